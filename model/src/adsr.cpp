@@ -0,0 +1,127 @@
+#include "adsr.h"
+
+#include "fixed_point.h"
+#include "synth_config.h"
+
+#include <algorithm>
+
+namespace synth {
+
+namespace {
+
+constexpr int c_PHASE_WIDTH = 24;
+constexpr int32_t c_PHASE_MAX = (1 << (c_PHASE_WIDTH - 1)) - 1;
+
+} // namespace
+
+const int32_t Adsr::c_STEAL_RELEASE_CW = (1 << (c_PHASE_WIDTH - 1)) / (SYNTH_SAMPLE_RATE / 1000);
+
+Adsr::Adsr(int numChannels)
+    : noteOn(numChannels, false),
+      m_numChannels(numChannels),
+      m_state(numChannels, State::off),
+      m_phase(numChannels, 0),
+      m_steal(numChannels, false),
+      m_freed(numChannels, false)
+{
+}
+
+void Adsr::steal(int firstChannel, int count)
+{
+    for (int ch = std::max(firstChannel, 0); ch < std::min(firstChannel + count, m_numChannels); ch++)
+        m_steal[ch] = true;
+}
+
+uint32_t Adsr::quietestChannel() const
+{
+    const bool valid = m_quietestValid && !m_steal[m_quietestChannel];
+    return (uint32_t(m_quietestChannel) << 25) | (uint32_t(valid) << 24) | (uint32_t(m_quietestLevel) & 0xFFFFFF);
+}
+
+void Adsr::process(int32_t *output)
+{
+    unsigned activeChannelCount = 0;
+    // the level with bit 24 set for a held channel
+    bool     quietValid = false;
+    uint32_t quietKey = 0;
+    int      quietChannel = 0;
+
+    for (int ch = 0; ch < m_numChannels; ch++) {
+        const bool    stolen = m_steal[ch];
+        const State   last   = stolen && m_state[ch] != State::off ? State::release : m_state[ch];
+        const int32_t phase  = m_phase[ch];
+        const bool    gate   = noteOn[ch];
+        const int32_t release = stolen ? c_STEAL_RELEASE_CW : releaseCw;
+
+        int64_t temp;
+        switch (last) {
+        case State::attack:  temp = wrapSigned(int64_t(phase) + attackCw, c_PHASE_WIDTH); break;
+        case State::decay:   temp = wrapSigned(int64_t(phase) - decayCw, c_PHASE_WIDTH);  break;
+        case State::sustain: temp = phase;                                                break;
+        case State::release: temp = wrapSigned(int64_t(phase) - release, c_PHASE_WIDTH);  break;
+        default:             temp = 0;                                                    break;
+        }
+
+        State   next      = last;
+        int64_t phaseNext = temp;
+        switch (last) {
+        case State::off:
+            phaseNext = 0;
+            next = gate ? State::attack : State::off;
+            break;
+        case State::attack:
+            if (temp < 0) {
+                // the accumulator overflowed, hold at full scale
+                phaseNext = c_PHASE_MAX;
+                next = gate ? State::decay : State::release;
+            } else {
+                next = gate ? State::attack : State::release;
+            }
+            break;
+        case State::decay:
+            if (temp <= sustainLevel || temp < 0) {
+                phaseNext = sustainLevel;
+                next = gate ? State::sustain : State::release;
+            } else {
+                next = gate ? State::decay : State::release;
+            }
+            break;
+        case State::sustain:
+            next = gate ? State::sustain : State::release;
+            break;
+        case State::release:
+            if (temp < 0) {
+                phaseNext = 0;
+                next = State::off;
+            }
+            break;
+        }
+
+        m_state[ch] = next;
+        m_phase[ch] = int32_t(phaseNext);
+        output[ch]  = int32_t(phaseNext);
+        m_freed[ch] = last != State::off && next == State::off;
+        if (next != State::off)
+            activeChannelCount++;
+
+        if (last == State::off || next == State::off)
+            m_steal[ch] = false;
+        if (next != State::off && !stolen) {
+            // ranked release, then decay and sustain, then attack
+            const uint32_t rank = next == State::release ? 0 : next == State::attack ? 2 : 1;
+            const uint32_t key = (rank << c_PHASE_WIDTH) | (uint32_t(phaseNext) & 0xFFFFFF);
+            if (!quietValid || key < quietKey) {
+                quietValid = true;
+                quietKey = key;
+                quietChannel = ch;
+            }
+        }
+    }
+
+    m_activeChannelCount = activeChannelCount;
+    m_quietestValid   = quietValid;
+    m_quietestChannel = quietChannel;
+    m_quietestLevel   = int32_t(quietKey & 0xFFFFFF);
+}
+
+} // namespace synth
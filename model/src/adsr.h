@@ -0,0 +1,77 @@
+// ADSR
+// Description:
+// Bit accurate model of adsr.vhd. Each channel has a 24 bit phase accumulator
+// stepped by the attack, decay and release control words, the envelope output
+// is the phase. The control words are the shared registers, the per voice
+// parameter RAM of ADSR_v2_0.vhd is not modelled.
+//
+// Parameters (register values):
+// attackCw, decayCw, releaseCw: Q1.23 step per sample period
+// sustainLevel: Q1.23
+// noteOn: gate per channel
+//
+// A stolen channel releases with c_STEAL_RELEASE_CW whatever its state and
+// gate until it is off, then restarts its attack if its gate is on. Each
+// sample period the quietest sounding channel that is not being stolen is
+// latched for the steal register, released channels before held ones and
+// held ones before those still in their attack. The channels that reach
+// off, stolen ones included, are flagged for the sample period, the
+// o_freed_en pulses of the voice freed registers.
+
+#ifndef ADSR_H
+#define ADSR_H
+
+#include <cstdint>
+#include <vector>
+
+namespace synth {
+
+class Adsr {
+public:
+    enum class State { off, attack, decay, sustain, release };
+
+    static const int32_t c_STEAL_RELEASE_CW;   // full scale to zero in 1 ms
+
+    explicit Adsr(int numChannels = 128);
+
+    // one sample period, an envelope sample per channel
+    void process(int32_t *output);
+
+    // a write of the steal register, count channels from firstChannel
+    void steal(int firstChannel, int count);
+    bool stealing(int channel) const { return m_steal[channel]; }
+    // the steal register on read, {channel[31:25], valid[24], level[23:0]} of
+    // the quietest channel of the last sample period, not valid when it has
+    // been stolen since or no channel was left to steal
+    uint32_t quietestChannel() const;
+
+    // o_active_channel_count of the last sample period, 0 to numChannels
+    unsigned activeChannelCount() const { return m_activeChannelCount; }
+    bool channelFree(int channel) const { return m_state[channel] == State::off; }
+    // the channel reached off in the last sample period
+    bool freed(int channel) const { return m_freed[channel]; }
+    State state(int channel) const { return m_state[channel]; }
+
+    int numChannels() const { return m_numChannels; }
+
+    int32_t attackCw     = 0;
+    int32_t decayCw      = 0;
+    int32_t sustainLevel = 0;
+    int32_t releaseCw    = 0;
+    std::vector<bool> noteOn;
+
+private:
+    int m_numChannels;
+    std::vector<State>   m_state;
+    std::vector<int32_t> m_phase;
+    std::vector<bool>    m_steal;
+    std::vector<bool>    m_freed;
+    unsigned m_activeChannelCount = 0;
+    bool     m_quietestValid = false;
+    int      m_quietestChannel = 0;
+    int32_t  m_quietestLevel = 0;
+};
+
+} // namespace synth
+
+#endif
@@ -0,0 +1,217 @@
+// Benchmark
+// Description:
+// Throughput of the reference models and of the vector engine. All 128
+// channels play a three oscillator patch with pulse width and cutoff
+// modulation, resonance and stereo panning, both engines render the same
+// samples on one core and the outputs are compared. The number of voices a
+// core renders in real time is the channel count times the realtime factor.
+// The vector engine is then run on the parallel renderer with 1 to --threads
+// threads (the hardware threads by default) for the scaling, every output is
+// checked against the single threaded one.
+//
+// Usage:
+// synth_benchmark [--rate 48000|96000|192000] [--seconds S] [--tanh polynomial|lut]
+//                 [--oversample] [--threads N] [--wavetables DIR]
+
+#include "parallel_renderer.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <exception>
+#include <string>
+#include <thread>
+#include <vector>
+
+#ifndef SYNTH_WAVETABLE_DIR
+#define SYNTH_WAVETABLE_DIR "repo/Oscillator_2.0/src"
+#endif
+
+namespace {
+
+void usage()
+{
+    std::fprintf(stderr, "usage: synth_benchmark [--rate 48000|96000|192000] [--seconds S] [--tanh polynomial|lut]\n"
+                         "                       [--oversample] [--threads N] [--wavetables DIR]\n");
+}
+
+struct Result {
+    double seconds;
+    std::vector<int32_t> output;
+};
+
+constexpr int c_VOICES = synth::Synthesizer::c_NUM_CHANNELS;
+
+void setPatch(synth::Synthesizer &synthesizer, bool oversample)
+{
+    synthesizer.setOscillatorWaveform(0, 1);
+    synthesizer.setOscillatorWaveform(1, 3);
+    synthesizer.setOscillatorWaveform(2, 2);
+    synthesizer.setOscillatorDetune(1, 7);
+    synthesizer.setOscillatorDetune(2, -12);
+    for (int osc = 0; osc < synth::Synthesizer::c_NUM_OSCILLATORS; osc++)
+        synthesizer.setOscillatorMix(osc, 0.33);
+    synthesizer.setOscillatorPulseWidth(1, 0.3);
+    synthesizer.setAdsrAttack(0, 0.01);
+    synthesizer.setAdsrDecay(0, 0.2);
+    synthesizer.setAdsrSustain(0, 0.7);
+    synthesizer.setAdsrAttack(1, 0.05);
+    synthesizer.setAdsrDecay(1, 0.5);
+    synthesizer.setAdsrSustain(1, 0.3);
+    synthesizer.setFilterCutoffFrequency(1200);
+    synthesizer.setFilterResonance(2.5);
+    synthesizer.setFilterEnvelopeAmount(0.4);
+    synthesizer.setFilterKeyTracking(0.5);
+    synthesizer.setFilterOversampling(oversample);
+    synthesizer.setLfoWaveform(1, 0);
+    synthesizer.setLfoRate(1, 0.25);
+    synthesizer.setLfoAmount(1, 0.3);
+    synthesizer.setLfoWaveform(2, 2);
+    synthesizer.setLfoRate(2, 0.7);
+    synthesizer.setLfoAmount(2, 0.5);
+    synthesizer.setMixerStereo(1);
+    for (int ch = 0; ch < c_VOICES; ch++)
+        synthesizer.setMixerVoicePan(ch, (ch % 17) / 8.0f - 1.0f);
+}
+
+Result run(const synth::Wavetables &tables, unsigned rateCode, synth::MoogLadderFilter::TanhImplementation tanh,
+           bool oversample, synth::Synthesizer::Engine engine, double length)
+{
+    synth::Synthesizer synthesizer(tables, rateCode, c_VOICES, tanh, engine);
+    setPatch(synthesizer, oversample);
+    for (int ch = 0; ch < c_VOICES; ch++)
+        synthesizer.noteOn(unsigned(ch));
+
+    const long samples = long(length * synthesizer.sampleRate());
+    Result result;
+    result.output.reserve(2 * samples);
+    const auto start = std::chrono::steady_clock::now();
+    for (long n = 0; n < samples; n++) {
+        int32_t left, right;
+        synthesizer.process(left, right);
+        result.output.push_back(left);
+        result.output.push_back(right);
+    }
+    result.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return result;
+}
+
+Result runParallel(const synth::Wavetables &tables, unsigned rateCode, synth::MoogLadderFilter::TanhImplementation tanh,
+                   bool oversample, int threads, double length)
+{
+    synth::ParallelRenderer renderer(tables, rateCode, c_VOICES, tanh, synth::Synthesizer::Engine::vector, threads);
+    renderer.configure([&](synth::Synthesizer &synthesizer) { setPatch(synthesizer, oversample); });
+    for (int ch = 0; ch < c_VOICES; ch++)
+        renderer.noteOn(unsigned(ch));
+
+    const long samples = long(length * renderer.sampleRate());
+    std::vector<int32_t> left(samples), right(samples);
+    const auto start = std::chrono::steady_clock::now();
+    renderer.render(samples, left.data(), right.data());
+    Result result;
+    result.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    result.output.reserve(2 * samples);
+    for (long n = 0; n < samples; n++) {
+        result.output.push_back(left[n]);
+        result.output.push_back(right[n]);
+    }
+    return result;
+}
+
+// the first differing sample period, or -1
+long firstDifference(const Result &a, const Result &b)
+{
+    if (a.output == b.output)
+        return -1;
+    size_t n = 0;
+    while (a.output[n] == b.output[n])
+        n++;
+    return long(n / 2);
+}
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+    unsigned rateCode = 1;
+    double length = 2.0;
+    bool oversample = false;
+    auto tanh = synth::MoogLadderFilter::TanhImplementation::polynomial;
+    int maxThreads = std::max(1u, std::thread::hardware_concurrency());
+    std::string wavetableDir = SYNTH_WAVETABLE_DIR;
+
+    for (int i = 1; i < argc; i++) {
+        const std::string arg = argv[i];
+        const bool hasValue = i + 1 < argc;
+        if (arg == "--rate" && hasValue) {
+            const std::string rate = argv[++i];
+            if (rate == "48000")       rateCode = 0;
+            else if (rate == "96000")  rateCode = 1;
+            else if (rate == "192000") rateCode = 2;
+            else { usage(); return 1; }
+        } else if (arg == "--seconds" && hasValue) {
+            length = std::atof(argv[++i]);
+        } else if (arg == "--tanh" && hasValue) {
+            const std::string value = argv[++i];
+            if (value == "polynomial") tanh = synth::MoogLadderFilter::TanhImplementation::polynomial;
+            else if (value == "lut")   tanh = synth::MoogLadderFilter::TanhImplementation::lookupTable;
+            else { usage(); return 1; }
+        } else if (arg == "--oversample") {
+            oversample = true;
+        } else if (arg == "--threads" && hasValue) {
+            maxThreads = std::atoi(argv[++i]);
+        } else if (arg == "--wavetables" && hasValue) {
+            wavetableDir = argv[++i];
+        } else {
+            usage();
+            return 1;
+        }
+    }
+    if (!(length > 0.0) || maxThreads < 1 || maxThreads > synth::ParallelRenderer::c_MAX_THREADS) {
+        usage();
+        return 1;
+    }
+
+    try {
+        const synth::Wavetables tables = synth::Wavetables::load(wavetableDir);
+        const Result reference = run(tables, rateCode, tanh, oversample, synth::Synthesizer::Engine::reference, length);
+        const Result vector = run(tables, rateCode, tanh, oversample, synth::Synthesizer::Engine::vector, length);
+
+        std::printf("%d voices, %.0f Hz, %.2f s\n", synth::Synthesizer::c_NUM_CHANNELS, 48000.0 * (1 << rateCode), length);
+        std::printf("%-10s %10s %10s %12s\n", "engine", "time", "realtime", "voices/core");
+        for (const auto &entry : { std::make_pair("reference", &reference), std::make_pair("vector", &vector) }) {
+            const double factor = length / entry.second->seconds;
+            std::printf("%-10s %9.2fs %9.2fx %12.0f\n", entry.first, entry.second->seconds, factor,
+                        factor * synth::Synthesizer::c_NUM_CHANNELS);
+        }
+
+        const long difference = firstDifference(vector, reference);
+        if (difference >= 0) {
+            std::printf("outputs differ from sample %ld\n", difference);
+            return 1;
+        }
+        std::printf("outputs identical, speedup %.2fx\n", reference.seconds / vector.seconds);
+
+        std::printf("\n%-10s %10s %10s %12s %10s\n", "threads", "time", "realtime", "voices", "scaling");
+        double single = 0.0;
+        for (int threads = 1; threads <= maxThreads; threads++) {
+            const Result parallel = runParallel(tables, rateCode, tanh, oversample, threads, length);
+            if (threads == 1)
+                single = parallel.seconds;
+            const double factor = length / parallel.seconds;
+            std::printf("%-10d %9.2fs %9.2fx %12.0f %9.2fx\n", threads, parallel.seconds, factor,
+                        factor * synth::Synthesizer::c_NUM_CHANNELS, single / parallel.seconds);
+            const long parallelDifference = firstDifference(parallel, vector);
+            if (parallelDifference >= 0) {
+                std::printf("outputs of %d threads differ from sample %ld\n", threads, parallelDifference);
+                return 1;
+            }
+        }
+        std::printf("outputs identical for 1 to %d threads\n", maxThreads);
+    } catch (const std::exception &e) {
+        std::fprintf(stderr, "synth_benchmark: %s\n", e.what());
+        return 1;
+    }
+    return 0;
+}
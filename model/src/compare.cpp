@@ -0,0 +1,103 @@
+// Compare
+// Description:
+// Checks a tb_system run for bit exact equivalence with the models. Replays
+// the register script of the run on the models and compares them with the
+// stream logs, oscillator.log, adsr.log, nca.log, filter.log and mixer.log in
+// LOG_DIR (see rtl_compare.h). Prints the frames compared and the first
+// mismatches of each stream and fails when a stream differs or has no frames.
+//
+// Usage:
+// synth_compare [--channels N] [--oscillators N] [--tanh polynomial|lut]
+//               [--wavetables DIR] SCRIPT LOG_DIR
+
+#include "register_script.h"
+#include "rtl_compare.h"
+
+#include <array>
+#include <cstdio>
+#include <cstdlib>
+#include <exception>
+#include <string>
+
+#ifndef SYNTH_WAVETABLE_DIR
+#define SYNTH_WAVETABLE_DIR "repo/Oscillator_2.0/src"
+#endif
+
+namespace {
+
+void usage()
+{
+    std::fprintf(stderr, "usage: synth_compare [--channels N] [--oscillators N] [--tanh polynomial|lut]\n"
+                         "                     [--wavetables DIR] SCRIPT LOG_DIR\n");
+}
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+    int channels = 8;
+    int oscillators = 2;
+    auto tanh = synth::MoogLadderFilter::TanhImplementation::polynomial;
+    std::string wavetableDir = SYNTH_WAVETABLE_DIR;
+    std::string scriptPath, logDir;
+
+    for (int i = 1; i < argc; i++) {
+        const std::string arg = argv[i];
+        const bool hasValue = i + 1 < argc;
+        if (arg == "--channels" && hasValue) {
+            channels = std::atoi(argv[++i]);
+        } else if (arg == "--oscillators" && hasValue) {
+            oscillators = std::atoi(argv[++i]);
+        } else if (arg == "--tanh" && hasValue) {
+            const std::string value = argv[++i];
+            if (value == "polynomial") tanh = synth::MoogLadderFilter::TanhImplementation::polynomial;
+            else if (value == "lut")   tanh = synth::MoogLadderFilter::TanhImplementation::lookupTable;
+            else { usage(); return 1; }
+        } else if (arg == "--wavetables" && hasValue) {
+            wavetableDir = argv[++i];
+        } else if (arg.rfind("--", 0) == 0) {
+            usage();
+            return 1;
+        } else if (scriptPath.empty()) {
+            scriptPath = arg;
+        } else if (logDir.empty()) {
+            logDir = arg;
+        } else {
+            usage();
+            return 1;
+        }
+    }
+    if (logDir.empty()) {
+        usage();
+        return 1;
+    }
+
+    try {
+        using synth::RtlCompare;
+        const synth::Wavetables tables = synth::Wavetables::load(wavetableDir);
+        const synth::RegisterScript script = synth::RegisterScript::load(scriptPath);
+        std::array<synth::StreamLog, RtlCompare::c_NUM_STREAMS> logs;
+        for (int s = 0; s < RtlCompare::c_NUM_STREAMS; s++)
+            logs[s] = synth::StreamLog::load(logDir + "/" + RtlCompare::streamName(RtlCompare::Stream(s)) + ".log");
+
+        const RtlCompare comparison(tables, channels, oscillators, tanh);
+        const auto results = comparison.compare(script, logs);
+
+        bool passed = true;
+        for (int s = 0; s < RtlCompare::c_NUM_STREAMS; s++) {
+            const RtlCompare::Result &result = results[s];
+            std::printf("%-10s %8ld frames %8ld mismatches\n", RtlCompare::streamName(RtlCompare::Stream(s)),
+                        result.frames, result.mismatches);
+            for (const RtlCompare::Mismatch &m : result.first)
+                std::printf("  frame %ld (sample period %ld) channel %d: rtl %d model %d\n",
+                            m.frame, m.period, m.channel, m.rtl, m.model);
+            if (result.frames == 0 || result.mismatches != 0)
+                passed = false;
+        }
+        std::printf("%s\n", passed ? "bit exact" : "FAILED");
+        return passed ? 0 : 1;
+    } catch (const std::exception &e) {
+        std::fprintf(stderr, "synth_compare: %s\n", e.what());
+        return 1;
+    }
+}
@@ -0,0 +1,65 @@
+/* Firmware
+ * Description:
+ * Synthesizer.h of the SDK application built for the host, see firmware.h.
+ */
+
+#include "firmware.h"
+#include "firmware_host.h"
+
+#include <math.h>
+#include <stdint.h>
+
+#include "Synthesizer.h"
+
+void firmwareInit(unsigned unisonVoices, unsigned stealPolicy, float attack, float decay, float sustain,
+                  float release)
+{
+    const u32 adsr[] = { ADSR_ADDR, FILTER_ADSR_ADDR };
+    for (unsigned i = 0; i < sizeof(adsr)/sizeof(adsr[0]); i++) {
+        setAdsrAttack(adsr[i], attack);
+        setAdsrSustain(adsr[i], sustain);
+        setAdsrDecay(adsr[i], decay);
+        setAdsrRelease(adsr[i], release);
+    }
+    SynthSetStealPolicy(stealPolicy);
+    SynthSetUnison(unisonVoices);
+    setAdsrVoiceFreedIrq(ADSR_ADDR, 1);
+}
+
+void firmwareMidiBytes(const uint8_t *bytes, unsigned count)
+{
+    unsigned i = 0;
+    while (i < count) {
+        const uint8_t status = bytes[i++];
+        const unsigned length = (unsigned)SynthMidiDataLength(status);
+        if (i + length > count)
+            break;
+        SynthMidiMessage(status, bytes + i);
+        i += length;
+    }
+}
+
+void firmwareVoiceFreed(void)
+{
+    SynthVoiceFreed();
+}
+
+int firmwareNumChannels(void)
+{
+    return NUM_CHANNELS;
+}
+
+unsigned firmwareUnisonVoices(void)
+{
+    return unisonVoices;
+}
+
+int firmwareAssignedNote(int channel)
+{
+    return assignedChannels[channel];
+}
+
+uint32_t firmwareVoiceSteals(void)
+{
+    return voiceSteals;
+}
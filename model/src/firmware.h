@@ -0,0 +1,43 @@
+// Firmware
+// Description:
+// The MIDI handling of the firmware, Synthesizer.h compiled for the host in
+// firmware.c against RegisterSpace (register_space.h). The firmware state is
+// global, as on the target, so there is one firmware per process and a
+// RegisterSpace has to be attached before any call.
+
+#ifndef FIRMWARE_H
+#define FIRMWARE_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// sets the envelope times and sustain level of both ADSRs with the firmware
+// setters, SynthSetStealPolicy(stealPolicy), one of the STEAL_ values 0 to 3,
+// then SynthSetUnison(unisonVoices), which releases every channel, and enables
+// the voice freed interrupt of the amplitude ADSR
+void firmwareInit(unsigned unisonVoices, unsigned stealPolicy, float attack, float decay, float sustain,
+                  float release);
+
+// bytes received on the MIDI UART, each status byte is followed by its data
+// bytes as read by MIDIInterruptHandler, an incomplete message is dropped
+void firmwareMidiBytes(const uint8_t *bytes, unsigned count);
+
+// the voice freed interrupt handler, called while RegisterSpace::voiceFreedIrq(0)
+void firmwareVoiceFreed(void);
+
+// NUM_CHANNELS, the unison voices of a note and the note a channel is
+// assigned to, -1 when the channel is not assigned
+int firmwareNumChannels(void);
+unsigned firmwareUnisonVoices(void);
+int firmwareAssignedNote(int channel);
+// note ons that stole a channel group
+uint32_t firmwareVoiceSteals(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,51 @@
+/* Firmware Host
+ * Description:
+ * The parts of the Xilinx standalone BSP that Synthesizer.h uses, so the
+ * firmware compiles on the host against RegisterSpace (register_space.h).
+ * Xil_In32 and Xil_Out32 are AXI-Lite accesses of the register space, the
+ * cache maintenance is a no-op. The base addresses follow the 64 KB address
+ * segments of the block design, they only have to be distinct.
+ */
+
+#ifndef FIRMWARE_HOST_H
+#define FIRMWARE_HOST_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef uint8_t   u8;
+typedef uint16_t  u16;
+typedef uint32_t  u32;
+typedef uintptr_t UINTPTR;
+
+u32 Xil_In32(UINTPTR address);
+void Xil_Out32(UINTPTR address, u32 value);
+
+static inline void Xil_DCacheFlushRange(UINTPTR address, u32 length) { (void)address; (void)length; }
+static inline void Xil_DCacheInvalidateRange(UINTPTR address, u32 length) { (void)address; (void)length; }
+
+#ifdef __cplusplus
+}
+#endif
+
+#define XPAR_OSCILLATOR_0_S_AXI_CTRL_BASEADDR           0x43C00000
+#define XPAR_ADSR_0_S_AXI_CTRL_BASEADDR                 0x43C10000
+#define XPAR_ADSR_1_S_AXI_CTRL_BASEADDR                 0x43C20000
+#define XPAR_MOOG_LADDER_FILTER_0_S_AXI_CTRL_BASEADDR   0x43C30000
+#define XPAR_LFO_0_S_AXI_CTRL_BASEADDR                  0x43C40000
+#define XPAR_MULTIPLIER_0_S_AXI_CTRL_BASEADDR           0x43C50000
+#define XPAR_MOD_MATRIX_0_S_AXI_CTRL_BASEADDR           0x43C60000
+#define XPAR_OSCILLATOR_0_S_AXI_PARAM_BASEADDR          0x43C70000
+#define XPAR_ADSR_0_S_AXI_PARAM_BASEADDR                0x43C80000
+#define XPAR_ADSR_1_S_AXI_PARAM_BASEADDR                0x43C90000
+#define XPAR_PARAM_STREAM_0_S_AXI_CTRL_BASEADDR         0x43CA0000
+#define XPAR_AUDIO_CAPTURE_0_S_AXI_CTRL_BASEADDR        0x43CB0000
+#define XPAR_MIXER_0_S_AXI_CTRL_BASEADDR                0x43CC0000
+#define XPAR_EFFECTS_0_S_AXI_CTRL_BASEADDR              0x43CD0000
+#define XPAR_AXI_DMA_0_BASEADDR                         0x40400000
+#define XPAR_AXI_GPIO_2_BASEADDR                        0x41220000
+
+#endif
@@ -0,0 +1,40 @@
+// Fixed Point
+// Description:
+// ieee.numeric_std arithmetic on integers. A signed or unsigned vector of N
+// bits is held as its integer value in an int64_t, which is wide enough for
+// every product and sum in the DSP modules (the widest is 47 bits). Right
+// shifts of negative values are arithmetic, as numeric_std shift_right of a
+// signed vector.
+
+#ifndef FIXED_POINT_H
+#define FIXED_POINT_H
+
+#include <cstdint>
+
+namespace synth {
+
+// two's complement wrap to N bits, the result of an N bit sum or of to_signed
+inline int64_t wrapSigned(int64_t value, int bits)
+{
+    const uint64_t mask = (uint64_t(1) << bits) - 1;
+    const uint64_t u = uint64_t(value) & mask;
+    return (u >> (bits - 1)) ? int64_t(u | ~mask) : int64_t(u);
+}
+
+// wrap to N bits, the result of an N bit unsigned sum, resize or to_unsigned
+inline uint64_t wrapUnsigned(uint64_t value, int bits)
+{
+    return value & ((uint64_t(1) << bits) - 1);
+}
+
+// resize of a signed vector, when truncating the sign bit is kept along with
+// the N-1 rightmost bits
+inline int64_t resizeSigned(int64_t value, int bits)
+{
+    const int64_t low = value & ((int64_t(1) << (bits - 1)) - 1);
+    return value < 0 ? low - (int64_t(1) << (bits - 1)) : low;
+}
+
+} // namespace synth
+
+#endif
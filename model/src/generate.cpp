@@ -0,0 +1,87 @@
+// Generate
+// Description:
+// Generates the bandlimited sawtooth and triangle wavetables of the
+// oscillator (see wavetable_generator.h) and writes their BRAM
+// initialisation images to OUTPUT_DIR, the VHDL package by default. The
+// package of the oscillator is generated with the default settings into
+// repo/Oscillator_2.0/src. --format may be given more than once.
+//
+// Usage:
+// synth_generate [--harmonics N] [--length N] [--width BITS] [--octaves N]
+//                [--headroom BITS] [--format vhdl|coe|mem|bin] OUTPUT_DIR
+
+#include "wavetable_generator.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <exception>
+#include <string>
+#include <vector>
+
+namespace {
+
+void usage()
+{
+    std::fprintf(stderr, "usage: synth_generate [--harmonics N] [--length N] [--width BITS] [--octaves N]\n"
+                         "                      [--headroom BITS] [--format vhdl|coe|mem|bin] OUTPUT_DIR\n");
+}
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+    using synth::WavetableGenerator;
+
+    synth::WavetableSettings settings;
+    std::vector<WavetableGenerator::Format> formats;
+    std::string directory;
+
+    for (int i = 1; i < argc; i++) {
+        const std::string arg = argv[i];
+        const bool hasValue = i + 1 < argc;
+        if (arg == "--harmonics" && hasValue) {
+            settings.harmonics = std::atoi(argv[++i]);
+        } else if (arg == "--length" && hasValue) {
+            settings.length = std::atoi(argv[++i]);
+        } else if (arg == "--width" && hasValue) {
+            settings.width = std::atoi(argv[++i]);
+        } else if (arg == "--octaves" && hasValue) {
+            settings.octaves = std::atoi(argv[++i]);
+        } else if (arg == "--headroom" && hasValue) {
+            settings.headroom = std::atoi(argv[++i]);
+        } else if (arg == "--format" && hasValue) {
+            const std::string value = argv[++i];
+            if (value == "vhdl")     formats.push_back(WavetableGenerator::Format::vhdl);
+            else if (value == "coe") formats.push_back(WavetableGenerator::Format::coe);
+            else if (value == "mem") formats.push_back(WavetableGenerator::Format::mem);
+            else if (value == "bin") formats.push_back(WavetableGenerator::Format::bin);
+            else { usage(); return 1; }
+        } else if (arg.rfind("--", 0) == 0 || !directory.empty()) {
+            usage();
+            return 1;
+        } else {
+            directory = arg;
+        }
+    }
+    if (directory.empty()) {
+        usage();
+        return 1;
+    }
+    if (formats.empty())
+        formats.push_back(WavetableGenerator::Format::vhdl);
+
+    try {
+        const auto start = std::chrono::steady_clock::now();
+        const WavetableGenerator generator(settings);
+        for (WavetableGenerator::Format format : formats)
+            generator.write(format, directory);
+        const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        std::printf("%d octaves of %d entries of %d bits, %d harmonics, in %.2f s\n", settings.octaves,
+                    settings.length, settings.width, settings.harmonics, seconds);
+        return 0;
+    } catch (const std::exception &e) {
+        std::fprintf(stderr, "synth_generate: %s\n", e.what());
+        return 1;
+    }
+}
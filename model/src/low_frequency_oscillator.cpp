@@ -0,0 +1,48 @@
+#include "low_frequency_oscillator.h"
+
+#include "fixed_point.h"
+
+namespace synth {
+
+namespace {
+
+constexpr int c_DATA_WIDTH  = 24;
+constexpr int c_PHASE_WIDTH = 24;
+
+} // namespace
+
+LowFrequencyOscillator::LowFrequencyOscillator(const Wavetables &tables, int numChannels)
+    : channelOn(numChannels, false),
+      m_tables(tables),
+      m_numChannels(numChannels),
+      m_phase(numChannels, 0)
+{
+}
+
+void LowFrequencyOscillator::process(int32_t *output)
+{
+    // the monophonic accumulator steps once per sample period, before the first channel is issued
+    m_phaseMonophonic = uint32_t(wrapUnsigned(uint64_t(m_phaseMonophonic) + fcw, c_PHASE_WIDTH));
+
+    for (int ch = 0; ch < m_numChannels; ch++) {
+        const bool on = channelOn[ch];
+        const uint32_t next = on ? uint32_t(wrapUnsigned(uint64_t(m_phase[ch]) + fcw, c_PHASE_WIDTH)) : 0;
+        m_phase[ch] = next;
+        const uint32_t accumulator = polyphonic ? next : m_phaseMonophonic;
+
+        const int64_t saw    = wrapSigned(accumulator, c_DATA_WIDTH);
+        const int64_t sawAbs = saw > 0 ? saw : wrapSigned(-saw, c_DATA_WIDTH);
+
+        int64_t wave;
+        switch (waveform & 3) {
+        case 0:  wave = m_tables.sine[accumulator >> 16]; break;
+        case 1:  wave = saw; break;
+        case 2:  wave = wrapSigned(wrapSigned(sawAbs - (1 << (c_DATA_WIDTH - 2)), c_DATA_WIDTH) << 1, c_DATA_WIDTH); break;
+        default: wave = saw > 0 ? (1 << (c_DATA_WIDTH - 1)) - 1 : -((1 << (c_DATA_WIDTH - 1)) - 1); break;
+        }
+
+        output[ch] = on ? int32_t(resizeSigned((wave * wrapSigned(amount, 16)) >> 15, c_DATA_WIDTH)) : 0;
+    }
+}
+
+} // namespace synth
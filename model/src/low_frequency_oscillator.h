@@ -0,0 +1,48 @@
+// Low Frequency Oscillator
+// Description:
+// Bit accurate model of one LFO of low_frequency_oscillator.vhd. In
+// polyphonic mode every channel has its own phase accumulator, reset while the
+// channel is off so each note starts at phase zero. In monophonic mode all
+// channels read one free running accumulator.
+//
+// Parameters (register values):
+// fcw: 24 bit phase accumulator step per sample period
+// amount: Q1.15
+// waveform: sine (0), sawtooth (1), triangle (2), square (3)
+// channelOn: per channel enable, the output of an off channel is zero
+
+#ifndef LOW_FREQUENCY_OSCILLATOR_H
+#define LOW_FREQUENCY_OSCILLATOR_H
+
+#include "wavetables.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace synth {
+
+class LowFrequencyOscillator {
+public:
+    LowFrequencyOscillator(const Wavetables &tables, int numChannels = 128);
+
+    // one sample period, a Q1.23 sample per channel
+    void process(int32_t *output);
+
+    int numChannels() const { return m_numChannels; }
+
+    uint32_t fcw        = 0;
+    int32_t  amount     = 0;
+    unsigned waveform   = 0;
+    bool     polyphonic = false;
+    std::vector<bool> channelOn;
+
+private:
+    const Wavetables &m_tables;
+    int m_numChannels;
+    uint32_t m_phaseMonophonic = 0;
+    std::vector<uint32_t> m_phase;
+};
+
+} // namespace synth
+
+#endif
@@ -0,0 +1,223 @@
+#include "midi_file.h"
+
+#include <algorithm>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+
+namespace synth {
+
+namespace {
+
+constexpr uint32_t c_DEFAULT_TEMPO = 500000;   // microseconds per quarter note, 120 BPM
+
+[[noreturn]] void error(const std::string &message)
+{
+    throw std::runtime_error("MIDI file: " + message);
+}
+
+class Reader {
+public:
+    Reader(const std::vector<uint8_t> &bytes, size_t begin, size_t end) : m_bytes(bytes), m_pos(begin), m_end(end) {}
+
+    bool atEnd() const { return m_pos >= m_end; }
+    size_t position() const { return m_pos; }
+
+    uint8_t byte()
+    {
+        if (m_pos >= m_end)
+            error("unexpected end of chunk");
+        return m_bytes[m_pos++];
+    }
+
+    uint8_t peek() const
+    {
+        if (m_pos >= m_end)
+            error("unexpected end of chunk");
+        return m_bytes[m_pos];
+    }
+
+    uint32_t bigEndian(int bytes)
+    {
+        uint32_t value = 0;
+        for (int i = 0; i < bytes; i++)
+            value = (value << 8) | byte();
+        return value;
+    }
+
+    // variable length quantity, at most 4 bytes
+    uint32_t variable()
+    {
+        uint32_t value = 0;
+        for (int i = 0; i < 4; i++) {
+            const uint8_t b = byte();
+            value = (value << 7) | (b & 0x7F);
+            if (!(b & 0x80))
+                return value;
+        }
+        error("variable length quantity longer than 4 bytes");
+    }
+
+    void skip(uint32_t bytes)
+    {
+        if (bytes > m_end - m_pos)
+            error("unexpected end of chunk");
+        m_pos += bytes;
+    }
+
+private:
+    const std::vector<uint8_t> &m_bytes;
+    size_t m_pos;
+    size_t m_end;
+};
+
+struct TimedEvent {
+    uint64_t  tick;
+    MidiEvent event;
+};
+
+struct TempoChange {
+    uint64_t tick;
+    uint32_t tempo;
+};
+
+int dataLength(uint8_t status)
+{
+    const uint8_t type = status & 0xF0;
+    return (type == 0xC0 || type == 0xD0) ? 1 : 2;
+}
+
+void readTrack(Reader &track, std::vector<TimedEvent> &events, std::vector<TempoChange> &tempo)
+{
+    uint64_t tick = 0;
+    uint8_t runningStatus = 0;
+
+    while (!track.atEnd()) {
+        tick += track.variable();
+        uint8_t status = track.peek();
+        if (status & 0x80) {
+            track.byte();
+        } else {
+            if (!runningStatus)
+                error("data byte without a running status");
+            status = runningStatus;
+        }
+
+        if (status == 0xFF) {
+            const uint8_t type = track.byte();
+            const uint32_t length = track.variable();
+            if (type == 0x51 && length == 3) {
+                tempo.push_back({ tick, track.bigEndian(3) });
+            } else if (type == 0x2F) {
+                track.skip(length);
+                return;
+            } else {
+                track.skip(length);
+            }
+            runningStatus = 0;
+        } else if (status == 0xF0 || status == 0xF7) {
+            track.skip(track.variable());
+            runningStatus = 0;
+        } else if (status >= 0xF0) {
+            error("system common message in a track");
+        } else {
+            TimedEvent timed{ tick, MidiEvent() };
+            timed.event.status = status;
+            timed.event.length = dataLength(status);
+            for (int i = 0; i < timed.event.length; i++) {
+                timed.event.data[i] = track.byte();
+                if (timed.event.data[i] & 0x80)
+                    error("status byte in the data of a message");
+            }
+            events.push_back(timed);
+            runningStatus = status;
+        }
+    }
+}
+
+} // namespace
+
+MidiFile MidiFile::parse(std::istream &input)
+{
+    const std::vector<uint8_t> bytes((std::istreambuf_iterator<char>(input)), std::istreambuf_iterator<char>());
+
+    Reader file(bytes, 0, bytes.size());
+    std::vector<TimedEvent> events;
+    std::vector<TempoChange> tempo;
+    uint16_t division = 0;
+    bool header = false;
+
+    while (!file.atEnd()) {
+        const uint32_t id = file.bigEndian(4);
+        const uint32_t length = file.bigEndian(4);
+        const size_t begin = file.position();
+        file.skip(length);
+
+        Reader chunk(bytes, begin, begin + length);
+        if (id == 0x4D546864) {         // MThd
+            const uint32_t format = chunk.bigEndian(2);
+            chunk.bigEndian(2);
+            division = uint16_t(chunk.bigEndian(2));
+            if (format > 1)
+                error("format " + std::to_string(format) + " is not supported");
+            if (division == 0)
+                error("division of 0 ticks");
+            header = true;
+        } else if (id == 0x4D54726B) {  // MTrk
+            if (!header)
+                error("track before the header");
+            readTrack(chunk, events, tempo);
+        }
+    }
+    if (!header)
+        error("no header chunk");
+
+    // stable, the events of a track are in tick order and the tracks in file order
+    std::stable_sort(events.begin(), events.end(),
+                     [](const TimedEvent &a, const TimedEvent &b) { return a.tick < b.tick; });
+    std::stable_sort(tempo.begin(), tempo.end(),
+                     [](const TempoChange &a, const TempoChange &b) { return a.tick < b.tick; });
+
+    MidiFile midi;
+    midi.m_events.reserve(events.size());
+    if (division & 0x8000) {
+        // SMPTE, -frames per second in the upper byte, 29 is 29.97 drop frame
+        const int frames = -int8_t(division >> 8);
+        const double rate = (frames == 29 ? 29.97 : frames) * (division & 0xFF);
+        if (rate <= 0)
+            error("invalid SMPTE division");
+        for (TimedEvent &timed : events) {
+            timed.event.time = timed.tick / rate;
+            midi.m_events.push_back(timed.event);
+        }
+    } else {
+        size_t next = 0;
+        uint64_t tempoTick = 0;
+        double tempoTime = 0.0;
+        uint32_t usPerQuarter = c_DEFAULT_TEMPO;
+        for (TimedEvent &timed : events) {
+            for (; next < tempo.size() && tempo[next].tick <= timed.tick; next++) {
+                tempoTime += double(tempo[next].tick - tempoTick) * usPerQuarter * 1e-6 / division;
+                tempoTick = tempo[next].tick;
+                usPerQuarter = tempo[next].tempo;
+            }
+            timed.event.time = tempoTime + double(timed.tick - tempoTick) * usPerQuarter * 1e-6 / division;
+            midi.m_events.push_back(timed.event);
+        }
+    }
+    return midi;
+}
+
+MidiFile MidiFile::load(const std::string &path)
+{
+    std::ifstream file(path, std::ios::binary);
+    if (!file)
+        throw std::runtime_error("can not open MIDI file " + path);
+    try {
+        return parse(file);
+    } catch (const std::runtime_error &e) {
+        throw std::runtime_error(path + ": " + e.what());
+    }
+}
+
+} // namespace synth
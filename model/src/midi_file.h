@@ -0,0 +1,47 @@
+// MIDI File
+// Description:
+// Reader of Standard MIDI Files, format 0 and 1. The channel messages of all
+// tracks are merged in time order, messages at the same tick keep the order
+// of their tracks. The times are in seconds, from the set tempo meta events of
+// any track (120 BPM until the first one) for a division in ticks per quarter
+// note, or from the frame rate and ticks per frame for an SMPTE division.
+// Running status is expanded, so every event is a complete message. System
+// exclusive and the other meta events are skipped.
+
+#ifndef MIDI_FILE_H
+#define MIDI_FILE_H
+
+#include <cstdint>
+#include <istream>
+#include <string>
+#include <vector>
+
+namespace synth {
+
+struct MidiEvent {
+    double  time = 0.0;
+    uint8_t status = 0;
+    uint8_t data[2] = {};
+    int     length = 0;   // data bytes, 1 or 2
+
+    // note on with a velocity, a note on with velocity 0 is a note off
+    bool isNoteOn() const { return (status & 0xF0) == 0x90 && data[1] != 0; }
+    bool isNoteOff() const { return (status & 0xF0) == 0x80 || ((status & 0xF0) == 0x90 && data[1] == 0); }
+};
+
+class MidiFile {
+public:
+    // throws std::runtime_error on a malformed or unsupported file
+    static MidiFile parse(std::istream &input);
+    static MidiFile load(const std::string &path);
+
+    const std::vector<MidiEvent> &events() const { return m_events; }   // in time order
+    double duration() const { return m_events.empty() ? 0.0 : m_events.back().time; }
+
+private:
+    std::vector<MidiEvent> m_events;
+};
+
+} // namespace synth
+
+#endif
@@ -0,0 +1,141 @@
+#include "midi_replay.h"
+
+#include "firmware.h"
+#include "register_space.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+
+namespace synth {
+
+namespace {
+
+int assignedChannels()
+{
+    int count = 0;
+    for (int c = 0; c < firmwareNumChannels(); c++)
+        count += firmwareAssignedNote(c) != -1;
+    return count;
+}
+
+MidiReplay::MessageType messageType(const MidiEvent &event)
+{
+    switch (event.status & 0xF0) {
+    case 0x80: return MidiReplay::noteOff;
+    case 0x90: return event.data[1] ? MidiReplay::noteOn : MidiReplay::noteOnVelocity0;
+    default:   return MidiReplay::other;
+    }
+}
+
+} // namespace
+
+const char *MidiReplay::messageTypeName(MessageType type)
+{
+    static const char *const c_NAMES[c_NUM_MESSAGE_TYPES] = { "note on", "note on vel 0", "note off", "other" };
+    return c_NAMES[type];
+}
+
+const char *MidiReplay::stealPolicyName(StealPolicy policy)
+{
+    static const char *const c_NAMES[] = { "none", "oldest", "quietest", "same-note" };
+    return c_NAMES[int(policy)];
+}
+
+MidiReplay::Report MidiReplay::run(const MidiFile &file, const Settings &settings)
+{
+    using Clock = std::chrono::steady_clock;
+
+    RegisterSpace registers;
+    registers.attach();
+    firmwareInit(settings.unisonVoices, unsigned(settings.stealPolicy), settings.attack, settings.decay,
+                 settings.sustain, settings.release);
+
+    Report report;
+    std::array<int, 128> held = {};   // note ons minus note offs of each note
+    std::vector<double> played;       // times of the notes played
+    long sample = 0;
+
+    // a sample period of the ADSRs and the voice freed interrupt it raised
+    auto process = [&]() {
+        registers.process();
+        if (registers.voiceFreedIrq(0)) {
+            const uint64_t accessesBefore = registers.reads() + registers.writes();
+            firmwareVoiceFreed();
+            report.voiceFreedInterrupts++;
+            report.voiceFreedAccesses += registers.reads() + registers.writes() - accessesBefore;
+        }
+    };
+
+    for (const MidiEvent &event : file.events()) {
+        const double time = event.time / settings.speed;
+        for (const long due = long(std::ceil(time * c_SAMPLE_RATE)); sample < due; sample++)
+            process();
+
+        const uint8_t bytes[3] = { event.status, event.data[0], event.data[1] };
+        const MessageType type = messageType(event);
+        const int before = assignedChannels();
+        const uint32_t stealsBefore = firmwareVoiceSteals();
+        const uint64_t accessesBefore = registers.reads() + registers.writes();
+
+        const Clock::time_point start = Clock::now();
+        firmwareMidiBytes(bytes, 1 + event.length);
+        const double nanoseconds = std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+
+        Cost &cost = report.cost[type];
+        const uint64_t accesses = registers.reads() + registers.writes() - accessesBefore;
+        cost.messages++;
+        cost.nanoseconds += nanoseconds;
+        cost.maxNanoseconds = std::max(cost.maxNanoseconds, nanoseconds);
+        cost.accesses += accesses;
+        cost.maxAccesses = std::max(cost.maxAccesses, accesses);
+
+        const int after = assignedChannels();
+        report.peakAssignedChannels = std::max(report.peakAssignedChannels, after);
+        if (type == noteOn || type == noteOnVelocity0) {
+            const bool stolen = firmwareVoiceSteals() != stealsBefore;
+            report.voiceSteals += stolen;
+            if (after > before || stolen) {
+                report.notesPlayed++;
+                played.push_back(time);
+            } else {
+                if (report.failures.size() < c_MAX_REPORTED)
+                    report.failures.push_back({ time, event.data[0], before });
+                report.allocationFailures++;
+            }
+        }
+
+        if (event.isNoteOn())
+            held[event.data[0]]++;
+        else if (event.isNoteOff() && held[event.data[0]] > 0)
+            held[event.data[0]]--;
+        report.seconds = time;
+    }
+
+    for (const long end = sample + long(std::ceil(settings.tail * c_SAMPLE_RATE)); sample < end; sample++)
+        process();
+
+    // the groups of the notes the file still holds are not stuck
+    const Adsr &amplitude = registers.adsr(0);
+    const int step = int(firmwareUnisonVoices());
+    for (int c = 0; c < firmwareNumChannels(); c += step) {
+        const int note = firmwareAssignedNote(c);
+        if (note >= 0 && held[note] > 0) {
+            held[note]--;
+            continue;
+        }
+        if (note >= 0 || !amplitude.channelFree(c))
+            report.stuckNotes.push_back({ c, note, bool(amplitude.noteOn[c]) });
+    }
+
+    if (report.seconds > 0)
+        report.notesPerSecond = report.notesPlayed / report.seconds;
+    for (size_t first = 0, last = 0; last < played.size(); last++) {
+        while (played[last] - played[first] >= 1.0)
+            first++;
+        report.peakNotesPerSecond = std::max(report.peakNotesPerSecond, long(last - first + 1));
+    }
+    return report;
+}
+
+} // namespace synth
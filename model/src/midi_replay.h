@@ -0,0 +1,102 @@
+// MIDI Replay
+// Description:
+// Plays a MIDI file through the MIDI handling of the firmware (firmware.h) on
+// a RegisterSpace, to reproduce the voice allocation of dense passages. Each
+// message is sent as the bytes MIDIInterruptHandler receives, with its status
+// byte, after the ADSRs have run up to the sample period of its time. The
+// speed divides the times of the file, a speed of 4 plays it four times as
+// fast against the same envelope times.
+//
+// Note ons are counted as played when the firmware assigned them a channel
+// group, free or stolen by the steal policy, and as allocation failures when
+// it did not. The firmware handles a
+// note on with velocity 0 as a note on, so those are counted as note ons and
+// separately. After the last message the ADSRs run for the tail, then a
+// channel group is a stuck note when the firmware still has it assigned to a
+// note the file does not hold (by the MIDI rules, velocity 0 releases), or
+// when its amplitude envelope has not returned to off.
+//
+// The voice freed interrupt of the amplitude ADSR is serviced after the sample
+// period that raised it, as the interrupt handler of the firmware. The cost of a
+// message is the number of register accesses the firmware made for it and its
+// host time, the accesses of the interrupts are counted apart.
+
+#ifndef MIDI_REPLAY_H
+#define MIDI_REPLAY_H
+
+#include "midi_file.h"
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+namespace synth {
+
+class MidiReplay {
+public:
+    static constexpr double c_SAMPLE_RATE   = 96000.0;   // the firmware runs at its reset rate
+    static constexpr size_t c_MAX_REPORTED  = 8;         // failures kept
+
+    enum MessageType { noteOn, noteOnVelocity0, noteOff, other, c_NUM_MESSAGE_TYPES };
+
+    // the STEAL_ policies of the firmware
+    enum class StealPolicy { none, oldest, quietest, sameNote };
+
+    // the firmware settings, the envelope times (seconds) and sustain level of
+    // both ADSRs, the unison voices of a note and the steal policy
+    struct Settings {
+        double   speed        = 1.0;
+        double   tail         = 1.0;   // seconds after the last message
+        unsigned unisonVoices = 1;
+        StealPolicy stealPolicy = StealPolicy::quietest;
+        float    attack       = 0.0;
+        float    decay        = 0.0;
+        float    sustain      = 1.0;
+        float    release      = 0.0;
+    };
+
+    struct Cost {
+        long     messages = 0;
+        double   nanoseconds = 0.0;
+        double   maxNanoseconds = 0.0;
+        uint64_t accesses = 0;
+        uint64_t maxAccesses = 0;
+    };
+
+    struct Failure {
+        double time;
+        int    note;
+        int    assignedChannels;
+    };
+
+    struct StuckNote {
+        int  channel;   // first channel of the group
+        int  note;      // -1 when the firmware has the channel unassigned
+        bool gate;      // amplitude ADSR note on
+    };
+
+    struct Report {
+        double seconds = 0.0;              // time of the last message after the speed
+        long   notesPlayed = 0;
+        long   voiceSteals = 0;            // notes played on a stolen group
+        long   voiceFreedInterrupts = 0;
+        uint64_t voiceFreedAccesses = 0;   // register accesses of the interrupts
+        long   allocationFailures = 0;
+        std::vector<Failure> failures;     // up to c_MAX_REPORTED
+        double notesPerSecond = 0.0;       // notes played over the whole file
+        long   peakNotesPerSecond = 0;     // notes played in any one second
+        int    peakAssignedChannels = 0;
+        std::array<Cost, c_NUM_MESSAGE_TYPES> cost;
+        std::vector<StuckNote> stuckNotes;
+    };
+
+    static const char *messageTypeName(MessageType type);
+    static const char *stealPolicyName(StealPolicy policy);
+
+    // the firmware state is global, one replay runs at a time
+    static Report run(const MidiFile &file, const Settings &settings);
+};
+
+} // namespace synth
+
+#endif
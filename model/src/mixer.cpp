@@ -0,0 +1,100 @@
+#include "mixer.h"
+
+#include "fixed_point.h"
+
+#include <array>
+#include <cmath>
+
+namespace synth {
+
+namespace {
+
+constexpr int c_DATA_WIDTH  = 24;
+constexpr int c_ACCUM_WIDTH = 7 + c_DATA_WIDTH;
+constexpr int c_PAN_SIZE    = 257;
+
+struct Tables {
+    std::array<int64_t, 128>        coefficients;
+    std::array<int64_t, c_PAN_SIZE> pan;
+
+    Tables()
+    {
+        // integer() of a real rounds to nearest
+        for (int idx = 0; idx < 128; idx++)
+            coefficients[idx] = std::lround(32767.0 / (idx + 1));
+        for (int idx = 0; idx < c_PAN_SIZE; idx++)
+            pan[idx] = std::lround(32767.0 * std::cos(idx * M_PI / 512.0));
+    }
+};
+
+const Tables &tables()
+{
+    static const Tables c_TABLES;
+    return c_TABLES;
+}
+
+} // namespace
+
+Mixer::Mixer(int numChannels)
+    : pan(numChannels, 128),
+      m_numChannels(numChannels)
+{
+}
+
+int32_t Mixer::normalise(int64_t accumulator, unsigned activeChannels)
+{
+    if (activeChannels == 0)
+        return int32_t(resizeSigned(accumulator, c_DATA_WIDTH));
+    if (activeChannels <= 8)
+        return int32_t(resizeSigned(accumulator >> 3, c_DATA_WIDTH));
+    return int32_t(resizeSigned((accumulator * tables().coefficients[activeChannels - 1]) >> 15, c_DATA_WIDTH));
+}
+
+int32_t Mixer::panGain(unsigned index)
+{
+    return int32_t(tables().pan[index > 256 ? 256 : index]);
+}
+
+void Mixer::process(const int32_t *input, unsigned activeChannels, int32_t &mono, int32_t &left, int32_t &right) const
+{
+    output(sum(input), activeChannels, mono, left, right);
+}
+
+Mixer::Sums Mixer::sum(const int32_t *input) const
+{
+    const Tables &t = tables();
+
+    Sums sums;
+    for (int ch = 0; ch < m_numChannels; ch++) {
+        sums.mono = wrapSigned(sums.mono + input[ch], c_ACCUM_WIDTH);
+        if (stereoEnable) {
+            const uint32_t p = pan[ch] > 256 ? 256 : pan[ch];
+            sums.left  = wrapSigned(sums.left + int64_t(input[ch]) * t.pan[p], c_ACCUM_WIDTH + 15);
+            sums.right = wrapSigned(sums.right + int64_t(input[ch]) * t.pan[256 - p], c_ACCUM_WIDTH + 15);
+        }
+    }
+    return sums;
+}
+
+Mixer::Sums Mixer::add(const Sums &a, const Sums &b)
+{
+    Sums sums;
+    sums.mono  = wrapSigned(a.mono + b.mono, c_ACCUM_WIDTH);
+    sums.left  = wrapSigned(a.left + b.left, c_ACCUM_WIDTH + 15);
+    sums.right = wrapSigned(a.right + b.right, c_ACCUM_WIDTH + 15);
+    return sums;
+}
+
+void Mixer::output(const Sums &sums, unsigned activeChannels, int32_t &mono, int32_t &left, int32_t &right) const
+{
+    mono = normalise(sums.mono, activeChannels);
+    if (stereoEnable) {
+        left  = normalise(resizeSigned(sums.left >> 15, c_ACCUM_WIDTH), activeChannels);
+        right = normalise(resizeSigned(sums.right >> 15, c_ACCUM_WIDTH), activeChannels);
+    } else {
+        left  = mono;
+        right = mono;
+    }
+}
+
+} // namespace synth
@@ -0,0 +1,57 @@
+// Mixer
+// Description:
+// Bit accurate model of mixer.vhd. The channels are summed and normalised by
+// the number of active channels reported by the amplitude envelope. In stereo
+// mode each channel is also panned with a constant power cosine law into left
+// and right accumulators. The accumulators wrap, so the sums of blocks of
+// channels add up to the sum of all channels and a mix can be summed in parts.
+//
+// Parameters (register values):
+// stereoEnable: pan the channels, otherwise left and right are the mono mix
+// pan: per channel, 0 is hard left, 128 centre and 256 hard right
+
+#ifndef MIXER_H
+#define MIXER_H
+
+#include <cstdint>
+#include <vector>
+
+namespace synth {
+
+class Mixer {
+public:
+    // the accumulators of the channels, mono and the pan products of left and right
+    struct Sums {
+        int64_t mono  = 0;
+        int64_t left  = 0;
+        int64_t right = 0;
+    };
+
+    explicit Mixer(int numChannels = 128);
+
+    // one sample period, activeChannels is i_active_channels, 0 to numChannels
+    void process(const int32_t *input, unsigned activeChannels, int32_t &mono, int32_t &left, int32_t &right) const;
+
+    // process in parts, the sums of the channels, the sums of two blocks of
+    // channels together and the normalised outputs of the sums
+    Sums sum(const int32_t *input) const;
+    static Sums add(const Sums &a, const Sums &b);
+    void output(const Sums &sums, unsigned activeChannels, int32_t &mono, int32_t &left, int32_t &right) const;
+
+    int numChannels() const { return m_numChannels; }
+
+    // the normalisation of an accumulator by the number of active channels
+    static int32_t normalise(int64_t accumulator, unsigned activeChannels);
+    // c_PAN_TABLE, the Q1.15 gain of a pan position, 0 to 256
+    static int32_t panGain(unsigned index);
+
+    bool stereoEnable = false;
+    std::vector<uint32_t> pan;
+
+private:
+    int m_numChannels;
+};
+
+} // namespace synth
+
+#endif
@@ -0,0 +1,44 @@
+#include "mod_matrix.h"
+
+#include "fixed_point.h"
+
+namespace synth {
+
+namespace {
+
+constexpr int c_DATA_WIDTH   = 24;
+constexpr int c_AMOUNT_WIDTH = 18;
+constexpr int c_AMOUNT_FRAC  = 15;
+constexpr int64_t c_MAX_OUTPUT = (1 << (c_DATA_WIDTH - 1)) - 1;
+constexpr int64_t c_MIN_OUTPUT = -(1 << (c_DATA_WIDTH - 1));
+
+} // namespace
+
+void ModMatrix::process(const std::array<const int32_t *, c_NUM_SOURCES> &sources,
+                        const std::array<int32_t *, c_NUM_DESTINATIONS> &outputs) const
+{
+    for (int ch = 0; ch < m_numChannels; ch++) {
+        for (int d = 0; d < c_NUM_DESTINATIONS; d++) {
+            // 45 bit sum of 42 bit products, wide enough to never overflow
+            int64_t sum = 0;
+            for (int s = 0; s < c_NUM_SOURCES; s++) {
+                if (sources[s])
+                    sum += int64_t(sources[s][ch]) * wrapSigned(amount[d][s], c_AMOUNT_WIDTH);
+            }
+
+            const int64_t value = sum >> c_AMOUNT_FRAC;
+            int64_t out;
+            if (d == amplitude && value < 0)
+                out = 0;
+            else if (value > c_MAX_OUTPUT)
+                out = c_MAX_OUTPUT;
+            else if (value < c_MIN_OUTPUT)
+                out = c_MIN_OUTPUT;
+            else
+                out = value;
+            outputs[d][ch] = int32_t(out);
+        }
+    }
+}
+
+} // namespace synth
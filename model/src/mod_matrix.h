@@ -0,0 +1,43 @@
+// Mod Matrix
+// Description:
+// Bit accurate model of mod_matrix.vhd. Each destination is the sum of the
+// eight sources scaled by their Q3.15 amounts, saturated to 24 bits. The
+// amplitude destination is also clamped at zero so it can not invert the
+// voice. Slots 0 to 3 are the LFOs and slots 4 to 7 the envelopes.
+//
+// Destinations: pitch (0), pulse width (1), cutoff (2), amplitude (3)
+
+#ifndef MOD_MATRIX_H
+#define MOD_MATRIX_H
+
+#include <array>
+#include <cstdint>
+
+namespace synth {
+
+class ModMatrix {
+public:
+    static constexpr int c_NUM_SOURCES      = 8;
+    static constexpr int c_NUM_DESTINATIONS = 4;
+    static constexpr int c_ENVELOPE_SLOT    = 4;
+
+    enum Destination { pitch = 0, pulseWidth = 1, cutoff = 2, amplitude = 3 };
+
+    explicit ModMatrix(int numChannels = 128) : m_numChannels(numChannels) {}
+
+    // one sample period, a null source reads zero as an unrouted slot does
+    void process(const std::array<const int32_t *, c_NUM_SOURCES> &sources,
+                 const std::array<int32_t *, c_NUM_DESTINATIONS> &outputs) const;
+
+    int numChannels() const { return m_numChannels; }
+
+    // Q3.15 amount of each source, amount[destination][source]
+    std::array<std::array<int32_t, c_NUM_SOURCES>, c_NUM_DESTINATIONS> amount {};
+
+private:
+    int m_numChannels;
+};
+
+} // namespace synth
+
+#endif
@@ -0,0 +1,274 @@
+#include "moog_ladder_filter.h"
+
+#include "fixed_point.h"
+
+#include <cmath>
+
+namespace synth {
+
+namespace {
+
+constexpr int c_DATA_WIDTH = 24;
+constexpr int c_COEF_WIDTH = 18;
+
+// tanh_function
+constexpr int c_TANH_SUM_WIDTH   = c_DATA_WIDTH + c_COEF_WIDTH + 1;
+constexpr int c_TANH_DATA_SCALE  = 23;
+constexpr int c_TANH_COEF_SCALE  = 16;
+constexpr int c_TANH_INPUT_WIDTH = 25;
+constexpr int c_TANH_ADDR_WIDTH  = 9;
+constexpr int c_TANH_FRAC_WIDTH  = c_TANH_INPUT_WIDTH - c_TANH_ADDR_WIDTH;
+constexpr int c_TANH_SLOPE_WIDTH = 18;
+constexpr std::array<int64_t, 6> c_TANH_COEFFICIENT = { 0, 73293, 0, -12523, 0, 3480 };
+
+// polynomial
+constexpr int c_POLY_SUM_WIDTH   = 2 * c_COEF_WIDTH + 1;
+constexpr int c_POLY_SCALE       = 15;
+constexpr std::array<int64_t, 5> c_POLY_COEFFICIENTS = { -661, 4525, -14227, 32414, 0 };
+
+// one_pole_filter
+constexpr int c_COEF_SCALE_FACTOR = 15;
+constexpr int c_ONE_POLE_SUM_WIDTH = c_DATA_WIDTH + c_COEF_WIDTH + 1;
+constexpr int64_t c_COEF_A = 25206;   // 1/1.3 * 2^15
+constexpr int64_t c_COEF_B = 7561;    // 0.3/1.3 * 2^15
+
+// feedforward coefficients of {tanh, y1, y2, y3, y4} by filter type and attenuation
+constexpr std::array<std::array<int64_t, 5>, 8> c_FEEDFORWARD_COEFFICIENTS = {{
+    { 0, 0, 1, 0, 0 },    // two pole low pass
+    { 0, 0, 0, 0, 1 },    // four pole low pass
+    { 1,-2, 1, 0, 0 },    // two pole high pass
+    { 1,-4, 6,-4, 1 },    // four pole high pass
+    { 0, 2,-2, 0, 0 },    // two pole band pass
+    { 0, 0, 4,-8, 4 },    // four pole band pass
+    { 0, 0, 0, 0, 1 },
+    { 0, 0, 0, 0, 1 },
+}};
+
+constexpr double c_SAMPLE_RATE = 96000.0;
+
+// 1 when negative, the resize to one bit of the tanh correction terms
+int64_t signBit(int64_t value)
+{
+    return value < 0 ? 1 : 0;
+}
+
+// tanh_polynomial of arch_lut, the arch_v2 pipeline on a 24 bit input
+int32_t tanhPolynomialCore(int64_t input)
+{
+    const auto term = [](int64_t sum) { return resizeSigned(sum >> (c_TANH_DATA_SCALE - 1), c_COEF_WIDTH); };
+
+    const int64_t p0 = input * c_TANH_COEFFICIENT[5];
+    const int64_t s0 = wrapSigned(p0 + (c_TANH_COEFFICIENT[4] << (c_TANH_DATA_SCALE - 1)), c_TANH_SUM_WIDTH);
+    const int64_t p1 = term(s0) * input;
+    const int64_t s1 = wrapSigned(p1 - ((c_TANH_COEFFICIENT[5] - c_TANH_COEFFICIENT[3]) << (c_TANH_DATA_SCALE - 1)), c_TANH_SUM_WIDTH);
+    const int64_t p2 = term(s1) * input;
+    const int64_t d4 = wrapSigned(term(s0) - c_TANH_COEFFICIENT[2], c_COEF_WIDTH);
+    const int64_t s2 = wrapSigned(p2 - (d4 << (c_TANH_DATA_SCALE - 1)), c_TANH_SUM_WIDTH);
+    const int64_t p3 = wrapSigned(term(s2) + signBit(s2), c_COEF_WIDTH) * input;
+    const int64_t d3 = wrapSigned(term(s1) - c_TANH_COEFFICIENT[1], c_COEF_WIDTH);
+    const int64_t s3 = wrapSigned(p3 - (d3 << (c_TANH_DATA_SCALE - 1)), c_TANH_SUM_WIDTH);
+    const int64_t p4 = term(s3) * input;
+    int64_t d2 = term(s2);
+    d2 = wrapSigned(d2 + signBit(d2) - c_TANH_COEFFICIENT[0], c_COEF_WIDTH);
+    const int64_t s4 = wrapSigned(p4 - (d2 << c_TANH_DATA_SCALE), c_TANH_SUM_WIDTH);
+
+    return int32_t(resizeSigned(s4 >> c_TANH_COEF_SCALE, c_DATA_WIDTH));
+}
+
+// the ROM contents of arch_lut, sampled from tanh_polynomial
+MoogLadderFilter::TanhTable buildTanhTable()
+{
+    const auto tanh = [](int64_t x) { return tanhPolynomialCore(resizeSigned(wrapSigned(x, 27) >> 1, c_DATA_WIDTH)); };
+
+    MoogLadderFilter::TanhTable table;
+    for (int i = 0; i < (1 << c_TANH_ADDR_WIDTH); i++) {
+        const int64_t x  = -(int64_t(1) << (c_TANH_INPUT_WIDTH - 1)) + (int64_t(i) << c_TANH_FRAC_WIDTH);
+        const int64_t y0 = tanh(x);
+        const int64_t y1 = i == (1 << c_TANH_ADDR_WIDTH) - 1 ? tanh((int64_t(1) << (c_TANH_INPUT_WIDTH - 1)) - 1)
+                                                             : tanh(x + (int64_t(1) << c_TANH_FRAC_WIDTH));
+        table.offset[i] = int32_t(wrapSigned(y0, c_DATA_WIDTH));
+        table.slope[i]  = int32_t(wrapSigned(y1 - y0, c_TANH_SLOPE_WIDTH));
+    }
+    return table;
+}
+
+// c_KEY_TABLE, the angular frequency of each note at 96kHz, Q3.15
+std::array<int32_t, 128> keyTable()
+{
+    std::array<int32_t, 128> table;
+    for (int i = 0; i < 128; i++)
+        table[i] = int32_t(std::round(2.0 * M_PI * 440.0 * std::pow(2.0, (i - 69) / 12.0) / c_SAMPLE_RATE * 32768.0));
+    return table;
+}
+
+} // namespace
+
+MoogLadderFilter::MoogLadderFilter(int numChannels, TanhImplementation tanh)
+    : cutoffOffset(numChannels, 0),
+      keyNote(numChannels, 0),
+      m_numChannels(numChannels),
+      m_tanh(tanh),
+      m_state(numChannels)
+{
+}
+
+int32_t MoogLadderFilter::tanhPolynomial(int64_t x)
+{
+    const int64_t top = wrapSigned(x, 27) >> 24;
+    int64_t saturated;
+    if (top >= 2)
+        saturated = (1 << 20) - 1;
+    else if (top < -2)
+        saturated = -(1 << 20);
+    else
+        saturated = resizeSigned(wrapSigned(x, 27) >> 1, c_DATA_WIDTH);
+    return tanhPolynomialCore(saturated);
+}
+
+const MoogLadderFilter::TanhTable &MoogLadderFilter::tanhTable()
+{
+    static const TanhTable c_LUT = buildTanhTable();
+    return c_LUT;
+}
+
+int32_t MoogLadderFilter::keyFrequency(unsigned note)
+{
+    static const std::array<int32_t, 128> c_KEY_TABLE = keyTable();
+    return c_KEY_TABLE[note & 0x7F];
+}
+
+int32_t MoogLadderFilter::tanhLookupTable(int64_t x)
+{
+    const TanhTable &c_LUT = tanhTable();
+
+    const int64_t top = wrapSigned(x, 27) >> 24;
+    int64_t saturated;
+    if (top > 0)
+        saturated = (int64_t(1) << (c_TANH_INPUT_WIDTH - 1)) - 1;
+    else if (top < -1)
+        saturated = -(int64_t(1) << (c_TANH_INPUT_WIDTH - 1));
+    else
+        saturated = wrapSigned(x, c_TANH_INPUT_WIDTH);
+
+    const int64_t address  = (saturated + (int64_t(1) << (c_TANH_INPUT_WIDTH - 1))) >> c_TANH_FRAC_WIDTH;
+    const int64_t fraction = saturated & ((int64_t(1) << c_TANH_FRAC_WIDTH) - 1);
+    const int64_t product  = int64_t(c_LUT.slope[address]) * fraction;
+    return int32_t(wrapSigned(c_LUT.offset[address] + resizeSigned(product >> c_TANH_FRAC_WIDTH, c_DATA_WIDTH), c_DATA_WIDTH));
+}
+
+int32_t MoogLadderFilter::cutoffPolynomial(int64_t x)
+{
+    int64_t sum = wrapSigned(x * c_POLY_COEFFICIENTS[0] + (c_POLY_COEFFICIENTS[1] << c_POLY_SCALE), c_POLY_SUM_WIDTH);
+    for (int idx = 1; idx < 4; idx++) {
+        const int64_t product = x * resizeSigned(sum >> c_POLY_SCALE, c_COEF_WIDTH);
+        sum = wrapSigned(product + (c_POLY_COEFFICIENTS[idx + 1] << c_POLY_SCALE), c_POLY_SUM_WIDTH);
+    }
+    return int32_t(resizeSigned(sum >> c_POLY_SCALE, c_COEF_WIDTH));
+}
+
+int32_t MoogLadderFilter::coefficient(int ch, int32_t adsrEnvelope, int32_t modulation) const
+{
+    const int64_t cutoff     = int64_t(wrapSigned(cutoffFrequency, 18)) + wrapSigned(cutoffOffset[ch], 18);
+    const int64_t adsrFactor = wrapSigned(adsrEnvelope, 18) * wrapSigned(adsrAmount, 18);
+
+    int64_t keyFreq = keyFrequency(keyNote[ch]);
+    switch (sampleRate & 3) {
+    case 0:  keyFreq = wrapSigned(keyFreq << 1, 18); break;
+    case 2:  keyFreq = keyFreq >> 1;                 break;
+    default: break;
+    }
+
+    const int64_t cutoffAdsr = wrapSigned(wrapSigned(cutoff << 17, 37) + adsrFactor, 37);
+    const int64_t modFactor  = modulationEnable ? wrapSigned(modulation, 18) * wrapSigned(modulationAmount, 18) : 0;
+    const int64_t keyFactor  = keyFreq * wrapSigned(keyTrackingAmount, 18);
+    const int64_t total      = wrapSigned(modFactor + cutoffAdsr + wrapSigned(keyFactor << 2, 38), 38);
+
+    int64_t saturated;
+    const int64_t top = total >> 32;
+    if (top > 0)
+        saturated = resizeSigned(total >> 17, 18);   // positive overflow
+    else if (top < 0)
+        saturated = 0;                               // negative overflow
+    else if (oversampleEnable)
+        saturated = resizeSigned(total >> 18, 18);
+    else
+        saturated = resizeSigned(total >> 17, 18);
+
+    return cutoffPolynomial(saturated);
+}
+
+int32_t MoogLadderFilter::pass(ChannelState &state, int32_t input, int32_t g) const
+{
+    // resonance feedback
+    const int64_t sumA = wrapSigned(int64_t(state.feedback) - (input >> 1), c_DATA_WIDTH + 1);
+    const int64_t prod = wrapSigned(resonance, 18) * sumA;
+    const int64_t sumB = wrapSigned(input - resizeSigned(prod >> 13, c_DATA_WIDTH + 3), c_DATA_WIDTH + 3);
+    const int32_t t    = m_tanh == TanhImplementation::polynomial ? tanhPolynomial(sumB) : tanhLookupTable(sumB);
+
+    // one pole stages, all with the cutoff of this sample
+    std::array<int64_t, 5> tap;
+    tap[0] = t;
+    for (int stage = 0; stage < c_NUM_STAGES; stage++) {
+        const int64_t x    = tap[stage];
+        const int64_t sumC = wrapSigned(wrapSigned(x * c_COEF_A - (int64_t(state.y[stage]) << c_COEF_SCALE_FACTOR), c_ONE_POLE_SUM_WIDTH) +
+                                        state.x[stage] * c_COEF_B, c_ONE_POLE_SUM_WIDTH);
+        const int64_t prodD = resizeSigned(sumC >> c_COEF_SCALE_FACTOR, c_DATA_WIDTH + 1) * g;
+        const int64_t sumE  = wrapSigned(prodD + (int64_t(state.y[stage]) << c_COEF_SCALE_FACTOR), c_ONE_POLE_SUM_WIDTH + 1);
+        const int32_t y     = int32_t(resizeSigned(sumE >> c_COEF_SCALE_FACTOR, c_DATA_WIDTH));
+        state.x[stage] = int32_t(x);
+        state.y[stage] = y;
+        tap[stage + 1] = y;
+    }
+    state.feedback = int32_t(tap[4]);
+
+    // feedforward sum selecting the response
+    const auto &coef = c_FEEDFORWARD_COEFFICIENTS[((filterType & 3) << 1) | (filterAttenuation & 1)];
+    const auto term  = [&](int i) { return resizeSigned(tap[i] * coef[i], c_DATA_WIDTH + 3); };
+    const int64_t sumAB  = wrapSigned(term(0) + term(1), c_DATA_WIDTH + 3);
+    const int64_t sumDE  = wrapSigned(term(3) + term(4), c_DATA_WIDTH + 3);
+    const int64_t sumABC = wrapSigned(sumAB + term(2), c_DATA_WIDTH + 4);
+    const int64_t total  = wrapSigned(sumABC + sumDE, c_DATA_WIDTH + 5);
+    return int32_t(resizeSigned(total, c_DATA_WIDTH));
+}
+
+int32_t MoogLadderFilter::decimate(ChannelState &state, int32_t x, bool phase)
+{
+    constexpr int c_SUM_WIDTH = c_DATA_WIDTH + 6;
+    auto &delay = state.decimator;   // delay[i] is w_delay(i+1)
+
+    int32_t y = 0;
+    if (phase) {
+        const int64_t outer  = wrapSigned(-int64_t(x) - delay[5], c_SUM_WIDTH);
+        const int64_t inner  = wrapSigned(int64_t(delay[1]) + delay[3], c_SUM_WIDTH);
+        const int64_t center = int64_t(delay[2]) << 4;
+        const int64_t pre    = wrapSigned(outer + wrapSigned(inner << 3, c_SUM_WIDTH) + inner + center, c_SUM_WIDTH) >> 5;
+        const int64_t guard  = pre >> (c_DATA_WIDTH - 1);
+        if (guard == 0 || guard == -1)
+            y = int32_t(pre);
+        else
+            y = guard > 0 ? (1 << (c_DATA_WIDTH - 1)) - 1 : -(1 << (c_DATA_WIDTH - 1));
+    }
+
+    for (int i = int(delay.size()) - 1; i > 0; i--)
+        delay[i] = delay[i - 1];
+    delay[0] = x;
+    return y;
+}
+
+void MoogLadderFilter::process(const int32_t *input, const int32_t *adsrEnvelope, const int32_t *modulation, int32_t *output)
+{
+    for (int ch = 0; ch < m_numChannels; ch++) {
+        ChannelState &state = m_state[ch];
+        const int32_t g = coefficient(ch, adsrEnvelope[ch], modulation[ch]);
+
+        if (!oversampleEnable) {
+            output[ch] = pass(state, input[ch], g);
+        } else {
+            // the second pass replays the inputs of the first at twice the rate
+            decimate(state, pass(state, input[ch], g), false);
+            output[ch] = decimate(state, pass(state, input[ch], g), true);
+        }
+    }
+}
+
+} // namespace synth
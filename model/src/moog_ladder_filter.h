@@ -0,0 +1,91 @@
+// Moog Ladder Filter
+// Description:
+// Bit accurate model of moog_ladder_filter_wrapper.vhd and the modules under
+// it: the cutoff frequency path (envelope, modulation and key tracking summed
+// and corrected by polynomial.vhd), the resonance feedback through
+// tanh_function.vhd, the four one_pole_filter.vhd stages and the feedforward
+// sum that selects the filter response. With oversampling enabled each sample
+// is processed twice at half the cutoff and decimated by
+// halfband_decimator.vhd.
+//
+// Parameters (register values):
+// resonance: Q1.17
+// cutoffFrequency, adsrAmount, modulationAmount, keyTrackingAmount: Q3.15
+// cutoffOffset: per channel Q3.15 offset added to the cutoff
+// keyNote: per channel MIDI note for key tracking
+// sampleRate: i_sample_rate code relative to c_SAMPLE_RATE, half ("00"), nominal ("01"), double ("10")
+// filterType: low pass (0), high pass (1), band pass (2)
+// filterAttenuation: 12dB/Oct (0), 24dB/Oct (1)
+
+#ifndef MOOG_LADDER_FILTER_H
+#define MOOG_LADDER_FILTER_H
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+namespace synth {
+
+class MoogLadderFilter {
+public:
+    // g_TANH_IMPLEMENTATION
+    enum class TanhImplementation { polynomial, lookupTable };
+
+    static constexpr int c_NUM_STAGES = 4;
+
+    // arch_lut ROM, the offset and slope of each segment
+    struct TanhTable {
+        std::array<int32_t, 512> offset;
+        std::array<int32_t, 512> slope;
+    };
+
+    explicit MoogLadderFilter(int numChannels = 128, TanhImplementation tanh = TanhImplementation::polynomial);
+
+    // one sample period, adsrEnvelope and modulation are Q1.17
+    void process(const int32_t *input, const int32_t *adsrEnvelope, const int32_t *modulation, int32_t *output);
+
+    int numChannels() const { return m_numChannels; }
+    TanhImplementation tanhImplementation() const { return m_tanh; }
+
+    // tanh_function arch_v2 and arch_lut, x is the 27 bit feedback sum
+    static int32_t tanhPolynomial(int64_t x);
+    static int32_t tanhLookupTable(int64_t x);
+    // polynomial.vhd, cutoff frequency to filter coefficient g, both Q3.15
+    static int32_t cutoffPolynomial(int64_t x);
+    static const TanhTable &tanhTable();
+    // c_KEY_TABLE, the angular frequency of a note at 96kHz, Q3.15
+    static int32_t keyFrequency(unsigned note);
+
+    int32_t  resonance         = 0;
+    int32_t  cutoffFrequency   = 0;
+    int32_t  adsrAmount        = 0;
+    bool     modulationEnable  = false;
+    int32_t  modulationAmount  = 0;
+    int32_t  keyTrackingAmount = 0;
+    bool     oversampleEnable  = false;
+    unsigned sampleRate        = 1;
+    unsigned filterType        = 0;
+    unsigned filterAttenuation = 0;
+    std::vector<int32_t> cutoffOffset;
+    std::vector<uint8_t> keyNote;
+
+private:
+    struct ChannelState {
+        int32_t feedback = 0;
+        std::array<int32_t, c_NUM_STAGES> x {};
+        std::array<int32_t, c_NUM_STAGES> y {};
+        std::array<int32_t, 6> decimator {};
+    };
+
+    int32_t coefficient(int ch, int32_t adsrEnvelope, int32_t modulation) const;
+    int32_t pass(ChannelState &state, int32_t input, int32_t g) const;
+    static int32_t decimate(ChannelState &state, int32_t x, bool phase);
+
+    int m_numChannels;
+    TanhImplementation m_tanh;
+    std::vector<ChannelState> m_state;
+};
+
+} // namespace synth
+
+#endif
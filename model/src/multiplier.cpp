@@ -0,0 +1,22 @@
+#include "multiplier.h"
+
+#include "fixed_point.h"
+
+namespace synth {
+
+namespace {
+
+constexpr int c_DATA_WIDTH     = 24;
+constexpr int c_ENVELOPE_WIDTH = 18;
+
+} // namespace
+
+void Multiplier::process(const int32_t *input, const int32_t *envelope, int32_t *output) const
+{
+    for (int ch = 0; ch < m_numChannels; ch++) {
+        const int64_t product = int64_t(input[ch]) * envelope[ch];
+        output[ch] = int32_t(resizeSigned(product >> (c_ENVELOPE_WIDTH - 1), c_DATA_WIDTH));
+    }
+}
+
+} // namespace synth
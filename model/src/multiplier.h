@@ -0,0 +1,28 @@
+// Multiplier
+// Description:
+// Bit accurate model of multiplier.vhd, the voice scaled by its Q1.17
+// amplitude envelope.
+
+#ifndef MULTIPLIER_H
+#define MULTIPLIER_H
+
+#include <cstdint>
+
+namespace synth {
+
+class Multiplier {
+public:
+    explicit Multiplier(int numChannels = 128) : m_numChannels(numChannels) {}
+
+    // one sample period, envelope is the top 18 bits of the amplitude stream
+    void process(const int32_t *input, const int32_t *envelope, int32_t *output) const;
+
+    int numChannels() const { return m_numChannels; }
+
+private:
+    int m_numChannels;
+};
+
+} // namespace synth
+
+#endif
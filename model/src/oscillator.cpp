@@ -0,0 +1,101 @@
+#include "oscillator.h"
+
+#include "fixed_point.h"
+
+namespace synth {
+
+namespace {
+
+constexpr int c_DATA_WIDTH           = 24;
+constexpr int c_PHASE_WIDTH          = 20;
+constexpr int c_WAVETABLE_ADDR_WIDTH = 11;
+
+// octave of the bandlimited tables from the total frequency control word
+unsigned octave(int64_t fcwTotal)
+{
+    const uint64_t fcw = wrapUnsigned(uint64_t(fcwTotal), c_PHASE_WIDTH);
+    for (int bit = 16; bit >= 8; bit--) {
+        if ((fcw >> bit) & 1)
+            return unsigned(bit - 7);
+    }
+    return 0;
+}
+
+} // namespace
+
+Oscillator::Oscillator(const Wavetables &tables, int numChannels, int numOscillators)
+    : oscillator(numOscillators),
+      channel(numChannels),
+      m_tables(tables),
+      m_numChannels(numChannels),
+      m_numOscillators(numOscillators),
+      m_phase(numChannels * numOscillators, 0)
+{
+}
+
+int32_t Oscillator::voice(uint32_t &phase, const OscillatorParams &osc, uint32_t fcw, uint32_t detune,
+                          bool modEnable, int32_t freqMod, int32_t pwMod) const
+{
+    // stage 0 and 1, detuned fcw and frequency modulation factor
+    const uint64_t fcwDetuned = uint64_t(fcw) * detune;
+    const int64_t  fcwDetunedZ1 = wrapSigned(int64_t(fcwDetuned >> 14), c_PHASE_WIDTH);
+    const int64_t  freqModFactor = modEnable ? fcwDetunedZ1 * freqMod : 0;
+
+    const int64_t pwTotal = osc.pwmEnable ? int64_t(osc.pulseWidth) + pwMod : int64_t(osc.pulseWidth);
+    int64_t pwSaturated;
+    switch (wrapUnsigned(uint64_t(pwTotal), 25) >> 23) {
+    case 1:  pwSaturated = (1 << 23) - 1;    break;   // positive overflow
+    case 2:  pwSaturated = -((1 << 23) - 1); break;   // negative overflow
+    default: pwSaturated = pwTotal;          break;
+    }
+
+    // stage 2 and 3, total fcw added to the phase accumulator
+    const int64_t fcwTotal = wrapSigned(fcwDetunedZ1 + resizeSigned(freqModFactor >> 17, c_PHASE_WIDTH), c_PHASE_WIDTH);
+    phase = uint32_t(wrapUnsigned(uint64_t(phase) + uint64_t(fcwTotal), c_PHASE_WIDTH));
+
+    // stage 4, wavetable addresses, the second sawtooth is offset by the pulse width
+    const uint32_t addrA = phase >> (c_PHASE_WIDTH - c_WAVETABLE_ADDR_WIDTH);
+    const uint32_t addrB = uint32_t(wrapUnsigned(addrA + (wrapUnsigned(uint64_t(pwSaturated), c_DATA_WIDTH) >> 13) +
+                                                 (1u << (c_WAVETABLE_ADDR_WIDTH - 1)), c_WAVETABLE_ADDR_WIDTH));
+    const unsigned tableOctave = octave(fcwTotal);
+
+    // stage 6, waveform select
+    int64_t wavetableOutput;
+    switch (osc.waveSelect & 3) {
+    case 0:  wavetableOutput = m_tables.sine[addrA >> 3]; break;
+    case 1:  wavetableOutput = m_tables.sawtooth[tableOctave][addrA]; break;
+    case 2:  wavetableOutput = m_tables.triangle[tableOctave][addrA]; break;
+    default: wavetableOutput = int64_t(m_tables.sawtooth[tableOctave][addrA]) - m_tables.sawtooth[tableOctave][addrB]; break;
+    }
+
+    // stage 7, the square wave is centred by the pulse width
+    int64_t wave;
+    if ((osc.waveSelect & 3) == 3)
+        wave = resizeSigned(wrapSigned(wavetableOutput + (pwSaturated >> 1), c_DATA_WIDTH + 1), c_DATA_WIDTH);
+    else
+        wave = resizeSigned(wavetableOutput, c_DATA_WIDTH);
+
+    // stage 8, amplitude
+    return int32_t(resizeSigned((wave * osc.amplitude) >> 17, c_DATA_WIDTH));
+}
+
+void Oscillator::process(const int32_t *freqMod, const int32_t *pwMod, int32_t *output)
+{
+    for (int ch = 0; ch < m_numChannels; ch++) {
+        const ChannelParams &params = channel[ch];
+        const int32_t chFreqMod = freqMod ? freqMod[ch] : 0;
+        const int32_t chPwMod   = pwMod ? pwMod[ch] : 0;
+
+        int64_t sum = 0;
+        for (int osc = 0; osc < m_numOscillators; osc++) {
+            const OscillatorParams &oscParams = oscillator[osc];
+            // unison slot detune on top of the oscillator detune, both Q4.14
+            const uint32_t detune = uint32_t(wrapUnsigned((uint64_t(oscParams.detune) * params.unisonDetune) >> 14, 18));
+            sum = wrapSigned(sum + voice(m_phase[ch * m_numOscillators + osc], oscParams, params.fcw, detune,
+                                         params.modEnable, chFreqMod, chPwMod), c_DATA_WIDTH);
+        }
+        output[ch] = int32_t(sum);
+    }
+}
+
+} // namespace synth
@@ -0,0 +1,69 @@
+// Oscillator
+// Description:
+// Bit accurate model of oscillator.vhd and oscillator_wrapper.vhd. Each
+// channel runs g_NUM_OSCILLATORS wavetable oscillators, issued channel by
+// channel with the oscillators of a channel back to back, and their outputs
+// are summed into one Q1.23 sample per channel. The per channel unison detune
+// of Oscillator_v2_0.vhd is applied on top of the oscillator detune.
+//
+// Parameters (register values):
+// waveSelect: sine (0), sawtooth (1), triangle (2), square (3)
+// amplitude: oscillator mix, Q1.17
+// detune: Q4.14, 16384 is no detune
+// pulseWidth: Q1.23, added to the square wave phase offset
+// fcw: frequency control word, 20 bit phase accumulator
+// unisonDetune: Q4.14 slot detune of the channel
+
+#ifndef OSCILLATOR_H
+#define OSCILLATOR_H
+
+#include "wavetables.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace synth {
+
+class Oscillator {
+public:
+    struct OscillatorParams {
+        unsigned waveSelect = 0;
+        int32_t  amplitude  = 0;
+        uint32_t detune     = 16384;
+        int32_t  pulseWidth = 0;
+        bool     pwmEnable  = false;
+    };
+
+    struct ChannelParams {
+        uint32_t fcw          = 0;
+        uint32_t unisonDetune = 16384;
+        bool     modEnable    = false;
+    };
+
+    Oscillator(const Wavetables &tables, int numChannels = 128, int numOscillators = 3);
+
+    // one sample period, freqMod is Q1.17 (bits 23:6 of the pitch stream) and
+    // pwMod is Q1.23, a null modulation input reads zero as an empty FIFO does
+    void process(const int32_t *freqMod, const int32_t *pwMod, int32_t *output);
+
+    int numChannels() const { return m_numChannels; }
+    int numOscillators() const { return m_numOscillators; }
+
+    std::vector<OscillatorParams> oscillator;
+    std::vector<ChannelParams>    channel;
+
+private:
+    int32_t voice(uint32_t &phase, const OscillatorParams &osc, uint32_t fcw, uint32_t detune,
+                  bool modEnable, int32_t freqMod, int32_t pwMod) const;
+
+    const Wavetables &m_tables;
+    int m_numChannels;
+    int m_numOscillators;
+
+    // phase accumulators in issue order, channel*g_NUM_OSCILLATORS+oscillator
+    std::vector<uint32_t> m_phase;
+};
+
+} // namespace synth
+
+#endif
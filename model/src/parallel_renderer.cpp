@@ -0,0 +1,131 @@
+#include "parallel_renderer.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace synth {
+
+ParallelRenderer::ParallelRenderer(const Wavetables &tables, unsigned sampleRate, int numVoices,
+                                   MoogLadderFilter::TanhImplementation tanh, Synthesizer::Engine engine,
+                                   int numThreads)
+{
+    numThreads = std::min(std::max(numThreads, 1), c_MAX_THREADS);
+
+    // contiguous blocks of whole lanes, the first blocks hold the voices the firmware uses first
+    for (int t = 0; t < numThreads; t++) {
+        const int first = (Synthesizer::c_NUM_CHANNELS * t / numThreads) & ~7;
+        const int last  = (Synthesizer::c_NUM_CHANNELS * (t + 1) / numThreads) & ~7;
+        Block block;
+        block.synth.reset(new Synthesizer(tables, sampleRate, numVoices, tanh, engine, first, last - first));
+        block.sums.resize(c_RUN_LENGTH);
+        block.activeChannels.resize(c_RUN_LENGTH);
+        m_blocks.push_back(std::move(block));
+    }
+
+    for (int t = 1; t < numThreads; t++)
+        m_threads.emplace_back(&ParallelRenderer::worker, this, t);
+}
+
+ParallelRenderer::~ParallelRenderer()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stop = true;
+    }
+    m_start.notify_all();
+    for (std::thread &thread : m_threads)
+        thread.join();
+}
+
+bool ParallelRenderer::noteOn(unsigned note)
+{
+    for (Block &block : m_blocks) {
+        if (block.synth->noteOn(note))
+            return true;
+    }
+    return false;
+}
+
+bool ParallelRenderer::noteOff(unsigned note)
+{
+    for (Block &block : m_blocks) {
+        if (block.synth->noteOff(note))
+            return true;
+    }
+    return false;
+}
+
+void ParallelRenderer::apply(const ScriptEvent &event)
+{
+    if (event.command == "note_on")
+        noteOn(unsigned(std::lround(event.args[0])) & 0x7F);
+    else if (event.command == "note_off")
+        noteOff(unsigned(std::lround(event.args[0])) & 0x7F);
+    else
+        configure([&](Synthesizer &synth) { Script::apply(event, synth); });
+}
+
+void ParallelRenderer::render(long samples, int32_t *left, int32_t *right)
+{
+    while (samples > 0) {
+        const long length = std::min<long>(samples, c_RUN_LENGTH);
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_runLength = length;
+            m_pending = int(m_threads.size());
+            m_generation++;
+        }
+        m_start.notify_all();
+        run(m_blocks.front(), length);
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_done.wait(lock, [this] { return m_pending == 0; });
+        }
+
+        // the mixer of the whole chain
+        const Mixer &mixer = m_blocks.front().synth->mixer;
+        for (long n = 0; n < length; n++) {
+            Mixer::Sums sums = m_blocks.front().sums[n];
+            unsigned activeChannels = m_blocks.front().activeChannels[n];
+            for (size_t b = 1; b < m_blocks.size(); b++) {
+                sums = Mixer::add(sums, m_blocks[b].sums[n]);
+                activeChannels += m_blocks[b].activeChannels[n];
+            }
+            int32_t mono;
+            mixer.output(sums, activeChannels, mono, left[n], right[n]);
+        }
+
+        left += length;
+        right += length;
+        samples -= length;
+    }
+}
+
+void ParallelRenderer::run(Block &block, long samples)
+{
+    for (long n = 0; n < samples; n++)
+        block.synth->processChannels(block.sums[n], block.activeChannels[n]);
+}
+
+void ParallelRenderer::worker(int index)
+{
+    unsigned long generation = 0;
+    std::unique_lock<std::mutex> lock(m_mutex);
+    for (;;) {
+        m_start.wait(lock, [&] { return m_stop || m_generation != generation; });
+        if (m_stop)
+            return;
+        generation = m_generation;
+        const long samples = m_runLength;
+
+        lock.unlock();
+        run(m_blocks[index], samples);
+        lock.lock();
+
+        if (--m_pending == 0)
+            m_done.notify_one();
+    }
+}
+
+} // namespace synth
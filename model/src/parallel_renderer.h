@@ -0,0 +1,89 @@
+// Parallel Renderer
+// Description:
+// Renders the block design chain on worker threads. The 128 channels are
+// partitioned into one block of contiguous channels per thread, each block is
+// a Synthesizer of its channels, and the threads render their blocks a run of
+// sample periods at a time. The mixer sums and active channel counts of the
+// blocks are then added and normalised as mixer.vhd does with the sums and
+// count of all channels. The accumulators and the count wrap, so the output is
+// bit identical to Synthesizer for any number of threads.
+//
+// Events are applied between runs, a run stops at the next event. A firmware
+// call goes to every block, except note on and note off which go to the
+// first block with a matching channel, as the firmware searches the channels
+// in order.
+
+#ifndef PARALLEL_RENDERER_H
+#define PARALLEL_RENDERER_H
+
+#include "script.h"
+#include "synthesizer.h"
+
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace synth {
+
+class ParallelRenderer {
+public:
+    static constexpr int c_MAX_THREADS = Synthesizer::c_NUM_CHANNELS / 8;   // blocks of whole 8 channel lanes
+    static constexpr int c_RUN_LENGTH  = 512;                                // sample periods per run
+
+    // the arguments of Synthesizer, numThreads is clamped to 1 to c_MAX_THREADS
+    ParallelRenderer(const Wavetables &tables, unsigned sampleRate, int numVoices,
+                     MoogLadderFilter::TanhImplementation tanh, Synthesizer::Engine engine, int numThreads);
+    ~ParallelRenderer();
+    ParallelRenderer(const ParallelRenderer &) = delete;
+    ParallelRenderer &operator=(const ParallelRenderer &) = delete;
+
+    float sampleRate() const { return m_blocks.front().synth->sampleRate(); }
+    int numThreads() const { return int(m_blocks.size()); }
+
+    // SynthNoteOn, SynthNoteOff
+    bool noteOn(unsigned note);
+    bool noteOff(unsigned note);
+
+    // a firmware call other than a note on or off, made on every block
+    template <typename Call>
+    void configure(Call call)
+    {
+        for (Block &block : m_blocks)
+            call(*block.synth);
+    }
+
+    // applies one script event
+    void apply(const ScriptEvent &event);
+
+    // renders sample periods to the left and right outputs
+    void render(long samples, int32_t *left, int32_t *right);
+
+private:
+    struct Block {
+        std::unique_ptr<Synthesizer> synth;
+        std::vector<Mixer::Sums> sums;
+        std::vector<unsigned> activeChannels;
+    };
+
+    void run(Block &block, long samples);
+    void worker(int index);
+
+    std::vector<Block> m_blocks;
+
+    // the threads of blocks 1 and up, block 0 is rendered by the caller
+    std::vector<std::thread> m_threads;
+    std::mutex m_mutex;
+    std::condition_variable m_start;
+    std::condition_variable m_done;
+    unsigned long m_generation = 0;
+    long m_runLength = 0;
+    int m_pending = 0;
+    bool m_stop = false;
+};
+
+} // namespace synth
+
+#endif
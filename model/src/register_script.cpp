@@ -0,0 +1,238 @@
+#include "register_script.h"
+
+#include "fixed_point.h"
+
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+
+namespace synth {
+
+namespace {
+
+// reset values of the filter S_AXI_CTRL registers
+constexpr int32_t c_FILTER_RESET_CUTOFF       = 9000;
+constexpr int32_t c_FILTER_RESET_RESONANCE    = 20000;
+constexpr unsigned c_FILTER_RESET_ATTENUATION = 1;
+
+constexpr uint32_t c_UNITY_DETUNE = 16384;
+
+[[noreturn]] void error(int line, const std::string &message)
+{
+    throw std::runtime_error("register script line " + std::to_string(line) + ": " + message);
+}
+
+int32_t signedField(uint32_t value, int bits)
+{
+    return int32_t(wrapSigned(value, bits));
+}
+
+// bits 31:25 of the data select a channel or an oscillator
+unsigned select(const RegisterWrite &write, int count, const char *what)
+{
+    const unsigned index = write.data >> 25;
+    if (index >= unsigned(count))
+        error(write.line, std::string(what) + " " + std::to_string(index) + " out of range");
+    return index;
+}
+
+} // namespace
+
+RegisterScript RegisterScript::parse(std::istream &input)
+{
+    RegisterScript script;
+    std::string text;
+    int line = 0;
+    bool ended = false;
+
+    while (std::getline(input, text)) {
+        line++;
+        std::istringstream fields(text);
+        std::string first;
+        if (!(fields >> first) || first[0] == '#')
+            continue;
+        if (ended)
+            error(line, "write after the end");
+
+        RegisterWrite write;
+        write.line = line;
+        try {
+            size_t length;
+            write.period = std::stol(first, &length);
+            if (length != first.size() || write.period < 0)
+                throw std::invalid_argument(first);
+        } catch (const std::logic_error &) {
+            error(line, "expected a sample period");
+        }
+        if (!script.m_writes.empty() && write.period < script.m_writes.back().period)
+            error(line, "sample period before the previous write");
+
+        std::string module;
+        if (!(fields >> module))
+            error(line, "expected a module");
+        if (module == "end") {
+            script.m_endPeriod = write.period;
+            ended = true;
+            continue;
+        }
+        if (module == "osc")
+            write.module = RegisterWrite::Module::oscillator;
+        else if (module == "adsr")
+            write.module = RegisterWrite::Module::adsr;
+        else if (module == "filter")
+            write.module = RegisterWrite::Module::filter;
+        else
+            error(line, "unknown module " + module);
+
+        std::string data;
+        if (!(fields >> write.reg) || write.reg > 15)
+            error(line, "expected a register number 0 to 15");
+        if (!(fields >> data) || data.size() != 8 || data.find_first_not_of("0123456789abcdefABCDEF") != std::string::npos)
+            error(line, "expected 8 hex digits of data");
+        write.data = uint32_t(std::stoul(data, nullptr, 16));
+        script.m_writes.push_back(write);
+    }
+    if (!ended)
+        error(line, "no end line");
+    if (!script.m_writes.empty() && script.m_writes.back().period > script.m_endPeriod)
+        error(line, "end before the last write");
+    return script;
+}
+
+RegisterScript RegisterScript::load(const std::string &path)
+{
+    std::ifstream file(path);
+    if (!file)
+        throw std::runtime_error("can not open register script " + path);
+    return parse(file);
+}
+
+RegisterMap::RegisterMap(Oscillator &oscillator, Adsr &adsr, MoogLadderFilter &filter)
+    : m_oscillator(oscillator), m_adsr(adsr), m_filter(filter)
+{
+    m_unisonDetune.fill(c_UNITY_DETUNE);
+    for (Oscillator::OscillatorParams &osc : m_oscillator.oscillator)
+        osc = Oscillator::OscillatorParams();
+    for (Oscillator::ChannelParams &channel : m_oscillator.channel)
+        channel = Oscillator::ChannelParams();
+
+    m_adsr.attackCw     = c_ADSR_RESET_ATTACK_CW;
+    m_adsr.decayCw      = c_ADSR_RESET_DECAY_CW;
+    m_adsr.sustainLevel = c_ADSR_RESET_SUSTAIN_LEVEL;
+    m_adsr.releaseCw    = c_ADSR_RESET_RELEASE_CW;
+    m_adsr.noteOn.assign(m_adsr.numChannels(), false);
+
+    m_filter.cutoffFrequency   = c_FILTER_RESET_CUTOFF;
+    m_filter.resonance         = c_FILTER_RESET_RESONANCE;
+    m_filter.adsrAmount        = 0;
+    m_filter.modulationEnable  = false;
+    m_filter.modulationAmount  = 0;
+    m_filter.filterType        = 0;
+    m_filter.filterAttenuation = c_FILTER_RESET_ATTENUATION;
+    m_filter.keyTrackingAmount = 0;
+    m_filter.oversampleEnable  = false;
+    m_filter.cutoffOffset.assign(m_filter.numChannels(), 0);
+    m_filter.keyNote.assign(m_filter.numChannels(), 0);
+}
+
+void RegisterMap::write(const RegisterWrite &write)
+{
+    switch (write.module) {
+    case RegisterWrite::Module::oscillator: writeOscillator(write); break;
+    case RegisterWrite::Module::adsr:       writeAdsr(write);       break;
+    case RegisterWrite::Module::filter:     writeFilter(write);     break;
+    }
+}
+
+void RegisterMap::writeOscillator(const RegisterWrite &write)
+{
+    const uint32_t data = write.data;
+    const int numOscillators = m_oscillator.numOscillators();
+    switch (write.reg) {
+    case 0:   // frequency control word {channel[31:25], fcw[17:0]}
+        m_oscillator.channel[select(write, m_oscillator.numChannels(), "channel")].fcw = uint32_t(wrapUnsigned(data, 18));
+        break;
+    case 1:
+        m_oscillator.oscillator[select(write, numOscillators, "oscillator")].waveSelect = data & 3;
+        break;
+    case 2:
+        m_oscillator.oscillator[select(write, numOscillators, "oscillator")].pulseWidth = signedField(data, 24);
+        break;
+    case 3:
+        m_oscillator.oscillator[select(write, numOscillators, "oscillator")].pwmEnable = data & 1;
+        break;
+    case 5:
+        m_oscillator.oscillator[select(write, numOscillators, "oscillator")].detune = uint32_t(wrapUnsigned(data, 18));
+        break;
+    case 6:
+        m_oscillator.oscillator[select(write, numOscillators, "oscillator")].amplitude = signedField(data, 18);
+        break;
+    case 9:
+        m_unisonSize = data & 3;
+        updateUnison();
+        break;
+    case 10:  // unison slot detune {slot[27:25], detune[17:0]}
+        m_unisonDetune[(data >> 25) & 7] = uint32_t(wrapUnsigned(data, 18));
+        updateUnison();
+        break;
+    default:
+        break;
+    }
+}
+
+void RegisterMap::writeAdsr(const RegisterWrite &write)
+{
+    switch (write.reg) {
+    case 0: case 1: case 2: case 3:   // note on bits of channels 32*reg to 32*reg+31
+        for (int bit = 0; bit < 32; bit++) {
+            const int channel = int(write.reg) * 32 + bit;
+            if (channel < m_adsr.numChannels())
+                m_adsr.noteOn[channel] = (write.data >> bit) & 1;
+        }
+        break;
+    case 4: m_adsr.attackCw     = signedField(write.data, 24); break;
+    case 5: m_adsr.decayCw      = signedField(write.data, 24); break;
+    case 6: m_adsr.sustainLevel = signedField(write.data, 24); break;
+    case 7: m_adsr.releaseCw    = signedField(write.data, 24); break;
+    case 13:  // steal {channel[31:25], count[3:0]}
+        m_adsr.steal(int(write.data >> 25), int(write.data & 0xF));
+        break;
+    default:
+        break;
+    }
+}
+
+void RegisterMap::writeFilter(const RegisterWrite &write)
+{
+    const uint32_t data = write.data;
+    switch (write.reg) {
+    case 0:  m_filter.cutoffFrequency   = signedField(data, 18); break;
+    case 1:  m_filter.resonance         = signedField(data, 18); break;
+    case 2:  m_filter.adsrAmount        = signedField(data, 18); break;
+    case 3:  m_filter.modulationEnable  = data & 1;              break;
+    case 4:  m_filter.modulationAmount  = signedField(data, 18); break;
+    case 5:  m_filter.filterType        = data & 3;              break;
+    case 6:  m_filter.filterAttenuation = data & 1;              break;
+    case 7:  // {channel[31:25], offset[17:0]}
+        m_filter.cutoffOffset[select(write, m_filter.numChannels(), "channel")] = signedField(data, 18);
+        break;
+    case 8:  // {channel[31:25], note[6:0]}
+        m_filter.keyNote[select(write, m_filter.numChannels(), "channel")] = uint8_t(data & 0x7F);
+        break;
+    case 9:  m_filter.keyTrackingAmount = signedField(data, 18); break;
+    case 10: m_filter.oversampleEnable  = data & 1;              break;
+    default:
+        break;
+    }
+}
+
+// o_unison_detune of Oscillator_v2_0_S_AXI_CTRL, the slot is the low bits
+// of the channel, 1.0 without unison
+void RegisterMap::updateUnison()
+{
+    const unsigned mask = (1u << m_unisonSize) - 1;
+    for (int ch = 0; ch < m_oscillator.numChannels(); ch++)
+        m_oscillator.channel[ch].unisonDetune = m_unisonSize ? m_unisonDetune[ch & mask] : c_UNITY_DETUNE;
+}
+
+} // namespace synth
@@ -0,0 +1,100 @@
+// Register Script
+// Description:
+// A script of AXI-Lite register writes, the stimulus tb_system runs
+// (run_register_script of synth_module_sim_package) and synth_compare replays
+// on the models. One write per line:
+//
+//   <sample period> <module> <register> <data>
+//
+// module is osc, adsr or filter, register is the register number of
+// synth_module_sim_package (the byte address / 4) and data is 8 hex digits.
+// The writes of a sample period are made after the previous sample period
+// and before its i_en, in the order of the script, so the sample periods
+// must not decrease. The last line, "<sample period> end", ends the run
+// before that sample period. Blank lines and lines starting with '#' are
+// ignored, as is text after the data.
+//
+// Oscillator 0 at full amplitude and channel 0 playing 500 Hz from sample
+// period 10:
+//
+//   0 osc 0 00001555
+//   0 osc 6 0001FFFF
+//   10 adsr 0 00000001
+//   1000 end
+
+#ifndef REGISTER_SCRIPT_H
+#define REGISTER_SCRIPT_H
+
+#include "adsr.h"
+#include "moog_ladder_filter.h"
+#include "oscillator.h"
+
+#include <array>
+#include <cstdint>
+#include <istream>
+#include <string>
+#include <vector>
+
+namespace synth {
+
+// reset values of the ADSR_v2_0 control word and sustain registers
+constexpr int32_t c_ADSR_RESET_ATTACK_CW     = 150000;
+constexpr int32_t c_ADSR_RESET_DECAY_CW      = 150000;
+constexpr int32_t c_ADSR_RESET_SUSTAIN_LEVEL = (1 << 23) - 1;
+constexpr int32_t c_ADSR_RESET_RELEASE_CW    = 50000;
+
+struct RegisterWrite {
+    enum class Module { oscillator, adsr, filter };
+
+    long     period = 0;
+    Module   module = Module::oscillator;
+    unsigned reg    = 0;
+    uint32_t data   = 0;
+    int      line   = 0;
+};
+
+class RegisterScript {
+public:
+    // throws std::runtime_error with the line number on a malformed line
+    static RegisterScript parse(std::istream &input);
+    static RegisterScript load(const std::string &path);
+
+    const std::vector<RegisterWrite> &writes() const { return m_writes; }   // in period order
+    long endPeriod() const { return m_endPeriod; }
+
+private:
+    std::vector<RegisterWrite> m_writes;
+    long m_endPeriod = 0;
+};
+
+// The S_AXI_CTRL register maps of Oscillator_v2_0, ADSR_v2_0 and
+// Moog_Ladder_Filter_v1_0 on the module models. The registers take their
+// reset values on construction. Registers the models have no parameter for
+// (modulation enable, parameter source, FIFO select and the status registers)
+// are ignored, tb_system drives no modulation or parameter streams.
+class RegisterMap {
+public:
+    RegisterMap(Oscillator &oscillator, Adsr &adsr, MoogLadderFilter &filter);
+
+    // throws std::runtime_error when the write selects a channel or an
+    // oscillator the models do not have
+    void write(const RegisterWrite &write);
+
+private:
+    void writeOscillator(const RegisterWrite &write);
+    void writeAdsr(const RegisterWrite &write);
+    void writeFilter(const RegisterWrite &write);
+    void updateUnison();
+
+    Oscillator &m_oscillator;
+    Adsr &m_adsr;
+    MoogLadderFilter &m_filter;
+
+    // unison size (slv_reg9) and slot detunes of the oscillator
+    unsigned m_unisonSize = 0;
+    std::array<uint32_t, 8> m_unisonDetune;
+};
+
+} // namespace synth
+
+#endif
@@ -0,0 +1,148 @@
+#include "register_space.h"
+
+#include "firmware_host.h"
+#include "fixed_point.h"
+#include "register_script.h"
+
+namespace synth {
+
+namespace {
+
+constexpr uintptr_t c_ADSR_BASE[RegisterSpace::c_NUM_ADSRS] = {
+    XPAR_ADSR_0_S_AXI_CTRL_BASEADDR, XPAR_ADSR_1_S_AXI_CTRL_BASEADDR
+};
+constexpr uintptr_t c_ADSR_SPAN = 32 * 4;   // the control and voice freed banks
+
+// ADSR_v2_0_S_AXI_CTRL registers
+constexpr unsigned c_ADSR_NOTE_ON_REG      = 0;   // 0 to 3, 32 channels each
+constexpr unsigned c_ADSR_ATTACK_CW_REG    = 4;
+constexpr unsigned c_ADSR_DECAY_CW_REG     = 5;
+constexpr unsigned c_ADSR_SUSTAIN_REG      = 6;
+constexpr unsigned c_ADSR_RELEASE_CW_REG   = 7;
+constexpr unsigned c_ADSR_CHANNEL_FREE_REG = 8;   // 8 to 11, read only
+constexpr unsigned c_ADSR_STEAL_REG        = 13;  // the quietest channel on read
+constexpr unsigned c_ADSR_FREED_REG        = 16;  // 16 to 19, cleared by the read
+constexpr unsigned c_ADSR_FREED_IRQ_EN_REG = 20;
+
+RegisterSpace *s_attached = nullptr;
+
+} // namespace
+
+RegisterSpace::RegisterSpace()
+    : m_adsr{ Adsr(c_NUM_CHANNELS), Adsr(c_NUM_CHANNELS) }, m_envelope(c_NUM_CHANNELS)
+{
+    for (int i = 0; i < c_NUM_ADSRS; i++) {
+        write(c_ADSR_BASE[i] + c_ADSR_ATTACK_CW_REG * 4, c_ADSR_RESET_ATTACK_CW);
+        write(c_ADSR_BASE[i] + c_ADSR_DECAY_CW_REG * 4, c_ADSR_RESET_DECAY_CW);
+        write(c_ADSR_BASE[i] + c_ADSR_SUSTAIN_REG * 4, c_ADSR_RESET_SUSTAIN_LEVEL);
+        write(c_ADSR_BASE[i] + c_ADSR_RELEASE_CW_REG * 4, c_ADSR_RESET_RELEASE_CW);
+    }
+    m_writes = 0;
+}
+
+RegisterSpace::~RegisterSpace()
+{
+    if (s_attached == this)
+        s_attached = nullptr;
+}
+
+void RegisterSpace::attach()
+{
+    s_attached = this;
+}
+
+int RegisterSpace::adsrRegister(uintptr_t address, unsigned &reg) const
+{
+    for (int i = 0; i < c_NUM_ADSRS; i++) {
+        if (address >= c_ADSR_BASE[i] && address < c_ADSR_BASE[i] + c_ADSR_SPAN) {
+            reg = unsigned(address - c_ADSR_BASE[i]) / 4;
+            return i;
+        }
+    }
+    return -1;
+}
+
+uint32_t RegisterSpace::read(uintptr_t address)
+{
+    m_reads++;
+    unsigned reg;
+    const int i = adsrRegister(address, reg);
+    if (i >= 0 && reg >= c_ADSR_CHANNEL_FREE_REG && reg < c_ADSR_CHANNEL_FREE_REG + 4) {
+        uint32_t free = 0;
+        for (int bit = 0; bit < 32; bit++) {
+            const int channel = int(reg - c_ADSR_CHANNEL_FREE_REG) * 32 + bit;
+            if (m_adsr[i].channelFree(channel))
+                free |= 1u << bit;
+        }
+        return free;
+    }
+    if (i >= 0 && reg == c_ADSR_STEAL_REG)
+        return m_adsr[i].quietestChannel();
+    if (i >= 0 && reg >= c_ADSR_FREED_REG && reg < c_ADSR_FREED_REG + 4) {
+        const uint32_t freed = m_freed[i][reg - c_ADSR_FREED_REG];
+        m_freed[i][reg - c_ADSR_FREED_REG] = 0;
+        return freed;
+    }
+    const auto value = m_registers.find(address);
+    return value == m_registers.end() ? 0 : value->second;
+}
+
+void RegisterSpace::write(uintptr_t address, uint32_t value)
+{
+    m_writes++;
+    unsigned reg;
+    const int i = adsrRegister(address, reg);
+    if (i >= 0) {
+        Adsr &adsr = m_adsr[i];
+        if (reg < c_ADSR_NOTE_ON_REG + 4) {
+            for (int bit = 0; bit < 32; bit++)
+                adsr.noteOn[(reg - c_ADSR_NOTE_ON_REG) * 32 + bit] = (value >> bit) & 1;
+        }
+        switch (reg) {
+        case c_ADSR_ATTACK_CW_REG:  adsr.attackCw     = int32_t(wrapSigned(value, 24)); break;
+        case c_ADSR_DECAY_CW_REG:   adsr.decayCw      = int32_t(wrapSigned(value, 24)); break;
+        case c_ADSR_SUSTAIN_REG:    adsr.sustainLevel = int32_t(wrapSigned(value, 24)); break;
+        case c_ADSR_RELEASE_CW_REG: adsr.releaseCw    = int32_t(wrapSigned(value, 24)); break;
+        case c_ADSR_STEAL_REG:      adsr.steal(int(value >> 25), int(value & 0xF));     break;
+        default:
+            break;
+        }
+    }
+    m_registers[address] = value;
+}
+
+void RegisterSpace::process()
+{
+    for (int i = 0; i < c_NUM_ADSRS; i++) {
+        m_adsr[i].process(m_envelope.data());
+        for (int ch = 0; ch < c_NUM_CHANNELS; ch++) {
+            if (m_adsr[i].freed(ch))
+                m_freed[i][ch / 32] |= 1u << (ch % 32);
+        }
+    }
+}
+
+bool RegisterSpace::voiceFreedIrq(int index) const
+{
+    const auto enable = m_registers.find(c_ADSR_BASE[index] + c_ADSR_FREED_IRQ_EN_REG * 4);
+    if (enable == m_registers.end() || (enable->second & 1) == 0)
+        return false;
+    for (uint32_t freed : m_freed[index]) {
+        if (freed)
+            return true;
+    }
+    return false;
+}
+
+} // namespace synth
+
+extern "C" u32 Xil_In32(UINTPTR address)
+{
+    return synth::s_attached ? synth::s_attached->read(address) : 0;
+}
+
+extern "C" void Xil_Out32(UINTPTR address, u32 value)
+{
+    if (synth::s_attached)
+        synth::s_attached->write(address, value);
+}
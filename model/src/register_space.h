@@ -0,0 +1,71 @@
+// Register Space
+// Description:
+// The AXI-Lite register space the firmware runs against on the host
+// (firmware.h). The amplitude and filter ADSRs are the bit accurate models:
+// their note on, control word and sustain registers drive the models and the
+// channel free registers read the envelope states and the steal register
+// steals channels and reads the quietest one, so the firmware finds free and
+// stolen voices as it does on the hardware. The voice freed registers collect
+// the channels the models free and clear on read, voiceFreedIrq is the
+// interrupt the host has to service. Every other address is a plain register
+// that reads back the last value written, 0 after reset.
+//
+// The reads and writes are counted. Each AXI-Lite access stalls the processor
+// for the round trip through the interconnect, so the access count is the
+// cost of a firmware call on the target.
+
+#ifndef REGISTER_SPACE_H
+#define REGISTER_SPACE_H
+
+#include "adsr.h"
+#include "synth_config.h"
+
+#include <array>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace synth {
+
+class RegisterSpace {
+public:
+    static constexpr int c_NUM_CHANNELS = SYNTH_NUM_CHANNELS;   // g_NUM_CHANNELS of the IPs
+    static constexpr int c_NUM_ADSRS    = 2;     // amplitude, filter
+
+    RegisterSpace();
+    ~RegisterSpace();
+    RegisterSpace(const RegisterSpace &) = delete;
+    RegisterSpace &operator=(const RegisterSpace &) = delete;
+
+    // Xil_In32 and Xil_Out32 access this register space until another one is
+    // attached or it is destroyed
+    void attach();
+
+    uint32_t read(uintptr_t address);
+    void write(uintptr_t address, uint32_t value);
+
+    // one sample period of the ADSRs
+    void process();
+
+    const Adsr &adsr(int index) const { return m_adsr[index]; }
+    // o_voice_freed_irq, a channel is freed and unread and the interrupt enabled
+    bool voiceFreedIrq(int index) const;
+
+    uint64_t reads() const { return m_reads; }
+    uint64_t writes() const { return m_writes; }
+
+private:
+    // the ADSR the address is in and the register number, -1 for no ADSR
+    int adsrRegister(uintptr_t address, unsigned &reg) const;
+
+    std::array<Adsr, c_NUM_ADSRS> m_adsr;
+    std::array<std::array<uint32_t, 4>, c_NUM_ADSRS> m_freed = {};
+    std::unordered_map<uintptr_t, uint32_t> m_registers;
+    std::vector<int32_t> m_envelope;
+    uint64_t m_reads = 0;
+    uint64_t m_writes = 0;
+};
+
+} // namespace synth
+
+#endif
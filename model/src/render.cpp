@@ -0,0 +1,124 @@
+// Render
+// Description:
+// Offline renderer, plays a script through the bit accurate models and writes
+// the output of the mixer to a 24 bit stereo WAV file. The channels are
+// rendered on --threads worker threads, the output does not depend on the
+// number of threads.
+//
+// Usage:
+// synth_render [--rate 48000|96000|192000] [--voices N] [--tanh polynomial|lut]
+//              [--engine reference|vector] [--threads N] [--wavetables DIR] SCRIPT OUTPUT.wav
+
+#include "parallel_renderer.h"
+#include "script.h"
+#include "wav_writer.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <exception>
+#include <string>
+#include <vector>
+
+#ifndef SYNTH_WAVETABLE_DIR
+#define SYNTH_WAVETABLE_DIR "repo/Oscillator_2.0/src"
+#endif
+
+namespace {
+
+void usage()
+{
+    std::fprintf(stderr, "usage: synth_render [--rate 48000|96000|192000] [--voices N] [--tanh polynomial|lut]\n"
+                         "                    [--engine reference|vector] [--threads N] [--wavetables DIR] SCRIPT OUTPUT.wav\n");
+}
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+    unsigned rateCode = 1;
+    int voices = 64;
+    auto tanh = synth::MoogLadderFilter::TanhImplementation::polynomial;
+    auto engine = synth::Synthesizer::Engine::vector;
+    int threads = 1;
+    std::string wavetableDir = SYNTH_WAVETABLE_DIR;
+    std::string scriptPath, outputPath;
+
+    for (int i = 1; i < argc; i++) {
+        const std::string arg = argv[i];
+        const bool hasValue = i + 1 < argc;
+        if (arg == "--rate" && hasValue) {
+            const std::string rate = argv[++i];
+            if (rate == "48000")       rateCode = 0;
+            else if (rate == "96000")  rateCode = 1;
+            else if (rate == "192000") rateCode = 2;
+            else { usage(); return 1; }
+        } else if (arg == "--voices" && hasValue) {
+            voices = std::atoi(argv[++i]);
+        } else if (arg == "--tanh" && hasValue) {
+            const std::string value = argv[++i];
+            if (value == "polynomial") tanh = synth::MoogLadderFilter::TanhImplementation::polynomial;
+            else if (value == "lut")   tanh = synth::MoogLadderFilter::TanhImplementation::lookupTable;
+            else { usage(); return 1; }
+        } else if (arg == "--engine" && hasValue) {
+            const std::string value = argv[++i];
+            if (value == "reference")   engine = synth::Synthesizer::Engine::reference;
+            else if (value == "vector") engine = synth::Synthesizer::Engine::vector;
+            else { usage(); return 1; }
+        } else if (arg == "--threads" && hasValue) {
+            threads = std::atoi(argv[++i]);
+        } else if (arg == "--wavetables" && hasValue) {
+            wavetableDir = argv[++i];
+        } else if (arg.rfind("--", 0) == 0) {
+            usage();
+            return 1;
+        } else if (scriptPath.empty()) {
+            scriptPath = arg;
+        } else if (outputPath.empty()) {
+            outputPath = arg;
+        } else {
+            usage();
+            return 1;
+        }
+    }
+    if (outputPath.empty()) {
+        usage();
+        return 1;
+    }
+
+    try {
+        const synth::Wavetables tables = synth::Wavetables::load(wavetableDir);
+        const synth::Script script = synth::Script::load(scriptPath);
+        synth::ParallelRenderer renderer(tables, rateCode, voices, tanh, engine, threads);
+        const double sampleRate = renderer.sampleRate();
+        synth::WavWriter wav(outputPath, uint32_t(sampleRate));
+
+        const auto start = std::chrono::steady_clock::now();
+        const long length = script.lengthSamples(sampleRate);
+        std::vector<int32_t> left(synth::ParallelRenderer::c_RUN_LENGTH), right(left.size());
+        auto event = script.events().begin();
+        for (long n = 0; n < length;) {
+            for (; event != script.events().end() && script.eventSample(*event, sampleRate) <= n; ++event)
+                renderer.apply(*event);
+            // up to the next event
+            long end = std::min(length, n + long(left.size()));
+            if (event != script.events().end())
+                end = std::min(end, script.eventSample(*event, sampleRate));
+            renderer.render(end - n, left.data(), right.data());
+            for (long i = 0; i < end - n; i++)
+                wav.write(left[i], right[i]);
+            n = end;
+        }
+        wav.close();
+        const double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        std::fprintf(stderr, "%ld samples (%.2f s) rendered in %.2f s, %.2fx realtime\n",
+                     length, length / sampleRate, elapsed, elapsed > 0.0 ? length / sampleRate / elapsed : 0.0);
+    } catch (const std::exception &e) {
+        std::fprintf(stderr, "synth_render: %s\n", e.what());
+        return 1;
+    }
+    return 0;
+}
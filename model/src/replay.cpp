@@ -0,0 +1,127 @@
+// Replay
+// Description:
+// Stress test of the voice allocation of the firmware. Plays a Standard MIDI
+// File through the MIDI handling of Synthesizer.h on the register space model
+// (see midi_replay.h) and reports the notes per second played, the allocation
+// failures, the stuck notes and the register accesses and host time of each
+// message type. --speed plays the file faster than its tempo, --steal the
+// voice steal policy of a note on with no free group (quietest by default, as
+// main() sets it), the envelope
+// options are the ADSR settings of the firmware (main() sets 0 s, 0 s, 1.0,
+// 0 s) and --tail the time the envelopes run after the last message, 1 s
+// longer than the release by default. Fails when a note was not played or is
+// stuck.
+//
+// Usage:
+// synth_replay [--speed F] [--unison 1|2|4|8] [--steal none|oldest|quietest|same-note]
+//              [--attack S] [--decay S] [--sustain L] [--release S] [--tail S] MIDI_FILE
+
+#include "midi_replay.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <exception>
+#include <string>
+
+namespace {
+
+void usage()
+{
+    std::fprintf(stderr, "usage: synth_replay [--speed F] [--unison 1|2|4|8] [--steal none|oldest|quietest|same-note]\n"
+                         "                    [--attack S] [--decay S] [--sustain L] [--release S] [--tail S] MIDI_FILE\n");
+}
+
+bool parseStealPolicy(const std::string &name, synth::MidiReplay::StealPolicy &policy)
+{
+    using synth::MidiReplay;
+    for (MidiReplay::StealPolicy p : { MidiReplay::StealPolicy::none, MidiReplay::StealPolicy::oldest,
+                                       MidiReplay::StealPolicy::quietest, MidiReplay::StealPolicy::sameNote }) {
+        if (name == MidiReplay::stealPolicyName(p)) {
+            policy = p;
+            return true;
+        }
+    }
+    return false;
+}
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+    using synth::MidiReplay;
+
+    MidiReplay::Settings settings;
+    double tail = -1.0;
+    std::string path;
+
+    for (int i = 1; i < argc; i++) {
+        const std::string arg = argv[i];
+        const bool hasValue = i + 1 < argc;
+        if (arg == "--speed" && hasValue) {
+            settings.speed = std::atof(argv[++i]);
+        } else if (arg == "--unison" && hasValue) {
+            settings.unisonVoices = unsigned(std::atoi(argv[++i]));
+        } else if (arg == "--steal" && hasValue) {
+            if (!parseStealPolicy(argv[++i], settings.stealPolicy)) {
+                usage();
+                return 1;
+            }
+        } else if (arg == "--attack" && hasValue) {
+            settings.attack = float(std::atof(argv[++i]));
+        } else if (arg == "--decay" && hasValue) {
+            settings.decay = float(std::atof(argv[++i]));
+        } else if (arg == "--sustain" && hasValue) {
+            settings.sustain = float(std::atof(argv[++i]));
+        } else if (arg == "--release" && hasValue) {
+            settings.release = float(std::atof(argv[++i]));
+        } else if (arg == "--tail" && hasValue) {
+            tail = std::atof(argv[++i]);
+        } else if (arg.rfind("--", 0) == 0 || !path.empty()) {
+            usage();
+            return 1;
+        } else {
+            path = arg;
+        }
+    }
+    if (path.empty() || settings.speed <= 0) {
+        usage();
+        return 1;
+    }
+    settings.tail = tail >= 0 ? tail : settings.release + 1.0;
+
+    try {
+        const synth::MidiFile file = synth::MidiFile::load(path);
+        const MidiReplay::Report report = MidiReplay::run(file, settings);
+
+        std::printf("%zu messages over %.2f s at speed %g, unison %u, steal %s\n", file.events().size(),
+                    report.seconds, settings.speed, settings.unisonVoices,
+                    MidiReplay::stealPolicyName(settings.stealPolicy));
+        std::printf("notes played        %ld, %.1f per second, peak %ld in one second\n", report.notesPlayed,
+                    report.notesPerSecond, report.peakNotesPerSecond);
+        std::printf("peak channels       %d assigned\n", report.peakAssignedChannels);
+        std::printf("voice steals        %ld\n", report.voiceSteals);
+        std::printf("freed interrupts    %ld, %.1f accesses each\n", report.voiceFreedInterrupts,
+                    report.voiceFreedInterrupts ? double(report.voiceFreedAccesses) / report.voiceFreedInterrupts : 0.0);
+        std::printf("allocation failures %ld\n", report.allocationFailures);
+        for (const MidiReplay::Failure &f : report.failures)
+            std::printf("  %.3f s note %d with %d channels assigned\n", f.time, f.note, f.assignedChannels);
+        std::printf("stuck notes         %zu\n", report.stuckNotes.size());
+        for (const MidiReplay::StuckNote &s : report.stuckNotes)
+            std::printf("  channel %d note %d, gate %s\n", s.channel, s.note, s.gate ? "on" : "off");
+
+        std::printf("%-14s %8s %12s %12s %14s %14s\n", "message", "count", "accesses", "max accesses",
+                    "ns per message", "max ns");
+        for (int t = 0; t < MidiReplay::c_NUM_MESSAGE_TYPES; t++) {
+            const MidiReplay::Cost &cost = report.cost[t];
+            if (cost.messages == 0)
+                continue;
+            std::printf("%-14s %8ld %12.1f %12llu %14.0f %14.0f\n", MidiReplay::messageTypeName(MidiReplay::MessageType(t)),
+                        cost.messages, double(cost.accesses) / cost.messages, (unsigned long long)cost.maxAccesses,
+                        cost.nanoseconds / cost.messages, cost.maxNanoseconds);
+        }
+        return report.allocationFailures == 0 && report.stuckNotes.empty() ? 0 : 1;
+    } catch (const std::exception &e) {
+        std::fprintf(stderr, "synth_replay: %s\n", e.what());
+        return 1;
+    }
+}
@@ -0,0 +1,172 @@
+#include "rtl_compare.h"
+
+#include "adsr.h"
+#include "mixer.h"
+#include "multiplier.h"
+#include "oscillator.h"
+
+#include <algorithm>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+#include <stdexcept>
+#include <utility>
+
+namespace synth {
+
+namespace {
+
+constexpr int c_ENVELOPE_SHIFT = 6;   // the NCA envelope is bits 23:6 of the ADSR stream
+
+long frameCount(const StreamLog &log, int frameSize)
+{
+    return long(log.data.size()) / frameSize;
+}
+
+void compareFrame(RtlCompare::Result &result, const StreamLog &log, long frame, int frameSize, const int32_t *model)
+{
+    for (int ch = 0; ch < frameSize; ch++) {
+        const size_t beat = size_t(frame) * frameSize + ch;
+        if (log.data[beat] == model[ch])
+            continue;
+        if (result.first.size() < RtlCompare::c_MAX_REPORTED)
+            result.first.push_back({ frame, log.period[beat], ch, log.data[beat], model[ch] });
+        result.mismatches++;
+    }
+}
+
+} // namespace
+
+StreamLog StreamLog::parse(std::istream &input)
+{
+    StreamLog log;
+    std::string text;
+    int line = 0;
+
+    while (std::getline(input, text)) {
+        line++;
+        std::istringstream fields(text);
+        long period;
+        long data;
+        if (!(fields >> period)) {
+            if (text.find_first_not_of(" \t\r") != std::string::npos)
+                throw std::runtime_error("log line " + std::to_string(line) + ": expected a sample period");
+            continue;
+        }
+        if (!(fields >> data) || data < -(1L << 23) || data >= (1L << 23))
+            throw std::runtime_error("log line " + std::to_string(line) + ": expected a 24 bit sample");
+        log.period.push_back(period);
+        log.data.push_back(int32_t(data));
+    }
+    return log;
+}
+
+StreamLog StreamLog::load(const std::string &path)
+{
+    std::ifstream file(path);
+    if (!file)
+        throw std::runtime_error("can not open log " + path);
+    try {
+        return parse(file);
+    } catch (const std::runtime_error &e) {
+        throw std::runtime_error(path + ": " + e.what());
+    }
+}
+
+RtlCompare::RtlCompare(const Wavetables &tables, int numChannels, int numOscillators,
+                       MoogLadderFilter::TanhImplementation tanh)
+    : m_tables(tables), m_numChannels(numChannels), m_numOscillators(numOscillators), m_tanh(tanh)
+{
+    if (numChannels < 1 || numChannels > 128)
+        throw std::invalid_argument("channels must be 1 to 128");
+    if (numOscillators < 1)
+        throw std::invalid_argument("at least one oscillator");
+}
+
+const char *RtlCompare::streamName(Stream stream)
+{
+    static const char *const c_NAMES[c_NUM_STREAMS] = { "oscillator", "adsr", "nca", "filter", "mixer" };
+    return c_NAMES[stream];
+}
+
+std::array<RtlCompare::Result, RtlCompare::c_NUM_STREAMS>
+RtlCompare::compare(const RegisterScript &script, const std::array<StreamLog, c_NUM_STREAMS> &logs) const
+{
+    const int N = m_numChannels;
+    std::array<Result, c_NUM_STREAMS> results;
+
+    Oscillator oscillatorModel(m_tables, N, m_numOscillators);
+    Adsr adsrModel(N);
+    Multiplier multiplierModel(N);
+    MoogLadderFilter filterModel(N, m_tanh);
+    Mixer mixerModel(N);
+    RegisterMap registers(oscillatorModel, adsrModel, filterModel);
+
+    // each module takes the writes due by the sample period of its frame
+    const std::vector<RegisterWrite> &writes = script.writes();
+    std::array<size_t, 3> nextWrite = {};
+    auto applyWrites = [&](RegisterWrite::Module module, long period) {
+        size_t &i = nextWrite[size_t(module)];
+        for (; i < writes.size() && writes[i].period <= period; i++) {
+            if (writes[i].module == module)
+                registers.write(writes[i]);
+        }
+    };
+
+    std::vector<int32_t> output(N), envelope(N);
+    const std::vector<int32_t> zero(N, 0);
+
+    const StreamLog &oscLog = logs[oscillator];
+    results[oscillator].frames = frameCount(oscLog, N);
+    for (long f = 0; f < results[oscillator].frames; f++) {
+        applyWrites(RegisterWrite::Module::oscillator, oscLog.period[f * N]);
+        oscillatorModel.process(nullptr, nullptr, output.data());
+        compareFrame(results[oscillator], oscLog, f, N, output.data());
+    }
+
+    // the active channel count after each ADSR frame, by sample period
+    std::vector<std::pair<long, unsigned>> activeChannels;
+    const StreamLog &adsrLog = logs[adsr];
+    results[adsr].frames = frameCount(adsrLog, N);
+    for (long f = 0; f < results[adsr].frames; f++) {
+        applyWrites(RegisterWrite::Module::adsr, adsrLog.period[f * N]);
+        adsrModel.process(output.data());
+        compareFrame(results[adsr], adsrLog, f, N, output.data());
+        activeChannels.emplace_back(adsrLog.period[f * N], adsrModel.activeChannelCount());
+    }
+
+    const StreamLog &ncaLog = logs[nca];
+    results[nca].frames = std::min({ frameCount(ncaLog, N), results[oscillator].frames, results[adsr].frames });
+    for (long f = 0; f < results[nca].frames; f++) {
+        for (int ch = 0; ch < N; ch++)
+            envelope[ch] = adsrLog.data[f * N + ch] >> c_ENVELOPE_SHIFT;
+        multiplierModel.process(&oscLog.data[f * N], envelope.data(), output.data());
+        compareFrame(results[nca], ncaLog, f, N, output.data());
+    }
+
+    const StreamLog &filterLog = logs[filter];
+    results[filter].frames = std::min(frameCount(filterLog, N), results[nca].frames);
+    for (long f = 0; f < results[filter].frames; f++) {
+        applyWrites(RegisterWrite::Module::filter, filterLog.period[f * N]);
+        filterModel.process(&ncaLog.data[f * N], zero.data(), zero.data(), output.data());
+        compareFrame(results[filter], filterLog, f, N, output.data());
+    }
+
+    const StreamLog &mixerLog = logs[mixer];
+    results[mixer].frames = std::min(frameCount(mixerLog, 1), results[filter].frames);
+    for (long f = 0; f < results[mixer].frames; f++) {
+        // the count of the last ADSR frame before the sample period
+        const long period = mixerLog.period[f];
+        auto last = std::lower_bound(activeChannels.begin(), activeChannels.end(), period,
+                                     [](const std::pair<long, unsigned> &count, long p) { return count.first < p; });
+        const unsigned count = last == activeChannels.begin() ? 0 : std::prev(last)->second;
+
+        int32_t mono, left, right;
+        mixerModel.process(&filterLog.data[f * N], count, mono, left, right);
+        compareFrame(results[mixer], mixerLog, f, 1, &mono);
+    }
+
+    return results;
+}
+
+} // namespace synth
@@ -0,0 +1,88 @@
+// RTL Compare
+// Description:
+// Compares the stream logs of tb_system with the bit accurate models, beat
+// by beat. tb_system runs a register script and logs every AXI-Stream
+// transfer of the oscillator, ADSR, NCA, filter and mixer outputs with
+// axis_log of axi_sim_package, one line per transfer:
+//
+//   <sample period> <data>
+//
+// where the sample period counts i_en from 0 and the data is the signed 24
+// bit sample. A frame is g_NUM_CHANNELS transfers, one for the mixer.
+//
+// The oscillator and ADSR models run the register script, the writes due by
+// the sample period of a frame are applied before the frame. The NCA, filter
+// and mixer models take their inputs from the logs of the streams that feed
+// them in tb_system, so a difference is reported at the module it starts in:
+//
+//   NCA     oscillator and ADSR frames of the same index
+//   filter  NCA frame of the same index, no envelope or modulation
+//   mixer   filter frame of the same index, the ADSR active channel count of
+//           the sample period before, as i_active_channels is sampled at i_en
+//
+// A partial frame at the end of a log is not compared.
+
+#ifndef RTL_COMPARE_H
+#define RTL_COMPARE_H
+
+#include "moog_ladder_filter.h"
+#include "register_script.h"
+#include "wavetables.h"
+
+#include <array>
+#include <cstdint>
+#include <istream>
+#include <string>
+#include <vector>
+
+namespace synth {
+
+struct StreamLog {
+    std::vector<long>    period;
+    std::vector<int32_t> data;
+
+    // throws std::runtime_error with the line number on a malformed line
+    static StreamLog parse(std::istream &input);
+    static StreamLog load(const std::string &path);
+};
+
+class RtlCompare {
+public:
+    enum Stream { oscillator, adsr, nca, filter, mixer, c_NUM_STREAMS };
+
+    static constexpr size_t c_MAX_REPORTED = 8;   // mismatches kept per stream
+
+    struct Mismatch {
+        long    frame;
+        long    period;
+        int     channel;
+        int32_t rtl;
+        int32_t model;
+    };
+
+    struct Result {
+        long frames = 0;
+        long mismatches = 0;
+        std::vector<Mismatch> first;   // up to c_MAX_REPORTED
+    };
+
+    // the generics of tb_system, g_NUM_CHANNELS and C_NUM_OSCILLATORS
+    RtlCompare(const Wavetables &tables, int numChannels = 8, int numOscillators = 2,
+               MoogLadderFilter::TanhImplementation tanh = MoogLadderFilter::TanhImplementation::polynomial);
+
+    // the log file of a stream, <stream>.log
+    static const char *streamName(Stream stream);
+
+    std::array<Result, c_NUM_STREAMS> compare(const RegisterScript &script,
+                                              const std::array<StreamLog, c_NUM_STREAMS> &logs) const;
+
+private:
+    const Wavetables &m_tables;
+    int m_numChannels;
+    int m_numOscillators;
+    MoogLadderFilter::TanhImplementation m_tanh;
+};
+
+} // namespace synth
+
+#endif
@@ -0,0 +1,156 @@
+#include "script.h"
+
+#include "synthesizer.h"
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <stdexcept>
+
+namespace synth {
+
+namespace {
+
+constexpr double c_TAIL_SECONDS = 1.0;
+
+// number of arguments of each command
+const std::map<std::string, size_t> &commands()
+{
+    static const std::map<std::string, size_t> c_COMMANDS = {
+        { "note_on", 1 },                  { "note_off", 1 },
+        { "osc_waveform", 2 },             { "osc_detune", 2 },
+        { "osc_pulse_width", 2 },          { "osc_mix", 2 },
+        { "osc_pwm", 2 },
+        { "adsr_attack", 2 },              { "adsr_decay", 2 },
+        { "adsr_sustain", 2 },             { "adsr_release", 2 },
+        { "filter_cutoff", 1 },            { "filter_resonance", 1 },
+        { "filter_type", 2 },              { "filter_envelope", 1 },
+        { "filter_modulation", 1 },        { "filter_modulation_amount", 1 },
+        { "filter_key_tracking", 1 },      { "filter_oversampling", 1 },
+        { "lfo_waveform", 2 },             { "lfo_rate", 2 },
+        { "lfo_amount", 2 },               { "lfo_polyphonic", 2 },
+        { "mod_amount", 3 },
+        { "mixer_stereo", 1 },             { "mixer_pan", 2 },
+        { "end", 0 },
+    };
+    return c_COMMANDS;
+}
+
+[[noreturn]] void error(int line, const std::string &message)
+{
+    throw std::runtime_error("script line " + std::to_string(line) + ": " + message);
+}
+
+} // namespace
+
+Script Script::parse(std::istream &input)
+{
+    Script script;
+    std::string text;
+    int line = 0;
+    bool ended = false;
+
+    while (std::getline(input, text)) {
+        line++;
+        text = text.substr(0, text.find('#'));
+        std::istringstream fields(text);
+        ScriptEvent event;
+        event.line = line;
+        if (!(fields >> event.time)) {
+            if (text.find_first_not_of(" \t\r") != std::string::npos)
+                error(line, "expected a time in seconds");
+            continue;
+        }
+        if (event.time < 0.0)
+            error(line, "negative time");
+        if (!(fields >> event.command))
+            error(line, "expected a command");
+
+        const auto command = commands().find(event.command);
+        if (command == commands().end())
+            error(line, "unknown command " + event.command);
+        double arg;
+        while (fields >> arg)
+            event.args.push_back(arg);
+        if (!fields.eof())
+            error(line, "malformed argument");
+        if (event.args.size() != command->second)
+            error(line, event.command + " takes " + std::to_string(command->second) + " arguments");
+
+        if (ended)
+            error(line, "event after end");
+        if (event.command == "end") {
+            ended = true;
+            script.m_endTime = event.time;
+        } else {
+            script.m_events.push_back(event);
+        }
+    }
+
+    std::stable_sort(script.m_events.begin(), script.m_events.end(),
+                     [](const ScriptEvent &a, const ScriptEvent &b) { return a.time < b.time; });
+    if (!ended)
+        script.m_endTime = (script.m_events.empty() ? 0.0 : script.m_events.back().time) + c_TAIL_SECONDS;
+    return script;
+}
+
+Script Script::load(const std::string &path)
+{
+    std::ifstream file(path);
+    if (!file)
+        throw std::runtime_error("can not open script " + path);
+    return parse(file);
+}
+
+long Script::eventSample(const ScriptEvent &event, double sampleRate) const
+{
+    return long(std::ceil(event.time * sampleRate));
+}
+
+long Script::lengthSamples(double sampleRate) const
+{
+    return long(std::ceil(m_endTime * sampleRate));
+}
+
+void Script::apply(const ScriptEvent &event, Synthesizer &synth)
+{
+    const std::string &c = event.command;
+    const std::vector<double> &a = event.args;
+    const auto i = [&](size_t n) { return int(std::lround(a[n])); };
+    const auto f = [&](size_t n) { return float(a[n]); };
+
+    try {
+        if      (c == "note_on")                  synth.noteOn(unsigned(i(0)) & 0x7F);
+        else if (c == "note_off")                 synth.noteOff(unsigned(i(0)) & 0x7F);
+        else if (c == "osc_waveform")             synth.setOscillatorWaveform(i(0), i(1));
+        else if (c == "osc_detune")               synth.setOscillatorDetune(i(0), i(1));
+        else if (c == "osc_pulse_width")          synth.setOscillatorPulseWidth(i(0), f(1));
+        else if (c == "osc_mix")                  synth.setOscillatorMix(i(0), f(1));
+        else if (c == "osc_pwm")                  synth.enableOscillatorPwm(i(0), unsigned(i(1)));
+        else if (c == "adsr_attack")              synth.setAdsrAttack(i(0), f(1));
+        else if (c == "adsr_decay")               synth.setAdsrDecay(i(0), f(1));
+        else if (c == "adsr_sustain")             synth.setAdsrSustain(i(0), f(1));
+        else if (c == "adsr_release")             synth.setAdsrRelease(i(0), f(1));
+        else if (c == "filter_cutoff")            synth.setFilterCutoffFrequency(f(0));
+        else if (c == "filter_resonance")         synth.setFilterResonance(f(0));
+        else if (c == "filter_type")              synth.setFilterType(i(0), i(1));
+        else if (c == "filter_envelope")          synth.setFilterEnvelopeAmount(f(0));
+        else if (c == "filter_modulation")        synth.setFilterModulationEnable(unsigned(i(0)));
+        else if (c == "filter_modulation_amount") synth.setFilterModulationAmount(f(0));
+        else if (c == "filter_key_tracking")      synth.setFilterKeyTracking(f(0));
+        else if (c == "filter_oversampling")      synth.setFilterOversampling(unsigned(i(0)));
+        else if (c == "lfo_waveform")             synth.setLfoWaveform(i(0), unsigned(i(1)));
+        else if (c == "lfo_rate")                 synth.setLfoRate(i(0), f(1));
+        else if (c == "lfo_amount")               synth.setLfoAmount(i(0), f(1));
+        else if (c == "lfo_polyphonic")           synth.setLfoPolyphonic(i(0), unsigned(i(1)));
+        else if (c == "mod_amount")               synth.setModMatrixAmount(unsigned(i(0)), unsigned(i(1)), f(2));
+        else if (c == "mixer_stereo")             synth.setMixerStereo(unsigned(i(0)));
+        else if (c == "mixer_pan")                synth.setMixerVoicePan(i(0), f(1));
+    } catch (const std::out_of_range &e) {
+        error(event.line, e.what());
+    }
+}
+
+} // namespace synth
@@ -0,0 +1,67 @@
+// Script
+// Description:
+// A render script, one timed event per line: "<seconds> <command> <args...>".
+// Blank lines and text after '#' are ignored. The commands are the firmware
+// calls of the Synthesizer model:
+//
+//   note_on <note>                     note_off <note>
+//   osc_waveform <osc> <waveform>      osc_detune <osc> <semitones>
+//   osc_pulse_width <osc> <pw>         osc_mix <osc> <mix>
+//   osc_pwm <osc> <enable>
+//   adsr_attack <adsr> <seconds>       adsr_decay <adsr> <seconds>
+//   adsr_sustain <adsr> <level>        adsr_release <adsr> <seconds>
+//   filter_cutoff <hz>                 filter_resonance <resonance>
+//   filter_type <type> <attenuation>   filter_envelope <amount>
+//   filter_modulation <enable>         filter_modulation_amount <amount>
+//   filter_key_tracking <amount>       filter_oversampling <enable>
+//   lfo_waveform <lfo> <waveform>      lfo_rate <lfo> <period seconds>
+//   lfo_amount <lfo> <amount>          lfo_polyphonic <lfo> <enable>
+//   mod_amount <destination> <source> <amount>
+//   mixer_stereo <enable>              mixer_pan <channel> <pan>
+//   end
+//
+// ADSR 0 is the amplitude envelope and ADSR 1 the filter envelope. An event
+// is applied before the first sample period at or after its time, the render
+// stops at the end event or otherwise one second after the last event.
+
+#ifndef SCRIPT_H
+#define SCRIPT_H
+
+#include <istream>
+#include <string>
+#include <vector>
+
+namespace synth {
+
+class Synthesizer;
+
+struct ScriptEvent {
+    double time = 0.0;
+    std::string command;
+    std::vector<double> args;
+    int line = 0;
+};
+
+class Script {
+public:
+    // throws std::runtime_error with the line number on a malformed line
+    static Script parse(std::istream &input);
+    static Script load(const std::string &path);
+
+    // sample period of each event and of the end of the render
+    long eventSample(const ScriptEvent &event, double sampleRate) const;
+    long lengthSamples(double sampleRate) const;
+
+    // applies one event to the synthesizer
+    static void apply(const ScriptEvent &event, Synthesizer &synth);
+
+    const std::vector<ScriptEvent> &events() const { return m_events; }
+
+private:
+    std::vector<ScriptEvent> m_events;   // in time order
+    double m_endTime = 0.0;
+};
+
+} // namespace synth
+
+#endif
@@ -0,0 +1,390 @@
+#include "synthesizer.h"
+
+#include "fixed_point.h"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace synth {
+
+namespace {
+
+constexpr uint32_t c_ADSR_MAX_VALUE   = 8388607;
+constexpr uint32_t c_MIXER_PAN_CENTER = 128;
+
+// float to integer conversion of the Cortex-A9, which saturates where C leaves it undefined
+uint32_t toU32(double value)
+{
+    if (!(value > 0.0))
+        return 0;
+    if (value >= 4294967295.0)
+        return 0xFFFFFFFF;
+    return uint32_t(value);
+}
+
+int32_t toI32(double value)
+{
+    if (std::isnan(value))
+        return 0;
+    if (value <= -2147483648.0)
+        return INT32_MIN;
+    if (value >= 2147483647.0)
+        return INT32_MAX;
+    return int32_t(value);
+}
+
+// register fields are sliced out of the written word
+int32_t signedField(uint32_t value, int bits)
+{
+    return int32_t(wrapSigned(value, bits));
+}
+
+void checkIndex(int index, int size, const char *what)
+{
+    if (index < 0 || index >= size)
+        throw std::out_of_range(std::string(what) + " index out of range");
+}
+
+} // namespace
+
+Synthesizer::Synthesizer(const Wavetables &tables, unsigned sampleRate, int numVoices,
+                         MoogLadderFilter::TanhImplementation tanh, Engine engine, int firstChannel, int numChannels)
+    : oscillator(tables, numChannels, c_NUM_OSCILLATORS),
+      adsr { Adsr(numChannels), Adsr(numChannels) },
+      lfo(c_NUM_LFOS, LowFrequencyOscillator(tables, numChannels)),
+      modMatrix(numChannels),
+      multiplier(numChannels),
+      filter(numChannels, tanh),
+      mixer(numChannels),
+      m_engine(engine),
+      m_audioFreq(48000.0 * (1 << sampleRate)),
+      m_firstChannel(firstChannel),
+      m_numChannels(numChannels),
+      m_numVoices(std::min(std::max(numVoices - firstChannel, 0), numChannels)),
+      m_assignedChannels(numChannels, -1)
+{
+    if (sampleRate > 2)
+        throw std::invalid_argument("sample rate code must be 0, 1 or 2");
+    if (numVoices < 1 || numVoices > c_NUM_CHANNELS)
+        throw std::invalid_argument("number of voices must be between 1 and 128");
+    if (firstChannel < 0 || numChannels < 1 || firstChannel + numChannels > c_NUM_CHANNELS)
+        throw std::invalid_argument("channel block must lie within the 128 channels");
+    if (engine == Engine::vector)
+        m_vectorEngine.reset(new VectorEngine(tables, numChannels));
+    filter.sampleRate = sampleRate;
+
+    for (auto *frame : { &m_freqModZ1, &m_pwModZ1, &m_multiplierZ1, &m_filterEnvelopeZ1, &m_cutoffModZ1, &m_filterZ1 })
+        frame->fill(0);
+
+    // the initial values of main()
+    setOscillatorMix(0, 1.0);
+    setOscillatorMix(1, 0.0);
+    setOscillatorMix(2, 0.0);
+    for (int osc = 0; osc < c_NUM_OSCILLATORS; osc++) {
+        setOscillatorWaveform(osc, 0);
+        setOscillatorDetune(osc, 0);
+        enableOscillatorPwm(osc, 1);
+    }
+
+    for (int env = 0; env < c_NUM_ADSRS; env++) {
+        setAdsrAttack(env, 0.0);
+        setAdsrDecay(env, 0.0);
+        setAdsrSustain(env, 1.0);
+        setAdsrRelease(env, 0.0);
+    }
+
+    setFilterCutoffFrequency(20000);
+    setFilterResonance(0);
+    setFilterType(0, 1);
+    setFilterEnvelopeAmount(0.0);
+    setFilterModulationEnable(1);
+    setFilterModulationAmount(1.0);
+    setFilterKeyTracking(0.0);
+    setFilterOversampling(0);
+
+    setModMatrixAmount(ModMatrix::pitch, 0, 1.0);
+    setModMatrixAmount(ModMatrix::pulseWidth, 2, 1.0);
+    setModMatrixAmount(ModMatrix::cutoff, 1, 1.0);
+    setModMatrixAmount(ModMatrix::cutoff, ModMatrix::c_ENVELOPE_SLOT + 1, 0.0);
+    setModMatrixAmount(ModMatrix::amplitude, ModMatrix::c_ENVELOPE_SLOT, 1.0);
+}
+
+void Synthesizer::process(int32_t &left, int32_t &right)
+{
+    Mixer::Sums sums;
+    unsigned activeChannels;
+    processChannels(sums, activeChannels);
+    int32_t mono;
+    mixer.output(sums, activeChannels, mono, left, right);
+}
+
+void Synthesizer::processChannels(Mixer::Sums &sums, unsigned &activeChannels)
+{
+    for (int i = 0; i < c_NUM_LFOS; i++)
+        lfo[i].process(m_lfo[i].data());
+    const bool vector = m_engine == Engine::vector;
+    for (int i = 0; i < c_NUM_ADSRS; i++) {
+        if (vector)
+            m_vectorEngine->adsr(i, adsr[i], m_adsr[i].data());
+        else
+            adsr[i].process(m_adsr[i].data());
+    }
+
+    std::array<const int32_t *, ModMatrix::c_NUM_SOURCES> sources {};
+    for (int i = 0; i < c_NUM_LFOS; i++)
+        sources[i] = m_lfo[i].data();
+    for (int i = 0; i < c_NUM_ADSRS; i++)
+        sources[ModMatrix::c_ENVELOPE_SLOT + i] = m_adsr[i].data();
+    std::array<int32_t *, ModMatrix::c_NUM_DESTINATIONS> destinations;
+    for (int d = 0; d < ModMatrix::c_NUM_DESTINATIONS; d++)
+        destinations[d] = m_modulation[d].data();
+    if (vector)
+        m_vectorEngine->modMatrix(modMatrix, sources, destinations);
+    else
+        modMatrix.process(sources, destinations);
+
+    if (vector)
+        m_vectorEngine->oscillator(oscillator, m_freqModZ1.data(), m_pwModZ1.data(), m_oscillator.data());
+    else
+        oscillator.process(m_freqModZ1.data(), m_pwModZ1.data(), m_oscillator.data());
+
+    for (int ch = 0; ch < m_numChannels; ch++)
+        m_amplitude[ch] = m_modulation[ModMatrix::amplitude][ch] >> 6;
+    if (vector)
+        m_vectorEngine->multiplier(m_oscillator.data(), m_amplitude.data(), m_multiplier.data());
+    else
+        multiplier.process(m_oscillator.data(), m_amplitude.data(), m_multiplier.data());
+
+    if (vector)
+        m_vectorEngine->filter(filter, m_multiplierZ1.data(), m_filterEnvelopeZ1.data(), m_cutoffModZ1.data(), m_filter.data());
+    else
+        filter.process(m_multiplierZ1.data(), m_filterEnvelopeZ1.data(), m_cutoffModZ1.data(), m_filter.data());
+
+    if (vector)
+        sums = m_vectorEngine->mixer(mixer, m_filterZ1.data());
+    else
+        sums = mixer.sum(m_filterZ1.data());
+    activeChannels = m_activeChannelsZ1;
+
+    // hand over to the next sample period, the 24 bit streams are sliced to 18 bits where
+    // the block design connects the top bits
+    for (int ch = 0; ch < m_numChannels; ch++) {
+        m_freqModZ1[ch]        = m_modulation[ModMatrix::pitch][ch] >> 6;
+        m_pwModZ1[ch]          = m_modulation[ModMatrix::pulseWidth][ch];
+        m_cutoffModZ1[ch]      = m_modulation[ModMatrix::cutoff][ch] >> 6;
+        m_filterEnvelopeZ1[ch] = m_adsr[1][ch] >> 6;
+    }
+    m_multiplierZ1 = m_multiplier;
+    m_filterZ1 = m_filter;
+    m_activeChannelsZ1 = activeChannelCount();
+}
+
+bool Synthesizer::channelFree(int channel) const
+{
+    return m_engine == Engine::vector ? m_vectorEngine->channelFree(0, channel) : adsr[0].channelFree(channel);
+}
+
+unsigned Synthesizer::activeChannelCount() const
+{
+    return m_engine == Engine::vector ? m_vectorEngine->activeChannelCount(0) : adsr[0].activeChannelCount();
+}
+
+bool Synthesizer::noteOn(unsigned note)
+{
+    int i = 0;
+    while (i < m_numVoices && (!channelFree(i) || m_assignedChannels[i] != -1))
+        i++;
+    if (i == m_numVoices)
+        return false;
+
+    float freq = 8.18*powf(2.0, note/12.0);
+    float fcw = freq*1048576.0/m_audioFreq;
+    oscillator.channel[i].fcw = uint32_t(wrapUnsigned(toU32(fcw), 18));
+    oscillator.channel[i].modEnable = true;
+    filter.keyNote[i] = uint8_t(note & 0x7F);
+    for (auto &l : lfo)
+        l.channelOn[i] = true;
+    m_assignedChannels[i] = int(note);
+    adsr[0].noteOn[i] = true;
+    adsr[1].noteOn[i] = true;
+    return true;
+}
+
+bool Synthesizer::noteOff(unsigned note)
+{
+    int i = 0;
+    while (i < m_numVoices && m_assignedChannels[i] != int(int8_t(note)))
+        i++;
+    if (i == m_numVoices)
+        return false;
+
+    adsr[0].noteOn[i] = false;
+    adsr[1].noteOn[i] = false;
+    for (auto &l : lfo)
+        l.channelOn[i] = false;
+    m_assignedChannels[i] = -1;
+    return true;
+}
+
+void Synthesizer::setOscillatorDetune(int osc, int semitones)
+{
+    checkIndex(osc, c_NUM_OSCILLATORS, "oscillator");
+    float detune = powf(2.0, (semitones)/12.0);
+    uint32_t msg = toU32(powf(2.0, 14.0) * detune);
+    oscillator.oscillator[osc].detune = uint32_t(wrapUnsigned(msg, 18));
+}
+
+void Synthesizer::setOscillatorWaveform(int osc, int waveform)
+{
+    checkIndex(osc, c_NUM_OSCILLATORS, "oscillator");
+    oscillator.oscillator[osc].waveSelect = unsigned(waveform) & 3;
+}
+
+void Synthesizer::setOscillatorPulseWidth(int osc, float pw)
+{
+    checkIndex(osc, c_NUM_OSCILLATORS, "oscillator");
+    oscillator.oscillator[osc].pulseWidth = signedField(toU32(8388607.0 * pw), 24);
+}
+
+void Synthesizer::setOscillatorMix(int osc, float mix)
+{
+    checkIndex(osc, c_NUM_OSCILLATORS, "oscillator");
+    oscillator.oscillator[osc].amplitude = signedField(toU32(mix * 131071), 18);
+}
+
+void Synthesizer::enableOscillatorPwm(int osc, unsigned enable)
+{
+    checkIndex(osc, c_NUM_OSCILLATORS, "oscillator");
+    oscillator.oscillator[osc].pwmEnable = enable & 1;
+}
+
+void Synthesizer::setAdsrAttack(int env, float time)
+{
+    checkIndex(env, c_NUM_ADSRS, "ADSR");
+    uint32_t attackCW = time == 0 ? c_ADSR_MAX_VALUE : toU32(c_ADSR_MAX_VALUE / (time * m_audioFreq));
+    adsr[env].attackCw = signedField(attackCW, 24);
+}
+
+void Synthesizer::setAdsrSustain(int env, float level)
+{
+    checkIndex(env, c_NUM_ADSRS, "ADSR");
+    uint32_t sustainLevel = toU32(c_ADSR_MAX_VALUE * level);
+    adsr[env].sustainLevel = signedField(sustainLevel, 24);
+}
+
+void Synthesizer::setAdsrDecay(int env, float time)
+{
+    checkIndex(env, c_NUM_ADSRS, "ADSR");
+    uint32_t sustainLevel = uint32_t(wrapUnsigned(uint32_t(adsr[env].sustainLevel), 24));
+    uint32_t decayCW = (time == 0) ? (c_ADSR_MAX_VALUE - sustainLevel) : toU32((c_ADSR_MAX_VALUE - sustainLevel) / (time * m_audioFreq));
+    adsr[env].decayCw = signedField(decayCW, 24);
+}
+
+void Synthesizer::setAdsrRelease(int env, float time)
+{
+    checkIndex(env, c_NUM_ADSRS, "ADSR");
+    uint32_t sustainLevel = uint32_t(wrapUnsigned(uint32_t(adsr[env].sustainLevel), 24));
+    uint32_t releaseCW = (time == 0) ? sustainLevel : toU32(sustainLevel / (time * m_audioFreq));
+    adsr[env].releaseCw = signedField(releaseCW, 24);
+}
+
+void Synthesizer::setFilterCutoffFrequency(float frequency)
+{
+    uint32_t freq = toU32(frequency*32768/m_audioFreq*2*3.14159);
+    filter.cutoffFrequency = signedField(freq, 18);
+}
+
+void Synthesizer::setFilterType(int type, int attenuation)
+{
+    filter.filterType = unsigned(type) & 3;
+    filter.filterAttenuation = unsigned(attenuation) & 1;
+}
+
+void Synthesizer::setFilterResonance(float resonance)
+{
+    uint32_t res = toU32(resonance * 32767);
+    filter.resonance = signedField(res, 18);
+}
+
+void Synthesizer::setFilterEnvelopeAmount(float amount)
+{
+    uint32_t am = toU32(amount*20000.0/m_audioFreq*2*3.14159*32767);
+    filter.adsrAmount = signedField(am, 18);
+}
+
+void Synthesizer::setFilterModulationEnable(unsigned value)
+{
+    filter.modulationEnable = value & 1;
+}
+
+void Synthesizer::setFilterModulationAmount(float amount)
+{
+    uint32_t value = toU32(amount * 42893);
+    filter.modulationAmount = signedField(value, 18);
+}
+
+void Synthesizer::setFilterKeyTracking(float amount)
+{
+    uint32_t value = toU32(amount * 32768);
+    filter.keyTrackingAmount = signedField(value, 18);
+}
+
+void Synthesizer::setFilterOversampling(unsigned value)
+{
+    filter.oversampleEnable = value & 1;
+}
+
+void Synthesizer::setLfoWaveform(int index, unsigned waveform)
+{
+    checkIndex(index, c_NUM_LFOS, "LFO");
+    lfo[index].waveform = waveform & 3;
+}
+
+void Synthesizer::setLfoRate(int index, float period)
+{
+    checkIndex(index, c_NUM_LFOS, "LFO");
+    uint32_t fcw = toU32(16777216.0/m_audioFreq/period);
+    lfo[index].fcw = uint32_t(wrapUnsigned(fcw, 24));
+}
+
+void Synthesizer::setLfoAmount(int index, float amount)
+{
+    checkIndex(index, c_NUM_LFOS, "LFO");
+    uint32_t value = toU32(32767 * amount);
+    lfo[index].amount = signedField(value, 16);
+}
+
+void Synthesizer::setLfoPolyphonic(int index, unsigned value)
+{
+    checkIndex(index, c_NUM_LFOS, "LFO");
+    lfo[index].polyphonic = value & 1;
+}
+
+void Synthesizer::setModMatrixAmount(unsigned destination, unsigned source, float amount)
+{
+    checkIndex(int(destination), ModMatrix::c_NUM_DESTINATIONS, "modulation destination");
+    checkIndex(int(source), ModMatrix::c_NUM_SOURCES, "modulation source");
+    int32_t value = toI32(amount * 32768);
+    modMatrix.amount[destination][source] = signedField(uint32_t(value) & 0x3FFFF, 18);
+}
+
+void Synthesizer::setMixerStereo(unsigned enable)
+{
+    mixer.stereoEnable = enable & 1;
+}
+
+void Synthesizer::setMixerVoicePan(int channel, float pan)
+{
+    checkIndex(channel, c_NUM_CHANNELS, "channel");
+    channel -= m_firstChannel;
+    if (channel < 0 || channel >= m_numChannels)
+        return;
+    if (pan < -1.0)
+        pan = -1.0;
+    else if (pan > 1.0)
+        pan = 1.0;
+    mixer.pan[channel] = uint32_t(wrapUnsigned(toU32((pan + 1.0) * c_MIXER_PAN_CENTER + 0.5), 9));
+}
+
+} // namespace synth
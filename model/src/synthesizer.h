@@ -0,0 +1,142 @@
+// Synthesizer
+// Description:
+// The block design signal chain of the models, one call to process is one
+// sample period. The setters mirror the functions of the firmware
+// (Synthesizer.h) and use the same float to register conversions, so a script
+// of firmware calls renders what the hardware would play. The module inputs
+// are taken from the FIFOs between the IPs in steady state:
+//
+//   LFO A/B/C, ADSR 0/1 -> Mod Matrix             same sample period
+//   Mod Matrix pitch/PW -> Oscillator             previous sample period
+//   Oscillator, Mod Matrix amplitude -> Multiplier same sample period
+//   Multiplier, ADSR 1, Mod Matrix cutoff -> Moog  previous sample period
+//   Moog, ADSR 0 active count -> Mixer            previous sample period
+//
+// The Effects IP between the mixer and the I2S transmitter is not modelled,
+// the output is the mixer output.
+//
+// The per voice modules run either on the reference models or on the
+// structure of arrays kernels of VectorEngine, which are bit exact with them.
+// The LFOs run on the reference models with both engines.
+//
+// A synthesizer can also model a block of the channels, firstChannel to
+// firstChannel+numChannels-1, for ParallelRenderer. The channels are
+// independent up to the mixer, so the blocks render the channels of the whole
+// chain and their mixer sums and active channel counts add up to the sums and
+// count of all channels. A block plays the voices of the firmware that fall
+// in it, channel numbers stay those of the whole chain.
+
+#ifndef SYNTHESIZER_H
+#define SYNTHESIZER_H
+
+#include "adsr.h"
+#include "low_frequency_oscillator.h"
+#include "mixer.h"
+#include "mod_matrix.h"
+#include "moog_ladder_filter.h"
+#include "multiplier.h"
+#include "oscillator.h"
+#include "vector_engine.h"
+#include "wavetables.h"
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace synth {
+
+class Synthesizer {
+public:
+    static constexpr int c_NUM_CHANNELS    = 128;   // g_NUM_CHANNELS of the IPs
+    static constexpr int c_NUM_OSCILLATORS = 3;
+    static constexpr int c_NUM_LFOS        = 3;
+    static constexpr int c_NUM_ADSRS       = 2;     // amplitude, filter
+
+    enum class Engine { reference, vector };
+
+    // sampleRate is the setSampleRate code, 48kHz (0), 96kHz (1) or 192kHz (2),
+    // numVoices is NUM_CHANNELS of the firmware
+    Synthesizer(const Wavetables &tables, unsigned sampleRate = 1, int numVoices = 64,
+                MoogLadderFilter::TanhImplementation tanh = MoogLadderFilter::TanhImplementation::polynomial,
+                Engine engine = Engine::reference, int firstChannel = 0, int numChannels = c_NUM_CHANNELS);
+    Synthesizer(const Synthesizer &) = delete;
+    Synthesizer &operator=(const Synthesizer &) = delete;
+
+    // one sample period
+    void process(int32_t &left, int32_t &right);
+    // one sample period up to the mixer, the mixer sums of the channels and
+    // the active channel count the mixer normalises them by
+    void processChannels(Mixer::Sums &sums, unsigned &activeChannels);
+
+    float sampleRate() const { return m_audioFreq; }
+
+    // SynthNoteOn, SynthNoteOff, false when no channel was found
+    bool noteOn(unsigned note);
+    bool noteOff(unsigned note);
+
+    void setOscillatorDetune(int oscillator, int semitones);
+    void setOscillatorWaveform(int oscillator, int waveform);
+    void setOscillatorPulseWidth(int oscillator, float pw);
+    void setOscillatorMix(int oscillator, float mix);
+    void enableOscillatorPwm(int oscillator, unsigned enable);
+
+    void setAdsrAttack(int adsr, float time);
+    void setAdsrSustain(int adsr, float level);
+    void setAdsrDecay(int adsr, float time);
+    void setAdsrRelease(int adsr, float time);
+
+    void setFilterCutoffFrequency(float frequency);
+    void setFilterType(int type, int attenuation);
+    void setFilterResonance(float resonance);
+    void setFilterEnvelopeAmount(float amount);
+    void setFilterModulationEnable(unsigned value);
+    void setFilterModulationAmount(float amount);
+    void setFilterKeyTracking(float amount);
+    void setFilterOversampling(unsigned value);
+
+    void setLfoWaveform(int lfo, unsigned waveform);
+    void setLfoRate(int lfo, float period);
+    void setLfoAmount(int lfo, float amount);
+    void setLfoPolyphonic(int lfo, unsigned value);
+
+    void setModMatrixAmount(unsigned destination, unsigned source, float amount);
+
+    void setMixerStereo(unsigned enable);
+    void setMixerVoicePan(int channel, float pan);
+
+    // with the vector engine the per voice modules hold the parameters only
+    Oscillator                            oscillator;
+    std::array<Adsr, c_NUM_ADSRS>         adsr;
+    std::vector<LowFrequencyOscillator>   lfo;
+    ModMatrix                             modMatrix;
+    Multiplier                            multiplier;
+    MoogLadderFilter                      filter;
+    Mixer                                 mixer;
+
+private:
+    using Frame = std::array<int32_t, c_NUM_CHANNELS>;
+
+    bool channelFree(int channel) const;
+    unsigned activeChannelCount() const;
+
+    Engine m_engine;
+    std::unique_ptr<VectorEngine> m_vectorEngine;
+    float m_audioFreq;
+    int m_firstChannel;
+    int m_numChannels;
+    int m_numVoices;   // of the block
+    std::vector<int> m_assignedChannels;
+
+    // module outputs, the _z1 copies hold the previous sample period
+    std::array<Frame, c_NUM_LFOS>  m_lfo;
+    std::array<Frame, c_NUM_ADSRS> m_adsr;
+    std::array<Frame, ModMatrix::c_NUM_DESTINATIONS> m_modulation;
+    Frame m_oscillator, m_amplitude, m_multiplier, m_filter;
+    Frame m_freqModZ1, m_pwModZ1, m_multiplierZ1, m_filterEnvelopeZ1, m_cutoffModZ1, m_filterZ1;
+    unsigned m_activeChannelsZ1 = 0;
+};
+
+} // namespace synth
+
+#endif
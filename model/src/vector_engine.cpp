@@ -0,0 +1,519 @@
+#include "vector_engine.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace synth {
+
+namespace {
+
+constexpr int c_DATA_WIDTH  = 24;
+constexpr int c_COEF_WIDTH  = 18;
+constexpr int32_t c_DATA_MAX = (1 << (c_DATA_WIDTH - 1)) - 1;
+constexpr int32_t c_DATA_MIN = -(1 << (c_DATA_WIDTH - 1));
+
+// The fixed_point.h operations in the forms the vectoriser maps to lane
+// instructions. A 64 bit arithmetic shift is a logical shift with the sign
+// extended by the xor/subtract trick, and a resize takes the sign from the
+// top bit with a logical shift.
+
+// value >> shift of a signed value
+inline int64_t shiftRight(int64_t value, int shift)
+{
+    const uint64_t sign = uint64_t(1) << (63 - shift);
+    return int64_t(((uint64_t(value) >> shift) ^ sign) - sign);
+}
+
+// wrapSigned for any width
+inline int64_t wrap(int64_t value, int bits)
+{
+    const uint64_t sign = uint64_t(1) << (bits - 1);
+    return int64_t(((uint64_t(value) & ((sign << 1) - 1)) ^ sign) - sign);
+}
+
+// wrapSigned to 32 bits or less
+inline int32_t wrap32(int64_t value, int bits)
+{
+    return int32_t(uint32_t(value) << (32 - bits)) >> (32 - bits);
+}
+
+// resizeSigned(value >> shift, bits) to 32 bits or less
+inline int32_t narrow(int64_t value, int shift, int bits)
+{
+    const uint32_t low  = uint32_t(uint64_t(value) >> shift) & ((uint32_t(1) << (bits - 1)) - 1);
+    const uint32_t sign = 0u - uint32_t(uint64_t(value) >> 63);
+    return int32_t(low | (sign << (bits - 1)));
+}
+
+// resizeSigned of a 32 bit value
+inline int32_t resize32(int32_t value, int bits)
+{
+    return narrow(value, 0, bits);
+}
+
+// Oscillator
+
+constexpr int c_PHASE_WIDTH          = 20;
+constexpr int c_WAVETABLE_ADDR_WIDTH = 11;
+
+enum Waveform { sine, sawtooth, triangle, square };
+
+// the per channel oscillator inputs, gathered once for all oscillators
+struct OscillatorChannels {
+    uint32_t fcw[VectorEngine::c_NUM_CHANNELS];
+    uint32_t unisonDetune[VectorEngine::c_NUM_CHANNELS];
+    int32_t  freqMod[VectorEngine::c_NUM_CHANNELS];   // zero when the modulation is disabled
+    int32_t  pwMod[VectorEngine::c_NUM_CHANNELS];
+    int      numChannels;
+};
+
+// one oscillator over all channels, the waveform is a template parameter so
+// the table reads are unswitched out of the channel loop. The pulse width,
+// the phase and the table reads are separate loops, the vectoriser gives up
+// on the square wave when they are one.
+template <int t_WAVEFORM>
+void oscillatorLanes(const OscillatorChannels &channels, const Oscillator::OscillatorParams &osc,
+                     const int32_t *__restrict sineTable, const int32_t *__restrict table,
+                     uint32_t *__restrict phase, int32_t *__restrict sum)
+{
+    constexpr int c_LANES = VectorEngine::c_NUM_CHANNELS;
+    const int numChannels = channels.numChannels;
+    const uint32_t detune    = osc.detune;
+    const int32_t  amplitude = osc.amplitude;
+    const int32_t  pw        = osc.pulseWidth;
+    const bool     pwm       = osc.pwmEnable;
+
+    // the second sawtooth of the square is offset by the pulse width
+    uint32_t pwOffset[c_LANES];
+    int32_t  pwHalf[c_LANES];
+    if (t_WAVEFORM == square) {
+        for (int ch = 0; ch < numChannels; ch++) {
+            const int32_t  pwTotal = pwm ? pw + channels.pwMod[ch] : pw;
+            const uint32_t pwRange = (uint32_t(pwTotal) & 0x1FFFFFF) >> 23;
+            const int32_t  pwSaturated = pwRange == 1 ? c_DATA_MAX : pwRange == 2 ? -c_DATA_MAX : pwTotal;
+            pwOffset[ch] = ((uint32_t(pwSaturated) & 0xFFFFFF) >> 13) + (1u << (c_WAVETABLE_ADDR_WIDTH - 1));
+            pwHalf[ch]   = pwSaturated >> 1;
+        }
+    }
+
+    uint32_t addrA[c_LANES], addrB[c_LANES];
+    for (int ch = 0; ch < numChannels; ch++) {
+        // bits 31 downto 14 of the product, the 32 bit multiply is enough
+        const uint32_t chDetune = ((detune * channels.unisonDetune[ch]) >> 14) & 0x3FFFF;
+        // the low bits of (fcw*detune) >> 14 from two 32 bit products, split at bit 14
+        const uint32_t fcw = channels.fcw[ch];
+        const uint32_t fcwDetuned = (fcw >> 14) * chDetune + (((fcw & 0x3FFF) * chDetune) >> 14);
+        const int32_t  fcwDetunedZ1 = wrap32(fcwDetuned, c_PHASE_WIDTH);
+        const int64_t  freqModFactor = int64_t(fcwDetunedZ1) * channels.freqMod[ch];
+
+        const int32_t  fcwTotal = wrap32(fcwDetunedZ1 + narrow(freqModFactor, 17, c_PHASE_WIDTH), c_PHASE_WIDTH);
+        const uint32_t ph = (phase[ch] + uint32_t(fcwTotal)) & ((1u << c_PHASE_WIDTH) - 1);
+        phase[ch] = ph;
+
+        // the octave is the highest bit set of 16 downto 8, counted by comparisons
+        const uint32_t octaveBits = (uint32_t(fcwTotal) >> 8) & 0x1FF;
+        uint32_t octave = 0;
+        for (int bit = 0; bit < 9; bit++)
+            octave += octaveBits >= (1u << bit);
+        const uint32_t base = octave << c_WAVETABLE_ADDR_WIDTH;
+
+        const uint32_t address = ph >> (c_PHASE_WIDTH - c_WAVETABLE_ADDR_WIDTH);
+        addrA[ch] = t_WAVEFORM == sine ? address >> 3 : base + address;
+        if (t_WAVEFORM == square)
+            addrB[ch] = base + ((address + pwOffset[ch]) & ((1u << c_WAVETABLE_ADDR_WIDTH) - 1));
+    }
+
+    for (int ch = 0; ch < numChannels; ch++) {
+        int32_t wave;
+        if (t_WAVEFORM == sine)
+            wave = sineTable[addrA[ch]];
+        else if (t_WAVEFORM == square)
+            wave = resize32(wrap32(table[addrA[ch]] - table[addrB[ch]] + pwHalf[ch], c_DATA_WIDTH + 1), c_DATA_WIDTH);
+        else
+            wave = table[addrA[ch]];
+
+        const int32_t out = narrow(int64_t(wave) * amplitude, 17, c_DATA_WIDTH);
+        sum[ch] = wrap32(sum[ch] + out, c_DATA_WIDTH);
+    }
+}
+
+// Moog ladder filter, the constants of moog_ladder_filter.cpp
+
+constexpr int c_TANH_SUM_WIDTH   = c_DATA_WIDTH + c_COEF_WIDTH + 1;
+constexpr int c_TANH_DATA_SCALE  = 23;
+constexpr int c_TANH_COEF_SCALE  = 16;
+constexpr int c_TANH_INPUT_WIDTH = 25;
+constexpr int c_TANH_FRAC_WIDTH  = 16;
+constexpr int32_t c_TANH_COEFFICIENT[6] = { 0, 73293, 0, -12523, 0, 3480 };
+
+constexpr int c_POLY_SUM_WIDTH = 2 * c_COEF_WIDTH + 1;
+constexpr int c_POLY_SCALE     = 15;
+constexpr int32_t c_POLY_COEFFICIENTS[5] = { -661, 4525, -14227, 32414, 0 };
+
+constexpr int c_COEF_SCALE_FACTOR  = 15;
+constexpr int c_ONE_POLE_SUM_WIDTH = c_DATA_WIDTH + c_COEF_WIDTH + 1;
+constexpr int32_t c_COEF_A = 25206;
+constexpr int32_t c_COEF_B = 7561;
+
+constexpr int32_t c_FEEDFORWARD_COEFFICIENTS[8][5] = {
+    { 0, 0, 1, 0, 0 },
+    { 0, 0, 0, 0, 1 },
+    { 1,-2, 1, 0, 0 },
+    { 1,-4, 6,-4, 1 },
+    { 0, 2,-2, 0, 0 },
+    { 0, 0, 4,-8, 4 },
+    { 0, 0, 0, 0, 1 },
+    { 0, 0, 0, 0, 1 },
+};
+
+// MoogLadderFilter::tanhPolynomial
+inline int32_t tanhPolynomial(int32_t x)
+{
+    const int32_t top = x >> 24;
+    const int32_t input = top >= 2 ? (1 << 20) - 1 : top < -2 ? -(1 << 20) : resize32(x >> 1, c_DATA_WIDTH);
+
+    // the products are of 32 bit operands so they map to the widening lane multiplies
+    const auto term = [](int64_t sum) { return narrow(sum, c_TANH_DATA_SCALE - 1, c_COEF_WIDTH); };
+    const auto signBit = [](int64_t value) { return int32_t(uint64_t(value) >> 63); };
+    constexpr int64_t c_SCALE = int64_t(1) << (c_TANH_DATA_SCALE - 1);
+
+    const int64_t p0 = int64_t(input) * c_TANH_COEFFICIENT[5];
+    const int64_t s0 = wrap(p0 + c_TANH_COEFFICIENT[4] * c_SCALE, c_TANH_SUM_WIDTH);
+    const int64_t p1 = int64_t(term(s0)) * input;
+    const int64_t s1 = wrap(p1 - (c_TANH_COEFFICIENT[5] - c_TANH_COEFFICIENT[3]) * c_SCALE, c_TANH_SUM_WIDTH);
+    const int64_t p2 = int64_t(term(s1)) * input;
+    const int32_t d4 = wrap32(term(s0) - c_TANH_COEFFICIENT[2], c_COEF_WIDTH);
+    const int64_t s2 = wrap(p2 - d4 * c_SCALE, c_TANH_SUM_WIDTH);
+    const int64_t p3 = int64_t(wrap32(term(s2) + signBit(s2), c_COEF_WIDTH)) * input;
+    const int32_t d3 = wrap32(term(s1) - c_TANH_COEFFICIENT[1], c_COEF_WIDTH);
+    const int64_t s3 = wrap(p3 - d3 * c_SCALE, c_TANH_SUM_WIDTH);
+    const int64_t p4 = int64_t(term(s3)) * input;
+    int32_t d2 = term(s2);
+    d2 = wrap32(d2 + signBit(d2) - c_TANH_COEFFICIENT[0], c_COEF_WIDTH);
+    const int64_t s4 = wrap(p4 - d2 * (2 * c_SCALE), c_TANH_SUM_WIDTH);
+
+    return narrow(s4, c_TANH_COEF_SCALE, c_DATA_WIDTH);
+}
+
+// MoogLadderFilter::tanhLookupTable
+inline int32_t tanhLookupTable(int32_t x, const int32_t *offset, const int32_t *slope)
+{
+    const int32_t top = x >> 24;
+    const int32_t saturated = top > 0  ? (1 << (c_TANH_INPUT_WIDTH - 1)) - 1
+                            : top < -1 ? -(1 << (c_TANH_INPUT_WIDTH - 1))
+                                       : wrap32(x, c_TANH_INPUT_WIDTH);
+
+    const int32_t address  = (saturated + (1 << (c_TANH_INPUT_WIDTH - 1))) >> c_TANH_FRAC_WIDTH;
+    const int32_t fraction = saturated & ((1 << c_TANH_FRAC_WIDTH) - 1);
+    const int64_t product  = int64_t(slope[address]) * fraction;
+    return wrap32(offset[address] + narrow(product, c_TANH_FRAC_WIDTH, c_DATA_WIDTH), c_DATA_WIDTH);
+}
+
+// MoogLadderFilter::cutoffPolynomial
+inline int32_t cutoffPolynomial(int32_t x)
+{
+    int64_t sum = wrap(int64_t(x) * c_POLY_COEFFICIENTS[0] + int64_t(c_POLY_COEFFICIENTS[1]) * (1 << c_POLY_SCALE), c_POLY_SUM_WIDTH);
+    for (int idx = 1; idx < 4; idx++) {
+        const int64_t product = int64_t(x) * narrow(sum, c_POLY_SCALE, c_COEF_WIDTH);
+        sum = wrap(product + int64_t(c_POLY_COEFFICIENTS[idx + 1]) * (1 << c_POLY_SCALE), c_POLY_SUM_WIDTH);
+    }
+    return narrow(sum, c_POLY_SCALE, c_COEF_WIDTH);
+}
+
+// Mixer
+
+constexpr int c_ACCUM_WIDTH = 7 + c_DATA_WIDTH;
+
+} // namespace
+
+VectorEngine::VectorEngine(const Wavetables &tables, int numChannels)
+    : m_numChannels(numChannels),
+      m_sine(tables.sine.begin(), tables.sine.end())
+{
+    if (numChannels < 1 || numChannels > c_NUM_CHANNELS)
+        throw std::invalid_argument("number of channels must be between 1 and 128");
+    for (const auto &table : tables.sawtooth)
+        m_sawtooth.insert(m_sawtooth.end(), table.begin(), table.end());
+    for (const auto &table : tables.triangle)
+        m_triangle.insert(m_triangle.end(), table.begin(), table.end());
+}
+
+void VectorEngine::adsr(int index, const Adsr &params, int32_t *output)
+{
+    // Adsr::State, the sustain follows the decay
+    constexpr int32_t c_OFF = 0, c_ATTACK = 1, c_DECAY = 2, c_RELEASE = 4;
+    constexpr int32_t c_PHASE_MAX = (1 << 23) - 1;
+
+    const int numChannels = m_numChannels;
+    AdsrState &s = m_adsr[index];
+    uint8_t gate[c_NUM_CHANNELS];
+    for (int ch = 0; ch < numChannels; ch++)
+        gate[ch] = params.noteOn[ch];
+
+    const int32_t attackCw = params.attackCw;
+    const int32_t decayCw = params.decayCw;
+    const int32_t releaseCw = params.releaseCw;
+    const int32_t sustainLevel = params.sustainLevel;
+
+    for (int ch = 0; ch < numChannels; ch++) {
+        const int32_t last = s.state[ch];
+        const int32_t on   = gate[ch];
+
+        // the off phase is always zero and the sustain step is zero
+        const int32_t step = last == c_ATTACK ? attackCw : last == c_DECAY ? -decayCw : last == c_RELEASE ? -releaseCw : 0;
+        const int32_t temp = wrap32(s.phase[ch] + step, 24);
+
+        // the conditions are combined with & and | rather than && and || so the
+        // loop has no branches
+        const int32_t overflow   = temp < 0;
+        const int32_t reached    = (temp <= sustainLevel) | overflow;
+        const int32_t attackEnd  = (last == c_ATTACK) & overflow;
+        const int32_t decayEnd   = (last == c_DECAY) & reached;
+        const int32_t releaseEnd = (last == c_RELEASE) & overflow;
+
+        // the attack and decay advance a segment at their ends, the attack, decay and
+        // sustain release on a note off
+        const int32_t gated = on ? last + (attackEnd | decayEnd) : c_RELEASE;
+        const int32_t next = last == c_OFF ? (on ? c_ATTACK : c_OFF) : last == c_RELEASE ? (overflow ? c_OFF : c_RELEASE) : gated;
+        const int32_t phaseNext = (last == c_OFF) | releaseEnd ? 0 : attackEnd ? c_PHASE_MAX : decayEnd ? sustainLevel : temp;
+
+        s.state[ch] = next;
+        s.phase[ch] = phaseNext;
+        output[ch]  = phaseNext;
+    }
+
+    // counted in a loop of its own, the count in the loop above stops the vectoriser
+    unsigned activeChannelCount = 0;
+    for (int ch = 0; ch < numChannels; ch++)
+        activeChannelCount += s.state[ch] != c_OFF;
+    s.activeChannelCount = activeChannelCount;
+}
+
+void VectorEngine::oscillator(const Oscillator &params, const int32_t *freqMod, const int32_t *pwMod, int32_t *output)
+{
+    const int numChannels = m_numChannels;
+    OscillatorChannels channels;
+    channels.numChannels = numChannels;
+    for (int ch = 0; ch < numChannels; ch++) {
+        channels.fcw[ch]          = params.channel[ch].fcw;
+        channels.unisonDetune[ch] = params.channel[ch].unisonDetune;
+        channels.freqMod[ch]      = params.channel[ch].modEnable && freqMod ? freqMod[ch] : 0;
+        channels.pwMod[ch]        = pwMod ? pwMod[ch] : 0;
+    }
+
+    std::fill(output, output + numChannels, 0);
+    const int numOscillators = std::min(params.numOscillators(), c_NUM_OSCILLATORS);
+    for (int osc = 0; osc < numOscillators; osc++) {
+        const Oscillator::OscillatorParams &p = params.oscillator[osc];
+        uint32_t *phase = m_phase[osc].data();
+        switch (p.waveSelect & 3) {
+        case sine:
+            oscillatorLanes<sine>(channels, p, m_sine.data(), nullptr, phase, output);
+            break;
+        case sawtooth:
+            oscillatorLanes<sawtooth>(channels, p, nullptr, m_sawtooth.data(), phase, output);
+            break;
+        case triangle:
+            oscillatorLanes<triangle>(channels, p, nullptr, m_triangle.data(), phase, output);
+            break;
+        default:
+            oscillatorLanes<square>(channels, p, nullptr, m_sawtooth.data(), phase, output);
+            break;
+        }
+    }
+}
+
+void VectorEngine::modMatrix(const ModMatrix &params, const std::array<const int32_t *, ModMatrix::c_NUM_SOURCES> &sources,
+                             const std::array<int32_t *, ModMatrix::c_NUM_DESTINATIONS> &outputs)
+{
+    const int numChannels = m_numChannels;
+    for (int d = 0; d < ModMatrix::c_NUM_DESTINATIONS; d++) {
+        int64_t sum[c_NUM_CHANNELS] = {};
+        for (int s = 0; s < ModMatrix::c_NUM_SOURCES; s++) {
+            if (!sources[s])
+                continue;
+            const int32_t *source = sources[s];
+            const int32_t amount = wrap32(params.amount[d][s], 18);
+            for (int ch = 0; ch < numChannels; ch++)
+                sum[ch] += int64_t(source[ch]) * amount;
+        }
+
+        // the sum is at most 45 bits so sum >> 15 fits in 32 bits
+        const int32_t minimum = d == ModMatrix::amplitude ? 0 : c_DATA_MIN;
+        int32_t *output = outputs[d];
+        for (int ch = 0; ch < numChannels; ch++) {
+            const int32_t value = int32_t(uint32_t(uint64_t(sum[ch]) >> 15));
+            output[ch] = std::min(std::max(value, minimum), c_DATA_MAX);
+        }
+    }
+}
+
+void VectorEngine::multiplier(const int32_t *input, const int32_t *envelope, int32_t *output)
+{
+    const int numChannels = m_numChannels;
+    for (int ch = 0; ch < numChannels; ch++)
+        output[ch] = narrow(int64_t(input[ch]) * envelope[ch], 17, c_DATA_WIDTH);
+}
+
+void VectorEngine::filterPass(const MoogLadderFilter &params, const int32_t *input, const int32_t *g, int32_t *output)
+{
+    const bool lut = params.tanhImplementation() == MoogLadderFilter::TanhImplementation::lookupTable;
+    const int32_t *offset = MoogLadderFilter::tanhTable().offset.data();
+    const int32_t *slope  = MoogLadderFilter::tanhTable().slope.data();
+    const int32_t resonance = wrap32(params.resonance, 18);
+    const int32_t *coef = c_FEEDFORWARD_COEFFICIENTS[((params.filterType & 3) << 1) | (params.filterAttenuation & 1)];
+    FilterState &s = m_filter;
+    const int numChannels = m_numChannels;
+
+    // resonance feedback, the tanh is unswitched so each loop is branch free
+    int32_t tap[MoogLadderFilter::c_NUM_STAGES + 1][c_NUM_CHANNELS];
+    for (int ch = 0; ch < numChannels; ch++) {
+        const int32_t sumA = wrap32(int64_t(s.feedback[ch]) - (input[ch] >> 1), c_DATA_WIDTH + 1);
+        const int64_t prod = int64_t(sumA) * resonance;
+        tap[0][ch] = wrap32(input[ch] - narrow(prod, 13, c_DATA_WIDTH + 3), c_DATA_WIDTH + 3);
+    }
+    if (lut) {
+        for (int ch = 0; ch < numChannels; ch++)
+            tap[0][ch] = tanhLookupTable(tap[0][ch], offset, slope);
+    } else {
+        for (int ch = 0; ch < numChannels; ch++)
+            tap[0][ch] = tanhPolynomial(tap[0][ch]);
+    }
+
+    // one pole stages
+    for (int stage = 0; stage < MoogLadderFilter::c_NUM_STAGES; stage++) {
+        int32_t *xState = s.x[stage].data();
+        int32_t *yState = s.y[stage].data();
+        for (int ch = 0; ch < numChannels; ch++) {
+            const int32_t x = tap[stage][ch];
+            const int64_t yScaled = int64_t(yState[ch]) * (1 << c_COEF_SCALE_FACTOR);
+            const int64_t sumC  = wrap(wrap(int64_t(x) * c_COEF_A - yScaled, c_ONE_POLE_SUM_WIDTH) +
+                                       int64_t(xState[ch]) * c_COEF_B, c_ONE_POLE_SUM_WIDTH);
+            const int64_t prodD = int64_t(narrow(sumC, c_COEF_SCALE_FACTOR, c_DATA_WIDTH + 1)) * g[ch];
+            const int64_t sumE  = wrap(prodD + yScaled, c_ONE_POLE_SUM_WIDTH + 1);
+            const int32_t y     = narrow(sumE, c_COEF_SCALE_FACTOR, c_DATA_WIDTH);
+            xState[ch] = x;
+            yState[ch] = y;
+            tap[stage + 1][ch] = y;
+        }
+    }
+
+    // feedforward sum selecting the response
+    for (int ch = 0; ch < numChannels; ch++) {
+        s.feedback[ch] = tap[4][ch];
+        int32_t term[5];
+        for (int i = 0; i < 5; i++)
+            term[i] = resize32(tap[i][ch] * coef[i], c_DATA_WIDTH + 3);
+        const int32_t sumAB  = wrap32(term[0] + term[1], c_DATA_WIDTH + 3);
+        const int32_t sumDE  = wrap32(term[3] + term[4], c_DATA_WIDTH + 3);
+        const int32_t sumABC = wrap32(sumAB + term[2], c_DATA_WIDTH + 4);
+        const int32_t total  = wrap32(sumABC + sumDE, c_DATA_WIDTH + 5);
+        output[ch] = resize32(total, c_DATA_WIDTH);
+    }
+}
+
+void VectorEngine::decimate(const int32_t *input, bool phase, int32_t *output)
+{
+    constexpr int c_SUM_WIDTH = c_DATA_WIDTH + 6;
+    const int numChannels = m_numChannels;
+    auto &delay = m_filter.decimator;   // delay[i] is w_delay(i+1)
+
+    if (phase) {
+        for (int ch = 0; ch < numChannels; ch++) {
+            const int32_t outer  = wrap32(-int64_t(input[ch]) - delay[5][ch], c_SUM_WIDTH);
+            const int32_t inner  = wrap32(int64_t(delay[1][ch]) + delay[3][ch], c_SUM_WIDTH);
+            const int32_t center = delay[2][ch] * 16;
+            const int32_t pre    = wrap32(int64_t(outer) + wrap32(int64_t(inner) * 8, c_SUM_WIDTH) + inner + center,
+                                          c_SUM_WIDTH) >> 5;
+            const int32_t guard  = pre >> (c_DATA_WIDTH - 1);
+            output[ch] = guard == 0 || guard == -1 ? pre : guard > 0 ? c_DATA_MAX : c_DATA_MIN;
+        }
+    }
+
+    for (int i = int(delay.size()) - 1; i > 0; i--)
+        delay[i] = delay[i - 1];
+    std::copy(input, input + numChannels, delay[0].begin());
+}
+
+void VectorEngine::filter(const MoogLadderFilter &params, const int32_t *input, const int32_t *adsrEnvelope,
+                          const int32_t *modulation, int32_t *output)
+{
+    const int32_t cutoffFrequency = wrap32(params.cutoffFrequency, 18);
+    const int32_t adsrAmount = wrap32(params.adsrAmount, 18);
+    const int32_t modulationAmount = params.modulationEnable ? wrap32(params.modulationAmount, 18) : 0;
+    const int32_t keyTrackingAmount = wrap32(params.keyTrackingAmount, 18);
+    const unsigned sampleRate = params.sampleRate & 3;
+    const bool oversample = params.oversampleEnable;
+    const int numChannels = m_numChannels;
+
+    // the key frequency for the sample rate and the cutoff offset of each channel
+    int32_t keyFreq[c_NUM_CHANNELS], cutoff[c_NUM_CHANNELS];
+    for (int ch = 0; ch < numChannels; ch++) {
+        const int32_t key = MoogLadderFilter::keyFrequency(params.keyNote[ch]);
+        keyFreq[ch] = sampleRate == 0 ? wrap32(int64_t(key) * 2, 18) : sampleRate == 2 ? key >> 1 : key;
+        cutoff[ch]  = cutoffFrequency + wrap32(params.cutoffOffset[ch], 18);
+    }
+
+    // MoogLadderFilter::coefficient, the cutoff sum and the polynomial are
+    // separate loops to keep the vectoriser within its limits
+    int32_t g[c_NUM_CHANNELS];
+    for (int ch = 0; ch < numChannels; ch++) {
+        const int64_t adsrFactor = int64_t(wrap32(adsrEnvelope[ch], 18)) * adsrAmount;
+        const int64_t cutoffAdsr = wrap(wrap(int64_t(cutoff[ch]) * (1 << 17), 37) + adsrFactor, 37);
+        const int64_t modFactor  = int64_t(wrap32(modulation[ch], 18)) * modulationAmount;
+        const int64_t keyFactor  = int64_t(keyFreq[ch]) * keyTrackingAmount;
+        const int64_t total      = wrap(modFactor + cutoffAdsr + wrap(keyFactor * 4, 38), 38);
+
+        // a positive overflow is not halved by the oversampling, a negative one is zero
+        const int32_t top = int32_t(shiftRight(total, 32));
+        const int32_t full = narrow(total, 17, 18);
+        g[ch] = top < 0 ? 0 : top > 0 || !oversample ? full : narrow(total, 18, 18);
+    }
+    for (int ch = 0; ch < numChannels; ch++)
+        g[ch] = cutoffPolynomial(g[ch]);
+
+    if (!params.oversampleEnable) {
+        filterPass(params, input, g, output);
+    } else {
+        // the second pass replays the inputs of the first at twice the rate
+        int32_t y[c_NUM_CHANNELS];
+        filterPass(params, input, g, y);
+        decimate(y, false, output);
+        filterPass(params, input, g, y);
+        decimate(y, true, output);
+    }
+}
+
+Mixer::Sums VectorEngine::mixer(const Mixer &params, const int32_t *input)
+{
+    const int numChannels = m_numChannels;
+
+    // the accumulators wrap, so wrapping the total is the same as wrapping every sum
+    Mixer::Sums sums;
+    int64_t accumulator = 0;
+    for (int ch = 0; ch < numChannels; ch++)
+        accumulator += input[ch];
+    sums.mono = wrap(accumulator, c_ACCUM_WIDTH);
+
+    if (!params.stereoEnable)
+        return sums;
+
+    int32_t gainLeft[c_NUM_CHANNELS], gainRight[c_NUM_CHANNELS];
+    for (int ch = 0; ch < numChannels; ch++) {
+        const unsigned pan = std::min(params.pan[ch], 256u);
+        gainLeft[ch]  = Mixer::panGain(pan);
+        gainRight[ch] = Mixer::panGain(256 - pan);
+    }
+
+    int64_t accLeft = 0;
+    int64_t accRight = 0;
+    for (int ch = 0; ch < numChannels; ch++) {
+        accLeft  += int64_t(input[ch]) * gainLeft[ch];
+        accRight += int64_t(input[ch]) * gainRight[ch];
+    }
+    sums.left  = wrap(accLeft, c_ACCUM_WIDTH + 15);
+    sums.right = wrap(accRight, c_ACCUM_WIDTH + 15);
+    return sums;
+}
+
+} // namespace synth
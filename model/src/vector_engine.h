@@ -0,0 +1,95 @@
+// Vector Engine
+// Description:
+// Structure of arrays versions of the per voice models for the host
+// renderer. Where the reference models step one channel at a time, each
+// kernel here runs a module over all channels with the state of every channel
+// in its own array (the phase of each oscillator, the ADSR segments, the
+// ladder stages and the decimator taps), so the channel loops are branch free
+// and compile to SIMD lanes: 8 channels per instruction for the 32 bit
+// datapaths and 4 for the 64 bit products and sums with AVX2. The wavetable
+// and tanh ROM reads are gathers.
+//
+// The arithmetic is the reference arithmetic rewritten without branches and
+// without 64 bit arithmetic shifts, which AVX2 lacks, so the outputs are bit
+// exact with the reference models and so with the VHDL. The parameters are
+// read from the reference module objects, which hold no state of their own
+// while the engine is used. An engine runs the first numChannels lanes, the
+// channels of a module object of that many channels.
+
+#ifndef VECTOR_ENGINE_H
+#define VECTOR_ENGINE_H
+
+#include "adsr.h"
+#include "mixer.h"
+#include "mod_matrix.h"
+#include "moog_ladder_filter.h"
+#include "oscillator.h"
+#include "wavetables.h"
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+namespace synth {
+
+class VectorEngine {
+public:
+    static constexpr int c_NUM_CHANNELS    = 128;
+    static constexpr int c_NUM_OSCILLATORS = 3;
+    static constexpr int c_NUM_ADSRS       = 2;
+
+    explicit VectorEngine(const Wavetables &tables, int numChannels = c_NUM_CHANNELS);
+
+    // Adsr::process of envelope index
+    void adsr(int index, const Adsr &params, int32_t *output);
+    // Oscillator::process
+    void oscillator(const Oscillator &params, const int32_t *freqMod, const int32_t *pwMod, int32_t *output);
+    // ModMatrix::process
+    void modMatrix(const ModMatrix &params, const std::array<const int32_t *, ModMatrix::c_NUM_SOURCES> &sources,
+                   const std::array<int32_t *, ModMatrix::c_NUM_DESTINATIONS> &outputs);
+    // Multiplier::process
+    void multiplier(const int32_t *input, const int32_t *envelope, int32_t *output);
+    // MoogLadderFilter::process
+    void filter(const MoogLadderFilter &params, const int32_t *input, const int32_t *adsrEnvelope,
+                const int32_t *modulation, int32_t *output);
+    // Mixer::sum
+    Mixer::Sums mixer(const Mixer &params, const int32_t *input);
+
+    unsigned activeChannelCount(int index) const { return m_adsr[index].activeChannelCount; }
+    bool channelFree(int index, int channel) const { return m_adsr[index].state[channel] == 0; }
+
+private:
+    template <typename T>
+    using Lanes = std::array<T, c_NUM_CHANNELS>;
+
+    struct AdsrState {
+        alignas(64) Lanes<int32_t> state {};   // Adsr::State
+        alignas(64) Lanes<int32_t> phase {};
+        unsigned activeChannelCount = 0;
+    };
+
+    struct FilterState {
+        alignas(64) Lanes<int32_t> feedback {};
+        alignas(64) std::array<Lanes<int32_t>, MoogLadderFilter::c_NUM_STAGES> x {};
+        alignas(64) std::array<Lanes<int32_t>, MoogLadderFilter::c_NUM_STAGES> y {};
+        alignas(64) std::array<Lanes<int32_t>, 6> decimator {};
+    };
+
+    void filterPass(const MoogLadderFilter &params, const int32_t *input, const int32_t *g, int32_t *output);
+    void decimate(const int32_t *input, bool phase, int32_t *output);
+
+    int m_numChannels;
+
+    // flat copies of the tables, octave*c_TABLE_SIZE+address
+    std::vector<int32_t> m_sine;
+    std::vector<int32_t> m_sawtooth;
+    std::vector<int32_t> m_triangle;
+
+    std::array<Lanes<uint32_t>, c_NUM_OSCILLATORS> m_phase {};
+    std::array<AdsrState, c_NUM_ADSRS> m_adsr;
+    FilterState m_filter;
+};
+
+} // namespace synth
+
+#endif
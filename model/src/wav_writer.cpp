@@ -0,0 +1,82 @@
+#include "wav_writer.h"
+
+#include <stdexcept>
+
+namespace synth {
+
+namespace {
+
+constexpr uint16_t c_CHANNELS        = 2;
+constexpr uint16_t c_BITS_PER_SAMPLE = 24;
+constexpr uint16_t c_BLOCK_ALIGN     = c_CHANNELS * c_BITS_PER_SAMPLE / 8;
+constexpr uint32_t c_HEADER_SIZE     = 44;
+
+void put16(std::ofstream &file, uint16_t value)
+{
+    const char bytes[2] = { char(value), char(value >> 8) };
+    file.write(bytes, 2);
+}
+
+void put32(std::ofstream &file, uint32_t value)
+{
+    const char bytes[4] = { char(value), char(value >> 8), char(value >> 16), char(value >> 24) };
+    file.write(bytes, 4);
+}
+
+} // namespace
+
+WavWriter::WavWriter(const std::string &path, uint32_t sampleRate)
+    : m_file(path, std::ios::binary),
+      m_path(path),
+      m_sampleRate(sampleRate)
+{
+    if (!m_file)
+        throw std::runtime_error("can not open " + path + " for writing");
+    writeHeader();
+}
+
+WavWriter::~WavWriter()
+{
+    try {
+        close();
+    } catch (...) {
+    }
+}
+
+void WavWriter::writeHeader()
+{
+    const uint32_t dataSize = m_frames * c_BLOCK_ALIGN;
+    m_file.write("RIFF", 4);
+    put32(m_file, c_HEADER_SIZE - 8 + dataSize);
+    m_file.write("WAVEfmt ", 8);
+    put32(m_file, 16);
+    put16(m_file, 1);   // PCM
+    put16(m_file, c_CHANNELS);
+    put32(m_file, m_sampleRate);
+    put32(m_file, m_sampleRate * c_BLOCK_ALIGN);
+    put16(m_file, c_BLOCK_ALIGN);
+    put16(m_file, c_BITS_PER_SAMPLE);
+    m_file.write("data", 4);
+    put32(m_file, dataSize);
+}
+
+void WavWriter::write(int32_t left, int32_t right)
+{
+    const char bytes[6] = { char(left), char(left >> 8), char(left >> 16),
+                            char(right), char(right >> 8), char(right >> 16) };
+    m_file.write(bytes, sizeof(bytes));
+    m_frames++;
+}
+
+void WavWriter::close()
+{
+    if (!m_file.is_open())
+        return;
+    m_file.seekp(0);
+    writeHeader();
+    m_file.close();
+    if (m_file.fail())
+        throw std::runtime_error("error writing " + m_path);
+}
+
+} // namespace synth
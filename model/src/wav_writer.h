@@ -0,0 +1,40 @@
+// WAV Writer
+// Description:
+// Writes the 24 bit stereo samples of the I2S transmitter to a PCM WAV file.
+
+#ifndef WAV_WRITER_H
+#define WAV_WRITER_H
+
+#include <cstdint>
+#include <fstream>
+#include <string>
+
+namespace synth {
+
+class WavWriter {
+public:
+    // throws std::runtime_error when the file can not be written
+    WavWriter(const std::string &path, uint32_t sampleRate);
+    ~WavWriter();
+
+    WavWriter(const WavWriter &) = delete;
+    WavWriter &operator=(const WavWriter &) = delete;
+
+    void write(int32_t left, int32_t right);
+    // patches the header sizes, called by the destructor if not called before
+    void close();
+
+    uint32_t frames() const { return m_frames; }
+
+private:
+    void writeHeader();
+
+    std::ofstream m_file;
+    std::string m_path;
+    uint32_t m_sampleRate;
+    uint32_t m_frames = 0;
+};
+
+} // namespace synth
+
+#endif
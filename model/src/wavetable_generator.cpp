@@ -0,0 +1,206 @@
+#include "wavetable_generator.h"
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <stdexcept>
+
+namespace synth {
+
+namespace {
+
+constexpr int c_WORDS_PER_LINE = 8;   // of the VHDL package
+
+std::ofstream openImage(const std::string &path, bool binary = false)
+{
+    std::ofstream file(path, binary ? std::ios::binary : std::ios::out);
+    if (!file)
+        throw std::runtime_error("can not write wavetable image " + path);
+    return file;
+}
+
+int log2(int value)
+{
+    int bits = 0;
+    while ((1 << bits) < value)
+        bits++;
+    return bits;
+}
+
+} // namespace
+
+WavetableGenerator::WavetableGenerator(const WavetableSettings &settings) : m_settings(settings)
+{
+    const WavetableSettings &s = settings;
+    if (s.length < 2 || (s.length & (s.length - 1)))
+        throw std::invalid_argument("the wavetable length must be a power of 2");
+    if (s.width < 2 || s.width > 32)
+        throw std::invalid_argument("the wavetable width must be 2 to 32 bits");
+    if (s.headroom < 0 || s.headroom >= s.width - 1)
+        throw std::invalid_argument("the headroom must leave a bit of the width");
+    if (s.octaves < 1 || s.harmonics < 1 || (s.harmonics >> (s.octaves - 1)) < 1)
+        throw std::invalid_argument("every octave needs a harmonic");
+
+    const double peak = double((int64_t(1) << (s.width - 1 - s.headroom)) - 1);
+    for (int w = 0; w < c_NUM_WAVEFORMS; w++) {
+        m_tables[w].resize(s.octaves);
+        for (int octave = 0; octave < s.octaves; octave++) {
+            const int harmonics = s.harmonics >> octave;
+            std::vector<double> sum(s.length, 0.0);
+            for (int i = 0; i < s.length; i++) {
+                const double x = 2.0 * M_PI * i / s.length;
+                if (Waveform(w) == Waveform::sawtooth) {
+                    for (int n = 1; n <= harmonics; n++)
+                        sum[i] -= std::sin(n * x) / n;
+                } else {
+                    for (int n = 1; n <= harmonics; n += 2)
+                        sum[i] -= std::cos(n * x) / (double(n) * n);
+                }
+            }
+            double max = 0.0;
+            for (double v : sum)
+                max = std::max(max, std::abs(v));
+            std::vector<int32_t> &table = m_tables[w][octave];
+            table.resize(s.length);
+            for (int i = 0; i < s.length; i++)
+                table[i] = int32_t(std::nearbyint(sum[i] / max * peak));
+        }
+    }
+}
+
+const std::vector<int32_t> &WavetableGenerator::table(Waveform waveform, int octave) const
+{
+    return m_tables[int(waveform)][octave];
+}
+
+const char *WavetableGenerator::waveformName(Waveform waveform)
+{
+    return waveform == Waveform::sawtooth ? "sawtooth" : "triangle";
+}
+
+uint32_t WavetableGenerator::word(int32_t value) const
+{
+    const uint32_t mask = m_settings.width == 32 ? 0xFFFFFFFFu : (1u << m_settings.width) - 1;
+    return uint32_t(value) & mask;
+}
+
+std::string WavetableGenerator::hex(int32_t value) const
+{
+    static const char c_DIGITS[] = "0123456789ABCDEF";
+    std::string digits((m_settings.width + 3) / 4, '0');
+    uint32_t bits = word(value);
+    for (auto d = digits.rbegin(); d != digits.rend(); ++d, bits >>= 4)
+        *d = c_DIGITS[bits & 0xF];
+    return digits;
+}
+
+void WavetableGenerator::write(Format format, const std::string &directory) const
+{
+    const std::string prefix = directory + "/";
+    if (format == Format::vhdl) {
+        std::ofstream file = openImage(prefix + "wavetable_rom_package.vhd");
+        writePackage(file);
+        return;
+    }
+    for (Waveform waveform : { Waveform::sawtooth, Waveform::triangle }) {
+        const std::string name = prefix + waveformName(waveform);
+        if (format == Format::bin) {
+            std::ofstream file = openImage(name + ".bin", true);
+            writeBin(file, waveform);
+            continue;
+        }
+        for (int octave = 0; octave < m_settings.octaves; octave++) {
+            const std::string path = name + std::to_string(octave) + (format == Format::coe ? ".coe" : ".mem");
+            std::ofstream file = openImage(path);
+            if (format == Format::coe)
+                writeCoe(file, waveform, octave);
+            else
+                writeMem(file, waveform, octave);
+        }
+    }
+}
+
+// hex bit string literals when the width is a multiple of 4, binary otherwise
+void WavetableGenerator::writePackage(std::ostream &output) const
+{
+    const WavetableSettings &s = m_settings;
+    auto literal = [&](int32_t value) {
+        if (s.width % 4 == 0)
+            return "x\"" + hex(value) + "\"";
+        std::string bits(s.width, '0');
+        for (int b = 0; b < s.width; b++)
+            bits[s.width - 1 - b] = (word(value) >> b) & 1 ? '1' : '0';
+        return "\"" + bits + "\"";
+    };
+
+    output << "-- Package: Wavetable ROM\n"
+              "-- Description: Bandlimited sawtooth and triangle wavetables of the oscillator, one per\n"
+              "-- octave, the initial values of the wavetable brams. Generated by synth_generate\n"
+              "-- (model/src/wavetable_generator.h) with --harmonics " << s.harmonics << " --length " << s.length
+           << " --width " << s.width << "\n"
+              "-- --octaves " << s.octaves << " --headroom " << s.headroom << ", do not edit.\n"
+              "\n"
+              "library ieee;\n"
+              "use ieee.std_logic_1164.all;\n"
+              "\n"
+              "package wavetable_rom_package is\n"
+              "    constant c_ROM_NUM_OCTAVES : integer := " << s.octaves << ";\n"
+              "    constant c_ROM_ADDR_WIDTH  : integer := " << log2(s.length) << ";\n"
+              "    constant c_ROM_DATA_WIDTH  : integer := " << s.width << ";\n"
+              "\n"
+              "    type t_rom is array(0 to 2**c_ROM_ADDR_WIDTH-1) of std_logic_vector(c_ROM_DATA_WIDTH-1 downto 0);\n"
+              "    type t_rom_array is array(0 to c_ROM_NUM_OCTAVES-1) of t_rom;\n";
+
+    for (Waveform waveform : { Waveform::sawtooth, Waveform::triangle }) {
+        std::string name = waveformName(waveform);
+        std::transform(name.begin(), name.end(), name.begin(), ::toupper);
+        output << "\n    constant c_" << name << "_ROM : t_rom_array := (\n";
+        for (int octave = 0; octave < s.octaves; octave++) {
+            const std::vector<int32_t> &t = table(waveform, octave);
+            output << "        -- octave " << octave << "\n        (";
+            for (int i = 0; i < s.length; i++) {
+                output << literal(t[i]);
+                if (i + 1 == s.length)
+                    output << ")";
+                else if ((i + 1) % c_WORDS_PER_LINE == 0)
+                    output << ",\n         ";
+                else
+                    output << ", ";
+            }
+            output << (octave + 1 == s.octaves ? "\n" : ",\n");
+        }
+        output << "    );\n";
+    }
+    output << "\nend package wavetable_rom_package;\n";
+}
+
+void WavetableGenerator::writeCoe(std::ostream &output, Waveform waveform, int octave) const
+{
+    const std::vector<int32_t> &t = table(waveform, octave);
+    output << "; " << waveformName(waveform) << " wavetable, octave " << octave << "\n"
+           << "memory_initialization_radix=16;\n"
+           << "memory_initialization_vector=\n";
+    for (size_t i = 0; i < t.size(); i++)
+        output << hex(t[i]) << (i + 1 == t.size() ? ";\n" : ",\n");
+}
+
+void WavetableGenerator::writeMem(std::ostream &output, Waveform waveform, int octave) const
+{
+    output << "@0\n";
+    for (int32_t value : table(waveform, octave))
+        output << hex(value) << "\n";
+}
+
+void WavetableGenerator::writeBin(std::ostream &output, Waveform waveform) const
+{
+    const int bytes = (m_settings.width + 7) / 8;
+    for (int octave = 0; octave < m_settings.octaves; octave++) {
+        for (int32_t value : table(waveform, octave)) {
+            const uint32_t w = word(value);
+            for (int b = 0; b < bytes; b++)
+                output.put(char((w >> (8 * b)) & 0xFF));
+        }
+    }
+}
+
+} // namespace synth
@@ -0,0 +1,74 @@
+// Wavetable Generator
+// Description:
+// Computes the bandlimited sawtooth and triangle wavetables of the oscillator
+// and writes them as BRAM initialisation images. The table of octave k has
+// the harmonics up to harmonics >> k, the sawtooth is -sum(sin(n x) / n) of
+// all of them and the triangle -sum(cos(n x) / n^2) of the odd ones. Each
+// table is normalised to a peak of 2^(width-1-headroom) - 1 and rounded. The
+// defaults give the tables of the oscillator, 1000 harmonics, 2048 entries of
+// 24 bits and one bit of headroom.
+//
+// Images:
+//   vhdl  wavetable_rom_package.vhd, the tables as constants the wavetable
+//         entities are initialised from, no file is read at elaboration
+//   coe   <waveform><octave>.coe, Block Memory Generator coefficient files
+//   mem   <waveform><octave>.mem, one hex word per line, for xpm_memory
+//         and updatemem
+//   bin   <waveform>.bin, the octaves in order, each word little endian in
+//         width / 8 bytes rounded up
+
+#ifndef WAVETABLE_GENERATOR_H
+#define WAVETABLE_GENERATOR_H
+
+#include <array>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace synth {
+
+struct WavetableSettings {
+    int harmonics = 1000;   // of octave 0
+    int length    = 2048;   // a power of 2
+    int width     = 24;     // bits, 2 to 32
+    int octaves   = 10;
+    int headroom  = 1;      // bits
+};
+
+class WavetableGenerator {
+public:
+    enum class Waveform { sawtooth, triangle };
+    enum class Format { vhdl, coe, mem, bin };
+
+    static constexpr int c_NUM_WAVEFORMS = 2;
+
+    // throws std::invalid_argument on settings out of range
+    explicit WavetableGenerator(const WavetableSettings &settings = WavetableSettings());
+
+    const WavetableSettings &settings() const { return m_settings; }
+    const std::vector<int32_t> &table(Waveform waveform, int octave) const;
+
+    static const char *waveformName(Waveform waveform);
+
+    // the images of a format in the directory, throws std::runtime_error when
+    // a file can not be written
+    void write(Format format, const std::string &directory) const;
+
+    void writePackage(std::ostream &output) const;
+    void writeCoe(std::ostream &output, Waveform waveform, int octave) const;
+    void writeMem(std::ostream &output, Waveform waveform, int octave) const;
+    void writeBin(std::ostream &output, Waveform waveform) const;
+
+private:
+    // the word of an entry, the two's complement bits of the width
+    uint32_t word(int32_t value) const;
+    std::string hex(int32_t value) const;
+
+    WavetableSettings m_settings;
+    std::array<std::vector<std::vector<int32_t>>, c_NUM_WAVEFORMS> m_tables;
+};
+
+} // namespace synth
+
+#endif
@@ -0,0 +1,80 @@
+#include "wavetables.h"
+
+#include "fixed_point.h"
+
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+
+namespace synth {
+
+namespace {
+
+std::string readFile(const std::string &path)
+{
+    std::ifstream file(path);
+    if (!file)
+        throw std::runtime_error("can not open wavetable file " + path);
+    std::stringstream contents;
+    contents << file.rdbuf();
+    return contents.str();
+}
+
+// x"..." literals from position begin to end of source, in address order
+void loadLiterals(const std::string &source, size_t begin, size_t end, int32_t *table, int size,
+                  const std::string &what, const std::string &path)
+{
+    int count = 0;
+    for (size_t at = source.find("x\"", begin); at != std::string::npos && at + 9 <= end; at = source.find("x\"", at + 2)) {
+        const std::string digits = source.substr(at + 2, 6);
+        if (source[at + 8] != '"' || digits.find_first_not_of("0123456789abcdefABCDEF") != std::string::npos)
+            continue;
+        if (count == size)
+            throw std::runtime_error("too many " + what + " entries in " + path);
+        table[count++] = int32_t(wrapSigned(std::stol(digits, nullptr, 16), 24));
+    }
+    if (count != size)
+        throw std::runtime_error("too few " + what + " entries in " + path);
+}
+
+// the SIN_LUT constant
+void loadSine(const std::string &path, std::array<int32_t, Wavetables::c_SINE_SIZE> &table)
+{
+    const std::string source = readFile(path);
+    loadLiterals(source, 0, source.size(), table.data(), Wavetables::c_SINE_SIZE, "sine wavetable", path);
+}
+
+// the octaves of a t_rom_array constant, from its declaration to the next one
+void loadRom(const std::string &source, const std::string &name, const std::string &path,
+             std::array<Wavetables::Table, Wavetables::c_NUM_OCTAVES> &tables)
+{
+    const size_t begin = source.find("constant " + name);
+    if (begin == std::string::npos)
+        throw std::runtime_error("no constant " + name + " in " + path);
+    size_t end = source.find("constant ", begin + 1);
+    if (end == std::string::npos)
+        end = source.size();
+
+    std::vector<int32_t> entries(size_t(Wavetables::c_NUM_OCTAVES) * Wavetables::c_TABLE_SIZE);
+    loadLiterals(source, begin, end, entries.data(), int(entries.size()), name, path);
+    for (int octave = 0; octave < Wavetables::c_NUM_OCTAVES; octave++)
+        std::copy_n(&entries[size_t(octave) * Wavetables::c_TABLE_SIZE], Wavetables::c_TABLE_SIZE,
+                    tables[octave].begin());
+}
+
+} // namespace
+
+Wavetables Wavetables::load(const std::string &directory)
+{
+    Wavetables tables;
+    loadSine(directory + "/sine_wavetable.vhd", tables.sine);
+    const std::string path = directory + "/wavetable_rom_package.vhd";
+    const std::string source = readFile(path);
+    loadRom(source, "c_SAWTOOTH_ROM", path, tables.sawtooth);
+    loadRom(source, "c_TRIANGLE_ROM", path, tables.triangle);
+    return tables;
+}
+
+} // namespace synth
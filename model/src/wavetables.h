@@ -0,0 +1,36 @@
+// Wavetables
+// Description:
+// The oscillator and LFO wavetables, read from the same files the VHDL is
+// elaborated from so the models can not drift from the hardware: the sine
+// table from the constant in sine_wavetable.vhd and the bandlimited sawtooth
+// and triangle tables (one per octave) from the c_SAWTOOTH_ROM and
+// c_TRIANGLE_ROM constants of wavetable_rom_package.vhd in
+// repo/Oscillator_2.0/src (generated by synth_generate).
+
+#ifndef WAVETABLES_H
+#define WAVETABLES_H
+
+#include <array>
+#include <cstdint>
+#include <string>
+
+namespace synth {
+
+struct Wavetables {
+    static constexpr int c_SINE_SIZE   = 256;
+    static constexpr int c_TABLE_SIZE  = 2048;
+    static constexpr int c_NUM_OCTAVES = 10;
+
+    using Table = std::array<int32_t, c_TABLE_SIZE>;
+
+    std::array<int32_t, c_SINE_SIZE> sine;               // Q1.23
+    std::array<Table, c_NUM_OCTAVES> sawtooth;           // Q1.23
+    std::array<Table, c_NUM_OCTAVES> triangle;           // Q1.23
+
+    // throws std::runtime_error when a file is missing or malformed
+    static Wavetables load(const std::string &directory);
+};
+
+} // namespace synth
+
+#endif
@@ -0,0 +1,664 @@
+// Model Test
+// Description:
+// Checks of the models against properties of the VHDL that can be worked out
+// by hand: the numeric_std resize semantics, the ADSR attack ramp, the
+// oscillator period, the mixer normalisation, the tanh lookup table error
+// budget of the block design and the low pass gain of the ladder filter, and
+// that the vector engine and the parallel renderer render the same samples as
+// the reference models. The RTL comparison is checked on logs made by the
+// models with the sample period timing of tb_system, the MIDI replay on small
+// files that fill, release and leak the voices of the firmware, and the
+// wavetable generator against the tables the VHDL is elaborated from.
+
+#include "adsr.h"
+#include "firmware.h"
+#include "fixed_point.h"
+#include "midi_file.h"
+#include "midi_replay.h"
+#include "mixer.h"
+#include "moog_ladder_filter.h"
+#include "multiplier.h"
+#include "oscillator.h"
+#include "parallel_renderer.h"
+#include "register_script.h"
+#include "rtl_compare.h"
+#include "synthesizer.h"
+#include "wavetable_generator.h"
+#include "wavetables.h"
+
+#include <algorithm>
+#include <array>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+
+int g_failures = 0;
+
+#define CHECK(condition)                                                                  \
+    do {                                                                                  \
+        if (!(condition)) {                                                               \
+            std::fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #condition); \
+            g_failures++;                                                                 \
+        }                                                                                 \
+    } while (0)
+
+using namespace synth;
+
+void testFixedPoint()
+{
+    CHECK(wrapSigned(0x800000, 24) == -0x800000);
+    CHECK(wrapSigned(0xFFFFFF, 24) == -1);
+    CHECK(wrapSigned(0x1000001, 24) == 1);
+    // resize keeps the sign bit, not a wrap
+    CHECK(resizeSigned(0x800000, 24) == 0);
+    CHECK(resizeSigned(0xC00000, 24) == 0x400000);
+    CHECK(resizeSigned(-0x800001, 24) == -1);
+    CHECK(resizeSigned(-5, 24) == -5);
+    CHECK((int64_t(-5) >> 1) == -3);
+}
+
+void testAdsrAttack()
+{
+    Adsr adsr(4);
+    adsr.attackCw = 0x200000;
+    adsr.decayCw = 0x100000;
+    adsr.sustainLevel = 0x400000;
+    adsr.releaseCw = 0x80000;
+    adsr.noteOn[1] = true;
+
+    std::vector<int32_t> out(4);
+    const int32_t expected[] = { 0, 0x200000, 0x400000, 0x600000, 0x7FFFFF, 0x6FFFFF, 0x5FFFFF, 0x4FFFFF, 0x400000, 0x400000 };
+    for (int32_t value : expected) {
+        adsr.process(out.data());
+        CHECK(out[1] == value);
+        CHECK(out[0] == 0);
+    }
+    CHECK(adsr.state(1) == Adsr::State::sustain);
+    CHECK(adsr.activeChannelCount() == 1);
+
+    adsr.noteOn[1] = false;
+    int periods = 0;
+    while (!adsr.channelFree(1) && periods < 100) {
+        adsr.process(out.data());
+        periods++;
+    }
+    // one period to leave sustain, 8 steps of release and the step below zero
+    CHECK(periods == 10);
+    CHECK(out[1] == 0);
+    CHECK(adsr.activeChannelCount() == 0);
+}
+
+void testAdsrSteal()
+{
+    Adsr adsr(4);
+    adsr.attackCw = 0x200000;
+    adsr.decayCw = 0x100000;
+    adsr.sustainLevel = 0x400000;
+    adsr.releaseCw = 0x80000;
+    adsr.noteOn[1] = true;
+    adsr.noteOn[2] = true;
+
+    std::vector<int32_t> out(4);
+    for (int i = 0; i < 10; i++)
+        adsr.process(out.data());
+    CHECK((adsr.quietestChannel() >> 24) == 0x3);   // channel 1, the first of the equal levels
+
+    // a released channel is quieter than a held one at a lower level
+    adsr.noteOn[2] = false;
+    adsr.noteOn[3] = true;
+    adsr.process(out.data());
+    adsr.process(out.data());
+    CHECK(out[3] == 0x200000);
+    CHECK(adsr.quietestChannel() == ((2u << 25) | (1u << 24) | 0x380000));   // a period to leave sustain
+    adsr.steal(2, 1);
+    CHECK((adsr.quietestChannel() & (1u << 24)) == 0);
+
+    // the stolen channel fades out with the fast release whatever its gate and
+    // restarts its attack when it is off
+    adsr.steal(1, 1);
+    int periods = 0;
+    while (!adsr.channelFree(1) && periods < 1000) {
+        adsr.process(out.data());
+        periods++;
+    }
+    CHECK(periods == 0x400000 / Adsr::c_STEAL_RELEASE_CW + 1);
+    CHECK(out[1] == 0 && !adsr.stealing(1));
+    // freed for the sample period it reached off in
+    CHECK(adsr.freed(1) && !adsr.freed(3));
+    adsr.process(out.data());
+    CHECK(!adsr.freed(1));
+    adsr.process(out.data());
+    CHECK(adsr.state(1) == Adsr::State::attack && out[1] == 0x200000);
+    CHECK(adsr.channelFree(2) && !adsr.stealing(2));
+
+    // a note in its attack is not the quietest, the held one at a higher level is
+    CHECK(adsr.state(3) == Adsr::State::sustain && out[3] == 0x400000);
+    CHECK(adsr.quietestChannel() == ((3u << 25) | (1u << 24) | 0x400000));
+}
+
+void testOscillatorPeriod(const Wavetables &tables)
+{
+    Oscillator osc(tables, 2, 1);
+    osc.oscillator[0].waveSelect = 1;
+    osc.oscillator[0].amplitude = 131071;
+    osc.channel[0].fcw = 1 << 12;   // 256 samples per period
+
+    std::vector<int32_t> first(256), out(2);
+    for (int n = 0; n < 256; n++) {
+        osc.process(nullptr, nullptr, out.data());
+        first[n] = out[0];
+        CHECK(out[1] == 0);
+    }
+    for (int n = 0; n < 256; n++) {
+        osc.process(nullptr, nullptr, out.data());
+        CHECK(out[0] == first[n]);
+    }
+    const auto range = std::minmax_element(first.begin(), first.end());
+    // the bandlimited sawtooth tables peak at half scale
+    CHECK(*range.first < -0x300000 && *range.second > 0x300000);
+}
+
+void testMixerNormalisation()
+{
+    Mixer mixer(8);
+    std::vector<int32_t> input(8, 0x100000);
+    int32_t mono, left, right;
+    mixer.process(input.data(), 8, mono, left, right);
+    CHECK(mono == 0x100000);
+    CHECK(left == mono && right == mono);
+
+    mixer.stereoEnable = true;
+    mixer.pan.assign(8, 0);
+    mixer.process(input.data(), 8, mono, left, right);
+    CHECK(right == 0);
+    CHECK(left == int32_t(((int64_t(0x800000) * 32767) >> 15) >> 3));
+
+    // every channel active, the count is 128 and not wrapped to 0
+    Adsr adsr(128);
+    adsr.attackCw = 0x200000;
+    adsr.noteOn.assign(128, true);
+    std::vector<int32_t> levels(128);
+    adsr.process(levels.data());
+    CHECK(adsr.activeChannelCount() == 128);
+    Mixer full(128);
+    std::vector<int32_t> voices(128, 0x10000);
+    full.process(voices.data(), adsr.activeChannelCount(), mono, left, right);
+    CHECK(mono == int32_t((int64_t(0x800000) * 256) >> 15));
+}
+
+void testTanhLookupTable()
+{
+    // the table is interpolated between points of the polynomial, arch_lut is
+    // accepted when within 338 LSB of arch_v2 over the unsaturated range
+    int64_t maxError = 0;
+    for (int64_t x = -(1 << 24); x < (1 << 24); x += 97) {
+        const int64_t error = std::abs(int64_t(MoogLadderFilter::tanhLookupTable(x)) - MoogLadderFilter::tanhPolynomial(x));
+        maxError = std::max(maxError, error);
+    }
+    CHECK(maxError <= 338);
+    CHECK(MoogLadderFilter::tanhPolynomial(0) == 0);
+}
+
+void testFilterLowPassGain()
+{
+    MoogLadderFilter filter(1);
+    filter.cutoffFrequency = 6434;   // 3kHz at 96kHz
+    filter.filterType = 0;
+    filter.filterAttenuation = 1;
+
+    const int32_t input = 0x100000;
+    const int32_t zero = 0;
+    int32_t out = 0;
+    for (int n = 0; n < 4000; n++)
+        filter.process(&input, &zero, &zero, &out);
+    // the ladder passes DC with unity gain after the input saturation
+    const int32_t saturated = MoogLadderFilter::tanhPolynomial(input);
+    CHECK(std::abs(out - saturated) < saturated / 1000);
+}
+
+void testSilence(const Wavetables &tables)
+{
+    Synthesizer synth(tables);
+    int32_t left = 1, right = 1;
+    for (int n = 0; n < 100; n++)
+        synth.process(left, right);
+    CHECK(left == 0 && right == 0);
+
+    synth.noteOn(69);
+    int32_t peak = 0;
+    for (int n = 0; n < 2000; n++) {
+        synth.process(left, right);
+        peak = std::max(peak, std::abs(left));
+    }
+    CHECK(peak > 0x10000);
+}
+
+// every waveform, pulse width and cutoff modulation, resonance and stereo
+void setTestPatch(Synthesizer &synth, bool oversample)
+{
+    for (int osc = 0; osc < Synthesizer::c_NUM_OSCILLATORS; osc++) {
+        synth.setOscillatorWaveform(osc, osc == 0 ? 0 : osc + 1);
+        synth.setOscillatorMix(osc, 0.3);
+    }
+    synth.setOscillatorDetune(2, -9);
+    synth.setOscillatorPulseWidth(2, 0.2);
+    synth.setAdsrAttack(0, 0.002);
+    synth.setAdsrDecay(0, 0.005);
+    synth.setAdsrSustain(0, 0.5);
+    synth.setAdsrRelease(0, 0.004);
+    synth.setFilterCutoffFrequency(800);
+    synth.setFilterResonance(3.0);
+    synth.setFilterEnvelopeAmount(0.5);
+    synth.setFilterKeyTracking(1.0);
+    synth.setFilterOversampling(oversample);
+    synth.setFilterModulationEnable(1);
+    synth.setFilterModulationAmount(0.3);
+    synth.setLfoRate(1, 0.01);
+    synth.setLfoAmount(1, 0.4);
+    synth.setLfoWaveform(2, 3);
+    synth.setLfoRate(2, 0.023);
+    synth.setLfoAmount(2, 0.6);
+    synth.setMixerStereo(1);
+    for (int ch = 0; ch < Synthesizer::c_NUM_CHANNELS; ch++)
+        synth.setMixerVoicePan(ch, (ch % 9) / 4.0f - 1.0f);
+}
+
+void testVectorEngine(const Wavetables &tables, MoogLadderFilter::TanhImplementation tanh, bool oversample)
+{
+    Synthesizer reference(tables, 1, 8, tanh, Synthesizer::Engine::reference);
+    Synthesizer vector(tables, 1, 8, tanh, Synthesizer::Engine::vector);
+    setTestPatch(reference, oversample);
+    setTestPatch(vector, oversample);
+
+    int mismatches = 0;
+    int32_t peak = 0;
+    for (int n = 0; n < 6000; n++) {
+        if (n % 500 == 0) {
+            reference.noteOn(unsigned(40 + n / 250));
+            vector.noteOn(unsigned(40 + n / 250));
+        }
+        if (n % 500 == 300) {
+            reference.noteOff(unsigned(40 + (n - 300) / 250));
+            vector.noteOff(unsigned(40 + (n - 300) / 250));
+        }
+        int32_t referenceLeft, referenceRight, vectorLeft, vectorRight;
+        reference.process(referenceLeft, referenceRight);
+        vector.process(vectorLeft, vectorRight);
+        mismatches += referenceLeft != vectorLeft || referenceRight != vectorRight;
+        peak = std::max(peak, std::abs(referenceLeft));
+    }
+    CHECK(peak > 0x10000);
+    CHECK(mismatches == 0);
+}
+
+void testParallelRenderer(const Wavetables &tables, Synthesizer::Engine engine, int threads)
+{
+    // enough overlapping notes for the voices to cross the blocks of 16 threads and run out
+    constexpr int c_VOICES = 24;
+    Synthesizer reference(tables, 1, c_VOICES, MoogLadderFilter::TanhImplementation::polynomial);
+    ParallelRenderer parallel(tables, 1, c_VOICES, MoogLadderFilter::TanhImplementation::polynomial, engine, threads);
+    setTestPatch(reference, true);
+    parallel.configure([](Synthesizer &synth) { setTestPatch(synth, true); });
+
+    int mismatches = 0;
+    for (int run = 0; run < 60; run++) {
+        const unsigned note = unsigned(30 + run);
+        reference.noteOn(note);
+        parallel.noteOn(note);
+        if (run >= 20) {
+            reference.noteOff(note - 20);
+            parallel.noteOff(note - 20);
+        }
+
+        int32_t left[100], right[100];
+        parallel.render(100, left, right);
+        for (int n = 0; n < 100; n++) {
+            int32_t referenceLeft, referenceRight;
+            reference.process(referenceLeft, referenceRight);
+            mismatches += referenceLeft != left[n] || referenceRight != right[n];
+        }
+    }
+    CHECK(mismatches == 0);
+}
+
+// two notes with the filter closing, channel 1 released at sample period 40
+const char *const c_TEST_REGISTER_SCRIPT =
+    "# period module register data\n"
+    "0 osc 0 00001555\n"
+    "0 osc 0 02002AAA\n"
+    "0 osc 6 0000FFFF\n"
+    "0 osc 1 02000001\n"
+    "0 osc 6 02007FFF\n"
+    "0 adsr 4 00040000\n"
+    "0 filter 0 00000C00\n"
+    "3 adsr 0 00000003\n"
+    "40 adsr 0 00000001\n"
+    "40 filter 0 00000400\n"
+    "40 filter 1 00010000\n"
+    "60 end\n";
+
+// the logs of a tb_system run made with the models: the oscillator, ADSR and
+// NCA frames in their sample period, the filter takes the NCA frame and the
+// mixer the filter frame of the sample period before at i_en
+std::array<StreamLog, RtlCompare::c_NUM_STREAMS> testLogs(const Wavetables &tables, const RegisterScript &script, int numChannels)
+{
+    Oscillator osc(tables, numChannels, 2);
+    Adsr adsr(numChannels);
+    Multiplier multiplier(numChannels);
+    MoogLadderFilter filter(numChannels);
+    Mixer mixer(numChannels);
+    RegisterMap registers(osc, adsr, filter);
+
+    std::array<StreamLog, RtlCompare::c_NUM_STREAMS> logs;
+    auto log = [&](RtlCompare::Stream stream, long period, const int32_t *data, int beats) {
+        for (int i = 0; i < beats; i++) {
+            logs[stream].period.push_back(period);
+            logs[stream].data.push_back(data[i]);
+        }
+    };
+
+    std::vector<int32_t> oscOut(numChannels), adsrOut(numChannels), envelope(numChannels);
+    std::vector<int32_t> ncaOut(numChannels), filterOut(numChannels), zero(numChannels, 0);
+    size_t next = 0;
+    for (long p = 0; p < script.endPeriod(); p++) {
+        for (; next < script.writes().size() && script.writes()[next].period <= p; next++)
+            registers.write(script.writes()[next]);
+        if (p >= 2) {
+            int32_t mono, left, right;
+            mixer.process(filterOut.data(), adsr.activeChannelCount(), mono, left, right);
+            log(RtlCompare::mixer, p, &mono, 1);
+        }
+        if (p >= 1) {
+            filter.process(ncaOut.data(), zero.data(), zero.data(), filterOut.data());
+            log(RtlCompare::filter, p, filterOut.data(), numChannels);
+        }
+        osc.process(nullptr, nullptr, oscOut.data());
+        adsr.process(adsrOut.data());
+        for (int ch = 0; ch < numChannels; ch++)
+            envelope[ch] = adsrOut[ch] >> 6;
+        multiplier.process(oscOut.data(), envelope.data(), ncaOut.data());
+        log(RtlCompare::oscillator, p, oscOut.data(), numChannels);
+        log(RtlCompare::adsr, p, adsrOut.data(), numChannels);
+        log(RtlCompare::nca, p, ncaOut.data(), numChannels);
+    }
+    return logs;
+}
+
+void testRtlCompare(const Wavetables &tables)
+{
+    constexpr int c_CHANNELS = 8;
+    std::istringstream text(c_TEST_REGISTER_SCRIPT);
+    const RegisterScript script = RegisterScript::parse(text);
+    CHECK(script.writes().size() == 11);
+    CHECK(script.endPeriod() == 60);
+
+    auto logs = testLogs(tables, script, c_CHANNELS);
+    const RtlCompare comparison(tables, c_CHANNELS, 2);
+    auto results = comparison.compare(script, logs);
+    for (int s = 0; s < RtlCompare::c_NUM_STREAMS; s++)
+        CHECK(results[s].mismatches == 0);
+    CHECK(results[RtlCompare::oscillator].frames == 60);
+    CHECK(results[RtlCompare::filter].frames == 59);
+    CHECK(results[RtlCompare::mixer].frames == 58);
+    const auto &mixer = logs[RtlCompare::mixer].data;
+    CHECK(*std::max_element(mixer.begin(), mixer.end()) > 0x1000);
+
+    // one sample off in the filter is reported where it is
+    logs[RtlCompare::filter].data[10 * c_CHANNELS + 3] += 1;
+    results = comparison.compare(script, logs);
+    CHECK(results[RtlCompare::filter].mismatches == 1);
+    CHECK(results[RtlCompare::filter].first.size() == 1);
+    CHECK(results[RtlCompare::filter].first[0].frame == 10);
+    CHECK(results[RtlCompare::filter].first[0].period == 11);
+    CHECK(results[RtlCompare::filter].first[0].channel == 3);
+    CHECK(results[RtlCompare::nca].mismatches == 0);
+
+    // a note on a sample period late
+    std::string late = c_TEST_REGISTER_SCRIPT;
+    late.replace(late.find("3 adsr 0"), 1, "4");
+    std::istringstream lateText(late);
+    results = comparison.compare(RegisterScript::parse(lateText), testLogs(tables, script, c_CHANNELS));
+    CHECK(results[RtlCompare::adsr].mismatches > 0);
+    CHECK(results[RtlCompare::oscillator].mismatches == 0);
+
+    for (const char *bad : { "0 osc 0 155\n1 end\n", "0 osc 0 00000155\n", "2 osc 0 00000155\n1 osc 0 00000155\n3 end\n",
+                             "0 lfo 0 00000155\n1 end\n" }) {
+        std::istringstream badText(bad);
+        bool thrown = false;
+        try {
+            RegisterScript::parse(badText);
+        } catch (const std::runtime_error &) {
+            thrown = true;
+        }
+        CHECK(thrown);
+    }
+}
+
+// a Standard MIDI File of a tempo track, 480 ticks per quarter note, and one
+// track of (delta ticks, message bytes) events
+std::string testMidiFile(const std::vector<std::pair<uint32_t, std::vector<uint8_t>>> &events,
+                         const std::vector<uint8_t> &tempoTrack)
+{
+    auto chunk = [](const char *id, const std::string &data) {
+        const uint32_t n = uint32_t(data.size());
+        return std::string(id, 4) + char(n >> 24) + char(n >> 16) + char(n >> 8) + char(n) + data;
+    };
+    std::string track;
+    for (const auto &event : events) {
+        std::string delta(1, char(event.first & 0x7F));
+        for (uint32_t d = event.first >> 7; d; d >>= 7)
+            delta.insert(delta.begin(), char(0x80 | (d & 0x7F)));
+        track += delta + std::string(event.second.begin(), event.second.end());
+    }
+    const std::string end = { 0, char(0xFF), 0x2F, 0 };
+    return chunk("MThd", std::string({ 0, 1, 0, 2, 1, char(0xE0) })) +
+           chunk("MTrk", std::string(tempoTrack.begin(), tempoTrack.end()) + end) + chunk("MTrk", track + end);
+}
+
+MidiFile parseMidi(const std::string &bytes)
+{
+    std::istringstream input(bytes);
+    return MidiFile::parse(input);
+}
+
+void testMidiReplay()
+{
+    // 120 BPM, 240 BPM from the second beat, running status
+    const std::vector<uint8_t> tempo = { 0, 0xFF, 0x51, 3, 0x07, 0xA1, 0x20, 0x83, 0x60, 0xFF, 0x51, 3, 0x03, 0xD0, 0x90 };
+    MidiFile file = parseMidi(testMidiFile({ { 0, { 0x90, 60, 100 } }, { 480, { 64, 100 } }, { 480, { 0x80, 60, 0 } } },
+                                           tempo));
+    CHECK(file.events().size() == 3);
+    CHECK(file.events()[1].status == 0x90 && file.events()[1].data[0] == 64);
+    CHECK(std::abs(file.events()[1].time - 0.5) < 1e-9);
+    CHECK(std::abs(file.events()[2].time - 0.75) < 1e-9);
+
+    // a chord of 8 notes, released
+    std::vector<std::pair<uint32_t, std::vector<uint8_t>>> events;
+    for (uint8_t n = 0; n < 8; n++)
+        events.push_back({ 0, { 0x90, uint8_t(48 + n), 100 } });
+    for (uint8_t n = 0; n < 8; n++)
+        events.push_back({ n ? 0u : 480u, { 0x80, uint8_t(48 + n), 0 } });
+    MidiReplay::Settings settings;
+    MidiReplay::Report report = MidiReplay::run(parseMidi(testMidiFile(events, tempo)), settings);
+    CHECK(report.notesPlayed == 8);
+    CHECK(report.allocationFailures == 0);
+    CHECK(report.stuckNotes.empty());
+    CHECK(report.peakAssignedChannels == 8);
+    CHECK(report.peakNotesPerSecond == 8);
+    CHECK(report.cost[MidiReplay::noteOn].messages == 8);
+    // 6 channel writes and the read modify write of 2 ADSRs, the free voice
+    // pool is kept by the voice freed interrupt and not read
+    CHECK(report.cost[MidiReplay::noteOn].maxAccesses == 10);
+    // the chord is freed in one sample period, one interrupt reads the 4 freed
+    // registers and turns off 3 LFOs and the modulation of each voice
+    CHECK(report.voiceFreedInterrupts == 1);
+    CHECK(report.voiceFreedAccesses == 4 + 8 * 4);
+
+    // with 4 unison voices a group of 4 channels per note is free, without
+    // voice stealing the note ons after the last group fail
+    settings.unisonVoices = 4;
+    settings.stealPolicy = MidiReplay::StealPolicy::none;
+    const int channels = firmwareNumChannels();
+    const int groups = channels / 4;
+    events.clear();
+    for (int n = 0; n < groups + 4; n++)
+        events.push_back({ 10, { 0x90, uint8_t(30 + n), 100 } });
+    report = MidiReplay::run(parseMidi(testMidiFile(events, tempo)), settings);
+    CHECK(report.notesPlayed == groups);
+    CHECK(report.allocationFailures == 4);
+    CHECK(report.failures.size() == 4);
+    CHECK(report.failures[0].note == 30 + groups && report.failures[0].assignedChannels == channels);
+    CHECK(report.peakAssignedChannels == channels);
+    CHECK(report.stuckNotes.empty());   // the file holds the notes
+
+    // every group playing and one released, the note on after it steals the
+    // released group, the oldest group or the group of the same note
+    settings.release = 1.0;
+    settings.tail = 2.0;
+    events.clear();
+    for (int n = 0; n < groups; n++)
+        events.push_back({ 10, { 0x90, uint8_t(30 + n), 100 } });
+    events.push_back({ 10, { 0x80, 40, 0 } });
+    struct StealCase {
+        MidiReplay::StealPolicy policy;
+        uint8_t note;
+        int     group;
+    };
+    for (const StealCase &steal : { StealCase{ MidiReplay::StealPolicy::quietest, 100, 10 },
+                                    StealCase{ MidiReplay::StealPolicy::oldest, 100, 0 },
+                                    StealCase{ MidiReplay::StealPolicy::sameNote, 35, 5 },
+                                    StealCase{ MidiReplay::StealPolicy::none, 100, -1 } }) {
+        settings.stealPolicy = steal.policy;
+        std::vector<std::pair<uint32_t, std::vector<uint8_t>>> stealEvents = events;
+        stealEvents.push_back({ 10, { 0x90, steal.note, 100 } });
+        report = MidiReplay::run(parseMidi(testMidiFile(stealEvents, tempo)), settings);
+        const bool stolen = steal.group >= 0;
+        CHECK(report.notesPlayed == groups + stolen);
+        CHECK(report.voiceSteals == stolen);
+        CHECK(report.allocationFailures == !stolen);
+        CHECK(report.stuckNotes.empty());
+        if (stolen)
+            CHECK(firmwareAssignedNote(steal.group * 4) == steal.note && firmwareAssignedNote(steal.group * 4 + 3) == steal.note);
+    }
+    settings.release = 0.0;
+    settings.tail = 1.0;
+
+    // the firmware plays a note on with velocity 0 as a note on, so the note
+    // and its release are left assigned. A repeated note plays on a second
+    // group that stays assigned while the file holds it
+    settings.unisonVoices = 1;
+    report = MidiReplay::run(parseMidi(testMidiFile({ { 0, { 0x90, 60, 100 } }, { 480, { 60, 0 } },
+                                                      { 0, { 0x90, 62, 100 } }, { 10, { 62, 100 } },
+                                                      { 10, { 0x80, 62, 0 } } }, tempo)), settings);
+    CHECK(report.notesPlayed == 4);
+    CHECK(report.cost[MidiReplay::noteOnVelocity0].messages == 1);
+    CHECK(report.stuckNotes.size() == 2);
+    for (const MidiReplay::StuckNote &stuck : report.stuckNotes)
+        CHECK(stuck.note == 60 && stuck.gate);
+
+    for (const std::string &bad : { std::string("MThd"), testMidiFile({ { 0, { 60, 100 } } }, tempo),
+                                    testMidiFile({ { 0, { 0x90, 60 } } }, tempo) }) {
+        bool thrown = false;
+        try {
+            parseMidi(bad);
+        } catch (const std::runtime_error &) {
+            thrown = true;
+        }
+        CHECK(thrown);
+    }
+}
+
+// the default settings give the tables of the oscillator and the committed
+// package, the images of small tables have the layout of their formats
+void testWavetableGenerator(const Wavetables &tables)
+{
+    using Waveform = WavetableGenerator::Waveform;
+    const WavetableGenerator generator;
+    for (int octave = 0; octave < Wavetables::c_NUM_OCTAVES; octave++) {
+        const std::vector<int32_t> &sawtooth = generator.table(Waveform::sawtooth, octave);
+        const std::vector<int32_t> &triangle = generator.table(Waveform::triangle, octave);
+        CHECK(std::equal(sawtooth.begin(), sawtooth.end(), tables.sawtooth[octave].begin(), tables.sawtooth[octave].end()));
+        CHECK(std::equal(triangle.begin(), triangle.end(), tables.triangle[octave].begin(), tables.triangle[octave].end()));
+    }
+
+    std::ifstream file(std::string(SYNTH_WAVETABLE_DIR) + "/wavetable_rom_package.vhd");
+    std::stringstream committed, generated;
+    committed << file.rdbuf();
+    generator.writePackage(generated);
+    CHECK(committed.str() == generated.str());
+
+    WavetableSettings settings;
+    settings.harmonics = 4;
+    settings.length = 16;
+    settings.width = 12;
+    settings.octaves = 3;
+    const WavetableGenerator small(settings);
+    // octave 2 has the fundamental only, the peaks at 0 and 3/4 of the table
+    CHECK(small.table(Waveform::triangle, 2)[0] == -(1 << 10) + 1);
+    CHECK(small.table(Waveform::sawtooth, 2)[12] == (1 << 10) - 1);
+
+    std::stringstream coe, mem, bin;
+    small.writeCoe(coe, Waveform::sawtooth, 2);
+    small.writeMem(mem, Waveform::sawtooth, 2);
+    small.writeBin(bin, Waveform::sawtooth);
+    const std::string coeText = coe.str(), memText = mem.str(), binText = bin.str();
+    CHECK(coeText.find("memory_initialization_radix=16;\nmemory_initialization_vector=\n000,\n") != std::string::npos);
+    CHECK(std::count(coeText.begin() + coeText.find("vector="), coeText.end(), ',') == 15);
+    CHECK(memText.compare(0, 7, "@0\n000\n") == 0);
+    CHECK(std::count(memText.begin(), memText.end(), '\n') == 17);
+    CHECK(binText.size() == 3 * 16 * 2);
+    CHECK(binText.compare((2 * 16 + 12) * 2, 2, std::string("\xFF\x03", 2)) == 0);
+
+    for (int field = 0; field < 4; field++) {
+        WavetableSettings bad;
+        if (field == 0) bad.length = 1000;
+        if (field == 1) bad.width = 40;
+        if (field == 2) bad.harmonics = 0;
+        if (field == 3) bad.headroom = 24;
+        bool thrown = false;
+        try {
+            WavetableGenerator rejected(bad);
+        } catch (const std::invalid_argument &) {
+            thrown = true;
+        }
+        CHECK(thrown);
+    }
+}
+
+} // namespace
+
+int main()
+{
+    const Wavetables tables = Wavetables::load(SYNTH_WAVETABLE_DIR);
+
+    testFixedPoint();
+    testAdsrAttack();
+    testAdsrSteal();
+    testOscillatorPeriod(tables);
+    testMixerNormalisation();
+    testTanhLookupTable();
+    testFilterLowPassGain();
+    testSilence(tables);
+    testVectorEngine(tables, MoogLadderFilter::TanhImplementation::polynomial, false);
+    testVectorEngine(tables, MoogLadderFilter::TanhImplementation::lookupTable, true);
+    testParallelRenderer(tables, Synthesizer::Engine::reference, 3);
+    testParallelRenderer(tables, Synthesizer::Engine::vector, 1);
+    testParallelRenderer(tables, Synthesizer::Engine::vector, ParallelRenderer::c_MAX_THREADS);
+    testRtlCompare(tables);
+    testMidiReplay();
+    testWavetableGenerator(tables);
+
+    if (g_failures) {
+        std::fprintf(stderr, "%d checks failed\n", g_failures);
+        return 1;
+    }
+    std::printf("all checks passed\n");
+    return 0;
+}
@@ -2,16 +2,22 @@ library ieee;
 use ieee.std_logic_1164.all;
 use ieee.numeric_std.all;
 use ieee.math_real.all;
+use work.synth_config_package.all;
 
 entity ADSR_v2_0 is
 	generic (
 		-- Users to add parameters here
-        g_NUM_CHANNELS : integer := 128;
+        g_NUM_CHANNELS : integer := c_NUM_CHANNELS;
         g_DATA_WIDTH   : integer := 24;
 
 		-- Parameters of Axi Slave Bus Interface S_AXI_CTRL
 		C_S_AXI_CTRL_DATA_WIDTH	: integer	:= 32;
-		C_S_AXI_CTRL_ADDR_WIDTH	: integer	:= 6;
+		C_S_AXI_CTRL_ADDR_WIDTH	: integer	:= 7;
+
+		-- Parameters of Axi Slave Bus Interface S_AXI_PARAM
+		C_S_AXI_PARAM_ID_WIDTH	: integer	:= 1;
+		C_S_AXI_PARAM_DATA_WIDTH	: integer	:= 32;
+		C_S_AXI_PARAM_ADDR_WIDTH	: integer	:= 11;
 
 		-- Parameters of Axi Master Bus Interface M_AXIS_OUTPUT
 		C_M_AXIS_OUTPUT_TDATA_WIDTH	: integer	:= 32;
@@ -20,7 +26,9 @@ entity ADSR_v2_0 is
 	port (
 		-- Users to add ports here
         i_enable : in std_logic;
-        o_active_channel_count : out std_logic_vector(6 downto 0);
+        o_active_channel_count : out std_logic_vector(c_COUNT_WIDTH-1 downto 0);
+        -- high while a voice freed since the freed registers were read is unread
+        o_voice_freed_irq : out std_logic;
 
 		-- Ports of Axi Slave Bus Interface S_AXI_CTRL
 		s_axi_ctrl_aclk	: in std_logic;
@@ -45,6 +53,45 @@ entity ADSR_v2_0 is
 		s_axi_ctrl_rvalid	: out std_logic;
 		s_axi_ctrl_rready	: in std_logic;
 
+		-- Ports of Axi Slave Bus Interface S_AXI_PARAM
+		s_axi_param_aclk	: in std_logic;
+		s_axi_param_aresetn	: in std_logic;
+		s_axi_param_awid	: in std_logic_vector(C_S_AXI_PARAM_ID_WIDTH-1 downto 0);
+		s_axi_param_awaddr	: in std_logic_vector(C_S_AXI_PARAM_ADDR_WIDTH-1 downto 0);
+		s_axi_param_awlen	: in std_logic_vector(7 downto 0);
+		s_axi_param_awsize	: in std_logic_vector(2 downto 0);
+		s_axi_param_awburst	: in std_logic_vector(1 downto 0);
+		s_axi_param_awlock	: in std_logic;
+		s_axi_param_awcache	: in std_logic_vector(3 downto 0);
+		s_axi_param_awprot	: in std_logic_vector(2 downto 0);
+		s_axi_param_awvalid	: in std_logic;
+		s_axi_param_awready	: out std_logic;
+		s_axi_param_wdata	: in std_logic_vector(C_S_AXI_PARAM_DATA_WIDTH-1 downto 0);
+		s_axi_param_wstrb	: in std_logic_vector((C_S_AXI_PARAM_DATA_WIDTH/8)-1 downto 0);
+		s_axi_param_wlast	: in std_logic;
+		s_axi_param_wvalid	: in std_logic;
+		s_axi_param_wready	: out std_logic;
+		s_axi_param_bid	: out std_logic_vector(C_S_AXI_PARAM_ID_WIDTH-1 downto 0);
+		s_axi_param_bresp	: out std_logic_vector(1 downto 0);
+		s_axi_param_bvalid	: out std_logic;
+		s_axi_param_bready	: in std_logic;
+		s_axi_param_arid	: in std_logic_vector(C_S_AXI_PARAM_ID_WIDTH-1 downto 0);
+		s_axi_param_araddr	: in std_logic_vector(C_S_AXI_PARAM_ADDR_WIDTH-1 downto 0);
+		s_axi_param_arlen	: in std_logic_vector(7 downto 0);
+		s_axi_param_arsize	: in std_logic_vector(2 downto 0);
+		s_axi_param_arburst	: in std_logic_vector(1 downto 0);
+		s_axi_param_arlock	: in std_logic;
+		s_axi_param_arcache	: in std_logic_vector(3 downto 0);
+		s_axi_param_arprot	: in std_logic_vector(2 downto 0);
+		s_axi_param_arvalid	: in std_logic;
+		s_axi_param_arready	: out std_logic;
+		s_axi_param_rid	: out std_logic_vector(C_S_AXI_PARAM_ID_WIDTH-1 downto 0);
+		s_axi_param_rdata	: out std_logic_vector(C_S_AXI_PARAM_DATA_WIDTH-1 downto 0);
+		s_axi_param_rresp	: out std_logic_vector(1 downto 0);
+		s_axi_param_rlast	: out std_logic;
+		s_axi_param_rvalid	: out std_logic;
+		s_axi_param_rready	: in std_logic;
+
 		-- Ports of Axi Master Bus Interface M_AXIS_OUTPUT
 		m_axis_output_aclk	: in std_logic;
 		m_axis_output_aresetn	: in std_logic;
@@ -64,12 +111,34 @@ architecture arch_imp of ADSR_v2_0 is
     signal w_sustain_level     : std_logic_vector(g_DATA_WIDTH-1 downto 0);
     signal w_release_cw        : std_logic_vector(g_DATA_WIDTH-1 downto 0);
     signal w_channel_free_array   : std_logic_vector(g_NUM_CHANNELS-1 downto 0);
+    -- voice stealing
+    signal w_steal_en          : std_logic;
+    signal w_steal_channel     : std_logic_vector(c_CHANNEL_WIDTH-1 downto 0);
+    signal w_steal_count       : std_logic_vector(3 downto 0);
+    signal w_quietest_valid    : std_logic;
+    signal w_quietest_channel  : std_logic_vector(c_CHANNEL_WIDTH-1 downto 0);
+    signal w_quietest_level    : std_logic_vector(g_DATA_WIDTH-1 downto 0);
+    -- voices freed
+    signal w_freed_en          : std_logic;
+    signal w_freed_channel     : std_logic_vector(c_CHANNEL_WIDTH-1 downto 0);
+    -- per voice parameter RAM {attack, decay, sustain, release}
+    signal w_param_source  : std_logic_vector(3 downto 0);
+    signal w_param_channel : std_logic_vector(c_CHANNEL_WIDTH-1 downto 0);
+    signal w_param_word    : std_logic_vector(6 downto 0); -- banks are 128 words whatever the channel count
+    signal w_param_index   : std_logic_vector(4*7-1 downto 0);
+    signal w_param_data    : std_logic_vector(4*C_S_AXI_PARAM_DATA_WIDTH-1 downto 0);
+    signal w_adsr_attack_cw     : std_logic_vector(g_DATA_WIDTH-1 downto 0);
+    signal w_adsr_decay_cw      : std_logic_vector(g_DATA_WIDTH-1 downto 0);
+    signal w_adsr_sustain_level : std_logic_vector(g_DATA_WIDTH-1 downto 0);
+    signal w_adsr_release_cw    : std_logic_vector(g_DATA_WIDTH-1 downto 0);
     -- envelope
     --signal w_envelope          : std_logic_vector(31 downto 0);
 
     signal w_output_fifo_wr_en   : std_logic;
 	signal w_output_fifo_wr_data : std_logic_vector(g_DATA_WIDTH-1 downto 0);
 	signal w_output_fifo_full    : std_logic;
+    signal w_output_fifo_level_status : std_logic_vector(31 downto 0);
+    signal w_output_fifo_error_status : std_logic_vector(31 downto 0);
 
 begin
 
@@ -87,6 +156,18 @@ begin
         o_sustain_level      => w_sustain_level,
         o_release_cw         => w_release_cw,
         i_channel_free_array => w_channel_free_array,
+        o_param_source       => w_param_source,
+        o_steal_en           => w_steal_en,
+        o_steal_channel      => w_steal_channel,
+        o_steal_count        => w_steal_count,
+        i_quietest_valid     => w_quietest_valid,
+        i_quietest_channel   => w_quietest_channel,
+        i_quietest_level     => w_quietest_level,
+        i_freed_en           => w_freed_en,
+        i_freed_channel      => w_freed_channel,
+        o_voice_freed_irq    => o_voice_freed_irq,
+        i_fifo_level_status  => w_output_fifo_level_status,
+        i_fifo_error_status  => w_output_fifo_error_status,
 		S_AXI_ACLK	    => s_axi_ctrl_aclk,
 		S_AXI_ARESETN	=> s_axi_ctrl_aresetn,
 		S_AXI_AWADDR	=> s_axi_ctrl_awaddr,
@@ -110,6 +191,58 @@ begin
 		S_AXI_RREADY	=> s_axi_ctrl_rready
 	);
 
+    -- Instantiation of Axi Bus Interface S_AXI_PARAM
+    param_ram : entity work.axi_param_ram
+	generic map (
+	    g_NUM_BANKS         => 4,
+	    g_INDEX_WIDTH       => 7,
+	    g_MEMORY_TYPE       => "block",
+		C_S_AXI_ID_WIDTH	=> C_S_AXI_PARAM_ID_WIDTH,
+		C_S_AXI_DATA_WIDTH	=> C_S_AXI_PARAM_DATA_WIDTH,
+		C_S_AXI_ADDR_WIDTH	=> C_S_AXI_PARAM_ADDR_WIDTH
+	)
+	port map (
+	    i_rd_index      => w_param_index,
+	    o_rd_data       => w_param_data,
+		S_AXI_ACLK	    => s_axi_param_aclk,
+		S_AXI_ARESETN	=> s_axi_param_aresetn,
+		S_AXI_AWID	    => s_axi_param_awid,
+		S_AXI_AWADDR	=> s_axi_param_awaddr,
+		S_AXI_AWLEN	    => s_axi_param_awlen,
+		S_AXI_AWSIZE	=> s_axi_param_awsize,
+		S_AXI_AWBURST	=> s_axi_param_awburst,
+		S_AXI_AWLOCK	=> s_axi_param_awlock,
+		S_AXI_AWCACHE	=> s_axi_param_awcache,
+		S_AXI_AWPROT	=> s_axi_param_awprot,
+		S_AXI_AWVALID	=> s_axi_param_awvalid,
+		S_AXI_AWREADY	=> s_axi_param_awready,
+		S_AXI_WDATA	    => s_axi_param_wdata,
+		S_AXI_WSTRB	    => s_axi_param_wstrb,
+		S_AXI_WLAST	    => s_axi_param_wlast,
+		S_AXI_WVALID	=> s_axi_param_wvalid,
+		S_AXI_WREADY	=> s_axi_param_wready,
+		S_AXI_BID	    => s_axi_param_bid,
+		S_AXI_BRESP	    => s_axi_param_bresp,
+		S_AXI_BVALID	=> s_axi_param_bvalid,
+		S_AXI_BREADY	=> s_axi_param_bready,
+		S_AXI_ARID	    => s_axi_param_arid,
+		S_AXI_ARADDR	=> s_axi_param_araddr,
+		S_AXI_ARLEN	    => s_axi_param_arlen,
+		S_AXI_ARSIZE	=> s_axi_param_arsize,
+		S_AXI_ARBURST	=> s_axi_param_arburst,
+		S_AXI_ARLOCK	=> s_axi_param_arlock,
+		S_AXI_ARCACHE	=> s_axi_param_arcache,
+		S_AXI_ARPROT	=> s_axi_param_arprot,
+		S_AXI_ARVALID	=> s_axi_param_arvalid,
+		S_AXI_ARREADY	=> s_axi_param_arready,
+		S_AXI_RID	    => s_axi_param_rid,
+		S_AXI_RDATA	    => s_axi_param_rdata,
+		S_AXI_RRESP	    => s_axi_param_rresp,
+		S_AXI_RLAST	    => s_axi_param_rlast,
+		S_AXI_RVALID	=> s_axi_param_rvalid,
+		S_AXI_RREADY	=> s_axi_param_rready
+	);
+
     -- Instantiation of Axi Bus Interface M_AXIS_OUTPUT
     ADSR_v2_0_M_AXIS_OUTPUT_inst : entity work.ADSR_v2_0_M_AXIS_OUTPUT
 	generic map (
@@ -122,6 +255,8 @@ begin
 	    i_fifo_wr_en    => w_output_fifo_wr_en,
         i_fifo_wr_data  => w_output_fifo_wr_data,
 	    o_fifo_full     => w_output_fifo_full,
+        o_fifo_level_status => w_output_fifo_level_status,
+        o_fifo_error_status => w_output_fifo_error_status,
 		M_AXIS_ACLK	    => m_axis_output_aclk,
 		M_AXIS_ARESETN	=> m_axis_output_aresetn,
 		M_AXIS_TVALID	=> m_axis_output_tvalid,
@@ -141,11 +276,20 @@ begin
         i_en                    => i_enable, 
         -- ctrls 
         i_note_on_off_array     => w_note_on_off_array,      
-        i_attack_cw             => w_attack_cw, 
-        i_decay_cw              => w_decay_cw, 
-        i_sustain_level         => w_sustain_level, 
-        i_release_cw            => w_release_cw, 
+        i_attack_cw             => w_adsr_attack_cw, 
+        i_decay_cw              => w_adsr_decay_cw, 
+        i_sustain_level         => w_adsr_sustain_level, 
+        i_release_cw            => w_adsr_release_cw, 
         o_channel_free_array    => w_channel_free_array, 
+        o_param_channel         => w_param_channel,
+        i_steal_en              => w_steal_en,
+        i_steal_channel         => w_steal_channel,
+        i_steal_count           => w_steal_count,
+        o_quietest_valid        => w_quietest_valid,
+        o_quietest_channel      => w_quietest_channel,
+        o_quietest_level        => w_quietest_level,
+        o_freed_en              => w_freed_en,
+        o_freed_channel         => w_freed_channel,
         -- envelope
         o_envelope_fifo_wr_en   => w_output_fifo_wr_en, 
         o_envelope_fifo_wr_data => w_output_fifo_wr_data, 
@@ -153,4 +297,13 @@ begin
         o_active_channel_count  => o_active_channel_count          
     );
 
+    -- envelope parameters from the control registers or the parameter RAM
+    w_param_word  <= std_logic_vector(resize(unsigned(w_param_channel), w_param_word'length));
+    w_param_index <= w_param_word & w_param_word & w_param_word & w_param_word;
+
+    w_adsr_attack_cw     <= w_param_data(0*C_S_AXI_PARAM_DATA_WIDTH+g_DATA_WIDTH-1 downto 0*C_S_AXI_PARAM_DATA_WIDTH) when w_param_source(0) = '1' else w_attack_cw;
+    w_adsr_decay_cw      <= w_param_data(1*C_S_AXI_PARAM_DATA_WIDTH+g_DATA_WIDTH-1 downto 1*C_S_AXI_PARAM_DATA_WIDTH) when w_param_source(1) = '1' else w_decay_cw;
+    w_adsr_sustain_level <= w_param_data(2*C_S_AXI_PARAM_DATA_WIDTH+g_DATA_WIDTH-1 downto 2*C_S_AXI_PARAM_DATA_WIDTH) when w_param_source(2) = '1' else w_sustain_level;
+    w_adsr_release_cw    <= w_param_data(3*C_S_AXI_PARAM_DATA_WIDTH+g_DATA_WIDTH-1 downto 3*C_S_AXI_PARAM_DATA_WIDTH) when w_param_source(3) = '1' else w_release_cw;
+
 end arch_imp;
@@ -1,6 +1,7 @@
 library ieee;
 use ieee.std_logic_1164.all;
 use ieee.numeric_std.all;
+use work.synth_config_package.all;
 
 
 entity ADSR_v2_0_S_AXI_CTRL is
@@ -13,8 +14,8 @@ entity ADSR_v2_0_S_AXI_CTRL is
 
 		-- Width of S_AXI data bus
 		C_S_AXI_DATA_WIDTH	: integer	:= 32;
-		-- Width of S_AXI address bus
-		C_S_AXI_ADDR_WIDTH	: integer	:= 6
+		-- Width of S_AXI address bus, the control bank and the voice freed bank
+		C_S_AXI_ADDR_WIDTH	: integer	:= 7
 	);
 	port (
 		-- Users to add ports here
@@ -24,6 +25,26 @@ entity ADSR_v2_0_S_AXI_CTRL is
         o_sustain_level     : out  std_logic_vector(g_DATA_WIDTH-1 downto 0);
         o_release_cw        : out  std_logic_vector(g_DATA_WIDTH-1 downto 0);
         i_channel_free_array : in std_logic_vector(g_NUM_CHANNELS-1 downto 0);
+        -- parameter source per parameter {attack, decay, sustain, release},
+        -- registers (0) or per voice parameter RAM (1)
+        o_param_source       : out std_logic_vector(3 downto 0);
+        -- voice stealing, a write to register 13 steals {channel[31:25], count[3:0]}
+        -- and a read returns the quietest channel {channel[31:25], valid[24], level[23:0]}
+        o_steal_en           : out std_logic;
+        o_steal_channel      : out std_logic_vector(c_CHANNEL_WIDTH-1 downto 0);
+        o_steal_count        : out std_logic_vector(3 downto 0);
+        i_quietest_valid     : in std_logic;
+        i_quietest_channel   : in std_logic_vector(c_CHANNEL_WIDTH-1 downto 0);
+        i_quietest_level     : in std_logic_vector(g_DATA_WIDTH-1 downto 0);
+        -- voices freed, a pulse per channel that reaches off sets its bit of the
+        -- freed registers 16 to 19, a read of one clears the bits it returns,
+        -- the interrupt is high while a bit is set and register 20 enables it
+        i_freed_en           : in std_logic;
+        i_freed_channel      : in std_logic_vector(c_CHANNEL_WIDTH-1 downto 0);
+        o_voice_freed_irq    : out std_logic;
+        -- output FIFO status
+        i_fifo_level_status  : in std_logic_vector(31 downto 0);
+        i_fifo_error_status  : in std_logic_vector(31 downto 0);
 		-- User ports ends
 		-- Do not modify the ports beyond this line
 
@@ -111,6 +132,11 @@ architecture arch_imp of ADSR_v2_0_S_AXI_CTRL is
 	-- ADDR_LSB = 3 for 64 bits (n downto 3)
 	constant ADDR_LSB  : integer := (C_S_AXI_DATA_WIDTH/32)+ 1;
 	constant OPT_MEM_ADDR_BITS : integer := 3;
+	-- the bank is selected by the address bits above the register index,
+	-- bank 0 holds registers 0 to 15 and bank 1 the voice freed registers
+	constant c_BANK_ADDR_LSB : integer := ADDR_LSB + OPT_MEM_ADDR_BITS + 1;
+	constant c_CONTROL_BANK  : integer := 0;
+	constant c_FREED_BANK    : integer := 1;
 	------------------------------------------------
 	---- Signals for user logic register space example
 	--------------------------------------------------
@@ -144,6 +170,11 @@ architecture arch_imp of ADSR_v2_0_S_AXI_CTRL is
     
     signal w_o_note_on_off_reg   : std_logic_vector(127 downto 0);
     signal w_channel_free_array : std_logic_vector(127 downto 0);
+    
+    -- channels freed since their freed register was last read
+    signal r_freed_array        : std_logic_vector(127 downto 0) := (others => '0');
+    signal slv_reg_irq_enable   : std_logic_vector(C_S_AXI_DATA_WIDTH-1 downto 0);
+    signal r_voice_freed_irq    : std_logic := '0';
 
 begin
 	-- I/O Connections assignments
@@ -238,6 +269,7 @@ begin
 
 	process (S_AXI_ACLK)
 	variable loc_addr :std_logic_vector(OPT_MEM_ADDR_BITS downto 0); 
+	variable bank : integer;
 	begin
 	  if rising_edge(S_AXI_ACLK) then 
 	    if S_AXI_ARESETN = '0' then
@@ -257,9 +289,16 @@ begin
           slv_reg13 <= (others => '0');
           slv_reg14 <= (others => '0');
           slv_reg15 <= (others => '0');
+          slv_reg_irq_enable <= (others => '0');
 	    else
 	      loc_addr := axi_awaddr(ADDR_LSB + OPT_MEM_ADDR_BITS downto ADDR_LSB);
-	      if (slv_reg_wren = '1') then
+	      bank := to_integer(unsigned(axi_awaddr(C_S_AXI_ADDR_WIDTH-1 downto c_BANK_ADDR_LSB)));
+	      if slv_reg_wren = '1' and bank = c_FREED_BANK then
+	        -- register 20, the interrupt enable, registers 16 to 19 are read only
+	        if loc_addr = b"0100" then
+	          slv_reg_irq_enable <= S_AXI_WDATA;
+	        end if;
+	      elsif slv_reg_wren = '1' and bank = c_CONTROL_BANK then
 	        case loc_addr is
 	          when b"0000" =>
 	                slv_reg0 <= S_AXI_WDATA;
@@ -399,51 +438,74 @@ begin
 
 	process (slv_reg0, slv_reg1, slv_reg2, slv_reg3, slv_reg4, slv_reg5, slv_reg6, slv_reg7, 
 	         slv_reg8, slv_reg9, slv_reg10, slv_reg11, slv_reg12, slv_reg13, slv_reg14, slv_reg15,
-	         axi_araddr, S_AXI_ARESETN, slv_reg_rden, w_channel_free_array)
+	         axi_araddr, S_AXI_ARESETN, slv_reg_rden, w_channel_free_array,
+	         i_fifo_level_status, i_fifo_error_status,
+	         i_quietest_valid, i_quietest_channel, i_quietest_level, r_freed_array, slv_reg_irq_enable)
 	variable loc_addr :std_logic_vector(OPT_MEM_ADDR_BITS downto 0);
+	variable bank : integer;
 	begin
 	    -- Address decoding for reading registers
 	    loc_addr := axi_araddr(ADDR_LSB + OPT_MEM_ADDR_BITS downto ADDR_LSB);
-	    case loc_addr is
-	      when b"0000" =>
-	        reg_data_out <= slv_reg0;
-	      when b"0001" =>
-	        reg_data_out <= slv_reg1;
-	      when b"0010" =>
-	        reg_data_out <= slv_reg2;
-	      when b"0011" =>
-	        reg_data_out <= slv_reg3;
-	      when b"0100" =>
-	        reg_data_out <= slv_reg4;
-	      when b"0101" =>
-	        reg_data_out <= slv_reg5;
-	      when b"0110" =>
-	        reg_data_out <= slv_reg6;
-	      when b"0111" =>
-	        reg_data_out <= slv_reg7;
-	      when b"1000" =>
-	        --reg_data_out <= slv_reg8;
-	        reg_data_out <= w_channel_free_array(31 downto 0);
-	      when b"1001" =>
-	        --reg_data_out <= slv_reg9;
-	        reg_data_out <= w_channel_free_array(63 downto 32);
-	      when b"1010" =>
-	        --reg_data_out <= slv_reg10;
-	        reg_data_out <= w_channel_free_array(95 downto 64);
-	      when b"1011" =>
-	        --reg_data_out <= slv_reg11;
-	        reg_data_out <= w_channel_free_array(127 downto 96);
-	      when b"1100" =>
-	        reg_data_out <= slv_reg12;
-	      when b"1101" =>
-	        reg_data_out <= slv_reg13;
-	      when b"1110" =>
-	        reg_data_out <= slv_reg14;
-	      when b"1111" =>
-	        reg_data_out <= slv_reg15;
-	      when others =>
-	        reg_data_out  <= (others => '0');
-	    end case;
+	    bank := to_integer(unsigned(axi_araddr(C_S_AXI_ADDR_WIDTH-1 downto c_BANK_ADDR_LSB)));
+	    if bank = c_FREED_BANK then
+	      case loc_addr is
+	        when b"0000" =>
+	          reg_data_out <= r_freed_array(31 downto 0);
+	        when b"0001" =>
+	          reg_data_out <= r_freed_array(63 downto 32);
+	        when b"0010" =>
+	          reg_data_out <= r_freed_array(95 downto 64);
+	        when b"0011" =>
+	          reg_data_out <= r_freed_array(127 downto 96);
+	        when b"0100" =>
+	          reg_data_out <= slv_reg_irq_enable;
+	        when others =>
+	          reg_data_out  <= (others => '0');
+	      end case;
+	    elsif bank /= c_CONTROL_BANK then
+	      reg_data_out  <= (others => '0');
+	    else
+	      case loc_addr is
+	        when b"0000" =>
+	          reg_data_out <= slv_reg0;
+	        when b"0001" =>
+	          reg_data_out <= slv_reg1;
+	        when b"0010" =>
+	          reg_data_out <= slv_reg2;
+	        when b"0011" =>
+	          reg_data_out <= slv_reg3;
+	        when b"0100" =>
+	          reg_data_out <= slv_reg4;
+	        when b"0101" =>
+	          reg_data_out <= slv_reg5;
+	        when b"0110" =>
+	          reg_data_out <= slv_reg6;
+	        when b"0111" =>
+	          reg_data_out <= slv_reg7;
+	        when b"1000" =>
+	          --reg_data_out <= slv_reg8;
+	          reg_data_out <= w_channel_free_array(31 downto 0);
+	        when b"1001" =>
+	          --reg_data_out <= slv_reg9;
+	          reg_data_out <= w_channel_free_array(63 downto 32);
+	        when b"1010" =>
+	          --reg_data_out <= slv_reg10;
+	          reg_data_out <= w_channel_free_array(95 downto 64);
+	        when b"1011" =>
+	          --reg_data_out <= slv_reg11;
+	          reg_data_out <= w_channel_free_array(127 downto 96);
+	        when b"1100" =>
+	          reg_data_out <= slv_reg12;
+	        when b"1101" =>
+	          reg_data_out <= std_logic_vector(resize(unsigned(i_quietest_channel), 7)) & i_quietest_valid & std_logic_vector(resize(unsigned(i_quietest_level), 24));
+	        when b"1110" =>
+	          reg_data_out <= i_fifo_level_status;
+	        when b"1111" =>
+	          reg_data_out <= i_fifo_error_status;
+	        when others =>
+	          reg_data_out  <= (others => '0');
+	      end case;
+	    end if;
 	end process; 
 
 	-- Output register or memory read data
@@ -469,9 +531,48 @@ begin
     o_decay_cw       <= slv_reg5(g_DATA_WIDTH-1 downto 0);
     o_sustain_level  <= slv_reg6(g_DATA_WIDTH-1 downto 0);
     o_release_cw     <= slv_reg7(g_DATA_WIDTH-1 downto 0);
+    o_param_source   <= slv_reg12(3 downto 0);
+    
+    -- a write to the steal register steals the channels on the cycle it is written
+    o_steal_en      <= '1' when slv_reg_wren = '1' and
+                                to_integer(unsigned(axi_awaddr(C_S_AXI_ADDR_WIDTH-1 downto c_BANK_ADDR_LSB))) = c_CONTROL_BANK and
+                                axi_awaddr(ADDR_LSB + OPT_MEM_ADDR_BITS downto ADDR_LSB) = b"1101" else '0';
+    o_steal_channel <= S_AXI_WDATA(25+c_CHANNEL_WIDTH-1 downto 25);
+    o_steal_count   <= S_AXI_WDATA(3 downto 0);
     
     w_channel_free_array <= std_logic_vector(resize(unsigned(i_channel_free_array), w_channel_free_array'length));
     
+    -- a read of a freed register clears the bits it returns, a channel freed
+    -- on the same cycle stays set for the next read
+    process (S_AXI_ACLK)
+    begin
+      if rising_edge(S_AXI_ACLK) then
+        if S_AXI_ARESETN = '0' then
+          r_freed_array     <= (others => '0');
+          r_voice_freed_irq <= '0';
+        else
+          if slv_reg_rden = '1' and
+             to_integer(unsigned(axi_araddr(C_S_AXI_ADDR_WIDTH-1 downto c_BANK_ADDR_LSB))) = c_FREED_BANK then
+            for word in 0 to 3 loop
+              if to_integer(unsigned(axi_araddr(ADDR_LSB + OPT_MEM_ADDR_BITS downto ADDR_LSB))) = word then
+                r_freed_array(word*32+31 downto word*32) <= (others => '0');
+              end if;
+            end loop;
+          end if;
+          if i_freed_en = '1' then
+            r_freed_array(to_integer(unsigned(i_freed_channel))) <= '1';
+          end if;
+          if slv_reg_irq_enable(0) = '1' and unsigned(r_freed_array) /= 0 then
+            r_voice_freed_irq <= '1';
+          else
+            r_voice_freed_irq <= '0';
+          end if;
+        end if;
+      end if;
+    end process;
+    
+    o_voice_freed_irq <= r_voice_freed_irq;
+    
     w_o_note_on_off_reg <= slv_reg3 & slv_reg2 & slv_reg1 & slv_reg0;
     
     o_note_on_off_array <= w_o_note_on_off_reg(o_note_on_off_array'range);
@@ -1,8 +1,13 @@
 library ieee;
 use ieee.std_logic_1164.all;
 
+library work;
+use work.synth_config_package.all;
+
 package adsr_package is   
     constant c_DATA_WIDTH       : integer := 24;  -- width of waveform data outputs  
+    -- release control word of a stolen voice, full scale to zero in 1 ms
+    constant c_STEAL_RELEASE_CW : integer := 2**(c_DATA_WIDTH-1) / (c_SAMPLE_RATE / 1000);
 end package adsr_package;
 
 library ieee;
@@ -11,10 +16,11 @@ use ieee.numeric_std.all;
 
 library work;
 use work.adsr_package.all;
+use work.synth_config_package.all;
 
 entity adsr is
     generic(
-        g_NUM_CHANNELS  : integer := 128;
+        g_NUM_CHANNELS  : integer := c_NUM_CHANNELS;
         g_DATA_WIDTH    : integer := 24
     );
     port(
@@ -27,11 +33,26 @@ entity adsr is
         i_sustain_level         : in  std_logic_vector(g_DATA_WIDTH-1 downto 0);
         i_release_cw            : in  std_logic_vector(g_DATA_WIDTH-1 downto 0);
         o_channel_free_array    : out std_logic_vector(g_NUM_CHANNELS-1 downto 0);
+        o_param_channel         : out std_logic_vector(c_CHANNEL_WIDTH-1 downto 0); -- channel of the parameters on the next cycle
+        -- voice stealing, a steal fades count channels from i_steal_channel out
+        -- with the fast release, they then restart their attack if their note is on
+        i_steal_en              : in  std_logic;
+        i_steal_channel         : in  std_logic_vector(c_CHANNEL_WIDTH-1 downto 0);
+        i_steal_count           : in  std_logic_vector(3 downto 0);
+        -- the quietest sounding channel of the last sample period, released
+        -- channels before held ones and held ones before those still in their
+        -- attack, not valid when none is left to steal
+        o_quietest_valid        : out std_logic;
+        o_quietest_channel      : out std_logic_vector(c_CHANNEL_WIDTH-1 downto 0);
+        o_quietest_level        : out std_logic_vector(g_DATA_WIDTH-1 downto 0);
+        -- a pulse for each channel that reaches off, stolen channels included
+        o_freed_en              : out std_logic;
+        o_freed_channel         : out std_logic_vector(c_CHANNEL_WIDTH-1 downto 0);
         -- envelope
         o_envelope_fifo_wr_en   : out std_logic;
         o_envelope_fifo_wr_data : out std_logic_vector(g_DATA_WIDTH-1 downto 0);
         i_envelope_fifo_full    : in  std_logic;   
-        o_active_channel_count  : out std_logic_vector(6 downto 0)           
+        o_active_channel_count  : out std_logic_vector(c_COUNT_WIDTH-1 downto 0)           
     );
 end adsr;
 
@@ -62,13 +83,33 @@ architecture arch of adsr is
     
     signal r_active_channel_count : integer := 0;
     
+    -- channels being stolen, cleared when they reach off
+    signal r_steal_array  : std_logic_vector(g_NUM_CHANNELS-1 downto 0) := (others => '0');
+    signal r_steal_last   : std_logic;
+    signal w_release_cw   : std_logic_vector(g_DATA_WIDTH-1 downto 0);
+    
+    -- quietest channel so far in the sample period and of the last one, the
+    -- key is the level below the rank of the state, 0 for release, 1 for
+    -- decay and sustain and 2 for attack, so a new note is not the one stolen
+    signal r_quiet_valid        : std_logic := '0';
+    signal r_quiet_key          : unsigned(c_PHASE_WIDTH+1 downto 0) := (others => '0');
+    signal r_quiet_channel      : integer range 0 to g_NUM_CHANNELS-1 := 0;
+    signal r_quietest_valid     : std_logic := '0';
+    signal r_quietest_channel   : integer range 0 to g_NUM_CHANNELS-1 := 0;
+    signal r_quietest_level     : signed(c_PHASE_WIDTH-1 downto 0) := (others => '0');
+    
 begin
-    r_adsr_state_last  <= r_adsr_state_array(r_channel);
+    r_steal_last       <= r_steal_array(r_channel);
+    -- a stolen channel releases with the fast release whatever its state and gate
+    r_adsr_state_last  <= release when r_steal_last = '1' and r_adsr_state_array(r_channel) /= off else
+                          r_adsr_state_array(r_channel);
     r_adsr_phase_last  <= r_adsr_phase_array(r_channel);
     r_note_on_off_last <= i_note_on_off_array(r_channel);
+    w_release_cw       <= std_logic_vector(to_signed(c_STEAL_RELEASE_CW, g_DATA_WIDTH)) when r_steal_last = '1' else
+                          i_release_cw;
 
     -- calculate phase logic
-    process(r_adsr_state_last, r_adsr_phase_last, i_attack_cw, i_decay_cw, i_release_cw)
+    process(r_adsr_state_last, r_adsr_phase_last, i_attack_cw, i_decay_cw, w_release_cw)
     begin
         case r_adsr_state_last is
             when off =>
@@ -80,7 +121,7 @@ begin
             when sustain =>
                 r_adsr_phase_next_temp <= r_adsr_phase_last;
             when release =>
-                r_adsr_phase_next_temp <= r_adsr_phase_last - signed(i_release_cw);
+                r_adsr_phase_next_temp <= r_adsr_phase_last - signed(w_release_cw);
         end case;
     end process;
     
@@ -175,9 +216,14 @@ begin
     
     
     process(i_clk)
+        variable v_key     : unsigned(c_PHASE_WIDTH+1 downto 0);
+        variable v_valid   : std_logic;
+        variable v_channel : integer range 0 to g_NUM_CHANNELS-1;
+        variable v_first   : integer;
     begin
         if rising_edge(i_clk) then
             o_envelope_fifo_wr_en  <= '0';
+            o_freed_en             <= '0';
             
             case r_fsm_state is
                 when idle   =>
@@ -185,6 +231,9 @@ begin
                         r_fsm_state <= output;
                         r_channel <= 0;
                         r_active_channel_count <= 0;
+                        r_quiet_valid <= '0';
+                        r_quiet_key <= (others => '0');
+                        r_quiet_channel <= 0;
                     end if;
                 when output   =>
                     -- update adsr channel with new values
@@ -193,23 +242,77 @@ begin
                     -- output adsr channel value
                     o_envelope_fifo_wr_en   <= '1';
                     o_envelope_fifo_wr_data <= std_logic_vector(r_adsr_phase_next(c_DATA_WIDTH-1 downto 0));
+                    -- the channel is freed when it reaches off
+                    if r_adsr_state_last /= off and r_adsr_state_next = off then
+                        o_freed_en      <= '1';
+                        o_freed_channel <= std_logic_vector(to_unsigned(r_channel, o_freed_channel'length));
+                    end if;
+                    -- a steal ends when the channel is off
+                    if r_adsr_state_last = off or r_adsr_state_next = off then
+                        r_steal_array(r_channel) <= '0';
+                    end if;
+                    -- quietest sounding channel that is not being stolen
+                    v_valid   := r_quiet_valid;
+                    v_key     := r_quiet_key;
+                    v_channel := r_quiet_channel;
+                    if r_adsr_state_next /= off and r_steal_last = '0' then
+                        if r_adsr_state_next = release then
+                            v_key := "00" & unsigned(r_adsr_phase_next);
+                        elsif r_adsr_state_next = attack then
+                            v_key := "10" & unsigned(r_adsr_phase_next);
+                        else
+                            v_key := "01" & unsigned(r_adsr_phase_next);
+                        end if;
+                        if r_quiet_valid = '0' or v_key < r_quiet_key then
+                            v_valid   := '1';
+                            v_channel := r_channel;
+                        else
+                            v_key := r_quiet_key;
+                        end if;
+                    end if;
+                    r_quiet_valid   <= v_valid;
+                    r_quiet_key     <= v_key;
+                    r_quiet_channel <= v_channel;
                     -- next adsr channel
                     if r_channel < g_NUM_CHANNELS-1 then
                         r_fsm_state <= output;
                         r_channel <= r_channel + 1;
                     else
                         r_fsm_state <= idle;
+                        r_quietest_valid   <= v_valid;
+                        r_quietest_channel <= v_channel;
+                        r_quietest_level   <= signed(v_key(c_PHASE_WIDTH-1 downto 0));
                     end if;
                     -- 
                     if r_adsr_state_next /= off then
                         r_active_channel_count <= r_active_channel_count + 1;
                     end if;
             end case;
+            
+            -- mark the stolen channels, after the case so a steal written on the
+            -- cycle of its channel wins over the end of steal clear of that channel
+            if i_steal_en = '1' then
+                v_first := to_integer(unsigned(i_steal_channel));
+                for i in 0 to g_NUM_CHANNELS-1 loop
+                    if i >= v_first and i < v_first + to_integer(unsigned(i_steal_count)) then
+                        r_steal_array(i) <= '1';
+                    end if;
+                end loop;
+            end if;
         end if;
     end process;
     
     o_active_channel_count <= std_logic_vector(to_unsigned(r_active_channel_count, o_active_channel_count'length));
     
+    -- a channel stolen since the sample period is no longer offered
+    o_quietest_valid   <= r_quietest_valid and not r_steal_array(r_quietest_channel);
+    o_quietest_channel <= std_logic_vector(to_unsigned(r_quietest_channel, o_quietest_channel'length));
+    o_quietest_level   <= std_logic_vector(r_quietest_level(g_DATA_WIDTH-1 downto 0));
+    
+    -- per channel parameters are read from RAM a cycle ahead of the channel being processed
+    o_param_channel <= std_logic_vector(to_unsigned(r_channel + 1, o_param_channel'length)) when r_fsm_state = output and r_channel < g_NUM_CHANNELS-1 else
+                       (others => '0');
+    
     process(r_adsr_state_array)
     begin
         for i in 0 to g_NUM_CHANNELS-1 loop
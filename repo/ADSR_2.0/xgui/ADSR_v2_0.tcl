@@ -13,6 +13,14 @@ proc init_gui { IPINST } {
   set_property tooltip {Width of S_AXI address bus} ${C_S_AXI_CTRL_ADDR_WIDTH}
   ipgui::add_param $IPINST -name "C_S_AXI_CTRL_BASEADDR" -parent ${Page_0}
   ipgui::add_param $IPINST -name "C_S_AXI_CTRL_HIGHADDR" -parent ${Page_0}
+  set C_S_AXI_PARAM_ID_WIDTH [ipgui::add_param $IPINST -name "C_S_AXI_PARAM_ID_WIDTH" -parent ${Page_0}]
+  set_property tooltip {Width of ID for for write address, write data, read address and read data} ${C_S_AXI_PARAM_ID_WIDTH}
+  set C_S_AXI_PARAM_DATA_WIDTH [ipgui::add_param $IPINST -name "C_S_AXI_PARAM_DATA_WIDTH" -parent ${Page_0} -widget comboBox]
+  set_property tooltip {Width of S_AXI data bus} ${C_S_AXI_PARAM_DATA_WIDTH}
+  set C_S_AXI_PARAM_ADDR_WIDTH [ipgui::add_param $IPINST -name "C_S_AXI_PARAM_ADDR_WIDTH" -parent ${Page_0}]
+  set_property tooltip {Width of S_AXI address bus} ${C_S_AXI_PARAM_ADDR_WIDTH}
+  ipgui::add_param $IPINST -name "C_S_AXI_PARAM_BASEADDR" -parent ${Page_0}
+  ipgui::add_param $IPINST -name "C_S_AXI_PARAM_HIGHADDR" -parent ${Page_0}
   ipgui::add_param $IPINST -name "g_NUM_CHANNELS" -parent ${Page_0}
 
 
@@ -90,6 +98,51 @@ proc validate_PARAM_VALUE.C_S_AXI_CTRL_HIGHADDR { PARAM_VALUE.C_S_AXI_CTRL_HIGHA
 	return true
 }
 
+proc update_PARAM_VALUE.C_S_AXI_PARAM_ID_WIDTH { PARAM_VALUE.C_S_AXI_PARAM_ID_WIDTH } {
+	# Procedure called to update C_S_AXI_PARAM_ID_WIDTH when any of the dependent parameters in the arguments change
+}
+
+proc validate_PARAM_VALUE.C_S_AXI_PARAM_ID_WIDTH { PARAM_VALUE.C_S_AXI_PARAM_ID_WIDTH } {
+	# Procedure called to validate C_S_AXI_PARAM_ID_WIDTH
+	return true
+}
+
+proc update_PARAM_VALUE.C_S_AXI_PARAM_DATA_WIDTH { PARAM_VALUE.C_S_AXI_PARAM_DATA_WIDTH } {
+	# Procedure called to update C_S_AXI_PARAM_DATA_WIDTH when any of the dependent parameters in the arguments change
+}
+
+proc validate_PARAM_VALUE.C_S_AXI_PARAM_DATA_WIDTH { PARAM_VALUE.C_S_AXI_PARAM_DATA_WIDTH } {
+	# Procedure called to validate C_S_AXI_PARAM_DATA_WIDTH
+	return true
+}
+
+proc update_PARAM_VALUE.C_S_AXI_PARAM_ADDR_WIDTH { PARAM_VALUE.C_S_AXI_PARAM_ADDR_WIDTH } {
+	# Procedure called to update C_S_AXI_PARAM_ADDR_WIDTH when any of the dependent parameters in the arguments change
+}
+
+proc validate_PARAM_VALUE.C_S_AXI_PARAM_ADDR_WIDTH { PARAM_VALUE.C_S_AXI_PARAM_ADDR_WIDTH } {
+	# Procedure called to validate C_S_AXI_PARAM_ADDR_WIDTH
+	return true
+}
+
+proc update_PARAM_VALUE.C_S_AXI_PARAM_BASEADDR { PARAM_VALUE.C_S_AXI_PARAM_BASEADDR } {
+	# Procedure called to update C_S_AXI_PARAM_BASEADDR when any of the dependent parameters in the arguments change
+}
+
+proc validate_PARAM_VALUE.C_S_AXI_PARAM_BASEADDR { PARAM_VALUE.C_S_AXI_PARAM_BASEADDR } {
+	# Procedure called to validate C_S_AXI_PARAM_BASEADDR
+	return true
+}
+
+proc update_PARAM_VALUE.C_S_AXI_PARAM_HIGHADDR { PARAM_VALUE.C_S_AXI_PARAM_HIGHADDR } {
+	# Procedure called to update C_S_AXI_PARAM_HIGHADDR when any of the dependent parameters in the arguments change
+}
+
+proc validate_PARAM_VALUE.C_S_AXI_PARAM_HIGHADDR { PARAM_VALUE.C_S_AXI_PARAM_HIGHADDR } {
+	# Procedure called to validate C_S_AXI_PARAM_HIGHADDR
+	return true
+}
+
 
 proc update_MODELPARAM_VALUE.C_M_AXIS_OUTPUT_TDATA_WIDTH { MODELPARAM_VALUE.C_M_AXIS_OUTPUT_TDATA_WIDTH PARAM_VALUE.C_M_AXIS_OUTPUT_TDATA_WIDTH } {
 	# Procedure called to set VHDL generic/Verilog parameter value(s) based on TCL parameter value
@@ -111,6 +164,21 @@ proc update_MODELPARAM_VALUE.C_S_AXI_CTRL_ADDR_WIDTH { MODELPARAM_VALUE.C_S_AXI_
 	set_property value [get_property value ${PARAM_VALUE.C_S_AXI_CTRL_ADDR_WIDTH}] ${MODELPARAM_VALUE.C_S_AXI_CTRL_ADDR_WIDTH}
 }
 
+proc update_MODELPARAM_VALUE.C_S_AXI_PARAM_ID_WIDTH { MODELPARAM_VALUE.C_S_AXI_PARAM_ID_WIDTH PARAM_VALUE.C_S_AXI_PARAM_ID_WIDTH } {
+	# Procedure called to set VHDL generic/Verilog parameter value(s) based on TCL parameter value
+	set_property value [get_property value ${PARAM_VALUE.C_S_AXI_PARAM_ID_WIDTH}] ${MODELPARAM_VALUE.C_S_AXI_PARAM_ID_WIDTH}
+}
+
+proc update_MODELPARAM_VALUE.C_S_AXI_PARAM_DATA_WIDTH { MODELPARAM_VALUE.C_S_AXI_PARAM_DATA_WIDTH PARAM_VALUE.C_S_AXI_PARAM_DATA_WIDTH } {
+	# Procedure called to set VHDL generic/Verilog parameter value(s) based on TCL parameter value
+	set_property value [get_property value ${PARAM_VALUE.C_S_AXI_PARAM_DATA_WIDTH}] ${MODELPARAM_VALUE.C_S_AXI_PARAM_DATA_WIDTH}
+}
+
+proc update_MODELPARAM_VALUE.C_S_AXI_PARAM_ADDR_WIDTH { MODELPARAM_VALUE.C_S_AXI_PARAM_ADDR_WIDTH PARAM_VALUE.C_S_AXI_PARAM_ADDR_WIDTH } {
+	# Procedure called to set VHDL generic/Verilog parameter value(s) based on TCL parameter value
+	set_property value [get_property value ${PARAM_VALUE.C_S_AXI_PARAM_ADDR_WIDTH}] ${MODELPARAM_VALUE.C_S_AXI_PARAM_ADDR_WIDTH}
+}
+
 proc update_MODELPARAM_VALUE.g_NUM_CHANNELS { MODELPARAM_VALUE.g_NUM_CHANNELS PARAM_VALUE.g_NUM_CHANNELS } {
 	# Procedure called to set VHDL generic/Verilog parameter value(s) based on TCL parameter value
 	set_property value [get_property value ${PARAM_VALUE.g_NUM_CHANNELS}] ${MODELPARAM_VALUE.g_NUM_CHANNELS}
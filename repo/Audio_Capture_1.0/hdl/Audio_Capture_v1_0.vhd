@@ -0,0 +1,233 @@
+library ieee;
+use ieee.std_logic_1164.all;
+use ieee.numeric_std.all;
+use work.synth_config_package.all;
+
+entity Audio_Capture_v1_0 is
+	generic (
+		-- Users to add parameters here
+        g_DATA_WIDTH : integer := 24;
+        g_FIFO_DEPTH : integer := 64;
+		-- User parameters ends
+		-- Do not modify the parameters beyond this line
+
+		-- Parameters of Axi Slave Bus Interface S_AXI_CTRL
+		C_S_AXI_CTRL_DATA_WIDTH	: integer	:= 32;
+		C_S_AXI_CTRL_ADDR_WIDTH	: integer	:= 6;
+
+		-- Parameters of Axi Master Bus Interface M_AXI
+		C_M_AXI_BURST_LEN	: integer	:= 16;
+		C_M_AXI_ID_WIDTH	: integer	:= 1;
+		C_M_AXI_ADDR_WIDTH	: integer	:= 32;
+		C_M_AXI_DATA_WIDTH	: integer	:= 32
+	);
+	port (
+		-- Users to add ports here
+        -- mixer output tap
+        i_sample_valid : in std_logic;
+        i_mix_sample   : in std_logic_vector(g_DATA_WIDTH-1 downto 0);
+        i_voice_sample : in std_logic_vector(g_DATA_WIDTH-1 downto 0);
+        o_voice_select : out std_logic_vector(c_CHANNEL_WIDTH-1 downto 0);
+		-- User ports ends
+		-- Do not modify the ports beyond this line
+
+		-- Ports of Axi Slave Bus Interface S_AXI_CTRL
+		s_axi_ctrl_aclk	: in std_logic;
+		s_axi_ctrl_aresetn	: in std_logic;
+		s_axi_ctrl_awaddr	: in std_logic_vector(C_S_AXI_CTRL_ADDR_WIDTH-1 downto 0);
+		s_axi_ctrl_awprot	: in std_logic_vector(2 downto 0);
+		s_axi_ctrl_awvalid	: in std_logic;
+		s_axi_ctrl_awready	: out std_logic;
+		s_axi_ctrl_wdata	: in std_logic_vector(C_S_AXI_CTRL_DATA_WIDTH-1 downto 0);
+		s_axi_ctrl_wstrb	: in std_logic_vector((C_S_AXI_CTRL_DATA_WIDTH/8)-1 downto 0);
+		s_axi_ctrl_wvalid	: in std_logic;
+		s_axi_ctrl_wready	: out std_logic;
+		s_axi_ctrl_bresp	: out std_logic_vector(1 downto 0);
+		s_axi_ctrl_bvalid	: out std_logic;
+		s_axi_ctrl_bready	: in std_logic;
+		s_axi_ctrl_araddr	: in std_logic_vector(C_S_AXI_CTRL_ADDR_WIDTH-1 downto 0);
+		s_axi_ctrl_arprot	: in std_logic_vector(2 downto 0);
+		s_axi_ctrl_arvalid	: in std_logic;
+		s_axi_ctrl_arready	: out std_logic;
+		s_axi_ctrl_rdata	: out std_logic_vector(C_S_AXI_CTRL_DATA_WIDTH-1 downto 0);
+		s_axi_ctrl_rresp	: out std_logic_vector(1 downto 0);
+		s_axi_ctrl_rvalid	: out std_logic;
+		s_axi_ctrl_rready	: in std_logic;
+
+		-- Ports of Axi Master Bus Interface M_AXI
+		m_axi_aclk	: in std_logic;
+		m_axi_aresetn	: in std_logic;
+		m_axi_awid	: out std_logic_vector(C_M_AXI_ID_WIDTH-1 downto 0);
+		m_axi_awaddr	: out std_logic_vector(C_M_AXI_ADDR_WIDTH-1 downto 0);
+		m_axi_awlen	: out std_logic_vector(7 downto 0);
+		m_axi_awsize	: out std_logic_vector(2 downto 0);
+		m_axi_awburst	: out std_logic_vector(1 downto 0);
+		m_axi_awlock	: out std_logic;
+		m_axi_awcache	: out std_logic_vector(3 downto 0);
+		m_axi_awprot	: out std_logic_vector(2 downto 0);
+		m_axi_awqos	: out std_logic_vector(3 downto 0);
+		m_axi_awvalid	: out std_logic;
+		m_axi_awready	: in std_logic;
+		m_axi_wdata	: out std_logic_vector(C_M_AXI_DATA_WIDTH-1 downto 0);
+		m_axi_wstrb	: out std_logic_vector(C_M_AXI_DATA_WIDTH/8-1 downto 0);
+		m_axi_wlast	: out std_logic;
+		m_axi_wvalid	: out std_logic;
+		m_axi_wready	: in std_logic;
+		m_axi_bid	: in std_logic_vector(C_M_AXI_ID_WIDTH-1 downto 0);
+		m_axi_bresp	: in std_logic_vector(1 downto 0);
+		m_axi_bvalid	: in std_logic;
+		m_axi_bready	: out std_logic
+	);
+end Audio_Capture_v1_0;
+
+architecture arch_imp of Audio_Capture_v1_0 is
+
+    -- burst master signals
+    signal w_burst_start : std_logic;
+    signal w_burst_addr  : std_logic_vector(C_M_AXI_ADDR_WIDTH-1 downto 0);
+    signal w_burst_rd_en : std_logic;
+    signal w_burst_data  : std_logic_vector(C_M_AXI_DATA_WIDTH-1 downto 0);
+    signal w_burst_busy  : std_logic;
+    signal w_burst_done  : std_logic;
+    signal w_burst_error : std_logic;
+
+    -- control signals
+    signal w_enable      : std_logic;
+    signal w_source      : std_logic;
+    signal w_buffer_base : std_logic_vector(31 downto 0);
+    signal w_buffer_size : std_logic_vector(31 downto 0);
+    signal w_tail        : std_logic_vector(31 downto 0);
+    signal w_error_clear : std_logic;
+    signal w_reset       : std_logic;
+
+    -- status signals
+    signal w_head              : std_logic_vector(31 downto 0);
+    signal w_sample_count      : std_logic_vector(31 downto 0);
+    signal w_error_count       : std_logic_vector(31 downto 0);
+    signal w_fifo_level_status : std_logic_vector(31 downto 0);
+    signal w_fifo_error_status : std_logic_vector(31 downto 0);
+
+begin
+
+    -- Instantiation of Axi Bus Interface S_AXI_CTRL
+    Audio_Capture_v1_0_S_AXI_CTRL_inst : entity work.Audio_Capture_v1_0_S_AXI_CTRL
+	generic map (
+		C_S_AXI_DATA_WIDTH	=> C_S_AXI_CTRL_DATA_WIDTH,
+		C_S_AXI_ADDR_WIDTH	=> C_S_AXI_CTRL_ADDR_WIDTH
+	)
+	port map (
+	    o_enable            => w_enable,
+	    o_source            => w_source,
+	    o_voice_select      => o_voice_select,
+	    o_buffer_base       => w_buffer_base,
+	    o_buffer_size       => w_buffer_size,
+	    o_tail              => w_tail,
+	    i_head              => w_head,
+	    i_sample_count      => w_sample_count,
+	    o_error_clear       => w_error_clear,
+	    i_error_count       => w_error_count,
+	    i_fifo_level_status => w_fifo_level_status,
+	    i_fifo_error_status => w_fifo_error_status,
+		S_AXI_ACLK	=> s_axi_ctrl_aclk,
+		S_AXI_ARESETN	=> s_axi_ctrl_aresetn,
+		S_AXI_AWADDR	=> s_axi_ctrl_awaddr,
+		S_AXI_AWPROT	=> s_axi_ctrl_awprot,
+		S_AXI_AWVALID	=> s_axi_ctrl_awvalid,
+		S_AXI_AWREADY	=> s_axi_ctrl_awready,
+		S_AXI_WDATA	=> s_axi_ctrl_wdata,
+		S_AXI_WSTRB	=> s_axi_ctrl_wstrb,
+		S_AXI_WVALID	=> s_axi_ctrl_wvalid,
+		S_AXI_WREADY	=> s_axi_ctrl_wready,
+		S_AXI_BRESP	=> s_axi_ctrl_bresp,
+		S_AXI_BVALID	=> s_axi_ctrl_bvalid,
+		S_AXI_BREADY	=> s_axi_ctrl_bready,
+		S_AXI_ARADDR	=> s_axi_ctrl_araddr,
+		S_AXI_ARPROT	=> s_axi_ctrl_arprot,
+		S_AXI_ARVALID	=> s_axi_ctrl_arvalid,
+		S_AXI_ARREADY	=> s_axi_ctrl_arready,
+		S_AXI_RDATA	=> s_axi_ctrl_rdata,
+		S_AXI_RRESP	=> s_axi_ctrl_rresp,
+		S_AXI_RVALID	=> s_axi_ctrl_rvalid,
+		S_AXI_RREADY	=> s_axi_ctrl_rready
+	);
+
+    -- Instantiation of Axi Bus Interface M_AXI
+    Audio_Capture_v1_0_M_AXI_inst : entity work.Audio_Capture_v1_0_M_AXI
+	generic map (
+		C_M_AXI_BURST_LEN	=> C_M_AXI_BURST_LEN,
+		C_M_AXI_ID_WIDTH	=> C_M_AXI_ID_WIDTH,
+		C_M_AXI_ADDR_WIDTH	=> C_M_AXI_ADDR_WIDTH,
+		C_M_AXI_DATA_WIDTH	=> C_M_AXI_DATA_WIDTH
+	)
+	port map (
+	    -- burst request interface
+	    i_burst_start => w_burst_start,
+	    i_burst_addr  => w_burst_addr,
+	    o_burst_rd_en => w_burst_rd_en,
+	    i_burst_data  => w_burst_data,
+	    o_burst_busy  => w_burst_busy,
+	    o_burst_done  => w_burst_done,
+	    o_burst_error => w_burst_error,
+	    -- axi full master
+		M_AXI_ACLK	=> m_axi_aclk,
+		M_AXI_ARESETN	=> m_axi_aresetn,
+		M_AXI_AWID	=> m_axi_awid,
+		M_AXI_AWADDR	=> m_axi_awaddr,
+		M_AXI_AWLEN	=> m_axi_awlen,
+		M_AXI_AWSIZE	=> m_axi_awsize,
+		M_AXI_AWBURST	=> m_axi_awburst,
+		M_AXI_AWLOCK	=> m_axi_awlock,
+		M_AXI_AWCACHE	=> m_axi_awcache,
+		M_AXI_AWPROT	=> m_axi_awprot,
+		M_AXI_AWQOS	=> m_axi_awqos,
+		M_AXI_AWVALID	=> m_axi_awvalid,
+		M_AXI_AWREADY	=> m_axi_awready,
+		M_AXI_WDATA	=> m_axi_wdata,
+		M_AXI_WSTRB	=> m_axi_wstrb,
+		M_AXI_WLAST	=> m_axi_wlast,
+		M_AXI_WVALID	=> m_axi_wvalid,
+		M_AXI_WREADY	=> m_axi_wready,
+		M_AXI_BID	=> m_axi_bid,
+		M_AXI_BRESP	=> m_axi_bresp,
+		M_AXI_BVALID	=> m_axi_bvalid,
+		M_AXI_BREADY	=> m_axi_bready
+	);
+
+	-- Add user logic here
+    w_reset <= not m_axi_aresetn;
+
+    -- Instantiation of the capture buffer control
+    audio_capture_unit : entity work.audio_capture
+    generic map(
+        g_DATA_WIDTH => g_DATA_WIDTH,
+        g_FIFO_DEPTH => g_FIFO_DEPTH,
+        g_BURST_LEN  => C_M_AXI_BURST_LEN
+    )
+    port map(
+        i_clk               => m_axi_aclk,
+        i_reset             => w_reset,
+        i_sample_valid      => i_sample_valid,
+        i_mix_sample        => i_mix_sample,
+        i_voice_sample      => i_voice_sample,
+        i_enable            => w_enable,
+        i_source            => w_source,
+        i_buffer_base       => w_buffer_base,
+        i_buffer_size       => w_buffer_size,
+        i_tail              => w_tail,
+        i_error_clear       => w_error_clear,
+        o_head              => w_head,
+        o_sample_count      => w_sample_count,
+        o_error_count       => w_error_count,
+        o_fifo_level_status => w_fifo_level_status,
+        o_fifo_error_status => w_fifo_error_status,
+        o_burst_start       => w_burst_start,
+        o_burst_addr        => w_burst_addr,
+        i_burst_rd_en       => w_burst_rd_en,
+        o_burst_data        => w_burst_data,
+        i_burst_busy        => w_burst_busy,
+        i_burst_done        => w_burst_done,
+        i_burst_error       => w_burst_error
+    );
+	-- User logic ends
+
+end arch_imp;
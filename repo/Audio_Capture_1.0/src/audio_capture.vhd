@@ -0,0 +1,209 @@
+-- Audio Capture
+-- Description:
+-- Records the mixer output, or the output of one voice, to a circular buffer
+-- in DDR so the audio can be streamed out or analysed by the firmware in
+-- place. Samples are sign extended to 32 bits, collected in a FIFO and
+-- written in bursts of g_BURST_LEN samples by the AXI4 write master.
+--
+-- The buffer is described by its base address and size in bytes, both
+-- multiples of the burst size. The head is the byte offset of the next
+-- burst and is advanced by the capture, the tail is the byte offset of the
+-- first sample not yet consumed and is advanced by the firmware. The buffer
+-- is empty when head = tail, a burst is only written when it leaves at least
+-- one burst free so the head never catches up with the tail. When the buffer
+-- is full the samples are held in the FIFO, once the FIFO is full new samples
+-- are dropped and counted by the FIFO overflow count.
+--
+-- Enabling the capture restarts it at offset 0 of the buffer, samples left in
+-- the FIFO when it is disabled are discarded.
+--
+-- Inputs:
+-- i_clk: system clk
+-- i_sample_valid: new mix/voice sample
+-- i_mix_sample/i_voice_sample: mixer output/output of the selected voice
+-- i_enable/i_source: capture enable/source (0: mix, 1: voice)
+-- i_buffer_base/i_buffer_size/i_tail: circular buffer in DDR
+-- burst master data read/busy/done/error
+--
+-- Outputs:
+-- o_head: byte offset of the next burst
+-- o_sample_count: samples captured since enabled
+-- o_error_count: bursts with an error response since cleared
+-- o_burst_start/o_burst_addr: burst request to the AXI4 write master
+
+library ieee;
+use ieee.std_logic_1164.all;
+use ieee.numeric_std.all;
+
+entity audio_capture is
+    generic(
+        g_DATA_WIDTH  : integer := 24;
+        g_FIFO_DEPTH  : integer := 64;
+        g_BURST_LEN   : integer := 16
+    );
+    port(
+        i_clk               : in std_logic;
+        i_reset             : in std_logic;
+        -- sample input
+        i_sample_valid      : in std_logic;
+        i_mix_sample        : in std_logic_vector(g_DATA_WIDTH-1 downto 0);
+        i_voice_sample      : in std_logic_vector(g_DATA_WIDTH-1 downto 0);
+        -- control
+        i_enable            : in std_logic;
+        i_source            : in std_logic;
+        i_buffer_base       : in std_logic_vector(31 downto 0);
+        i_buffer_size       : in std_logic_vector(31 downto 0);
+        i_tail              : in std_logic_vector(31 downto 0);
+        i_error_clear       : in std_logic;
+        -- status
+        o_head              : out std_logic_vector(31 downto 0);
+        o_sample_count      : out std_logic_vector(31 downto 0);
+        o_error_count       : out std_logic_vector(31 downto 0);
+        o_fifo_level_status : out std_logic_vector(31 downto 0);
+        o_fifo_error_status : out std_logic_vector(31 downto 0);
+        -- burst master interface
+        o_burst_start       : out std_logic;
+        o_burst_addr        : out std_logic_vector(31 downto 0);
+        i_burst_rd_en       : in std_logic;
+        o_burst_data        : out std_logic_vector(31 downto 0);
+        i_burst_busy        : in std_logic;
+        i_burst_done        : in std_logic;
+        i_burst_error       : in std_logic
+    );
+end audio_capture;
+
+architecture arch of audio_capture is
+
+    constant c_BURST_BYTES : integer := g_BURST_LEN*4;
+    constant c_MAX_COUNT   : integer := 2**16-1;
+
+    type t_state is (idle, burst);
+    signal r_state : t_state := idle;
+
+    signal r_enable : std_logic := '0';
+
+    signal r_head         : unsigned(31 downto 0) := (others => '0');
+    signal r_burst_start  : std_logic := '0';
+    signal r_burst_addr   : unsigned(31 downto 0) := (others => '0');
+    signal r_sample_count : unsigned(31 downto 0) := (others => '0');
+    signal r_error_count  : integer range 0 to c_MAX_COUNT := 0;
+
+    signal w_used  : unsigned(31 downto 0);
+    signal w_space : std_logic;
+
+    -- FIFO signals
+    signal w_fifo_wr_en   : std_logic;
+    signal w_fifo_wr_data : std_logic_vector(31 downto 0);
+    signal w_fifo_full    : std_logic;
+    signal w_fifo_rd_en   : std_logic;
+    signal w_fifo_empty   : std_logic;
+    signal w_fifo_level   : std_logic_vector(15 downto 0);
+    signal w_fifo_discard : std_logic;
+
+begin
+
+    -- sample input, sign extended to the 32 bit buffer words
+    w_fifo_wr_en   <= i_sample_valid and i_enable;
+    w_fifo_wr_data <= std_logic_vector(resize(signed(i_voice_sample), 32)) when i_source = '1' else
+                      std_logic_vector(resize(signed(i_mix_sample), 32));
+
+    -- samples left when the capture is disabled are discarded
+    w_fifo_discard <= '1' when i_enable = '0' and r_state = idle and w_fifo_empty = '0' else '0';
+    w_fifo_rd_en   <= i_burst_rd_en or w_fifo_discard;
+
+    fifo_unit : entity work.fifo
+    generic map(
+        g_WIDTH       => 32,
+        g_DEPTH       => g_FIFO_DEPTH,
+        g_MEMORY_TYPE => "distributed"
+    )
+    port map(
+        i_clk       => i_clk,
+        i_reset     => i_reset,
+        -- FIFO write interface
+        i_wr_en     => w_fifo_wr_en,
+        i_wr_data   => w_fifo_wr_data,
+        o_full      => w_fifo_full,
+        -- FIFO read interface
+        i_rd_en     => w_fifo_rd_en,
+        o_rd_data   => o_burst_data,
+        o_empty     => w_fifo_empty,
+        -- FIFO status
+        o_level           => w_fifo_level,
+        o_high_watermark  => o_fifo_level_status(31 downto 16),
+        o_overflow_count  => o_fifo_error_status(15 downto 0),
+        o_underflow_count => o_fifo_error_status(31 downto 16)
+    );
+
+    o_fifo_level_status(15 downto 0) <= w_fifo_level;
+
+    -- buffer occupancy, a burst must leave at least one burst free
+    w_used  <= r_head - unsigned(i_tail) when r_head >= unsigned(i_tail) else
+               r_head + unsigned(i_buffer_size) - unsigned(i_tail);
+    w_space <= '1' when w_used + c_BURST_BYTES < unsigned(i_buffer_size) else '0';
+
+    process(i_clk)
+    begin
+        if rising_edge(i_clk) then
+            if i_reset = '1' then
+                r_state        <= idle;
+                r_enable       <= '0';
+                r_head         <= (others => '0');
+                r_burst_start  <= '0';
+                r_burst_addr   <= (others => '0');
+                r_sample_count <= (others => '0');
+            else
+                r_enable      <= i_enable;
+                r_burst_start <= '0';
+
+                if i_enable = '1' and r_enable = '0' then
+                    r_sample_count <= (others => '0');
+                elsif w_fifo_wr_en = '1' and w_fifo_full = '0' then
+                    r_sample_count <= r_sample_count + 1;
+                end if;
+
+                case r_state is
+                    when idle =>
+                        if i_enable = '1' and r_enable = '0' then
+                            -- new capture, restart at the beginning of the buffer
+                            r_head <= (others => '0');
+                        elsif i_enable = '1' and i_burst_busy = '0' and w_space = '1' and
+                              unsigned(w_fifo_level) >= g_BURST_LEN then
+                            r_burst_start <= '1';
+                            r_burst_addr  <= unsigned(i_buffer_base) + r_head;
+                            r_state       <= burst;
+                        end if;
+
+                    when burst =>
+                        if i_burst_done = '1' then
+                            r_state <= idle;
+                            if r_head + c_BURST_BYTES >= unsigned(i_buffer_size) then
+                                r_head <= (others => '0');
+                            else
+                                r_head <= r_head + c_BURST_BYTES;
+                            end if;
+                        end if;
+                end case;
+            end if;
+        end if;
+    end process;
+
+    -- write error counter, saturates until cleared
+    process(i_clk)
+    begin
+        if rising_edge(i_clk) then
+            if i_reset = '1' or i_error_clear = '1' then
+                r_error_count <= 0;
+            elsif i_burst_done = '1' and i_burst_error = '1' and r_error_count /= c_MAX_COUNT then
+                r_error_count <= r_error_count + 1;
+            end if;
+        end if;
+    end process;
+
+    o_head         <= std_logic_vector(r_head);
+    o_sample_count <= std_logic_vector(r_sample_count);
+    o_error_count  <= std_logic_vector(to_unsigned(r_error_count, 32));
+    o_burst_start  <= r_burst_start;
+    o_burst_addr   <= std_logic_vector(r_burst_addr);
+
+end arch;
@@ -0,0 +1,308 @@
+library ieee;
+use ieee.std_logic_1164.all;
+use ieee.numeric_std.all;
+
+entity Effects_v1_0 is
+	generic (
+		-- Users to add parameters here
+        g_DATA_WIDTH : integer := 24;
+        g_NUM_TAPS   : integer := 4;
+        g_FIFO_DEPTH : integer := 64;
+		-- User parameters ends
+		-- Do not modify the parameters beyond this line
+
+		-- Parameters of Axi Slave Bus Interface S_AXI_CTRL
+		C_S_AXI_CTRL_DATA_WIDTH	: integer	:= 32;
+		C_S_AXI_CTRL_ADDR_WIDTH	: integer	:= 8;
+
+		-- Parameters of Axi Master Bus Interface M_AXI
+		C_M_AXI_BURST_LEN	: integer	:= 16;
+		C_M_AXI_ID_WIDTH	: integer	:= 1;
+		C_M_AXI_ADDR_WIDTH	: integer	:= 32;
+		C_M_AXI_DATA_WIDTH	: integer	:= 32
+	);
+	port (
+		-- Users to add ports here
+        -- mixer output
+        i_sample_valid : in std_logic;
+        i_left         : in std_logic_vector(g_DATA_WIDTH-1 downto 0);
+        i_right        : in std_logic_vector(g_DATA_WIDTH-1 downto 0);
+        -- effect output to the I2S transmitter
+        o_left         : out std_logic_vector(g_DATA_WIDTH-1 downto 0);
+        o_right        : out std_logic_vector(g_DATA_WIDTH-1 downto 0);
+		-- User ports ends
+		-- Do not modify the ports beyond this line
+
+		-- Ports of Axi Slave Bus Interface S_AXI_CTRL
+		s_axi_ctrl_aclk	: in std_logic;
+		s_axi_ctrl_aresetn	: in std_logic;
+		s_axi_ctrl_awaddr	: in std_logic_vector(C_S_AXI_CTRL_ADDR_WIDTH-1 downto 0);
+		s_axi_ctrl_awprot	: in std_logic_vector(2 downto 0);
+		s_axi_ctrl_awvalid	: in std_logic;
+		s_axi_ctrl_awready	: out std_logic;
+		s_axi_ctrl_wdata	: in std_logic_vector(C_S_AXI_CTRL_DATA_WIDTH-1 downto 0);
+		s_axi_ctrl_wstrb	: in std_logic_vector((C_S_AXI_CTRL_DATA_WIDTH/8)-1 downto 0);
+		s_axi_ctrl_wvalid	: in std_logic;
+		s_axi_ctrl_wready	: out std_logic;
+		s_axi_ctrl_bresp	: out std_logic_vector(1 downto 0);
+		s_axi_ctrl_bvalid	: out std_logic;
+		s_axi_ctrl_bready	: in std_logic;
+		s_axi_ctrl_araddr	: in std_logic_vector(C_S_AXI_CTRL_ADDR_WIDTH-1 downto 0);
+		s_axi_ctrl_arprot	: in std_logic_vector(2 downto 0);
+		s_axi_ctrl_arvalid	: in std_logic;
+		s_axi_ctrl_arready	: out std_logic;
+		s_axi_ctrl_rdata	: out std_logic_vector(C_S_AXI_CTRL_DATA_WIDTH-1 downto 0);
+		s_axi_ctrl_rresp	: out std_logic_vector(1 downto 0);
+		s_axi_ctrl_rvalid	: out std_logic;
+		s_axi_ctrl_rready	: in std_logic;
+
+		-- Ports of Axi Master Bus Interface M_AXI
+		m_axi_aclk	: in std_logic;
+		m_axi_aresetn	: in std_logic;
+		m_axi_awid	: out std_logic_vector(C_M_AXI_ID_WIDTH-1 downto 0);
+		m_axi_awaddr	: out std_logic_vector(C_M_AXI_ADDR_WIDTH-1 downto 0);
+		m_axi_awlen	: out std_logic_vector(7 downto 0);
+		m_axi_awsize	: out std_logic_vector(2 downto 0);
+		m_axi_awburst	: out std_logic_vector(1 downto 0);
+		m_axi_awlock	: out std_logic;
+		m_axi_awcache	: out std_logic_vector(3 downto 0);
+		m_axi_awprot	: out std_logic_vector(2 downto 0);
+		m_axi_awqos	: out std_logic_vector(3 downto 0);
+		m_axi_awvalid	: out std_logic;
+		m_axi_awready	: in std_logic;
+		m_axi_wdata	: out std_logic_vector(C_M_AXI_DATA_WIDTH-1 downto 0);
+		m_axi_wstrb	: out std_logic_vector(C_M_AXI_DATA_WIDTH/8-1 downto 0);
+		m_axi_wlast	: out std_logic;
+		m_axi_wvalid	: out std_logic;
+		m_axi_wready	: in std_logic;
+		m_axi_bid	: in std_logic_vector(C_M_AXI_ID_WIDTH-1 downto 0);
+		m_axi_bresp	: in std_logic_vector(1 downto 0);
+		m_axi_bvalid	: in std_logic;
+		m_axi_bready	: out std_logic;
+		m_axi_arid	: out std_logic_vector(C_M_AXI_ID_WIDTH-1 downto 0);
+		m_axi_araddr	: out std_logic_vector(C_M_AXI_ADDR_WIDTH-1 downto 0);
+		m_axi_arlen	: out std_logic_vector(7 downto 0);
+		m_axi_arsize	: out std_logic_vector(2 downto 0);
+		m_axi_arburst	: out std_logic_vector(1 downto 0);
+		m_axi_arlock	: out std_logic;
+		m_axi_arcache	: out std_logic_vector(3 downto 0);
+		m_axi_arprot	: out std_logic_vector(2 downto 0);
+		m_axi_arqos	: out std_logic_vector(3 downto 0);
+		m_axi_arvalid	: out std_logic;
+		m_axi_arready	: in std_logic;
+		m_axi_rid	: in std_logic_vector(C_M_AXI_ID_WIDTH-1 downto 0);
+		m_axi_rdata	: in std_logic_vector(C_M_AXI_DATA_WIDTH-1 downto 0);
+		m_axi_rresp	: in std_logic_vector(1 downto 0);
+		m_axi_rlast	: in std_logic;
+		m_axi_rvalid	: in std_logic;
+		m_axi_rready	: out std_logic
+	);
+end Effects_v1_0;
+
+architecture arch_imp of Effects_v1_0 is
+
+    -- burst master signals
+    signal w_write_start : std_logic;
+    signal w_write_addr  : std_logic_vector(C_M_AXI_ADDR_WIDTH-1 downto 0);
+    signal w_write_rd_en : std_logic;
+    signal w_write_data  : std_logic_vector(C_M_AXI_DATA_WIDTH-1 downto 0);
+    signal w_write_busy  : std_logic;
+    signal w_write_done  : std_logic;
+    signal w_write_error : std_logic;
+    signal w_read_start  : std_logic;
+    signal w_read_addr   : std_logic_vector(C_M_AXI_ADDR_WIDTH-1 downto 0);
+    signal w_read_valid  : std_logic;
+    signal w_read_data   : std_logic_vector(C_M_AXI_DATA_WIDTH-1 downto 0);
+    signal w_read_busy   : std_logic;
+    signal w_read_done   : std_logic;
+    signal w_read_error  : std_logic;
+
+    -- control signals
+    signal w_enable            : std_logic;
+    signal w_buffer_base       : std_logic_vector(31 downto 0);
+    signal w_buffer_size       : std_logic_vector(31 downto 0);
+    signal w_dry_level         : std_logic_vector(15 downto 0);
+    signal w_tap_delay         : std_logic_vector(4*24-1 downto 0);
+    signal w_tap_level         : std_logic_vector(4*16-1 downto 0);
+    signal w_tap_feedback      : std_logic_vector(4*16-1 downto 0);
+    signal w_fifo_select       : std_logic_vector(2 downto 0);
+    signal w_flow_status_clear : std_logic;
+    signal w_error_clear       : std_logic;
+    signal w_reset             : std_logic;
+
+    -- status signals
+    signal w_flow_status       : std_logic_vector(31 downto 0);
+    signal w_write_burst_count : std_logic_vector(31 downto 0);
+    signal w_read_burst_count  : std_logic_vector(31 downto 0);
+    signal w_error_count       : std_logic_vector(31 downto 0);
+    signal w_fifo_level_status : std_logic_vector(31 downto 0);
+    signal w_fifo_error_status : std_logic_vector(31 downto 0);
+
+begin
+
+    -- Instantiation of Axi Bus Interface S_AXI_CTRL
+    Effects_v1_0_S_AXI_CTRL_inst : entity work.Effects_v1_0_S_AXI_CTRL
+	generic map (
+		C_S_AXI_DATA_WIDTH	=> C_S_AXI_CTRL_DATA_WIDTH,
+		C_S_AXI_ADDR_WIDTH	=> C_S_AXI_CTRL_ADDR_WIDTH
+	)
+	port map (
+	    o_enable            => w_enable,
+	    o_buffer_base       => w_buffer_base,
+	    o_buffer_size       => w_buffer_size,
+	    o_dry_level         => w_dry_level,
+	    o_tap_delay         => w_tap_delay,
+	    o_tap_level         => w_tap_level,
+	    o_tap_feedback      => w_tap_feedback,
+	    o_flow_status_clear => w_flow_status_clear,
+	    i_flow_status       => w_flow_status,
+	    o_fifo_select       => w_fifo_select,
+	    i_fifo_level_status => w_fifo_level_status,
+	    i_fifo_error_status => w_fifo_error_status,
+	    i_write_burst_count => w_write_burst_count,
+	    i_read_burst_count  => w_read_burst_count,
+	    o_error_clear       => w_error_clear,
+	    i_error_count       => w_error_count,
+		S_AXI_ACLK	=> s_axi_ctrl_aclk,
+		S_AXI_ARESETN	=> s_axi_ctrl_aresetn,
+		S_AXI_AWADDR	=> s_axi_ctrl_awaddr,
+		S_AXI_AWPROT	=> s_axi_ctrl_awprot,
+		S_AXI_AWVALID	=> s_axi_ctrl_awvalid,
+		S_AXI_AWREADY	=> s_axi_ctrl_awready,
+		S_AXI_WDATA	=> s_axi_ctrl_wdata,
+		S_AXI_WSTRB	=> s_axi_ctrl_wstrb,
+		S_AXI_WVALID	=> s_axi_ctrl_wvalid,
+		S_AXI_WREADY	=> s_axi_ctrl_wready,
+		S_AXI_BRESP	=> s_axi_ctrl_bresp,
+		S_AXI_BVALID	=> s_axi_ctrl_bvalid,
+		S_AXI_BREADY	=> s_axi_ctrl_bready,
+		S_AXI_ARADDR	=> s_axi_ctrl_araddr,
+		S_AXI_ARPROT	=> s_axi_ctrl_arprot,
+		S_AXI_ARVALID	=> s_axi_ctrl_arvalid,
+		S_AXI_ARREADY	=> s_axi_ctrl_arready,
+		S_AXI_RDATA	=> s_axi_ctrl_rdata,
+		S_AXI_RRESP	=> s_axi_ctrl_rresp,
+		S_AXI_RVALID	=> s_axi_ctrl_rvalid,
+		S_AXI_RREADY	=> s_axi_ctrl_rready
+	);
+
+    -- Instantiation of Axi Bus Interface M_AXI
+    Effects_v1_0_M_AXI_inst : entity work.Effects_v1_0_M_AXI
+	generic map (
+		C_M_AXI_BURST_LEN	=> C_M_AXI_BURST_LEN,
+		C_M_AXI_ID_WIDTH	=> C_M_AXI_ID_WIDTH,
+		C_M_AXI_ADDR_WIDTH	=> C_M_AXI_ADDR_WIDTH,
+		C_M_AXI_DATA_WIDTH	=> C_M_AXI_DATA_WIDTH
+	)
+	port map (
+	    -- burst request interface
+	    i_burst_start => w_write_start,
+	    i_burst_addr  => w_write_addr,
+	    o_burst_rd_en => w_write_rd_en,
+	    i_burst_data  => w_write_data,
+	    o_burst_busy  => w_write_busy,
+	    o_burst_done  => w_write_done,
+	    o_burst_error => w_write_error,
+	    i_read_start  => w_read_start,
+	    i_read_addr   => w_read_addr,
+	    o_read_valid  => w_read_valid,
+	    o_read_data   => w_read_data,
+	    o_read_busy   => w_read_busy,
+	    o_read_done   => w_read_done,
+	    o_read_error  => w_read_error,
+	    -- axi full master
+		M_AXI_ACLK	=> m_axi_aclk,
+		M_AXI_ARESETN	=> m_axi_aresetn,
+		M_AXI_AWID	=> m_axi_awid,
+		M_AXI_AWADDR	=> m_axi_awaddr,
+		M_AXI_AWLEN	=> m_axi_awlen,
+		M_AXI_AWSIZE	=> m_axi_awsize,
+		M_AXI_AWBURST	=> m_axi_awburst,
+		M_AXI_AWLOCK	=> m_axi_awlock,
+		M_AXI_AWCACHE	=> m_axi_awcache,
+		M_AXI_AWPROT	=> m_axi_awprot,
+		M_AXI_AWQOS	=> m_axi_awqos,
+		M_AXI_AWVALID	=> m_axi_awvalid,
+		M_AXI_AWREADY	=> m_axi_awready,
+		M_AXI_WDATA	=> m_axi_wdata,
+		M_AXI_WSTRB	=> m_axi_wstrb,
+		M_AXI_WLAST	=> m_axi_wlast,
+		M_AXI_WVALID	=> m_axi_wvalid,
+		M_AXI_WREADY	=> m_axi_wready,
+		M_AXI_BID	=> m_axi_bid,
+		M_AXI_BRESP	=> m_axi_bresp,
+		M_AXI_BVALID	=> m_axi_bvalid,
+		M_AXI_BREADY	=> m_axi_bready,
+		M_AXI_ARID	=> m_axi_arid,
+		M_AXI_ARADDR	=> m_axi_araddr,
+		M_AXI_ARLEN	=> m_axi_arlen,
+		M_AXI_ARSIZE	=> m_axi_arsize,
+		M_AXI_ARBURST	=> m_axi_arburst,
+		M_AXI_ARLOCK	=> m_axi_arlock,
+		M_AXI_ARCACHE	=> m_axi_arcache,
+		M_AXI_ARPROT	=> m_axi_arprot,
+		M_AXI_ARQOS	=> m_axi_arqos,
+		M_AXI_ARVALID	=> m_axi_arvalid,
+		M_AXI_ARREADY	=> m_axi_arready,
+		M_AXI_RID	=> m_axi_rid,
+		M_AXI_RDATA	=> m_axi_rdata,
+		M_AXI_RRESP	=> m_axi_rresp,
+		M_AXI_RLAST	=> m_axi_rlast,
+		M_AXI_RVALID	=> m_axi_rvalid,
+		M_AXI_RREADY	=> m_axi_rready
+	);
+
+	-- Add user logic here
+    w_reset <= not m_axi_aresetn;
+
+    -- Instantiation of the delay and reverb engine
+    effects_unit : entity work.effects
+    generic map(
+        g_DATA_WIDTH => g_DATA_WIDTH,
+        g_NUM_TAPS   => g_NUM_TAPS,
+        g_FIFO_DEPTH => g_FIFO_DEPTH,
+        g_BURST_LEN  => C_M_AXI_BURST_LEN
+    )
+    port map(
+        i_clk               => m_axi_aclk,
+        i_reset             => w_reset,
+        i_sample_valid      => i_sample_valid,
+        i_left              => i_left,
+        i_right             => i_right,
+        o_left              => o_left,
+        o_right             => o_right,
+        i_enable            => w_enable,
+        i_buffer_base       => w_buffer_base,
+        i_buffer_size       => w_buffer_size,
+        i_dry_level         => w_dry_level,
+        i_tap_delay         => w_tap_delay(g_NUM_TAPS*24-1 downto 0),
+        i_tap_level         => w_tap_level(g_NUM_TAPS*16-1 downto 0),
+        i_tap_feedback      => w_tap_feedback(g_NUM_TAPS*16-1 downto 0),
+        i_fifo_select       => w_fifo_select,
+        i_flow_status_clear => w_flow_status_clear,
+        i_error_clear       => w_error_clear,
+        o_write_burst_count => w_write_burst_count,
+        o_read_burst_count  => w_read_burst_count,
+        o_overflow_count    => w_flow_status(15 downto 0),
+        o_underrun_count    => w_flow_status(31 downto 16),
+        o_error_count       => w_error_count,
+        o_fifo_level_status => w_fifo_level_status,
+        o_fifo_error_status => w_fifo_error_status,
+        o_write_start       => w_write_start,
+        o_write_addr        => w_write_addr,
+        i_write_rd_en       => w_write_rd_en,
+        o_write_data        => w_write_data,
+        i_write_busy        => w_write_busy,
+        i_write_done        => w_write_done,
+        i_write_error       => w_write_error,
+        o_read_start        => w_read_start,
+        o_read_addr         => w_read_addr,
+        i_read_valid        => w_read_valid,
+        i_read_data         => w_read_data,
+        i_read_busy         => w_read_busy,
+        i_read_done         => w_read_done,
+        i_read_error        => w_read_error
+    );
+	-- User logic ends
+
+end arch_imp;
@@ -0,0 +1,334 @@
+library ieee;
+use ieee.std_logic_1164.all;
+use ieee.numeric_std.all;
+
+entity Effects_v1_0_M_AXI is
+	generic (
+		-- Users to add parameters here
+
+		-- User parameters ends
+		-- Do not modify the parameters beyond this line
+
+		-- Burst Length. Supports 1, 2, 4, 8, 16, 32, 64, 128, 256 burst lengths
+		C_M_AXI_BURST_LEN	: integer	:= 16;
+		-- Thread ID Width
+		C_M_AXI_ID_WIDTH	: integer	:= 1;
+		-- Width of Address Bus
+		C_M_AXI_ADDR_WIDTH	: integer	:= 32;
+		-- Width of Data Bus
+		C_M_AXI_DATA_WIDTH	: integer	:= 32
+	);
+	port (
+		-- Users to add ports here
+        -- burst write request, accepted when o_burst_busy is low
+        i_burst_start : in  std_logic;
+        i_burst_addr  : in  std_logic_vector(C_M_AXI_ADDR_WIDTH-1 downto 0);
+        -- burst data, read from a first word fall through FIFO
+        o_burst_rd_en : out std_logic;
+        i_burst_data  : in  std_logic_vector(C_M_AXI_DATA_WIDTH-1 downto 0);
+        o_burst_busy  : out std_logic;
+        -- pulsed with the write response, o_burst_error for SLVERR/DECERR
+        o_burst_done  : out std_logic;
+        o_burst_error : out std_logic;
+        -- burst read request, accepted when o_read_busy is low, the data is
+        -- written to a FIFO that must have room for the whole burst
+        i_read_start  : in  std_logic;
+        i_read_addr   : in  std_logic_vector(C_M_AXI_ADDR_WIDTH-1 downto 0);
+        o_read_valid  : out std_logic;
+        o_read_data   : out std_logic_vector(C_M_AXI_DATA_WIDTH-1 downto 0);
+        o_read_busy   : out std_logic;
+        -- pulsed with the last beat, o_read_error for SLVERR/DECERR on any beat
+        o_read_done   : out std_logic;
+        o_read_error  : out std_logic;
+		-- User ports ends
+		-- Do not modify the ports beyond this line
+
+		-- Global Clock Signal.
+		M_AXI_ACLK	: in std_logic;
+		-- Global Reset Singal. This Signal is Active Low
+		M_AXI_ARESETN	: in std_logic;
+		-- Master Interface Write Address ID
+		M_AXI_AWID	: out std_logic_vector(C_M_AXI_ID_WIDTH-1 downto 0);
+		-- Master Interface Write Address
+		M_AXI_AWADDR	: out std_logic_vector(C_M_AXI_ADDR_WIDTH-1 downto 0);
+		-- Burst length. The burst length gives the exact number of transfers in a burst
+		M_AXI_AWLEN	: out std_logic_vector(7 downto 0);
+		-- Burst size. This signal indicates the size of each transfer in the burst
+		M_AXI_AWSIZE	: out std_logic_vector(2 downto 0);
+		-- Burst type. The burst type and the size information,
+    -- determine how the address for each transfer within the burst is calculated.
+		M_AXI_AWBURST	: out std_logic_vector(1 downto 0);
+		-- Lock type. Provides additional information about the
+    -- atomic characteristics of the transfer.
+		M_AXI_AWLOCK	: out std_logic;
+		-- Memory type. This signal indicates how transactions
+    -- are required to progress through a system.
+		M_AXI_AWCACHE	: out std_logic_vector(3 downto 0);
+		-- Protection type. This signal indicates the privilege
+    -- and security level of the transaction, and whether
+    -- the transaction is a data access or an instruction access.
+		M_AXI_AWPROT	: out std_logic_vector(2 downto 0);
+		-- Quality of Service, QoS identifier sent for each write transaction.
+		M_AXI_AWQOS	: out std_logic_vector(3 downto 0);
+		-- Write address valid. This signal indicates that
+    -- the channel is signaling valid write address and control information.
+		M_AXI_AWVALID	: out std_logic;
+		-- Write address ready. This signal indicates that
+    -- the slave is ready to accept an address and associated control signals
+		M_AXI_AWREADY	: in std_logic;
+		-- Master Interface Write Data.
+		M_AXI_WDATA	: out std_logic_vector(C_M_AXI_DATA_WIDTH-1 downto 0);
+		-- Write strobes. This signal indicates which byte
+    -- lanes hold valid data. There is one write strobe
+    -- bit for each eight bits of the write data bus.
+		M_AXI_WSTRB	: out std_logic_vector(C_M_AXI_DATA_WIDTH/8-1 downto 0);
+		-- Write last. This signal indicates the last transfer in a write burst.
+		M_AXI_WLAST	: out std_logic;
+		-- Write valid. This signal indicates that valid write
+    -- data and strobes are available
+		M_AXI_WVALID	: out std_logic;
+		-- Write ready. This signal indicates that the slave
+    -- can accept the write data.
+		M_AXI_WREADY	: in std_logic;
+		-- Master Interface Write Response.
+		M_AXI_BID	: in std_logic_vector(C_M_AXI_ID_WIDTH-1 downto 0);
+		-- Write response. This signal indicates the status of the write transaction.
+		M_AXI_BRESP	: in std_logic_vector(1 downto 0);
+		-- Write response valid. This signal indicates that the
+    -- channel is signaling a valid write response.
+		M_AXI_BVALID	: in std_logic;
+		-- Response ready. This signal indicates that the master
+    -- can accept a write response.
+		M_AXI_BREADY	: out std_logic;
+		-- Master Interface Read Address.
+		M_AXI_ARID	: out std_logic_vector(C_M_AXI_ID_WIDTH-1 downto 0);
+		-- Read address. This signal indicates the initial
+    -- address of a read burst transaction.
+		M_AXI_ARADDR	: out std_logic_vector(C_M_AXI_ADDR_WIDTH-1 downto 0);
+		-- Burst length. The burst length gives the exact number of transfers in a burst
+		M_AXI_ARLEN	: out std_logic_vector(7 downto 0);
+		-- Burst size. This signal indicates the size of each transfer in the burst
+		M_AXI_ARSIZE	: out std_logic_vector(2 downto 0);
+		-- Burst type. The burst type and the size information,
+    -- determine how the address for each transfer within the burst is calculated.
+		M_AXI_ARBURST	: out std_logic_vector(1 downto 0);
+		-- Lock type. Provides additional information about the
+    -- atomic characteristics of the transfer.
+		M_AXI_ARLOCK	: out std_logic;
+		-- Memory type. This signal indicates how transactions
+    -- are required to progress through a system.
+		M_AXI_ARCACHE	: out std_logic_vector(3 downto 0);
+		-- Protection type. This signal indicates the privilege
+    -- and security level of the transaction, and whether
+    -- the transaction is a data access or an instruction access.
+		M_AXI_ARPROT	: out std_logic_vector(2 downto 0);
+		-- Quality of Service, QoS identifier sent for each read transaction
+		M_AXI_ARQOS	: out std_logic_vector(3 downto 0);
+		-- Write address valid. This signal indicates that
+    -- the channel is signaling valid read address and control information
+		M_AXI_ARVALID	: out std_logic;
+		-- Read address ready. This signal indicates that
+    -- the slave is ready to accept an address and associated control signals
+		M_AXI_ARREADY	: in std_logic;
+		-- Read ID tag. This signal is the identification tag
+    -- for the read data group of signals generated by the slave.
+		M_AXI_RID	: in std_logic_vector(C_M_AXI_ID_WIDTH-1 downto 0);
+		-- Master Read Data
+		M_AXI_RDATA	: in std_logic_vector(C_M_AXI_DATA_WIDTH-1 downto 0);
+		-- Read response. This signal indicates the status of the read transfer
+		M_AXI_RRESP	: in std_logic_vector(1 downto 0);
+		-- Read last. This signal indicates the last transfer in a read burst
+		M_AXI_RLAST	: in std_logic;
+		-- Read valid. This signal indicates that the channel
+    -- is signaling the required read data.
+		M_AXI_RVALID	: in std_logic;
+		-- Read ready. This signal indicates that the master can
+    -- accept the read data and response information.
+		M_AXI_RREADY	: out std_logic
+	);
+end Effects_v1_0_M_AXI;
+
+architecture implementation of Effects_v1_0_M_AXI is
+
+	-- AXI4 signals
+	--write address valid
+	signal axi_awvalid	: std_logic;
+	--write data valid
+	signal axi_wvalid	: std_logic;
+	--last beat of the burst
+	signal axi_wlast	: std_logic;
+	--write response acceptance
+	signal axi_bready	: std_logic;
+	--write address
+	signal axi_awaddr	: std_logic_vector(C_M_AXI_ADDR_WIDTH-1 downto 0);
+
+	-- beat index within the burst
+	signal r_beat : integer range 0 to C_M_AXI_BURST_LEN-1;
+
+	-- the address and data channels are handshaked independently, the
+	-- burst is complete with the response
+	signal r_busy : std_logic;
+
+	signal w_beat_accepted : std_logic;
+
+	--read address valid
+	signal axi_arvalid	: std_logic;
+	--read data acceptance
+	signal axi_rready	: std_logic;
+	--read address
+	signal axi_araddr	: std_logic_vector(C_M_AXI_ADDR_WIDTH-1 downto 0);
+
+	signal r_read_busy  : std_logic;
+	signal r_read_error : std_logic;
+
+	signal w_read_accepted : std_logic;
+
+begin
+	-- I/O Connections assignments
+
+	M_AXI_AWID	<= (others => '0');
+	M_AXI_AWADDR	<= axi_awaddr;
+	M_AXI_AWLEN	<= std_logic_vector(to_unsigned(C_M_AXI_BURST_LEN - 1, 8));
+	--Size should be C_M_AXI_DATA_WIDTH, in 2^SIZE bytes
+	M_AXI_AWSIZE	<= std_logic_vector(to_unsigned(2, 3)) when C_M_AXI_DATA_WIDTH = 32 else
+	                   std_logic_vector(to_unsigned(3, 3));
+	--INCR burst type
+	M_AXI_AWBURST	<= "01";
+	M_AXI_AWLOCK	<= '0';
+	--Bufferable, modifiable, the delay line is not shared with the cache
+	M_AXI_AWCACHE	<= "0011";
+	M_AXI_AWPROT	<= "000";
+	M_AXI_AWQOS	<= x"0";
+	M_AXI_AWVALID	<= axi_awvalid;
+	--Write Data(W), straight from the head of the FIFO
+	M_AXI_WDATA	<= i_burst_data;
+	--All bursts are full width
+	M_AXI_WSTRB	<= (others => '1');
+	M_AXI_WLAST	<= axi_wlast;
+	M_AXI_WVALID	<= axi_wvalid;
+	--Write Response (B)
+	M_AXI_BREADY	<= axi_bready;
+	--Read Address (AR), same burst as the writes
+	M_AXI_ARID	<= (others => '0');
+	M_AXI_ARADDR	<= axi_araddr;
+	M_AXI_ARLEN	<= std_logic_vector(to_unsigned(C_M_AXI_BURST_LEN - 1, 8));
+	M_AXI_ARSIZE	<= std_logic_vector(to_unsigned(2, 3)) when C_M_AXI_DATA_WIDTH = 32 else
+	                   std_logic_vector(to_unsigned(3, 3));
+	M_AXI_ARBURST	<= "01";
+	M_AXI_ARLOCK	<= '0';
+	M_AXI_ARCACHE	<= "0011";
+	M_AXI_ARPROT	<= "000";
+	M_AXI_ARQOS	<= x"0";
+	M_AXI_ARVALID	<= axi_arvalid;
+	--Read Data (R)
+	M_AXI_RREADY	<= axi_rready;
+
+	w_beat_accepted <= axi_wvalid and M_AXI_WREADY;
+	axi_wlast       <= '1' when r_beat = C_M_AXI_BURST_LEN-1 else '0';
+
+	-- each accepted beat pops the FIFO
+	o_burst_rd_en <= w_beat_accepted;
+	o_burst_busy  <= r_busy;
+
+	process(M_AXI_ACLK)
+	begin
+	  if rising_edge(M_AXI_ACLK) then
+	    if M_AXI_ARESETN = '0' then
+	      axi_awvalid   <= '0';
+	      axi_wvalid    <= '0';
+	      axi_bready    <= '0';
+	      axi_awaddr    <= (others => '0');
+	      r_beat        <= 0;
+	      r_busy        <= '0';
+	      o_burst_done  <= '0';
+	      o_burst_error <= '0';
+	    else
+	      o_burst_done <= '0';
+
+	      if r_busy = '0' then
+	        if i_burst_start = '1' then
+	          -- the FIFO holds the whole burst, so the address and data
+	          -- channels start together and the data is never stalled
+	          axi_awaddr  <= i_burst_addr;
+	          axi_awvalid <= '1';
+	          axi_wvalid  <= '1';
+	          axi_bready  <= '1';
+	          r_beat      <= 0;
+	          r_busy      <= '1';
+	        end if;
+	      else
+	        if axi_awvalid = '1' and M_AXI_AWREADY = '1' then
+	          axi_awvalid <= '0';
+	        end if;
+
+	        if w_beat_accepted = '1' then
+	          if axi_wlast = '1' then
+	            axi_wvalid <= '0';
+	          else
+	            r_beat <= r_beat + 1;
+	          end if;
+	        end if;
+
+	        -- the response can only follow the address and the last beat
+	        if axi_bready = '1' and M_AXI_BVALID = '1' then
+	          axi_bready    <= '0';
+	          r_busy        <= '0';
+	          o_burst_done  <= '1';
+	          o_burst_error <= M_AXI_BRESP(1);
+	        end if;
+	      end if;
+	    end if;
+	  end if;
+	end process;
+
+	-- the FIFO has room for the whole burst, so the data is never stalled
+	w_read_accepted <= axi_rready and M_AXI_RVALID;
+
+	o_read_valid <= w_read_accepted;
+	o_read_data  <= M_AXI_RDATA;
+	o_read_busy  <= r_read_busy;
+
+	process(M_AXI_ACLK)
+	begin
+	  if rising_edge(M_AXI_ACLK) then
+	    if M_AXI_ARESETN = '0' then
+	      axi_arvalid  <= '0';
+	      axi_rready   <= '0';
+	      axi_araddr   <= (others => '0');
+	      r_read_busy  <= '0';
+	      r_read_error <= '0';
+	      o_read_done  <= '0';
+	      o_read_error <= '0';
+	    else
+	      o_read_done <= '0';
+
+	      if r_read_busy = '0' then
+	        if i_read_start = '1' then
+	          axi_araddr   <= i_read_addr;
+	          axi_arvalid  <= '1';
+	          axi_rready   <= '1';
+	          r_read_busy  <= '1';
+	          r_read_error <= '0';
+	        end if;
+	      else
+	        if axi_arvalid = '1' and M_AXI_ARREADY = '1' then
+	          axi_arvalid <= '0';
+	        end if;
+
+	        if w_read_accepted = '1' then
+	          if M_AXI_RRESP(1) = '1' then
+	            r_read_error <= '1';
+	          end if;
+	          if M_AXI_RLAST = '1' then
+	            axi_rready   <= '0';
+	            r_read_busy  <= '0';
+	            o_read_done  <= '1';
+	            o_read_error <= r_read_error or M_AXI_RRESP(1);
+	          end if;
+	        end if;
+	      end if;
+	    end if;
+	  end if;
+	end process;
+
+end implementation;
@@ -0,0 +1,508 @@
+-- Effects
+-- Description:
+-- Post mixer delay and reverb. The delay line is a circular buffer in DDR
+-- holding one stereo frame per 8 bytes (left word, right word, sign
+-- extended), long enough for musical delays and reverb tails that do not fit
+-- in the block RAM. The engine is a multi-tap feedback delay:
+--
+--   output   = dry * input + sum over n of level(n) * tap(n)
+--   line     = input + sum over n of feedback(n) * tap(n)
+--   tap(n)   = line delayed by delay(n) frames
+--
+-- A single tap with feedback is an echo, several taps at unrelated delays
+-- with feedback build up a reverb tail.
+--
+-- The line is written through a FIFO drained in bursts of g_BURST_LEN words
+-- by the AXI4 write master. Every tap reads the line sequentially, so each
+-- tap has a prefetch FIFO that is refilled by burst reads as soon as it has
+-- room for a burst, g_FIFO_DEPTH words (g_FIFO_DEPTH/2 frames) ahead of the
+-- frame being processed, which hides the DDR latency many times over. A tap
+-- without a whole frame in its FIFO when the frame is processed is an
+-- underrun, the tap is silent for that frame and its delay grows by a frame.
+--
+-- The delays are rounded down to a whole burst, limited to
+-- c_MIN_DELAY_FRAMES so the reads stay behind the writes, and limited to the
+-- buffer. The buffer and the delays are applied when the effect is enabled,
+-- the levels and feedback at every frame. The taps are silent until they
+-- have been written since the enable. The effect is bypassed when disabled.
+--
+-- Inputs:
+-- i_clk: system clk
+-- i_sample_valid/i_left/i_right: mixer output
+-- i_enable: effect enable
+-- i_buffer_base/i_buffer_size: delay line in DDR, multiples of the burst size
+-- i_dry_level: Q1.15
+-- i_tap_delay: frames, tap n at bits n*24+23 downto n*24
+-- i_tap_level/i_tap_feedback: Q1.15, tap n at bits n*16+15 downto n*16
+-- i_fifo_select: {0: write FIFO, n+1: prefetch FIFO of tap n}
+-- burst masters data/busy/done/error
+--
+-- Outputs:
+-- o_left/o_right: to the I2S transmitter
+-- o_write_burst_count/o_read_burst_count: bursts since enabled, the DDR
+--           bandwidth is count * g_BURST_LEN * 4 bytes
+-- o_overflow_count: frames dropped from the line, write FIFO full
+-- o_underrun_count: frames of a tap missing in its prefetch FIFO
+-- o_error_count: bursts with an error response since cleared
+-- o_write_start/o_write_addr, o_read_start/o_read_addr: burst requests
+
+library ieee;
+use ieee.std_logic_1164.all;
+use ieee.numeric_std.all;
+
+entity effects is
+    generic(
+        g_DATA_WIDTH : integer := 24;
+        g_NUM_TAPS   : integer := 4;
+        g_FIFO_DEPTH : integer := 64;
+        g_BURST_LEN  : integer := 16
+    );
+    port(
+        i_clk               : in std_logic;
+        i_reset             : in std_logic;
+        -- mixer output
+        i_sample_valid      : in std_logic;
+        i_left              : in std_logic_vector(g_DATA_WIDTH-1 downto 0);
+        i_right             : in std_logic_vector(g_DATA_WIDTH-1 downto 0);
+        -- effect output
+        o_left              : out std_logic_vector(g_DATA_WIDTH-1 downto 0);
+        o_right             : out std_logic_vector(g_DATA_WIDTH-1 downto 0);
+        -- control
+        i_enable            : in std_logic;
+        i_buffer_base       : in std_logic_vector(31 downto 0);
+        i_buffer_size       : in std_logic_vector(31 downto 0);
+        i_dry_level         : in std_logic_vector(15 downto 0);
+        i_tap_delay         : in std_logic_vector(g_NUM_TAPS*24-1 downto 0);
+        i_tap_level         : in std_logic_vector(g_NUM_TAPS*16-1 downto 0);
+        i_tap_feedback      : in std_logic_vector(g_NUM_TAPS*16-1 downto 0);
+        i_fifo_select       : in std_logic_vector(2 downto 0);
+        i_flow_status_clear : in std_logic;
+        i_error_clear       : in std_logic;
+        -- status
+        o_write_burst_count : out std_logic_vector(31 downto 0);
+        o_read_burst_count  : out std_logic_vector(31 downto 0);
+        o_overflow_count    : out std_logic_vector(15 downto 0);
+        o_underrun_count    : out std_logic_vector(15 downto 0);
+        o_error_count       : out std_logic_vector(31 downto 0);
+        o_fifo_level_status : out std_logic_vector(31 downto 0);
+        o_fifo_error_status : out std_logic_vector(31 downto 0);
+        -- burst write master interface
+        o_write_start       : out std_logic;
+        o_write_addr        : out std_logic_vector(31 downto 0);
+        i_write_rd_en       : in std_logic;
+        o_write_data        : out std_logic_vector(31 downto 0);
+        i_write_busy        : in std_logic;
+        i_write_done        : in std_logic;
+        i_write_error       : in std_logic;
+        -- burst read master interface
+        o_read_start        : out std_logic;
+        o_read_addr         : out std_logic_vector(31 downto 0);
+        i_read_valid        : in std_logic;
+        i_read_data         : in std_logic_vector(31 downto 0);
+        i_read_busy         : in std_logic;
+        i_read_done         : in std_logic;
+        i_read_error        : in std_logic
+    );
+end effects;
+
+architecture arch of effects is
+    -- constants
+    constant c_FRAME_BYTES      : integer := 8;
+    constant c_BURST_BYTES      : integer := g_BURST_LEN*4;
+    constant c_MIN_DELAY_FRAMES : integer := g_FIFO_DEPTH + g_BURST_LEN;
+    constant c_COEFF_FRAC       : integer := 15;
+    constant c_ACC_WIDTH        : integer := g_DATA_WIDTH + 16 + 3;
+    constant c_MAX_COUNT        : integer := 2**16-1;
+    constant c_MAX_FRAMES       : integer := 2**24-1;
+
+    constant c_MAX_OUTPUT : signed(g_DATA_WIDTH-1 downto 0) := to_signed(2**(g_DATA_WIDTH-1)-1, g_DATA_WIDTH);
+    constant c_MIN_OUTPUT : signed(g_DATA_WIDTH-1 downto 0) := to_signed(-2**(g_DATA_WIDTH-1), g_DATA_WIDTH);
+
+    -- types
+    type t_state is (idle, taps, flush, output, write_right);
+    type t_burst_state is (idle, burst);
+    type t_offset_array is array (0 to g_NUM_TAPS-1) of unsigned(31 downto 0);
+    type t_frames_array is array (0 to g_NUM_TAPS-1) of unsigned(23 downto 0);
+    type t_data_array is array (0 to g_NUM_TAPS) of std_logic_vector(31 downto 0);
+    type t_level_array is array (0 to g_NUM_TAPS) of std_logic_vector(15 downto 0);
+    type t_acc_array is array (0 to 1) of signed(c_ACC_WIDTH-1 downto 0);
+
+    function saturate(value : signed(c_ACC_WIDTH-1 downto 0)) return signed is
+        variable v_value : signed(c_ACC_WIDTH-1 downto 0);
+    begin
+        v_value := shift_right(value, c_COEFF_FRAC);
+        if v_value > resize(c_MAX_OUTPUT, c_ACC_WIDTH) then
+            return c_MAX_OUTPUT;
+        elsif v_value < resize(c_MIN_OUTPUT, c_ACC_WIDTH) then
+            return c_MIN_OUTPUT;
+        else
+            return resize(v_value, g_DATA_WIDTH);
+        end if;
+    end function;
+
+    -- signals
+    signal r_running : std_logic := '0';
+    signal r_restart : std_logic := '0';
+    signal w_restart : std_logic;
+
+    -- frame processing
+    signal r_state       : t_state := idle;
+    signal r_index       : integer range 0 to 2*g_NUM_TAPS-1 := 0;
+    signal r_frame_count : integer range 0 to c_MAX_FRAMES := 0;
+    signal r_acc_output  : t_acc_array := (others => (others => '0'));
+    signal r_acc_line    : t_acc_array := (others => (others => '0'));
+    signal r_tap_hit     : std_logic := '0';
+    signal r_left        : signed(g_DATA_WIDTH-1 downto 0) := (others => '0');
+    signal r_right       : signed(g_DATA_WIDTH-1 downto 0) := (others => '0');
+    signal r_line_right  : signed(g_DATA_WIDTH-1 downto 0) := (others => '0');
+
+    -- tap sample, multiplied and accumulated one clock later
+    signal r_mac_valid   : std_logic := '0';
+    signal r_mac_tap     : integer range 0 to g_NUM_TAPS-1 := 0;
+    signal r_mac_channel : integer range 0 to 1 := 0;
+    signal r_mac_sample  : signed(g_DATA_WIDTH-1 downto 0) := (others => '0');
+
+    signal w_tap     : integer range 0 to g_NUM_TAPS-1;
+    signal w_channel : integer range 0 to 1;
+    signal w_tap_hit : std_logic;
+
+    -- delay line positions, byte offsets in the buffer
+    signal r_write_state  : t_burst_state := idle;
+    signal r_write_head   : unsigned(31 downto 0) := (others => '0');
+    signal r_read_state   : t_burst_state := idle;
+    signal r_read_head    : t_offset_array := (others => (others => '0'));
+    signal r_read_tap     : integer range 0 to g_NUM_TAPS-1 := 0;
+    signal r_burst_tap    : integer range 0 to g_NUM_TAPS-1 := 0;
+    signal r_delay_frames : t_frames_array := (others => (others => '0'));
+    signal r_write_start  : std_logic := '0';
+    signal r_write_addr   : unsigned(31 downto 0) := (others => '0');
+    signal r_read_start   : std_logic := '0';
+    signal r_read_addr    : unsigned(31 downto 0) := (others => '0');
+
+    -- status
+    signal r_write_burst_count : unsigned(31 downto 0) := (others => '0');
+    signal r_read_burst_count  : unsigned(31 downto 0) := (others => '0');
+    signal r_overflow_count    : integer range 0 to c_MAX_COUNT := 0;
+    signal r_underrun_count    : integer range 0 to c_MAX_COUNT := 0;
+    signal r_error_count       : integer range 0 to c_MAX_COUNT := 0;
+
+    -- FIFO signals, index 0 is the write FIFO and n+1 the prefetch FIFO of tap n
+    signal w_fifo_reset       : std_logic;
+    signal w_fifo_level       : t_level_array;
+    signal w_fifo_watermark   : t_level_array;
+    signal w_fifo_overflow    : t_level_array;
+    signal w_fifo_underflow   : t_level_array;
+
+    signal r_write_fifo_wr_en       : std_logic := '0';
+    signal r_write_fifo_wr_data     : std_logic_vector(31 downto 0) := (others => '0');
+    signal w_write_fifo_almost_full : std_logic;
+
+    signal w_tap_fifo_wr_en   : std_logic_vector(0 to g_NUM_TAPS-1);
+    signal w_tap_fifo_rd_en   : std_logic_vector(0 to g_NUM_TAPS-1);
+    signal w_tap_fifo_rd_data : t_data_array;
+begin
+    assert g_NUM_TAPS <= 4 report "at most 4 taps are mapped to the control registers" severity failure;
+    assert g_FIFO_DEPTH >= 2*g_BURST_LEN report "the FIFOs must hold at least two bursts" severity failure;
+
+    -- the effect is restarted once both burst masters are idle, so no burst
+    -- of the previous run reaches the flushed FIFOs
+    w_restart    <= '1' when i_enable = '1' and r_running = '0' and r_write_state = idle and r_read_state = idle and
+                             i_write_busy = '0' and i_read_busy = '0' else '0';
+    w_fifo_reset <= i_reset or r_restart;
+
+    process(i_clk)
+        variable v_delay : unsigned(31 downto 0);
+    begin
+        if rising_edge(i_clk) then
+            r_restart <= '0';
+            if i_reset = '1' or i_enable = '0' then
+                r_running <= '0';
+            elsif w_restart = '1' then
+                r_running <= '1';
+                r_restart <= '1';
+                for n in 0 to g_NUM_TAPS-1 loop
+                    v_delay := resize(unsigned(i_tap_delay(n*24+23 downto n*24)) * c_FRAME_BYTES, 32);
+                    v_delay := v_delay - (v_delay mod c_BURST_BYTES);
+                    if v_delay < c_MIN_DELAY_FRAMES*c_FRAME_BYTES then
+                        v_delay := to_unsigned(c_MIN_DELAY_FRAMES*c_FRAME_BYTES, 32);
+                    elsif v_delay >= unsigned(i_buffer_size) then
+                        v_delay := unsigned(i_buffer_size) - c_BURST_BYTES;
+                    end if;
+                    r_delay_frames(n) <= resize(v_delay / c_FRAME_BYTES, 24);
+                    r_read_head(n)    <= unsigned(i_buffer_size) - v_delay;
+                end loop;
+            end if;
+
+            -- prefetch, the taps are polled in turn and refilled when they have room for a burst
+            r_read_start <= '0';
+            if r_restart = '1' then
+                r_read_state <= idle;
+                r_read_tap   <= 0;
+            else
+                case r_read_state is
+                    when idle =>
+                        if r_running = '1' and i_read_busy = '0' then
+                            if unsigned(w_fifo_level(r_read_tap+1)) <= g_FIFO_DEPTH - g_BURST_LEN then
+                                r_read_start <= '1';
+                                r_read_addr  <= unsigned(i_buffer_base) + r_read_head(r_read_tap);
+                                r_burst_tap  <= r_read_tap;
+                                r_read_state <= burst;
+                            end if;
+                            if r_read_tap = g_NUM_TAPS-1 then
+                                r_read_tap <= 0;
+                            else
+                                r_read_tap <= r_read_tap + 1;
+                            end if;
+                        end if;
+
+                    when burst =>
+                        if i_read_done = '1' then
+                            r_read_state <= idle;
+                            if r_read_head(r_burst_tap) + c_BURST_BYTES >= unsigned(i_buffer_size) then
+                                r_read_head(r_burst_tap) <= (others => '0');
+                            else
+                                r_read_head(r_burst_tap) <= r_read_head(r_burst_tap) + c_BURST_BYTES;
+                            end if;
+                        end if;
+                end case;
+            end if;
+
+            -- the line is written as soon as a burst is available
+            r_write_start <= '0';
+            if r_restart = '1' then
+                r_write_state <= idle;
+                r_write_head  <= (others => '0');
+            else
+                case r_write_state is
+                    when idle =>
+                        if r_running = '1' and i_write_busy = '0' and unsigned(w_fifo_level(0)) >= g_BURST_LEN then
+                            r_write_start <= '1';
+                            r_write_addr  <= unsigned(i_buffer_base) + r_write_head;
+                            r_write_state <= burst;
+                        end if;
+
+                    when burst =>
+                        if i_write_done = '1' then
+                            r_write_state <= idle;
+                            if r_write_head + c_BURST_BYTES >= unsigned(i_buffer_size) then
+                                r_write_head <= (others => '0');
+                            else
+                                r_write_head <= r_write_head + c_BURST_BYTES;
+                            end if;
+                        end if;
+                end case;
+            end if;
+        end if;
+    end process;
+
+    -- write FIFO, one frame is two words
+    write_fifo_unit : entity work.fifo
+    generic map(
+        g_WIDTH       => 32,
+        g_DEPTH       => g_FIFO_DEPTH,
+        g_MEMORY_TYPE => "distributed"
+    )
+    port map(
+        i_clk       => i_clk,
+        i_reset     => w_fifo_reset,
+        -- FIFO write interface
+        i_wr_en       => r_write_fifo_wr_en,
+        i_wr_data     => r_write_fifo_wr_data,
+        o_almost_full => w_write_fifo_almost_full,
+        -- FIFO read interface
+        i_rd_en     => i_write_rd_en,
+        o_rd_data   => o_write_data,
+        -- FIFO status
+        o_level           => w_fifo_level(0),
+        o_high_watermark  => w_fifo_watermark(0),
+        o_overflow_count  => w_fifo_overflow(0),
+        o_underflow_count => w_fifo_underflow(0)
+    );
+
+    -- prefetch FIFOs, filled by the burst reads of their tap
+    tap_gen : for n in 0 to g_NUM_TAPS-1 generate
+        w_tap_fifo_wr_en(n) <= i_read_valid when r_burst_tap = n else '0';
+        w_tap_fifo_rd_en(n) <= w_tap_hit when r_state = taps and w_tap = n else '0';
+
+        tap_fifo_unit : entity work.fifo
+        generic map(
+            g_WIDTH       => 32,
+            g_DEPTH       => g_FIFO_DEPTH,
+            g_MEMORY_TYPE => "distributed"
+        )
+        port map(
+            i_clk       => i_clk,
+            i_reset     => w_fifo_reset,
+            -- FIFO write interface
+            i_wr_en     => w_tap_fifo_wr_en(n),
+            i_wr_data   => i_read_data,
+            -- FIFO read interface
+            i_rd_en     => w_tap_fifo_rd_en(n),
+            o_rd_data   => w_tap_fifo_rd_data(n),
+            -- FIFO status
+            o_level           => w_fifo_level(n+1),
+            o_high_watermark  => w_fifo_watermark(n+1),
+            o_overflow_count  => w_fifo_overflow(n+1),
+            o_underflow_count => w_fifo_underflow(n+1)
+        );
+    end generate;
+
+    -- tap word being read, the left and right word of each tap in turn
+    w_tap     <= r_index / 2;
+    w_channel <= r_index mod 2;
+
+    -- a tap is read when the whole frame is in its FIFO, the decision is
+    -- taken on the left word and kept for the right word
+    w_tap_hit <= r_tap_hit when w_channel = 1 else
+                 '1' when unsigned(w_fifo_level(w_tap+1)) >= 2 else '0';
+
+    -- frame processing
+    process(i_clk)
+    begin
+        if rising_edge(i_clk) then
+            r_mac_valid <= '0';
+            r_write_fifo_wr_en <= '0';
+
+            case r_state is
+                when idle =>
+                    if i_sample_valid = '1' then
+                        if r_running = '1' then
+                            r_acc_output(0) <= resize(signed(i_left) * signed(i_dry_level), c_ACC_WIDTH);
+                            r_acc_output(1) <= resize(signed(i_right) * signed(i_dry_level), c_ACC_WIDTH);
+                            r_acc_line(0)   <= shift_left(resize(signed(i_left), c_ACC_WIDTH), c_COEFF_FRAC);
+                            r_acc_line(1)   <= shift_left(resize(signed(i_right), c_ACC_WIDTH), c_COEFF_FRAC);
+                            r_index         <= 0;
+                            r_state         <= taps;
+                        else
+                            -- bypass
+                            r_left  <= signed(i_left);
+                            r_right <= signed(i_right);
+                        end if;
+                    end if;
+
+                when taps =>
+                    r_tap_hit     <= w_tap_hit;
+                    r_mac_valid   <= '1';
+                    r_mac_tap     <= w_tap;
+                    r_mac_channel <= w_channel;
+                    -- the tap is silent until its delay has been written since the enable
+                    if w_tap_hit = '1' and r_frame_count >= to_integer(r_delay_frames(w_tap)) then
+                        r_mac_sample <= resize(signed(w_tap_fifo_rd_data(w_tap)), g_DATA_WIDTH);
+                    else
+                        r_mac_sample <= (others => '0');
+                    end if;
+
+                    if r_index = 2*g_NUM_TAPS-1 then
+                        r_state <= flush;
+                    else
+                        r_index <= r_index + 1;
+                    end if;
+
+                -- the last tap is accumulated
+                when flush =>
+                    r_state <= output;
+
+                when output =>
+                    r_left       <= saturate(r_acc_output(0));
+                    r_right      <= saturate(r_acc_output(1));
+                    r_line_right <= saturate(r_acc_line(1));
+                    if r_frame_count /= c_MAX_FRAMES then
+                        r_frame_count <= r_frame_count + 1;
+                    end if;
+                    -- the frame is written whole or not at all
+                    if w_write_fifo_almost_full = '0' then
+                        r_write_fifo_wr_en   <= '1';
+                        r_write_fifo_wr_data <= std_logic_vector(resize(saturate(r_acc_line(0)), 32));
+                        r_state <= write_right;
+                    else
+                        r_state <= idle;
+                    end if;
+
+                when write_right =>
+                    r_write_fifo_wr_en   <= '1';
+                    r_write_fifo_wr_data <= std_logic_vector(resize(r_line_right, 32));
+                    r_state <= idle;
+            end case;
+
+            if r_mac_valid = '1' then
+                r_acc_output(r_mac_channel) <= r_acc_output(r_mac_channel) +
+                    r_mac_sample * signed(i_tap_level(r_mac_tap*16+15 downto r_mac_tap*16));
+                r_acc_line(r_mac_channel) <= r_acc_line(r_mac_channel) +
+                    r_mac_sample * signed(i_tap_feedback(r_mac_tap*16+15 downto r_mac_tap*16));
+            end if;
+
+            if r_restart = '1' then
+                r_frame_count <= 0;
+            end if;
+
+            if i_reset = '1' then
+                r_state <= idle;
+            end if;
+        end if;
+    end process;
+
+    -- burst and flow counters
+    process(i_clk)
+    begin
+        if rising_edge(i_clk) then
+            if i_reset = '1' or r_restart = '1' then
+                r_write_burst_count <= (others => '0');
+                r_read_burst_count  <= (others => '0');
+            else
+                if i_write_done = '1' then
+                    r_write_burst_count <= r_write_burst_count + 1;
+                end if;
+                if i_read_done = '1' then
+                    r_read_burst_count <= r_read_burst_count + 1;
+                end if;
+            end if;
+
+            -- sticky counts, saturate until cleared
+            if i_reset = '1' or i_flow_status_clear = '1' then
+                r_overflow_count <= 0;
+                r_underrun_count <= 0;
+            else
+                if r_state = output and w_write_fifo_almost_full = '1' and r_overflow_count /= c_MAX_COUNT then
+                    r_overflow_count <= r_overflow_count + 1;
+                end if;
+                if r_state = taps and w_channel = 0 and w_tap_hit = '0' and r_underrun_count /= c_MAX_COUNT then
+                    r_underrun_count <= r_underrun_count + 1;
+                end if;
+            end if;
+
+            if i_reset = '1' or i_error_clear = '1' then
+                r_error_count <= 0;
+            elsif ((i_write_done = '1' and i_write_error = '1') or (i_read_done = '1' and i_read_error = '1')) and
+                  r_error_count /= c_MAX_COUNT then
+                r_error_count <= r_error_count + 1;
+            end if;
+        end if;
+    end process;
+
+    o_left  <= std_logic_vector(r_left);
+    o_right <= std_logic_vector(r_right);
+
+    o_write_start <= r_write_start;
+    o_write_addr  <= std_logic_vector(r_write_addr);
+    o_read_start  <= r_read_start;
+    o_read_addr   <= std_logic_vector(r_read_addr);
+
+    o_write_burst_count <= std_logic_vector(r_write_burst_count);
+    o_read_burst_count  <= std_logic_vector(r_read_burst_count);
+    o_overflow_count    <= std_logic_vector(to_unsigned(r_overflow_count, 16));
+    o_underrun_count    <= std_logic_vector(to_unsigned(r_underrun_count, 16));
+    o_error_count       <= std_logic_vector(to_unsigned(r_error_count, 32));
+
+    -- FIFO status of the selected FIFO
+    process(i_fifo_select, w_fifo_level, w_fifo_watermark, w_fifo_overflow, w_fifo_underflow)
+        variable v_select : integer;
+    begin
+        v_select := to_integer(unsigned(i_fifo_select));
+        if v_select > g_NUM_TAPS then
+            v_select := 0;
+        end if;
+        o_fifo_level_status <= w_fifo_watermark(v_select) & w_fifo_level(v_select);
+        o_fifo_error_status <= w_fifo_underflow(v_select) & w_fifo_overflow(v_select);
+    end process;
+
+end arch;
@@ -0,0 +1,164 @@
+# Definitional proc to organize widgets for parameters.
+proc init_gui { IPINST } {
+  ipgui::add_param $IPINST -name "Component_Name"
+  #Adding Page
+  set Page_0 [ipgui::add_page $IPINST -name "Page 0"]
+  set C_S_AXI_CTRL_ADDR_WIDTH [ipgui::add_param $IPINST -name "C_S_AXI_CTRL_ADDR_WIDTH" -parent ${Page_0}]
+  set_property tooltip {Width of S_AXI address bus} ${C_S_AXI_CTRL_ADDR_WIDTH}
+  ipgui::add_param $IPINST -name "C_S_AXI_CTRL_BASEADDR" -parent ${Page_0}
+  ipgui::add_param $IPINST -name "C_S_AXI_CTRL_HIGHADDR" -parent ${Page_0}
+  set g_FIFO_DEPTH [ipgui::add_param $IPINST -name "g_FIFO_DEPTH" -parent ${Page_0}]
+  set_property tooltip {Depth of the write and prefetch FIFOs, at least two bursts} ${g_FIFO_DEPTH}
+  set g_NUM_TAPS [ipgui::add_param $IPINST -name "g_NUM_TAPS" -parent ${Page_0}]
+  set_property tooltip {Delay line taps, each with its own delay, level and feedback} ${g_NUM_TAPS}
+  set g_DATA_WIDTH [ipgui::add_param $IPINST -name "g_DATA_WIDTH" -parent ${Page_0}]
+  set_property tooltip {Width of the mixer samples} ${g_DATA_WIDTH}
+
+
+}
+
+proc update_PARAM_VALUE.g_DATA_WIDTH { PARAM_VALUE.g_DATA_WIDTH } {
+	# Procedure called to update g_DATA_WIDTH when any of the dependent parameters in the arguments change
+}
+
+proc validate_PARAM_VALUE.g_DATA_WIDTH { PARAM_VALUE.g_DATA_WIDTH } {
+	# Procedure called to validate g_DATA_WIDTH
+	return true
+}
+
+proc update_PARAM_VALUE.g_NUM_TAPS { PARAM_VALUE.g_NUM_TAPS } {
+	# Procedure called to update g_NUM_TAPS when any of the dependent parameters in the arguments change
+}
+
+proc validate_PARAM_VALUE.g_NUM_TAPS { PARAM_VALUE.g_NUM_TAPS } {
+	# Procedure called to validate g_NUM_TAPS
+	return true
+}
+
+proc update_PARAM_VALUE.g_FIFO_DEPTH { PARAM_VALUE.g_FIFO_DEPTH } {
+	# Procedure called to update g_FIFO_DEPTH when any of the dependent parameters in the arguments change
+}
+
+proc validate_PARAM_VALUE.g_FIFO_DEPTH { PARAM_VALUE.g_FIFO_DEPTH } {
+	# Procedure called to validate g_FIFO_DEPTH
+	return true
+}
+
+proc update_PARAM_VALUE.C_S_AXI_CTRL_DATA_WIDTH { PARAM_VALUE.C_S_AXI_CTRL_DATA_WIDTH } {
+	# Procedure called to update C_S_AXI_CTRL_DATA_WIDTH when any of the dependent parameters in the arguments change
+}
+
+proc validate_PARAM_VALUE.C_S_AXI_CTRL_DATA_WIDTH { PARAM_VALUE.C_S_AXI_CTRL_DATA_WIDTH } {
+	# Procedure called to validate C_S_AXI_CTRL_DATA_WIDTH
+	return true
+}
+
+proc update_PARAM_VALUE.C_S_AXI_CTRL_ADDR_WIDTH { PARAM_VALUE.C_S_AXI_CTRL_ADDR_WIDTH } {
+	# Procedure called to update C_S_AXI_CTRL_ADDR_WIDTH when any of the dependent parameters in the arguments change
+}
+
+proc validate_PARAM_VALUE.C_S_AXI_CTRL_ADDR_WIDTH { PARAM_VALUE.C_S_AXI_CTRL_ADDR_WIDTH } {
+	# Procedure called to validate C_S_AXI_CTRL_ADDR_WIDTH
+	return true
+}
+
+proc update_PARAM_VALUE.C_S_AXI_CTRL_BASEADDR { PARAM_VALUE.C_S_AXI_CTRL_BASEADDR } {
+	# Procedure called to update C_S_AXI_CTRL_BASEADDR when any of the dependent parameters in the arguments change
+}
+
+proc validate_PARAM_VALUE.C_S_AXI_CTRL_BASEADDR { PARAM_VALUE.C_S_AXI_CTRL_BASEADDR } {
+	# Procedure called to validate C_S_AXI_CTRL_BASEADDR
+	return true
+}
+
+proc update_PARAM_VALUE.C_S_AXI_CTRL_HIGHADDR { PARAM_VALUE.C_S_AXI_CTRL_HIGHADDR } {
+	# Procedure called to update C_S_AXI_CTRL_HIGHADDR when any of the dependent parameters in the arguments change
+}
+
+proc validate_PARAM_VALUE.C_S_AXI_CTRL_HIGHADDR { PARAM_VALUE.C_S_AXI_CTRL_HIGHADDR } {
+	# Procedure called to validate C_S_AXI_CTRL_HIGHADDR
+	return true
+}
+
+proc update_PARAM_VALUE.C_M_AXI_BURST_LEN { PARAM_VALUE.C_M_AXI_BURST_LEN } {
+	# Procedure called to update C_M_AXI_BURST_LEN when any of the dependent parameters in the arguments change
+}
+
+proc validate_PARAM_VALUE.C_M_AXI_BURST_LEN { PARAM_VALUE.C_M_AXI_BURST_LEN } {
+	# Procedure called to validate C_M_AXI_BURST_LEN
+	return true
+}
+
+proc update_PARAM_VALUE.C_M_AXI_ID_WIDTH { PARAM_VALUE.C_M_AXI_ID_WIDTH } {
+	# Procedure called to update C_M_AXI_ID_WIDTH when any of the dependent parameters in the arguments change
+}
+
+proc validate_PARAM_VALUE.C_M_AXI_ID_WIDTH { PARAM_VALUE.C_M_AXI_ID_WIDTH } {
+	# Procedure called to validate C_M_AXI_ID_WIDTH
+	return true
+}
+
+proc update_PARAM_VALUE.C_M_AXI_ADDR_WIDTH { PARAM_VALUE.C_M_AXI_ADDR_WIDTH } {
+	# Procedure called to update C_M_AXI_ADDR_WIDTH when any of the dependent parameters in the arguments change
+}
+
+proc validate_PARAM_VALUE.C_M_AXI_ADDR_WIDTH { PARAM_VALUE.C_M_AXI_ADDR_WIDTH } {
+	# Procedure called to validate C_M_AXI_ADDR_WIDTH
+	return true
+}
+
+proc update_PARAM_VALUE.C_M_AXI_DATA_WIDTH { PARAM_VALUE.C_M_AXI_DATA_WIDTH } {
+	# Procedure called to update C_M_AXI_DATA_WIDTH when any of the dependent parameters in the arguments change
+}
+
+proc validate_PARAM_VALUE.C_M_AXI_DATA_WIDTH { PARAM_VALUE.C_M_AXI_DATA_WIDTH } {
+	# Procedure called to validate C_M_AXI_DATA_WIDTH
+	return true
+}
+
+
+proc update_MODELPARAM_VALUE.g_DATA_WIDTH { MODELPARAM_VALUE.g_DATA_WIDTH PARAM_VALUE.g_DATA_WIDTH } {
+	# Procedure called to set VHDL generic/Verilog parameter value(s) based on TCL parameter value
+	set_property value [get_property value ${PARAM_VALUE.g_DATA_WIDTH}] ${MODELPARAM_VALUE.g_DATA_WIDTH}
+}
+
+proc update_MODELPARAM_VALUE.g_NUM_TAPS { MODELPARAM_VALUE.g_NUM_TAPS PARAM_VALUE.g_NUM_TAPS } {
+	# Procedure called to set VHDL generic/Verilog parameter value(s) based on TCL parameter value
+	set_property value [get_property value ${PARAM_VALUE.g_NUM_TAPS}] ${MODELPARAM_VALUE.g_NUM_TAPS}
+}
+
+proc update_MODELPARAM_VALUE.g_FIFO_DEPTH { MODELPARAM_VALUE.g_FIFO_DEPTH PARAM_VALUE.g_FIFO_DEPTH } {
+	# Procedure called to set VHDL generic/Verilog parameter value(s) based on TCL parameter value
+	set_property value [get_property value ${PARAM_VALUE.g_FIFO_DEPTH}] ${MODELPARAM_VALUE.g_FIFO_DEPTH}
+}
+
+proc update_MODELPARAM_VALUE.C_S_AXI_CTRL_DATA_WIDTH { MODELPARAM_VALUE.C_S_AXI_CTRL_DATA_WIDTH PARAM_VALUE.C_S_AXI_CTRL_DATA_WIDTH } {
+	# Procedure called to set VHDL generic/Verilog parameter value(s) based on TCL parameter value
+	set_property value [get_property value ${PARAM_VALUE.C_S_AXI_CTRL_DATA_WIDTH}] ${MODELPARAM_VALUE.C_S_AXI_CTRL_DATA_WIDTH}
+}
+
+proc update_MODELPARAM_VALUE.C_S_AXI_CTRL_ADDR_WIDTH { MODELPARAM_VALUE.C_S_AXI_CTRL_ADDR_WIDTH PARAM_VALUE.C_S_AXI_CTRL_ADDR_WIDTH } {
+	# Procedure called to set VHDL generic/Verilog parameter value(s) based on TCL parameter value
+	set_property value [get_property value ${PARAM_VALUE.C_S_AXI_CTRL_ADDR_WIDTH}] ${MODELPARAM_VALUE.C_S_AXI_CTRL_ADDR_WIDTH}
+}
+
+proc update_MODELPARAM_VALUE.C_M_AXI_BURST_LEN { MODELPARAM_VALUE.C_M_AXI_BURST_LEN PARAM_VALUE.C_M_AXI_BURST_LEN } {
+	# Procedure called to set VHDL generic/Verilog parameter value(s) based on TCL parameter value
+	set_property value [get_property value ${PARAM_VALUE.C_M_AXI_BURST_LEN}] ${MODELPARAM_VALUE.C_M_AXI_BURST_LEN}
+}
+
+proc update_MODELPARAM_VALUE.C_M_AXI_ID_WIDTH { MODELPARAM_VALUE.C_M_AXI_ID_WIDTH PARAM_VALUE.C_M_AXI_ID_WIDTH } {
+	# Procedure called to set VHDL generic/Verilog parameter value(s) based on TCL parameter value
+	set_property value [get_property value ${PARAM_VALUE.C_M_AXI_ID_WIDTH}] ${MODELPARAM_VALUE.C_M_AXI_ID_WIDTH}
+}
+
+proc update_MODELPARAM_VALUE.C_M_AXI_ADDR_WIDTH { MODELPARAM_VALUE.C_M_AXI_ADDR_WIDTH PARAM_VALUE.C_M_AXI_ADDR_WIDTH } {
+	# Procedure called to set VHDL generic/Verilog parameter value(s) based on TCL parameter value
+	set_property value [get_property value ${PARAM_VALUE.C_M_AXI_ADDR_WIDTH}] ${MODELPARAM_VALUE.C_M_AXI_ADDR_WIDTH}
+}
+
+proc update_MODELPARAM_VALUE.C_M_AXI_DATA_WIDTH { MODELPARAM_VALUE.C_M_AXI_DATA_WIDTH PARAM_VALUE.C_M_AXI_DATA_WIDTH } {
+	# Procedure called to set VHDL generic/Verilog parameter value(s) based on TCL parameter value
+	set_property value [get_property value ${PARAM_VALUE.C_M_AXI_DATA_WIDTH}] ${MODELPARAM_VALUE.C_M_AXI_DATA_WIDTH}
+}
+
@@ -3,6 +3,8 @@
 -- Data: 1/11/2020
 -- Description: Receiver and transmitter module that implements the Phillips I2S
 -- protocol. Capable of using different  master clock and sampling frequencies.
+-- The sample rate can be halved or doubled at run time with rate_sel, the new
+-- rate is applied at the next frame boundary so no frame is cut short.
 --
 -- ToDo: Modify module to allow for 32 bit data width
 
@@ -27,20 +29,28 @@ entity i2s is
         data_tx_right : in std_logic_vector(DBIT-1 downto 0);   -- right channel data in
         data_rx_left  : out std_logic_vector(DBIT-1 downto 0);  -- left channel data out
         data_rx_right : out std_logic_vector(DBIT-1 downto 0);  -- left channel data out
+        rate_sel      : in std_logic_vector(1 downto 0) := "01";  -- "00": half, "01": generic, "10": double sample rate, "11" is ignored
         ready         : out std_logic
     );
 end i2s;
 
 architecture arch of i2s is 
-    -- # of mclk leading edges per slck and rlck half period
+    -- # of mclk leading edges per slck and rlck half period at the generic rate
     constant SCLK_DIV        : integer := MCLK_LRCK_RATIO/SCLK_LRCK_RATIO/2 - 1;
     constant RLCK_DIV        : integer := MCLK_LRCK_RATIO/2 - 1;
     -- registered clock outputs
     signal sclk_reg          : std_logic;
     signal lrck_reg          : std_logic;
-    -- counters for clock generation
-    signal sclk_count_reg    : unsigned(9 downto 0);
-    signal lrck_count_reg    : unsigned(9 downto 0);
+    -- counters for clock generation, one bit wider for the halved rate
+    signal sclk_count_reg    : unsigned(10 downto 0);
+    signal lrck_count_reg    : unsigned(10 downto 0);
+    -- rate select, synchronised to mclk and applied at the frame boundary
+    signal rate_sync_reg     : std_logic_vector(3 downto 0);
+    signal rate_reg          : std_logic_vector(1 downto 0);
+    signal sclk_div          : unsigned(10 downto 0);
+    signal lrck_div          : unsigned(10 downto 0);
+    signal load_tx_count     : unsigned(10 downto 0);
+    signal load_rx_count     : unsigned(10 downto 0);
     -- control signals
     signal sclk_rising_edge  : std_logic;
     signal sclk_falling_edge : std_logic;
@@ -58,9 +68,17 @@ begin
             tx_reg         <= (others => '0');
             sclk_reg <= '0';
             lrck_reg <= '0';
+            rate_sync_reg  <= "0101";
+            rate_reg       <= "01";
         elsif falling_edge(mclk) then
+            -- rate select synchroniser, the new rate starts with a left channel frame
+            rate_sync_reg <= rate_sync_reg(1 downto 0) & rate_sel;
+            if lrck_count_reg = lrck_div and lrck_reg = '1' and rate_sync_reg(3 downto 2) /= "11" then
+                rate_reg <= rate_sync_reg(3 downto 2);
+            end if;
+
             -- sclk counter
-            if sclk_count_reg = SCLK_DIV then
+            if sclk_count_reg = sclk_div then
                 sclk_count_reg <= (others => '0');
                 sclk_reg       <= not sclk_reg;
             else
@@ -68,7 +86,7 @@ begin
             end if;         
             
             -- lrck counter
-            if lrck_count_reg = RLCK_DIV then
+            if lrck_count_reg = lrck_div then
                 lrck_count_reg <= (others => '0');
                 lrck_reg       <= not lrck_reg;
             else
@@ -102,10 +120,22 @@ begin
         end if;
     end process;
     
-    sclk_falling_edge <= '1' when (sclk_count_reg = SCLK_DIV and sclk_reg = '1') else '0';
-    sclk_rising_edge  <= '1' when (sclk_count_reg = SCLK_DIV and sclk_reg = '0') else '0';
-    load_en_tx  <= '1' when (lrck_count_reg = MCLK_LRCK_RATIO/SCLK_LRCK_RATIO - 1) else '0';
-    load_en_rx  <= '1' when (lrck_count_reg = MCLK_LRCK_RATIO/SCLK_LRCK_RATIO*3/2 - 1) else '0';
+    -- divider counts for the active rate
+    with rate_reg select sclk_div <=
+        to_unsigned((SCLK_DIV+1)*2 - 1, 11)      when "00",
+        to_unsigned((SCLK_DIV+1)/2 - 1, 11)      when "10",
+        to_unsigned(SCLK_DIV, 11)                when others;
+    with rate_reg select lrck_div <=
+        to_unsigned((RLCK_DIV+1)*2 - 1, 11)      when "00",
+        to_unsigned((RLCK_DIV+1)/2 - 1, 11)      when "10",
+        to_unsigned(RLCK_DIV, 11)                when others;
+    load_tx_count <= (sclk_div(9 downto 0) & '1');
+    load_rx_count <= (sclk_div(9 downto 0) & '1') + sclk_div + 1;
+
+    sclk_falling_edge <= '1' when (sclk_count_reg = sclk_div and sclk_reg = '1') else '0';
+    sclk_rising_edge  <= '1' when (sclk_count_reg = sclk_div and sclk_reg = '0') else '0';
+    load_en_tx  <= '1' when (lrck_count_reg = load_tx_count) else '0';
+    load_en_rx  <= '1' when (lrck_count_reg = load_rx_count) else '0';
     
     -- output clocks and serial data
     sclk  <= sclk_reg;
@@ -6,15 +6,16 @@ entity LFO_v1_0 is
 	generic (
 		-- Users to add parameters here
         g_NUM_CHANNELS : integer := 128;
+        g_NUM_LFOS     : integer := 1;   -- LFOs computed per voice, at most 4
 		-- User parameters ends
 		-- Do not modify the parameters beyond this line
 
 
 		-- Parameters of Axi Slave Bus Interface S_AXI_CTRL
 		C_S_AXI_CTRL_DATA_WIDTH	: integer	:= 32;
-		C_S_AXI_CTRL_ADDR_WIDTH	: integer	:= 5;
+		C_S_AXI_CTRL_ADDR_WIDTH	: integer	:= 7;
 
-		-- Parameters of Axi Master Bus Interface M_AXIS_OUTPUT
+		-- Parameters of Axi Master Bus Interface M_AXIS_OUTPUT, 32 bits per LFO
 		C_M_AXIS_OUTPUT_TDATA_WIDTH	: integer	:= 32;
 		C_M_AXIS_OUTPUT_START_COUNT	: integer	:= 32
 	);
@@ -62,17 +63,24 @@ end LFO_v1_0;
 architecture arch_imp of LFO_v1_0 is
 
 	constant c_DATA_WIDTH : integer := 24;
+	-- samples in flight in the LFO pipeline when the output fifo fills
+	constant c_PIPELINE_DEPTH : integer := 3;
 
     -- output fifo signals
 	signal w_output_fifo_wr_en   : std_logic;
-	signal w_output_fifo_wr_data : std_logic_vector(c_DATA_WIDTH-1 downto 0);
-	signal w_output_fifo_full    : std_logic;
+	signal w_output_fifo_wr_data : std_logic_vector(g_NUM_LFOS*c_DATA_WIDTH-1 downto 0);
+	signal w_output_fifo_almost_full : std_logic;
+    signal w_output_fifo_level_status : std_logic_vector(31 downto 0);
+    signal w_output_fifo_error_status : std_logic_vector(31 downto 0);
 	
-    signal w_channel_on  : std_logic_vector(0 to g_NUM_CHANNELS-1);
-    signal w_channel_fcw : std_logic_vector(23 downto 0);
-    signal w_amount      : std_logic_vector(15 downto 0);
-    signal w_waveform    : std_logic_vector(1 downto 0);
-    signal w_polyphonic  : std_logic;
+    signal w_channel_on  : std_logic_vector(0 to g_NUM_LFOS*g_NUM_CHANNELS-1);
+    signal w_channel_fcw : std_logic_vector(g_NUM_LFOS*24-1 downto 0);
+    signal w_amount      : std_logic_vector(g_NUM_LFOS*16-1 downto 0);
+    signal w_waveform    : std_logic_vector(g_NUM_LFOS*2-1 downto 0);
+    signal w_polyphonic  : std_logic_vector(g_NUM_LFOS-1 downto 0);
+    
+    signal w_flow_status_clear : std_logic;
+    signal w_overflow_count    : std_logic_vector(15 downto 0);
 	
 begin
 
@@ -80,6 +88,7 @@ begin
 LFO_v1_0_S_AXI_CTRL_inst : entity work.LFO_v1_0_S_AXI_CTRL
 	generic map (
 	    g_NUM_CHANNELS      => g_NUM_CHANNELS,
+	    g_NUM_LFOS          => g_NUM_LFOS,
 		C_S_AXI_DATA_WIDTH	=> C_S_AXI_CTRL_DATA_WIDTH,
 		C_S_AXI_ADDR_WIDTH	=> C_S_AXI_CTRL_ADDR_WIDTH
 	)
@@ -89,6 +98,10 @@ LFO_v1_0_S_AXI_CTRL_inst : entity work.LFO_v1_0_S_AXI_CTRL
         o_amount        => w_amount,
         o_waveform      => w_waveform,
         o_polyphonic    => w_polyphonic,
+        i_fifo_level_status => w_output_fifo_level_status,
+        i_fifo_error_status => w_output_fifo_error_status,
+        o_flow_status_clear => w_flow_status_clear,
+        i_flow_status       => x"0000" & w_overflow_count,
 		S_AXI_ACLK	    => s_axi_ctrl_aclk,
 		S_AXI_ARESETN	=> s_axi_ctrl_aresetn,
 		S_AXI_AWADDR	=> s_axi_ctrl_awaddr,
@@ -117,13 +130,17 @@ LFO_v1_0_M_AXIS_OUTPUT_inst : entity work.LFO_v1_0_M_AXIS_OUTPUT
 	generic map (
         g_NUM_CHANNELS        => g_NUM_CHANNELS,
         g_DATA_WIDTH          => c_DATA_WIDTH,
+        g_NUM_LFOS            => g_NUM_LFOS,
+        g_FIFO_ALMOST_FULL_OFFSET => c_PIPELINE_DEPTH,
         C_M_AXIS_TDATA_WIDTH  => C_M_AXIS_OUTPUT_TDATA_WIDTH,
         C_M_START_COUNT	      => C_M_AXIS_OUTPUT_START_COUNT
 	)
 	port map (
 	    i_fifo_wr_en    => w_output_fifo_wr_en,
         i_fifo_wr_data  => w_output_fifo_wr_data,
-	    o_fifo_full     => w_output_fifo_full,
+	    o_fifo_almost_full => w_output_fifo_almost_full,
+        o_fifo_level_status => w_output_fifo_level_status,
+        o_fifo_error_status => w_output_fifo_error_status,
 		M_AXIS_ACLK	    => m_axis_output_aclk,
 		M_AXIS_ARESETN	=> m_axis_output_aresetn,
 		M_AXIS_TVALID	=> m_axis_output_tvalid,
@@ -136,7 +153,8 @@ LFO_v1_0_M_AXIS_OUTPUT_inst : entity work.LFO_v1_0_M_AXIS_OUTPUT
     lfo_module : entity work.low_frequency_oscillator
     generic map(
         g_DATA_WIDTH   => c_DATA_WIDTH,
-        g_NUM_CHANNELS => g_NUM_CHANNELS
+        g_NUM_CHANNELS => g_NUM_CHANNELS,
+        g_NUM_LFOS     => g_NUM_LFOS
     )
     port map(
         i_clk                 => s_axi_ctrl_aclk,
@@ -148,7 +166,9 @@ LFO_v1_0_M_AXIS_OUTPUT_inst : entity work.LFO_v1_0_M_AXIS_OUTPUT
         i_polyphonic          => w_polyphonic,
         o_output_fifo_wr_en   => w_output_fifo_wr_en,
         o_output_fifo_wr_data => w_output_fifo_wr_data,
-        i_output_fifo_full    => w_output_fifo_full
+        i_output_fifo_almost_full => w_output_fifo_almost_full,
+        i_flow_status_clear   => w_flow_status_clear,
+        o_overflow_count      => w_overflow_count
     );
 
 end arch_imp;
@@ -5,8 +5,11 @@ use ieee.numeric_std.all;
 entity LFO_v1_0_M_AXIS_OUTPUT is
 	generic (
 		-- Users to add parameters here
-        g_NUM_CHANNELS : integer := 128;
-        g_DATA_WIDTH   : integer := 24;
+        g_NUM_CHANNELS            : integer := 128;
+        g_DATA_WIDTH              : integer := 24;
+        g_NUM_LFOS                : integer := 1;             -- each LFO is sent in its own 32 bit slot of TDATA
+        g_FIFO_MEMORY_TYPE        : string  := "distributed"; -- {"registers", "distributed", "block"}
+        g_FIFO_ALMOST_FULL_OFFSET : integer := 1;             -- free words reserved for samples in flight
 		-- User parameters ends
 		-- Do not modify the parameters beyond this line
 
@@ -18,8 +21,11 @@ entity LFO_v1_0_M_AXIS_OUTPUT is
 	port (
 		-- Users to add ports here
         i_fifo_wr_en   : in  std_logic;
-        i_fifo_wr_data : in std_logic_vector(g_DATA_WIDTH-1 downto 0);
-	    o_fifo_full    : out std_logic;
+        i_fifo_wr_data : in std_logic_vector(g_NUM_LFOS*g_DATA_WIDTH-1 downto 0);
+	    o_fifo_almost_full : out std_logic;
+        -- FIFO status
+        o_fifo_level_status : out std_logic_vector(31 downto 0); -- high watermark & level
+        o_fifo_error_status : out std_logic_vector(31 downto 0); -- underflow count & overflow count
 		-- User ports ends
 		-- Do not modify the ports beyond this line
 
@@ -44,7 +50,7 @@ architecture implementation of LFO_v1_0_M_AXIS_OUTPUT is
   
     -- FIFO write interface signals
 	signal w_fifo_rd_en   : std_logic;
-	signal w_fifo_rd_data : std_logic_vector(g_DATA_WIDTH-1 downto 0);
+	signal w_fifo_rd_data : std_logic_vector(g_NUM_LFOS*g_DATA_WIDTH-1 downto 0);
 	signal w_fifo_empty   : std_logic;
 	
 	signal w_reset : std_logic;
@@ -59,12 +65,19 @@ begin
 	
 	w_reset <= not M_AXIS_ARESETN;
 	
-	M_AXIS_TDATA  <= std_logic_vector(resize(unsigned(w_fifo_rd_data), M_AXIS_TDATA'length));
+	assert C_M_AXIS_TDATA_WIDTH = 32*g_NUM_LFOS
+	    report "C_M_AXIS_TDATA_WIDTH must be 32 bits per LFO" severity failure;
+
+	tdata_gen : for lfo in 0 to g_NUM_LFOS-1 generate
+	    M_AXIS_TDATA(lfo*32+31 downto lfo*32) <= std_logic_vector(resize(unsigned(w_fifo_rd_data(lfo*g_DATA_WIDTH+g_DATA_WIDTH-1 downto lfo*g_DATA_WIDTH)), 32));
+	end generate;
 	
     fifo_unit : entity work.fifo
     generic map(
-        g_WIDTH => g_DATA_WIDTH,
-        g_DEPTH => g_NUM_CHANNELS
+        g_WIDTH              => g_NUM_LFOS*g_DATA_WIDTH,
+        g_DEPTH              => g_NUM_CHANNELS,
+        g_MEMORY_TYPE        => g_FIFO_MEMORY_TYPE,
+        g_ALMOST_FULL_OFFSET => g_FIFO_ALMOST_FULL_OFFSET
     )
     port map(
         i_clk       => M_AXIS_ACLK,
@@ -72,11 +85,17 @@ begin
         -- FIFO write interface
         i_wr_en     => i_fifo_wr_en,
         i_wr_data   => i_fifo_wr_data,
-        o_full      => o_fifo_full,
+        o_full        => open,
+        o_almost_full => o_fifo_almost_full,
         -- FIFO read interface
         i_rd_en     => w_fifo_rd_en,
         o_rd_data   => w_fifo_rd_data,
-        o_empty     => w_fifo_empty
+        o_empty     => w_fifo_empty,
+        -- FIFO status
+        o_level           => o_fifo_level_status(15 downto 0),
+        o_high_watermark  => o_fifo_level_status(31 downto 16),
+        o_overflow_count  => o_fifo_error_status(15 downto 0),
+        o_underflow_count => o_fifo_error_status(31 downto 16)
     );
 
 end implementation;
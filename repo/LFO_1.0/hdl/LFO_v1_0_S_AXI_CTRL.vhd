@@ -6,20 +6,28 @@ entity LFO_v1_0_S_AXI_CTRL is
 	generic (
 		-- Users to add parameters here
         g_NUM_CHANNELS : integer := 128;
+        g_NUM_LFOS     : integer := 1;
 		-- User parameters ends
 
 		-- Width of S_AXI data bus
 		C_S_AXI_DATA_WIDTH	: integer	:= 32;
-		-- Width of S_AXI address bus
-		C_S_AXI_ADDR_WIDTH	: integer	:= 5
+		-- Width of S_AXI address bus, each LFO has a bank of 8 registers
+		C_S_AXI_ADDR_WIDTH	: integer	:= 7
 	);
 	port (
 		-- Users to add ports here
-        o_channel_on  : out std_logic_vector(0 to g_NUM_CHANNELS-1);
-        o_channel_fcw : out std_logic_vector(23 downto 0);
-        o_amount      : out std_logic_vector(15 downto 0);
-        o_waveform    : out std_logic_vector(1 downto 0);
-        o_polyphonic  : out std_logic;
+        -- LFO parameters, packed per LFO
+        o_channel_on  : out std_logic_vector(0 to g_NUM_LFOS*g_NUM_CHANNELS-1);
+        o_channel_fcw : out std_logic_vector(g_NUM_LFOS*24-1 downto 0);
+        o_amount      : out std_logic_vector(g_NUM_LFOS*16-1 downto 0);
+        o_waveform    : out std_logic_vector(g_NUM_LFOS*2-1 downto 0);
+        o_polyphonic  : out std_logic_vector(g_NUM_LFOS-1 downto 0);
+        -- output FIFO status
+        i_fifo_level_status : in std_logic_vector(31 downto 0);
+        i_fifo_error_status : in std_logic_vector(31 downto 0);
+        -- flow status, underrun count & overflow count, cleared by a write
+        o_flow_status_clear : out std_logic;
+        i_flow_status       : in std_logic_vector(31 downto 0);
 		-- User ports ends
 		-- Do not modify the ports beyond this line
 
@@ -110,12 +118,15 @@ architecture arch_imp of LFO_v1_0_S_AXI_CTRL is
 	------------------------------------------------
 	---- Signals for user logic register space example
 	--------------------------------------------------
-	---- Number of Slave Registers 4
-	signal slv_reg0	:std_logic_vector(C_S_AXI_DATA_WIDTH-1 downto 0);
-	signal slv_reg1	:std_logic_vector(C_S_AXI_DATA_WIDTH-1 downto 0);
-	signal slv_reg2	:std_logic_vector(C_S_AXI_DATA_WIDTH-1 downto 0);
-	signal slv_reg3	:std_logic_vector(C_S_AXI_DATA_WIDTH-1 downto 0);
-	signal slv_reg4	:std_logic_vector(C_S_AXI_DATA_WIDTH-1 downto 0);
+	---- Number of Slave Registers 8 per LFO, registers 5 to 7 are shared status
+	-- the LFO is selected by the address bits above the register bank
+	constant c_LFO_ADDR_LSB : integer := ADDR_LSB + OPT_MEM_ADDR_BITS + 1;
+	type t_reg_array is array (0 to g_NUM_LFOS-1) of std_logic_vector(C_S_AXI_DATA_WIDTH-1 downto 0);
+	signal slv_reg0	:t_reg_array;
+	signal slv_reg1	:t_reg_array;
+	signal slv_reg2	:t_reg_array;
+	signal slv_reg3	:t_reg_array;
+	signal slv_reg4	:t_reg_array;
 	signal slv_reg5	:std_logic_vector(C_S_AXI_DATA_WIDTH-1 downto 0);
 	signal slv_reg6	:std_logic_vector(C_S_AXI_DATA_WIDTH-1 downto 0);
 	signal slv_reg7	:std_logic_vector(C_S_AXI_DATA_WIDTH-1 downto 0);
@@ -125,7 +136,15 @@ architecture arch_imp of LFO_v1_0_S_AXI_CTRL is
 	signal byte_index	: integer;
 	signal aw_en	: std_logic;
 	
-	signal r_channel_on : std_logic_vector(0 to g_NUM_CHANNELS-1) := (others => '0');
+	signal r_channel_on : std_logic_vector(0 to g_NUM_LFOS*g_NUM_CHANNELS-1) := (others => '0');
+
+	function lfo_index(addr : std_logic_vector(C_S_AXI_ADDR_WIDTH-1 downto 0)) return integer is
+	begin
+	    if C_S_AXI_ADDR_WIDTH <= c_LFO_ADDR_LSB then
+	        return 0;
+	    end if;
+	    return to_integer(unsigned(addr(C_S_AXI_ADDR_WIDTH-1 downto c_LFO_ADDR_LSB)));
+	end function;
 
 begin
 	-- I/O Connections assignments
@@ -220,23 +239,26 @@ begin
 
 	process (S_AXI_ACLK)
 	variable loc_addr :std_logic_vector(OPT_MEM_ADDR_BITS downto 0); 
+	variable lfo : integer;
 	begin
 	  if rising_edge(S_AXI_ACLK) then 
 	    if S_AXI_ARESETN = '0' then
-	      slv_reg0 <= (others => '0');
-	      slv_reg1 <= (others => '0');
-	      slv_reg2 <= (others => '0');
-	      slv_reg3 <= (others => '0');
+	      slv_reg0 <= (others => (others => '0'));
+	      slv_reg1 <= (others => (others => '0'));
+	      slv_reg2 <= (others => (others => '0'));
+	      slv_reg3 <= (others => (others => '0'));
 	    else
 	      loc_addr := axi_awaddr(ADDR_LSB + OPT_MEM_ADDR_BITS downto ADDR_LSB);
-	      if (slv_reg_wren = '1') then
+	      lfo := lfo_index(axi_awaddr);
+	      -- writes to the banks of missing LFOs are ignored
+	      if (slv_reg_wren = '1' and lfo < g_NUM_LFOS) then
 	        case loc_addr is
 	          when b"000" =>
 	            for byte_index in 0 to (C_S_AXI_DATA_WIDTH/8-1) loop
 	              if ( S_AXI_WSTRB(byte_index) = '1' ) then
 	                -- Respective byte enables are asserted as per write strobes                   
 	                -- slave registor 0
-	                slv_reg0(byte_index*8+7 downto byte_index*8) <= S_AXI_WDATA(byte_index*8+7 downto byte_index*8);
+	                slv_reg0(lfo)(byte_index*8+7 downto byte_index*8) <= S_AXI_WDATA(byte_index*8+7 downto byte_index*8);
 	              end if;
 	            end loop;
 	          when b"001" =>
@@ -244,7 +266,7 @@ begin
 	              if ( S_AXI_WSTRB(byte_index) = '1' ) then
 	                -- Respective byte enables are asserted as per write strobes                   
 	                -- slave registor 1
-	                slv_reg1(byte_index*8+7 downto byte_index*8) <= S_AXI_WDATA(byte_index*8+7 downto byte_index*8);
+	                slv_reg1(lfo)(byte_index*8+7 downto byte_index*8) <= S_AXI_WDATA(byte_index*8+7 downto byte_index*8);
 	              end if;
 	            end loop;
 	          when b"010" =>
@@ -252,7 +274,7 @@ begin
 	              if ( S_AXI_WSTRB(byte_index) = '1' ) then
 	                -- Respective byte enables are asserted as per write strobes                   
 	                -- slave registor 2
-	                slv_reg2(byte_index*8+7 downto byte_index*8) <= S_AXI_WDATA(byte_index*8+7 downto byte_index*8);
+	                slv_reg2(lfo)(byte_index*8+7 downto byte_index*8) <= S_AXI_WDATA(byte_index*8+7 downto byte_index*8);
 	              end if;
 	            end loop;
 	          when b"011" =>
@@ -260,7 +282,7 @@ begin
 	              if ( S_AXI_WSTRB(byte_index) = '1' ) then
 	                -- Respective byte enables are asserted as per write strobes                   
 	                -- slave registor 3
-	                slv_reg3(byte_index*8+7 downto byte_index*8) <= S_AXI_WDATA(byte_index*8+7 downto byte_index*8);
+	                slv_reg3(lfo)(byte_index*8+7 downto byte_index*8) <= S_AXI_WDATA(byte_index*8+7 downto byte_index*8);
 	              end if;
 	            end loop;
               when b"100" =>
@@ -268,7 +290,7 @@ begin
 	              if ( S_AXI_WSTRB(byte_index) = '1' ) then
 	                -- Respective byte enables are asserted as per write strobes                   
 	                -- slave registor 4
-	                slv_reg4(byte_index*8+7 downto byte_index*8) <= S_AXI_WDATA(byte_index*8+7 downto byte_index*8);
+	                slv_reg4(lfo)(byte_index*8+7 downto byte_index*8) <= S_AXI_WDATA(byte_index*8+7 downto byte_index*8);
 	              end if;
 	            end loop;
 	          when b"101" =>
@@ -391,28 +413,34 @@ begin
 	-- and the slave is ready to accept the read address.
 	slv_reg_rden <= axi_arready and S_AXI_ARVALID and (not axi_rvalid) ;
 
-	process (slv_reg0, slv_reg1, slv_reg2, slv_reg3, axi_araddr, S_AXI_ARESETN, slv_reg_rden)
+	process (slv_reg0, slv_reg1, slv_reg2, slv_reg3, slv_reg4, slv_reg5, axi_araddr, S_AXI_ARESETN, slv_reg_rden,
+	         i_fifo_level_status, i_fifo_error_status, i_flow_status)
 	variable loc_addr :std_logic_vector(OPT_MEM_ADDR_BITS downto 0);
+	variable lfo : integer;
 	begin
 	    -- Address decoding for reading registers
 	    loc_addr := axi_araddr(ADDR_LSB + OPT_MEM_ADDR_BITS downto ADDR_LSB);
+	    lfo := lfo_index(axi_araddr);
+	    if lfo >= g_NUM_LFOS then
+	        lfo := 0;
+	    end if;
 	    case loc_addr is
 	      when b"000" =>
-	        reg_data_out <= slv_reg0;
+	        reg_data_out <= slv_reg0(lfo);
 	      when b"001" =>
-	        reg_data_out <= slv_reg1;
+	        reg_data_out <= slv_reg1(lfo);
 	      when b"010" =>
-	        reg_data_out <= slv_reg2;
+	        reg_data_out <= slv_reg2(lfo);
 	      when b"011" =>
-	        reg_data_out <= slv_reg3;
+	        reg_data_out <= slv_reg3(lfo);
           when b"100" =>
-	        reg_data_out <= slv_reg4;
+	        reg_data_out <= slv_reg4(lfo);
 	      when b"101" =>
-	        reg_data_out <= slv_reg5;
+	        reg_data_out <= i_flow_status;
 	      when b"110" =>
-	        reg_data_out <= slv_reg6;
+	        reg_data_out <= i_fifo_level_status;
 	      when b"111" =>
-	        reg_data_out <= slv_reg7;
+	        reg_data_out <= i_fifo_error_status;
 	      when others =>
 	        reg_data_out  <= (others => '0');
 	    end case;
@@ -437,16 +465,28 @@ begin
 	end process;
 
 
+	-- voice on/off writes {on, valid, channel} to register 0 of an LFO bank
 	process(S_AXI_ACLK)
+	    variable lfo : integer;
 	begin
-	    if slv_reg0(7) = '1' then
-            r_channel_on(to_integer(unsigned(slv_reg0(6 downto 0)))) <= slv_reg0(8);
+	    if rising_edge(S_AXI_ACLK) then
+	        lfo := lfo_index(axi_awaddr);
+	        if slv_reg_wren = '1' and axi_awaddr(ADDR_LSB + OPT_MEM_ADDR_BITS downto ADDR_LSB) = b"000" and
+	           lfo < g_NUM_LFOS and S_AXI_WDATA(7) = '1' and to_integer(unsigned(S_AXI_WDATA(6 downto 0))) < g_NUM_CHANNELS then
+                r_channel_on(lfo*g_NUM_CHANNELS + to_integer(unsigned(S_AXI_WDATA(6 downto 0)))) <= S_AXI_WDATA(8);
+            end if;
         end if;
     end process;
     o_channel_on  <= r_channel_on;
-    o_channel_fcw <= slv_reg1(o_channel_fcw'range);
-    o_amount      <= slv_reg2(o_amount'range);
-    o_waveform    <= slv_reg3(o_waveform'range);
-    o_polyphonic <= slv_reg4(0);
+
+    lfo_gen : for lfo in 0 to g_NUM_LFOS-1 generate
+        o_channel_fcw(lfo*24+23 downto lfo*24) <= slv_reg1(lfo)(23 downto 0);
+        o_amount(lfo*16+15 downto lfo*16)      <= slv_reg2(lfo)(15 downto 0);
+        o_waveform(lfo*2+1 downto lfo*2)       <= slv_reg3(lfo)(1 downto 0);
+        o_polyphonic(lfo)                      <= slv_reg4(lfo)(0);
+    end generate;
+
+    -- a write to the flow status register clears the overflow count
+    o_flow_status_clear <= '1' when slv_reg_wren = '1' and axi_awaddr(ADDR_LSB + OPT_MEM_ADDR_BITS downto ADDR_LSB) = b"101" else '0';
 
 end arch_imp;
@@ -3,147 +3,217 @@ use ieee.std_logic_1164.all;
 use ieee.numeric_std.all;
 
 
+-- Pipelined LFO engine, one voice is issued per clock and all g_NUM_LFOS LFOs of
+-- that voice are computed side by side in the same pass.
+-- Per LFO parameters are packed, LFO n uses bits n*width+width-1 downto n*width
+-- and i_channel_on(n*g_NUM_CHANNELS to n*g_NUM_CHANNELS+g_NUM_CHANNELS-1).
+-- Pipeline: issue (phase accumulate, sine read) -> waveform select -> scale -> fifo write
 entity low_frequency_oscillator is
     generic (
         g_DATA_WIDTH   : integer := 24;
-        g_NUM_CHANNELS : integer := 128
+        g_NUM_CHANNELS : integer := 128;
+        g_NUM_LFOS     : integer := 1
     );
     port (
         i_clk    : in std_logic;
         i_enable : in std_logic;
-        i_channel_on     : in std_logic_vector(0 to g_NUM_CHANNELS-1);
-        i_channel_fcw    : in std_logic_vector(23 downto 0);
-        i_amount         : in std_logic_vector(15 downto 0);
-        i_waveform       : in std_logic_vector(1 downto 0);
-        i_polyphonic     : in std_logic;
+        i_channel_on     : in std_logic_vector(0 to g_NUM_LFOS*g_NUM_CHANNELS-1);
+        i_channel_fcw    : in std_logic_vector(g_NUM_LFOS*24-1 downto 0);
+        i_amount         : in std_logic_vector(g_NUM_LFOS*16-1 downto 0);
+        i_waveform       : in std_logic_vector(g_NUM_LFOS*2-1 downto 0);
+        i_polyphonic     : in std_logic_vector(g_NUM_LFOS-1 downto 0);
         o_output_fifo_wr_en   : out std_logic;
-        o_output_fifo_wr_data : out std_logic_vector(g_DATA_WIDTH-1 downto 0);
-        i_output_fifo_full    : in std_logic
+        o_output_fifo_wr_data : out std_logic_vector(g_NUM_LFOS*g_DATA_WIDTH-1 downto 0);
+        i_output_fifo_almost_full : in std_logic; -- must leave room for the c_PIPELINE_DEPTH samples in flight
+        -- flow status
+        i_flow_status_clear : in std_logic;
+        o_overflow_count    : out std_logic_vector(15 downto 0) -- sample periods not started on their enable
     );
 end low_frequency_oscillator;
 
 architecture arch of low_frequency_oscillator is
 
-    type t_state is (idle, accumulate, sine, saw, triangle, square, scale);
-    
-    signal r_state, r_state_last : t_state := idle;
-    signal w_phase_accumulator : std_logic_vector(23 downto 0);
-    signal r_phase_accumulator_next : unsigned(23 downto 0) := (others => '0');
-    signal r_phase_accumulator_monophonic : unsigned(23 downto 0) := (others => '0');
-    signal w_accumulator : unsigned(23 downto 0);
-    signal shift_enable : std_logic;
-    
-    signal r_output : signed(g_DATA_WIDTH-1 downto 0) := (others => '0');
-    
-    signal r_channel_index, r_channel_index_last : integer := 0;
-    
-    signal r_waveform : std_logic_vector(1 downto 0);
-    signal r_wave : signed(g_DATA_WIDTH-1 downto 0);
-    
-    signal w_saw : signed(g_DATA_WIDTH-1 downto 0);
-    signal w_sine : std_logic_vector(g_DATA_WIDTH-1 downto 0);
-    signal w_square : signed(g_DATA_WIDTH-1 downto 0);
-    signal w_saw_abs : signed(g_DATA_WIDTH-1 downto 0);
-    signal w_triangle : signed(g_DATA_WIDTH-1 downto 0);
-    
+    constant c_MAX_COUNT      : integer := 2**16-1;
+    constant c_PIPELINE_DEPTH : integer := 3;
+
+    type t_state is (idle, processing);
+    signal r_state : t_state := idle;
+
+    type t_phase_array is array (0 to g_NUM_LFOS-1) of unsigned(23 downto 0);
+    type t_wave_array is array (0 to g_NUM_LFOS-1) of signed(g_DATA_WIDTH-1 downto 0);
+    type t_slv_array is array (0 to g_NUM_LFOS-1) of std_logic_vector(g_DATA_WIDTH-1 downto 0);
+
+    signal r_channel_index : integer range 0 to g_NUM_CHANNELS-1 := 0;
+    signal w_issue : std_logic;
+
+    -- per LFO state
+    signal r_waveform : std_logic_vector(g_NUM_LFOS*2-1 downto 0) := (others => '0');
+    signal r_phase_accumulator_monophonic : t_phase_array := (others => (others => '0'));
+    signal w_phase_accumulator      : t_slv_array;
+    signal w_phase_accumulator_next : t_phase_array;
+    signal w_accumulator            : t_phase_array;
+    signal w_channel_on             : std_logic_vector(0 to g_NUM_LFOS-1);
+
+    -- stage 1: phase, the sine wavetable output is valid in this stage
+    signal r_valid_1       : std_logic := '0';
+    signal r_waveform_1    : std_logic_vector(g_NUM_LFOS*2-1 downto 0) := (others => '0');
+    signal r_channel_on_1  : std_logic_vector(0 to g_NUM_LFOS-1) := (others => '0');
+    signal r_accumulator_1 : t_phase_array := (others => (others => '0'));
+    signal w_sine          : t_slv_array;
+
+    -- stage 2: selected waveform
+    signal r_valid_2      : std_logic := '0';
+    signal r_channel_on_2 : std_logic_vector(0 to g_NUM_LFOS-1) := (others => '0');
+    signal r_wave_2       : t_wave_array := (others => (others => '0'));
+
+    -- stage 3: scaled output
+    signal r_valid_3  : std_logic := '0';
+    signal r_output_3 : t_wave_array := (others => (others => '0'));
+
+    signal r_start_pending  : std_logic := '0';
+    signal r_overflow_count : integer range 0 to c_MAX_COUNT := 0;
+
 begin
 
-    phase_sr : entity work.shift_register
-    generic map(
-        g_LENGTH    => g_NUM_CHANNELS,
-        g_DATA_SIZE => 24
-        )
-    port map(
-        i_clk  => i_clk,
-        i_en   => shift_enable,
-        i_in   => std_logic_vector(r_phase_accumulator_next),
-        o_out  => w_phase_accumulator
-    );
+    -- a voice is issued every clock while the output fifo has room for the samples in flight
+    w_issue <= '1' when r_state = processing and i_output_fifo_almost_full = '0' else '0';
 
     process(i_clk)
     begin
         if rising_edge(i_clk) then
-            r_state_last <= r_state;
-            r_channel_index_last <= r_channel_index;
-            
-        
             case r_state is
                 when idle =>
-                    if i_enable = '1' then
-                        r_state <= accumulate;
+                    if i_enable = '1' or r_start_pending = '1' then
+                        r_state <= processing;
                         r_waveform <= i_waveform;
                         r_channel_index <= 0;
-                        r_phase_accumulator_monophonic <= r_phase_accumulator_monophonic + unsigned(i_channel_fcw);
+                        for lfo in 0 to g_NUM_LFOS-1 loop
+                            r_phase_accumulator_monophonic(lfo) <= r_phase_accumulator_monophonic(lfo) +
+                                unsigned(i_channel_fcw(lfo*24+23 downto lfo*24));
+                        end loop;
                     end if;
-                    
-                when accumulate =>
-                    if i_channel_on(r_channel_index) = '1' then
-                        r_phase_accumulator_next <= unsigned(w_phase_accumulator) + unsigned(i_channel_fcw);
-                    else
-                        r_phase_accumulator_next <= (others => '0');
-                    end if;
-                    if r_waveform = "00" then
-                        r_state <= sine;
-                    elsif r_waveform = "01" then
-                        r_state <= saw;
-                    elsif r_waveform = "10" then
-                        r_state <= triangle;
-                    else 
-                        r_state <= square;
-                    end if;
-                    
-                when sine =>
-                    r_wave  <= signed(w_sine);
-                    r_state <= scale;
-                    
-                when saw =>
-                    r_wave  <= w_saw;
-                    r_state <= scale;
-                
-                when triangle =>
-                    r_wave <= w_triangle;
-                    r_state <= scale;
-                
-                when square =>
-                    r_wave <= w_square;
-                    r_state <= scale;
-                    
-                when scale =>   
-                    r_output <= resize(shift_right(r_wave * signed(i_amount), 15), 24);
-
-                    if r_channel_index = g_NUM_CHANNELS-1 then
-                        r_channel_index <= 0;
-                        r_state <= idle;
-                    else
-                        r_channel_index <= r_channel_index + 1;
-                        r_state <= accumulate;
+
+                when processing =>
+                    if w_issue = '1' then
+                        if r_channel_index = g_NUM_CHANNELS-1 then
+                            r_channel_index <= 0;
+                            r_state <= idle;
+                        else
+                            r_channel_index <= r_channel_index + 1;
+                        end if;
                     end if;
-                    
             end case;
         end if;
-    end process;    
-    
-    shift_enable <= '1' when r_state = scale else '0';
-    
-    o_output_fifo_wr_en <= '1' when r_state_last = scale else '0';
-    
-    o_output_fifo_wr_data <= std_logic_vector(r_output) when i_channel_on(r_channel_index_last) = '1' else (others => '0');
-    
-    w_accumulator <= r_phase_accumulator_next when i_polyphonic = '1' else r_phase_accumulator_monophonic;
-    
-    w_saw <= signed(w_accumulator);
-    w_saw_abs <= w_saw  when w_saw > 0 else -w_saw;
-    w_triangle <= shift_left(w_saw_abs - to_signed(2**(g_DATA_WIDTH-2), g_DATA_WIDTH), 1);
-    w_square <= to_signed(2**(g_DATA_WIDTH-1)-1, 24) when w_saw > 0 else to_signed(-1*2**(g_DATA_WIDTH-1)-1, 24);
-    
-    -- instantiate sine wavetable
-    sine_wavetable_unit: entity work.sine_wavetable
-    port map(
-        i_clk    => i_clk,
-        i_en     => '1',
-        i_addr   => std_logic_vector(w_accumulator(w_accumulator'high downto w_accumulator'high-8+1)),
-        i_octave => (others => '0'),
-        o_out    => w_sine
-    );
+    end process;
+
+    lfo_gen : for lfo in 0 to g_NUM_LFOS-1 generate
+
+        w_channel_on(lfo) <= i_channel_on(lfo*g_NUM_CHANNELS + r_channel_index);
+
+        -- the oldest phase in the shift register belongs to the voice being issued
+        phase_sr : entity work.shift_register
+        generic map(
+            g_LENGTH    => g_NUM_CHANNELS,
+            g_DATA_SIZE => 24
+            )
+        port map(
+            i_clk  => i_clk,
+            i_en   => w_issue,
+            i_in   => std_logic_vector(w_phase_accumulator_next(lfo)),
+            o_out  => w_phase_accumulator(lfo)
+        );
+
+        w_phase_accumulator_next(lfo) <= unsigned(w_phase_accumulator(lfo)) + unsigned(i_channel_fcw(lfo*24+23 downto lfo*24))
+                                         when w_channel_on(lfo) = '1' else (others => '0');
+
+        w_accumulator(lfo) <= w_phase_accumulator_next(lfo) when i_polyphonic(lfo) = '1' else r_phase_accumulator_monophonic(lfo);
+
+        -- instantiate sine wavetable, read in the issue stage
+        sine_wavetable_unit: entity work.sine_wavetable
+        port map(
+            i_clk    => i_clk,
+            i_en     => '1',
+            i_addr   => std_logic_vector(w_accumulator(lfo)(23 downto 16)),
+            i_octave => (others => '0'),
+            o_out    => w_sine(lfo)
+        );
+
+        process(i_clk)
+            variable v_saw, v_saw_abs : signed(g_DATA_WIDTH-1 downto 0);
+        begin
+            if rising_edge(i_clk) then
+                -- stage 1
+                r_channel_on_1(lfo)  <= w_channel_on(lfo);
+                r_accumulator_1(lfo) <= w_accumulator(lfo);
+
+                -- stage 2
+                v_saw := signed(r_accumulator_1(lfo));
+                if v_saw > 0 then
+                    v_saw_abs := v_saw;
+                else
+                    v_saw_abs := -v_saw;
+                end if;
+
+                r_channel_on_2(lfo) <= r_channel_on_1(lfo);
+                case r_waveform_1(lfo*2+1 downto lfo*2) is
+                    when "00" =>    -- sine
+                        r_wave_2(lfo) <= signed(w_sine(lfo));
+                    when "01" =>    -- saw
+                        r_wave_2(lfo) <= v_saw;
+                    when "10" =>    -- triangle
+                        r_wave_2(lfo) <= shift_left(v_saw_abs - to_signed(2**(g_DATA_WIDTH-2), g_DATA_WIDTH), 1);
+                    when others =>  -- square
+                        if v_saw > 0 then
+                            r_wave_2(lfo) <= to_signed(2**(g_DATA_WIDTH-1)-1, g_DATA_WIDTH);
+                        else
+                            r_wave_2(lfo) <= to_signed(-(2**(g_DATA_WIDTH-1)-1), g_DATA_WIDTH);
+                        end if;
+                end case;
+
+                -- stage 3
+                if r_channel_on_2(lfo) = '1' then
+                    r_output_3(lfo) <= resize(shift_right(r_wave_2(lfo) * signed(i_amount(lfo*16+15 downto lfo*16)), 15), g_DATA_WIDTH);
+                else
+                    r_output_3(lfo) <= (others => '0');
+                end if;
+            end if;
+        end process;
+
+        o_output_fifo_wr_data(lfo*g_DATA_WIDTH+g_DATA_WIDTH-1 downto lfo*g_DATA_WIDTH) <= std_logic_vector(r_output_3(lfo));
+
+    end generate;
+
+    process(i_clk)
+    begin
+        if rising_edge(i_clk) then
+            r_valid_1 <= w_issue;
+            r_waveform_1 <= r_waveform;
+            r_valid_2 <= r_valid_1;
+            r_valid_3 <= r_valid_2;
+        end if;
+    end process;
+
+    o_output_fifo_wr_en <= r_valid_3;
+
+    -- a sample period that starts before the previous one is finished is started
+    -- once the previous one is, the sticky overflow count saturates until cleared
+    process(i_clk)
+    begin
+        if rising_edge(i_clk) then
+            if r_state = idle then
+                r_start_pending <= '0';
+            elsif i_enable = '1' then
+                r_start_pending <= '1';
+            end if;
+
+            if i_flow_status_clear = '1' then
+                r_overflow_count <= 0;
+            elsif i_enable = '1' and (r_state /= idle or r_start_pending = '1') and r_overflow_count /= c_MAX_COUNT then
+                r_overflow_count <= r_overflow_count + 1;
+            end if;
+        end if;
+    end process;
+
+    o_overflow_count <= std_logic_vector(to_unsigned(r_overflow_count, 16));
 
-end arch;
\ No newline at end of file
+end arch;
@@ -3,7 +3,7 @@ proc init_gui { IPINST } {
   ipgui::add_param $IPINST -name "Component_Name"
   #Adding Page
   set Page_0 [ipgui::add_page $IPINST -name "Page 0"]
-  set C_M_AXIS_OUTPUT_TDATA_WIDTH [ipgui::add_param $IPINST -name "C_M_AXIS_OUTPUT_TDATA_WIDTH" -parent ${Page_0} -widget comboBox]
+  set C_M_AXIS_OUTPUT_TDATA_WIDTH [ipgui::add_param $IPINST -name "C_M_AXIS_OUTPUT_TDATA_WIDTH" -parent ${Page_0}]
   set_property tooltip {Width of S_AXIS address bus. The slave accepts the read and write addresses of width C_M_AXIS_TDATA_WIDTH.} ${C_M_AXIS_OUTPUT_TDATA_WIDTH}
   set C_S_AXI_CTRL_DATA_WIDTH [ipgui::add_param $IPINST -name "C_S_AXI_CTRL_DATA_WIDTH" -parent ${Page_0} -widget comboBox]
   set_property tooltip {Width of S_AXI data bus} ${C_S_AXI_CTRL_DATA_WIDTH}
@@ -12,10 +12,21 @@ proc init_gui { IPINST } {
   ipgui::add_param $IPINST -name "C_S_AXI_CTRL_BASEADDR" -parent ${Page_0}
   ipgui::add_param $IPINST -name "C_S_AXI_CTRL_HIGHADDR" -parent ${Page_0}
   ipgui::add_param $IPINST -name "g_NUM_CHANNELS" -parent ${Page_0}
+  set g_NUM_LFOS [ipgui::add_param $IPINST -name "g_NUM_LFOS" -parent ${Page_0}]
+  set_property tooltip {LFOs computed per voice, each one has a register bank and a 32 bit slot of the output stream} ${g_NUM_LFOS}
 
 
 }
 
+proc update_PARAM_VALUE.g_NUM_LFOS { PARAM_VALUE.g_NUM_LFOS } {
+	# Procedure called to update g_NUM_LFOS when any of the dependent parameters in the arguments change
+}
+
+proc validate_PARAM_VALUE.g_NUM_LFOS { PARAM_VALUE.g_NUM_LFOS } {
+	# Procedure called to validate g_NUM_LFOS
+	return true
+}
+
 proc update_PARAM_VALUE.g_NUM_CHANNELS { PARAM_VALUE.g_NUM_CHANNELS } {
 	# Procedure called to update g_NUM_CHANNELS when any of the dependent parameters in the arguments change
 }
@@ -25,8 +36,9 @@ proc validate_PARAM_VALUE.g_NUM_CHANNELS { PARAM_VALUE.g_NUM_CHANNELS } {
 	return true
 }
 
-proc update_PARAM_VALUE.C_M_AXIS_OUTPUT_TDATA_WIDTH { PARAM_VALUE.C_M_AXIS_OUTPUT_TDATA_WIDTH } {
+proc update_PARAM_VALUE.C_M_AXIS_OUTPUT_TDATA_WIDTH { PARAM_VALUE.C_M_AXIS_OUTPUT_TDATA_WIDTH PARAM_VALUE.g_NUM_LFOS } {
 	# Procedure called to update C_M_AXIS_OUTPUT_TDATA_WIDTH when any of the dependent parameters in the arguments change
+	set_property value [expr [get_property value ${PARAM_VALUE.g_NUM_LFOS}] * 32] ${PARAM_VALUE.C_M_AXIS_OUTPUT_TDATA_WIDTH}
 }
 
 proc validate_PARAM_VALUE.C_M_AXIS_OUTPUT_TDATA_WIDTH { PARAM_VALUE.C_M_AXIS_OUTPUT_TDATA_WIDTH } {
@@ -105,3 +117,8 @@ proc update_MODELPARAM_VALUE.g_NUM_CHANNELS { MODELPARAM_VALUE.g_NUM_CHANNELS PA
 	set_property value [get_property value ${PARAM_VALUE.g_NUM_CHANNELS}] ${MODELPARAM_VALUE.g_NUM_CHANNELS}
 }
 
+proc update_MODELPARAM_VALUE.g_NUM_LFOS { MODELPARAM_VALUE.g_NUM_LFOS PARAM_VALUE.g_NUM_LFOS } {
+	# Procedure called to set VHDL generic/Verilog parameter value(s) based on TCL parameter value
+	set_property value [get_property value ${PARAM_VALUE.g_NUM_LFOS}] ${MODELPARAM_VALUE.g_NUM_LFOS}
+}
+
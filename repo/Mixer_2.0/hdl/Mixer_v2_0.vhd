@@ -2,19 +2,53 @@ library ieee;
 use ieee.std_logic_1164.all;
 use ieee.numeric_std.all;
 use ieee.math_real.all;
+use work.synth_config_package.all;
 
 entity Mixer_v2_0 is
 	generic (
-        g_NUM_CHANNELS : integer := 128;
+        g_NUM_CHANNELS : integer := c_NUM_CHANNELS;
         g_DATA_WIDTH   : integer := 24;
 
+		-- Parameters of Axi Slave Bus Interface S_AXI_CTRL
+		C_S_AXI_CTRL_DATA_WIDTH	: integer	:= 32;
+		C_S_AXI_CTRL_ADDR_WIDTH	: integer	:= 4;
+
 		-- Parameters of Axi Slave Bus Interface S_AXIS_INPUT
 		C_S_AXIS_INPUT_TDATA_WIDTH	: integer	:= 32
 	);
 	port (
 		i_en                : in std_logic;
-        i_active_channels   : in  std_logic_vector(6 downto 0);
+        i_active_channels   : in  std_logic_vector(c_COUNT_WIDTH-1 downto 0);
         o_output            : out std_logic_vector(g_DATA_WIDTH-1 downto 0);
+        o_output_left       : out std_logic_vector(g_DATA_WIDTH-1 downto 0);
+        o_output_right      : out std_logic_vector(g_DATA_WIDTH-1 downto 0);
+        -- capture tap of the mix and of one voice
+        o_output_valid      : out std_logic;
+        i_voice_select      : in  std_logic_vector(c_CHANNEL_WIDTH-1 downto 0) := (others => '0');
+        o_voice_output      : out std_logic_vector(g_DATA_WIDTH-1 downto 0);
+
+		-- Ports of Axi Slave Bus Interface S_AXI_CTRL
+		s_axi_ctrl_aclk	: in std_logic;
+		s_axi_ctrl_aresetn	: in std_logic;
+		s_axi_ctrl_awaddr	: in std_logic_vector(C_S_AXI_CTRL_ADDR_WIDTH-1 downto 0);
+		s_axi_ctrl_awprot	: in std_logic_vector(2 downto 0);
+		s_axi_ctrl_awvalid	: in std_logic;
+		s_axi_ctrl_awready	: out std_logic;
+		s_axi_ctrl_wdata	: in std_logic_vector(C_S_AXI_CTRL_DATA_WIDTH-1 downto 0);
+		s_axi_ctrl_wstrb	: in std_logic_vector((C_S_AXI_CTRL_DATA_WIDTH/8)-1 downto 0);
+		s_axi_ctrl_wvalid	: in std_logic;
+		s_axi_ctrl_wready	: out std_logic;
+		s_axi_ctrl_bresp	: out std_logic_vector(1 downto 0);
+		s_axi_ctrl_bvalid	: out std_logic;
+		s_axi_ctrl_bready	: in std_logic;
+		s_axi_ctrl_araddr	: in std_logic_vector(C_S_AXI_CTRL_ADDR_WIDTH-1 downto 0);
+		s_axi_ctrl_arprot	: in std_logic_vector(2 downto 0);
+		s_axi_ctrl_arvalid	: in std_logic;
+		s_axi_ctrl_arready	: out std_logic;
+		s_axi_ctrl_rdata	: out std_logic_vector(C_S_AXI_CTRL_DATA_WIDTH-1 downto 0);
+		s_axi_ctrl_rresp	: out std_logic_vector(1 downto 0);
+		s_axi_ctrl_rvalid	: out std_logic;
+		s_axi_ctrl_rready	: in std_logic;
 
 		-- Ports of Axi Slave Bus Interface S_AXIS_INPUT
 		s_axis_input_aclk	: in std_logic;
@@ -35,8 +69,53 @@ architecture arch_imp of Mixer_v2_0 is
     signal w_input_fifo_rd_data : std_logic_vector(c_DATA_WIDTH-1 downto 0);
 	signal w_input_fifo_empty   : std_logic;
     
+    -- stereo mix signals
+    signal w_stereo_en      : std_logic;
+    signal w_channel_select : std_logic_vector(c_CHANNEL_WIDTH-1 downto 0);
+    signal w_pan            : std_logic_vector(8 downto 0);
+    
+    -- fifo status signals
+    signal w_fifo_level_status : std_logic_vector(31 downto 0);
+    signal w_fifo_error_status : std_logic_vector(31 downto 0);
+    
 begin
 
+-- Instantiation of Axi Bus Interface S_AXI_CTRL
+    Mixer_v2_0_S_AXI_CTRL_inst : entity work.Mixer_v2_0_S_AXI_CTRL
+	generic map (
+        g_NUM_CHANNELS      => g_NUM_CHANNELS,
+		C_S_AXI_DATA_WIDTH	=> C_S_AXI_CTRL_DATA_WIDTH,
+		C_S_AXI_ADDR_WIDTH	=> C_S_AXI_CTRL_ADDR_WIDTH
+	)
+	port map (
+        o_stereo_en         => w_stereo_en,
+        i_channel_select    => w_channel_select,
+        o_pan               => w_pan,
+        i_fifo_level_status => w_fifo_level_status,
+        i_fifo_error_status => w_fifo_error_status,
+		S_AXI_ACLK	=> s_axi_ctrl_aclk,
+		S_AXI_ARESETN	=> s_axi_ctrl_aresetn,
+		S_AXI_AWADDR	=> s_axi_ctrl_awaddr,
+		S_AXI_AWPROT	=> s_axi_ctrl_awprot,
+		S_AXI_AWVALID	=> s_axi_ctrl_awvalid,
+		S_AXI_AWREADY	=> s_axi_ctrl_awready,
+		S_AXI_WDATA	=> s_axi_ctrl_wdata,
+		S_AXI_WSTRB	=> s_axi_ctrl_wstrb,
+		S_AXI_WVALID	=> s_axi_ctrl_wvalid,
+		S_AXI_WREADY	=> s_axi_ctrl_wready,
+		S_AXI_BRESP	=> s_axi_ctrl_bresp,
+		S_AXI_BVALID	=> s_axi_ctrl_bvalid,
+		S_AXI_BREADY	=> s_axi_ctrl_bready,
+		S_AXI_ARADDR	=> s_axi_ctrl_araddr,
+		S_AXI_ARPROT	=> s_axi_ctrl_arprot,
+		S_AXI_ARVALID	=> s_axi_ctrl_arvalid,
+		S_AXI_ARREADY	=> s_axi_ctrl_arready,
+		S_AXI_RDATA	=> s_axi_ctrl_rdata,
+		S_AXI_RRESP	=> s_axi_ctrl_rresp,
+		S_AXI_RVALID	=> s_axi_ctrl_rvalid,
+		S_AXI_RREADY	=> s_axi_ctrl_rready
+	);
+
 -- Instantiation of Axi Bus Interface S_AXIS_INPUT
     Mixer_v2_0_S_AXIS_INPUT_inst : entity work.Mixer_v2_0_S_AXIS_INPUT
 	generic map (
@@ -48,6 +127,8 @@ begin
         i_fifo_rd_en    => w_input_fifo_rd_en,
         o_fifo_rd_data  => w_input_fifo_rd_data,
         o_fifo_empty    => w_input_fifo_empty,
+        o_fifo_level_status => w_fifo_level_status,
+        o_fifo_error_status => w_fifo_error_status,
         S_AXIS_ACLK	    => s_axis_input_aclk,
         S_AXIS_ARESETN	=> s_axis_input_aresetn,
         S_AXIS_TREADY	=> s_axis_input_tready,
@@ -69,7 +150,15 @@ begin
         o_input_fifo_rd_en   => w_input_fifo_rd_en,
         i_input_fifo_rd_data => w_input_fifo_rd_data,
 	    i_input_fifo_empty   => w_input_fifo_empty,
-        o_output             => o_output
+        o_output             => o_output,
+        i_stereo_en          => w_stereo_en,
+        o_channel_select     => w_channel_select,
+        i_pan                => w_pan,
+        o_output_left        => o_output_left,
+        o_output_right       => o_output_right,
+        o_output_valid       => o_output_valid,
+        i_voice_select       => i_voice_select,
+        o_voice_output       => o_voice_output
     );
 
 end arch_imp;
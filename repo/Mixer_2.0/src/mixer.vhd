@@ -2,26 +2,37 @@ library ieee;
 use ieee.std_logic_1164.all;
 use ieee.numeric_std.all;
 use ieee.math_real.all;
+use work.synth_config_package.all;
 
 entity mixer is
     generic(
-        g_NUM_CHANNELS : integer := 128;
+        g_NUM_CHANNELS : integer := c_NUM_CHANNELS;
         g_DATA_WIDTH   : integer := 24
     );
     port(
         i_clk                : in std_logic;
         i_en                 : in std_logic;
-        i_active_channels    : in std_logic_vector(6 downto 0);
+        i_active_channels    : in std_logic_vector(c_COUNT_WIDTH-1 downto 0);
         o_input_fifo_rd_en   : out std_logic;
         i_input_fifo_rd_data : in std_logic_vector(g_DATA_WIDTH-1 downto 0);
 	    i_input_fifo_empty   : in std_logic; 
-        o_output             : out std_logic_vector(g_DATA_WIDTH-1 downto 0)
+        o_output             : out std_logic_vector(g_DATA_WIDTH-1 downto 0);
+        -- stereo mix, per channel pan {0: left, 128: centre, 256: right}
+        i_stereo_en          : in std_logic;
+        o_channel_select     : out std_logic_vector(c_CHANNEL_WIDTH-1 downto 0);
+        i_pan                : in std_logic_vector(8 downto 0);
+        o_output_left        : out std_logic_vector(g_DATA_WIDTH-1 downto 0);
+        o_output_right       : out std_logic_vector(g_DATA_WIDTH-1 downto 0);
+        -- capture tap, pulsed when o_output and o_voice_output are updated
+        o_output_valid       : out std_logic;
+        i_voice_select       : in std_logic_vector(c_CHANNEL_WIDTH-1 downto 0);
+        o_voice_output       : out std_logic_vector(g_DATA_WIDTH-1 downto 0)
     );
 end entity mixer;
 
 architecture arch of mixer is
     -- FSM states
-    type t_state is (idle, processing, output);
+    type t_state is (idle, processing, flush, output);
     
     signal r_state : t_state := idle;
     
@@ -52,50 +63,128 @@ architecture arch of mixer is
 
     constant C_COEFFICIENTS : t_coef_array := coefficients(g_NUM_CHANNELS);
 
+    -- Scale the sum of all channels by the number of active channels
+    function normalise (accumulator : signed; active_channels : integer) return signed is
+    begin
+        if active_channels = 0 then
+            return resize(accumulator, g_DATA_WIDTH);
+        elsif active_channels <= 8 then
+            return resize(shift_right(accumulator, 3), g_DATA_WIDTH);
+        else
+            return resize(shift_right(accumulator * C_COEFFICIENTS(active_channels-1), 15), g_DATA_WIDTH);
+        end if;
+    end function;
+
+    -- Constant power pan law, gain cos(pan*pi/512) in Q1.15, the right channel uses 256-pan
+    type t_pan_table is array (0 to 256) of signed(15 downto 0);
+
+    function pan_table return t_pan_table is
+        variable table : t_pan_table;
+    begin
+        for Idx in 0 to 256 loop
+            table(Idx) := to_signed(integer(round((2.0**15.0-1.0)*cos(real(Idx)*MATH_PI/512.0))), 16);
+        end loop;
+        return table;
+    end function;
+
+    constant C_PAN_TABLE : t_pan_table := pan_table;
+
     signal r_active_channels : integer;
+    signal r_channel_index   : integer range 0 to g_NUM_CHANNELS-1 := 0;
+    signal w_pan             : integer range 0 to 256;
 
     signal r_output : signed(g_DATA_WIDTH-1 downto 0);
+
+    -- stereo accumulation, the pan gains are applied one cycle after the read
+    signal r_stereo         : std_logic := '0';
+    signal r_stereo_valid   : std_logic := '0';
+    signal r_stereo_sample  : signed(g_DATA_WIDTH-1 downto 0) := (others => '0');
+    signal r_gain_left      : signed(15 downto 0) := (others => '0');
+    signal r_gain_right     : signed(15 downto 0) := (others => '0');
+    signal r_acc_left       : signed(c_ACCUM_WIDTH+15-1 downto 0) := (others => '0');
+    signal r_acc_right      : signed(c_ACCUM_WIDTH+15-1 downto 0) := (others => '0');
+    signal r_output_left    : signed(g_DATA_WIDTH-1 downto 0) := (others => '0');
+    signal r_output_right   : signed(g_DATA_WIDTH-1 downto 0) := (others => '0');
+
+    signal r_output_valid : std_logic := '0';
+    signal r_voice_sample : std_logic_vector(g_DATA_WIDTH-1 downto 0) := (others => '0');
+    signal r_voice_output : std_logic_vector(g_DATA_WIDTH-1 downto 0) := (others => '0');
 begin
 
     process(i_clk)
-        variable channel_index : integer;
     begin   
         if rising_edge(i_clk) then
+            r_output_valid <= '0';
+            r_stereo_valid <= '0';
+
             case r_state is
                 when idle =>
                     
                     if i_en = '1' and i_input_fifo_empty = '0' then
                         r_state   <= processing;
                         r_accumulator <= (others => '0');
-                        channel_index := 0;
+                        r_acc_left    <= (others => '0');
+                        r_acc_right   <= (others => '0');
+                        r_channel_index <= 0;
                         r_active_channels <= to_integer(unsigned(i_active_channels));
+                        r_stereo <= i_stereo_en;
                     end if;
                     
                 when processing =>
                     r_accumulator <= r_accumulator + resize(signed(i_input_fifo_rd_data), r_accumulator'length);
+
+                    -- pan gains of the current channel
+                    r_stereo_valid  <= r_stereo;
+                    r_stereo_sample <= signed(i_input_fifo_rd_data);
+                    r_gain_left     <= C_PAN_TABLE(w_pan);
+                    r_gain_right    <= C_PAN_TABLE(256 - w_pan);
+
+                    if r_channel_index = to_integer(unsigned(i_voice_select)) then
+                        r_voice_sample <= i_input_fifo_rd_data;
+                    end if;
                     
-                    channel_index := channel_index + 1;
-                    if channel_index = g_NUM_CHANNELS then
-                        channel_index := 0;             
-                        r_state  <= output;
+                    if r_channel_index = g_NUM_CHANNELS-1 then
+                        r_channel_index <= 0;             
+                        r_state  <= flush;
+                    else
+                        r_channel_index <= r_channel_index + 1;
                     end if;
+                
+                -- the last channel is added to the stereo accumulators
+                when flush =>
+                    r_state  <= output;
                    
                 when output =>
                     r_state  <= idle;
+                    r_output_valid <= '1';
+                    r_voice_output <= r_voice_sample;
                     
-                    if r_active_channels = 0 then
-                        r_output <= resize(r_accumulator, g_DATA_WIDTH);
-                    elsif r_active_channels <= 8 then
-                        r_output <= resize(shift_right(r_accumulator, 3), g_DATA_WIDTH);
+                    r_output <= normalise(r_accumulator, r_active_channels);
+                    if r_stereo = '1' then
+                        r_output_left  <= normalise(resize(shift_right(r_acc_left, 15), c_ACCUM_WIDTH), r_active_channels);
+                        r_output_right <= normalise(resize(shift_right(r_acc_right, 15), c_ACCUM_WIDTH), r_active_channels);
                     else
-                        r_output <= resize(shift_right(r_accumulator * C_COEFFICIENTS(r_active_channels-1), 15), g_DATA_WIDTH);        
-                    end if;                   
+                        r_output_left  <= normalise(r_accumulator, r_active_channels);
+                        r_output_right <= normalise(r_accumulator, r_active_channels);
+                    end if;
             end case;
+            
+            if r_stereo_valid = '1' then
+                r_acc_left  <= r_acc_left + r_stereo_sample * r_gain_left;
+                r_acc_right <= r_acc_right + r_stereo_sample * r_gain_right;
+            end if;
         end if;
     end process;
     
     o_input_fifo_rd_en <= '1' when r_state = processing else '0';
+    o_channel_select   <= std_logic_vector(to_unsigned(r_channel_index, o_channel_select'length));
+    w_pan              <= 256 when unsigned(i_pan) > 256 else to_integer(unsigned(i_pan));
     
     o_output <= std_logic_vector(r_output);
+    o_output_left  <= std_logic_vector(r_output_left);
+    o_output_right <= std_logic_vector(r_output_right);
+
+    o_output_valid <= r_output_valid;
+    o_voice_output <= r_voice_output;
 
 end arch;
\ No newline at end of file
@@ -0,0 +1,263 @@
+library ieee;
+use ieee.std_logic_1164.all;
+use ieee.numeric_std.all;
+
+entity Mod_Matrix_v1_0 is
+	generic (
+		-- Users to add parameters here
+        g_NUM_CHANNELS   : integer := 128;
+        g_DATA_WIDTH     : integer := 24;
+        g_NUM_LFOS       : integer := 3; -- at most 4
+        g_NUM_ENVELOPES  : integer := 2; -- at most 4
+
+		-- Parameters of Axi Slave Bus Interface S_AXI_CTRL
+		C_S_AXI_CTRL_DATA_WIDTH	: integer	:= 32;
+		C_S_AXI_CTRL_ADDR_WIDTH	: integer	:= 8;
+
+		-- Parameters of Axi Slave Bus Interface S_AXIS_LFO
+		C_S_AXIS_LFO_TDATA_WIDTH	: integer	:= 96;
+
+		-- Parameters of Axi Slave Bus Interface S_AXIS_ENVELOPE
+		C_S_AXIS_ENVELOPE_TDATA_WIDTH	: integer	:= 64;
+
+		-- Parameters of Axi Master Bus Interface M_AXIS_OUTPUT
+		C_M_AXIS_OUTPUT_TDATA_WIDTH	: integer	:= 128;
+		C_M_AXIS_OUTPUT_START_COUNT	: integer	:= 32
+	);
+	port (
+		-- Users to add ports here
+        i_enable : in std_logic;
+
+		-- Ports of Axi Slave Bus Interface S_AXI_CTRL
+		s_axi_ctrl_aclk	: in std_logic;
+		s_axi_ctrl_aresetn	: in std_logic;
+		s_axi_ctrl_awaddr	: in std_logic_vector(C_S_AXI_CTRL_ADDR_WIDTH-1 downto 0);
+		s_axi_ctrl_awprot	: in std_logic_vector(2 downto 0);
+		s_axi_ctrl_awvalid	: in std_logic;
+		s_axi_ctrl_awready	: out std_logic;
+		s_axi_ctrl_wdata	: in std_logic_vector(C_S_AXI_CTRL_DATA_WIDTH-1 downto 0);
+		s_axi_ctrl_wstrb	: in std_logic_vector((C_S_AXI_CTRL_DATA_WIDTH/8)-1 downto 0);
+		s_axi_ctrl_wvalid	: in std_logic;
+		s_axi_ctrl_wready	: out std_logic;
+		s_axi_ctrl_bresp	: out std_logic_vector(1 downto 0);
+		s_axi_ctrl_bvalid	: out std_logic;
+		s_axi_ctrl_bready	: in std_logic;
+		s_axi_ctrl_araddr	: in std_logic_vector(C_S_AXI_CTRL_ADDR_WIDTH-1 downto 0);
+		s_axi_ctrl_arprot	: in std_logic_vector(2 downto 0);
+		s_axi_ctrl_arvalid	: in std_logic;
+		s_axi_ctrl_arready	: out std_logic;
+		s_axi_ctrl_rdata	: out std_logic_vector(C_S_AXI_CTRL_DATA_WIDTH-1 downto 0);
+		s_axi_ctrl_rresp	: out std_logic_vector(1 downto 0);
+		s_axi_ctrl_rvalid	: out std_logic;
+		s_axi_ctrl_rready	: in std_logic;
+
+		-- Ports of Axi Slave Bus Interface S_AXIS_LFO
+		s_axis_lfo_aclk	: in std_logic;
+		s_axis_lfo_aresetn	: in std_logic;
+		s_axis_lfo_tready	: out std_logic;
+		s_axis_lfo_tdata	: in std_logic_vector(C_S_AXIS_LFO_TDATA_WIDTH-1 downto 0);
+		s_axis_lfo_tstrb	: in std_logic_vector((C_S_AXIS_LFO_TDATA_WIDTH/8)-1 downto 0);
+		s_axis_lfo_tlast	: in std_logic;
+		s_axis_lfo_tvalid	: in std_logic;
+
+		-- Ports of Axi Slave Bus Interface S_AXIS_ENVELOPE
+		s_axis_envelope_aclk	: in std_logic;
+		s_axis_envelope_aresetn	: in std_logic;
+		s_axis_envelope_tready	: out std_logic;
+		s_axis_envelope_tdata	: in std_logic_vector(C_S_AXIS_ENVELOPE_TDATA_WIDTH-1 downto 0);
+		s_axis_envelope_tstrb	: in std_logic_vector((C_S_AXIS_ENVELOPE_TDATA_WIDTH/8)-1 downto 0);
+		s_axis_envelope_tlast	: in std_logic;
+		s_axis_envelope_tvalid	: in std_logic;
+
+		-- Ports of Axi Master Bus Interface M_AXIS_OUTPUT
+		m_axis_output_aclk	: in std_logic;
+		m_axis_output_aresetn	: in std_logic;
+		m_axis_output_tvalid	: out std_logic;
+		m_axis_output_tdata	: out std_logic_vector(C_M_AXIS_OUTPUT_TDATA_WIDTH-1 downto 0);
+		m_axis_output_tstrb	: out std_logic_vector((C_M_AXIS_OUTPUT_TDATA_WIDTH/8)-1 downto 0);
+		m_axis_output_tlast	: out std_logic;
+		m_axis_output_tready	: in std_logic
+	);
+end Mod_Matrix_v1_0;
+
+architecture arch_imp of Mod_Matrix_v1_0 is
+
+    constant c_NUM_DESTINATIONS : integer := 4;
+    constant c_PIPELINE_DEPTH   : integer := 4;
+
+    -- routing amounts
+    signal w_amount : std_logic_vector(c_NUM_DESTINATIONS*8*18-1 downto 0);
+    -- output fifo signals
+	signal w_output_fifo_wr_en   : std_logic;
+	signal w_output_fifo_wr_data : std_logic_vector(c_NUM_DESTINATIONS*g_DATA_WIDTH-1 downto 0);
+	signal w_output_fifo_almost_full : std_logic;
+	-- lfo fifo signals
+	signal w_lfo_fifo_rd_en   : std_logic;
+    signal w_lfo_fifo_rd_data : std_logic_vector(g_NUM_LFOS*g_DATA_WIDTH-1 downto 0);
+	signal w_lfo_fifo_empty   : std_logic;
+	-- envelope fifo signals
+	signal w_envelope_fifo_rd_en   : std_logic;
+    signal w_envelope_fifo_rd_data : std_logic_vector(g_NUM_ENVELOPES*g_DATA_WIDTH-1 downto 0);
+	signal w_envelope_fifo_empty   : std_logic;
+	-- fifo status signals
+    signal w_fifo_select                : std_logic_vector(1 downto 0);
+    signal w_fifo_level_status          : std_logic_vector(31 downto 0);
+    signal w_fifo_error_status          : std_logic_vector(31 downto 0);
+    signal w_lfo_fifo_level_status      : std_logic_vector(31 downto 0);
+    signal w_lfo_fifo_error_status      : std_logic_vector(31 downto 0);
+    signal w_envelope_fifo_level_status : std_logic_vector(31 downto 0);
+    signal w_envelope_fifo_error_status : std_logic_vector(31 downto 0);
+    signal w_output_fifo_level_status   : std_logic_vector(31 downto 0);
+    signal w_output_fifo_error_status   : std_logic_vector(31 downto 0);
+    -- flow status signals
+    signal w_flow_status_clear : std_logic;
+    signal w_overflow_count    : std_logic_vector(15 downto 0);
+    signal w_underrun_count    : std_logic_vector(15 downto 0);
+
+begin
+
+-- Instantiation of Axi Bus Interface S_AXI_CTRL
+    Mod_Matrix_v1_0_S_AXI_CTRL_inst : entity work.Mod_Matrix_v1_0_S_AXI_CTRL
+	generic map (
+		C_S_AXI_DATA_WIDTH	=> C_S_AXI_CTRL_DATA_WIDTH,
+		C_S_AXI_ADDR_WIDTH	=> C_S_AXI_CTRL_ADDR_WIDTH
+	)
+	port map (
+        o_amount            => w_amount,
+        o_flow_status_clear => w_flow_status_clear,
+        i_flow_status       => w_underrun_count & w_overflow_count,
+        o_fifo_select       => w_fifo_select,
+        i_fifo_level_status => w_fifo_level_status,
+        i_fifo_error_status => w_fifo_error_status,
+		S_AXI_ACLK  	=> s_axi_ctrl_aclk,
+		S_AXI_ARESETN	=> s_axi_ctrl_aresetn,
+		S_AXI_AWADDR	=> s_axi_ctrl_awaddr,
+		S_AXI_AWPROT	=> s_axi_ctrl_awprot,
+		S_AXI_AWVALID	=> s_axi_ctrl_awvalid,
+		S_AXI_AWREADY	=> s_axi_ctrl_awready,
+		S_AXI_WDATA	    => s_axi_ctrl_wdata,
+		S_AXI_WSTRB  	=> s_axi_ctrl_wstrb,
+		S_AXI_WVALID	=> s_axi_ctrl_wvalid,
+		S_AXI_WREADY	=> s_axi_ctrl_wready,
+		S_AXI_BRESP 	=> s_axi_ctrl_bresp,
+		S_AXI_BVALID	=> s_axi_ctrl_bvalid,
+		S_AXI_BREADY	=> s_axi_ctrl_bready,
+		S_AXI_ARADDR	=> s_axi_ctrl_araddr,
+		S_AXI_ARPROT	=> s_axi_ctrl_arprot,
+		S_AXI_ARVALID	=> s_axi_ctrl_arvalid,
+		S_AXI_ARREADY	=> s_axi_ctrl_arready,
+		S_AXI_RDATA 	=> s_axi_ctrl_rdata,
+		S_AXI_RRESP 	=> s_axi_ctrl_rresp,
+		S_AXI_RVALID	=> s_axi_ctrl_rvalid,
+		S_AXI_RREADY	=> s_axi_ctrl_rready
+	);
+
+-- Instantiation of Axi Bus Interface S_AXIS_LFO
+    Mod_Matrix_v1_0_S_AXIS_LFO_inst : entity work.Mod_Matrix_v1_0_S_AXIS_LFO
+	generic map (
+	    g_NUM_CHANNELS        => g_NUM_CHANNELS,
+        g_DATA_WIDTH          => g_DATA_WIDTH,
+        g_NUM_LFOS            => g_NUM_LFOS,
+		C_S_AXIS_TDATA_WIDTH  => C_S_AXIS_LFO_TDATA_WIDTH
+	)
+	port map (
+	    i_fifo_rd_en    => w_lfo_fifo_rd_en,
+        o_fifo_rd_data  => w_lfo_fifo_rd_data,
+	    o_fifo_empty    => w_lfo_fifo_empty,
+        o_fifo_level_status => w_lfo_fifo_level_status,
+        o_fifo_error_status => w_lfo_fifo_error_status,
+		S_AXIS_ACLK	    => s_axis_lfo_aclk,
+		S_AXIS_ARESETN	=> s_axis_lfo_aresetn,
+		S_AXIS_TREADY	=> s_axis_lfo_tready,
+		S_AXIS_TDATA	=> s_axis_lfo_tdata,
+		S_AXIS_TSTRB	=> s_axis_lfo_tstrb,
+		S_AXIS_TLAST	=> s_axis_lfo_tlast,
+		S_AXIS_TVALID	=> s_axis_lfo_tvalid
+	);
+
+    -- Instantiation of Axi Bus Interface S_AXIS_ENVELOPE
+    Mod_Matrix_v1_0_S_AXIS_ENVELOPE_inst : entity work.Mod_Matrix_v1_0_S_AXIS_ENVELOPE
+	generic map (
+	    g_NUM_CHANNELS        => g_NUM_CHANNELS,
+        g_DATA_WIDTH          => g_DATA_WIDTH,
+        g_NUM_ENVELOPES       => g_NUM_ENVELOPES,
+		C_S_AXIS_TDATA_WIDTH  => C_S_AXIS_ENVELOPE_TDATA_WIDTH
+	)
+	port map (
+	    i_fifo_rd_en    => w_envelope_fifo_rd_en,
+        o_fifo_rd_data  => w_envelope_fifo_rd_data,
+	    o_fifo_empty    => w_envelope_fifo_empty,
+        o_fifo_level_status => w_envelope_fifo_level_status,
+        o_fifo_error_status => w_envelope_fifo_error_status,
+		S_AXIS_ACLK 	=> s_axis_envelope_aclk,
+		S_AXIS_ARESETN	=> s_axis_envelope_aresetn,
+		S_AXIS_TREADY	=> s_axis_envelope_tready,
+		S_AXIS_TDATA	=> s_axis_envelope_tdata,
+		S_AXIS_TSTRB	=> s_axis_envelope_tstrb,
+		S_AXIS_TLAST	=> s_axis_envelope_tlast,
+		S_AXIS_TVALID	=> s_axis_envelope_tvalid
+	);
+
+    -- Instantiation of Axi Bus Interface M_AXIS_OUTPUT
+    Mod_Matrix_v1_0_M_AXIS_OUTPUT_inst : entity work.Mod_Matrix_v1_0_M_AXIS_OUTPUT
+	generic map (
+	    g_NUM_CHANNELS        => g_NUM_CHANNELS,
+        g_DATA_WIDTH          => g_DATA_WIDTH,
+        g_NUM_DESTINATIONS    => c_NUM_DESTINATIONS,
+        g_FIFO_ALMOST_FULL_OFFSET => c_PIPELINE_DEPTH,
+		C_M_AXIS_TDATA_WIDTH  => C_M_AXIS_OUTPUT_TDATA_WIDTH,
+		C_M_START_COUNT	      => C_M_AXIS_OUTPUT_START_COUNT
+	)
+	port map (
+	    i_fifo_wr_en    => w_output_fifo_wr_en,
+        i_fifo_wr_data  => w_output_fifo_wr_data,
+	    o_fifo_almost_full => w_output_fifo_almost_full,
+        o_fifo_level_status => w_output_fifo_level_status,
+        o_fifo_error_status => w_output_fifo_error_status,
+		M_AXIS_ACLK 	=> m_axis_output_aclk,
+		M_AXIS_ARESETN	=> m_axis_output_aresetn,
+		M_AXIS_TVALID	=> m_axis_output_tvalid,
+		M_AXIS_TDATA	=> m_axis_output_tdata,
+		M_AXIS_TSTRB	=> m_axis_output_tstrb,
+		M_AXIS_TLAST	=> m_axis_output_tlast,
+		M_AXIS_TREADY	=> m_axis_output_tready
+	);
+
+    mod_matrix_module : entity work.mod_matrix
+    generic map(
+        g_NUM_CHANNELS  => g_NUM_CHANNELS,
+        g_DATA_WIDTH    => g_DATA_WIDTH,
+        g_NUM_LFOS      => g_NUM_LFOS,
+        g_NUM_ENVELOPES => g_NUM_ENVELOPES
+    )
+    port map(
+        i_clk                    => s_axis_lfo_aclk,
+        i_enable                 => i_enable,
+        i_amount                 => w_amount,
+        -- lfo fifo interface
+        o_lfo_fifo_rd_en         => w_lfo_fifo_rd_en,
+        i_lfo_fifo_rd_data       => w_lfo_fifo_rd_data,
+	    i_lfo_fifo_empty         => w_lfo_fifo_empty,
+        -- envelope fifo interface
+        o_envelope_fifo_rd_en    => w_envelope_fifo_rd_en,
+        i_envelope_fifo_rd_data  => w_envelope_fifo_rd_data,
+	    i_envelope_fifo_empty    => w_envelope_fifo_empty,
+        -- output fifo interface
+        o_output_fifo_wr_en      => w_output_fifo_wr_en,
+        o_output_fifo_wr_data    => w_output_fifo_wr_data,
+	    i_output_fifo_almost_full => w_output_fifo_almost_full,
+        -- flow status
+	    i_flow_status_clear       => w_flow_status_clear,
+	    o_overflow_count          => w_overflow_count,
+	    o_underrun_count          => w_underrun_count
+    );
+
+    -- fifo status {lfo, envelope, output}
+    w_fifo_level_status <= w_lfo_fifo_level_status      when w_fifo_select = "00" else
+                           w_envelope_fifo_level_status when w_fifo_select = "01" else
+                           w_output_fifo_level_status;
+    w_fifo_error_status <= w_lfo_fifo_error_status      when w_fifo_select = "00" else
+                           w_envelope_fifo_error_status when w_fifo_select = "01" else
+                           w_output_fifo_error_status;
+
+end arch_imp;
@@ -0,0 +1,101 @@
+library ieee;
+use ieee.std_logic_1164.all;
+use ieee.numeric_std.all;
+
+entity Mod_Matrix_v1_0_M_AXIS_OUTPUT is
+	generic (
+		-- Users to add parameters here
+        g_NUM_CHANNELS            : integer := 128;
+        g_DATA_WIDTH              : integer := 24;
+        g_NUM_DESTINATIONS        : integer := 4;             -- each destination is sent in its own 32 bit slot of TDATA
+        g_FIFO_MEMORY_TYPE        : string  := "distributed"; -- {"registers", "distributed", "block"}
+        g_FIFO_ALMOST_FULL_OFFSET : integer := 1;             -- free words reserved for samples in flight
+		-- User parameters ends
+		-- Do not modify the parameters beyond this line
+
+		-- Width of S_AXIS address bus. The slave accepts the read and write addresses of width C_M_AXIS_TDATA_WIDTH.
+		C_M_AXIS_TDATA_WIDTH	: integer	:= 128;
+		-- Start count is the number of clock cycles the master will wait before initiating/issuing any transaction.
+		C_M_START_COUNT	: integer	:= 32
+	);
+	port (
+		-- Users to add ports here
+        i_fifo_wr_en   : in  std_logic;
+        i_fifo_wr_data : in std_logic_vector(g_NUM_DESTINATIONS*g_DATA_WIDTH-1 downto 0);
+	    o_fifo_almost_full : out std_logic;
+        -- FIFO status
+        o_fifo_level_status : out std_logic_vector(31 downto 0); -- high watermark & level
+        o_fifo_error_status : out std_logic_vector(31 downto 0); -- underflow count & overflow count
+		-- User ports ends
+		-- Do not modify the ports beyond this line
+
+		-- Global ports
+		M_AXIS_ACLK	: in std_logic;
+		-- 
+		M_AXIS_ARESETN	: in std_logic;
+		-- Master Stream Ports. TVALID indicates that the master is driving a valid transfer, A transfer takes place when both TVALID and TREADY are asserted. 
+		M_AXIS_TVALID	: out std_logic;
+		-- TDATA is the primary payload that is used to provide the data that is passing across the interface from the master.
+		M_AXIS_TDATA	: out std_logic_vector(C_M_AXIS_TDATA_WIDTH-1 downto 0);
+		-- TSTRB is the byte qualifier that indicates whether the content of the associated byte of TDATA is processed as a data byte or a position byte.
+		M_AXIS_TSTRB	: out std_logic_vector((C_M_AXIS_TDATA_WIDTH/8)-1 downto 0);
+		-- TLAST indicates the boundary of a packet.
+		M_AXIS_TLAST	: out std_logic;
+		-- TREADY indicates that the slave can accept a transfer in the current cycle.
+		M_AXIS_TREADY	: in std_logic
+	);
+end Mod_Matrix_v1_0_M_AXIS_OUTPUT;
+
+architecture implementation of Mod_Matrix_v1_0_M_AXIS_OUTPUT is
+  
+    -- FIFO write interface signals
+	signal w_fifo_rd_en   : std_logic;
+	signal w_fifo_rd_data : std_logic_vector(g_NUM_DESTINATIONS*g_DATA_WIDTH-1 downto 0);
+	signal w_fifo_empty   : std_logic;
+	
+	signal w_reset : std_logic;
+
+begin
+	-- I/O Connections assignments
+	M_AXIS_TLAST	<= '1';
+	M_AXIS_TSTRB	<= (others => '1');                                               
+
+	M_AXIS_TVALID <= not w_fifo_empty;
+	w_fifo_rd_en  <= M_AXIS_TREADY;
+	
+	w_reset <= not M_AXIS_ARESETN;
+	
+	assert C_M_AXIS_TDATA_WIDTH = 32*g_NUM_DESTINATIONS
+	    report "C_M_AXIS_TDATA_WIDTH must be 32 bits per destination" severity failure;
+
+	tdata_gen : for dest in 0 to g_NUM_DESTINATIONS-1 generate
+	    M_AXIS_TDATA(dest*32+31 downto dest*32) <= std_logic_vector(resize(unsigned(w_fifo_rd_data(dest*g_DATA_WIDTH+g_DATA_WIDTH-1 downto dest*g_DATA_WIDTH)), 32));
+	end generate;
+	
+    fifo_unit : entity work.fifo
+    generic map(
+        g_WIDTH              => g_NUM_DESTINATIONS*g_DATA_WIDTH,
+        g_DEPTH              => g_NUM_CHANNELS,
+        g_MEMORY_TYPE        => g_FIFO_MEMORY_TYPE,
+        g_ALMOST_FULL_OFFSET => g_FIFO_ALMOST_FULL_OFFSET
+    )
+    port map(
+        i_clk       => M_AXIS_ACLK,
+        i_reset     => w_reset,
+        -- FIFO write interface
+        i_wr_en     => i_fifo_wr_en,
+        i_wr_data   => i_fifo_wr_data,
+        o_full        => open,
+        o_almost_full => o_fifo_almost_full,
+        -- FIFO read interface
+        i_rd_en     => w_fifo_rd_en,
+        o_rd_data   => w_fifo_rd_data,
+        o_empty     => w_fifo_empty,
+        -- FIFO status
+        o_level           => o_fifo_level_status(15 downto 0),
+        o_high_watermark  => o_fifo_level_status(31 downto 16),
+        o_overflow_count  => o_fifo_error_status(15 downto 0),
+        o_underflow_count => o_fifo_error_status(31 downto 16)
+    );
+
+end implementation;
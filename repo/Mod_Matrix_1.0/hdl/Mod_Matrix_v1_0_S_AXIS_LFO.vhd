@@ -0,0 +1,99 @@
+library ieee;
+use ieee.std_logic_1164.all;
+use ieee.numeric_std.all;
+
+entity Mod_Matrix_v1_0_S_AXIS_LFO is
+	generic (
+		-- Users to add parameters here
+        g_NUM_CHANNELS     : integer := 128;
+        g_DATA_WIDTH       : integer := 24;
+        g_NUM_LFOS         : integer := 3;             -- each LFO is received in its own 32 bit slot of TDATA
+        g_FIFO_MEMORY_TYPE : string  := "distributed"; -- {"registers", "distributed", "block"}
+		-- User parameters ends
+		-- Do not modify the parameters beyond this line
+
+		-- AXI4Stream sink: Data Width
+		C_S_AXIS_TDATA_WIDTH	: integer	:= 96
+	);
+	port (
+		-- Users to add ports here
+        i_fifo_rd_en   : in  std_logic;
+        o_fifo_rd_data : out std_logic_vector(g_NUM_LFOS*g_DATA_WIDTH-1 downto 0);
+	    o_fifo_empty   : out std_logic;
+        -- FIFO status
+        o_fifo_level_status : out std_logic_vector(31 downto 0); -- high watermark & level
+        o_fifo_error_status : out std_logic_vector(31 downto 0); -- underflow count & overflow count
+		-- User ports ends
+		-- Do not modify the ports beyond this line
+
+		-- AXI4Stream sink: Clock
+		S_AXIS_ACLK	: in std_logic;
+		-- AXI4Stream sink: Reset
+		S_AXIS_ARESETN	: in std_logic;
+		-- Ready to accept data in
+		S_AXIS_TREADY	: out std_logic;
+		-- Data in
+		S_AXIS_TDATA	: in std_logic_vector(C_S_AXIS_TDATA_WIDTH-1 downto 0);
+		-- Byte qualifier
+		S_AXIS_TSTRB	: in std_logic_vector((C_S_AXIS_TDATA_WIDTH/8)-1 downto 0);
+		-- Indicates boundary of last packet
+		S_AXIS_TLAST	: in std_logic;
+		-- Data is in valid
+		S_AXIS_TVALID	: in std_logic
+	);
+end Mod_Matrix_v1_0_S_AXIS_LFO;
+
+architecture arch_imp of Mod_Matrix_v1_0_S_AXIS_LFO is
+		
+	-- internal axi signal
+	signal axis_tready	: std_logic;
+	
+	-- FIFO write interface signals
+	signal w_fifo_wr_en   : std_logic;
+	signal w_fifo_wr_data : std_logic_vector(g_NUM_LFOS*g_DATA_WIDTH-1 downto 0);
+	signal w_fifo_full    : std_logic;
+	
+	signal w_reset : std_logic;
+
+begin
+
+	S_AXIS_TREADY	<= axis_tready;
+
+    w_reset <= not S_AXIS_ARESETN;
+
+	axis_tready <= '1' when w_fifo_full = '0' else '0';
+	
+	w_fifo_wr_en   <= S_AXIS_TVALID and axis_tready;
+
+	assert C_S_AXIS_TDATA_WIDTH = 32*g_NUM_LFOS
+	    report "C_S_AXIS_TDATA_WIDTH must be 32 bits per LFO" severity failure;
+
+	slot_gen : for slot in 0 to g_NUM_LFOS-1 generate
+	    w_fifo_wr_data(slot*g_DATA_WIDTH+g_DATA_WIDTH-1 downto slot*g_DATA_WIDTH) <= S_AXIS_TDATA(slot*32+g_DATA_WIDTH-1 downto slot*32);
+	end generate;
+	
+    fifo_unit : entity work.fifo
+    generic map(
+        g_WIDTH       => g_NUM_LFOS*g_DATA_WIDTH,
+        g_DEPTH       => g_NUM_CHANNELS,
+        g_MEMORY_TYPE => g_FIFO_MEMORY_TYPE
+    )
+    port map(
+        i_clk       => S_AXIS_ACLK,
+        i_reset     => w_reset,
+        -- FIFO write interface
+        i_wr_en     => w_fifo_wr_en,
+        i_wr_data   => w_fifo_wr_data,
+        o_full      => w_fifo_full,
+        -- FIFO read interface
+        i_rd_en     => i_fifo_rd_en,
+        o_rd_data   => o_fifo_rd_data,
+        o_empty     => o_fifo_empty,
+        -- FIFO status
+        o_level           => o_fifo_level_status(15 downto 0),
+        o_high_watermark  => o_fifo_level_status(31 downto 16),
+        o_overflow_count  => o_fifo_error_status(15 downto 0),
+        o_underflow_count => o_fifo_error_status(31 downto 16)
+    );
+
+end arch_imp;
@@ -0,0 +1,289 @@
+-- Modulation Matrix
+-- Description:
+-- Routes the LFO and envelope streams to the per voice modulation inputs of
+-- the synth modules. Every destination is the sum of all sources scaled by
+-- their routing amount, so any source can drive any destination and several
+-- sources can be mixed on one destination:
+--
+--   destination(d) = sum over s of amount(d, s) * source(s)
+--
+-- The sources are numbered by their slot, LFO n is slot n and envelope n is
+-- slot 4+n, slots without a source read zero. The destinations are
+-- {0: pitch, 1: pulse width, 2: cutoff, 3: amplitude}.
+--
+-- One voice is issued per clock once all sources of the voice are available
+-- and the output FIFO has room for the samples in flight. After the next
+-- enable (the sample period deadline) missing sources are replaced by zero,
+-- and the late beats are dropped when they arrive so the LFO and envelope
+-- streams stay aligned on the voice.
+-- Pipeline: issue (source read) -> multiply -> sum -> saturate -> fifo write
+--
+-- Inputs:
+-- i_clk: system clk
+-- i_enable: start of the sample period
+-- i_amount: routing amounts, Q3.15, destination d and slot s at bits
+--           (d*8+s)*18+17 downto (d*8+s)*18
+-- lfo/envelope fifo read data/empty: g_DATA_WIDTH bits per source, packed
+--
+-- Outputs:
+-- o_output_fifo_wr_en/o_output_fifo_wr_data: g_DATA_WIDTH bits per
+--           destination, packed, saturated, the amplitude is not negative
+-- o_overflow_count: sample periods not started on their enable
+-- o_underrun_count: voices processed with a missing source
+
+library ieee;
+use ieee.std_logic_1164.all;
+use ieee.numeric_std.all;
+
+entity mod_matrix is
+    generic(
+        g_NUM_CHANNELS  : integer := 128;
+        g_DATA_WIDTH    : integer := 24;
+        g_NUM_LFOS      : integer := 3;
+        g_NUM_ENVELOPES : integer := 2
+    );
+    port(
+        i_clk                     : in std_logic;
+        i_enable                  : in std_logic;
+        -- routing amounts
+        i_amount                  : in std_logic_vector(4*8*18-1 downto 0);
+        -- lfo fifo interface
+        o_lfo_fifo_rd_en          : out std_logic;
+        i_lfo_fifo_rd_data        : in std_logic_vector(g_NUM_LFOS*g_DATA_WIDTH-1 downto 0);
+        i_lfo_fifo_empty          : in std_logic;
+        -- envelope fifo interface
+        o_envelope_fifo_rd_en     : out std_logic;
+        i_envelope_fifo_rd_data   : in std_logic_vector(g_NUM_ENVELOPES*g_DATA_WIDTH-1 downto 0);
+        i_envelope_fifo_empty     : in std_logic;
+        -- output fifo interface
+        o_output_fifo_wr_en       : out std_logic;
+        o_output_fifo_wr_data     : out std_logic_vector(4*g_DATA_WIDTH-1 downto 0);
+        i_output_fifo_almost_full : in std_logic; -- must leave room for the c_PIPELINE_DEPTH samples in flight
+        -- flow status
+        i_flow_status_clear       : in std_logic;
+        o_overflow_count          : out std_logic_vector(15 downto 0); -- sample periods not started on their enable
+        o_underrun_count          : out std_logic_vector(15 downto 0)  -- voices processed with a missing source
+    );
+end mod_matrix;
+
+architecture arch of mod_matrix is
+    -- constants
+    constant c_NUM_SOURCES      : integer := 8;
+    constant c_NUM_DESTINATIONS : integer := 4;
+    constant c_ENVELOPE_SLOT    : integer := 4;
+    constant c_AMOUNT_WIDTH     : integer := 18;
+    constant c_AMOUNT_FRAC      : integer := 15;
+    constant c_PRODUCT_WIDTH    : integer := g_DATA_WIDTH + c_AMOUNT_WIDTH;
+    constant c_SUM_WIDTH        : integer := c_PRODUCT_WIDTH + 3;
+    constant c_AMPLITUDE        : integer := 3;
+    constant c_MAX_COUNT        : integer := 2**16-1;
+    constant c_PIPELINE_DEPTH   : integer := 4;
+
+    constant c_MAX_OUTPUT : signed(g_DATA_WIDTH-1 downto 0) := to_signed(2**(g_DATA_WIDTH-1)-1, g_DATA_WIDTH);
+    constant c_MIN_OUTPUT : signed(g_DATA_WIDTH-1 downto 0) := to_signed(-2**(g_DATA_WIDTH-1), g_DATA_WIDTH);
+
+    -- types
+    type t_state is (idle, processing);
+    type t_source_array is array (0 to c_NUM_SOURCES-1) of signed(g_DATA_WIDTH-1 downto 0);
+    type t_product_array is array (0 to c_NUM_SOURCES-1) of signed(c_PRODUCT_WIDTH-1 downto 0);
+    type t_product_matrix is array (0 to c_NUM_DESTINATIONS-1) of t_product_array;
+    type t_sum_array is array (0 to c_NUM_DESTINATIONS-1) of signed(c_SUM_WIDTH-1 downto 0);
+    type t_output_array is array (0 to c_NUM_DESTINATIONS-1) of signed(g_DATA_WIDTH-1 downto 0);
+
+    -- signals
+    signal r_state : t_state := idle;
+
+    signal r_start_pending : std_logic := '0';
+    signal r_deadline      : std_logic := '0';
+
+    signal r_channel_index : integer range 0 to g_NUM_CHANNELS-1 := 0;
+
+    -- beats of each stream replaced by zero and not yet arrived, modulo a
+    -- sample period as a stream that skips whole periods stays voice aligned
+    signal r_lfo_missing      : integer range 0 to g_NUM_CHANNELS-1 := 0;
+    signal r_envelope_missing : integer range 0 to g_NUM_CHANNELS-1 := 0;
+
+    signal w_lfo_valid      : std_logic;
+    signal w_envelope_valid : std_logic;
+    signal w_lfo_drop       : std_logic;
+    signal w_envelope_drop  : std_logic;
+    signal w_advance        : std_logic;
+    signal w_source         : t_source_array;
+
+    -- stage 1: sources
+    signal r_valid_1  : std_logic := '0';
+    signal r_source_1 : t_source_array := (others => (others => '0'));
+
+    -- stage 2: scaled sources
+    signal r_valid_2   : std_logic := '0';
+    signal r_product_2 : t_product_matrix := (others => (others => (others => '0')));
+
+    -- stage 3: sums
+    signal r_valid_3 : std_logic := '0';
+    signal r_sum_3   : t_sum_array := (others => (others => '0'));
+
+    -- stage 4: saturated outputs
+    signal r_valid_4  : std_logic := '0';
+    signal r_output_4 : t_output_array := (others => (others => '0'));
+
+    signal r_overflow_count : integer range 0 to c_MAX_COUNT := 0;
+    signal r_underrun_count : integer range 0 to c_MAX_COUNT := 0;
+begin
+    assert g_NUM_LFOS <= c_ENVELOPE_SLOT and g_NUM_ENVELOPES <= c_NUM_SOURCES-c_ENVELOPE_SLOT
+        report "at most 4 LFOs and 4 envelopes can be routed" severity failure;
+
+    -- a beat arriving after it was replaced by zero belongs to an earlier voice
+    w_lfo_drop       <= '1' when r_lfo_missing /= 0 and i_lfo_fifo_empty = '0' else '0';
+    w_envelope_drop  <= '1' when r_envelope_missing /= 0 and i_envelope_fifo_empty = '0' else '0';
+
+    w_lfo_valid      <= '1' when r_lfo_missing = 0 and i_lfo_fifo_empty = '0' else '0';
+    w_envelope_valid <= '1' when r_envelope_missing = 0 and i_envelope_fifo_empty = '0' else '0';
+
+    -- a voice is issued once all its sources are available and the output has space,
+    -- after the next enable (the sample period deadline) missing sources are replaced by zero
+    w_advance <= '1' when r_state = processing and i_output_fifo_almost_full = '0' and
+                          ((w_lfo_valid = '1' and w_envelope_valid = '1') or r_deadline = '1') else '0';
+
+    o_lfo_fifo_rd_en      <= (w_advance and w_lfo_valid) or w_lfo_drop;
+    o_envelope_fifo_rd_en <= (w_advance and w_envelope_valid) or w_envelope_drop;
+
+    -- source slots, unused slots are zero
+    source_gen : for s in 0 to c_NUM_SOURCES-1 generate
+        lfo_gen : if s < g_NUM_LFOS generate
+            w_source(s) <= signed(i_lfo_fifo_rd_data(s*g_DATA_WIDTH+g_DATA_WIDTH-1 downto s*g_DATA_WIDTH))
+                           when w_lfo_valid = '1' else (others => '0');
+        end generate;
+        envelope_gen : if s >= c_ENVELOPE_SLOT and s < c_ENVELOPE_SLOT+g_NUM_ENVELOPES generate
+            w_source(s) <= signed(i_envelope_fifo_rd_data((s-c_ENVELOPE_SLOT)*g_DATA_WIDTH+g_DATA_WIDTH-1 downto (s-c_ENVELOPE_SLOT)*g_DATA_WIDTH))
+                           when w_envelope_valid = '1' else (others => '0');
+        end generate;
+        unused_gen : if (s >= g_NUM_LFOS and s < c_ENVELOPE_SLOT) or s >= c_ENVELOPE_SLOT+g_NUM_ENVELOPES generate
+            w_source(s) <= (others => '0');
+        end generate;
+    end generate;
+
+    process(i_clk)
+    begin
+        if rising_edge(i_clk) then
+            case r_state is
+                when idle =>
+                    r_deadline <= '0';
+                    if i_enable = '1' or r_start_pending = '1' then
+                        r_state         <= processing;
+                        r_start_pending <= '0';
+                    end if;
+
+                when processing =>
+                    -- the next sample period started before all voices were processed
+                    if i_enable = '1' then
+                        r_start_pending <= '1';
+                        r_deadline      <= '1';
+                    end if;
+
+                    if w_advance = '1' then
+                        if r_channel_index = g_NUM_CHANNELS-1 then
+                            r_channel_index <= 0;
+                            r_state <= idle;
+                        else
+                            r_channel_index <= r_channel_index + 1;
+                        end if;
+                    end if;
+            end case;
+        end if;
+    end process;
+
+    -- missing beats, counted when replaced by zero and uncounted when dropped
+    process(i_clk)
+    begin
+        if rising_edge(i_clk) then
+            if w_advance = '1' and w_lfo_valid = '0' and w_lfo_drop = '0' then
+                r_lfo_missing <= (r_lfo_missing + 1) mod g_NUM_CHANNELS;
+            elsif w_advance = '0' and w_lfo_drop = '1' then
+                r_lfo_missing <= r_lfo_missing - 1;
+            end if;
+
+            if w_advance = '1' and w_envelope_valid = '0' and w_envelope_drop = '0' then
+                r_envelope_missing <= (r_envelope_missing + 1) mod g_NUM_CHANNELS;
+            elsif w_advance = '0' and w_envelope_drop = '1' then
+                r_envelope_missing <= r_envelope_missing - 1;
+            end if;
+        end if;
+    end process;
+
+    -- routing pipeline
+    process(i_clk)
+        variable v_amount : signed(c_AMOUNT_WIDTH-1 downto 0);
+        variable v_sum    : signed(c_SUM_WIDTH-1 downto 0);
+    begin
+        if rising_edge(i_clk) then
+            -- stage 1
+            r_valid_1 <= w_advance;
+            if w_advance = '1' then
+                r_source_1 <= w_source;
+            end if;
+
+            -- stage 2
+            r_valid_2 <= r_valid_1;
+            for d in 0 to c_NUM_DESTINATIONS-1 loop
+                for s in 0 to c_NUM_SOURCES-1 loop
+                    v_amount := signed(i_amount((d*c_NUM_SOURCES+s)*c_AMOUNT_WIDTH+c_AMOUNT_WIDTH-1 downto (d*c_NUM_SOURCES+s)*c_AMOUNT_WIDTH));
+                    r_product_2(d)(s) <= r_source_1(s) * v_amount;
+                end loop;
+            end loop;
+
+            -- stage 3
+            r_valid_3 <= r_valid_2;
+            for d in 0 to c_NUM_DESTINATIONS-1 loop
+                v_sum := (others => '0');
+                for s in 0 to c_NUM_SOURCES-1 loop
+                    v_sum := v_sum + resize(r_product_2(d)(s), c_SUM_WIDTH);
+                end loop;
+                r_sum_3(d) <= v_sum;
+            end loop;
+
+            -- stage 4
+            r_valid_4 <= r_valid_3;
+            for d in 0 to c_NUM_DESTINATIONS-1 loop
+                v_sum := shift_right(r_sum_3(d), c_AMOUNT_FRAC);
+                if d = c_AMPLITUDE and v_sum < 0 then
+                    r_output_4(d) <= (others => '0');
+                elsif v_sum > resize(c_MAX_OUTPUT, c_SUM_WIDTH) then
+                    r_output_4(d) <= c_MAX_OUTPUT;
+                elsif v_sum < resize(c_MIN_OUTPUT, c_SUM_WIDTH) then
+                    r_output_4(d) <= c_MIN_OUTPUT;
+                else
+                    r_output_4(d) <= resize(v_sum, g_DATA_WIDTH);
+                end if;
+            end loop;
+        end if;
+    end process;
+
+    o_output_fifo_wr_en <= r_valid_4;
+
+    output_gen : for d in 0 to c_NUM_DESTINATIONS-1 generate
+        o_output_fifo_wr_data(d*g_DATA_WIDTH+g_DATA_WIDTH-1 downto d*g_DATA_WIDTH) <= std_logic_vector(r_output_4(d));
+    end generate;
+
+    -- sticky flow counters, saturate until cleared
+    process(i_clk)
+    begin
+        if rising_edge(i_clk) then
+            if i_flow_status_clear = '1' then
+                r_overflow_count <= 0;
+                r_underrun_count <= 0;
+            else
+                if i_enable = '1' and (r_state = processing or r_start_pending = '1') and r_overflow_count /= c_MAX_COUNT then
+                    r_overflow_count <= r_overflow_count + 1;
+                end if;
+
+                if w_advance = '1' and (w_lfo_valid = '0' or w_envelope_valid = '0') and r_underrun_count /= c_MAX_COUNT then
+                    r_underrun_count <= r_underrun_count + 1;
+                end if;
+            end if;
+        end if;
+    end process;
+
+    o_overflow_count <= std_logic_vector(to_unsigned(r_overflow_count, 16));
+    o_underrun_count <= std_logic_vector(to_unsigned(r_underrun_count, 16));
+
+end arch;
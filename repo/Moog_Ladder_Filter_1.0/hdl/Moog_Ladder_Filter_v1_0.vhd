@@ -1,12 +1,15 @@
 library ieee;
 use ieee.std_logic_1164.all;
 use ieee.numeric_std.all;
+use work.synth_config_package.all;
 
 entity Moog_Ladder_Filter_v1_0 is
 	generic (
 		-- Filter module parameters 
-        g_NUM_CHANNELS : integer := 128;
-        g_DATA_WIDTH   : integer := 24;
+        g_NUM_CHANNELS        : integer := c_NUM_CHANNELS;
+        g_DATA_WIDTH          : integer := 24;
+        g_TANH_IMPLEMENTATION : integer := 0;  -- {polynomial, lookup table}
+        g_CYCLES_PER_SAMPLE   : integer := c_SAMPLE_CYCLES;
 
 		-- Parameters of Axi Slave Bus Interface S_AXI_CTRL
 		C_S_AXI_CTRL_DATA_WIDTH	: integer	:= 32;
@@ -115,23 +118,57 @@ architecture arch_imp of Moog_Ladder_Filter_v1_0 is
     signal w_modulation_amount  : std_logic_vector(17 downto 0);
     signal w_filter_type        : std_logic_vector(1 downto 0);
     signal w_filter_attenuation : std_logic;
+    
+    signal w_channel_select      : std_logic_vector(c_CHANNEL_WIDTH-1 downto 0);
+    signal w_cutoff_offset       : std_logic_vector(17 downto 0);
+    signal w_key_note            : std_logic_vector(6 downto 0);
+    signal w_key_tracking_amount : std_logic_vector(17 downto 0);
+    
+    signal w_oversample_en     : std_logic;
+    signal w_frame_cycles_1x   : std_logic_vector(15 downto 0);
+    signal w_frame_cycles_2x   : std_logic_vector(15 downto 0);
+    signal w_sample_cycles     : std_logic_vector(15 downto 0);
+    -- fifo status signals
+    signal w_fifo_select                  : std_logic_vector(1 downto 0);
+    signal w_fifo_level_status            : std_logic_vector(31 downto 0);
+    signal w_fifo_error_status            : std_logic_vector(31 downto 0);
+    signal w_input_fifo_level_status      : std_logic_vector(31 downto 0);
+    signal w_input_fifo_error_status      : std_logic_vector(31 downto 0);
+    signal w_output_fifo_level_status     : std_logic_vector(31 downto 0);
+    signal w_output_fifo_error_status     : std_logic_vector(31 downto 0);
+    signal w_adsr_fifo_level_status       : std_logic_vector(31 downto 0);
+    signal w_adsr_fifo_error_status       : std_logic_vector(31 downto 0);
+    signal w_modulation_fifo_level_status : std_logic_vector(31 downto 0);
+    signal w_modulation_fifo_error_status : std_logic_vector(31 downto 0);
 
 begin
 
     -- Instantiation of Axi Bus Interface S_AXI_CTRL
     Moog_Ladder_Filter_v1_0_S_AXI_CTRL_inst : entity work.Moog_Ladder_Filter_v1_0_S_AXI_CTRL
 	generic map (
+		g_NUM_CHANNELS	    => g_NUM_CHANNELS,
 		C_S_AXI_DATA_WIDTH	=> C_S_AXI_CTRL_DATA_WIDTH,
 		C_S_AXI_ADDR_WIDTH	=> C_S_AXI_CTRL_ADDR_WIDTH
 	)
 	port map (
-	    o_cutoff_frequency   => w_cutoff_frequency,
-        o_resonance          => w_resonance,
-        o_adsr_amount        => w_adsr_amount,
-        o_modulation_en      => w_modulation_en,
-        o_modulation_amount  => w_modulation_amount,
-        o_filter_type        => w_filter_type,
-        o_filter_attenuation => w_filter_attenuation,
+	    i_channel_select      => w_channel_select,
+	    o_cutoff_frequency    => w_cutoff_frequency,
+        o_resonance           => w_resonance,
+        o_adsr_amount         => w_adsr_amount,
+        o_modulation_en       => w_modulation_en,
+        o_modulation_amount   => w_modulation_amount,
+        o_filter_type         => w_filter_type,
+        o_filter_attenuation  => w_filter_attenuation,
+        o_cutoff_offset       => w_cutoff_offset,
+        o_key_note            => w_key_note,
+        o_key_tracking_amount => w_key_tracking_amount,
+        o_oversample_en       => w_oversample_en,
+        i_frame_cycles_1x     => w_frame_cycles_1x,
+        i_frame_cycles_2x     => w_frame_cycles_2x,
+        i_sample_cycles       => w_sample_cycles,
+        o_fifo_select         => w_fifo_select,
+        i_fifo_level_status   => w_fifo_level_status,
+        i_fifo_error_status   => w_fifo_error_status,
 		S_AXI_ACLK	    => s_axi_ctrl_aclk,
 		S_AXI_ARESETN	=> s_axi_ctrl_aresetn,
 		S_AXI_AWADDR	=> s_axi_ctrl_awaddr,
@@ -168,6 +205,8 @@ begin
 	    i_fifo_wr_en    => w_output_fifo_wr_en,
         i_fifo_wr_data  => w_output_fifo_wr_data,
 	    o_fifo_full     => w_output_fifo_full,
+        o_fifo_level_status => w_output_fifo_level_status,
+        o_fifo_error_status => w_output_fifo_error_status,
 	    -- axi stream master
 		M_AXIS_ACLK  	=> m_axis_output_aclk,
 		M_AXIS_ARESETN	=> m_axis_output_aresetn,
@@ -190,6 +229,8 @@ begin
 	    i_fifo_rd_en    => w_input_fifo_rd_en,
         o_fifo_rd_data  => w_input_fifo_rd_data,
 	    o_fifo_empty    => w_input_fifo_empty,
+        o_fifo_level_status => w_input_fifo_level_status,
+        o_fifo_error_status => w_input_fifo_error_status,
 	    -- axi stream slave
 		S_AXIS_ACLK	    => s_axis_input_aclk,
 		S_AXIS_ARESETN	=> s_axis_input_aresetn,
@@ -212,6 +253,8 @@ begin
 	    i_fifo_rd_en    => w_adsr_fifo_rd_en,
         o_fifo_rd_data  => w_adsr_fifo_rd_data,
 	    o_fifo_empty    => w_adsr_fifo_empty,
+        o_fifo_level_status => w_adsr_fifo_level_status,
+        o_fifo_error_status => w_adsr_fifo_error_status,
 	    -- axi stream slave
 		S_AXIS_ACLK	    => s_axis_adsr_aclk,
 		S_AXIS_ARESETN	=> s_axis_adsr_aresetn,
@@ -234,6 +277,8 @@ begin
 	    i_fifo_rd_en    => w_modulation_fifo_rd_en,
         o_fifo_rd_data  => w_modulation_fifo_rd_data,
 	    o_fifo_empty    => w_modulation_fifo_empty,
+        o_fifo_level_status => w_modulation_fifo_level_status,
+        o_fifo_error_status => w_modulation_fifo_error_status,
 	    -- axi stream slave
 		S_AXIS_ACLK	    => s_axi_modulation_aclk,
 		S_AXIS_ARESETN	=> s_axi_modulation_aresetn,
@@ -247,8 +292,10 @@ begin
     -- Instantiation of Moog ladder filter
     ladder_filter: entity work.moog_ladder_filter_wrapper
     generic map(
-        g_NUM_CHANNELS => g_NUM_CHANNELS,
-        g_DATA_WIDTH   => g_DATA_WIDTH
+        g_NUM_CHANNELS        => g_NUM_CHANNELS,
+        g_DATA_WIDTH          => g_DATA_WIDTH,
+        g_TANH_IMPLEMENTATION => g_TANH_IMPLEMENTATION,
+        g_CYCLES_PER_SAMPLE   => g_CYCLES_PER_SAMPLE
     )
     port map(
         i_clk                     => s_axis_input_aclk,
@@ -271,6 +318,15 @@ begin
         i_modulation_fifo_rd_data => w_modulation_fifo_rd_data(23 downto 6),
 	    i_modulation_fifo_empty   => w_modulation_fifo_empty,
         i_modulation_amount       => w_modulation_amount,
+        -- per channel cutoff offset and key tracking
+        o_channel_select          => w_channel_select,
+        i_cutoff_offset           => w_cutoff_offset,
+        i_key_note                => w_key_note,
+        i_key_tracking_amount     => w_key_tracking_amount,
+        i_oversample_en           => w_oversample_en,
+        o_frame_cycles_1x         => w_frame_cycles_1x,
+        o_frame_cycles_2x         => w_frame_cycles_2x,
+        o_sample_cycles           => w_sample_cycles,
         -- filter type
         i_filter_type             => w_filter_type,
         i_filter_attenuation      => w_filter_attenuation,
@@ -280,4 +336,14 @@ begin
 	    i_output_fifo_full        => w_output_fifo_full
     );
 
+    -- fifo status register select {input, ADSR, modulation, output}
+    w_fifo_level_status <= w_input_fifo_level_status      when w_fifo_select = "00" else
+                           w_adsr_fifo_level_status       when w_fifo_select = "01" else
+                           w_modulation_fifo_level_status when w_fifo_select = "10" else
+                           w_output_fifo_level_status;
+    w_fifo_error_status <= w_input_fifo_error_status      when w_fifo_select = "00" else
+                           w_adsr_fifo_error_status       when w_fifo_select = "01" else
+                           w_modulation_fifo_error_status when w_fifo_select = "10" else
+                           w_output_fifo_error_status;
+
 end arch_imp;
@@ -5,8 +5,9 @@ use ieee.numeric_std.all;
 entity Moog_Ladder_Filter_v1_0_S_AXIS_INPUT is
 	generic (
 		-- Users to add parameters here
-        g_NUM_CHANNELS : integer := 128;
-        g_DATA_WIDTH   : integer := 24;
+        g_NUM_CHANNELS     : integer := 128;
+        g_DATA_WIDTH       : integer := 24;
+        g_FIFO_MEMORY_TYPE : string  := "distributed"; -- {"registers", "distributed", "block"}
 		-- User parameters ends
 		-- Do not modify the parameters beyond this line
 
@@ -18,6 +19,9 @@ entity Moog_Ladder_Filter_v1_0_S_AXIS_INPUT is
         i_fifo_rd_en   : in  std_logic;
         o_fifo_rd_data : out std_logic_vector(g_DATA_WIDTH-1 downto 0);
 	    o_fifo_empty   : out std_logic;
+        -- FIFO status
+        o_fifo_level_status : out std_logic_vector(31 downto 0); -- high watermark & level
+        o_fifo_error_status : out std_logic_vector(31 downto 0); -- underflow count & overflow count
 		-- User ports ends
 		-- Do not modify the ports beyond this line
 
@@ -63,8 +67,9 @@ begin
 	
     fifo_unit : entity work.fifo
     generic map(
-        g_WIDTH => g_DATA_WIDTH,
-        g_DEPTH => g_NUM_CHANNELS
+        g_WIDTH       => g_DATA_WIDTH,
+        g_DEPTH       => g_NUM_CHANNELS,
+        g_MEMORY_TYPE => g_FIFO_MEMORY_TYPE
     )
     port map(
         i_clk       => S_AXIS_ACLK,
@@ -76,7 +81,12 @@ begin
         -- FIFO read interface
         i_rd_en     => i_fifo_rd_en,
         o_rd_data   => o_fifo_rd_data,
-        o_empty     => o_fifo_empty
+        o_empty     => o_fifo_empty,
+        -- FIFO status
+        o_level           => o_fifo_level_status(15 downto 0),
+        o_high_watermark  => o_fifo_level_status(31 downto 16),
+        o_overflow_count  => o_fifo_error_status(15 downto 0),
+        o_underflow_count => o_fifo_error_status(31 downto 16)
     );
 
 end arch_imp;
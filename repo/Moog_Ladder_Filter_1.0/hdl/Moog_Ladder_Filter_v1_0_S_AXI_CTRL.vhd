@@ -1,11 +1,12 @@
 library ieee;
 use ieee.std_logic_1164.all;
 use ieee.numeric_std.all;
+use work.synth_config_package.all;
 
 entity Moog_Ladder_Filter_v1_0_S_AXI_CTRL is
 	generic (
 		-- Users to add parameters here
-
+        g_NUM_CHANNELS : integer := 128;
 		-- User parameters ends
 		-- Do not modify the parameters beyond this line
 
@@ -16,13 +17,27 @@ entity Moog_Ladder_Filter_v1_0_S_AXI_CTRL is
 	);
 	port (
 		-- Users to add ports here
-        o_cutoff_frequency   : out std_logic_vector(17 downto 0);
-        o_resonance          : out std_logic_vector(17 downto 0);
-        o_adsr_amount        : out std_logic_vector(17 downto 0);
-        o_modulation_en      : out std_logic;
-        o_modulation_amount  : out std_logic_vector(17 downto 0);
-        o_filter_type        : out std_logic_vector(1 downto 0);
-        o_filter_attenuation : out std_logic;
+        i_channel_select      : in std_logic_vector(c_CHANNEL_WIDTH-1 downto 0);
+        o_cutoff_frequency    : out std_logic_vector(17 downto 0);
+        o_resonance           : out std_logic_vector(17 downto 0);
+        o_adsr_amount         : out std_logic_vector(17 downto 0);
+        o_modulation_en       : out std_logic;
+        o_modulation_amount   : out std_logic_vector(17 downto 0);
+        o_filter_type         : out std_logic_vector(1 downto 0);
+        o_filter_attenuation  : out std_logic;
+        -- per channel cutoff offset and key tracking
+        o_cutoff_offset       : out std_logic_vector(17 downto 0);
+        o_key_note            : out std_logic_vector(6 downto 0);
+        o_key_tracking_amount : out std_logic_vector(17 downto 0);
+        -- oversampling and frame cycles
+        o_oversample_en       : out std_logic;
+        i_frame_cycles_1x     : in std_logic_vector(15 downto 0);
+        i_frame_cycles_2x     : in std_logic_vector(15 downto 0);
+        i_sample_cycles       : in std_logic_vector(15 downto 0);
+        -- FIFO status {input, ADSR, modulation, output}
+        o_fifo_select         : out std_logic_vector(1 downto 0);
+        i_fifo_level_status   : in std_logic_vector(31 downto 0);
+        i_fifo_error_status   : in std_logic_vector(31 downto 0);
 		-- User ports ends
 		-- Do not modify the ports beyond this line
 
@@ -136,6 +151,13 @@ architecture arch_imp of Moog_Ladder_Filter_v1_0_S_AXI_CTRL is
 	signal byte_index	: integer;
 	signal aw_en	: std_logic;
 
+    -- per channel cutoff frequency offset and key tracking note
+    type t_cutoff_offset_array is array (0 to g_NUM_CHANNELS-1) of std_logic_vector(17 downto 0);
+    type t_note_array          is array (0 to g_NUM_CHANNELS-1) of std_logic_vector(6 downto 0);
+    
+    signal r_channel_cutoff_offset : t_cutoff_offset_array := (others => (others => '0'));
+    signal r_channel_note          : t_note_array          := (others => (others => '0'));
+
 begin
 	-- I/O Connections assignments
 
@@ -309,21 +331,16 @@ begin
 	              end if;
 	            end loop;
 	          when b"0111" =>
-	            for byte_index in 0 to (C_S_AXI_DATA_WIDTH/8-1) loop
-	              if ( S_AXI_WSTRB(byte_index) = '1' ) then
-	                -- Respective byte enables are asserted as per write strobes                   
-	                -- slave registor 7
-	                slv_reg7(byte_index*8+7 downto byte_index*8) <= S_AXI_WDATA(byte_index*8+7 downto byte_index*8);
-	              end if;
-	            end loop;
+	            -- channel cutoff frequency offset {channel[31:25], offset[17:0]}, the channel
+	            -- and the offset share the word so only full word writes are accepted
+	            if S_AXI_WSTRB = (S_AXI_WSTRB'range => '1') then
+	              r_channel_cutoff_offset(to_integer(unsigned(S_AXI_WDATA(31 downto 25)))) <= S_AXI_WDATA(17 downto 0);
+	            end if;
 	          when b"1000" =>
-	            for byte_index in 0 to (C_S_AXI_DATA_WIDTH/8-1) loop
-	              if ( S_AXI_WSTRB(byte_index) = '1' ) then
-	                -- Respective byte enables are asserted as per write strobes                   
-	                -- slave registor 8
-	                slv_reg8(byte_index*8+7 downto byte_index*8) <= S_AXI_WDATA(byte_index*8+7 downto byte_index*8);
-	              end if;
-	            end loop;
+	            -- channel key tracking note {channel[31:25], note[6:0]}, full word writes only
+	            if S_AXI_WSTRB = (S_AXI_WSTRB'range => '1') then
+	              r_channel_note(to_integer(unsigned(S_AXI_WDATA(31 downto 25)))) <= S_AXI_WDATA(6 downto 0);
+	            end if;
 	          when b"1001" =>
 	            for byte_index in 0 to (C_S_AXI_DATA_WIDTH/8-1) loop
 	              if ( S_AXI_WSTRB(byte_index) = '1' ) then
@@ -484,7 +501,9 @@ begin
 	-- and the slave is ready to accept the read address.
 	slv_reg_rden <= axi_arready and S_AXI_ARVALID and (not axi_rvalid) ;
 
-	process (slv_reg0, slv_reg1, slv_reg2, slv_reg3, slv_reg4, slv_reg5, slv_reg6, slv_reg7, slv_reg8, slv_reg9, slv_reg10, slv_reg11, slv_reg12, slv_reg13, slv_reg14, slv_reg15, axi_araddr, S_AXI_ARESETN, slv_reg_rden)
+	process (slv_reg0, slv_reg1, slv_reg2, slv_reg3, slv_reg4, slv_reg5, slv_reg6, slv_reg7, slv_reg8, slv_reg9, slv_reg10, slv_reg11, slv_reg12, slv_reg13, slv_reg14, slv_reg15, axi_araddr, S_AXI_ARESETN, slv_reg_rden,
+	         i_frame_cycles_1x, i_frame_cycles_2x, i_sample_cycles,
+	         i_fifo_level_status, i_fifo_error_status)
 	variable loc_addr :std_logic_vector(OPT_MEM_ADDR_BITS downto 0);
 	begin
 	    -- Address decoding for reading registers
@@ -515,13 +534,13 @@ begin
 	      when b"1011" =>
 	        reg_data_out <= slv_reg11;
 	      when b"1100" =>
-	        reg_data_out <= slv_reg12;
+	        reg_data_out <= i_frame_cycles_2x & i_frame_cycles_1x;
 	      when b"1101" =>
-	        reg_data_out <= slv_reg13;
+	        reg_data_out <= i_sample_cycles & slv_reg13(15 downto 0);
 	      when b"1110" =>
-	        reg_data_out <= slv_reg14;
+	        reg_data_out <= i_fifo_level_status;
 	      when b"1111" =>
-	        reg_data_out <= slv_reg15;
+	        reg_data_out <= i_fifo_error_status;
 	      when others =>
 	        reg_data_out  <= (others => '0');
 	    end case;
@@ -547,13 +566,18 @@ begin
 
 
 	-- Add user logic here
-    o_cutoff_frequency   <= slv_reg0(17 downto 0);
-    o_resonance          <= slv_reg1(17 downto 0);
-    o_adsr_amount        <= slv_reg2(17 downto 0);
-    o_modulation_en      <= slv_reg3(0);
-    o_modulation_amount  <= slv_reg4(17 downto 0);
-    o_filter_type        <= slv_reg5(1 downto 0);
-    o_filter_attenuation <= slv_reg6(0);
+    o_cutoff_frequency    <= slv_reg0(17 downto 0);
+    o_resonance           <= slv_reg1(17 downto 0);
+    o_adsr_amount         <= slv_reg2(17 downto 0);
+    o_modulation_en       <= slv_reg3(0);
+    o_modulation_amount   <= slv_reg4(17 downto 0);
+    o_filter_type         <= slv_reg5(1 downto 0);
+    o_filter_attenuation  <= slv_reg6(0);
+    o_cutoff_offset       <= r_channel_cutoff_offset(to_integer(unsigned(i_channel_select)));
+    o_key_note            <= r_channel_note(to_integer(unsigned(i_channel_select)));
+    o_key_tracking_amount <= slv_reg9(17 downto 0);
+    o_oversample_en       <= slv_reg10(0);
+    o_fifo_select         <= slv_reg13(1 downto 0);
 	-- User logic ends
 
 end arch_imp;
@@ -0,0 +1,103 @@
+-- Halfband Decimator
+-- Description:
+-- Multichannel 2x decimator for the oversampled ladder filter. The filter
+-- output arrives as two passes per sample, all channels of pass 0 followed
+-- by all channels of pass 1, and one output per channel is produced during
+-- pass 1 with the 7 tap halfband filter h = (-1, 0, 9, 16, 9, 0, -1)/32.
+-- The zero taps are skipped, so per channel history is kept in a single
+-- delay line shifted on every input and tapped at 2, 3, 4 and 6 passes back.
+-- The filter uses shifts and adds only, no DSP slices.
+--
+-- Inputs:
+-- i_clk: system clk
+-- i_en: input data valid
+-- i_phase: oversampling pass of the input data, pass 0 (0) or pass 1 (1)
+-- i_x: oversampled filter output
+--
+-- Outputs:
+-- o_en: output data valid
+-- o_y: decimated output
+
+library ieee;
+use ieee.std_logic_1164.all;
+use ieee.numeric_std.all;
+
+entity halfband_decimator is
+    generic(
+        g_NUM_CHANNELS : integer := 128;
+        g_DATA_WIDTH   : integer := 24
+    );
+    port(
+        i_clk   : in  std_logic;
+        i_en    : in  std_logic;
+        i_phase : in  std_logic;
+        i_x     : in  std_logic_vector(g_DATA_WIDTH-1 downto 0); -- Q1.23
+        o_en    : out std_logic;
+        o_y     : out std_logic_vector(g_DATA_WIDTH-1 downto 0)  -- Q1.23
+    );
+end halfband_decimator;
+
+architecture arch of halfband_decimator is
+
+    constant c_SUM_WIDTH : integer := g_DATA_WIDTH+6;
+
+    type t_data_array is array (natural range<>) of std_logic_vector(g_DATA_WIDTH-1 downto 0);
+
+    -- delay line, w_delay(k) holds the input from k passes ago
+    signal w_delay : t_data_array(0 to 6);
+
+    -- filter pipeline
+    signal r_sum_outer  : signed(c_SUM_WIDTH-1 downto 0) := (others => '0');
+    signal r_sum_inner  : signed(c_SUM_WIDTH-1 downto 0) := (others => '0');
+    signal r_center     : signed(c_SUM_WIDTH-1 downto 0) := (others => '0');
+    signal r_en         : std_logic := '0';
+
+    -- output arithmetic saturation
+    signal w_output_pre_saturation  : signed(c_SUM_WIDTH-1 downto 0);
+    signal w_output_guard_bits      : std_logic_vector(c_SUM_WIDTH-g_DATA_WIDTH downto 0);
+
+begin
+
+    w_delay(0) <= i_x;
+
+    delay_line_gen : for I in 1 to 6 generate
+        shift_reg_delay : entity work.shift_register
+        generic map(
+            g_LENGTH    => g_NUM_CHANNELS,
+            g_DATA_SIZE => g_DATA_WIDTH
+        )
+        port map(
+            i_clk  => i_clk,
+            i_en   => i_en,
+            i_in   => w_delay(I-1),
+            o_out  => w_delay(I)
+        );
+    end generate;
+
+    process(i_clk)
+    begin
+        if rising_edge(i_clk) then
+            -- stage 1
+            r_sum_outer <= -resize(signed(w_delay(0)), c_SUM_WIDTH) - resize(signed(w_delay(6)), c_SUM_WIDTH);
+            r_sum_inner <= resize(signed(w_delay(2)), c_SUM_WIDTH) + resize(signed(w_delay(4)), c_SUM_WIDTH);
+            r_center    <= shift_left(resize(signed(w_delay(3)), c_SUM_WIDTH), 4);
+            r_en        <= i_en and i_phase;
+
+            -- stage 2
+            if w_output_guard_bits = (w_output_guard_bits'range => '1') or
+               w_output_guard_bits = (w_output_guard_bits'range => '0') then
+                o_y <= std_logic_vector(resize(w_output_pre_saturation, g_DATA_WIDTH));
+            elsif w_output_guard_bits(w_output_guard_bits'left) = '0' then
+                o_y <= std_logic_vector(to_signed(2**(g_DATA_WIDTH-1)-1, g_DATA_WIDTH));
+            else
+                o_y <= std_logic_vector(to_signed(-2**(g_DATA_WIDTH-1), g_DATA_WIDTH));
+            end if;
+            o_en <= r_en;
+        end if;
+    end process;
+
+    -- (-x0 - x6 + 9*(x2 + x4) + 16*x3)/32
+    w_output_pre_saturation <= shift_right(r_sum_outer + shift_left(r_sum_inner, 3) + r_sum_inner + r_center, 5);
+    w_output_guard_bits     <= std_logic_vector(w_output_pre_saturation(c_SUM_WIDTH-1 downto g_DATA_WIDTH-1));
+
+end arch;
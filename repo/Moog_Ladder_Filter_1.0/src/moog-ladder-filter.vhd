@@ -8,6 +8,10 @@
 -- filter configurations (Low pass, High pass and Bandpass) (12dB/Oct and 24dB/Oct slope)
 -- and includes cutoff frequency modulation inputs.
 --
+-- Generics:
+-- g_TANH_IMPLEMENTATION: feedback saturator, polynomial (0) or interpolated lookup table (1),
+--                        the lookup table shortens the filter by 2 clocks
+--
 -- Inputs:
 -- i_clk: system clk
 -- 1_input: input data
@@ -16,6 +20,11 @@
 -- i_adsr: ADSR envelope input
 -- i_adsr_amount: ADSR envelope amount
 -- i_cutoff_mod: cutoff frequency modulation input (e.g. LFO)
+-- i_cutoff_offset: per channel cutoff frequency offset
+-- i_key_note: per channel MIDI note driving the key tracking
+-- i_key_tracking_amount: key tracking amount (1.0 adds the note frequency to the cutoff)
+-- i_oversample_en: input is 2x oversampled, the cutoff frequency is halved to match
+-- i_sample_rate: key tracking sample rate relative to c_SAMPLE_RATE, half (00), nominal (01) and double (10)
 -- i_filter_type: Low pass (00), High pass (01) and Bandpass (10) filter configuration
 -- i_filter_attenuation: 12dB/Oct (0) and 24dB/Oct (1) slope
 --
@@ -26,32 +35,42 @@
 library ieee;
 use ieee.std_logic_1164.all;
 use ieee.numeric_std.all;
+use ieee.math_real.all;
+use work.synth_config_package.all;
 
 entity moog_ladder_filter is
     generic(
-        g_NUM_CHANNELS : integer := 128;
-        g_DATA_WIDTH   : integer := 24   
+        g_NUM_CHANNELS        : integer := c_NUM_CHANNELS;
+        g_DATA_WIDTH          : integer := 24;
+        g_TANH_IMPLEMENTATION : integer := 0  -- {polynomial, lookup table}
     );
     port(
-        i_clk                : in std_logic;
-        i_data_valid         : in std_logic;
-        i_input              : in std_logic_vector(g_DATA_WIDTH-1 downto 0);
+        i_clk                 : in std_logic;
+        i_data_valid          : in std_logic;
+        i_input               : in std_logic_vector(g_DATA_WIDTH-1 downto 0);
         -- filter parameters
-        i_resonance          : in std_logic_vector(17 downto 0);
-        i_cutoff_frequency   : in std_logic_vector(17 downto 0); -- Q3.15
+        i_resonance           : in std_logic_vector(17 downto 0);
+        i_cutoff_frequency    : in std_logic_vector(17 downto 0); -- Q3.15
         -- ADSR Envelope
-        i_adsr_envelope      : in std_logic_vector(17 downto 0); -- Q1.17
-        i_adsr_amount        : in std_logic_vector(17 downto 0); -- Q3.15
+        i_adsr_envelope       : in std_logic_vector(17 downto 0); -- Q1.17
+        i_adsr_amount         : in std_logic_vector(17 downto 0); -- Q3.15
         -- modulation (LFO)
-        i_modulation_en      : in std_logic;
-        i_modulation         : in std_logic_vector(17 downto 0); -- Q1.17
-        i_modulation_amount  : in std_logic_vector(17 downto 0); -- Q3.15
+        i_modulation_en       : in std_logic;
+        i_modulation          : in std_logic_vector(17 downto 0); -- Q1.17
+        i_modulation_amount   : in std_logic_vector(17 downto 0); -- Q3.15
+        -- per channel cutoff offset and key tracking
+        i_cutoff_offset       : in std_logic_vector(17 downto 0); -- Q3.15
+        i_key_note            : in std_logic_vector(6 downto 0);
+        i_key_tracking_amount : in std_logic_vector(17 downto 0); -- Q3.15
+        -- oversampling
+        i_oversample_en       : in std_logic;
+        i_sample_rate         : in std_logic_vector(1 downto 0) := "01";
         -- filter type
-        i_filter_type        : in std_logic_vector(1 downto 0);  -- {low pass, high pass, bandpass}
-        i_filter_attenuation : in std_logic;                     -- {12dB/Oct, 24dB/Oct}
+        i_filter_type         : in std_logic_vector(1 downto 0);  -- {low pass, high pass, bandpass}
+        i_filter_attenuation  : in std_logic;                     -- {12dB/Oct, 24dB/Oct}
         -- outputs
-        o_output             : out std_logic_vector(g_DATA_WIDTH-1 downto 0); -- Q1.23
-        o_data_valid         : out std_logic
+        o_output              : out std_logic_vector(g_DATA_WIDTH-1 downto 0); -- Q1.23
+        o_data_valid          : out std_logic
     );
 end moog_ladder_filter;
 
@@ -93,6 +112,11 @@ architecture arch of moog_ladder_filter is
     -- hyperbolic tangent function module input and output 
     signal w_tanh_input : std_logic_vector(g_DATA_WIDTH+3-1 downto 0);
     signal w_tanh_output : std_logic_vector(g_DATA_WIDTH-1 downto 0);
+    signal w_tanh_lut_output : std_logic_vector(g_DATA_WIDTH-1 downto 0);
+    
+    -- one pole filter stage A data valid and cutoff frequency
+    signal w_stage_a_en : std_logic;
+    signal w_stage_a_g  : std_logic_vector(17 downto 0);
     
     -- connections between one pole filter modules
     signal w_filter_output      : t_data_array(0 to 3);
@@ -139,8 +163,24 @@ architecture arch of moog_ladder_filter is
     signal r_data_valid_reg : t_sl_array(0 to 13) := (others => '0');
     signal r_data_valid_output_reg : t_sl_array(0 to 1) := (others => '0');
     
+    -- key tracking note frequency table, 2*pi*f/fs in Q3.15 at the sample rate of the configuration
+    type t_key_table is array (0 to 127) of signed(17 downto 0);
+    
+    function init_key_table return t_key_table is
+        variable v_table : t_key_table;
+    begin
+        for I in 0 to 127 loop
+            v_table(I) := to_signed(integer(round(2.0*MATH_PI*440.0*2.0**(real(I-69)/12.0)/real(c_SAMPLE_RATE)*2.0**15)), 18);
+        end loop;
+        return v_table;
+    end function;
+    
+    constant c_KEY_TABLE : t_key_table := init_key_table;
+
     -- cutoff frequency modulation and correction
-    signal r_cutoff_freq           : std_logic_vector(17 downto 0) := (others => '0');
+    signal r_cutoff_freq           : signed(18 downto 0) := (others => '0');
+    signal r_key_freq              : signed(17 downto 0) := (others => '0');
+    signal r_key_factor            : signed(35 downto 0) := (others => '0');
     signal r_adsr_factor           : signed(35 downto 0) := (others => '0');
     signal r_modulation            : signed(17 downto 0) := (others => '0');
     signal r_mod_factor            : signed(35 downto 0) := (others => '0');
@@ -167,9 +207,6 @@ begin
                 r_data_valid_reg(idx+1) <= r_data_valid_reg(idx);
             end loop;
             
-            r_freq_reg(0) <= w_cutoff_freq_corrected;
-            r_freq_reg(1) <= r_freq_reg(0);
-            
             r_data_valid_output_reg(0) <=  w_filter_data_valid(3);
             r_data_valid_output_reg(1) <= r_data_valid_output_reg(0);
             o_data_valid <= r_data_valid_output_reg(1);
@@ -235,26 +272,34 @@ begin
     begin
         if rising_edge(i_clk) then
             -- stage 1
-            r_cutoff_freq <= i_cutoff_frequency;
+            r_cutoff_freq <= resize(signed(i_cutoff_frequency), 19) + resize(signed(i_cutoff_offset), 19);
             r_adsr_factor <= signed(i_adsr_envelope) * signed(i_adsr_amount);
             r_modulation  <= signed(i_modulation);
+            case i_sample_rate is
+                when "00"   => r_key_freq <= shift_left(c_KEY_TABLE(to_integer(unsigned(i_key_note))), 1);
+                when "10"   => r_key_freq <= shift_right(c_KEY_TABLE(to_integer(unsigned(i_key_note))), 1);
+                when others => r_key_freq <= c_KEY_TABLE(to_integer(unsigned(i_key_note)));
+            end case;
             
             -- stage 2
-            r_cutoff_freq_adsr <= shift_left(resize(signed(r_cutoff_freq), 37), 17) + resize(r_adsr_factor, 37);
+            r_cutoff_freq_adsr <= shift_left(resize(r_cutoff_freq, 37), 17) + resize(r_adsr_factor, 37);
             if i_modulation_en = '1' then
                 r_mod_factor  <= r_modulation * signed(i_modulation_amount);
             else
                 r_mod_factor  <= r_modulation * to_signed(0, 18);
             end if;
+            r_key_factor  <= r_key_freq * signed(i_key_tracking_amount);
             
             -- stage 3
-            r_cutoff_freq_adsr_mod <= resize(r_mod_factor, 38) + resize(r_cutoff_freq_adsr, 38);
+            r_cutoff_freq_adsr_mod <= resize(r_mod_factor, 38) + resize(r_cutoff_freq_adsr, 38) + shift_left(resize(r_key_factor, 38), 2);
             
-            -- stage 4
+            -- stage 4 (at twice the sample rate the normalised cutoff frequency is halved)
             if r_cutoff_freq_adsr_mod(37 downto 32) > 0 then        -- positive overflow
                 r_cutoff_freq_saturated <= resize(shift_right(r_cutoff_freq_adsr_mod, 17), 18);
             elsif r_cutoff_freq_adsr_mod(37 downto 32) < 0 then  -- negative overflow
                 r_cutoff_freq_saturated <= (others => '0');
+            elsif i_oversample_en = '1' then
+                r_cutoff_freq_saturated <= resize(shift_right(r_cutoff_freq_adsr_mod, 18), 18);
             else
                 r_cutoff_freq_saturated <= resize(shift_right(r_cutoff_freq_adsr_mod, 17), 18);
             end if;
@@ -263,12 +308,53 @@ begin
 
     -- hyperbolic tangent function (11 delays)
     w_tanh_input <= std_logic_vector(resize(shift_right(r_feedback_sum_b, 0), g_DATA_WIDTH+3));
-    tanh_function : entity work.tanh_function(arch_v2)
-    port map(
-        i_clk    => i_clk,
-        i_input  => w_tanh_input,
-        o_result => w_tanh_output
-    );
+    
+    tanh_polynomial_gen : if g_TANH_IMPLEMENTATION = 0 generate
+        tanh_function : entity work.tanh_function(arch_v2)
+        port map(
+            i_clk    => i_clk,
+            i_input  => w_tanh_input,
+            o_result => w_tanh_output
+        );
+        
+        -- cutoff frequency balanced to the polynomial (2 delays)
+        process(i_clk)
+        begin
+            if rising_edge(i_clk) then
+                r_freq_reg(0) <= w_cutoff_freq_corrected;
+                r_freq_reg(1) <= r_freq_reg(0);
+            end if;
+        end process;
+        
+        w_stage_a_en <= r_data_valid_reg(13);
+        w_stage_a_g  <= r_freq_reg(1);
+    end generate;
+    
+    -- lookup table (3 delays) and balance shift register (6 delays), level with the
+    -- cutoff frequency correction output so the filter stages start 2 clocks earlier
+    tanh_lut_gen : if g_TANH_IMPLEMENTATION = 1 generate
+        tanh_function : entity work.tanh_function(arch_lut)
+        port map(
+            i_clk    => i_clk,
+            i_input  => w_tanh_input,
+            o_result => w_tanh_lut_output
+        );
+        
+        shift_reg_tanh_balance : entity work.shift_register
+        generic map(
+            g_LENGTH    => 6,
+            g_DATA_SIZE => g_DATA_WIDTH
+        )
+        port map(
+            i_clk  => i_clk,
+            i_en   => '1',
+            i_in   => w_tanh_lut_output,
+            o_out  => w_tanh_output
+        );
+        
+        w_stage_a_en <= r_data_valid_reg(11);
+        w_stage_a_g  <= w_cutoff_freq_corrected;
+    end generate;
 
     -- polynomial cutoff frequency correction (8 delays) 
     cutoff_freq_correction : entity work.polynomial
@@ -290,9 +376,9 @@ begin
     )
     port map(
         i_clk => i_clk,
-        i_en  => r_data_valid_reg(13),
+        i_en  => w_stage_a_en,
         i_x   => w_tanh_output,
-        i_g   => r_freq_reg(1),
+        i_g   => w_stage_a_g,
         o_en  => w_filter_data_valid(0),
         o_y   => w_filter_output(0),
         o_g   => w_filter_cutoff_freq(0)
@@ -1,11 +1,15 @@
 library ieee;
 use ieee.std_logic_1164.all;
+use ieee.numeric_std.all;
+use work.synth_config_package.all;
 
 
 entity moog_ladder_filter_wrapper is
     generic(
-        g_NUM_CHANNELS : integer := 128;
-        g_DATA_WIDTH   : integer := 24
+        g_NUM_CHANNELS        : integer := c_NUM_CHANNELS;
+        g_DATA_WIDTH          : integer := 24;
+        g_TANH_IMPLEMENTATION : integer := 0; -- {polynomial, lookup table}
+        g_CYCLES_PER_SAMPLE   : integer := c_SAMPLE_CYCLES -- nominal rate the key tracking is referenced to
     );
     port(
         i_clk                     : in std_logic;
@@ -28,6 +32,17 @@ entity moog_ladder_filter_wrapper is
         i_modulation_fifo_rd_data : in std_logic_vector(17 downto 0); -- Q1.17
 	    i_modulation_fifo_empty   : in std_logic; 
         i_modulation_amount       : in std_logic_vector(17 downto 0); -- Q3.15
+        -- per channel cutoff offset and key tracking
+        o_channel_select          : out std_logic_vector(c_CHANNEL_WIDTH-1 downto 0);
+        i_cutoff_offset           : in std_logic_vector(17 downto 0); -- Q3.15
+        i_key_note                : in std_logic_vector(6 downto 0);
+        i_key_tracking_amount     : in std_logic_vector(17 downto 0); -- Q3.15
+        -- oversampling
+        i_oversample_en           : in std_logic;
+        o_frame_cycles_1x         : out std_logic_vector(15 downto 0);
+        o_frame_cycles_2x         : out std_logic_vector(15 downto 0);
+        -- clock cycles between the last two module enables
+        o_sample_cycles           : out std_logic_vector(15 downto 0);
         -- filter type
         i_filter_type             : in std_logic_vector(1 downto 0);  -- {low pass, high pass, bandpass}
         i_filter_attenuation      : in std_logic;                     -- {12dB/Oct, 24dB/Oct}
@@ -40,16 +55,54 @@ end moog_ladder_filter_wrapper;
 
 architecture arch of moog_ladder_filter_wrapper is
 
-    type t_state is (idle, running);
+    -- hyperbolic tangent latency, polynomial (11) or lookup table and its
+    -- balance shift register (9)
+    type t_latency_array is array (0 to 1) of integer;
+    constant c_TANH_LATENCY : t_latency_array := (11, 9);
+    
+    -- ladder filter latency from data valid in to data valid out: feedback (3),
+    -- hyperbolic tangent, four one pole stages (5 each) and the output data
+    -- valid registers (3)
+    constant c_FILTER_LATENCY    : integer := 3 + c_TANH_LATENCY(g_TANH_IMPLEMENTATION) + 4*5 + 3;
+    -- the state machine starts a pass the cycle after the enable and the
+    -- decimator output is 2 cycles behind the filter output
+    constant c_START_LATENCY     : integer := 1;
+    constant c_DECIMATOR_LATENCY : integer := 2;
+    -- cycles a pass adds to the channel count, from the enable to the last
+    -- data valid out
+    constant c_PASS_LATENCY : integer := c_START_LATENCY + c_FILTER_LATENCY + c_DECIMATOR_LATENCY;
+    
+    constant c_FRAME_CYCLES_1X   : integer := g_NUM_CHANNELS + c_PASS_LATENCY;
+    constant c_FRAME_CYCLES_2X   : integer := 2*(g_NUM_CHANNELS + c_PASS_LATENCY);
+
+    -- the sample period is measured from the module enable as the I2S
+    -- transceiver can change the rate at run time
+    signal r_en_prev        : std_logic := '0';
+    signal r_cycle_count    : unsigned(15 downto 0) := (others => '0');
+    signal r_sample_cycles  : unsigned(15 downto 0) := to_unsigned(g_CYCLES_PER_SAMPLE, 16);
+    signal r_sample_rate    : std_logic_vector(1 downto 0) := "01";
+
+    type t_state is (idle, running, draining);
     signal r_state : t_state := idle;
     
     signal r_channel : integer range 0 to g_NUM_CHANNELS-1 := 0;
     
+    -- oversampling, pass 0 reads the FIFOs and pass 1 replays the same inputs
+    signal r_oversample : std_logic := '0';
+    signal r_pass       : std_logic := '0';
+    
+    signal r_output_count : integer range 0 to g_NUM_CHANNELS-1 := 0;
+    signal r_output_pass  : std_logic := '0';
+    
     signal w_data_valid_in  : std_logic;
     signal w_data_valid_out : std_logic;
     
     signal w_output : std_logic_vector(g_DATA_WIDTH-1 downto 0);
     
+    signal w_decimator_en     : std_logic;
+    signal w_decimator_output : std_logic_vector(g_DATA_WIDTH-1 downto 0);
+    signal w_decimator_valid  : std_logic;
+    
     signal r_rd_input : std_logic;
     signal r_rd_adsr : std_logic;
     signal r_rd_modulation : std_logic;
@@ -57,6 +110,10 @@ architecture arch of moog_ladder_filter_wrapper is
     signal w_input : std_logic_vector(g_DATA_WIDTH-1 downto 0);
     signal w_adsr_envelope : std_logic_vector(17 downto 0);
     signal w_modulation : std_logic_vector(17 downto 0);
+    
+    signal w_fifo_data   : std_logic_vector(g_DATA_WIDTH+36-1 downto 0);
+    signal w_replay_out  : std_logic_vector(g_DATA_WIDTH+36-1 downto 0);
+    signal w_filter_data : std_logic_vector(g_DATA_WIDTH+36-1 downto 0);
 begin
 
     process(i_clk)
@@ -65,64 +122,166 @@ begin
             case r_state is
                 when idle =>
                     r_channel <= 0;
+                    r_pass    <= '0';
                     if i_en = '1' then
                         r_state   <= running;
                         r_rd_input <= not i_input_fifo_empty;  
                         r_rd_adsr <= not i_adsr_fifo_empty;  
                         r_rd_modulation <= not i_modulation_fifo_empty;  
+                        r_oversample <= i_oversample_en;
                     end if;
                 when running =>
                     r_channel <= r_channel + 1;
                     if r_channel = g_NUM_CHANNELS-1 then
-                        r_state   <= idle;
+                        r_channel <= 0;
+                        if r_oversample = '1' and r_pass = '0' then
+                            r_state <= draining;
+                        else
+                            r_state <= idle;
+                        end if;
+                    end if;
+                -- the second pass may only start once the first pass has left
+                -- the ladder, otherwise the feedback shift register misaligns
+                when draining =>
+                    if w_data_valid_out = '1' and r_output_count = g_NUM_CHANNELS-1 then
+                        r_state <= running;
+                        r_pass  <= '1';
                     end if;
             end case;        
         end if;
     end process;
 
-    process(r_state, r_rd_input, r_rd_adsr, r_rd_modulation)
+    process(r_state, r_pass, r_rd_input, r_rd_adsr, r_rd_modulation)
     begin
         case r_state is
-            when idle =>
+            when idle | draining =>
                 o_input_fifo_rd_en <= '0';
                 o_adsr_fifo_rd_en  <= '0';
                 o_modulation_fifo_rd_en <= '0';
                 w_data_valid_in <= '0';
             when running =>
-                o_input_fifo_rd_en <= r_rd_input;
-                o_adsr_fifo_rd_en  <= r_rd_adsr;
-                o_modulation_fifo_rd_en <= r_rd_modulation;
+                o_input_fifo_rd_en <= r_rd_input and not r_pass;
+                o_adsr_fifo_rd_en  <= r_rd_adsr and not r_pass;
+                o_modulation_fifo_rd_en <= r_rd_modulation and not r_pass;
                 w_data_valid_in <= '1';
         end case;        
     end process;
     
-    o_output_fifo_wr_data <= w_output;
-    o_output_fifo_wr_en   <= w_data_valid_out;
+    -- output channel and pass counter
+    process(i_clk)
+    begin
+        if rising_edge(i_clk) then
+            if r_state = idle and i_en = '1' then
+                r_output_count <= 0;
+                r_output_pass  <= '0';
+            elsif w_data_valid_out = '1' then
+                r_output_count <= r_output_count + 1;
+                if r_output_count = g_NUM_CHANNELS-1 then
+                    r_output_count <= 0;
+                    r_output_pass  <= r_oversample and not r_output_pass;
+                end if;
+            end if;
+        end if;
+    end process;
+    
+    o_channel_select <= std_logic_vector(to_unsigned(r_channel, o_channel_select'length));
+    
+    o_output_fifo_wr_data <= w_decimator_output when r_oversample = '1' else w_output;
+    o_output_fifo_wr_en   <= w_decimator_valid when r_oversample = '1' else w_data_valid_out;
+    
+    -- sample period measurement, the enable may be wider than one clock cycle
+    process(i_clk)
+    begin
+        if rising_edge(i_clk) then
+            r_en_prev <= i_en;
+            if i_en = '1' and r_en_prev = '0' then
+                r_cycle_count   <= to_unsigned(1, 16);
+                r_sample_cycles <= r_cycle_count;
+            elsif r_cycle_count /= x"FFFF" then
+                r_cycle_count <= r_cycle_count + 1;
+            end if;
+            
+            -- key tracking rate relative to the nominal sample period
+            if r_sample_cycles > g_CYCLES_PER_SAMPLE*3/2 then
+                r_sample_rate <= "00";
+            elsif r_sample_cycles < g_CYCLES_PER_SAMPLE*3/4 then
+                r_sample_rate <= "10";
+            else
+                r_sample_rate <= "01";
+            end if;
+        end if;
+    end process;
+    
+    o_sample_cycles   <= std_logic_vector(r_sample_cycles);
+    o_frame_cycles_1x <= std_logic_vector(to_unsigned(c_FRAME_CYCLES_1X, 16));
+    o_frame_cycles_2x <= std_logic_vector(to_unsigned(c_FRAME_CYCLES_2X, 16));
+    
+    w_fifo_data(g_DATA_WIDTH+36-1 downto 36) <= i_input_fifo_rd_data when r_rd_input = '1' else (others => '0');
+    w_fifo_data(35 downto 18)                <= i_adsr_fifo_rd_data when r_rd_adsr = '1' else (others => '0');
+    w_fifo_data(17 downto 0)                 <= i_modulation_fifo_rd_data when r_rd_modulation = '1' else (others => '0');
+    
+    -- replay of the first pass inputs for the second pass (zero order hold upsampling)
+    w_filter_data <= w_fifo_data when r_pass = '0' else w_replay_out;
+    
+    shift_reg_replay : entity work.shift_register
+    generic map(
+        g_LENGTH    => g_NUM_CHANNELS,
+        g_DATA_SIZE => g_DATA_WIDTH+36
+    )
+    port map(
+        i_clk  => i_clk,
+        i_en   => w_data_valid_in,
+        i_in   => w_filter_data,
+        o_out  => w_replay_out
+    );
     
-    w_input         <= i_input_fifo_rd_data when r_rd_input = '1' else (others => '0');
-    w_adsr_envelope <= i_adsr_fifo_rd_data when r_rd_adsr = '1' else (others => '0');
-    w_modulation    <= i_modulation_fifo_rd_data when r_rd_modulation = '1' else (others => '0');
+    w_input         <= w_filter_data(g_DATA_WIDTH+36-1 downto 36);
+    w_adsr_envelope <= w_filter_data(35 downto 18);
+    w_modulation    <= w_filter_data(17 downto 0);
     
     ladder_filter : entity work.moog_ladder_filter
+    generic map(
+        g_NUM_CHANNELS        => g_NUM_CHANNELS,
+        g_DATA_WIDTH          => g_DATA_WIDTH,
+        g_TANH_IMPLEMENTATION => g_TANH_IMPLEMENTATION
+    )
+    port map(
+        i_clk                 => i_clk,
+        i_data_valid          => w_data_valid_in,
+        i_input               => w_input,
+        i_resonance           => i_resonance,
+        i_cutoff_frequency    => i_cutoff_frequency,
+        i_adsr_envelope       => w_adsr_envelope,
+        i_adsr_amount         => i_adsr_amount,
+        i_modulation_en       => i_modulation_en,
+        i_modulation          => w_modulation,
+        i_modulation_amount   => i_modulation_amount,
+        i_cutoff_offset       => i_cutoff_offset,
+        i_key_note            => i_key_note,
+        i_key_tracking_amount => i_key_tracking_amount,
+        i_oversample_en       => r_oversample,
+        i_sample_rate         => r_sample_rate,
+        i_filter_type         => i_filter_type,
+        i_filter_attenuation  => i_filter_attenuation,
+        o_output              => w_output,
+        o_data_valid          => w_data_valid_out
+    );
+
+    -- 2x decimation of the oversampled output
+    w_decimator_en <= w_data_valid_out and r_oversample;
+    
+    decimator : entity work.halfband_decimator
     generic map(
         g_NUM_CHANNELS => g_NUM_CHANNELS,
-        g_DATA_WIDTH   => g_DATA_WIDTH   
+        g_DATA_WIDTH   => g_DATA_WIDTH
     )
     port map(
-        i_clk                => i_clk,
-        i_data_valid         => w_data_valid_in,
-        i_input              => w_input,
-        i_resonance          => i_resonance,
-        i_cutoff_frequency   => i_cutoff_frequency,
-        i_adsr_envelope      => w_adsr_envelope,
-        i_adsr_amount        => i_adsr_amount,
-        i_modulation_en      => i_modulation_en,
-        i_modulation         => w_modulation,
-        i_modulation_amount  => i_modulation_amount,
-        i_filter_type        => i_filter_type,
-        i_filter_attenuation => i_filter_attenuation,
-        o_output             => w_output,
-        o_data_valid         => w_data_valid_out
+        i_clk   => i_clk,
+        i_en    => w_decimator_en,
+        i_phase => r_output_pass,
+        i_x     => w_output,
+        o_en    => w_decimator_valid,
+        o_y     => w_decimator_output
     );
 
 end arch;
\ No newline at end of file
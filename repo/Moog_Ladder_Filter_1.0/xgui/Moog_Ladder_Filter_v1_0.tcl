@@ -8,6 +8,10 @@ proc init_gui { IPINST } {
   ipgui::add_param $IPINST -name "C_S_AXI_CTRL_BASEADDR" -parent ${Page_0}
   ipgui::add_param $IPINST -name "C_S_AXI_CTRL_HIGHADDR" -parent ${Page_0}
   ipgui::add_param $IPINST -name "g_NUM_CHANNELS" -parent ${Page_0}
+  set g_TANH_IMPLEMENTATION [ipgui::add_param $IPINST -name "g_TANH_IMPLEMENTATION" -parent ${Page_0}]
+  set_property tooltip {Feedback saturator: polynomial (0) or interpolated lookup table (1)} ${g_TANH_IMPLEMENTATION}
+  set g_CYCLES_PER_SAMPLE [ipgui::add_param $IPINST -name "g_CYCLES_PER_SAMPLE" -parent ${Page_0}]
+  set_property tooltip {Clock cycles per audio sample (clock frequency / sample rate), the rate the key tracking is referenced to} ${g_CYCLES_PER_SAMPLE}
 
 
 }
@@ -21,6 +25,24 @@ proc validate_PARAM_VALUE.g_DATA_WIDTH { PARAM_VALUE.g_DATA_WIDTH } {
 	return true
 }
 
+proc update_PARAM_VALUE.g_TANH_IMPLEMENTATION { PARAM_VALUE.g_TANH_IMPLEMENTATION } {
+	# Procedure called to update g_TANH_IMPLEMENTATION when any of the dependent parameters in the arguments change
+}
+
+proc validate_PARAM_VALUE.g_TANH_IMPLEMENTATION { PARAM_VALUE.g_TANH_IMPLEMENTATION } {
+	# Procedure called to validate g_TANH_IMPLEMENTATION
+	return true
+}
+
+proc update_PARAM_VALUE.g_CYCLES_PER_SAMPLE { PARAM_VALUE.g_CYCLES_PER_SAMPLE } {
+	# Procedure called to update g_CYCLES_PER_SAMPLE when any of the dependent parameters in the arguments change
+}
+
+proc validate_PARAM_VALUE.g_CYCLES_PER_SAMPLE { PARAM_VALUE.g_CYCLES_PER_SAMPLE } {
+	# Procedure called to validate g_CYCLES_PER_SAMPLE
+	return true
+}
+
 proc update_PARAM_VALUE.g_NUM_CHANNELS { PARAM_VALUE.g_NUM_CHANNELS } {
 	# Procedure called to update g_NUM_CHANNELS when any of the dependent parameters in the arguments change
 }
@@ -157,3 +179,13 @@ proc update_MODELPARAM_VALUE.g_DATA_WIDTH { MODELPARAM_VALUE.g_DATA_WIDTH PARAM_
 	set_property value [get_property value ${PARAM_VALUE.g_DATA_WIDTH}] ${MODELPARAM_VALUE.g_DATA_WIDTH}
 }
 
+proc update_MODELPARAM_VALUE.g_TANH_IMPLEMENTATION { MODELPARAM_VALUE.g_TANH_IMPLEMENTATION PARAM_VALUE.g_TANH_IMPLEMENTATION } {
+	# Procedure called to set VHDL generic/Verilog parameter value(s) based on TCL parameter value
+	set_property value [get_property value ${PARAM_VALUE.g_TANH_IMPLEMENTATION}] ${MODELPARAM_VALUE.g_TANH_IMPLEMENTATION}
+}
+
+proc update_MODELPARAM_VALUE.g_CYCLES_PER_SAMPLE { MODELPARAM_VALUE.g_CYCLES_PER_SAMPLE PARAM_VALUE.g_CYCLES_PER_SAMPLE } {
+	# Procedure called to set VHDL generic/Verilog parameter value(s) based on TCL parameter value
+	set_property value [get_property value ${PARAM_VALUE.g_CYCLES_PER_SAMPLE}] ${MODELPARAM_VALUE.g_CYCLES_PER_SAMPLE}
+}
+
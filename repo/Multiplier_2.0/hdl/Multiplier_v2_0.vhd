@@ -9,6 +9,10 @@ entity Multiplier_v2_0 is
         g_DATA_WIDTH     : integer := 24;
         g_ENVELOPE_WIDTH : integer := 18;
 
+		-- Parameters of Axi Slave Bus Interface S_AXI_CTRL
+		C_S_AXI_CTRL_DATA_WIDTH	: integer	:= 32;
+		C_S_AXI_CTRL_ADDR_WIDTH	: integer	:= 4;
+
 		-- Parameters of Axi Slave Bus Interface S_AXIS_INPUT
 		C_S_AXIS_INPUT_TDATA_WIDTH	: integer	:= 32;
 
@@ -23,6 +27,29 @@ entity Multiplier_v2_0 is
 		-- Users to add ports here
         i_enable : in std_logic;
 
+		-- Ports of Axi Slave Bus Interface S_AXI_CTRL
+		s_axi_ctrl_aclk	: in std_logic;
+		s_axi_ctrl_aresetn	: in std_logic;
+		s_axi_ctrl_awaddr	: in std_logic_vector(C_S_AXI_CTRL_ADDR_WIDTH-1 downto 0);
+		s_axi_ctrl_awprot	: in std_logic_vector(2 downto 0);
+		s_axi_ctrl_awvalid	: in std_logic;
+		s_axi_ctrl_awready	: out std_logic;
+		s_axi_ctrl_wdata	: in std_logic_vector(C_S_AXI_CTRL_DATA_WIDTH-1 downto 0);
+		s_axi_ctrl_wstrb	: in std_logic_vector((C_S_AXI_CTRL_DATA_WIDTH/8)-1 downto 0);
+		s_axi_ctrl_wvalid	: in std_logic;
+		s_axi_ctrl_wready	: out std_logic;
+		s_axi_ctrl_bresp	: out std_logic_vector(1 downto 0);
+		s_axi_ctrl_bvalid	: out std_logic;
+		s_axi_ctrl_bready	: in std_logic;
+		s_axi_ctrl_araddr	: in std_logic_vector(C_S_AXI_CTRL_ADDR_WIDTH-1 downto 0);
+		s_axi_ctrl_arprot	: in std_logic_vector(2 downto 0);
+		s_axi_ctrl_arvalid	: in std_logic;
+		s_axi_ctrl_arready	: out std_logic;
+		s_axi_ctrl_rdata	: out std_logic_vector(C_S_AXI_CTRL_DATA_WIDTH-1 downto 0);
+		s_axi_ctrl_rresp	: out std_logic_vector(1 downto 0);
+		s_axi_ctrl_rvalid	: out std_logic;
+		s_axi_ctrl_rready	: in std_logic;
+
 		-- Ports of Axi Slave Bus Interface S_AXIS_INPUT
 		s_axis_input_aclk	: in std_logic;
 		s_axis_input_aresetn	: in std_logic;
@@ -57,7 +84,7 @@ architecture arch_imp of Multiplier_v2_0 is
     -- output fifo signals
 	signal w_output_fifo_wr_en   : std_logic;
 	signal w_output_fifo_wr_data : std_logic_vector(g_DATA_WIDTH-1 downto 0);
-	signal w_output_fifo_full    : std_logic;
+	signal w_output_fifo_almost_full : std_logic;
 	-- pulse width modulation fifo signals
 	signal w_input_fifo_rd_en   : std_logic;
     signal w_input_fifo_rd_data : std_logic_vector(g_DATA_WIDTH-1 downto 0);
@@ -66,9 +93,58 @@ architecture arch_imp of Multiplier_v2_0 is
 	signal w_envelope_fifo_rd_en   : std_logic;
     signal w_envelope_fifo_rd_data : std_logic_vector(g_DATA_WIDTH-1 downto 0);
 	signal w_envelope_fifo_empty   : std_logic;
+	-- fifo status signals
+    signal w_fifo_select                : std_logic_vector(1 downto 0);
+    signal w_fifo_level_status          : std_logic_vector(31 downto 0);
+    signal w_fifo_error_status          : std_logic_vector(31 downto 0);
+    signal w_input_fifo_level_status    : std_logic_vector(31 downto 0);
+    signal w_input_fifo_error_status    : std_logic_vector(31 downto 0);
+    signal w_envelope_fifo_level_status : std_logic_vector(31 downto 0);
+    signal w_envelope_fifo_error_status : std_logic_vector(31 downto 0);
+    signal w_output_fifo_level_status   : std_logic_vector(31 downto 0);
+    signal w_output_fifo_error_status   : std_logic_vector(31 downto 0);
+    -- flow status signals
+    signal w_flow_status_clear : std_logic;
+    signal w_overflow_count    : std_logic_vector(15 downto 0);
+    signal w_underrun_count    : std_logic_vector(15 downto 0);
 
 begin
 
+-- Instantiation of Axi Bus Interface S_AXI_CTRL
+    Multiplier_v2_0_S_AXI_CTRL_inst : entity work.Multiplier_v2_0_S_AXI_CTRL
+	generic map (
+		C_S_AXI_DATA_WIDTH	=> C_S_AXI_CTRL_DATA_WIDTH,
+		C_S_AXI_ADDR_WIDTH	=> C_S_AXI_CTRL_ADDR_WIDTH
+	)
+	port map (
+        o_flow_status_clear => w_flow_status_clear,
+        i_flow_status       => w_underrun_count & w_overflow_count,
+        o_fifo_select       => w_fifo_select,
+        i_fifo_level_status => w_fifo_level_status,
+        i_fifo_error_status => w_fifo_error_status,
+		S_AXI_ACLK  	=> s_axi_ctrl_aclk,
+		S_AXI_ARESETN	=> s_axi_ctrl_aresetn,
+		S_AXI_AWADDR	=> s_axi_ctrl_awaddr,
+		S_AXI_AWPROT	=> s_axi_ctrl_awprot,
+		S_AXI_AWVALID	=> s_axi_ctrl_awvalid,
+		S_AXI_AWREADY	=> s_axi_ctrl_awready,
+		S_AXI_WDATA	    => s_axi_ctrl_wdata,
+		S_AXI_WSTRB  	=> s_axi_ctrl_wstrb,
+		S_AXI_WVALID	=> s_axi_ctrl_wvalid,
+		S_AXI_WREADY	=> s_axi_ctrl_wready,
+		S_AXI_BRESP 	=> s_axi_ctrl_bresp,
+		S_AXI_BVALID	=> s_axi_ctrl_bvalid,
+		S_AXI_BREADY	=> s_axi_ctrl_bready,
+		S_AXI_ARADDR	=> s_axi_ctrl_araddr,
+		S_AXI_ARPROT	=> s_axi_ctrl_arprot,
+		S_AXI_ARVALID	=> s_axi_ctrl_arvalid,
+		S_AXI_ARREADY	=> s_axi_ctrl_arready,
+		S_AXI_RDATA 	=> s_axi_ctrl_rdata,
+		S_AXI_RRESP 	=> s_axi_ctrl_rresp,
+		S_AXI_RVALID	=> s_axi_ctrl_rvalid,
+		S_AXI_RREADY	=> s_axi_ctrl_rready
+	);
+
 -- Instantiation of Axi Bus Interface S_AXIS_INPUT
     Multiplier_v2_0_S_AXIS_INPUT_inst : entity work.Multiplier_v2_0_S_AXIS_INPUT
 	generic map (
@@ -80,6 +156,8 @@ begin
 	    i_fifo_rd_en    => w_input_fifo_rd_en,
         o_fifo_rd_data  => w_input_fifo_rd_data,
 	    o_fifo_empty    => w_input_fifo_empty,
+        o_fifo_level_status => w_input_fifo_level_status,
+        o_fifo_error_status => w_input_fifo_error_status,
 		S_AXIS_ACLK	    => s_axis_input_aclk,
 		S_AXIS_ARESETN	=> s_axis_input_aresetn,
 		S_AXIS_TREADY	=> s_axis_input_tready,
@@ -100,6 +178,8 @@ begin
 	    i_fifo_rd_en    => w_envelope_fifo_rd_en,
         o_fifo_rd_data  => w_envelope_fifo_rd_data,
 	    o_fifo_empty    => w_envelope_fifo_empty,
+        o_fifo_level_status => w_envelope_fifo_level_status,
+        o_fifo_error_status => w_envelope_fifo_error_status,
 		S_AXIS_ACLK 	=> s_axis_envelope_aclk,
 		S_AXIS_ARESETN	=> s_axis_envelope_aresetn,
 		S_AXIS_TREADY	=> s_axis_envelope_tready,
@@ -120,7 +200,9 @@ begin
 	port map (
 	    i_fifo_wr_en    => w_output_fifo_wr_en,
         i_fifo_wr_data  => w_output_fifo_wr_data,
-	    o_fifo_full     => w_output_fifo_full,
+	    o_fifo_almost_full => w_output_fifo_almost_full,
+        o_fifo_level_status => w_output_fifo_level_status,
+        o_fifo_error_status => w_output_fifo_error_status,
 		M_AXIS_ACLK 	=> m_axis_output_aclk,
 		M_AXIS_ARESETN	=> m_axis_output_aresetn,
 		M_AXIS_TVALID	=> m_axis_output_tvalid,
@@ -150,7 +232,19 @@ begin
         -- output fifo interface
         o_output_fifo_wr_en      => w_output_fifo_wr_en,
         o_output_fifo_wr_data    => w_output_fifo_wr_data,
-	    i_output_fifo_full       => w_output_fifo_full
+	    i_output_fifo_almost_full => w_output_fifo_almost_full,
+        -- flow status
+	    i_flow_status_clear       => w_flow_status_clear,
+	    o_overflow_count          => w_overflow_count,
+	    o_underrun_count          => w_underrun_count
     );
 
+    -- fifo status {input, envelope, output}
+    w_fifo_level_status <= w_input_fifo_level_status    when w_fifo_select = "00" else
+                           w_envelope_fifo_level_status when w_fifo_select = "01" else
+                           w_output_fifo_level_status;
+    w_fifo_error_status <= w_input_fifo_error_status    when w_fifo_select = "00" else
+                           w_envelope_fifo_error_status when w_fifo_select = "01" else
+                           w_output_fifo_error_status;
+
 end arch_imp;
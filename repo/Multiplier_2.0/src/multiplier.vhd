@@ -9,75 +9,154 @@ entity multiplier is
         g_ENVELOPE_WIDTH : integer := 18
     );
     port(
-        i_clk                    : in std_logic;
-        i_enable                 : in std_logic;
+        i_clk                     : in std_logic;
+        i_enable                  : in std_logic;
         -- input fifo interface
-        o_input_fifo_rd_en       : out std_logic;
-        i_input_fifo_rd_data     : in std_logic_vector(g_DATA_WIDTH-1 downto 0);
-	    i_input_fifo_empty       : in std_logic;
+        o_input_fifo_rd_en        : out std_logic;
+        i_input_fifo_rd_data      : in std_logic_vector(g_DATA_WIDTH-1 downto 0);
+	    i_input_fifo_empty        : in std_logic;
         -- envelope fifo interface
-        o_envelope_fifo_rd_en    : out std_logic;
-        i_envelope_fifo_rd_data  : in std_logic_vector(g_ENVELOPE_WIDTH-1 downto 0);
-	    i_envelope_fifo_empty    : in std_logic;
+        o_envelope_fifo_rd_en     : out std_logic;
+        i_envelope_fifo_rd_data   : in std_logic_vector(g_ENVELOPE_WIDTH-1 downto 0);
+	    i_envelope_fifo_empty     : in std_logic;
         -- output fifo interface
-        o_output_fifo_wr_en      : out std_logic;
-        o_output_fifo_wr_data    : out std_logic_vector(g_DATA_WIDTH-1 downto 0); -- Q1.23
-	    i_output_fifo_full       : in std_logic
+        o_output_fifo_wr_en       : out std_logic;
+        o_output_fifo_wr_data     : out std_logic_vector(g_DATA_WIDTH-1 downto 0); -- Q1.23
+	    i_output_fifo_almost_full : in std_logic;
+	    -- flow status
+	    i_flow_status_clear       : in std_logic;
+	    o_overflow_count          : out std_logic_vector(15 downto 0); -- sample periods not started on their enable
+	    o_underrun_count          : out std_logic_vector(15 downto 0)  -- voices processed with a missing input
     );
 end multiplier;
 
 architecture arch of multiplier is
     -- constants
     constant c_PROD_WIDTH : integer := g_DATA_WIDTH + g_ENVELOPE_WIDTH;
-    
+    constant c_MAX_COUNT  : integer := 2**16-1;
+
     -- types
     type t_state is (idle, processing);
-    
+
     -- signals
     signal r_state : t_state := idle;
     signal r_product : signed(c_PROD_WIDTH-1 downto 0) := (others => '0');
-    
-    signal r_input_fifo_empty    : std_logic := '0';
-    signal r_envelope_fifo_empty : std_logic := '0';
-    
-    signal r_channel_index : integer := 0;
-    
+
+    signal r_start_pending : std_logic := '0';
+    signal r_deadline      : std_logic := '0';
+
+    signal r_channel_index : integer range 0 to g_NUM_CHANNELS-1 := 0;
+
+    -- samples of each stream replaced by zero and not yet arrived, modulo a
+    -- sample period as a stream that skips whole periods stays voice aligned
+    signal r_input_missing    : integer range 0 to g_NUM_CHANNELS-1 := 0;
+    signal r_envelope_missing : integer range 0 to g_NUM_CHANNELS-1 := 0;
+
+    signal w_input_valid    : std_logic;
+    signal w_envelope_valid : std_logic;
+    signal w_input_drop     : std_logic;
+    signal w_envelope_drop  : std_logic;
+    signal w_advance        : std_logic;
+
     signal w_input    : signed(g_DATA_WIDTH-1 downto 0);
     signal w_envelope : signed(g_ENVELOPE_WIDTH-1 downto 0);
+
+    signal r_overflow_count : integer range 0 to c_MAX_COUNT := 0;
+    signal r_underrun_count : integer range 0 to c_MAX_COUNT := 0;
 begin
-    -- read input from fifo if fifo is not empty 
-    w_input    <= signed(i_input_fifo_rd_data)    when r_input_fifo_empty = '0'    else (others => '0');
-    w_envelope <= signed(i_envelope_fifo_rd_data) when r_envelope_fifo_empty = '0' else (others => '0');
-    
-    -- only read from the fifo if processing and the fifo is initially not empty
-    o_input_fifo_rd_en     <= '1' when r_state = processing and r_input_fifo_empty = '0'    else '0';
-    o_envelope_fifo_rd_en  <= '1' when r_state = processing and r_envelope_fifo_empty = '0' else '0';
-    
+    -- a sample arriving after it was replaced by zero belongs to an earlier voice,
+    -- it is dropped so the streams stay aligned on the voice
+    w_input_drop     <= '1' when r_input_missing /= 0 and i_input_fifo_empty = '0' else '0';
+    w_envelope_drop  <= '1' when r_envelope_missing /= 0 and i_envelope_fifo_empty = '0' else '0';
+
+    w_input_valid    <= '1' when r_input_missing = 0 and i_input_fifo_empty = '0' else '0';
+    w_envelope_valid <= '1' when r_envelope_missing = 0 and i_envelope_fifo_empty = '0' else '0';
+
+    -- a voice is processed once both samples are available and the output has space,
+    -- after the next enable (the sample period deadline) missing samples are replaced by zero
+    w_advance <= '1' when r_state = processing and i_output_fifo_almost_full = '0' and
+                          ((w_input_valid = '1' and w_envelope_valid = '1') or r_deadline = '1') else '0';
+
+    w_input    <= signed(i_input_fifo_rd_data)    when w_input_valid = '1'    else (others => '0');
+    w_envelope <= signed(i_envelope_fifo_rd_data) when w_envelope_valid = '1' else (others => '0');
+
+    o_input_fifo_rd_en    <= (w_advance and w_input_valid) or w_input_drop;
+    o_envelope_fifo_rd_en <= (w_advance and w_envelope_valid) or w_envelope_drop;
+
     process(i_clk)
-        variable channel_index : integer := 0;
     begin
         if rising_edge(i_clk) then
+            o_output_fifo_wr_en <= '0';
+
             case r_state is
                 when idle =>
-                    o_output_fifo_wr_en <= '0';
-                    if i_enable = '1' then
-                        r_state <= processing;
-                        r_input_fifo_empty    <= i_input_fifo_empty;
-                        r_envelope_fifo_empty <= i_envelope_fifo_empty;
+                    r_deadline <= '0';
+                    if i_enable = '1' or r_start_pending = '1' then
+                        r_state         <= processing;
+                        r_start_pending <= '0';
                     end if;
-                    
+
                 when processing =>
-                    r_product <= w_input * w_envelope;
-                    o_output_fifo_wr_en <= '1';
-                    channel_index := channel_index + 1;
-                    if channel_index = g_NUM_CHANNELS then
-                        channel_index := 0;
-                        r_state <= idle;
+                    -- the next sample period started before all voices were processed
+                    if i_enable = '1' then
+                        r_start_pending <= '1';
+                        r_deadline      <= '1';
+                    end if;
+
+                    if w_advance = '1' then
+                        r_product <= w_input * w_envelope;
+                        o_output_fifo_wr_en <= '1';
+                        if r_channel_index = g_NUM_CHANNELS-1 then
+                            r_channel_index <= 0;
+                            r_state <= idle;
+                        else
+                            r_channel_index <= r_channel_index + 1;
+                        end if;
                     end if;
             end case;
         end if;
     end process;
 
+    -- missing samples, counted when replaced by zero and uncounted when dropped
+    process(i_clk)
+    begin
+        if rising_edge(i_clk) then
+            if w_advance = '1' and w_input_valid = '0' and w_input_drop = '0' then
+                r_input_missing <= (r_input_missing + 1) mod g_NUM_CHANNELS;
+            elsif w_advance = '0' and w_input_drop = '1' then
+                r_input_missing <= r_input_missing - 1;
+            end if;
+
+            if w_advance = '1' and w_envelope_valid = '0' and w_envelope_drop = '0' then
+                r_envelope_missing <= (r_envelope_missing + 1) mod g_NUM_CHANNELS;
+            elsif w_advance = '0' and w_envelope_drop = '1' then
+                r_envelope_missing <= r_envelope_missing - 1;
+            end if;
+        end if;
+    end process;
+
+    -- sticky flow counters, saturate until cleared
+    process(i_clk)
+    begin
+        if rising_edge(i_clk) then
+            if i_flow_status_clear = '1' then
+                r_overflow_count <= 0;
+                r_underrun_count <= 0;
+            else
+                if i_enable = '1' and (r_state = processing or r_start_pending = '1') and r_overflow_count /= c_MAX_COUNT then
+                    r_overflow_count <= r_overflow_count + 1;
+                end if;
+
+                if w_advance = '1' and (w_input_valid = '0' or w_envelope_valid = '0') and r_underrun_count /= c_MAX_COUNT then
+                    r_underrun_count <= r_underrun_count + 1;
+                end if;
+            end if;
+        end if;
+    end process;
+
     o_output_fifo_wr_data <= std_logic_vector(resize(shift_right(r_product, g_ENVELOPE_WIDTH-1), g_DATA_WIDTH));
 
+    o_overflow_count <= std_logic_vector(to_unsigned(r_overflow_count, 16));
+    o_underrun_count <= std_logic_vector(to_unsigned(r_underrun_count, 16));
+
 end arch;
@@ -16,6 +16,11 @@ entity Oscillator_v2_0 is
 		C_S_AXI_CTRL_DATA_WIDTH	: integer	:= 32;
 		C_S_AXI_CTRL_ADDR_WIDTH	: integer	:= 6;
 
+		-- Parameters of Axi Slave Bus Interface S_AXI_PARAM
+		C_S_AXI_PARAM_ID_WIDTH	: integer	:= 1;
+		C_S_AXI_PARAM_DATA_WIDTH	: integer	:= 32;
+		C_S_AXI_PARAM_ADDR_WIDTH	: integer	:= 13;
+
 		-- Parameters of Axi Master Bus Interface M_AXIS_OUTPUT
 		C_M_AXIS_OUTPUT_TDATA_WIDTH	: integer	:= 32;
 		C_M_AXIS_OUTPUT_START_COUNT	: integer	:= 32;
@@ -56,6 +61,45 @@ entity Oscillator_v2_0 is
 		s_axi_ctrl_rvalid	: out std_logic;
 		s_axi_ctrl_rready	: in std_logic;
 
+		-- Ports of Axi Slave Bus Interface S_AXI_PARAM
+		s_axi_param_aclk	: in std_logic;
+		s_axi_param_aresetn	: in std_logic;
+		s_axi_param_awid	: in std_logic_vector(C_S_AXI_PARAM_ID_WIDTH-1 downto 0);
+		s_axi_param_awaddr	: in std_logic_vector(C_S_AXI_PARAM_ADDR_WIDTH-1 downto 0);
+		s_axi_param_awlen	: in std_logic_vector(7 downto 0);
+		s_axi_param_awsize	: in std_logic_vector(2 downto 0);
+		s_axi_param_awburst	: in std_logic_vector(1 downto 0);
+		s_axi_param_awlock	: in std_logic;
+		s_axi_param_awcache	: in std_logic_vector(3 downto 0);
+		s_axi_param_awprot	: in std_logic_vector(2 downto 0);
+		s_axi_param_awvalid	: in std_logic;
+		s_axi_param_awready	: out std_logic;
+		s_axi_param_wdata	: in std_logic_vector(C_S_AXI_PARAM_DATA_WIDTH-1 downto 0);
+		s_axi_param_wstrb	: in std_logic_vector((C_S_AXI_PARAM_DATA_WIDTH/8)-1 downto 0);
+		s_axi_param_wlast	: in std_logic;
+		s_axi_param_wvalid	: in std_logic;
+		s_axi_param_wready	: out std_logic;
+		s_axi_param_bid	: out std_logic_vector(C_S_AXI_PARAM_ID_WIDTH-1 downto 0);
+		s_axi_param_bresp	: out std_logic_vector(1 downto 0);
+		s_axi_param_bvalid	: out std_logic;
+		s_axi_param_bready	: in std_logic;
+		s_axi_param_arid	: in std_logic_vector(C_S_AXI_PARAM_ID_WIDTH-1 downto 0);
+		s_axi_param_araddr	: in std_logic_vector(C_S_AXI_PARAM_ADDR_WIDTH-1 downto 0);
+		s_axi_param_arlen	: in std_logic_vector(7 downto 0);
+		s_axi_param_arsize	: in std_logic_vector(2 downto 0);
+		s_axi_param_arburst	: in std_logic_vector(1 downto 0);
+		s_axi_param_arlock	: in std_logic;
+		s_axi_param_arcache	: in std_logic_vector(3 downto 0);
+		s_axi_param_arprot	: in std_logic_vector(2 downto 0);
+		s_axi_param_arvalid	: in std_logic;
+		s_axi_param_arready	: out std_logic;
+		s_axi_param_rid	: out std_logic_vector(C_S_AXI_PARAM_ID_WIDTH-1 downto 0);
+		s_axi_param_rdata	: out std_logic_vector(C_S_AXI_PARAM_DATA_WIDTH-1 downto 0);
+		s_axi_param_rresp	: out std_logic_vector(1 downto 0);
+		s_axi_param_rlast	: out std_logic;
+		s_axi_param_rvalid	: out std_logic;
+		s_axi_param_rready	: in std_logic;
+
 		-- Ports of Axi Master Bus Interface M_AXIS_OUTPUT
 		m_axis_output_aclk	: in std_logic;
 		m_axis_output_aresetn	: in std_logic;
@@ -90,7 +134,7 @@ architecture arch_imp of Oscillator_v2_0 is
 	-- output fifo signals
 	signal w_output_fifo_wr_en   : std_logic;
 	signal w_output_fifo_wr_data : std_logic_vector(g_DATA_WIDTH-1 downto 0);
-	signal w_output_fifo_full    : std_logic;
+	signal w_output_fifo_almost_full : std_logic;
 	-- pulse width modulation fifo signals
 	signal w_pwm_fifo_rd_en   : std_logic;
     signal w_pwm_fifo_rd_data : std_logic_vector(g_DATA_WIDTH-1 downto 0);
@@ -109,6 +153,39 @@ architecture arch_imp of Oscillator_v2_0 is
     signal w_amplitude   : std_logic_vector(17 downto 0);
     signal w_fcw         : std_logic_vector(17 downto 0);
     signal w_detune      : std_logic_vector(17 downto 0);
+    signal w_unison_detune : std_logic_vector(17 downto 0);
+    -- per voice parameter RAM {frequency, detune, amplitude, pulse width},
+    -- frequency is indexed by channel, the others by oscillator and channel
+    signal w_param_source  : std_logic_vector(3 downto 0);
+    signal w_param_index   : std_logic_vector(4*9-1 downto 0);
+    signal w_param_data    : std_logic_vector(4*C_S_AXI_PARAM_DATA_WIDTH-1 downto 0);
+    -- parameters to the oscillator, a cycle after the select
+    signal r_mod_enable    : std_logic := '0';
+    signal r_pwm_enable    : std_logic := '0';
+    signal r_pulse_width   : std_logic_vector(g_DATA_WIDTH-1 downto 0) := (others => '0');
+    signal r_wave_select   : std_logic_vector(1 downto 0) := (others => '0');
+    signal r_amplitude     : std_logic_vector(17 downto 0) := (others => '0');
+    signal r_fcw           : std_logic_vector(17 downto 0) := (others => '0');
+    signal r_detune        : std_logic_vector(17 downto 0) := (others => '0');
+    signal r_unison_detune : std_logic_vector(17 downto 0) := (others => '0');
+    signal w_param_detune  : std_logic_vector(17 downto 0);
+    signal w_osc_pulse_width : std_logic_vector(g_DATA_WIDTH-1 downto 0);
+    signal w_osc_amplitude   : std_logic_vector(17 downto 0);
+    signal w_osc_fcw         : std_logic_vector(17 downto 0);
+    signal w_osc_detune      : std_logic_vector(17 downto 0);
+    -- fifo status signals
+    signal w_fifo_select                  : std_logic_vector(1 downto 0);
+    signal w_fifo_level_status            : std_logic_vector(31 downto 0);
+    signal w_fifo_error_status            : std_logic_vector(31 downto 0);
+    signal w_output_fifo_level_status     : std_logic_vector(31 downto 0);
+    signal w_output_fifo_error_status     : std_logic_vector(31 downto 0);
+    signal w_pwm_fifo_level_status        : std_logic_vector(31 downto 0);
+    signal w_pwm_fifo_error_status        : std_logic_vector(31 downto 0);
+    signal w_modulation_fifo_level_status : std_logic_vector(31 downto 0);
+    signal w_modulation_fifo_error_status : std_logic_vector(31 downto 0);
+    signal w_flow_status_clear            : std_logic;
+    signal w_overflow_count               : std_logic_vector(15 downto 0);
+    signal w_underrun_count               : std_logic_vector(15 downto 0);
 
 begin
 
@@ -130,6 +207,13 @@ begin
         o_amplitude     => w_amplitude,
         o_fcw           => w_fcw,
         o_detune        => w_detune,
+        o_unison_detune => w_unison_detune,
+        o_param_source  => w_param_source,
+        o_fifo_select       => w_fifo_select,
+        i_fifo_level_status => w_fifo_level_status,
+        i_fifo_error_status => w_fifo_error_status,
+        o_flow_status_clear => w_flow_status_clear,
+        i_flow_status       => w_underrun_count & w_overflow_count,
 		S_AXI_ACLK  	=> s_axi_ctrl_aclk,
 		S_AXI_ARESETN	=> s_axi_ctrl_aresetn,
 		S_AXI_AWADDR	=> s_axi_ctrl_awaddr,
@@ -153,18 +237,73 @@ begin
 		S_AXI_RREADY	=> s_axi_ctrl_rready
 	);
 
+    -- Instantiation of Axi Bus Interface S_AXI_PARAM
+    param_ram : entity work.axi_param_ram
+	generic map (
+	    g_NUM_BANKS         => 4,
+	    g_INDEX_WIDTH       => 9,
+	    g_MEMORY_TYPE       => "block",
+		C_S_AXI_ID_WIDTH	=> C_S_AXI_PARAM_ID_WIDTH,
+		C_S_AXI_DATA_WIDTH	=> C_S_AXI_PARAM_DATA_WIDTH,
+		C_S_AXI_ADDR_WIDTH	=> C_S_AXI_PARAM_ADDR_WIDTH
+	)
+	port map (
+	    i_rd_index      => w_param_index,
+	    o_rd_data       => w_param_data,
+		S_AXI_ACLK	    => s_axi_param_aclk,
+		S_AXI_ARESETN	=> s_axi_param_aresetn,
+		S_AXI_AWID	    => s_axi_param_awid,
+		S_AXI_AWADDR	=> s_axi_param_awaddr,
+		S_AXI_AWLEN	    => s_axi_param_awlen,
+		S_AXI_AWSIZE	=> s_axi_param_awsize,
+		S_AXI_AWBURST	=> s_axi_param_awburst,
+		S_AXI_AWLOCK	=> s_axi_param_awlock,
+		S_AXI_AWCACHE	=> s_axi_param_awcache,
+		S_AXI_AWPROT	=> s_axi_param_awprot,
+		S_AXI_AWVALID	=> s_axi_param_awvalid,
+		S_AXI_AWREADY	=> s_axi_param_awready,
+		S_AXI_WDATA	    => s_axi_param_wdata,
+		S_AXI_WSTRB	    => s_axi_param_wstrb,
+		S_AXI_WLAST	    => s_axi_param_wlast,
+		S_AXI_WVALID	=> s_axi_param_wvalid,
+		S_AXI_WREADY	=> s_axi_param_wready,
+		S_AXI_BID	    => s_axi_param_bid,
+		S_AXI_BRESP	    => s_axi_param_bresp,
+		S_AXI_BVALID	=> s_axi_param_bvalid,
+		S_AXI_BREADY	=> s_axi_param_bready,
+		S_AXI_ARID	    => s_axi_param_arid,
+		S_AXI_ARADDR	=> s_axi_param_araddr,
+		S_AXI_ARLEN	    => s_axi_param_arlen,
+		S_AXI_ARSIZE	=> s_axi_param_arsize,
+		S_AXI_ARBURST	=> s_axi_param_arburst,
+		S_AXI_ARLOCK	=> s_axi_param_arlock,
+		S_AXI_ARCACHE	=> s_axi_param_arcache,
+		S_AXI_ARPROT	=> s_axi_param_arprot,
+		S_AXI_ARVALID	=> s_axi_param_arvalid,
+		S_AXI_ARREADY	=> s_axi_param_arready,
+		S_AXI_RID	    => s_axi_param_rid,
+		S_AXI_RDATA	    => s_axi_param_rdata,
+		S_AXI_RRESP	    => s_axi_param_rresp,
+		S_AXI_RLAST	    => s_axi_param_rlast,
+		S_AXI_RVALID	=> s_axi_param_rvalid,
+		S_AXI_RREADY	=> s_axi_param_rready
+	);
+
     -- Instantiation of Axi Bus Interface M_AXIS_OUTPUT
     Oscillator_v2_0_M_AXIS_OUTPUT_inst : entity work.Oscillator_v2_0_M_AXIS_OUTPUT
 	generic map (
 	    g_NUM_CHANNELS        => g_NUM_CHANNELS,
 	    g_DATA_WIDTH          => g_DATA_WIDTH,
+	    g_FIFO_ALMOST_FULL_OFFSET => g_NUM_CHANNELS-1, -- a frame is only started into an empty fifo
 		C_M_AXIS_TDATA_WIDTH  => C_M_AXIS_OUTPUT_TDATA_WIDTH,
 		C_M_START_COUNT	      => C_M_AXIS_OUTPUT_START_COUNT
 	)
 	port map (
 	    i_fifo_wr_en    => w_output_fifo_wr_en,
         i_fifo_wr_data  => w_output_fifo_wr_data,
-	    o_fifo_full     => w_output_fifo_full,
+	    o_fifo_almost_full => w_output_fifo_almost_full,
+        o_fifo_level_status => w_output_fifo_level_status,
+        o_fifo_error_status => w_output_fifo_error_status,
 		M_AXIS_ACLK	    => m_axis_output_aclk,
 		M_AXIS_ARESETN	=> m_axis_output_aresetn,
 		M_AXIS_TVALID	=> m_axis_output_tvalid,
@@ -185,6 +324,8 @@ begin
 	    i_fifo_rd_en    => w_modulation_fifo_rd_en,
         o_fifo_rd_data  => w_modulation_fifo_rd_data,
 	    o_fifo_empty    => w_modulation_fifo_empty,
+        o_fifo_level_status => w_modulation_fifo_level_status,
+        o_fifo_error_status => w_modulation_fifo_error_status,
 		S_AXIS_ACLK	    => s_axis_freq_mod_aclk,
 		S_AXIS_ARESETN	=> s_axis_freq_mod_aresetn,
 		S_AXIS_TREADY	=> s_axis_freq_mod_tready,
@@ -205,6 +346,8 @@ begin
 	    i_fifo_rd_en    => w_pwm_fifo_rd_en,
         o_fifo_rd_data  => w_pwm_fifo_rd_data,
 	    o_fifo_empty    => w_pwm_fifo_empty,
+        o_fifo_level_status => w_pwm_fifo_level_status,
+        o_fifo_error_status => w_pwm_fifo_error_status,
 		S_AXIS_ACLK	    => s_axis_pwm_aclk,
 		S_AXIS_ARESETN	=> s_axis_pwm_aresetn,
 		S_AXIS_TREADY	=> s_axis_pwm_tready,
@@ -219,7 +362,8 @@ begin
     generic map(
         g_NUM_CHANNELS    => g_NUM_CHANNELS,
         g_NUM_OSCILLATORS => g_NUM_OSCILLATORS,
-        g_DATA_WIDTH      => g_DATA_WIDTH
+        g_DATA_WIDTH      => g_DATA_WIDTH,
+        g_PARAM_LATENCY   => 1
     )
     port map(
         i_clk                     => m_axis_output_aclk,
@@ -227,25 +371,64 @@ begin
         -- filter parameters
         o_oscillator_select       => w_oscillator_select,
         o_channel_select          => w_channel_select,
-        i_wave_select             => w_wave_select,
-        i_fcw                     => w_fcw,
-        i_detune                  => w_detune,
-        i_amplitude               => w_amplitude,
-        i_pulse_width             => w_pulse_width,
+        i_wave_select             => r_wave_select,
+        i_fcw                     => w_osc_fcw,
+        i_detune                  => w_osc_detune,
+        i_amplitude               => w_osc_amplitude,
+        i_pulse_width             => w_osc_pulse_width,
         -- frequency modulation 
-        i_modulation_en           => w_mod_enable,
+        i_modulation_en           => r_mod_enable,
         o_modulation_fifo_rd_en   => w_modulation_fifo_rd_en,
         i_modulation_fifo_rd_data => w_modulation_fifo_rd_data(23 downto 6),
 	    i_modulation_fifo_empty   => w_modulation_fifo_empty,
 	    -- Pulse Width Modulation
-	    i_pwm_en                  => w_pwm_enable,
+	    i_pwm_en                  => r_pwm_enable,
         o_pwm_fifo_rd_en          => w_pwm_fifo_rd_en,
         i_pwm_fifo_rd_data        => w_pwm_fifo_rd_data,
 	    i_pwm_fifo_empty          => w_pwm_fifo_empty,
         -- outputs
         o_output_fifo_wr_en       => w_output_fifo_wr_en,
         o_output_fifo_wr_data     => w_output_fifo_wr_data,
-	    i_output_fifo_full        => w_output_fifo_full
+	    i_output_fifo_almost_full => w_output_fifo_almost_full,
+	    i_flow_status_clear       => w_flow_status_clear,
+	    o_overflow_count          => w_overflow_count,
+	    o_underrun_count          => w_underrun_count
     );
 
+    -- parameters are read a cycle after the select, from the control registers or the parameter RAM
+    w_param_index <= w_oscillator_select & w_channel_select &
+                     w_oscillator_select & w_channel_select &
+                     w_oscillator_select & w_channel_select &
+                     "00" & w_channel_select;
+
+    process(m_axis_output_aclk)
+    begin
+        if rising_edge(m_axis_output_aclk) then
+            r_mod_enable  <= w_mod_enable;
+            r_pwm_enable  <= w_pwm_enable;
+            r_wave_select <= w_wave_select;
+            r_fcw         <= w_fcw;
+            r_detune      <= w_detune;
+            r_unison_detune <= w_unison_detune;
+            r_amplitude   <= w_amplitude;
+            r_pulse_width <= w_pulse_width;
+        end if;
+    end process;
+
+    w_osc_fcw         <= w_param_data(17 downto 0)                             when w_param_source(0) = '1' else r_fcw;
+    w_param_detune    <= w_param_data(1*C_S_AXI_PARAM_DATA_WIDTH+17 downto 1*C_S_AXI_PARAM_DATA_WIDTH) when w_param_source(1) = '1' else r_detune;
+    w_osc_amplitude   <= w_param_data(2*C_S_AXI_PARAM_DATA_WIDTH+17 downto 2*C_S_AXI_PARAM_DATA_WIDTH) when w_param_source(2) = '1' else r_amplitude;
+    w_osc_pulse_width <= w_param_data(3*C_S_AXI_PARAM_DATA_WIDTH+g_DATA_WIDTH-1 downto 3*C_S_AXI_PARAM_DATA_WIDTH) when w_param_source(3) = '1' else r_pulse_width;
+
+    -- unison slot detune on top of the oscillator detune, both Q4.14
+    w_osc_detune      <= std_logic_vector(resize(shift_right(unsigned(w_param_detune) * unsigned(r_unison_detune), 14), 18));
+
+    -- fifo status register select {frequency modulation, pwm, output}
+    w_fifo_level_status <= w_modulation_fifo_level_status when w_fifo_select = "00" else
+                           w_pwm_fifo_level_status        when w_fifo_select = "01" else
+                           w_output_fifo_level_status;
+    w_fifo_error_status <= w_modulation_fifo_error_status when w_fifo_select = "00" else
+                           w_pwm_fifo_error_status        when w_fifo_select = "01" else
+                           w_output_fifo_error_status;
+
 end arch_imp;
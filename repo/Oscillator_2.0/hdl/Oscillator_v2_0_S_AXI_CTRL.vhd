@@ -25,6 +25,19 @@ entity Oscillator_v2_0_S_AXI_CTRL is
         o_amplitude   : out std_logic_vector(17 downto 0);
         o_fcw         : out std_logic_vector(17 downto 0);
         o_detune      : out std_logic_vector(17 downto 0);
+        -- unison, a note plays on 2**size aligned channels, slot = channel mod 2**size,
+        -- the detune of the slot is applied on top of the oscillator detune
+        o_unison_detune : out std_logic_vector(17 downto 0);
+        -- parameter source per parameter {frequency, detune, amplitude, pulse width},
+        -- registers (0) or per voice parameter RAM (1)
+        o_param_source : out std_logic_vector(3 downto 0);
+        -- FIFO status {frequency modulation, pwm, output}
+        o_fifo_select       : out std_logic_vector(1 downto 0);
+        i_fifo_level_status : in std_logic_vector(31 downto 0);
+        i_fifo_error_status : in std_logic_vector(31 downto 0);
+        -- flow status, underrun count & overflow count, cleared by a write
+        o_flow_status_clear : out std_logic;
+        i_flow_status       : in std_logic_vector(31 downto 0);
 		-- User ports ends
 		-- Do not modify the ports beyond this line
 
@@ -143,6 +156,7 @@ architecture arch_imp of Oscillator_v2_0_S_AXI_CTRL is
     type t_wave_select_array is array (0 to g_NUM_OSCILLATORS-1) of std_logic_vector(1 downto 0);
     type t_fcw_array         is array (0 to g_NUM_CHANNELS-1)    of std_logic_vector(17 downto 0);
     type t_detune_array      is array (0 to g_NUM_OSCILLATORS-1) of std_logic_vector(17 downto 0);
+    type t_unison_array      is array (0 to 7)                   of std_logic_vector(17 downto 0);
     
     signal r_oscillator_modulation_en : std_logic_vector(0 to g_NUM_OSCILLATORS-1) := (others => '1');
     signal r_oscillator_pwm_en        : std_logic_vector(0 to g_NUM_OSCILLATORS-1) := (others => '0');  
@@ -151,6 +165,9 @@ architecture arch_imp of Oscillator_v2_0_S_AXI_CTRL is
     signal r_oscillator_wave_select   : t_wave_select_array                        := (others => (others => '0'));
     signal r_channel_fcw              : t_fcw_array                                := (others => (others => '0'));
     signal r_oscillator_detune        : t_detune_array                             := (others => std_logic_vector(to_unsigned(16384, 18)));
+    signal r_unison_detune            : t_unison_array                             := (others => std_logic_vector(to_unsigned(16384, 18)));
+    signal w_unison_mask              : std_logic_vector(2 downto 0);
+    signal w_unison_slot              : std_logic_vector(2 downto 0);
     
     
 begin
@@ -308,13 +325,8 @@ begin
 	              end if;
 	            end loop;
 	          when b"1010" =>
-	            for byte_index in 0 to (C_S_AXI_DATA_WIDTH/8-1) loop
-	              if ( S_AXI_WSTRB(byte_index) = '1' ) then
-	                -- Respective byte enables are asserted as per write strobes                   
-	                -- slave registor 10
-	                slv_reg10(byte_index*8+7 downto byte_index*8) <= S_AXI_WDATA(byte_index*8+7 downto byte_index*8);
-	              end if;
-	            end loop;
+	               -- unison slot detune {slot[27:25], detune[17:0]}
+	               r_unison_detune(to_integer(unsigned(S_AXI_WDATA(27 downto 25)))) <= S_AXI_WDATA(17 downto 0);
 	          when b"1011" =>
 	            for byte_index in 0 to (C_S_AXI_DATA_WIDTH/8-1) loop
 	              if ( S_AXI_WSTRB(byte_index) = '1' ) then
@@ -459,7 +471,8 @@ begin
 	-- and the slave is ready to accept the read address.
 	slv_reg_rden <= axi_arready and S_AXI_ARVALID and (not axi_rvalid) ;
 
-	process (slv_reg0, slv_reg1, slv_reg2, slv_reg3, slv_reg4, slv_reg5, slv_reg6, slv_reg7, slv_reg8, slv_reg9, slv_reg10, slv_reg11, slv_reg12, slv_reg13, slv_reg14, slv_reg15, axi_araddr, S_AXI_ARESETN, slv_reg_rden)
+	process (slv_reg0, slv_reg1, slv_reg2, slv_reg3, slv_reg4, slv_reg5, slv_reg6, slv_reg7, slv_reg8, slv_reg9, slv_reg10, slv_reg11, slv_reg12, slv_reg13, slv_reg14, slv_reg15, axi_araddr, S_AXI_ARESETN, slv_reg_rden,
+	         i_fifo_level_status, i_fifo_error_status, i_flow_status)
 	variable loc_addr :std_logic_vector(OPT_MEM_ADDR_BITS downto 0);
 	begin
 	    -- Address decoding for reading registers
@@ -480,7 +493,7 @@ begin
 	      when b"0110" =>
 	        reg_data_out <= slv_reg6;
 	      when b"0111" =>
-	        reg_data_out <= slv_reg7;
+	        reg_data_out <= i_flow_status;
 	      when b"1000" =>
 	        reg_data_out <= slv_reg8;
 	      when b"1001" =>
@@ -494,9 +507,9 @@ begin
 	      when b"1101" =>
 	        reg_data_out <= slv_reg13;
 	      when b"1110" =>
-	        reg_data_out <= slv_reg14;
+	        reg_data_out <= i_fifo_level_status;
 	      when b"1111" =>
-	        reg_data_out <= slv_reg15;
+	        reg_data_out <= i_fifo_error_status;
 	      when others =>
 	        reg_data_out  <= (others => '0');
 	    end case;
@@ -529,6 +542,17 @@ begin
     o_amplitude   <= r_oscillator_amplitude((to_integer(unsigned(i_oscillator_select))));
     o_fcw         <= r_channel_fcw((to_integer(unsigned(i_channel_select))));
     o_detune      <= r_oscillator_detune((to_integer(unsigned(i_oscillator_select))));
+    o_fifo_select <= slv_reg13(1 downto 0);
+    o_param_source <= slv_reg8(3 downto 0);
+
+    -- unison slot of the channel, the slot detune is 1.0 without unison
+    w_unison_mask   <= (slv_reg9(1) and slv_reg9(0)) & slv_reg9(1) & (slv_reg9(1) or slv_reg9(0));
+    w_unison_slot   <= i_channel_select(2 downto 0) and w_unison_mask;
+    o_unison_detune <= std_logic_vector(to_unsigned(16384, 18)) when slv_reg9(1 downto 0) = "00" else
+                       r_unison_detune(to_integer(unsigned(w_unison_slot)));
+
+    -- a write to the flow status register clears the overflow and underrun counts
+    o_flow_status_clear <= '1' when slv_reg_wren = '1' and axi_awaddr(ADDR_LSB + OPT_MEM_ADDR_BITS downto ADDR_LSB) = b"0111" else '0';
 
 	-- User logic ends
 
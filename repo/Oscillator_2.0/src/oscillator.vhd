@@ -81,6 +81,7 @@ architecture arch of oscillator is
     signal shift_reg : std_logic;
     
     signal w_octave : unsigned(3 downto 0);                               -- octave of current voice
+    signal r_octave : unsigned(3 downto 0) := (others => '0');            -- octave aligned with the wavetable read
     
 begin
     
@@ -129,7 +130,7 @@ begin
             if r_pw_total(r_pw_total'high downto r_pw_total'high-1) = "01" then -- negative
                 r_pw_saturated <= to_signed(2**23-1, 24);
             elsif r_pw_total(r_pw_total'high downto r_pw_total'high-1) = "10" then -- overflow
-                r_pw_saturated <= to_signed(-2**23-1, 24);
+                r_pw_saturated <= to_signed(-(2**23-1), 24);
             else
                 r_pw_saturated <= signed(resize(r_pw_total, 24));
             end if;
@@ -161,6 +162,7 @@ begin
             r_pw_saturated_z3 <= r_pw_saturated_z2;         
             -- stage 5
             r_pw_saturated_z4 <= r_pw_saturated_z3;
+            r_octave          <= w_octave;
             
             -- stage 6
             case r_wave_select_delay_reg(5) is
@@ -249,7 +251,7 @@ begin
         i_clk    => i_clk,
         i_en     => '1',
         i_addr   => std_logic_vector(r_addr_a(r_addr_a'high downto r_addr_a'high-8+1)),
-        i_octave => std_logic_vector(w_octave),
+        i_octave => std_logic_vector(r_octave),
         o_out    => w_sine
     );
     
@@ -260,7 +262,7 @@ begin
         i_en     => '1',
         i_addr_a => std_logic_vector(r_addr_a),
         i_addr_b => std_logic_vector(r_addr_b),
-        i_octave => std_logic_vector(w_octave),
+        i_octave => std_logic_vector(r_octave),
         o_out_a  => w_saw_a,
         o_out_b  => w_saw_b
     );
@@ -271,7 +273,7 @@ begin
         i_clk    => i_clk,
         i_en     => '1',
         i_addr   => std_logic_vector(r_addr_a),
-        i_octave => std_logic_vector(w_octave),
+        i_octave => std_logic_vector(r_octave),
         o_out    => w_triangle
     );
     
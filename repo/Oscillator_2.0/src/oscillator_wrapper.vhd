@@ -7,7 +7,8 @@ entity oscillator_wrapper is
     generic(
         g_NUM_CHANNELS    : integer := 128;
         g_NUM_OSCILLATORS : integer := 2;
-        g_DATA_WIDTH      : integer := 24
+        g_DATA_WIDTH      : integer := 24;
+        g_PARAM_LATENCY   : integer := 0  -- cycles from the channel/oscillator select to the parameters {0, 1}
     );
     port(
         i_clk                     : in std_logic;
@@ -33,15 +34,37 @@ entity oscillator_wrapper is
         -- outputs
         o_output_fifo_wr_en       : out std_logic;
         o_output_fifo_wr_data     : out std_logic_vector(g_DATA_WIDTH-1 downto 0); -- Q1.23
-	    i_output_fifo_full        : in std_logic 
+	    i_output_fifo_almost_full : in std_logic; -- less than a frame of space left
+	    -- flow status
+	    i_flow_status_clear       : in std_logic;
+	    o_overflow_count          : out std_logic_vector(15 downto 0); -- sample periods not started on their enable
+	    o_underrun_count          : out std_logic_vector(15 downto 0)  -- voices with an empty modulation fifo
     );
 end oscillator_wrapper;
 
 architecture arch of oscillator_wrapper is
 
+    constant c_MAX_COUNT : integer := 2**16-1;
+
     type t_state is (idle, running);
     signal r_state : t_state := idle;
     
+    -- the phase shift register of the oscillator is shifted in contiguous bursts,
+    -- so a frame can not be stalled once started, it is only started with space for all voices
+    signal r_start_pending : std_logic := '0';
+    signal w_start         : std_logic;
+    
+    signal w_pwm_fifo_rd_en        : std_logic;
+    signal w_modulation_fifo_rd_en : std_logic;
+    
+    signal r_overflow_count : integer range 0 to c_MAX_COUNT := 0;
+    signal r_underrun_count : integer range 0 to c_MAX_COUNT := 0;
+    
+    -- oscillator inputs, aligned with the parameters
+    signal w_osc_data_valid : std_logic;
+    signal w_osc_freq_mod   : std_logic_vector(17 downto 0);
+    signal w_osc_pw_mod     : std_logic_vector(23 downto 0);
+    
     signal r_data_valid_in  : std_logic;
     signal w_data_valid_out : std_logic;
     
@@ -75,7 +98,7 @@ begin
         if rising_edge(i_clk) then
             case r_state is
                 when idle =>
-                    if i_en = '1' then
+                    if w_start = '1' then
                         r_state         <= running; 
                         channel_index_input <= 0;
                         oscillator_index_input <= 0;
@@ -100,6 +123,37 @@ begin
         end if;
     end process;
 
+    w_start <= '1' when (i_en = '1' or r_start_pending = '1') and r_state = idle and i_output_fifo_almost_full = '0' else '0';
+
+    -- flow status
+    process(i_clk)
+    begin
+        if rising_edge(i_clk) then
+            if w_start = '1' then
+                r_start_pending <= '0';
+            elsif i_en = '1' then
+                r_start_pending <= '1';
+            end if;
+            
+            if i_flow_status_clear = '1' then
+                r_overflow_count <= 0;
+                r_underrun_count <= 0;
+            else
+                if i_en = '1' and (w_start = '0' or r_start_pending = '1') and r_overflow_count /= c_MAX_COUNT then
+                    r_overflow_count <= r_overflow_count + 1;
+                end if;
+                
+                if ((w_pwm_fifo_rd_en = '1' and i_pwm_fifo_empty = '1') or
+                    (w_modulation_fifo_rd_en = '1' and i_modulation_fifo_empty = '1')) and r_underrun_count /= c_MAX_COUNT then
+                    r_underrun_count <= r_underrun_count + 1;
+                end if;
+            end if;
+        end if;
+    end process;
+    
+    o_overflow_count <= std_logic_vector(to_unsigned(r_overflow_count, 16));
+    o_underrun_count <= std_logic_vector(to_unsigned(r_underrun_count, 16));
+
     process(i_clk)
     begin
         if rising_edge(i_clk) then
@@ -140,14 +194,36 @@ begin
     o_oscillator_select <= std_logic_vector(to_unsigned(oscillator_index_input, o_oscillator_select'length));
     o_channel_select    <= std_logic_vector(to_unsigned(channel_index_input, o_channel_select'length));
 
-    o_pwm_fifo_rd_en        <= '1' when r_pwm_fifo_empty = '0' and oscillator_index_input = g_NUM_OSCILLATORS-1 and r_data_valid_in = '1' else '0';
-    o_modulation_fifo_rd_en <= '1' when r_modulation_fifo_empty = '0' and oscillator_index_input = g_NUM_OSCILLATORS-1 and r_data_valid_in = '1' else '0';
+    w_pwm_fifo_rd_en        <= '1' when r_pwm_fifo_empty = '0' and oscillator_index_input = g_NUM_OSCILLATORS-1 and r_data_valid_in = '1' else '0';
+    w_modulation_fifo_rd_en <= '1' when r_modulation_fifo_empty = '0' and oscillator_index_input = g_NUM_OSCILLATORS-1 and r_data_valid_in = '1' else '0';
+    
+    o_pwm_fifo_rd_en        <= w_pwm_fifo_rd_en;
+    o_modulation_fifo_rd_en <= w_modulation_fifo_rd_en;
     
-    w_pw_mod   <= i_pwm_fifo_rd_data when r_pwm_fifo_empty = '0' else (others => '0');
-    w_freq_mod <= i_modulation_fifo_rd_data when r_modulation_fifo_empty = '0' else (others => '0');
+    -- modulation fifos that were not empty at the start of the frame but run dry are read as zero
+    w_pw_mod   <= i_pwm_fifo_rd_data when r_pwm_fifo_empty = '0' and i_pwm_fifo_empty = '0' else (others => '0');
+    w_freq_mod <= i_modulation_fifo_rd_data when r_modulation_fifo_empty = '0' and i_modulation_fifo_empty = '0' else (others => '0');
     
     o_output_fifo_wr_data <= std_logic_vector(r_output);
 
+    -- parameters read from RAM arrive a cycle after the select,
+    -- so the data valid and the modulation inputs are delayed to match
+    param_latency_0_gen : if g_PARAM_LATENCY = 0 generate
+        w_osc_data_valid <= r_data_valid_in;
+        w_osc_freq_mod   <= w_freq_mod;
+        w_osc_pw_mod     <= w_pw_mod;
+    end generate;
+
+    param_latency_1_gen : if g_PARAM_LATENCY = 1 generate
+        process(i_clk)
+        begin
+            if rising_edge(i_clk) then
+                w_osc_data_valid <= r_data_valid_in;
+                w_osc_freq_mod   <= w_freq_mod;
+                w_osc_pw_mod     <= w_pw_mod;
+            end if;
+        end process;
+    end generate;
 
     
     oscillator : entity work.oscillator
@@ -156,16 +232,16 @@ begin
     )
     port map(
         i_clk         => i_clk,
-        i_data_valid  => r_data_valid_in,
+        i_data_valid  => w_osc_data_valid,
         -- ctrls 
         i_wave_select => i_wave_select,
         i_amplitude   => i_amplitude,
         i_fcw         => i_fcw,
         i_detune      => i_detune,
-        i_freq_mod    => w_freq_mod,
+        i_freq_mod    => w_osc_freq_mod,
         i_mod_en      => i_modulation_en,
         i_pulse_width => i_pulse_width,
-        i_pw_mod      => w_pw_mod,
+        i_pw_mod      => w_osc_pw_mod,
         i_pwm_en      => i_pwm_en,
         o_output      => w_output,
         o_data_valid  => w_data_valid_out
@@ -16,11 +16,9 @@ library ieee;
 use ieee.std_logic_1164.all;
 use ieee.numeric_std.all;
 
-library std;
-use std.textio.all;
-
 library work;
 use work.sawtooth_wavetable_package.all;
+use work.wavetable_rom_package.all;
 
 entity sawtooth_wavetable is
     port(
@@ -36,44 +34,16 @@ end sawtooth_wavetable;
 
 architecture arch of sawtooth_wavetable is
     -- constants
-    constant c_NUM_OCTAVES   : integer := 10; -- # of octaves
+    constant c_NUM_OCTAVES   : integer := c_ROM_NUM_OCTAVES; -- # of octaves
     constant c_ADDR_WIDTH    : integer := 11;
     constant c_DATA_WIDTH    : integer := 24;
     
     -- types
-    type t_wavetable is array(0 to 2**c_ADDR_WIDTH-1) of std_logic_vector(c_DATA_WIDTH-1 downto 0);
-    type t_wavetable_array is array(0 to c_NUM_OCTAVES-1) of t_wavetable;
     type t_slv_array is array(0 to 9) of std_logic_vector(c_DATA_WIDTH-1 downto 0);
     
-    -- bram initilization function
-    impure function read_wavetable(i_directory : in string) return t_wavetable is
-        file     v_file     : text is in i_directory;
-        variable v_line      : line;
-        variable v_data_read  : bit_vector(c_DATA_WIDTH-1 downto 0);
-        variable v_wavetable : t_wavetable := (others => (others => '0'));
-    begin
-        for I in v_Wavetable'range loop
-            readline (v_file, v_line);
-            read(v_line, v_data_read);
-            v_wavetable(I) := to_stdlogicvector(v_data_read);
-        end loop;
-        return v_wavetable;
-    end function;
-
-    -- wavetable binary file directory
-    constant directory  : string := "F:\HDL\Synthesizer\repo\Oscillator_2.0\src\";
-    
-    -- array of triangle wavetables (one per octave) each stored as a bram
-    constant wavetables : t_wavetable_array := (   read_wavetable(directory & "sawtooth0.txt"),
-                                                   read_wavetable(directory & "sawtooth1.txt"),
-                                                   read_wavetable(directory & "sawtooth2.txt"),
-                                                   read_wavetable(directory & "sawtooth3.txt"),
-                                                   read_wavetable(directory & "sawtooth4.txt"),
-                                                   read_wavetable(directory & "sawtooth5.txt"),
-                                                   read_wavetable(directory & "sawtooth6.txt"),
-                                                   read_wavetable(directory & "sawtooth7.txt"),
-                                                   read_wavetable(directory & "sawtooth8.txt"),
-                                                   read_wavetable(directory & "sawtooth9.txt") );
+    -- array of sawtooth wavetables (one per octave) each stored as a bram, initialised from the
+    -- generated constants of wavetable_rom_package
+    constant wavetables : t_rom_array := c_SAWTOOTH_ROM;
                                                    
     -- synchronous outputs of wavetable bram 
     signal r_output_array_a : t_slv_array;
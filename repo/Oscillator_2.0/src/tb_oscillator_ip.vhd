@@ -54,6 +54,11 @@ architecture arch of tb_oscillator_ip is
 		C_S_AXI_CTRL_DATA_WIDTH	: integer	:= 32;
 		C_S_AXI_CTRL_ADDR_WIDTH	: integer	:= 6;
 
+		-- Parameters of Axi Slave Bus Interface S_AXI_PARAM
+		C_S_AXI_PARAM_ID_WIDTH	: integer	:= 1;
+		C_S_AXI_PARAM_DATA_WIDTH	: integer	:= 32;
+		C_S_AXI_PARAM_ADDR_WIDTH	: integer	:= 13;
+
 		-- Parameters of Axi Master Bus Interface M_AXIS_OUTPUT
 		C_M_AXIS_OUTPUT_TDATA_WIDTH	: integer	:= 32;
 		C_M_AXIS_OUTPUT_START_COUNT	: integer	:= 32;
@@ -94,6 +99,45 @@ architecture arch of tb_oscillator_ip is
 		s_axi_ctrl_rvalid	: out std_logic;
 		s_axi_ctrl_rready	: in std_logic;
 
+		-- Ports of Axi Slave Bus Interface S_AXI_PARAM
+		s_axi_param_aclk	: in std_logic;
+		s_axi_param_aresetn	: in std_logic;
+		s_axi_param_awid	: in std_logic_vector(C_S_AXI_PARAM_ID_WIDTH-1 downto 0);
+		s_axi_param_awaddr	: in std_logic_vector(C_S_AXI_PARAM_ADDR_WIDTH-1 downto 0);
+		s_axi_param_awlen	: in std_logic_vector(7 downto 0);
+		s_axi_param_awsize	: in std_logic_vector(2 downto 0);
+		s_axi_param_awburst	: in std_logic_vector(1 downto 0);
+		s_axi_param_awlock	: in std_logic;
+		s_axi_param_awcache	: in std_logic_vector(3 downto 0);
+		s_axi_param_awprot	: in std_logic_vector(2 downto 0);
+		s_axi_param_awvalid	: in std_logic;
+		s_axi_param_awready	: out std_logic;
+		s_axi_param_wdata	: in std_logic_vector(C_S_AXI_PARAM_DATA_WIDTH-1 downto 0);
+		s_axi_param_wstrb	: in std_logic_vector((C_S_AXI_PARAM_DATA_WIDTH/8)-1 downto 0);
+		s_axi_param_wlast	: in std_logic;
+		s_axi_param_wvalid	: in std_logic;
+		s_axi_param_wready	: out std_logic;
+		s_axi_param_bid	: out std_logic_vector(C_S_AXI_PARAM_ID_WIDTH-1 downto 0);
+		s_axi_param_bresp	: out std_logic_vector(1 downto 0);
+		s_axi_param_bvalid	: out std_logic;
+		s_axi_param_bready	: in std_logic;
+		s_axi_param_arid	: in std_logic_vector(C_S_AXI_PARAM_ID_WIDTH-1 downto 0);
+		s_axi_param_araddr	: in std_logic_vector(C_S_AXI_PARAM_ADDR_WIDTH-1 downto 0);
+		s_axi_param_arlen	: in std_logic_vector(7 downto 0);
+		s_axi_param_arsize	: in std_logic_vector(2 downto 0);
+		s_axi_param_arburst	: in std_logic_vector(1 downto 0);
+		s_axi_param_arlock	: in std_logic;
+		s_axi_param_arcache	: in std_logic_vector(3 downto 0);
+		s_axi_param_arprot	: in std_logic_vector(2 downto 0);
+		s_axi_param_arvalid	: in std_logic;
+		s_axi_param_arready	: out std_logic;
+		s_axi_param_rid	: out std_logic_vector(C_S_AXI_PARAM_ID_WIDTH-1 downto 0);
+		s_axi_param_rdata	: out std_logic_vector(C_S_AXI_PARAM_DATA_WIDTH-1 downto 0);
+		s_axi_param_rresp	: out std_logic_vector(1 downto 0);
+		s_axi_param_rlast	: out std_logic;
+		s_axi_param_rvalid	: out std_logic;
+		s_axi_param_rready	: in std_logic;
+
 		-- Ports of Axi Master Bus Interface M_AXIS_OUTPUT
 		m_axis_output_aclk	: in std_logic;
 		m_axis_output_aresetn	: in std_logic;
@@ -245,6 +289,45 @@ begin
 		s_axi_ctrl_rvalid	=> open,
 		s_axi_ctrl_rready	=> '0',
 
+		-- Ports of Axi Slave Bus Interface S_AXI_PARAM
+		s_axi_param_aclk	=> axi_aclk,
+		s_axi_param_aresetn	=> axi_aresetn,
+		s_axi_param_awid	=> (others => '0'),
+		s_axi_param_awaddr	=> (others => '0'),
+		s_axi_param_awlen	=> (others => '0'),
+		s_axi_param_awsize	=> (others => '0'),
+		s_axi_param_awburst	=> (others => '0'),
+		s_axi_param_awlock	=> '0',
+		s_axi_param_awcache	=> (others => '0'),
+		s_axi_param_awprot	=> (others => '0'),
+		s_axi_param_awvalid	=> '0',
+		s_axi_param_awready	=> open,
+		s_axi_param_wdata	=> (others => '0'),
+		s_axi_param_wstrb	=> (others => '1'),
+		s_axi_param_wlast	=> '0',
+		s_axi_param_wvalid	=> '0',
+		s_axi_param_wready	=> open,
+		s_axi_param_bid	=> open,
+		s_axi_param_bresp	=> open,
+		s_axi_param_bvalid	=> open,
+		s_axi_param_bready	=> '0',
+		s_axi_param_arid	=> (others => '0'),
+		s_axi_param_araddr	=> (others => '0'),
+		s_axi_param_arlen	=> (others => '0'),
+		s_axi_param_arsize	=> (others => '0'),
+		s_axi_param_arburst	=> (others => '0'),
+		s_axi_param_arlock	=> '0',
+		s_axi_param_arcache	=> (others => '0'),
+		s_axi_param_arprot	=> (others => '0'),
+		s_axi_param_arvalid	=> '0',
+		s_axi_param_arready	=> open,
+		s_axi_param_rid	=> open,
+		s_axi_param_rdata	=> open,
+		s_axi_param_rresp	=> open,
+		s_axi_param_rlast	=> open,
+		s_axi_param_rvalid	=> open,
+		s_axi_param_rready	=> '0',
+
 		-- Ports of Axi Master Bus Interface M_AXIS_OUTPUT
 		m_axis_output_aclk	    => axi_aclk,
 		m_axis_output_aresetn	=> axi_aresetn,
@@ -293,6 +376,29 @@ begin
 		-- User ports ends
 		-- Do not modify the ports beyond this line
 
+		-- Ports of Axi Slave Bus Interface S_AXI_CTRL, mono mix
+		s_axi_ctrl_aclk	    => axi_aclk,
+		s_axi_ctrl_aresetn	=> axi_aresetn,
+		s_axi_ctrl_awaddr	=> (others => '0'),
+		s_axi_ctrl_awprot	=> (others => '0'),
+		s_axi_ctrl_awvalid	=> '0',
+		s_axi_ctrl_awready	=> open,
+		s_axi_ctrl_wdata	=> (others => '0'),
+		s_axi_ctrl_wstrb	=> (others => '0'),
+		s_axi_ctrl_wvalid	=> '0',
+		s_axi_ctrl_wready	=> open,
+		s_axi_ctrl_bresp	=> open,
+		s_axi_ctrl_bvalid	=> open,
+		s_axi_ctrl_bready	=> '0',
+		s_axi_ctrl_araddr	=> (others => '0'),
+		s_axi_ctrl_arprot	=> (others => '0'),
+		s_axi_ctrl_arvalid	=> '0',
+		s_axi_ctrl_arready	=> open,
+		s_axi_ctrl_rdata	=> open,
+		s_axi_ctrl_rresp	=> open,
+		s_axi_ctrl_rvalid	=> open,
+		s_axi_ctrl_rready	=> '0',
+
 
 		-- Ports of Axi Slave Bus Interface S_AXIS_INPUT
 		s_axis_input_aclk	 => axi_aclk,
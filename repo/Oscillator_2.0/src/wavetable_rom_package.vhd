@@ -0,0 +1,5164 @@
+-- Package: Wavetable ROM
+-- Description: Bandlimited sawtooth and triangle wavetables of the oscillator, one per
+-- octave, the initial values of the wavetable brams. Generated by synth_generate
+-- (model/src/wavetable_generator.h) with --harmonics 1000 --length 2048 --width 24
+-- --octaves 10 --headroom 1, do not edit.
+
+library ieee;
+use ieee.std_logic_1164.all;
+
+package wavetable_rom_package is
+    constant c_ROM_NUM_OCTAVES : integer := 10;
+    constant c_ROM_ADDR_WIDTH  : integer := 11;
+    constant c_ROM_DATA_WIDTH  : integer := 24;
+
+    type t_rom is array(0 to 2**c_ROM_ADDR_WIDTH-1) of std_logic_vector(c_ROM_DATA_WIDTH-1 downto 0);
+    type t_rom_array is array(0 to c_ROM_NUM_OCTAVES-1) of t_rom;
+
+    constant c_SAWTOOTH_ROM : t_rom_array := (
+        -- octave 0
+        (x"000000", x"C00001", x"CEF9E7", x"C64B74", x"CC76C7", x"C7DE97", x"CB9E5F", x"C8A655",
+         x"CB3796", x"C927D4", x"CAFF75", x"C9889D", x"CADF44", x"C9D743", x"CACD3D", x"CA1A8E",
+         x"CAC484", x"CA5611", x"CAC26D", x"CA8BD5", x"CAC563", x"CABD19", x"CACC67", x"CAEAAA",
+         x"CAD6D2", x"CB1514", x"CAE430", x"CB3CBA", x"CAF42A", x"CB61E5", x"CB0680", x"CB84D1",
+         x"CB1AFC", x"CBA5AF", x"CB316F", x"CBC4AA", x"CB49B0", x"CBE1EB", x"CB6398", x"CBFD9A",
+         x"CB7EFF", x"CC17DB", x"CB9BC1", x"CC30D5", x"CBB9B7", x"CC48AE", x"CBD8BB", x"CC5F8C",
+         x"CBF8A6", x"CC7596", x"CC1951", x"CC8AF3", x"CC3A97", x"CC9FC9", x"CC5C52", x"CCB43D",
+         x"CC7E5B", x"CCC874", x"CCA090", x"CCDC92", x"CCC2CD", x"CCF0B8", x"CCE4F1", x"CD0506",
+         x"CD06DF", x"CD1998", x"CD287A", x"CD2E8B", x"CD49A9", x"CD43F5", x"CD6A57", x"CD59EA",
+         x"CD8A6F", x"CD707D", x"CDA9E4", x"CD87B9", x"CDC8A9", x"CD9FAA", x"CDE6B6", x"CDB856",
+         x"CE0406", x"CDD1BF", x"CE2098", x"CDEBE5", x"CE3C6F", x"CE06C5", x"CE5791", x"CE2256",
+         x"CE7204", x"CE3E8F", x"CE8BD6", x"CE5B64", x"CEA513", x"CE78C6", x"CEBDCC", x"CE96A3",
+         x"CED613", x"CEB4EA", x"CEEDF9", x"CED386", x"CF0595", x"CEF263", x"CF1CF9", x"CF116C",
+         x"CF343D", x"CF308D", x"CF4B73", x"CF4FAF", x"CF62B1", x"CF6EC0", x"CF7A0B", x"CF8DAD",
+         x"CF9192", x"CFAC63", x"CFA957", x"CFCAD3", x"CFC16A", x"CFE8EF", x"CFD9D8", x"D006AB",
+         x"CFF2AB", x"D023FC", x"D00BEC", x"D040DC", x"D025A2", x"D05D45", x"D03FD0", x"D07935",
+         x"D05A77", x"D094AC", x"D07597", x"D0AFAC", x"D0912C", x"D0CA39", x"D0AD30", x"D0E45A",
+         x"D0C99D", x"D0FE17", x"D0E668", x"D1177B", x"D10386", x"D13092", x"D120ED", x"D14968",
+         x"D13E8D", x"D1620A", x"D15C59", x"D17A89", x"D17A42", x"D192F1", x"D19839", x"D1AB52",
+         x"D1B631", x"D1C3BB", x"D1D419", x"D1DC3A", x"D1F1E5", x"D1F4DC", x"D20F88", x"D20DAD",
+         x"D22CF6", x"D226B8", x"D24A25", x"D24007", x"D2670B", x"D259A2", x"D283A2", x"D2738F",
+         x"D29FE5", x"D28DD2", x"D2BBCF", x"D2A870", x"D2D75F", x"D2C368", x"D2F295", x"D2DEB9",
+         x"D30D73", x"D2FA61", x"D327FB", x"D3165B", x"D34235", x"D332A2", x"D35C25", x"D34F2E",
+         x"D375D5", x"D36BF6", x"D38F4C", x"D388F1", x"D3A896", x"D3A615", x"D3C1BD", x"D3C356",
+         x"D3DACC", x"D3E0A9", x"D3F3CF", x"D3FE02", x"D40CD1", x"D41B57", x"D425DD", x"D4389C",
+         x"D43EFF", x"D455C6", x"D45841", x"D472CC", x"D471AB", x"D48FA4", x"D48B47", x"D4AC47",
+         x"D4A51C", x"D4C8AE", x"D4BF2F", x"D4E4D4", x"D4D986", x"D500B6", x"D4F423", x"D51C4F",
+         x"D50F08", x"D537A1", x"D52A35", x"D552AA", x"D545A9", x"D56D6E", x"D56162", x"D587EF",
+         x"D57D5B", x"D5A233", x"D5998E", x"D5BC3E", x"D5B5F7", x"D5D619", x"D5D28D", x"D5EFCA",
+         x"D5EF48", x"D6095A", x"D60C20", x"D622D2", x"D6290B", x"D63C3B", x"D64600", x"D6559F",
+         x"D662F5", x"D66F08", x"D67FE2", x"D6887E", x"D69CBC", x"D6A20A", x"D6B97D", x"D6BBB4",
+         x"D6D61B", x"D6D585", x"D6F290", x"D6EF81", x"D70ED5", x"D709B0", x"D72AE7", x"D72415",
+         x"D746C0", x"D73EB4", x"D7625E", x"D7598E", x"D77DC0", x"D774A5", x"D798E5", x"D78FF8",
+         x"D7B3CF", x"D7AB86", x"D7CE7F", x"D7C74C", x"D7E8FA", x"D7E345", x"D80343", x"D7FF6D",
+         x"D81D60", x"D81BBF", x"D83757", x"D83833", x"D8512F", x"D854C2", x"D86AEF", x"D87165",
+         x"D884A0", x"D88E14", x"D89E48", x"D8AAC7", x"D8B7F1", x"D8C776", x"D8D1A2", x"D8E418",
+         x"D8EB63", x"D900A7", x"D9053C", x"D91D1B", x"D91F32", x"D9396F", x"D9394B", x"D9559C",
+         x"D9538E", x"D9719D", x"D96DFF", x"D98D6F", x"D9889F", x"D9A910", x"D9A373", x"D9C47D",
+         x"D9BE7B", x"D9DFB5", x"D9D9B8", x"D9FAB9", x"D9F527", x"DA158B", x"DA10C8", x"DA302D",
+         x"DA2C98", x"DA4AA3", x"DA4892", x"DA64F0", x"DA64B2", x"DA7F1A", x"DA80F2", x"DA9926",
+         x"DA9D4C", x"DAB31B", x"DAB9BB", x"DACD00", x"DAD636", x"DAE6DB", x"DAF2B8", x"DB00B4",
+         x"DB0F39", x"DB1A91", x"DB2BB1", x"DB3479", x"DB481B", x"DB4E74", x"DB6470", x"DB6886",
+         x"DB80AA", x"DB82B6", x"DB9CC4", x"DB9D08", x"DBB8B9", x"DBB781", x"DBD486", x"DBD224",
+         x"DBF028", x"DBECF4", x"DC0B9D", x"DC07F1", x"DC26E3", x"DC231C", x"DC41FB", x"DC3E75",
+         x"DC5CE6", x"DC59FB", x"DC77A6", x"DC75AB", x"DC923D", x"DC9182", x"DCACAE", x"DCAD7C",
+         x"DCC6FF", x"DCC995", x"DCE133", x"DCE5C7", x"DCFB51", x"DD020D", x"DD155D", x"DD1E61",
+         x"DD2F5F", x"DD3ABD", x"DD495D", x"DD571A", x"DD635C", x"DD7372", x"DD7D63", x"DD8FC0",
+         x"DD9778", x"DDABFC", x"DDB1A0", x"DDC822", x"DDCBE2", x"DDE42E", x"DDE640", x"DE0019",
+         x"DE00C0", x"DE1BE2", x"DE1B65", x"DE3785", x"DE3631", x"DE52FF", x"DE5125", x"DE6E50",
+         x"DE6C43", x"DE8978", x"DE878B", x"DEA477", x"DEA2FB", x"DEBF4D", x"DEBE92", x"DED9FE",
+         x"DEDA4E", x"DEF48D", x"DEF62A", x"DF0EFC", x"DF1224", x"DF2950", x"DF2E36", x"DF438D",
+         x"DF4A5C", x"DF5DBA", x"DF6691", x"DF77DA", x"DF82CF", x"DF91F5", x"DF9F10", x"DFAC0F",
+         x"DFBB4E", x"DFC62E", x"DFD785", x"DFE058", x"DFF3AE", x"DFFA93", x"E00FC4", x"E014E2",
+         x"E02BC4", x"E02F4A", x"E047A8", x"E049D0", x"E0636D", x"E06476", x"E07F10", x"E07F3F",
+         x"E09A90", x"E09A2C", x"E0B5EA", x"E0B540", x"E0D11E", x"E0D079", x"E0EC2D", x"E0EBD8",
+         x"E10716", x"E1075B", x"E121DC", x"E12300", x"E13C82", x"E13EC4", x"E1570A", x"E15AA5",
+         x"E17177", x"E1769D", x"E18BCF", x"E192AA", x"E1A615", x"E1AEC5", x"E1C04F", x"E1CAEA",
+         x"E1DA81", x"E1E714", x"E1F4B1", x"E2033E", x"E20EE4", x"E21F62", x"E22920", x"E23B7B",
+         x"E24368", x"E25785", x"E25DC2", x"E2737B", x"E27833", x"E28F58", x"E292BD", x"E2AB1B",
+         x"E2AD64", x"E2C6BF", x"E2C82A", x"E2E243", x"E2E312", x"E2FDA4", x"E2FE1C", x"E318E3",
+         x"E3194A", x"E333FE", x"E3349A", x"E34EF7", x"E3500D", x"E369CF", x"E36B9F", x"E38488",
+         x"E38750", x"E39F24", x"E3A31B", x"E3B9A7", x"E3BEFE", x"E3D414", x"E3DAF5", x"E3EE70",
+         x"E3F6FB", x"E408BE", x"E4130C", x"E42304", x"E42F23", x"E43D47", x"E44B3B", x"E4578A",
+         x"E46750", x"E471D4", x"E4835C", x"E48C28", x"E49F5B", x"E4A68C", x"E4BB49", x"E4C103",
+         x"E4D722", x"E4DB90", x"E4F2E2", x"E4F638", x"E50E87", x"E510FC", x"E52A0F", x"E52BDF",
+         x"E54577", x"E546E2", x"E560BE", x"E56205", x"E57BE5", x"E57D49", x"E596EB", x"E598AD",
+         x"E5B1D2", x"E5B430", x"E5CC9B", x"E5CFD0", x"E5E749", x"E5EB89", x"E601DE", x"E6075A",
+         x"E61C5D", x"E6233F", x"E636CB", x"E63F33", x"E6512B", x"E65B33", x"E66B82", x"E6773A",
+         x"E685D3", x"E69343", x"E6A025", x"E6AF4B", x"E6BA7A", x"E6CB4C", x"E6D4D9", x"E6E743",
+         x"E6EF44", x"E7032A", x"E709C0", x"E71EFF", x"E72450", x"E73ABE", x"E73EF8", x"E75664",
+         x"E759BA", x"E771EE", x"E77498", x"E78D5C", x"E78F94", x"E7A8AB", x"E7AAAF", x"E7C3DC",
+         x"E7C5E8", x"E7DEEE", x"E7E140", x"E7F9E2", x"E7FCB5", x"E814B9", x"E81846", x"E82F76",
+         x"E833F1", x"E84A1A", x"E84FB2", x"E864A9", x"E86B87", x"E87F26", x"E8876C", x"E89995",
+         x"E8A35D", x"E8B3FA", x"E8BF56", x"E8CE59", x"E8DB53", x"E8E8B6", x"E8F750", x"E90316",
+         x"E91348", x"E91D7C", x"E92F37", x"E937EE", x"E94B19", x"E9526E", x"E966EB", x"E96D01",
+         x"E982A8", x"E987A9", x"E99E4F", x"E9A269", x"E9B9DD", x"E9BD43", x"E9D550", x"E9D839",
+         x"E9F0A6", x"E9F34C", x"EA0BDF", x"EA0E7C", x"EA26FC", x"EA29C8", x"EA41FB", x"EA4532",
+         x"EA5CDF", x"EA60B6", x"EA77A8", x"EA7C53", x"EA925A", x"EA9806", x"EAACF7", x"EAB3CE",
+         x"EAC782", x"EACFA5", x"EAE1FE", x"EAEB8A", x"EAFC6F", x"EB0777", x"EB16D9", x"EB236A",
+         x"EB3141", x"EB3F5D", x"EB4BA9", x"EB5B4D", x"EB6617", x"EB7736", x"EB808E", x"EB9313",
+         x"EB9B12", x"EBAEE2", x"EBB5A6", x"EBCA9F", x"EBD04D", x"EBE647", x"EBEB0B", x"EC01D8",
+         x"EC05E1", x"EC1D50", x"EC20D2", x"EC38AC", x"EC3BDD", x"EC53EE", x"EC5705", x"EC6F13",
+         x"EC7248", x"EC8A1C", x"EC8DA6", x"ECA50B", x"ECA91F", x"ECBFE1", x"ECC4B0", x"ECDA9F",
+         x"ECE058", x"ECF548", x"ECFC13", x"ED0FDE", x"ED17DF", x"ED2A66", x"ED33B8", x"ED44E2",
+         x"ED4F9B", x"ED5F56", x"ED6B84", x"ED79C6", x"ED876F", x"ED9436", x"EDA359", x"EDAEA9",
+         x"EDBF3C", x"EDC925", x"EDDB16", x"EDE3AC", x"EDF6E3", x"EDFE41", x"EE12A0", x"EE18E8",
+         x"EE2E49", x"EE33A4", x"EE49DD", x"EE4E76", x"EE6559", x"EE6961", x"EE80BC", x"EE8466",
+         x"EE9C04", x"EE9F86", x"EEB732", x"EEBAC0", x"EED245", x"EED615", x"EEED3E", x"EEF183",
+         x"EF081E", x"EF0D0A", x"EF22E7", x"EF28A6", x"EF3D9A", x"EF4457", x"EF583B", x"EF6018",
+         x"EF72CD", x"EF7BE8", x"EF8D53", x"EF97C2", x"EFA7CF", x"EFB3A3", x"EFC247", x"EFCF87",
+         x"EFDCBD", x"EFEB6A", x"EFF736", x"F00749", x"F011B5", x"F02320", x"F02C3E", x"F03EEC",
+         x"F046D4", x"F05AA8", x"F0617B", x"F07653", x"F07C34", x"F091EA", x"F09703", x"F0AD6B",
+         x"F0B1E9", x"F0C8D3", x"F0CCE8", x"F0E422", x"F0E800", x"F0FF58", x"F10332", x"F11A73",
+         x"F11E7E", x"F13575", x"F139E3", x"F1505F", x"F1555F", x"F16B31", x"F170F2", x"F185EF",
+         x"F18C99", x"F1A09A", x"F1A851", x"F1BB34", x"F1C418", x"F1D5C2", x"F1DFEA", x"F1F047",
+         x"F1FBC3", x"F20AC5", x"F217A1", x"F22541", x"F23380", x"F23FBE", x"F24F5B", x"F25A40",
+         x"F26B30", x"F274CB", x"F286FA", x"F28F61", x"F2A2B7", x"F2AA07", x"F2BE64", x"F2C4BE",
+         x"F2D9FE", x"F2DF89", x"F2F583", x"F2FA6A", x"F310F0", x"F31563", x"F32C46", x"F33074",
+         x"F34783", x"F34B9F", x"F362A6", x"F366E2", x"F37DB1", x"F3823E", x"F398A3", x"F39DB2",
+         x"F3B37F", x"F3B93C", x"F3CE45", x"F3D4DA", x"F3E8F9", x"F3F08A", x"F4039C", x"F40C48",
+         x"F41E31", x"F42813", x"F438BC", x"F443E6", x"F45341", x"F45FBF", x"F46DC2", x"F47B99",
+         x"F48843", x"F49771", x"F4A2C7", x"F4B344", x"F4BD53", x"F4CF0E", x"F4D7E9", x"F4EACC",
+         x"F4F28D", x"F5067A", x"F50D42", x"F52217", x"F52809", x"F53DA0", x"F542E6", x"F55913",
+         x"F55DD9", x"F5746F", x"F578E3", x"F58FB3", x"F59406", x"F5AADE", x"F5AF42", x"F5C5F1",
+         x"F5CA96", x"F5E0EB", x"F5E602", x"F5FBCF", x"F60183", x"F6169E", x"F61D19", x"F63159",
+         x"F638C1", x"F64C04", x"F65479", x"F666A0", x"F6703D", x"F68131", x"F68C0A", x"F69BBB",
+         x"F6A7DE", x"F6B640", x"F6C3B5", x"F6D0C4", x"F6DF8A", x"F6EB4B", x"F6FB5C", x"F705D7",
+         x"F71725", x"F7206D", x"F732E4", x"F73B10", x"F74E95", x"F755C1", x"F76A35", x"F77085",
+         x"F785C2", x"F78B5D", x"F7A13B", x"F7A64A", x"F7BC9D", x"F7C14E", x"F7D7E7", x"F7DC6A",
+         x"F7F31A", x"F7F79F", x"F80E34", x"F812EB", x"F82936", x"F82E4F", x"F84422", x"F849C8",
+         x"F85EF8", x"F86557", x"F879BB", x"F880F8", x"F8946C", x"F89CA8", x"F8AF0F", x"F8B867",
+         x"F8C9A6", x"F8D42F", x"F8E434", x"F8EFFF", x"F8FEBD", x"F90BD2", x"F91943", x"F927A6",
+         x"F933CC", x"F94376", x"F94E59", x"F95F40", x"F968EE", x"F97B00", x"F9838E", x"F996B3",
+         x"F99E3D", x"F9B257", x"F9B8FD", x"F9CDE9", x"F9D3CF", x"F9E966", x"F9EEB7", x"FA04CE",
+         x"FA09B5", x"FA201F", x"FA24CA", x"FA3B59", x"FA3FF8", x"FA567A", x"FA5B3D", x"FA7184",
+         x"FA7699", x"FA8C77", x"FA920B", x"FAA755", x"FAAD92", x"FAC21E", x"FAC92D", x"FADCD6",
+         x"FAE4D7", x"FAF77F", x"FB0090", x"FB121A", x"FB1C54", x"FB2CAD", x"FB3820", x"FB4738",
+         x"FB53F1", x"FB61C1", x"FB6FC3", x"FB7C4A", x"FB8B93", x"FB96D7", x"FBA75D", x"FBB16C",
+         x"FBC31F", x"FBCC0A", x"FBDED5", x"FBE6B6", x"FBFA7C", x"FC0171", x"FC1613", x"FC1C3F",
+         x"FC3195", x"FC3721", x"FC4D03", x"FC5219", x"FC685B", x"FC6D27", x"FC839B", x"FC884D",
+         x"FC9EC4", x"FCA38B", x"FCB9D5", x"FCBEE0", x"FCD4CF", x"FCDA4B", x"FCEFB4", x"FCF5CC",
+         x"FD0A84", x"FD1160", x"FD2541", x"FD2D05", x"FD3FEF", x"FD48B9", x"FD5A8F", x"FD6479",
+         x"FD7525", x"FD8042", x"FD8FB4", x"FD9C10", x"FDAA3E", x"FDB7E1", x"FDC4C8", x"FDD3B1",
+         x"FDDF55", x"FDEF7C", x"FDF9E7", x"FE0B40", x"FE1483", x"FE26F9", x"FE2F2B", x"FE42A4",
+         x"FE49E3", x"FE5E3F", x"FE64AB", x"FE79C8", x"FE7F87", x"FE953C", x"FE9A79", x"FEB09A",
+         x"FEB581", x"FECBE1", x"FED0A0", x"FEE710", x"FEEBD7", x"FF0229", x"FF0725", x"FF1D2A",
+         x"FF2289", x"FF3815", x"FF3E03", x"FF52EB", x"FF5991", x"FF6DAE", x"FF7531", x"FF8861",
+         x"FF90E1", x"FFA305", x"FFAC9D", x"FFBD9F", x"FFC863", x"FFD82F", x"FFE430", x"FFF2BB",
+         x"000000", x"000D45", x"001BD0", x"0027D1", x"00379D", x"004261", x"005363", x"005CFB",
+         x"006F1F", x"00779F", x"008ACF", x"009252", x"00A66F", x"00AD15", x"00C1FD", x"00C7EB",
+         x"00DD77", x"00E2D6", x"00F8DB", x"00FDD7", x"011429", x"0118F0", x"012F60", x"01341F",
+         x"014A7F", x"014F66", x"016587", x"016AC4", x"018079", x"018638", x"019B55", x"01A1C1",
+         x"01B61D", x"01BD5C", x"01D0D5", x"01D907", x"01EB7D", x"01F4C0", x"020619", x"021084",
+         x"0220AB", x"022C4F", x"023B38", x"02481F", x"0255C2", x"0263F0", x"02704C", x"027FBE",
+         x"028ADB", x"029B87", x"02A571", x"02B747", x"02C011", x"02D2FB", x"02DABF", x"02EEA0",
+         x"02F57C", x"030A34", x"03104C", x"0325B5", x"032B31", x"034120", x"03462B", x"035C75",
+         x"03613C", x"0377B3", x"037C65", x"0392D9", x"0397A5", x"03ADE7", x"03B2FD", x"03C8DF",
+         x"03CE6B", x"03E3C1", x"03E9ED", x"03FE8F", x"040584", x"04194A", x"04212B", x"0433F6",
+         x"043CE1", x"044E94", x"0458A3", x"046929", x"04746D", x"0483B6", x"04903D", x"049E3F",
+         x"04AC0F", x"04B8C8", x"04C7E0", x"04D353", x"04E3AC", x"04EDE6", x"04FF70", x"050881",
+         x"051B29", x"05232A", x"0536D3", x"053DE2", x"05526E", x"0558AB", x"056DF5", x"057389",
+         x"058967", x"058E7C", x"05A4C3", x"05A986", x"05C008", x"05C4A7", x"05DB36", x"05DFE1",
+         x"05F64B", x"05FB32", x"061149", x"06169A", x"062C31", x"063217", x"064703", x"064DA9",
+         x"0661C3", x"06694D", x"067C72", x"068500", x"069712", x"06A0C0", x"06B1A7", x"06BC8A",
+         x"06CC34", x"06D85A", x"06E6BD", x"06F42E", x"070143", x"071001", x"071BCC", x"072BD1",
+         x"07365A", x"074799", x"0750F1", x"076358", x"076B94", x"077F08", x"078645", x"079AA9",
+         x"07A108", x"07B638", x"07BBDE", x"07D1B1", x"07D6CA", x"07ED15", x"07F1CC", x"080861",
+         x"080CE6", x"082396", x"082819", x"083EB2", x"084363", x"0859B6", x"085EC5", x"0874A3",
+         x"087A3E", x"088F7B", x"0895CB", x"08AA3F", x"08B16B", x"08C4F0", x"08CD1C", x"08DF93",
+         x"08E8DB", x"08FA29", x"0904A4", x"0914B5", x"092076", x"092F3C", x"093C4B", x"0949C0",
+         x"095822", x"096445", x"0973F6", x"097ECF", x"098FC3", x"099960", x"09AB87", x"09B3FC",
+         x"09C73F", x"09CEA7", x"09E2E7", x"09E962", x"09FE7D", x"0A0431", x"0A19FE", x"0A1F15",
+         x"0A356A", x"0A3A0F", x"0A50BE", x"0A5522", x"0A6BFA", x"0A704D", x"0A871D", x"0A8B91",
+         x"0AA227", x"0AA6ED", x"0ABD1A", x"0AC260", x"0AD7F7", x"0ADDE9", x"0AF2BE", x"0AF986",
+         x"0B0D73", x"0B1534", x"0B2817", x"0B30F2", x"0B42AD", x"0B4CBC", x"0B5D39", x"0B688F",
+         x"0B77BD", x"0B8467", x"0B923E", x"0BA041", x"0BACBF", x"0BBC1A", x"0BC744", x"0BD7ED",
+         x"0BE1CF", x"0BF3B8", x"0BFC64", x"0C0F76", x"0C1707", x"0C2B26", x"0C31BB", x"0C46C4",
+         x"0C4C81", x"0C624E", x"0C675D", x"0C7DC2", x"0C824F", x"0C991E", x"0C9D5A", x"0CB461",
+         x"0CB87D", x"0CCF8C", x"0CD3BA", x"0CEA9D", x"0CEF10", x"0D0596", x"0D0A7D", x"0D2077",
+         x"0D2602", x"0D3B42", x"0D419C", x"0D55F9", x"0D5D49", x"0D709F", x"0D7906", x"0D8B35",
+         x"0D94D0", x"0DA5C0", x"0DB0A5", x"0DC042", x"0DCC80", x"0DDABF", x"0DE85F", x"0DF53B",
+         x"0E043D", x"0E0FB9", x"0E2016", x"0E2A3E", x"0E3BE8", x"0E44CC", x"0E57AF", x"0E5F66",
+         x"0E7367", x"0E7A11", x"0E8F0E", x"0E94CF", x"0EAAA1", x"0EAFA1", x"0EC61D", x"0ECA8B",
+         x"0EE182", x"0EE58D", x"0EFCCE", x"0F00A8", x"0F1800", x"0F1BDE", x"0F3318", x"0F372D",
+         x"0F4E17", x"0F5295", x"0F68FD", x"0F6E16", x"0F83CC", x"0F89AD", x"0F9E85", x"0FA558",
+         x"0FB92C", x"0FC114", x"0FD3C2", x"0FDCE0", x"0FEE4B", x"0FF8B7", x"1008CA", x"101496",
+         x"102343", x"103079", x"103DB9", x"104C5D", x"105831", x"10683E", x"1072AD", x"108418",
+         x"108D33", x"109FE8", x"10A7C5", x"10BBA9", x"10C266", x"10D75A", x"10DD19", x"10F2F6",
+         x"10F7E2", x"110E7D", x"1112C2", x"1129EB", x"112DBB", x"114540", x"1148CE", x"11607A",
+         x"1163FC", x"117B9A", x"117F44", x"11969F", x"119AA7", x"11B18A", x"11B623", x"11CC5C",
+         x"11D1B7", x"11E718", x"11ED60", x"1201BF", x"12091D", x"121C54", x"1224EA", x"1236DB",
+         x"1240C4", x"125157", x"125CA7", x"126BCA", x"127891", x"12863A", x"12947C", x"12A0AA",
+         x"12B065", x"12BB1E", x"12CC48", x"12D59A", x"12E821", x"12F022", x"1303ED", x"130AB8",
+         x"131FA8", x"132561", x"133B50", x"13401F", x"1356E1", x"135AF5", x"13725A", x"1375E4",
+         x"138DB8", x"1390ED", x"13A8FB", x"13AC12", x"13C423", x"13C754", x"13DF2E", x"13E2B0",
+         x"13FA1F", x"13FE28", x"1414F5", x"1419B9", x"142FB3", x"143561", x"144A5A", x"14511E",
+         x"1464EE", x"146CED", x"147F72", x"1488CA", x"1499E9", x"14A4B3", x"14B457", x"14C0A3",
+         x"14CEBF", x"14DC96", x"14E927", x"14F889", x"150391", x"151476", x"151E02", x"15305B",
+         x"15387E", x"154C32", x"155309", x"1567FA", x"156DA6", x"1583AD", x"158858", x"159F4A",
+         x"15A321", x"15BACE", x"15BE05", x"15D638", x"15D904", x"15F184", x"15F421", x"160CB4",
+         x"160F5A", x"1627C7", x"162AB0", x"1642BD", x"164623", x"165D97", x"1661B1", x"167857",
+         x"167D58", x"1692FF", x"169915", x"16AD92", x"16B4E7", x"16C812", x"16D0C9", x"16E284",
+         x"16ECB8", x"16FCEA", x"1708B0", x"17174A", x"1724AD", x"1731A7", x"1740AA", x"174C06",
+         x"175CA3", x"17666B", x"177894", x"1780DA", x"179479", x"179B57", x"17B04E", x"17B5E6",
+         x"17CC0F", x"17D08A", x"17E7BA", x"17EB47", x"18034B", x"18061E", x"181EC0", x"182112",
+         x"183A18", x"183C24", x"185551", x"185755", x"18706C", x"1872A4", x"188B68", x"188E12",
+         x"18A646", x"18A99C", x"18C108", x"18C542", x"18DBB0", x"18E101", x"18F640", x"18FCD6",
+         x"1910BC", x"1918BD", x"192B27", x"1934B4", x"194586", x"1950B5", x"195FDB", x"196CBD",
+         x"197A2D", x"1988C6", x"19947E", x"19A4CD", x"19AED5", x"19C0CD", x"19C935", x"19DCC1",
+         x"19E3A3", x"19F8A6", x"19FE22", x"1A1477", x"1A18B7", x"1A3030", x"1A3365", x"1A4BD0",
+         x"1A4E2E", x"1A6753", x"1A6915", x"1A82B7", x"1A841B", x"1A9DFB", x"1A9F42", x"1AB91E",
+         x"1ABA89", x"1AD421", x"1AD5F1", x"1AEF04", x"1AF179", x"1B09C8", x"1B0D1E", x"1B2470",
+         x"1B28DE", x"1B3EFD", x"1B44B7", x"1B5974", x"1B60A5", x"1B73D8", x"1B7CA4", x"1B8E2C",
+         x"1B98B0", x"1BA876", x"1BB4C5", x"1BC2B9", x"1BD0DD", x"1BDCFC", x"1BECF4", x"1BF742",
+         x"1C0905", x"1C1190", x"1C250B", x"1C2BEC", x"1C4102", x"1C4659", x"1C5CE5", x"1C60DC",
+         x"1C78B0", x"1C7B78", x"1C9461", x"1C9631", x"1CAFF3", x"1CB109", x"1CCB66", x"1CCC02",
+         x"1CE6B6", x"1CE71D", x"1D01E4", x"1D025C", x"1D1CEE", x"1D1DBD", x"1D37D6", x"1D3941",
+         x"1D529C", x"1D54E5", x"1D6D43", x"1D70A8", x"1D87CD", x"1D8C85", x"1DA23E", x"1DA87B",
+         x"1DBC98", x"1DC485", x"1DD6E0", x"1DE09E", x"1DF11C", x"1DFCC2", x"1E0B4F", x"1E18EC",
+         x"1E257F", x"1E3516", x"1E3FB1", x"1E513B", x"1E59EB", x"1E6D56", x"1E7431", x"1E8963",
+         x"1E8E89", x"1EA55B", x"1EA8F6", x"1EC13C", x"1EC37E", x"1EDD00", x"1EDE24", x"1EF8A5",
+         x"1EF8EA", x"1F1428", x"1F13D3", x"1F2F87", x"1F2EE2", x"1F4AC0", x"1F4A16", x"1F65D4",
+         x"1F6570", x"1F80C1", x"1F80F0", x"1F9B8A", x"1F9C93", x"1FB630", x"1FB858", x"1FD0B6",
+         x"1FD43C", x"1FEB1E", x"1FF03C", x"20056D", x"200C52", x"201FA8", x"20287B", x"2039D2",
+         x"2044B2", x"2053F1", x"2060F0", x"206E0B", x"207D31", x"208826", x"20996F", x"20A246",
+         x"20B5A4", x"20BC73", x"20D1CA", x"20D6B0", x"20EDDC", x"20F104", x"2109D6", x"210B73",
+         x"2125B2", x"212602", x"21416E", x"2140B3", x"215D05", x"215B89", x"217875", x"217688",
+         x"2193BD", x"2191B0", x"21AEDB", x"21AD01", x"21C9CF", x"21C87B", x"21E49B", x"21E41E",
+         x"21FF40", x"21FFE7", x"2219C0", x"221BD2", x"22341E", x"2237DE", x"224E60", x"225404",
+         x"226888", x"227040", x"22829D", x"228C8E", x"229CA4", x"22A8E6", x"22B6A3", x"22C543",
+         x"22D0A1", x"22E19F", x"22EAA3", x"22FDF3", x"2304AF", x"231A39", x"231ECD", x"23366B",
+         x"233901", x"235284", x"235352", x"236E7E", x"236DC3", x"238A55", x"23885A", x"23A605",
+         x"23A31A", x"23C18B", x"23BE05", x"23DCE4", x"23D91D", x"23F80F", x"23F463", x"24130C",
+         x"240FD8", x"242DDC", x"242B7A", x"24487F", x"244747", x"2462F8", x"24633C", x"247D4A",
+         x"247F56", x"24977A", x"249B90", x"24B18C", x"24B7E5", x"24CB87", x"24D44F", x"24E56F",
+         x"24F0C7", x"24FF4C", x"250D48", x"251925", x"2529CA", x"253300", x"254645", x"254CE5",
+         x"2562B4", x"2566DA", x"257F0E", x"2580E6", x"259B4E", x"259B10", x"25B76E", x"25B55D",
+         x"25D368", x"25CFD3", x"25EF38", x"25EA75", x"260AD9", x"260547", x"262648", x"26204B",
+         x"264185", x"263B83", x"265C8D", x"2656F0", x"267761", x"267291", x"269201", x"268E63",
+         x"26AC72", x"26AA64", x"26C6B5", x"26C691", x"26E0CE", x"26E2E5", x"26FAC4", x"26FF59",
+         x"27149D", x"271BE8", x"272E5E", x"27388A", x"27480F", x"275539", x"2761B8", x"2771EC",
+         x"277B60", x"278E9B", x"279511", x"27AB3E", x"27AED1", x"27C7CD", x"27C8A9", x"27E441",
+         x"27E2A0", x"280093", x"27FCBD", x"281CBB", x"281706", x"2838B4", x"283181", x"28547A",
+         x"284C31", x"287008", x"28671B", x"288B5B", x"288240", x"28A672", x"289DA2", x"28C14C",
+         x"28B940", x"28DBEB", x"28D519", x"28F650", x"28F12B", x"29107F", x"290D70", x"292A7B",
+         x"2929E5", x"29444C", x"294683", x"295DF6", x"296344", x"297782", x"29801E", x"2990F8",
+         x"299D0B", x"29AA61", x"29BA00", x"29C3C5", x"29D6F5", x"29DD2E", x"29F3E0", x"29F6A6",
+         x"2A10B8", x"2A1036", x"2A2D73", x"2A29E7", x"2A4A09", x"2A43C2", x"2A6672", x"2A5DCD",
+         x"2A82A5", x"2A7811", x"2A9E9E", x"2A9292", x"2ABA57", x"2AAD56", x"2AD5CB", x"2AC85F",
+         x"2AF0F8", x"2AE3B1", x"2B0BDD", x"2AFF4A", x"2B267A", x"2B1B2C", x"2B40D1", x"2B3752",
+         x"2B5AE4", x"2B53B9", x"2B74B9", x"2B705C", x"2B8E55", x"2B8D34", x"2BA7BF", x"2BAA3A",
+         x"2BC101", x"2BC764", x"2BDA23", x"2BE4A9", x"2BF32F", x"2C01FE", x"2C0C31", x"2C1F57",
+         x"2C2534", x"2C3CAA", x"2C3E43", x"2C59EB", x"2C576A", x"2C770F", x"2C70B4", x"2C940A",
+         x"2C8A2B", x"2CB0D2", x"2CA3DB", x"2CCD5E", x"2CBDCB", x"2CE9A5", x"2CD805", x"2D059F",
+         x"2CF28D", x"2D2147", x"2D0D6B", x"2D3C98", x"2D28A1", x"2D5790", x"2D4431", x"2D722E",
+         x"2D601B", x"2D8C71", x"2D7C5E", x"2DA65E", x"2D98F5", x"2DBFF9", x"2DB5DB", x"2DD948",
+         x"2DD30A", x"2DF253", x"2DF078", x"2E0B24", x"2E0E1B", x"2E23C6", x"2E2BE7", x"2E3C45",
+         x"2E49CF", x"2E54AE", x"2E67C7", x"2E6D0F", x"2E85BE", x"2E8577", x"2EA3A7", x"2E9DF6",
+         x"2EC173", x"2EB698", x"2EDF13", x"2ECF6E", x"2EFC7A", x"2EE885", x"2F1998", x"2F01E9",
+         x"2F3663", x"2F1BA6", x"2F52D0", x"2F35C7", x"2F6ED4", x"2F5054", x"2F8A69", x"2F6B54",
+         x"2FA589", x"2F86CB", x"2FC030", x"2FA2BB", x"2FDA5E", x"2FBF24", x"2FF414", x"2FDC04",
+         x"300D55", x"2FF955", x"302628", x"301711", x"303E96", x"30352D", x"3056A9", x"30539D",
+         x"306E6E", x"307253", x"3085F5", x"309140", x"309D4F", x"30B051", x"30B48D", x"30CF73",
+         x"30CBC3", x"30EE94", x"30E307", x"310D9D", x"30FA6B", x"312C7A", x"311207", x"314B16",
+         x"3129ED", x"31695D", x"314234", x"31873A", x"315AED", x"31A49C", x"31742A", x"31C171",
+         x"318DFC", x"31DDAA", x"31A86F", x"31F93B", x"31C391", x"32141B", x"31DF68", x"322E41",
+         x"31FBFA", x"3247AA", x"32194A", x"326056", x"323757", x"327847", x"32561C", x"328F83",
+         x"327591", x"32A616", x"3295A9", x"32BC0B", x"32B657", x"32D175", x"32D786", x"32E668",
+         x"32F921", x"32FAFA", x"331B0F", x"330F48", x"333D33", x"33236E", x"335F70", x"33378C",
+         x"3381A5", x"334BC3", x"33A3AE", x"336037", x"33C569", x"33750D", x"33E6AF", x"338A6A",
+         x"34075A", x"33A074", x"342745", x"33B752", x"344649", x"33CF2B", x"34643F", x"33E825",
+         x"348101", x"340266", x"349C68", x"341E15", x"34B650", x"343B56", x"34CE91", x"345A51",
+         x"34E504", x"347B2F", x"34F980", x"349E1B", x"350BD6", x"34C346", x"351BD0", x"34EAEC",
+         x"35292E", x"351556", x"353399", x"3542E7", x"353A9D", x"35742B", x"353D93", x"35A9EF",
+         x"353B7C", x"35E572", x"3532C3", x"3628BD", x"3520BC", x"367763", x"35008B", x"36D82C",
+         x"34C86A", x"3759AB", x"3461A1", x"382169", x"338939", x"39B48C", x"310619", x"3FFFFF"),
+        -- octave 1
+        (x"000000", x"D15E7B", x"C00001", x"C7ACC6", x"CF0B90", x"CB2B26", x"C66753", x"C8EBD4",
+         x"CCA3BE", x"CB05AE", x"C81560", x"C94E3B", x"CBE6F4", x"CB2246", x"C8F7E6", x"C9963A",
+         x"CB9BD8", x"CB4B24", x"C9942A", x"C9D80A", x"CB7F61", x"CB7739", x"CA0FC0", x"CA183A",
+         x"CB7ACF", x"CBA406", x"CA793E", x"CA583A", x"CB8458", x"CBD0B2", x"CAD774", x"CA988E",
+         x"CB971D", x"CBFCEB", x"CB2DF3", x"CAD965", x"CBB06F", x"CC2899", x"CB7EC9", x"CB1AC9",
+         x"CBCEBA", x"CC53BE", x"CBCB35", x"CB5CAF", x"CBF0FC", x"CC7E68", x"CC1406", x"CB9F05",
+         x"CC168E", x"CCA8B0", x"CC59C5", x"CBE1B0", x"CC3EFC", x"CCD2B1", x"CC9CD7", x"CC2494",
+         x"CC69F1", x"CCFC88", x"CCDD83", x"CC6790", x"CC972C", x"CD2657", x"CD1C04", x"CCAA86",
+         x"CCC67A", x"CD503D", x"CD588A", x"CCED54", x"CCF7AF", x"CD7A59", x"CD933C", x"CD2FDD",
+         x"CD2AA3", x"CDA4CC", x"CDCC42", x"CD7200", x"CD5F31", x"CDCFB1", x"CE03C0", x"CDB3A2",
+         x"CD9536", x"CDFB25", x"CE39D8", x"CDF4A9", x"CDCC90", x"CE2741", x"CE6EAC", x"CE34FC",
+         x"CE051C", x"CE541C", x"CEA261", x"CE7486", x"CE3EB6", x"CE81C9", x"CED518", x"CEB335",
+         x"CE793C", x"CEB059", x"CF06F6", x"CEF0FB", x"CEB489", x"CEDFD8", x"CF381D", x"CF2DCB",
+         x"CEF07C", x"CF1051", x"CF68B1", x"CF699F", x"CF2CF1", x"CF41C9", x"CF98D4", x"CFA472",
+         x"CF69C5", x"CF7443", x"CFC8A9", x"CFDE43", x"CFA6D6", x"CFA7BE", x"CFF851", x"D01715",
+         x"CFE404", x"CFDC35", x"D027EC", x"D04EEE", x"D0212F", x"D011A1", x"D05799", x"D085D8",
+         x"D05E3B", x"D047F6", x"D08773", x"D0BBDE", x"D09B0B", x"D07F27", x"D0B796", x"D0F111",
+         x"D0D787", x"D0B724", x"D0E819", x"D12581", x"D11399", x"D0EFD9", x"D11910", x"D15943",
+         x"D14F2B", x"D12933", x"D14A8E", x"D18C6B", x"D18A2F", x"D1631B", x"D17CA3", x"D1BF10",
+         x"D1C496", x"D19D7A", x"D1AF5A", x"D1F14B", x"D1FE57", x"D1D836", x"D1E2BC", x"D22334",
+         x"D23769", x"D21339", x"D216CF", x"D254E3", x"D26FC9", x"D24E69", x"D24B94", x"D28672",
+         x"D2A776", x"D289AD", x"D2810B", x"D2B7F8", x"D2DE72", x"D2C4EF", x"D2B731", x"D2E98C",
+         x"D314C3", x"D30017", x"D2EDFF", x"D31B45", x"D34A71", x"D33B10", x"D3256B", x"D34D36",
+         x"D37F85", x"D375C7", x"D35D6A", x"D37F73", x"D3B40D", x"D3B02A", x"D395EF", x"D3B20C",
+         x"D3E817", x"D3EA29", x"D3CEEA", x"D3E50F", x"D41BB3", x"D423B8", x"D4084A", x"D41889",
+         x"D44EF3", x"D45CCB", x"D441FC", x"D44C82", x"D481EA", x"D4955B", x"D47BEF", x"D48101",
+         x"D4B4AA", x"D4CD63", x"D4B60F", x"D4B60B", x"D4E747", x"D504DF", x"D4F048", x"D4EBA1",
+         x"D519D5", x"D53BCF", x"D52A86", x"D521C2", x"D54C66", x"D57235", x"D564B8", x"D5586A",
+         x"D57F0D", x"D5A817", x"D59ECC", x"D58F94", x"D5B1DB", x"D5DD7B", x"D5D8B0", x"D5C737",
+         x"D5E4E0", x"D6126B", x"D61255", x"D5FF4A", x"D6182B", x"D646F0", x"D64BAE", x"D637C0",
+         x"D64BC8", x"D67B19", x"D684AF", x"D6708D", x"D67FC3", x"D6AEF1", x"D6BD4E", x"D6A9A3",
+         x"D6B424", x"D6E289", x"D6F583", x"D6E2F1", x"D6E8F2", x"D715F0", x"D72D48", x"D71C68",
+         x"D71E32", x"D74936", x"D7649B", x"D755F9", x"D753E5", x"D77C6B", x"D79B79", x"D78F92",
+         x"D78A0B", x"D7AF9F", x"D7D1E5", x"D7C924", x"D7C0A4", x"D7E2E2", x"D807E1", x"D8029F",
+         x"D7F7AA", x"D81643", x"D83D72", x"D83BF6", x"D82F17", x"D849CF", x"D872A0", x"D8751B",
+         x"D866E4", x"D87D94", x"D8A772", x"D8AE01", x"D89F07", x"D8B19D", x"D8DBF3", x"D8E69E",
+         x"D8D776", x"D8E5F4", x"D9102F", x"D91EEA", x"D91024", x"D91AA0", x"D94432", x"D956DC",
+         x"D94905", x"D94FA8", x"D97809", x"D98E6F", x"D9820B", x"D98511", x"D9ABC1", x"D9C5A1",
+         x"D9BB28", x"D9BADD", x"D9DF69", x"D9FC6F", x"D9F44F", x"D9F10C", x"DA130F", x"DA32DA",
+         x"DA2D71", x"DA279E", x"DA46C0", x"DA68E4", x"DA6681", x"DA5E8F", x"DA7A88", x"DA9E91",
+         x"DA9F73", x"DA95DA", x"DAAE76", x"DAD3E7", x"DAD83B", x"DACD78", x"DAE293", x"DB08ED",
+         x"DB10CE", x"DB0563", x"DB16EB", x"DB3DAC", x"DB4922", x"DB3D90", x"DB4B85", x"DB722D",
+         x"DB812F", x"DB75F6", x"DB806A", x"DBA67B", x"DBB8EE", x"DBAE89", x"DBB59F", x"DBDAA1",
+         x"DBF05B", x"DBE73E", x"DBEB28", x"DC0EAC", x"DC2772", x"DC2008", x"DC2109", x"DC42A8",
+         x"DC5E31", x"DC58DB", x"DC5741", x"DC76A0", x"DC9499", x"DC91AB", x"DC8DD0", x"DCAAA2",
+         x"DCCAAB", x"DCCA6C", x"DCC4B4", x"DCDEB8", x"DD006B", x"DD0313", x"DCFBE7", x"DD12EE",
+         x"DD35DD", x"DD3B95", x"DD3366", x"DD474E", x"DD6B07", x"DD73E8", x"DD6B28", x"DD7BE1",
+         x"DD9FF2", x"DDAC04", x"DDA326", x"DDB0B0", x"DDD4A5", x"DDE3E1", x"DDDB56", x"DDE5C1",
+         x"DE092B", x"DE1B78", x"DE13B0", x"DE1B19", x"DE3D8D", x"DE52C6", x"DE4C28", x"DE50BD",
+         x"DE71D5", x"DE89C8", x"DE84B3", x"DE86AF", x"DEA610", x"DEC07A", x"DEBD47", x"DEBCEF",
+         x"DEDA47", x"DEF6DE", x"DEF5D9", x"DEF37E", x"DF0E86", x"DF2CF5", x"DF2E5D", x"DF2A58",
+         x"DF42D8", x"DF62C1", x"DF66CA", x"DF617C", x"DF7746", x"DF9848", x"DF9F16", x"DF98E2",
+         x"DFABDA", x"DFCD8D", x"DFD738", x"DFD086", x"DFE09D", x"E00299", x"E00F27", x"E00860",
+         x"E01595", x"E03772", x"E046DE", x"E04069", x"E04AC8", x"E06C22", x"E07E56", x"E07896",
+         x"E0803D", x"E0A0B1", x"E0B58B", x"E0B0E0", x"E0B5F7", x"E0D529", x"E0EC7A", x"E0E93B",
+         x"E0EBF7", x"E10995", x"E12322", x"E1219E", x"E1223F", x"E13DFD", x"E15982", x"E159FF",
+         x"E158CE", x"E1726D", x"E18F9B", x"E19253", x"E18FA3", x"E1A6EE", x"E1C570", x"E1CA92",
+         x"E1C6BA", x"E1DB88", x"E1FB05", x"E202B3", x"E1FE0F", x"E21046", x"E2305F", x"E23AAD",
+         x"E2359C", x"E2452E", x"E26584", x"E27279", x"E26D5B", x"E27A47", x"E29A7B", x"E2AA11",
+         x"E2A544", x"E2AF97", x"E2CF4C", x"E2E16F", x"E2DD4F", x"E2E523", x"E303FE", x"E3188F",
+         x"E31574", x"E31AEE", x"E3389C", x"E34F6F", x"E34DA9", x"E350FB", x"E36D2E", x"E3860D",
+         x"E385E5", x"E3874A", x"E3A1BE", x"E3BC69", x"E3BE1E", x"E3BDDB", x"E3D655", x"E3F284",
+         x"E3F64D", x"E3F4AC", x"E40AFB", x"E42860", x"E42E67", x"E42BBA", x"E43FB9", x"E45E00",
+         x"E46665", x"E46301", x"E47498", x"E4936A", x"E49E3F", x"E49A7C", x"E4A99F", x"E4C8A2",
+         x"E4D5EE", x"E4D226", x"E4DED3", x"E4FDB0", x"E50D6C", x"E509F6", x"E5143B", x"E5329B",
+         x"E544B5", x"E541E6", x"E549DA", x"E5676A", x"E57BC4", x"E579ED", x"E57FB5", x"E59C26",
+         x"E5B297", x"E5B203", x"E5B5CC", x"E5D0D7", x"E5E92D", x"E5EA20", x"E5EC21", x"E60587",
+         x"E61F84", x"E6223A", x"E622B4", x"E63A3C", x"E6559F", x"E65A4A", x"E65982", x"E66F01",
+         x"E68B80", x"E69246", x"E6908A", x"E6A3DD", x"E6C129", x"E6CA27", x"E6C7C7", x"E6D8D8",
+         x"E6F69F", x"E701E7", x"E6FF34", x"E70DF8", x"E72BE7", x"E7397E", x"E736CD", x"E74343",
+         x"E76107", x"E770E7", x"E76E89", x"E778BE", x"E79607", x"E7A81D", x"E7A663", x"E7AE6E",
+         x"E7CAED", x"E7DF1E", x"E7DE53", x"E7E455", x"E7FFC1", x"E815E6", x"E81650", x"E81A76",
+         x"E8348C", x"E84C74", x"E84E53", x"E850D1", x"E86955", x"E882C7", x"E88653", x"E88766",
+         x"E89E24", x"E8B8E2", x"E8BE49", x"E8BE33", x"E8D303", x"E8EEC6", x"E8F62C", x"E8F535",
+         x"E907F7", x"E92475", x"E92DF6", x"E92C6A", x"E93D08", x"E959F4", x"E965A0", x"E963CD",
+         x"E9723D", x"E98F49", x"E99D23", x"E99B57", x"E9A79B", x"E9C478", x"E9D47A", x"E9D304",
+         x"E9DD27", x"E9F988", x"EA0BA1", x"EA0ACC", x"EA12E5", x"EA2E81", x"EA4295", x"EA42A9",
+         x"EA48D7", x"EA6369", x"EA7953", x"EA7A92", x"EA7F00", x"EA9848", x"EAAFDA", x"EAB280",
+         x"EAB561", x"EACD27", x"EAE62A", x"EAEA6B", x"EAEBF8", x"EB020C", x"EB1C44", x"EB224B",
+         x"EB22C4", x"EB36FF", x"EB522A", x"EB5A1A", x"EB59C3", x"EB6C07", x"EB87DE", x"EB91D0",
+         x"EB90F2", x"EBA12C", x"EBBD65", x"EBC967", x"EBC84C", x"EBD673", x"EBF2C3", x"EC00D9",
+         x"EBFFCC", x"EC0BE1", x"EC27FE", x"EC3821", x"EC376C", x"EC417B", x"EC5D1C", x"EC6F3B",
+         x"EC6F26", x"EC7745", x"EC9223", x"ECA624", x"ECA6F3", x"ECAD41", x"ECC71C", x"ECDCDA",
+         x"ECDECB", x"ECE371", x"ECFC0C", x"ED135B", x"ED16A7", x"ED19D7", x"ED30FC", x"ED49A7",
+         x"ED4E81", x"ED5070", x"ED65F3", x"ED7FBF", x"ED8650", x"ED873C", x"ED9AF7", x"EDB5A6",
+         x"EDBE0D", x"EDBE39", x"EDD011", x"EDEB5E", x"EDF5B3", x"EDF564", x"EE0545", x"EE20EA",
+         x"EE2D3A", x"EE2CB7", x"EE3A9B", x"EE5650", x"EE649E", x"EE642F", x"EE7017", x"EE8B94",
+         x"EE9BD9", x"EE9BC4", x"EEA5BD", x"EEC0BD", x"EED2E7", x"EED373", x"EEDB92", x"EEF5D1",
+         x"EF09C7", x"EF0B33", x"EF1196", x"EF2AD6", x"EF4075", x"EF42FD", x"EF47CD", x"EF5FD5",
+         x"EF76F0", x"EF7ACC", x"EF7E37", x"EF94D3", x"EFAD39", x"EFB296", x"EFB4D3", x"EFC9D8",
+         x"EFE350", x"EFEA57", x"EFEBA0", x"EFFEEC", x"F01937", x"F02206", x"F0229C", x"F03413",
+         x"F04EF1", x"F0599D", x"F059C3", x"F06955", x"F08481", x"F09117", x"F09111", x"F09EB8",
+         x"F0B9ED", x"F0C86F", x"F0C882", x"F0D43F", x"F0EF38", x"F0FF9F", x"F10010", x"F109F0",
+         x"F1246A", x"F136A4", x"F137B5", x"F13FCE", x"F15987", x"F16D7B", x"F16F6B", x"F175DA",
+         x"F18E98", x"F1A422", x"F1A72A", x"F1AC17", x"F1C3A1", x"F1DA98", x"F1DEED", x"F1E286",
+         x"F1F8AC", x"F210DD", x"F216AC", x"F21925", x"F22DBD", x"F246F2", x"F24E60", x"F24FF3",
+         x"F262DC", x"F27CD9", x"F28603", x"F286EE", x"F29810", x"F2B294", x"F2BD8F", x"F2BE13",
+         x"F2CD5D", x"F2E827", x"F2F4FE", x"F2F55E", x"F302CB", x"F31D97", x"F32C4B", x"F32CCA",
+         x"F3385C", x"F352E8", x"F36371", x"F36451", x"F36E16", x"F38820", x"F39A6E", x"F39BEF",
+         x"F3A3FC", x"F3BD45", x"F3D13D", x"F3D39D", x"F3DA0F", x"F3F25E", x"F407DE", x"F40B54",
+         x"F41052", x"F42771", x"F43E4F", x"F4430D", x"F446C5", x"F45C85", x"F47490", x"F47AC2",
+         x"F47D66", x"F491A0", x"F4AAA3", x"F4B26C", x"F4B436", x"F4C6C9", x"F4E089", x"F4EA05",
+         x"F4EB31", x"F4FC07", x"F51645", x"F52187", x"F52255", x"F5315E", x"F54BDA", x"F558ED",
+         x"F5599E", x"F566D4", x"F5814C", x"F59031", x"F59107", x"F59C6F", x"F5B6A1", x"F5C74F",
+         x"F5C88A", x"F5D231", x"F5EBDE", x"F5FE44", x"F60022", x"F6081D", x"F62109", x"F6350C",
+         x"F637CA", x"F63E37", x"F65629", x"F66BA8", x"F66F7A", x"F6747F", x"F68B43", x"F6A214",
+         x"F6A72B", x"F6AAF6", x"F6C05E", x"F6D852", x"F6DED9", x"F6E19B", x"F6F581", x"F70E62",
+         x"F7167B", x"F7186C", x"F72AB3", x"F74446", x"F74E0C", x"F74F69", x"F75FF8", x"F77A01",
+         x"F78586", x"F7868D", x"F79558", x"F7AF97", x"F7BCE4", x"F7BDD4", x"F7CAD6", x"F7E50B",
+         x"F7F420", x"F7F53B", x"F80077", x"F81A63", x"F82B37", x"F82CBB", x"F83640", x"F84FA3",
+         x"F86225", x"F86450", x"F86C33", x"F884D3", x"F898E8", x"F89BF2", x"F8A253", x"F8B9F7",
+         x"F8CF7D", x"F8D39D", x"F8D8A0", x"F8EF16", x"F905E5", x"F90B49", x"F90F1A", x"F92437",
+         x"F93C1F", x"F942F1", x"F945C3", x"F95961", x"F9722D", x"F97A8D", x"F97C97", x"F98E98",
+         x"F9A80F", x"F9B217", x"F9B395", x"F9C3E5", x"F9DDC9", x"F9E98A", x"F9EABA", x"F9F94A",
+         x"FA135E", x"FA20E1", x"FA2201", x"FA2ECF", x"FA48D3", x"FA5817", x"FA5967", x"FA6477",
+         x"FA7E2B", x"FA8F28", x"FA90E6", x"FA9A46", x"FAB36E", x"FAC610", x"FAC878", x"FAD03F",
+         x"FAE8A0", x"FAFCCE", x"FB0018", x"FB0663", x"FB1DC7", x"FB335F", x"FB37BF", x"FB3CB5",
+         x"FB52EA", x"FB69C2", x"FB6F67", x"FB7334", x"FB8810", x"FB9FF8", x"FBA70A", x"FBA9E0",
+         x"FBBD3E", x"FBD602", x"FBDEA1", x"FBE0B7", x"FBF27A", x"FC0BE2", x"FC1627", x"FC17B7",
+         x"FC27CC", x"FC419A", x"FC4D95", x"FC4EDE", x"FC5D37", x"FC772E", x"FC84E7", x"FC8626",
+         x"FC92C1", x"FCACA1", x"FCBC17", x"FCBD8C", x"FCC86E", x"FCE1FA", x"FCF323", x"FCF50B",
+         x"FCFE42", x"FD173D", x"FD2A06", x"FD2C9C", x"FD3440", x"FD4C70", x"FD60BE", x"FD643A",
+         x"FD6A69", x"FD8199", x"FD974A", x"FD9BE0", x"FDA0BF", x"FDB6BF", x"FDCDA9", x"FDD386",
+         x"FDD743", x"FDEBE7", x"FE03DB", x"FE0B25", x"FE0DF2", x"FE2118", x"FE39E2", x"FE42B9",
+         x"FE44CD", x"FE5658", x"FE6FBE", x"FE7A3B", x"FE7BD0", x"FE8BAD", x"FEA573", x"FEB1A5",
+         x"FEB2F9", x"FEC11C", x"FEDB05", x"FEE8F3", x"FEEA44", x"FEF6AB", x"FF1077", x"FF201F",
+         x"FF21AB", x"FF2C5C", x"FF45CF", x"FF5726", x"FF592B", x"FF6235", x"FF7B11", x"FF8E05",
+         x"FF90BD", x"FF9837", x"FFB044", x"FFC4B9", x"FFC85B", x"FFCE65", x"FFE56D", x"FFFB40",
+         x"000000", x"0004C0", x"001A93", x"00319B", x"0037A5", x"003B47", x"004FBC", x"0067C9",
+         x"006F43", x"0071FB", x"0084EF", x"009DCB", x"00A6D5", x"00A8DA", x"00BA31", x"00D3A4",
+         x"00DE55", x"00DFE1", x"00EF89", x"010955", x"0115BC", x"01170D", x"0124FB", x"013EE4",
+         x"014D07", x"014E5B", x"015A8D", x"017453", x"018430", x"0185C5", x"019042", x"01A9A8",
+         x"01BB33", x"01BD47", x"01C61E", x"01DEE8", x"01F20E", x"01F4DB", x"01FC25", x"021419",
+         x"0228BD", x"022C7A", x"023257", x"024941", x"025F41", x"026420", x"0268B6", x"027E67",
+         x"029597", x"029BC6", x"029F42", x"02B390", x"02CBC0", x"02D364", x"02D5FA", x"02E8C3",
+         x"0301BE", x"030AF5", x"030CDD", x"031E06", x"033792", x"034274", x"0343E9", x"03535F",
+         x"036D3F", x"0379DA", x"037B19", x"0388D2", x"03A2C9", x"03B122", x"03B26B", x"03BE66",
+         x"03D834", x"03E849", x"03E9D9", x"03F41E", x"040D86", x"041F49", x"04215F", x"0429FE",
+         x"0442C2", x"045620", x"0458F6", x"046008", x"0477F0", x"048CCC", x"049099", x"04963E",
+         x"04AD16", x"04C34B", x"04C841", x"04CCA1", x"04E239", x"04F99D", x"04FFE8", x"050332",
+         x"051760", x"052FC1", x"053788", x"0539F0", x"054C92", x"0565BA", x"056F1A", x"0570D8",
+         x"0581D5", x"059B89", x"05A699", x"05A7E9", x"05B72D", x"05D131", x"05DDFF", x"05DF1F",
+         x"05ECA2", x"0606B6", x"061546", x"061676", x"062237", x"063C1B", x"064C6B", x"064DE9",
+         x"0657F1", x"067168", x"068369", x"068573", x"068DD3", x"06A69F", x"06BA3D", x"06BD0F",
+         x"06C3E1", x"06DBC9", x"06F0E6", x"06F4B7", x"06FA1B", x"0710EA", x"072760", x"072C63",
+         x"073083", x"074609", x"075DAD", x"07640E", x"076718", x"077B2D", x"0793CD", x"079BB0",
+         x"079DDB", x"07B05D", x"07C9C0", x"07D345", x"07D4C9", x"07E59D", x"07FF89", x"080AC5",
+         x"080BE0", x"081AF5", x"08352A", x"08422C", x"08431C", x"085069", x"086AA8", x"087973",
+         x"087A7A", x"0885FF", x"08A008", x"08B097", x"08B1F4", x"08BBBA", x"08D54D", x"08E794",
+         x"08E985", x"08F19E", x"090A7F", x"091E65", x"092127", x"0927AE", x"093FA2", x"09550A",
+         x"0958D5", x"095DEC", x"0974BD", x"098B81", x"099086", x"099458", x"09A9D7", x"09C1C9",
+         x"09C836", x"09CAF4", x"09DEF7", x"09F7E3", x"09FFDE", x"0A01BC", x"0A1422", x"0A2DCF",
+         x"0A3776", x"0A38B1", x"0A495F", x"0A6391", x"0A6EF9", x"0A6FCF", x"0A7EB4", x"0A992C",
+         x"0AA662", x"0AA713", x"0AB426", x"0ACEA2", x"0ADDAB", x"0ADE79", x"0AE9BB", x"0B03F9",
+         x"0B14CF", x"0B15FB", x"0B1F77", x"0B3937", x"0B4BCA", x"0B4D94", x"0B555D", x"0B6E60",
+         x"0B829A", x"0B853E", x"0B8B70", x"0BA37B", x"0BB93B", x"0BBCF3", x"0BC1B1", x"0BD88F",
+         x"0BEFAE", x"0BF4AC", x"0BF822", x"0C0DA2", x"0C25F1", x"0C2C63", x"0C2EC3", x"0C42BB",
+         x"0C5C04", x"0C6411", x"0C6592", x"0C77E0", x"0C91EA", x"0C9BAF", x"0C9C8F", x"0CAD18",
+         x"0CC7A4", x"0CD336", x"0CD3B5", x"0CE269", x"0CFD35", x"0D0AA2", x"0D0B02", x"0D17D9",
+         x"0D32A3", x"0D41ED", x"0D4271", x"0D4D6C", x"0D67F0", x"0D7912", x"0D79FD", x"0D8327",
+         x"0D9D24", x"0DB00D", x"0DB1A0", x"0DB90E", x"0DD243", x"0DE6DB", x"0DE954", x"0DEF23",
+         x"0E0754", x"0E1D7A", x"0E2113", x"0E2568", x"0E3C5F", x"0E53E9", x"0E58D6", x"0E5BDE",
+         x"0E7168", x"0E8A26", x"0E9095", x"0E9285", x"0EA679", x"0EC032", x"0EC84B", x"0EC95C",
+         x"0EDB96", x"0EF610", x"0EFFF0", x"0F0061", x"0F10C8", x"0F2BC1", x"0F377E", x"0F3791",
+         x"0F4613", x"0F6148", x"0F6EEF", x"0F6EE9", x"0F7B7F", x"0F96AB", x"0FA63D", x"0FA663",
+         x"0FB10F", x"0FCBED", x"0FDD64", x"0FDDFA", x"0FE6C9", x"100114", x"101460", x"1015A9",
+         x"101CB0", x"103628", x"104B2D", x"104D6A", x"1052C7", x"106B2D", x"1081C9", x"108534",
+         x"108910", x"10A02B", x"10B833", x"10BD03", x"10BF8B", x"10D52A", x"10EE6A", x"10F4CD",
+         x"10F639", x"110A2F", x"11246E", x"112C8D", x"112D19", x"113F43", x"115A43", x"11643C",
+         x"116427", x"11746C", x"118FE9", x"119BD1", x"119B62", x"11A9B0", x"11C565", x"11D349",
+         x"11D2C6", x"11DF16", x"11FABB", x"120A9C", x"120A4D", x"1214A2", x"122FEF", x"1241C7",
+         x"1241F3", x"124A5A", x"126509", x"1278C4", x"1279B0", x"128041", x"129A0D", x"12AF90",
+         x"12B17F", x"12B659", x"12CF04", x"12E629", x"12E959", x"12ECA5", x"1303F4", x"131C8F",
+         x"132135", x"132326", x"1338E4", x"1352BF", x"13590D", x"1359DC", x"136DDD", x"1388BB",
+         x"1390DA", x"1390C5", x"13A2E4", x"13BE85", x"13C894", x"13C7DF", x"13D802", x"13F41F",
+         x"140034", x"13FF27", x"140D3D", x"14298D", x"1437B4", x"143699", x"14429B", x"145ED4",
+         x"146F0E", x"146E30", x"147822", x"1493F9", x"14A63D", x"14A5E6", x"14ADD6", x"14C901",
+         x"14DD3C", x"14DDB5", x"14E3BC", x"14FDF4", x"151408", x"151595", x"1519D6", x"1532D9",
+         x"154A9F", x"154D80", x"155026", x"1567B8", x"158100", x"15856E", x"1586AD", x"159C97",
+         x"15B729", x"15BD57", x"15BD6B", x"15D17F", x"15ED1B", x"15F534", x"15F45F", x"160678",
+         x"1622D9", x"162CFC", x"162B86", x"163B88", x"165865", x"1664A9", x"1662DD", x"1670B7",
+         x"168DC3", x"169C33", x"169A60", x"16A60C", x"16C2F8", x"16D396", x"16D20A", x"16DB8B",
+         x"16F809", x"170ACB", x"1709D4", x"17113A", x"172CFD", x"1741CD", x"1741B7", x"17471E",
+         x"1761DC", x"17789A", x"1779AD", x"177D39", x"1796AB", x"17AF2F", x"17B1AD", x"17B38C",
+         x"17CB74", x"17E58A", x"17E9B0", x"17EA1A", x"18003F", x"181BAB", x"1821AD", x"1820E2",
+         x"183513", x"185192", x"18599D", x"1857E3", x"1869F9", x"188742", x"189177", x"188F19",
+         x"189EF9", x"18BCBD", x"18C933", x"18C682", x"18D419", x"18F208", x"1900CC", x"18FE19",
+         x"190961", x"192728", x"193839", x"1935D9", x"193ED7", x"195C23", x"196F76", x"196DBA",
+         x"197480", x"1990FF", x"19A67E", x"19A5B6", x"19AA61", x"19C5C4", x"19DD4C", x"19DDC6",
+         x"19E07C", x"19FA79", x"1A13DF", x"1A15E0", x"1A16D3", x"1A2F29", x"1A4A34", x"1A4DFD",
+         x"1A4D69", x"1A63DA", x"1A804B", x"1A8613", x"1A843C", x"1A9896", x"1AB626", x"1ABE1A",
+         x"1ABB4B", x"1ACD65", x"1AEBC5", x"1AF60A", x"1AF294", x"1B0250", x"1B212D", x"1B2DDA",
+         x"1B2A12", x"1B375E", x"1B5661", x"1B6584", x"1B61C1", x"1B6C96", x"1B8B68", x"1B9CFF",
+         x"1B999B", x"1BA200", x"1BC047", x"1BD446", x"1BD199", x"1BD7A0", x"1BF505", x"1C0B54",
+         x"1C09B3", x"1C0D7C", x"1C29AB", x"1C4225", x"1C41E2", x"1C4397", x"1C5E42", x"1C78B6",
+         x"1C7A1B", x"1C79F3", x"1C92D2", x"1CAF05", x"1CB257", x"1CB091", x"1CC764", x"1CE512",
+         x"1CEA8C", x"1CE771", x"1CFC02", x"1D1ADD", x"1D22B1", x"1D1E91", x"1D30B4", x"1D5069",
+         x"1D5ABC", x"1D55EF", x"1D6585", x"1D85B9", x"1D92A5", x"1D8D87", x"1D9A7C", x"1DBAD2",
+         x"1DCA64", x"1DC553", x"1DCFA1", x"1DEFBA", x"1E01F1", x"1DFD4D", x"1E04FB", x"1E2478",
+         x"1E3946", x"1E356E", x"1E3A90", x"1E5912", x"1E705D", x"1E6DAD", x"1E7065", x"1E8D93",
+         x"1EA732", x"1EA601", x"1EA67E", x"1EC203", x"1EDDC1", x"1EDE62", x"1EDCDE", x"1EF66B",
+         x"1F1409", x"1F16C5", x"1F1386", x"1F2AD7", x"1F4A09", x"1F4F20", x"1F4A75", x"1F5F4F",
+         x"1F7FC3", x"1F876A", x"1F81AA", x"1F93DE", x"1FB538", x"1FBF97", x"1FB922", x"1FC88E",
+         x"1FEA6B", x"1FF7A0", x"1FF0D9", x"1FFD67", x"201F63", x"202F7A", x"2028C8", x"203273",
+         x"205426", x"20671E", x"2060EA", x"2067B8", x"2088BA", x"209E84", x"209936", x"209D3F",
+         x"20BD28", x"20D5A8", x"20D1A3", x"20D30B", x"20F17A", x"210C82", x"210A27", x"210922",
+         x"2125B9", x"214311", x"2142B9", x"213F86", x"2159F0", x"217951", x"217B4D", x"217638",
+         x"218E2B", x"21AF43", x"21B3D8", x"21AD3A", x"21C273", x"21E4E7", x"21EC50", x"21E488",
+         x"21F6D5", x"221A3F", x"2224AA", x"221C1F", x"222B5B", x"224F50", x"225CDA", x"2253FC",
+         x"22600E", x"22841F", x"2294D8", x"228C18", x"2294F9", x"22B8B2", x"22CC9A", x"22C46B",
+         x"22CA23", x"22ED12", x"230419", x"22FCED", x"22FF95", x"232148", x"233B4C", x"233594",
+         x"233555", x"23555E", x"237230", x"236E55", x"236B67", x"238960", x"23A8BF", x"23A725",
+         x"23A1CF", x"23BD58", x"23DEF7", x"23DFF8", x"23D88E", x"23F154", x"2414D8", x"2418C2",
+         x"240FA5", x"24255F", x"244A61", x"245177", x"244712", x"245985", x"247F96", x"248A0A",
+         x"247ED1", x"248DD3", x"24B47B", x"24C270", x"24B6DE", x"24C254", x"24E915", x"24FA9D",
+         x"24EF32", x"24F713", x"251D6D", x"253288", x"2527C5", x"252C19", x"25518A", x"256A26",
+         x"25608D", x"25616F", x"258578", x"25A171", x"25997F", x"25971C", x"25B940", x"25D862",
+         x"25D28F", x"25CD26", x"25ECF1", x"260EF4", x"260BB1", x"260391", x"262097", x"264523",
+         x"2644D8", x"263A5F", x"26543F", x"267AEF", x"267DF5", x"267191", x"2687F7", x"26B058",
+         x"26B6FB", x"26A924", x"26BBCE", x"26E560", x"26EFDC", x"26E116", x"26EFD1", x"271A0C",
+         x"27288A", x"271962", x"27240D", x"274E63", x"2760F9", x"2751FF", x"27588E", x"27826C",
+         x"27991C", x"278AE5", x"278D60", x"27B631", x"27D0E9", x"27C40A", x"27C28E", x"27E9BD",
+         x"280856", x"27FD61", x"27F81F", x"281D1E", x"283F5C", x"2836DC", x"282E1B", x"285061",
+         x"2875F5", x"28706E", x"286487", x"288395", x"28AC1B", x"28AA07", x"289B65", x"28B6CA",
+         x"28E1CE", x"28E398", x"28D2B8", x"28EA10", x"29170E", x"291D0F", x"290A7D", x"291D77",
+         x"294BDC", x"29565D", x"2942B2", x"29510F", x"29803D", x"298F73", x"297B51", x"2984E7",
+         x"29B438", x"29C840", x"29B452", x"29B910", x"29E7D5", x"2A00B6", x"29EDAB", x"29ED95",
+         x"2A1B20", x"2A38C9", x"2A2750", x"2A2285", x"2A4E25", x"2A706C", x"2A6134", x"2A57E9",
+         x"2A80F3", x"2AA796", x"2A9B48", x"2A8DCB", x"2AB39A", x"2ADE3E", x"2AD57A", x"2AC431",
+         x"2AE62B", x"2B145F", x"2B0FB8", x"2AFB21", x"2B18B9", x"2B49F5", x"2B49F1", x"2B329D",
+         x"2B4B56", x"2B7EFF", x"2B8411", x"2B6AA5", x"2B7E16", x"2BB37E", x"2BBE04", x"2BA335",
+         x"2BB10D", x"2BE777", x"2BF7B6", x"2BDC48", x"2BE44D", x"2C1AF1", x"2C3116", x"2C15D7",
+         x"2C17E9", x"2C4DF4", x"2C6A11", x"2C4FD6", x"2C4BF3", x"2C808D", x"2CA296", x"2C8A39",
+         x"2C807B", x"2CB2CA", x"2CDA95", x"2CC4F0", x"2CB58F", x"2CE4BB", x"2D1201", x"2CFFE9",
+         x"2CEB3D", x"2D1674", x"2D48CF", x"2D3B11", x"2D218E", x"2D4808", x"2D7EF5", x"2D7653",
+         x"2D588A", x"2D798E", x"2DB46C", x"2DB197", x"2D9037", x"2DAB1D", x"2DE931", x"2DECC7",
+         x"2DC897", x"2DDCCC", x"2E1D44", x"2E27CA", x"2E01A9", x"2E0EB5", x"2E50A6", x"2E6286",
+         x"2E3B6A", x"2E40F0", x"2E835D", x"2E9CE5", x"2E75D1", x"2E7395", x"2EB572", x"2ED6CD",
+         x"2EB0D5", x"2EA6BD", x"2EE6F0", x"2F1027", x"2EEC67", x"2EDA7F", x"2F17E7", x"2F48DC",
+         x"2F2879", x"2F0EEF", x"2F486A", x"2F80D9", x"2F64F5", x"2F4422", x"2F788D", x"2FB80A",
+         x"2FA1C5", x"2F7A28", x"2FA867", x"2FEE5F", x"2FDED1", x"2FB112", x"2FD814", x"3023CB",
+         x"301BFC", x"2FE8EB", x"3007AF", x"305842", x"30592A", x"3021BD", x"303757", x"308BBD",
+         x"30963B", x"305B8E", x"30672C", x"30BE37", x"30D30F", x"309661", x"30974F", x"30EFAF",
+         x"310F84", x"30D235", x"30C7E3", x"312028", x"314B77", x"310F05", x"30F90A", x"314FA7",
+         x"3186C4", x"314CCB", x"312AE8", x"317E37", x"31C14A", x"318B7A", x"315D9F", x"31ABE4",
+         x"31FAE4", x"31CB04", x"319154", x"31D8BF", x"323370", x"320B57", x"31C628", x"3204DB",
+         x"326ACA", x"324C5E", x"31FC40", x"32304F", x"32A0CF", x"328E00", x"3233BE", x"325B34",
+         x"32D55D", x"32D023", x"326CC4", x"3285A7", x"330851", x"3312AC", x"32A776", x"32AFC3",
+         x"333986", x"33557A", x"32E3FC", x"32D9A9", x"3368D4", x"339870", x"33227D", x"330378",
+         x"33960F", x"33DB6C", x"336329", x"332D4F", x"33C104", x"341E50", x"33A63B", x"335750",
+         x"33E972", x"3460FB", x"33EBFA", x"338198", x"340F04", x"34A351", x"3434CB", x"33AC42",
+         x"343146", x"34E537", x"348137", x"33D767", x"344F91", x"35269B", x"34D20D", x"340315",
+         x"3468E3", x"356772", x"35288C", x"342F4E", x"347BA8", x"35A7C6", x"3586C2", x"345BFA",
+         x"348531", x"35E7C6", x"35F040", x"3488C7", x"34809F", x"3627F6", x"366BD6", x"34B4DC",
+         x"346428", x"3669C6", x"37081A", x"34DDBA", x"34190C", x"36B1C5", x"37EAA0", x"34FA52",
+         x"335C42", x"37142C", x"3998AD", x"34D4DA", x"30F470", x"38533A", x"3FFFFF", x"2EA185"),
+        -- octave 2
+        (x"000000", x"E64136", x"D14FD8", x"C45BDB", x"C00001", x"C24D3D", x"C7C709", x"CCDA9F",
+         x"CF2EF0", x"CE485F", x"CB508D", x"C8367F", x"C69F3D", x"C726B0", x"C93CDF", x"CB9A14",
+         x"CCFDD3", x"CCD198", x"CB61D0", x"C99C60", x"C88345", x"C8A355", x"C9D588", x"CB644C",
+         x"CC7864", x"CC8E45", x"CBB569", x"CA7C87", x"C99B82", x"C98DA8", x"CA5395", x"CB7B2E",
+         x"CC64C0", x"CC9C40", x"CC1576", x"CB2C6F", x"CA6D74", x"CA461A", x"CACB48", x"CBB292",
+         x"CC7FBB", x"CCCB08", x"CC78E0", x"CBC540", x"CB1EC6", x"CAE7D3", x"CB4137", x"CBFB11",
+         x"CCB288", x"CD0A33", x"CCDD25", x"CC50F3", x"CBBE18", x"CB7D55", x"CBB6D7", x"CC4DEC",
+         x"CCF355", x"CD52BD", x"CD4165", x"CCD441", x"CC5240", x"CC0B7B", x"CC2CB1", x"CCA7BB",
+         x"CD3D3C", x"CDA12E", x"CDA549", x"CD51B2", x"CCDED7", x"CC94CC", x"CCA2F9", x"CD0691",
+         x"CD8D8B", x"CDF3A5", x"CE08B4", x"CDCAC2", x"CD65EB", x"CD1AB3", x"CD19BF", x"CD6943",
+         x"CDE2A8", x"CE490F", x"CE6BA2", x"CE4062", x"CDE8C0", x"CD9E07", x"CD9100", x"CDCF0E",
+         x"CE3B92", x"CEA0C3", x"CECE1B", x"CEB332", x"CE6824", x"CE1F48", x"CE08AC", x"CE3769",
+         x"CE97A1", x"CEFA5C", x"CF3031", x"CF23A8", x"CEE4A3", x"CE9EC9", x"CE80B3", x"CEA1F1",
+         x"CEF660", x"CF5599", x"CF91F9", x"CF921B", x"CF5E9F", x"CF1CBB", x"CEF8FB", x"CF0E56",
+         x"CF577A", x"CFB253", x"CFF38A", x"CFFED0", x"CFD661", x"CF993E", x"CF716C", x"CF7C5B",
+         x"CFBAB3", x"D01072", x"D05500", x"D06A03", x"D04C1E", x"D01466", x"CFE9ED", x"CFEBC8",
+         x"D01FD8", x"D06FE6", x"D0B674", x"D0D3E6", x"D0C004", x"D08E3D", x"D06261", x"D05C6E",
+         x"D086C2", x"D0D0A5", x"D11802", x"D13CA7", x"D13238", x"D106CC", x"D0DAAF", x"D0CE20",
+         x"D0EF4C", x"D132AB", x"D179C3", x"D1A471", x"D1A2DB", x"D17E17", x"D152BD", x"D140B5",
+         x"D15958", x"D195F2", x"D1DBD1", x"D20B6B", x"D2120D", x"D1F421", x"D1CA70", x"D1B405",
+         x"D1C4C6", x"D1FA79", x"D23E46", x"D271BC", x"D27FE9", x"D268EF", x"D241B2", x"D227ED",
+         x"D2317B", x"D26039", x"D2A137", x"D2D788", x"D2EC8E", x"D2DC85", x"D2B86D", x"D29C48",
+         x"D29F5A", x"D2C72F", x"D304BA", x"D33CF3", x"D35817", x"D34EE9", x"D32E8B", x"D310F4",
+         x"D30E45", x"D32F54", x"D368E2", x"D3A21D", x"D3C2A2", x"D3C022", x"D3A3FC", x"D385D0",
+         x"D37E21", x"D3989F", x"D3CDC0", x"D40727", x"D42C4B", x"D43039", x"D418B0", x"D3FABC",
+         x"D3EECF", x"D40306", x"D43362", x"D46C2F", x"D49530", x"D49F3A", x"D48C99", x"D46F9C",
+         x"D46034", x"D46E7E", x"D499D4", x"D4D153", x"D4FD6E", x"D50D32", x"D4FFAD", x"D4E452",
+         x"D4D230", x"D4DAF7", x"D50120", x"D536AC", x"D56522", x"D57A30", x"D571E5", x"D558C6",
+         x"D544A8", x"D54862", x"D5694A", x"D59C55", x"D5CC69", x"D5E644", x"D5E33C", x"D5CCE0",
+         x"D5B77E", x"D5B6AD", x"D5D256", x"D60262", x"D63361", x"D65183", x"D653B0", x"D6408A",
+         x"D62A96", x"D625C4", x"D63C45", x"D668E9", x"D69A25", x"D6BBFF", x"D6C342", x"D6B3B2",
+         x"D69DD4", x"D69593", x"D6A715", x"D6CFFB", x"D700D0", x"D725CF", x"D731F6", x"D72647",
+         x"D7111C", x"D70603", x"D712C0", x"D737A6", x"D7677E", x"D78F09", x"D79FD1", x"D7983C",
+         x"D78457", x"D776FD", x"D77F40", x"D79FF7", x"D7CE46", x"D7F7C4", x"D80CDD", x"D80986",
+         x"D7F76A", x"D7E86A", x"D7EC89", x"D808F8", x"D83540", x"D86019", x"D87925", x"D87A1D",
+         x"D86A41", x"D85A32", x"D85A91", x"D872AE", x"D89C82", x"D8C81F", x"D8E4B6", x"D8E9FC",
+         x"D8DCC6", x"D8CC3B", x"D8C948", x"D8DD1E", x"D9041E", x"D92FF0", x"D94F9F", x"D95921",
+         x"D94EE8", x"D93E6F", x"D9389E", x"D94849", x"D96C27", x"D997A2", x"D9B9F1", x"D9C78C",
+         x"D9C095", x"D9B0B5", x"D9A883", x"D9B42C", x"D9D4AB", x"D9FF4D", x"DA23BF", x"DA3540",
+         x"DA31C0", x"DA22F8", x"DA18E2", x"DA20C3", x"DA3DB7", x"DA6707", x"DA8D1B", x"DAA243",
+         x"DAA25F", x"DA9520", x"DA89AA", x"DA8E08", x"DAA754", x"DACEE5", x"DAF61A", x"DB0E9C",
+         x"DB1267", x"DB071A", x"DAFAC4", x"DAFBF2", x"DB118B", x"DB36FB", x"DB5ED0", x"DB7A56",
+         x"DB81D4", x"DB78D3", x"DB6C1B", x"DB6A75", x"DB7C61", x"DB9F5B", x"DBC753", x"DBE57D",
+         x"DBF0A0", x"DBEA3A", x"DBDD9C", x"DBD984", x"DBE7D6", x"DC0815", x"DC2FB8", x"DC501F",
+         x"DC5ECC", x"DC5B40", x"DC4F31", x"DC4912", x"DC53EC", x"DC7137", x"DC9812", x"DCBA4B",
+         x"DCCC59", x"DCCBD6", x"DCC0C6", x"DCB90D", x"DCC09F", x"DCDACE", x"DD0077", x"DD2411",
+         x"DD394B", x"DD3BF3", x"DD3247", x"DD2965", x"DD2DEB", x"DD44E4", x"DD68F9", x"DD8D83",
+         x"DDA5A7", x"DDAB8E", x"DDA3A2", x"DD9A08", x"DD9BC9", x"DDAF7F", x"DDD1AA", x"DDF6B3",
+         x"DE1176", x"DE1A9F", x"DE14C5", x"DE0AE3", x"DE0A2F", x"DE1AA5", x"DE3A9B", x"DE5FB5",
+         x"DE7CC2", x"DE8924", x"DE85A0", x"DE7BE5", x"DE7912", x"DE8659", x"DEA3DA", x"DEC89A",
+         x"DEE797", x"DEF71B", x"DEF626", x"DEECF9", x"DEE865", x"DEF29C", x"DF0D76", x"DF3175",
+         x"DF5203", x"DF6484", x"DF664B", x"DF5E0E", x"DF581B", x"DF5F6B", x"DF7778", x"DF9A58",
+         x"DFBC13", x"DFD162", x"DFD602", x"DFCF12", x"DFC825", x"DFCCC3", x"DFE1EC", x"E00355",
+         x"E025D7", x"E03DBA", x"E04546", x"E03FF4", x"E03872", x"E03A9D", x"E04CD7", x"E06C7C",
+         x"E08F60", x"E0A993", x"E0B40E", x"E0B0A4", x"E0A8F2", x"E0A8F2", x"E0B840", x"E0D5DC",
+         x"E0F8BF", x"E114F6", x"E12257", x"E12114", x"E11995", x"E117B8", x"E12429", x"E13F83",
+         x"E16204", x"E17FEE", x"E19020", x"E19137", x"E18A48", x"E186E4", x"E19093", x"E1A97E",
+         x"E1CB41", x"E1EA86", x"E1FD68", x"E20100", x"E1FAFB", x"E1F669", x"E1FD7C", x"E213D7",
+         x"E23485", x"E254CB", x"E26A33", x"E27067", x"E26B9F", x"E26639", x"E26AE1", x"E27E97",
+         x"E29DE1", x"E2BECD", x"E2D683", x"E2DF63", x"E2DC23", x"E2D646", x"E2D8BD", x"E2E9C4",
+         x"E30765", x"E32898", x"E34260", x"E34DEE", x"E34C79", x"E34681", x"E34709", x"E35564",
+         x"E3711D", x"E3923E", x"E3ADD1", x"E3BC06", x"E3BC93", x"E3B6DB", x"E3B5BC", x"E3C17A",
+         x"E3DB17", x"E3FBCE", x"E418E0", x"E429A7", x"E42C65", x"E42743", x"E424CC", x"E42E06",
+         x"E4455F", x"E46556", x"E48399", x"E496D2", x"E49BE5", x"E497AA", x"E4942D", x"E49B07",
+         x"E4AFFE", x"E4CEE7", x"E4EE06", x"E50389", x"E50B09", x"E50801", x"E503D2", x"E5087B",
+         x"E51AFD", x"E5388F", x"E55835", x"E56FD0", x"E579CA", x"E5783A", x"E573AF", x"E5765C",
+         x"E58662", x"E5A25C", x"E5C234", x"E5DBAC", x"E5E822", x"E5E847", x"E5E3B4", x"E5E4A4",
+         x"E5F231", x"E60C5C", x"E62C11", x"E64726", x"E6560F", x"E6581C", x"E653D5", x"E6534B",
+         x"E65E6E", x"E6769A", x"E695DB", x"E6B245", x"E6C38D", x"E6C7AC", x"E6C401", x"E6C247",
+         x"E6CB18", x"E6E122", x"E6FFA0", x"E71D15", x"E7309D", x"E736EE", x"E7342B", x"E7318D",
+         x"E73830", x"E74BFC", x"E7696E", x"E787A0", x"E79D42", x"E7A5DB", x"E7A445", x"E7A111",
+         x"E7A5B2", x"E7B72F", x"E7D354", x"E7F1F2", x"E8097E", x"E81469", x"E81441", x"E810C8",
+         x"E8139A", x"E822C3", x"E83D5E", x"E85C19", x"E87558", x"E88296", x"E88412", x"E880A4",
+         x"E881E2", x"E88EBB", x"E8A799", x"E8C622", x"E8E0D5", x"E8F05C", x"E8F3AC", x"E8F097",
+         x"E8F081", x"E8FB1A", x"E91210", x"E9301B", x"E94C00", x"E95DBC", x"E96306", x"E96093",
+         x"E95F6F", x"E967E1", x"E97CCC", x"E99A11", x"E9B6E0", x"E9CAB4", x"E9D215", x"E9D08C",
+         x"E9CEA1", x"E9D50E", x"E9E7D8", x"EA0411", x"EA2181", x"EA3746", x"EA40D1", x"EA4073",
+         x"EA3E0D", x"EA429E", x"EA5339", x"EA6E29", x"EA8BEF", x"EAA377", x"EAAF35", x"EAB03C",
+         x"EAADA6", x"EAB08E", x"EABEF6", x"EAD866", x"EAF636", x"EB0F4C", x"EB1D3B", x"EB1FDB",
+         x"EB1D61", x"EB1ED8", x"EB2B12", x"EB42D2", x"EB6062", x"EB7ACB", x"EB8AE0", x"EB8F45",
+         x"EB8D2F", x"EB8D73", x"EB978F", x"EBAD79", x"EBCA80", x"EBE5FC", x"EBF823", x"EBFE70",
+         x"EBFD05", x"EBFC57", x"EC046F", x"EC1863", x"EC349E", x"EC50E8", x"EC6505", x"EC6D53",
+         x"EC6CD4", x"EC6B7B", x"EC71B0", x"EC8399", x"EC9EC8", x"ECBB9A", x"ECD186", x"ECDBE6",
+         x"ECDC92", x"ECDAD4", x"ECDF4F", x"ECEF22", x"ED090A", x"ED261D", x"ED3DAC", x"ED4A24",
+         x"ED4C31", x"ED4A57", x"ED4D48", x"ED5B02", x"ED7371", x"ED907D", x"EDA97A", x"EDB808",
+         x"EDBBA5", x"EDB9F6", x"EDBB95", x"EDC73E", x"EDDE07", x"EDFAC5", x"EE14F7", x"EE258F",
+         x"EE2AE6", x"EE29A7", x"EE2A2F", x"EE33D8", x"EE48D6", x"EE6502", x"EE802B", x"EE92B9",
+         x"EE99E9", x"EE995D", x"EE990E", x"EEA0CF", x"EEB3E8", x"EECF40", x"EEEB20", x"EEFF85",
+         x"EF08A5", x"EF090B", x"EF0828", x"EF0E23", x"EF1F43", x"EF398D", x"EF55DE", x"EF6BF6",
+         x"EF7714", x"EF78A5", x"EF7773", x"EF7BD1", x"EF8AEF", x"EFA3F2", x"EFC071", x"EFD80F",
+         x"EFE530", x"EFE821", x"EFE6E4", x"EFE9D4", x"EFF6EF", x"F00E7D", x"F02AE4", x"F043D5",
+         x"F052F6", x"F05772", x"F0566E", x"F05826", x"F06348", x"F07937", x"F09542", x"F0AF4F",
+         x"F0C062", x"F0C68F", x"F0C608", x"F0C6C2", x"F0CFFB", x"F0E429", x"F0FF98", x"F11A84",
+         x"F12D74", x"F1356E", x"F135A3", x"F1359E", x"F13D09", x"F14F5D", x"F169F2", x"F1857D",
+         x"F19A2C", x"F1A409", x"F1A535", x"F1A4B1", x"F1AA6F", x"F1BAD9", x"F1D45B", x"F1F044",
+         x"F2068C", x"F21258", x"F214B2", x"F213F2", x"F2182B", x"F226A4", x"F23EDF", x"F25AE2",
+         x"F27298", x"F28056", x"F2840F", x"F28355", x"F28639", x"F292C2", x"F2A988", x"F2C564",
+         x"F2DE55", x"F2EE00", x"F2F341", x"F2F2CF", x"F2F493", x"F2FF35", x"F31461", x"F32FD5",
+         x"F349CA", x"F35B53", x"F3623F", x"F36256", x"F36332", x"F36C00", x"F37F72", x"F39A3F",
+         x"F3B4FD", x"F3C84E", x"F3D101", x"F3D1DC", x"F3D20E", x"F3D923", x"F3EAC4", x"F404AF",
+         x"F41FF8", x"F434F3", x"F43F7E", x"F44157", x"F4411E", x"F4469B", x"F4565E", x"F46F30",
+         x"F48AC4", x"F4A142", x"F4ADB0", x"F4B0BB", x"F4B058", x"F4B466", x"F4C244", x"F4D9CD",
+         x"F4F56B", x"F50D41", x"F51B93", x"F51FFE", x"F51FB1", x"F52280", x"F52E7D", x"F54490",
+         x"F55FF8", x"F578F4", x"F58923", x"F58F16", x"F58F1F", x"F590E2", x"F59B09", x"F5AF84",
+         x"F5CA76", x"F5E462", x"F5F65E", x"F5FDF9", x"F5FE96", x"F5FF87", x"F607EA", x"F61AB0",
+         x"F634F1", x"F64F91", x"F66344", x"F66C9F", x"F66E0B", x"F66E65", x"F67521", x"F6861D",
+         x"F69F73", x"F6BA8C", x"F6CFD5", x"F6DB01", x"F6DD73", x"F6DD74", x"F6E2AB", x"F6F1D1",
+         x"F70A08", x"F7255A", x"F73C14", x"F7491A", x"F74CC3", x"F74CAA", x"F75086", x"F75DD2",
+         x"F774BA", x"F79006", x"F7A805", x"F7B6E3", x"F7BBF0", x"F7BBFD", x"F7BEAC", x"F7CA22",
+         x"F7DF94", x"F7FA9B", x"F813AD", x"F8245B", x"F82AF0", x"F82B62", x"F82D19", x"F836C6",
+         x"F84A9F", x"F86523", x"F87F12", x"F89180", x"F899BC", x"F89ACE", x"F89BC5", x"F8A3BD",
+         x"F8B5E3", x"F8CFAA", x"F8EA3B", x"F8FE51", x"F9084A", x"F90A35", x"F90AA7", x"F91108",
+         x"F92168", x"F93A3B", x"F95532", x"F96ACF", x"F97694", x"F9798D", x"F979B8", x"F97EA4",
+         x"F98D35", x"F9A4E0", x"F9C000", x"F9D6FD", x"F9E494", x"F9E8CC", x"F9E8ED", x"F9EC8F",
+         x"F9F94D", x"FA0FA5", x"FA2AAE", x"FA42DF", x"FA5247", x"FA57E6", x"FA583D", x"FA5AC3",
+         x"FA65B5", x"FA7A92", x"FA9548", x"FAAE7A", x"FABFA8", x"FAC6D2", x"FAC79C", x"FAC93B",
+         x"FAD26F", x"FAE5B2", x"FAFFD7", x"FB19D5", x"FB2CB7", x"FB3589", x"FB36FF", x"FB37EF",
+         x"FB3F7B", x"FB510B", x"FB6A68", x"FB84F7", x"FB9973", x"FBA401", x"FBA65C", x"FBA6D9",
+         x"FBACDA", x"FBBCA6", x"FBD504", x"FBEFE9", x"FC05DE", x"FC1235", x"FC15A8", x"FC15EE",
+         x"FC1A88", x"FC2888", x"FC3FB7", x"FC5AB3", x"FC71FB", x"FC801F", x"FC84D8", x"FC8525",
+         x"FC8883", x"FC94B7", x"FCAA8B", x"FCC561", x"FCDDCD", x"FCEDBC", x"FCF3E2", x"FCF473",
+         x"FCF6C7", x"FD0135", x"FD1589", x"FD2FFD", x"FD495A", x"FD5B07", x"FD62BD", x"FD63CF",
+         x"FD654B", x"FD6E04", x"FD80BA", x"FD9A90", x"FDB4A9", x"FDC801", x"FDD161", x"FDD32D",
+         x"FDD40B", x"FDDB25", x"FDEC27", x"FE0527", x"FE1FC1", x"FE34A9", x"FE3FC6", x"FE4283",
+         x"FE42FD", x"FE4898", x"FE57D6", x"FE6FCC", x"FE8AAB", x"FEA100", x"FEADE6", x"FEB1C5",
+         x"FEB218", x"FEB65A", x"FEC3CC", x"FEDA89", x"FEF570", x"FF0D0A", x"FF1BBB", x"FF20E9",
+         x"FF2154", x"FF2467", x"FF3010", x"FF4569", x"FF601B", x"FF78CC", x"FF8942", x"FF8FE6",
+         x"FF90A4", x"FF92BA", x"FF9CA3", x"FFB076", x"FFCAB5", x"FFE449", x"FFF679", x"FFFEB3",
+         x"000000", x"00014D", x"000987", x"001BB7", x"00354B", x"004F8A", x"00635D", x"006D46",
+         x"006F5C", x"00701A", x"0076BE", x"008734", x"009FE5", x"00BA97", x"00CFF0", x"00DB99",
+         x"00DEAC", x"00DF17", x"00E445", x"00F2F6", x"010A90", x"012577", x"013C34", x"0149A6",
+         x"014DE8", x"014E3B", x"01521A", x"015F00", x"017555", x"019034", x"01A82A", x"01B768",
+         x"01BD03", x"01BD7D", x"01C03A", x"01CB57", x"01E03F", x"01FAD9", x"0213D9", x"0224DB",
+         x"022BF5", x"022CD3", x"022E9F", x"0237FF", x"024B57", x"026570", x"027F46", x"0291FC",
+         x"029AB5", x"029C31", x"029D43", x"02A4F9", x"02B6A6", x"02D003", x"02EA77", x"02FECB",
+         x"030939", x"030B8D", x"030C1E", x"031244", x"032233", x"033A9F", x"035575", x"036B49",
+         x"03777D", x"037ADB", x"037B28", x"037FE1", x"038E05", x"03A54D", x"03C049", x"03D778",
+         x"03E578", x"03EA12", x"03EA58", x"03EDCB", x"03FA22", x"041017", x"042AFC", x"04435A",
+         x"045326", x"045927", x"0459A4", x"045BFF", x"04668D", x"047B09", x"049598", x"04AEF5",
+         x"04C085", x"04C811", x"04C901", x"04CA77", x"04D349", x"04E62B", x"050029", x"051A4E",
+         x"052D91", x"0536C5", x"053864", x"05392E", x"054058", x"055186", x"056AB8", x"05856E",
+         x"059A4B", x"05A53D", x"05A7C3", x"05A81A", x"05ADB9", x"05BD21", x"05D552", x"05F05B",
+         x"0606B3", x"061371", x"061713", x"061734", x"061B6C", x"062903", x"064000", x"065B20",
+         x"0672CB", x"06815C", x"068648", x"068673", x"06896C", x"069531", x"06AACE", x"06C5C5",
+         x"06DE98", x"06EEF8", x"06F559", x"06F5CB", x"06F7B6", x"0701AF", x"0715C5", x"073056",
+         x"074A1D", x"075C43", x"07643B", x"076532", x"076644", x"076E80", x"0780EE", x"079ADD",
+         x"07B561", x"07C93A", x"07D2E7", x"07D49E", x"07D510", x"07DBA5", x"07EC53", x"080565",
+         x"08206C", x"0835DE", x"084154", x"084403", x"084410", x"08491D", x"0857FB", x"086FFA",
+         x"088B46", x"08A22E", x"08AF7A", x"08B356", x"08B33D", x"08B6E6", x"08C3EC", x"08DAA6",
+         x"08F5F8", x"090E2F", x"091D55", x"09228C", x"09228D", x"0924FF", x"09302B", x"094574",
+         x"09608D", x"0979E3", x"098ADF", x"09919B", x"0991F5", x"099361", x"099CBC", x"09B06F",
+         x"09CB0F", x"09E550", x"09F816", x"0A0079", x"0A016A", x"0A0207", x"0A09A2", x"0A1B9E",
+         x"0A358A", x"0A507C", x"0A64F7", x"0A6F1E", x"0A70E1", x"0A70EA", x"0A76DD", x"0A870C",
+         x"0AA008", x"0ABB70", x"0AD183", x"0ADD80", x"0AE04F", x"0AE002", x"0AE46D", x"0AF2BF",
+         x"0B0A95", x"0B2633", x"0B3DBC", x"0B4B9A", x"0B4FA8", x"0B4F45", x"0B5250", x"0B5EBE",
+         x"0B753C", x"0B90D0", x"0BA9A2", x"0BB965", x"0BBEE2", x"0BBEA9", x"0BC082", x"0BCB0D",
+         x"0BE008", x"0BFB51", x"0C153C", x"0C26DD", x"0C2DF2", x"0C2E24", x"0C2EFF", x"0C37B2",
+         x"0C4B03", x"0C65C1", x"0C808E", x"0C9400", x"0C9CCE", x"0C9DAA", x"0C9DC1", x"0CA4AD",
+         x"0CB636", x"0CD02B", x"0CEB9F", x"0D00CB", x"0D0B6D", x"0D0D31", x"0D0CBF", x"0D1200",
+         x"0D21AB", x"0D3A9C", x"0D5678", x"0D6D3E", x"0D79C7", x"0D7CAB", x"0D7BF1", x"0D7FAA",
+         x"0D8D68", x"0DA51E", x"0DC121", x"0DD95C", x"0DE7D5", x"0DEC0E", x"0DEB4E", x"0DEDA8",
+         x"0DF974", x"0E0FBC", x"0E2BA5", x"0E4527", x"0E5591", x"0E5B4F", x"0E5ACB", x"0E5BF7",
+         x"0E65D4", x"0E7A83", x"0E960E", x"0EB0A3", x"0EC2F7", x"0ECA62", x"0ECA5D", x"0ECA92",
+         x"0ED28C", x"0EE57C", x"0F0068", x"0F1BD7", x"0F3005", x"0F393E", x"0F39F8", x"0F3971",
+         x"0F3F9E", x"0F50B1", x"0F6ABE", x"0F86C9", x"0F9CB8", x"0FA7DA", x"0FA992", x"0FA88E",
+         x"0FAD0A", x"0FBC2B", x"0FD51C", x"0FF183", x"100911", x"10162C", x"10191C", x"1017DF",
+         x"101AD0", x"1027F1", x"103F8F", x"105C0E", x"107511", x"10842F", x"10888D", x"10875B",
+         x"1088EC", x"10940A", x"10AA22", x"10C673", x"10E0BD", x"10F1DD", x"10F7D8", x"10F6F5",
+         x"10F75B", x"11007B", x"1114E0", x"1130C0", x"114C18", x"115F31", x"1166F2", x"1166A3",
+         x"116617", x"116D47", x"117FD5", x"119AFE", x"11B72A", x"11CC28", x"11D5D1", x"11D659",
+         x"11D51A", x"11DA71", x"11EB09", x"12053B", x"1221F9", x"1238C2", x"12446B", x"12460A",
+         x"12445B", x"1247F8", x"125686", x"126F83", x"128C8F", x"12A4FE", x"12B2B8", x"12B5A9",
+         x"12B3CF", x"12B5DC", x"12C254", x"12D9E3", x"12F6F6", x"1310DE", x"1320B1", x"13252C",
+         x"13236E", x"13241A", x"132E7A", x"134466", x"136138", x"137C67", x"138E50", x"139485",
+         x"13932C", x"1392AD", x"139AFB", x"13AF18", x"13CB62", x"13E79D", x"13FB91", x"1403A9",
+         x"1402FB", x"140190", x"1407DD", x"141A04", x"143580", x"145287", x"146871", x"14728D",
+         x"1472D1", x"1470BB", x"147520", x"148535", x"149F9E", x"14BD2E", x"14D4EE", x"14E128",
+         x"14E29F", x"14E025", x"14E2C5", x"14F0B4", x"1509CA", x"15279A", x"15410A", x"154F72",
+         x"15525A", x"154FC4", x"1550CB", x"155C89", x"157411", x"1591D7", x"15ACC7", x"15BD62",
+         x"15C1F3", x"15BF8D", x"15BF2F", x"15C8BA", x"15DE7F", x"15FBEF", x"161828", x"162AF2",
+         x"16315F", x"162F74", x"162DEB", x"16354C", x"164920", x"1665EF", x"168334", x"16981F",
+         x"16A091", x"169F6D", x"169CFA", x"16A244", x"16B400", x"16CFE5", x"16EDF0", x"1704E6",
+         x"170F7F", x"170F69", x"170C54", x"170FA4", x"171F2B", x"1739DE", x"175867", x"177145",
+         x"177E1E", x"177F5C", x"177BEE", x"177D6A", x"178AA8", x"17A3E7", x"17C2A2", x"17DD3D",
+         x"17EC66", x"17EF38", x"17EBBF", x"17EB97", x"17F682", x"180E0E", x"182CAC", x"1848D1",
+         x"185A4E", x"185EEF", x"185BBB", x"185A25", x"1862BE", x"187860", x"189692", x"18B404",
+         x"18C7D0", x"18CE73", x"18CBD5", x"18C912", x"18CF63", x"18E2EB", x"190060", x"191EDE",
+         x"1934E8", x"193DB9", x"193BFF", x"193854", x"193C73", x"194DBB", x"196A25", x"198966",
+         x"19A192", x"19ACB5", x"19AC2B", x"19A7E4", x"19A9F1", x"19B8DA", x"19D3EF", x"19F3A4",
+         x"1A0DCF", x"1A1B5C", x"1A1C4C", x"1A17B9", x"1A17DE", x"1A2454", x"1A3DCC", x"1A5DA4",
+         x"1A799E", x"1A89A4", x"1A8C51", x"1A87C6", x"1A8636", x"1A9030", x"1AA7CB", x"1AC771",
+         x"1AE503", x"1AF785", x"1AFC2E", x"1AF7FF", x"1AF4F7", x"1AFC77", x"1B11FA", x"1B3119",
+         x"1B5002", x"1B64F9", x"1B6BD3", x"1B6856", x"1B641B", x"1B692E", x"1B7C67", x"1B9AAA",
+         x"1BBAA1", x"1BD1FA", x"1BDB34", x"1BD8BD", x"1BD39B", x"1BD659", x"1BE720", x"1C0432",
+         x"1C24E9", x"1C3E86", x"1C4A44", x"1C4925", x"1C436D", x"1C43FA", x"1C522F", x"1C6DC2",
+         x"1C8EE3", x"1CAA9C", x"1CB8F7", x"1CB97F", x"1CB387", x"1CB212", x"1CBDA0", x"1CD768",
+         x"1CF89B", x"1D163C", x"1D2743", x"1D29BA", x"1D23DD", x"1D209D", x"1D297D", x"1D4133",
+         x"1D621F", x"1D8169", x"1D951F", x"1D99C7", x"1D9461", x"1D8F99", x"1D95CD", x"1DAB35",
+         x"1DCB7B", x"1DEC29", x"1E0284", x"1E0997", x"1E0505", x"1DFF00", x"1E0298", x"1E157A",
+         x"1E34BF", x"1E5682", x"1E6F6D", x"1E791C", x"1E75B8", x"1E6EC9", x"1E6FE0", x"1E8012",
+         x"1E9DFC", x"1EC07D", x"1EDBD7", x"1EE848", x"1EE66B", x"1EDEEC", x"1EDDA9", x"1EEB0A",
+         x"1F0741", x"1F2A24", x"1F47C0", x"1F570E", x"1F570E", x"1F4F5C", x"1F4BF2", x"1F566D",
+         x"1F70A0", x"1F9384", x"1FB329", x"1FC563", x"1FC78E", x"1FC00C", x"1FBABA", x"1FC246",
+         x"1FDA29", x"1FFCAB", x"201E14", x"20333D", x"2037DB", x"2030EE", x"2029FE", x"202E9E",
+         x"2043ED", x"2065A8", x"208888", x"20A095", x"20A7E5", x"20A1F2", x"2099B5", x"209B7C",
+         x"20ADFD", x"20CE8B", x"20F28A", x"210D64", x"21179B", x"211307", x"2109DA", x"2108E5",
+         x"211869", x"213766", x"215C26", x"2179A7", x"2186EE", x"21841B", x"217A60", x"2176DC",
+         x"21833E", x"21A04B", x"21C565", x"21E55B", x"21F5D1", x"21F51D", x"21EB3B", x"21E561",
+         x"21EE8A", x"22094D", x"222E56", x"225081", x"226437", x"2265F8", x"225C5E", x"225472",
+         x"225A59", x"22727D", x"229707", x"22BB1C", x"22D215", x"22D69B", x"22CDB9", x"22C40D",
+         x"22C6B5", x"22DBEF", x"22FF89", x"232532", x"233F61", x"2346F3", x"233F3A", x"23342A",
+         x"2333A7", x"2345B5", x"2367EE", x"238EC9", x"23AC14", x"23B6EE", x"23B0CF", x"23A4C0",
+         x"23A134", x"23AFE1", x"23D048", x"23F7EB", x"24182A", x"24267C", x"242264", x"2415C6",
+         x"240F60", x"241A83", x"2438AD", x"2460A5", x"24839F", x"24958B", x"2493E5", x"24872D",
+         x"247E2C", x"2485AA", x"24A130", x"24C905", x"24EE75", x"25040E", x"25053C", x"24F8E6",
+         x"24ED99", x"24F164", x"2509E6", x"25311B", x"2558AC", x"2571F8", x"257656", x"256AE0",
+         x"255DA1", x"255DBD", x"2572E5", x"2598F9", x"25C249", x"25DF3D", x"25E71E", x"25DD08",
+         x"25CE40", x"25CAC0", x"25DC41", x"2600B3", x"262B55", x"264BD4", x"26577D", x"264F4B",
+         x"263F6B", x"263874", x"26460F", x"26685E", x"2693D9", x"26B7B7", x"26C762", x"26C191",
+         x"26B118", x"26A6DF", x"26B061", x"26D010", x"26FBE2", x"2722E2", x"2736B8", x"2733C5",
+         x"27233A", x"271604", x"271B4A", x"2737E1", x"27637E", x"278D52", x"27A56F", x"27A5CE",
+         x"2795BF", x"2785E3", x"2786DB", x"279FE7", x"27CAC0", x"27F708", x"281377", x"281796",
+         x"280896", x"27F67A", x"27F323", x"28083C", x"2831BA", x"286009", x"2880C0", x"288903",
+         x"287BA9", x"2867C4", x"28602F", x"2870F7", x"289882", x"28C85A", x"28ED40", x"28F9FD",
+         x"28EEE4", x"28D9B9", x"28CE0A", x"28DA31", x"28FF30", x"293005", x"2958EB", x"296A6D",
+         x"29622C", x"294C4E", x"293CBE", x"294401", x"2965DB", x"299717", x"29C3BB", x"29DA3C",
+         x"29D56A", x"29BF76", x"29AC50", x"29AE7D", x"29CC9F", x"29FD9E", x"2A2DAA", x"2A4953",
+         x"2A4882", x"2A3320", x"2A1CC4", x"2A19BC", x"2A3397", x"2A63AB", x"2A96B6", x"2AB79E",
+         x"2ABB58", x"2AA73A", x"2A8E1B", x"2A85D0", x"2A9ADE", x"2AC954", x"2AFEE0", x"2B2509",
+         x"2B2DD0", x"2B1BAE", x"2B0053", x"2AF2CE", x"2B0292", x"2B2EAD", x"2B662C", x"2B9182",
+         x"2B9FCC", x"2B9064", x"2B7367", x"2B60C6", x"2B6AD0", x"2B93D1", x"2BCC9E", x"2BFCFA",
+         x"2C1131", x"2C0544", x"2BE750", x"2BCFC7", x"2BD3B5", x"2BF8D9", x"2C3240", x"2C6761",
+         x"2C81DF", x"2C7A30", x"2C5C04", x"2C3FDE", x"2C3D5E", x"2C5DE3", x"2C971E", x"2CD0AC",
+         x"2CF1BB", x"2CEF0C", x"2CD175", x"2CB117", x"2CA7E9", x"2CC30D", x"2CFB46", x"2D38D1",
+         x"2D60A6", x"2D63B8", x"2D4793", x"2D237B", x"2D1372", x"2D2878", x"2D5EC9", x"2D9FC7",
+         x"2DCE85", x"2DD813", x"2DBE4E", x"2D9711", x"2D8017", x"2D8E44", x"2DC1BA", x"2E0587",
+         x"2E3B3A", x"2E4BFB", x"2E3590", x"2E0BDF", x"2DEDF3", x"2DF495", x"2E242F", x"2E6A0E",
+         x"2EA6A8", x"2EBF4B", x"2EAD43", x"2E81E9", x"2E5D25", x"2E5B8F", x"2E863D", x"2ECD55",
+         x"2F10B4", x"2F31E0", x"2F2551", x"2EF934", x"2ECDC8", x"2EC359", x"2EE7FE", x"2F2F5B",
+         x"2F793E", x"2FA392", x"2F9D9F", x"2F71C3", x"2F3FFC", x"2F2C1A", x"2F498C", x"2F901A",
+         x"2FE028", x"301438", x"301613", x"2FEB9A", x"2FB3E2", x"2F95FD", x"2FAB00", x"2FEF8E",
+         x"30454D", x"3083A5", x"308E94", x"3066C2", x"30299F", x"300130", x"300C76", x"304DAD",
+         x"30A886", x"30F1AA", x"310705", x"30E345", x"30A161", x"306DE5", x"306E07", x"30AA67",
+         x"3109A0", x"315E0F", x"317F4D", x"316137", x"311B5D", x"30DC58", x"30CFCF", x"3105A4",
+         x"31685F", x"31C897", x"31F754", x"31E0B8", x"3197DC", x"314CCE", x"3131E5", x"315F3D",
+         x"31C46E", x"3230F2", x"326F00", x"3261F9", x"321740", x"31BF9E", x"31945E", x"31B6F1",
+         x"321D58", x"3296BD", x"32E641", x"32E54D", x"329A15", x"32353E", x"31F74C", x"320C5B",
+         x"327275", x"32F96F", x"335D07", x"336B34", x"332129", x"32AE4E", x"325AB7", x"325ED2",
+         x"32C2C4", x"335845", x"33D34F", x"33F485", x"33ADC0", x"332BBF", x"32BE9B", x"32AD43",
+         x"330CAB", x"33B214", x"344929", x"3482AB", x"3441E8", x"33AF0D", x"3322DB", x"32F5CD",
+         x"334D78", x"3404EF", x"34BEC9", x"35182D", x"34E13A", x"343AC0", x"338720", x"3334F8",
+         x"338045", x"344D6E", x"3534B8", x"35B9E6", x"35928C", x"34D391", x"33EA8A", x"3363C0",
+         x"339B40", x"3484D2", x"35AC6B", x"367258", x"36647E", x"358379", x"344A97", x"3371BB",
+         x"33879C", x"349BB4", x"362A78", x"375CAB", x"377CBB", x"3663A0", x"349E30", x"332E68",
+         x"33022D", x"3465EC", x"36C321", x"38D950", x"3960C3", x"37C981", x"34AF73", x"31B7A1",
+         x"30D110", x"332561", x"3838F7", x"3DB2C3", x"3FFFFF", x"3BA425", x"2EB028", x"19BECA"),
+        -- octave 3
+        (x"000000", x"F2C39E", x"E62D02", x"DAD364", x"D13267", x"C99FED", x"C445D6", x"C12031",
+         x"C00001", x"C09224", x"C2697F", x"C50B3F", x"C7FBC2", x"CACAC4", x"CD1D86", x"CEB5E8",
+         x"CF75E1", x"CF5F27", x"CE8F4E", x"CD390F", x"CB9BAB", x"C9F995", x"C88F8A", x"C78D24",
+         x"C70FB8", x"C71FF6", x"C7B265", x"C8AA7A", x"C9DFBE", x"CB241E", x"CC4A9F", x"CD2D6D",
+         x"CDB29C", x"CDCEF7", x"CD86A8", x"CCEBBE", x"CC1ADE", x"CB36AF", x"CA62B1", x"C9BE3E",
+         x"C96059", x"C954E5", x"C99B81", x"CA282C", x"CAE584", x"CBB834", x"CC8313", x"CD2B5B",
+         x"CD9C56", x"CDCA0D", x"CDB29E", x"CD5E16", x"CCDCEE", x"CC455E", x"CBAFF8", x"CB3419",
+         x"CAE49E", x"CACD5C", x"CAF1AE", x"CB4C4B", x"CBD04B", x"CC6B47", x"CD0825", x"CD9233",
+         x"CDF81A", x"CE2E40", x"CE3043", x"CE0161", x"CDABC8", x"CD3EEB", x"CCCD25", x"CC68FD",
+         x"CC2284", x"CC050D", x"CC15B8", x"CC52DA", x"CCB46B", x"CD2D58", x"CDAD86", x"CE2438",
+         x"CE827B", x"CEBD42", x"CECEE4", x"CEB7CD", x"CE7E46", x"CE2D6C", x"CDD378", x"CD7F9F",
+         x"CD3FDB", x"CD1EEE", x"CD22E9", x"CD4C62", x"CD9683", x"CDF7D6", x"CE63BD", x"CECC5A",
+         x"CF248E", x"CF61E5", x"CF7E00", x"CF7774", x"CF51DF", x"CF154D", x"CECCF4", x"CE8588",
+         x"CE4B5B", x"CE2897", x"CE23D4", x"CE3F2D", x"CE7810", x"CEC7AD", x"CF2409", x"CF817D",
+         x"CFD472", x"D01308", x"D0367F", x"D03C26", x"D025AA", x"CFF8C5", x"CFBE57", x"CF8113",
+         x"CF4BE6", x"CF2863", x"CF1D65", x"CF2E1C", x"CF59A4", x"CF9B3A", x"CFEAFB", x"D03F13",
+         x"D08D36", x"D0CC1E", x"D0F4DD", x"D103DB", x"D0F949", x"D0D90E", x"D0AA28", x"D0759C",
+         x"D0451E", x"D021A8", x"D01230", x"D01AA8", x"D03B7C", x"D0718A", x"D0B6A9", x"D10291",
+         x"D14C1F", x"D18AA5", x"D1B72D", x"D1CD7A", x"D1CC94", x"D1B6EA", x"D191E4", x"D16515",
+         x"D1391A", x"D11652", x"D103AB", x"D105A5", x"D11DB1", x"D14A05", x"D185EA", x"D1CA75",
+         x"D20F8E", x"D24D22", x"D27C50", x"D29863", x"D29F7D", x"D292D3", x"D27675", x"D250B2",
+         x"D22921", x"D20788", x"D1F2B7", x"D1EF8D", x"D2004A", x"D22442", x"D257FF", x"D295C7",
+         x"D2D67C", x"D312A9", x"D34393", x"D36439", x"D37203", x"D36D21", x"D3587B", x"D3393A",
+         x"D31607", x"D2F609", x"D2DFE0", x"D2D8A8", x"D2E345", x"D2FFF9", x"D32C64", x"D363E3",
+         x"D3A040", x"D3DAA1", x"D40C88", x"D430C3", x"D4442B", x"D44614", x"D43862", x"D41F36",
+         x"D40058", x"D3E252", x"D3CB80", x"D3C121", x"D3C698", x"D3DCF0", x"D402BD", x"D43456",
+         x"D46C62", x"D4A4A4", x"D4D6E6", x"D4FDE2", x"D51600", x"D51DDE", x"D5167A", x"D50308",
+         x"D4E877", x"D4CCB6", x"D4B5D0", x"D4A90F", x"D4AA37", x"D4BAFB", x"D4DAC5", x"D506CF",
+         x"D53A90", x"D5706B", x"D5A27E", x"D5CB83", x"D5E790", x"D5F4A8", x"D5F301", x"D5E4F6",
+         x"D5CEAB", x"D5B570", x"D59EF7", x"D59080", x"D58E15", x"D599F4", x"D5B443", x"D5DB0D",
+         x"D60A8E", x"D63DC5", x"D66F31", x"D6999F", x"D6B8E9", x"D6CA95", x"D6CE28", x"D6C537",
+         x"D6B327", x"D69CA9", x"D6870E", x"D67778", x"D67221", x"D679B9", x"D68F0C", x"D6B0E0",
+         x"D6DC2E", x"D70C90", x"D73CED", x"D76833", x"D78A1C", x"D79FC5", x"D7A819", x"D7A3F9",
+         x"D79614", x"D78281", x"D76E24", x"D75DF6", x"D7564A", x"D75A2E", x"D76AF9", x"D78821",
+         x"D7AF4D", x"D7DCB1", x"D80BA3", x"D83744", x"D85B3B", x"D87453", x"D880F6", x"D8815F",
+         x"D87791", x"D8670D", x"D85444", x"D843F6", x"D83A80", x"D83B36", x"D847EA", x"D860AD",
+         x"D883CC", x"D8AE14", x"D8DB4D", x"D906D6", x"D92C55", x"D9485C", x"D958DF", x"D95D88",
+         x"D957BB", x"D94A5E", x"D93972", x"D92971", x"D91EB0", x"D91CB7", x"D925C0", x"D93A67",
+         x"D95995", x"D980AA", x"D9ABE6", x"D9D6F0", x"D9FD7F", x"DA1BF7", x"DA2FF1", x"DA3892",
+         x"DA36A6", x"DA2C84", x"DA1DB2", x"DA0E60", x"DA02CA", x"D9FE99", x"DA045F", x"DA1534",
+         x"DA3091", x"DA5466", x"DA7D6B", x"DAA79A", x"DACEC8", x"DAEF3E", x"DB0648", x"DB1295",
+         x"DB1468", x"DB0D8A", x"DB0107", x"DAF2BA", x"DAE6BA", x"DAE0C4", x"DAE3AD", x"DAF0FA",
+         x"DB08AC", x"DB293C", x"DB4FDC", x"DB78DE", x"DBA042", x"DBC247", x"DBDBFC", x"DBEBAB",
+         x"DBF114", x"DBED7C", x"DBE372", x"DBD677", x"DBCA71", x"DBC321", x"DBC390", x"DBCDA4",
+         x"DBE1D4", x"DBFF21", x"DC2336", x"DC4AC3", x"DC71FE", x"DC9529", x"DCB127", x"DCC3E9",
+         x"DCCCBC", x"DCCC63", x"DCC4F4", x"DCB98E", x"DCADDE", x"DCA59A", x"DCA3F1", x"DCAB18",
+         x"DCBBF7", x"DCD60B", x"DCF778", x"DD1D52", x"DD440B", x"DD67FA", x"DD85E1", x"DD9B67",
+         x"DDA772", x"DDAA4A", x"DDA58E", x"DD9BF8", x"DD90F2", x"DD881A", x"DD84B8", x"DD8942",
+         x"DD9704", x"DDADF0", x"DDCCA1", x"DDF092", x"DE167A", x"DE3ACE", x"DE5A40", x"DE723C",
+         x"DE8148", x"DE873C", x"DE8543", x"DE7DAD", x"DE739D", x"DE6A8D", x"DE65CD", x"DE680A",
+         x"DE72E7", x"DE86C4", x"DEA2AE", x"DEC488", x"DEE958", x"DF0DBA", x"DF2E5B", x"DF487C",
+         x"DF5A50", x"DF6345", x"DF6415", x"DF5EA9", x"DF55D3", x"DF4CDF", x"DF471B", x"DF475C",
+         x"DF4F90", x"DF607C", x"DF799C", x"DF993B", x"DFBCB3", x"DFE0D0", x"E00249", x"E01E3D",
+         x"E0329B", x"E03E70", x"E04209", x"E03EE7", x"E03786", x"E02EFD", x"E0288D", x"E02722",
+         x"E02CEC", x"E03B0C", x"E05166", x"E06EAE", x"E09095", x"E0B421", x"E0D61E", x"E0F396",
+         x"E10A3C", x"E118C9", x"E11F23", x"E11E63", x"E118AC", x"E110D8", x"E10A0C", x"E10746",
+         x"E10AE9", x"E11666", x"E12A06", x"E144E4", x"E1650A", x"E187BF", x"E1A9EF", x"E1C89A",
+         x"E1E147", x"E1F25F", x"E1FB6A", x"E1FD1B", x"E1F93B", x"E1F25D", x"E1EB86", x"E1E7B4",
+         x"E1E973", x"E1F27C", x"E20376", x"E21BDD", x"E23A19", x"E25BBA", x"E27DD0", x"E29D5F",
+         x"E2B7CD", x"E2CB40", x"E2D6E5", x"E2DB10", x"E2D92B", x"E2D380", x"E2CCE7", x"E2C857",
+         x"E2C878", x"E2CF41", x"E2DDAD", x"E2F39A", x"E30FCC", x"E3301E", x"E351D2", x"E371FA",
+         x"E38DE2", x"E3A37A", x"E3B19E", x"E3B842", x"E3B875", x"E3B432", x"E3AE1D", x"E3A91B",
+         x"E3A7E4", x"E3ACA4", x"E3B8A3", x"E3CC19", x"E3E627", x"E404F9", x"E42608", x"E4467D",
+         x"E46399", x"E47B1E", x"E48B9D", x"E494B4", x"E49714", x"E49468", x"E48F17", x"E489EB",
+         x"E487A5", x"E48A96", x"E4944B", x"E4A555", x"E4BD2F", x"E4DA55", x"E4FA82", x"E51AFD",
+         x"E53907", x"E5523B", x"E564EF", x"E5706B", x"E57505", x"E57416", x"E56FC6", x"E56AB6",
+         x"E567A6", x"E56905", x"E5709C", x"E57F4B", x"E594E5", x"E5B03D", x"E5CF4F", x"E5EF8C",
+         x"E60E3C", x"E628E4", x"E63DA0", x"E64B6B", x"E65246", x"E65336", x"E6501A", x"E64B69",
+         x"E647D4", x"E647E0", x"E64D88", x"E659F3", x"E66D4C", x"E686B9", x"E6A47E", x"E6C43C",
+         x"E6E34E", x"E6FF29", x"E715BC", x"E725BC", x"E72ED8", x"E731BE", x"E73006", x"E72BF2",
+         x"E7281E", x"E72716", x"E72B00", x"E73546", x"E74662", x"E75DCE", x"E77A1A", x"E7991E",
+         x"E7B84F", x"E7D51C", x"E7ED52", x"E7FF67", x"E80ABC", x"E80FAA", x"E80F7F", x"E80C42",
+         x"E8086F", x"E80695", x"E808F8", x"E8113B", x"E82024", x"E83581", x"E8502E", x"E86E41",
+         x"E88D4F", x"E8AAD0", x"E8C471", x"E8D876", x"E8E5F4", x"E8ECF7", x"E8EE7A", x"E8EC49",
+         x"E8E8B8", x"E8E64B", x"E8E75F", x"E8EDC6", x"E8FA8F", x"E90DD6", x"E926C5", x"E943B3",
+         x"E96263", x"E98055", x"E99B29", x"E9B0F3", x"E9C087", x"E9C9A1", x"E9CCEF", x"E9CBF9",
+         x"E9C8E5", x"E9C627", x"E9C625", x"E9CADD", x"E9D59D", x"E9E6CD", x"E9FDE6", x"EA1984",
+         x"EA3799", x"EA55BE", x"EA7189", x"EA88EB", x"EA9A7B", x"EAA5A9", x"EAAAD7", x"EAAB46",
+         x"EAA8E7", x"EAA615", x"EAA53A", x"EAA873", x"EAB146", x"EAC066", x"EAD597", x"EAEFBD",
+         x"EB0D02", x"EB2B1C", x"EB47A3", x"EB606B", x"EB73D7", x"EB8111", x"EB882D", x"EB8A24",
+         x"EB88AF", x"EB8606", x"EB848D", x"EB867A", x"EB8D83", x"EB9A9E", x"EBADDC", x"EBC66A",
+         x"EBE2AD", x"EC0081", x"EC1D87", x"EC3781", x"EC4CA4", x"EC5BDA", x"EC64EC", x"EC688A",
+         x"EC682E", x"EC65E8", x"EC640E", x"EC64E4", x"EC6A49", x"EC7572", x"EC86B9", x"EC9D94",
+         x"ECB8A8", x"ECD5FC", x"ECF346", x"ED0E3C", x"ED24ED", x"ED360A", x"ED4113", x"ED466F",
+         x"ED4757", x"ED45AB", x"ED43AB", x"ED43A1", x"ED478E", x"ED50DD", x"ED602E", x"ED7542",
+         x"ED8EFF", x"EDAB9F", x"EDC8F1", x"EDE4AB", x"EDFCBE", x"EE0FA6", x"EE1CA2", x"EE23CD",
+         x"EE261E", x"EE253F", x"EE2353", x"EE22A2", x"EE2545", x"EE2CD7", x"EE3A3B", x"EE4D79",
+         x"EE65BD", x"EE8178", x"EE9E99", x"EEBADE", x"EED423", x"EEE8B7", x"EEF79A", x"EF009F",
+         x"EF0478", x"EF0496", x"EF02F7", x"EF01D7", x"EF0361", x"EF0959", x"EF14DE", x"EF263F",
+         x"EF3CED", x"EF5795", x"EF744F", x"EF90E5", x"EFAB2A", x"EFC145", x"EFD1FD", x"EFDCE2",
+         x"EFE25C", x"EFE3A2", x"EFE285", x"EFE130", x"EFE1D4", x"EFE658", x"EFF013", x"EFFF94",
+         x"F01496", x"F02E03", x"F04A20", x"F066D1", x"F081E0", x"F0995B", x"F0ABD2", x"F0B893",
+         x"F0BFC4", x"F0C257", x"F0C1EF", x"F0C09C", x"F0C090", x"F0C3CB", x"F0CBD4", x"F0D97B",
+         x"F0ECC0", x"F104CE", x"F1201E", x"F13CB0", x"F15856", x"F17103", x"F1851D", x"F193B4",
+         x"F19CA7", x"F1A0AA", x"F1A126", x"F1A00D", x"F19F86", x"F1A1A5", x"F1A81B", x"F1B3F3",
+         x"F1C570", x"F1DC00", x"F1F656", x"F21294", x"F22E99", x"F2484A", x"F25DE7", x"F26E46",
+         x"F27904", x"F27E90", x"F2801D", x"F27F71", x"F27EA6", x"F27FDA", x"F284DF", x"F28EF8",
+         x"F29EA9", x"F2B3A4", x"F2CCD5", x"F2E88C", x"F304BA", x"F31F3E", x"F33637", x"F3484B",
+         x"F354D5", x"F35C01", x"F35EC5", x"F35EB9", x"F35DE1", x"F35E5B", x"F36217", x"F36A87",
+         x"F3786D", x"F38BBF", x"F3A3A8", x"F3BEA7", x"F3DAC7", x"F3F5EB", x"F40E19", x"F421C9",
+         x"F4301B", x"F438F7", x"F43D14", x"F43DD7", x"F43D27", x"F43D1C", x"F43FB8", x"F4469A",
+         x"F452BD", x"F4645A", x"F47ADB", x"F494F4", x"F4B0D2", x"F4CC61", x"F4E598", x"F4FAC7",
+         x"F50AD6", x"F5156C", x"F51AFE", x"F51CBD", x"F51C68", x"F51C0D", x"F51DB7", x"F5232A",
+         x"F52D97", x"F53D77", x"F55275", x"F56B7F", x"F586E8", x"F5A2AE", x"F5BCBF", x"F5D34B",
+         x"F5E508", x"F5F15C", x"F5F87C", x"F5FB5E", x"F5FB96", x"F5FB1E", x"F5FC07", x"F6002F",
+         x"F608F9", x"F6171B", x"F62A82", x"F64256", x"F65D19", x"F678E1", x"F6939B", x"F6AB60",
+         x"F6BEB4", x"F6CCC5", x"F6D584", x"F6D9AD", x"F6DAA2", x"F6DA42", x"F6DA9B", x"F6DD9F",
+         x"F6E4DE", x"F6F146", x"F70306", x"F71984", x"F73374", x"F74F0A", x"F76A3B", x"F7830E",
+         x"F797E0", x"F7A7A6", x"F7B212", x"F7B79F", x"F7B97D", x"F7B969", x"F7B964", x"F7BB70",
+         x"F7C140", x"F7CBF9", x"F7DC08", x"F7F114", x"F80A06", x"F82538", x"F840AD", x"F85A61",
+         x"F87092", x"F88200", x"F88E1F", x"F8952A", x"F8981B", x"F89883", x"F89854", x"F89995",
+         x"F89E17", x"F8A731", x"F8B58C", x"F8C90F", x"F8E0DD", x"F8FB79", x"F916FF", x"F93166",
+         x"F948D2", x"F95BD6", x"F969A9", x"F97247", x"F9766E", x"F97782", x"F9775D", x"F97803",
+         x"F97B5C", x"F982EC", x"F98F95", x"F9A17D", x"F9B804", x"F9D1DD", x"F9ED40", x"FA082A",
+         x"FA20AA", x"FA352C", x"FA44AE", x"FA4EEE", x"FA546B", x"FA5658", x"FA566E", x"FA56AB",
+         x"FA5905", x"FA5F24", x"FA6A22", x"FA7A63", x"FA8F86", x"FAA871", x"FAC37F", x"FADEBA",
+         x"FAF824", x"FB0E07", x"FB1F2F", x"FB2B19", x"FB3207", x"FB34F7", x"FB357B", x"FB3580",
+         x"FB3706", x"FB3BD3", x"FB4534", x"FB53C8", x"FB676D", x"FB7F43", x"FB99CB", x"FBB524",
+         x"FBCF4C", x"FBE66F", x"FBF92C", x"FC06C3", x"FC0F3A", x"FC1352", x"FC1473", x"FC1474",
+         x"FC1553", x"FC18F2", x"FC20C8", x"FC2DAE", x"FC3FC3", x"FC565F", x"FC7032", x"FC8B76",
+         x"FCA62D", x"FCBE6C", x"FCD2A8", x"FCE1EC", x"FCEBFB", x"FCF15D", x"FCF349", x"FCF377",
+         x"FCF3E1", x"FCF677", x"FCFCDA", x"FD0818", x"FD188D", x"FD2DD0", x"FD46C4", x"FD61C1",
+         x"FD7CD4", x"FD9607", x"FDABAA", x"FDBC91", x"FDC844", x"FDCF0D", x"FDD1EE", x"FDD27B",
+         x"FDD2A1", x"FDD459", x"FDD964", x"FDE305", x"FDF1D2", x"FE05A1", x"FE1D8C", x"FE3812",
+         x"FE5351", x"FE6D4C", x"FE8435", x"FE96B3", x"FEA410", x"FEAC58", x"FEB055", x"FEB172",
+         x"FEB185", x"FEB28C", x"FEB661", x"FEBE74", x"FECB96", x"FEDDDC", x"FEF498", x"FF0E78",
+         x"FF29B0", x"FF4445", x"FF5C53", x"FF7054", x"FF7F5B", x"FF8936", x"FF8E72", x"FF904C",
+         x"FF907F", x"FF9104", x"FF93C7", x"FF9A62", x"FFA5DC", x"FFB688", x"FFCBF5", x"FFE501",
+         x"000000", x"001AFF", x"00340B", x"004978", x"005A24", x"00659E", x"006C39", x"006EFC",
+         x"006F81", x"006FB4", x"00718E", x"0076CA", x"0080A5", x"008FAC", x"00A3AD", x"00BBBB",
+         x"00D650", x"00F188", x"010B68", x"012224", x"01346A", x"01418C", x"01499F", x"014D74",
+         x"014E7B", x"014E8E", x"014FAB", x"0153A8", x"015BF0", x"01694D", x"017BCB", x"0192B4",
+         x"01ACAF", x"01C7EE", x"01E274", x"01FA5F", x"020E2E", x"021CFB", x"02269C", x"022BA7",
+         x"022D5F", x"022D85", x"022E12", x"0230F3", x"0237BC", x"02436F", x"025456", x"0269F9",
+         x"02832C", x"029E3F", x"02B93C", x"02D230", x"02E773", x"02F7E8", x"030326", x"030989",
+         x"030C1F", x"030C89", x"030CB7", x"030EA3", x"031405", x"031E14", x"032D58", x"034194",
+         x"0359D3", x"03748A", x"038FCE", x"03A9A1", x"03C03D", x"03D252", x"03DF38", x"03E70E",
+         x"03EAAD", x"03EB8C", x"03EB8D", x"03ECAE", x"03F0C6", x"03F93D", x"0406D4", x"041991",
+         x"0430B4", x"044ADC", x"046635", x"0480BD", x"049893", x"04AC38", x"04BACC", x"04C42D",
+         x"04C8FA", x"04CA80", x"04CA85", x"04CB09", x"04CDF9", x"04D4E7", x"04E0D1", x"04F1F9",
+         x"0507DC", x"052146", x"053C81", x"05578F", x"05707A", x"05859D", x"0595DE", x"05A0DC",
+         x"05A6FB", x"05A955", x"05A992", x"05A9A8", x"05AB95", x"05B112", x"05BB52", x"05CAD4",
+         x"05DF56", x"05F7D6", x"0612C0", x"062E23", x"0647FC", x"065E83", x"06706B", x"067D14",
+         x"0684A4", x"0687FD", x"0688A3", x"06887E", x"068992", x"068DB9", x"069657", x"06A42A",
+         x"06B72E", x"06CE9A", x"06E901", x"070487", x"071F23", x"0736F1", x"074A74", x"0758CF",
+         x"0761E9", x"07666B", x"0767AC", x"07677D", x"0767E5", x"076AD6", x"0771E1", x"077E00",
+         x"078F6E", x"07A59F", x"07BF53", x"07DAC8", x"07F5FA", x"080EEC", x"0823F8", x"083407",
+         x"083EC0", x"084490", x"08469C", x"084697", x"084683", x"084861", x"084DEE", x"08585A",
+         x"086820", x"087CF2", x"0895C5", x"08B0F6", x"08CC8C", x"08E67C", x"08FCFA", x"090EBA",
+         x"091B22", x"092261", x"092565", x"0925BE", x"09255E", x"092653", x"092A7C", x"09333B",
+         x"09414C", x"0954A0", x"096C65", x"09871F", x"09A2E7", x"09BDAA", x"09D57E", x"09E8E5",
+         x"09F707", x"09FFD1", x"0A03F9", x"0A04E2", x"0A046A", x"0A04A2", x"0A0784", x"0A0EA4",
+         x"0A1AF8", x"0A2CB5", x"0A4341", x"0A5D52", x"0A7918", x"0A9481", x"0AAD8B", x"0AC289",
+         x"0AD269", x"0ADCD6", x"0AE249", x"0AE3F3", x"0AE398", x"0AE343", x"0AE502", x"0AEA94",
+         x"0AF52A", x"0B0539", x"0B1A68", x"0B339F", x"0B4F2E", x"0B6B0C", x"0B8525", x"0B9BA6",
+         x"0BAD43", x"0BB966", x"0BC048", x"0BC2E4", x"0BC2D9", x"0BC229", x"0BC2EC", x"0BC709",
+         x"0BCFE5", x"0BDE37", x"0BF1E7", x"0C0A15", x"0C2539", x"0C4159", x"0C5C58", x"0C7441",
+         x"0C8793", x"0C9579", x"0C9DE9", x"0CA1A5", x"0CA21F", x"0CA147", x"0CA13B", x"0CA3FF",
+         x"0CAB2B", x"0CB7B5", x"0CC9C9", x"0CE0C2", x"0CFB46", x"0D1774", x"0D332B", x"0D4C5C",
+         x"0D6157", x"0D7108", x"0D7B21", x"0D8026", x"0D815A", x"0D808F", x"0D7FE3", x"0D8170",
+         x"0D86FC", x"0D91BA", x"0DA219", x"0DB7B6", x"0DD167", x"0DED6C", x"0E09AA", x"0E2400",
+         x"0E3A90", x"0E4C0D", x"0E57E5", x"0E5E5B", x"0E607A", x"0E5FF3", x"0E5EDA", x"0E5F56",
+         x"0E6359", x"0E6C4C", x"0E7AE3", x"0E8EFD", x"0EA7AA", x"0EC350", x"0EDFE2", x"0EFB32",
+         x"0F1340", x"0F2685", x"0F342C", x"0F3C35", x"0F3F70", x"0F3F64", x"0F3E11", x"0F3DA9",
+         x"0F403C", x"0F476D", x"0F542E", x"0F66A5", x"0F7E20", x"0F992F", x"0FB5E0", x"0FD1FD",
+         x"0FEB6A", x"10006C", x"100FED", x"1019A8", x"101E2C", x"101ED0", x"101D7B", x"101C5E",
+         x"101DA4", x"10231E", x"102E03", x"103EBB", x"1054D6", x"106F1B", x"108BB1", x"10A86B",
+         x"10C313", x"10D9C1", x"10EB22", x"10F6A7", x"10FC9F", x"10FE29", x"10FD09", x"10FB6A",
+         x"10FB88", x"10FF61", x"110866", x"111749", x"112BDD", x"114522", x"116167", x"117E88",
+         x"119A43", x"11B287", x"11C5C5", x"11D329", x"11DABB", x"11DD5E", x"11DCAD", x"11DAC1",
+         x"11D9E2", x"11DC33", x"11E35E", x"11F05A", x"120342", x"121B55", x"12370F", x"125461",
+         x"127101", x"128ABE", x"129FD2", x"12AF23", x"12B872", x"12BC5F", x"12BC55", x"12BA55",
+         x"12B8A9", x"12B991", x"12BEED", x"12C9F6", x"12DB13", x"12F1C4", x"130CBA", x"132A04",
+         x"134758", x"13626C", x"137947", x"138A8E", x"1395B7", x"139B1C", x"139BF2", x"139A18",
+         x"1397D2", x"139776", x"139B14", x"13A426", x"13B35C", x"13C87F", x"13E279", x"13FF7F",
+         x"141D53", x"143996", x"145224", x"146562", x"14727D", x"147986", x"147B73", x"1479FA",
+         x"147751", x"1475DC", x"1477D3", x"147EEF", x"148C29", x"149F95", x"14B85D", x"14D4E4",
+         x"14F2FE", x"151043", x"152A69", x"153F9A", x"154EBA", x"15578D", x"155AC6", x"1559EB",
+         x"155719", x"1554BA", x"155529", x"155A57", x"156585", x"157715", x"158E77", x"15AA42",
+         x"15C867", x"15E67C", x"16021A", x"161933", x"162A63", x"163523", x"1639DB", x"1639D9",
+         x"16371B", x"163407", x"163311", x"16365F", x"163F79", x"164F0D", x"1664D7", x"167FAB",
+         x"169D9D", x"16BC4D", x"16D93B", x"16F22A", x"170571", x"17123A", x"1718A1", x"1719B5",
+         x"171748", x"1713B7", x"171186", x"171309", x"171A0C", x"17278A", x"173B8F", x"175530",
+         x"1772B1", x"1791BF", x"17AFD2", x"17CA7F", x"17DFDC", x"17EEC5", x"17F708", x"17F96B",
+         x"17F791", x"17F3BE", x"17F081", x"17F056", x"17F544", x"180099", x"1812AE", x"182AE4",
+         x"1847B1", x"1866E2", x"1885E6", x"18A232", x"18B99E", x"18CABA", x"18D500", x"18D8EA",
+         x"18D7E2", x"18D40E", x"18CFFA", x"18CE42", x"18D128", x"18DA44", x"18EA44", x"1900D7",
+         x"191CB2", x"193BC4", x"195B82", x"197947", x"1992B4", x"19A60D", x"19B278", x"19B820",
+         x"19B82C", x"19B497", x"19AFE6", x"19ACCA", x"19ADBA", x"19B495", x"19C260", x"19D71C",
+         x"19F1C4", x"1A1074", x"1A30B1", x"1A4FC3", x"1A6B1B", x"1A80B5", x"1A8F64", x"1A96FB",
+         x"1A985A", x"1A954A", x"1A903A", x"1A8BEA", x"1A8AFB", x"1A8F95", x"1A9B11", x"1AADC5",
+         x"1AC6F9", x"1AE503", x"1B057E", x"1B25AB", x"1B42D1", x"1B5AAB", x"1B6BB5", x"1B756A",
+         x"1B785B", x"1B7615", x"1B70E9", x"1B6B98", x"1B68EC", x"1B6B4C", x"1B7463", x"1B84E2",
+         x"1B9C67", x"1BB983", x"1BD9F8", x"1BFB07", x"1C19D9", x"1C33E7", x"1C475D", x"1C535C",
+         x"1C581C", x"1C56E5", x"1C51E3", x"1C4BCE", x"1C478B", x"1C47BE", x"1C4E62", x"1C5C86",
+         x"1C721E", x"1C8E06", x"1CAE2E", x"1CCFE2", x"1CF034", x"1D0C66", x"1D2253", x"1D30BF",
+         x"1D3788", x"1D37A9", x"1D3319", x"1D2C80", x"1D26D5", x"1D24F0", x"1D291B", x"1D34C0",
+         x"1D4833", x"1D62A1", x"1D8230", x"1DA446", x"1DC5E7", x"1DE423", x"1DFC8A", x"1E0D84",
+         x"1E168D", x"1E184C", x"1E147A", x"1E0DA3", x"1E06C5", x"1E02E5", x"1E0496", x"1E0DA1",
+         x"1E1EB9", x"1E3766", x"1E5611", x"1E7841", x"1E9AF6", x"1EBB1C", x"1ED5FA", x"1EE99A",
+         x"1EF517", x"1EF8BA", x"1EF5F4", x"1EEF28", x"1EE754", x"1EE19D", x"1EE0DD", x"1EE737",
+         x"1EF5C4", x"1F0C6A", x"1F29E2", x"1F4BDF", x"1F6F6B", x"1F9152", x"1FAE9A", x"1FC4F4",
+         x"1FD314", x"1FD8DE", x"1FD773", x"1FD103", x"1FC87A", x"1FC119", x"1FBDF7", x"1FC190",
+         x"1FCD65", x"1FE1C3", x"1FFDB7", x"201F30", x"20434D", x"2066C5", x"208664", x"209F84",
+         x"20B070", x"20B8A4", x"20B8E5", x"20B321", x"20AA2D", x"20A157", x"209BEB", x"209CBB",
+         x"20A5B0", x"20B784", x"20D1A5", x"20F246", x"2116A8", x"213B78", x"215D52", x"21793C",
+         x"218D19", x"2197F6", x"219A33", x"219573", x"218C63", x"218253", x"217ABD", x"2178C4",
+         x"217EB8", x"218DC4", x"21A5C0", x"21C532", x"21E986", x"220F6E", x"22335F", x"225210",
+         x"2268FC", x"2276BE", x"227B48", x"2277E6", x"226F0E", x"226408", x"225A72", x"2255B6",
+         x"22588E", x"226499", x"227A1F", x"229806", x"22BBF5", x"22E2AE", x"230888", x"2329F5",
+         x"234409", x"2354E8", x"235C0F", x"235A66", x"235222", x"234672", x"233B0C", x"23339D",
+         x"233344", x"233C17", x"234ED9", x"236AD7", x"238E02", x"23B53D", x"23DCCA", x"2400DF",
+         x"241E2C", x"24325C", x"243C70", x"243CDF", x"24358F", x"242989", x"241C8E", x"241284",
+         x"240EEC", x"241455", x"242404", x"243DB9", x"245FBE", x"248722", x"24B024", x"24D6C4",
+         x"24F754", x"250F06", x"251C53", x"251F3C", x"251946", x"250D46", x"24FEF9", x"24F276",
+         x"24EB98", x"24ED6B", x"24F9B8", x"2510C2", x"253138", x"255866", x"258295", x"25AB9A",
+         x"25CF6F", x"25EACC", x"25FBA1", x"260167", x"25FD36", x"25F1A0", x"25E24E", x"25D37C",
+         x"25C95A", x"25C76E", x"25D00F", x"25E409", x"260281", x"262910", x"26541A", x"267F56",
+         x"26A66B", x"26C599", x"26DA40", x"26E349", x"26E150", x"26D68F", x"26C68E", x"26B5A2",
+         x"26A845", x"26A278", x"26A721", x"26B7A4", x"26D3AB", x"26F92A", x"2724B3", x"2751EC",
+         x"277C34", x"279F53", x"27B816", x"27C4CA", x"27C580", x"27BC0A", x"27ABBC", x"2798F3",
+         x"27886F", x"277EA1", x"277F0A", x"278BAD", x"27A4C5", x"27C8BC", x"27F45D", x"28234F",
+         x"2850B3", x"2877DF", x"289507", x"28A5D2", x"28A9B6", x"28A20A", x"2891DC", x"287D7F",
+         x"2869EC", x"285C07", x"2857E7", x"28603B", x"2875E4", x"2897CD", x"28C313", x"28F370",
+         x"2923D2", x"294F20", x"2970F4", x"298647", x"298DDF", x"298888", x"2978F2", x"296357",
+         x"294CD9", x"293AC9", x"2931D8", x"29356B", x"294717", x"296661", x"2990CF", x"29C23B",
+         x"29F572", x"2A24F3", x"2A4BBD", x"2A660C", x"2A71EB", x"2A6F80", x"2A6109", x"2A4A90",
+         x"2A3155", x"2A1B0A", x"2A0CFF", x"2A0B58", x"2A1870", x"2A347D", x"2A5D82", x"2A8F95",
+         x"2AC570", x"2AF931", x"2B253B", x"2B4505", x"2B55C9", x"2B56F1", x"2B4A30", x"2B334A",
+         x"2B1789", x"2AFCF8", x"2AE986", x"2AE222", x"2AEA00", x"2B021E", x"2B291A", x"2B5B5C",
+         x"2B939E", x"2BCBAA", x"2BFD43", x"2C2310", x"2C3968", x"2C3EDF", x"2C3480", x"2C1DAE",
+         x"2BFFA8", x"2BE0CA", x"2BC79E", x"2BB9EC", x"2BBBD5", x"2BCF3D", x"2BF378", x"2C255F",
+         x"2C5FC0", x"2C9C1D", x"2CD39C", x"2D0007", x"2D1CBB", x"2D2758", x"2D2020", x"2D09F7",
+         x"2CE9F9", x"2CC6C6", x"2CA785", x"2C92DF", x"2C8DFD", x"2C9BC7", x"2CBC6D", x"2CED57",
+         x"2D2984", x"2D6A39", x"2DA801", x"2DDBBE", x"2DFFB6", x"2E1073", x"2E0D49", x"2DF878",
+         x"2DD6DF", x"2DAF4E", x"2D898B", x"2D6D2D", x"2D6083", x"2D679D", x"2D83B0", x"2DB2DE",
+         x"2DF072", x"2E358B", x"2E7A16", x"2EB5FB", x"2EE24F", x"2EFA5B", x"2EFC55", x"2EE9AE",
+         x"2EC6E6", x"2E9AEB", x"2E6E1C", x"2E4916", x"2E336C", x"2E3286", x"2E48D3", x"2E755B",
+         x"2EB3E1", x"2EFD6F", x"2F4957", x"2F8E76", x"2FC484", x"2FE558", x"2FEDD0", x"2FDE58",
+         x"2FBAE2", x"2F8A64", x"2F55D8", x"2F26F2", x"2F06B7", x"2EFC25", x"2F0B23", x"2F33E2",
+         x"2F72CA", x"2FC0ED", x"301505", x"3064C6", x"30A65C", x"30D1E4", x"30E29B", x"30D79D",
+         x"30B41A", x"307EED", x"3041A9", x"30073B", x"2FDA56", x"2FC3DA", x"2FC981", x"2FECF8",
+         x"302B8E", x"307E83", x"30DBF7", x"313853", x"3187F0", x"31C0D3", x"31DC2C", x"31D769",
+         x"31B4A5", x"317A78", x"31330C", x"30EAB3", x"30AE21", x"30888C", x"308200", x"309E1B",
+         x"30DB72", x"3133A6", x"319C43", x"32082A", x"32697D", x"32B39E", x"32DD17", x"32E112",
+         x"32C025", x"328061", x"322C88", x"31D294", x"3181BA", x"314833", x"31311C", x"3142BE",
+         x"317D85", x"31DBC8", x"32527A", x"32D2A8", x"334B95", x"33AD26", x"33EA48", x"33FAF3",
+         x"33DD7C", x"339703", x"3332DB", x"32C115", x"325438", x"31FE9F", x"31CFBD", x"31D1C0",
+         x"3207E6", x"326DCD", x"32F7DB", x"3394B9", x"342FB5", x"34B3B5", x"350E52", x"3532A4",
+         x"351B62", x"34CBE7", x"345008", x"33BAA2", x"332312", x"32A1EA", x"324D62", x"3235F3",
+         x"3263AA", x"32D4A5", x"337CED", x"3447CC", x"351A7C", x"35D7D4", x"36647F", x"36AB1B",
+         x"369FA7", x"3641C2", x"359D4F", x"34C951", x"33E522", x"331442", x"327958", x"323109",
+         x"324D64", x"32D293", x"33B561", x"34DBE2", x"362042", x"375586", x"384D9B", x"38E00A",
+         x"38F048", x"3872DC", x"377076", x"36066B", x"346455", x"32C6F1", x"3170B2", x"30A0D9",
+         x"308A1F", x"314A18", x"32E27A", x"35353C", x"38043E", x"3AF4C1", x"3D9681", x"3F6DDC",
+         x"3FFFFF", x"3EDFCF", x"3BBA2A", x"366013", x"2ECD99", x"252C9C", x"19D2FE", x"0D3C62"),
+        -- octave 4
+        (x"000000", x"F9594F", x"F2C795", x"EC5F51", x"E6341B", x"E05835", x"DADC27", x"D5CE67",
+         x"D13B0F", x"CD2BA1", x"C9A6DB", x"C6B0A6", x"C44A07", x"C27132", x"C121A5", x"C05459",
+         x"C00001", x"C01951", x"C09358", x"C15FDF", x"C26FCB", x"C3B389", x"C51B6E", x"C69825",
+         x"C81B05", x"C9966E", x"CAFE16", x"CC4746", x"CD6910", x"CE5C74", x"CF1C76", x"CFA622",
+         x"CFF884", x"D01492", x"CFFD09", x"CFB63A", x"CF45D0", x"CEB294", x"CE041D", x"CD4290",
+         x"CC764A", x"CBA7A0", x"CADE90", x"CA2289", x"C97A2B", x"C8EB1B", x"C879DB", x"C829B3",
+         x"C7FC9D", x"C7F343", x"C80D0A", x"C84820", x"C8A198", x"C91593", x"C99F65", x"CA39CC",
+         x"CADF1E", x"CB8984", x"CC332C", x"CCD67F", x"CD6E4F", x"CDF604", x"CE69BD", x"CEC671",
+         x"CF09FE", x"CF333C", x"CF41F9", x"CF36F8", x"CF13E0", x"CEDB28", x"CE8FFB", x"CE3615",
+         x"CDD19F", x"CD6703", x"CCFAC7", x"CC915E", x"CC2F06", x"CBD79E", x"CB8E86", x"CB5687",
+         x"CB31B8", x"CB2176", x"CB2656", x"CB4028", x"CB6DFC", x"CBAE31", x"CBFE84", x"CC5C2F",
+         x"CCC3FD", x"CD3272", x"CDA3E6", x"CE14AB", x"CE812D", x"CEE616", x"CF4065", x"CF8D8D",
+         x"CFCB86", x"CFF8E2", x"D014D0", x"D01F29", x"D01864", x"D00198", x"CFDC67", x"CFAAF4",
+         x"CF6FC6", x"CF2DB1", x"CEE7BD", x"CEA107", x"CE5CA3", x"CE1D83", x"CDE659", x"CDB981",
+         x"CD98ED", x"CD8616", x"CD81ED", x"CD8CD7", x"CDA6AD", x"CDCEBE", x"CE03D8", x"CE4454",
+         x"CE8E2B", x"CEDF06", x"CF3458", x"CF8B74", x"CFE1A7", x"D03454", x"D08107", x"D0C58E",
+         x"D1000B", x"D12F05", x"D15175", x"D166CA", x"D16EEF", x"D16A4C", x"D159BC", x"D13E87",
+         x"D11A51", x"D0EF0D", x"D0BEE9", x"D08C36", x"D05958", x"D028A8", x"CFFC64", x"CFD69B",
+         x"CFB914", x"CFA547", x"CF9C4B", x"CF9ECF", x"CFAD14", x"CFC6EE", x"CFEBC5", x"D01A9C",
+         x"D05220", x"D090AD", x"D0D466", x"D11B42", x"D16324", x"D1A9EA", x"D1ED84", x"D22C05",
+         x"D263B8", x"D2932B", x"D2B93C", x"D2D527", x"D2E686", x"D2ED58", x"D2E9FD", x"D2DD34",
+         x"D2C811", x"D2ABF1", x"D28A71", x"D26558", x"D23E8D", x"D217FD", x"D1F391", x"D1D317",
+         x"D1B833", x"D1A450", x"D19895", x"D195D9", x"D19C9C", x"D1AD06", x"D1C6E3", x"D1E9A9",
+         x"D2147C", x"D24635", x"D27D73", x"D2B8A5", x"D2F617", x"D33406", x"D370B0", x"D3AA62",
+         x"D3DF89", x"D40EC1", x"D436E2", x"D45707", x"D46E99", x"D47D52", x"D4833E", x"D480BF",
+         x"D4767F", x"D46573", x"D44ECA", x"D433E8", x"D41650", x"D3F7A0", x"D3D978", x"D3BD72",
+         x"D3A50F", x"D391AA", x"D3846C", x"D37E45", x"D37FDD", x"D38995", x"D39B7E", x"D3B55F",
+         x"D3D6B5", x"D3FEB8", x"D42C64", x"D45E81", x"D493B3", x"D4CA81", x"D50169", x"D536EB",
+         x"D56995", x"D59816", x"D5C144", x"D5E42B", x"D60013", x"D61486", x"D62157", x"D6269E",
+         x"D624BA", x"D61C4D", x"D60E34", x"D5FB7F", x"D5E567", x"D5CD42", x"D5B477", x"D59C6F",
+         x"D58689", x"D5740F", x"D56627", x"D55DCB", x"D55BBE", x"D56086", x"D56C6C", x"D57F71",
+         x"D59957", x"D5B99E", x"D5DF8E", x"D60A39", x"D63887", x"D66942", x"D69B1F", x"D6CCC8",
+         x"D6FCF0", x"D72A57", x"D753DB", x"D7787F", x"D79777", x"D7B02D", x"D7C246", x"D7CDA5",
+         x"D7D26C", x"D7D0FD", x"D7C9F1", x"D7BE13", x"D7AE5D", x"D79BE9", x"D787E9", x"D7739C",
+         x"D76040", x"D74F09", x"D74116", x"D73764", x"D732C6", x"D733E0", x"D73B1E", x"D748B2",
+         x"D75C94", x"D7767F", x"D795F7", x"D7BA4D", x"D7E2A6", x"D80E02", x"D83B48", x"D8694E",
+         x"D896E4", x"D8C2E1", x"D8EC2E", x"D911CE", x"D932E7", x"D94ECB", x"D964FF", x"D9753E",
+         x"D97F79", x"D983DC", x"D982C7", x"D97CCE", x"D972B1", x"D96556", x"D955C0", x"D94504",
+         x"D93443", x"D92499", x"D91718", x"D90CBB", x"D90660", x"D904BC", x"D90859", x"D9118D",
+         x"D9207A", x"D9350D", x"D94EFD", x"D96DD2", x"D990E2", x"D9B762", x"D9E064", x"DA0AE5",
+         x"DA35D7", x"DA6028", x"DA88CE", x"DAAECF", x"DAD14C", x"DAEF8A", x"DB08F2", x"DB1D20",
+         x"DB2BDF", x"DB352D", x"DB393C", x"DB386E", x"DB3352", x"DB2A9F", x"DB1F2C", x"DB11E8",
+         x"DB03D4", x"DAF5F4", x"DAE94B", x"DADECF", x"DAD75F", x"DAD3BE", x"DAD489", x"DADA34",
+         x"DAE503", x"DAF50B", x"DB0A31", x"DB2428", x"DB4277", x"DB647F", x"DB897B", x"DBB08F",
+         x"DBD8CC", x"DC0137", x"DC28D8", x"DC4EBD", x"DC7206", x"DC91EE", x"DCADCE", x"DCC528",
+         x"DCD7A9", x"DCE529", x"DCEDB1", x"DCF179", x"DCF0E4", x"DCEC7E", x"DCE4F6", x"DCDB16",
+         x"DCCFC0", x"DCC3DE", x"DCB863", x"DCAE3A", x"DCA642", x"DCA142", x"DC9FE8", x"DCA2BB",
+         x"DCAA1E", x"DCB647", x"DCC73E", x"DCDCE0", x"DCF6DE", x"DD14C0", x"DD35EA", x"DD59A4",
+         x"DD7F1B", x"DDA571", x"DDCBBE", x"DDF11D", x"DE14B1", x"DE35B1", x"DE536A", x"DE6D4D",
+         x"DE82EB", x"DE93FF", x"DEA071", x"DEA850", x"DEABDB", x"DEAB75", x"DEA7A7", x"DEA11A",
+         x"DE988E", x"DE8ED8", x"DE84D3", x"DE7B5F", x"DE7355", x"DE6D7E", x"DE6A91", x"DE6B27",
+         x"DE6FB6", x"DE7890", x"DE85E0", x"DE97A4", x"DEADB1", x"DEC7B7", x"DEE53D", x"DF05AD",
+         x"DF2854", x"DF4C6C", x"DF7123", x"DF95A2", x"DFB912", x"DFDAAC", x"DFF9B6", x"E01591",
+         x"E02DBE", x"E041DD", x"E051B9", x"E05D40", x"E0648E", x"E067E2", x"E067A2", x"E06456",
+         x"E05E9F", x"E05737", x"E04EE5", x"E0467A", x"E03EC4", x"E0388E", x"E0348F", x"E0336C",
+         x"E035AE", x"E03BBD", x"E045DD", x"E0542D", x"E066A3", x"E07D10", x"E0971E", x"E0B457",
+         x"E0D426", x"E0F5E1", x"E118CA", x"E13C1B", x"E15F08", x"E180CC", x"E1A0AD", x"E1BE04",
+         x"E1D83F", x"E1EEEE", x"E201C0", x"E21089", x"E21B44", x"E22210", x"E22533", x"E22513",
+         x"E22235", x"E21D38", x"E216CC", x"E20FB1", x"E208AB", x"E2027B", x"E1FDDD", x"E1FB7A",
+         x"E1FBE9", x"E1FFA2", x"E20702", x"E21242", x"E22174", x"E23489", x"E24B4A", x"E26561",
+         x"E28258", x"E2A19C", x"E2C289", x"E2E469", x"E3067F", x"E3280D", x"E34859", x"E366B7",
+         x"E3828D", x"E39B59", x"E3B0B7", x"E3C261", x"E3D038", x"E3DA3C", x"E3E095", x"E3E38A",
+         x"E3E384", x"E3E107", x"E3DCAC", x"E3D71F", x"E3D115", x"E3CB49", x"E3C672", x"E3C33D",
+         x"E3C247", x"E3C419", x"E3C921", x"E3D1AD", x"E3DDEC", x"E3EDE8", x"E4018B", x"E4189A",
+         x"E432BB", x"E44F78", x"E46E42", x"E48E7A", x"E4AF6F", x"E4D06F", x"E4F0C4", x"E50FC2",
+         x"E52CC7", x"E54747", x"E55ECB", x"E572FC", x"E5839E", x"E5909A", x"E599FA", x"E59FEA",
+         x"E5A2B5", x"E5A2C5", x"E5A09C", x"E59CD0", x"E59808", x"E592F2", x"E58E3F", x"E58A9B",
+         x"E588A8", x"E588FA", x"E58C0B", x"E5923E", x"E59BD8", x"E5A8FD", x"E5B9B1", x"E5CDD4",
+         x"E5E52A", x"E5FF56", x"E61BE1", x"E63A40", x"E659D6", x"E679FA", x"E69A01", x"E6B93E",
+         x"E6D70F", x"E6F2DF", x"E70C2A", x"E72287", x"E735A7", x"E7455A", x"E75191", x"E75A5B",
+         x"E75FEA", x"E7628D", x"E762AF", x"E760D0", x"E75D84", x"E7596D", x"E75531", x"E7517A",
+         x"E74EEB", x"E74E1D", x"E74F96", x"E753C8", x"E75B0B", x"E7659A", x"E77391", x"E784EC",
+         x"E79986", x"E7B11E", x"E7CB55", x"E7E7B5", x"E805B5", x"E824B9", x"E84421", x"E86346",
+         x"E88186", x"E89E47", x"E8B8FD", x"E8D130", x"E8E680", x"E8F8A8", x"E90780", x"E91301",
+         x"E91B42", x"E92077", x"E922F5", x"E92324", x"E92187", x"E91EAE", x"E91B36", x"E917C0",
+         x"E914EF", x"E9135C", x"E91397", x"E9161E", x"E91B58", x"E92394", x"E92F04", x"E93DBC",
+         x"E94FB1", x"E964B9", x"E97C8F", x"E996D3", x"E9B30E", x"E9D0B7", x"E9EF39", x"EA0DF5",
+         x"EA2C4E", x"EA49A6", x"EA656E", x"EA7F23", x"EA9655", x"EAAAAD", x"EABBF0", x"EAC9FF",
+         x"EAD4D8", x"EADC98", x"EAE17A", x"EAE3D2", x"EAE40D", x"EAE2AB", x"EAE03A", x"EADD52",
+         x"EADA91", x"EAD892", x"EAD7E6", x"EAD915", x"EADC94", x"EAE2C2", x"EAEBE4", x"EAF825",
+         x"EB0790", x"EB1A14", x"EB2F84", x"EB4795", x"EB61E6", x"EB7E00", x"EB9B5B", x"EBB966",
+         x"EBD786", x"EBF522", x"EC11A6", x"EC2C88", x"EC454F", x"EC5B93", x"EC6F07", x"EC7F75",
+         x"EC8CC8", x"EC9704", x"EC9E4D", x"ECA2DF", x"ECA513", x"ECA557", x"ECA429", x"ECA216",
+         x"EC9FB4", x"EC9D99", x"EC9C5A", x"EC9C85", x"EC9E96", x"ECA2FB", x"ECAA0B", x"ECB404",
+         x"ECC106", x"ECD119", x"ECE424", x"ECF9F5", x"ED123F", x"ED2C9F", x"ED489C", x"ED65B1",
+         x"ED834E", x"EDA0DE", x"EDBDCC", x"EDD98B", x"EDF399", x"EE0B82", x"EE20E9", x"EE3386",
+         x"EE432E", x"EE4FD1", x"EE597A", x"EE6050", x"EE6497", x"EE66A8", x"EE66F1", x"EE65F2",
+         x"EE6436", x"EE624E", x"EE60CD", x"EE6042", x"EE6133", x"EE6417", x"EE6954", x"EE7138",
+         x"EE7BF9", x"EE89B2", x"EE9A63", x"EEADEE", x"EEC41C", x"EEDC9D", x"EEF70C", x"EF12F0",
+         x"EF2FC5", x"EF4CFE", x"EF6A08", x"EF8654", x"EFA15C", x"EFBAA2", x"EFD1BC", x"EFE652",
+         x"EFF827", x"F00714", x"F01310", x"F01C2D", x"F02297", x"F02695", x"F02882", x"F028CF",
+         x"F027FB", x"F0268E", x"F02517", x"F02425", x"F02443", x"F025EE", x"F02998", x"F02F9F",
+         x"F0384B", x"F043CA", x"F05230", x"F06377", x"F0777C", x"F08E04", x"F0A6BB", x"F0C13A",
+         x"F0DD09", x"F0F9A3", x"F1167E", x"F1330B", x"F14EC1", x"F1691C", x"F181A6", x"F197FD",
+         x"F1ABCF", x"F1BCE4", x"F1CB20", x"F1D67D", x"F1DF14", x"F1E516", x"F1E8CD", x"F1EA97",
+         x"F1EAE6", x"F1EA38", x"F1E914", x"F1E807", x"F1E79C", x"F1E857", x"F1EAB2", x"F1EF18",
+         x"F1F5DF", x"F1FF48", x"F20B7B", x"F21A87", x"F22C5D", x"F240D8", x"F257B6", x"F270A2",
+         x"F28B32", x"F2A6EF", x"F2C353", x"F2DFD7", x"F2FBF0", x"F31717", x"F330CF", x"F348A8",
+         x"F35E44", x"F3715B", x"F381BB", x"F38F4D", x"F39A12", x"F3A229", x"F3A7C6", x"F3AB37",
+         x"F3ACDE", x"F3AD2C", x"F3ACA0", x"F3ABC1", x"F3AB17", x"F3AB2B", x"F3AC7B", x"F3AF7D",
+         x"F3B494", x"F3BC12", x"F3C631", x"F3D312", x"F3E2BC", x"F3F51C", x"F40A08", x"F4213B",
+         x"F43A5B", x"F454FE", x"F470AB", x"F48CDE", x"F4A911", x"F4C4BB", x"F4DF5B", x"F4F878",
+         x"F50FA8", x"F52493", x"F536F7", x"F546A9", x"F55396", x"F55DC9", x"F56563", x"F56A9E",
+         x"F56DCB", x"F56F4E", x"F56F9A", x"F56F2D", x"F56E8D", x"F56E41", x"F56ECC", x"F570AB",
+         x"F5744C", x"F57A0E", x"F5823B", x"F58D08", x"F59A90", x"F5AAD3", x"F5BDBA", x"F5D314",
+         x"F5EA9A", x"F603EF", x"F61EA6", x"F63A45", x"F6564B", x"F67231", x"F68D73", x"F6A792",
+         x"F6C01B", x"F6D6A9", x"F6EAE9", x"F6FCA0", x"F70BAA", x"F717F9", x"F7219D", x"F728BE",
+         x"F72D98", x"F73082", x"F731E0", x"F73227", x"F731D7", x"F73172", x"F7317F", x"F7327C",
+         x"F734E3", x"F7391D", x"F73F83", x"F7485A", x"F753CF", x"F761F9", x"F772D1", x"F7863C",
+         x"F79C02", x"F7B3DA", x"F7CD63", x"F7E82F", x"F803C4", x"F81F9F", x"F83B3D", x"F8561C",
+         x"F86FC0", x"F887BA", x"F89DAB", x"F8B147", x"F8C257", x"F8D0BC", x"F8DC71", x"F8E58A",
+         x"F8EC33", x"F8F0AF", x"F8F355", x"F8F48D", x"F8F4CF", x"F8F497", x"F8F46B", x"F8F4CB",
+         x"F8F637", x"F8F920", x"F8FDEE", x"F904F3", x"F90E6E", x"F91A88", x"F9294F", x"F93ABA",
+         x"F94EA5", x"F964D7", x"F97D00", x"F996BE", x"F9B1A1", x"F9CD2D", x"F9E8E1", x"FA043B",
+         x"FA1EBA", x"FA37E7", x"FA4F58", x"FA64B1", x"FA77AD", x"FA8819", x"FA95DE", x"FAA0FC",
+         x"FAA98C", x"FAAFBF", x"FAB3DD", x"FAB63F", x"FAB751", x"FAB78A", x"FAB769", x"FAB771",
+         x"FAB822", x"FAB9F7", x"FABD60", x"FAC2BD", x"FACA5D", x"FAD479", x"FAE133", x"FAF096",
+         x"FB0290", x"FB16FA", x"FB2D97", x"FB4611", x"FB6005", x"FB7B00", x"FB9686", x"FBB216",
+         x"FBCD2E", x"FBE751", x"FC000C", x"FC16F6", x"FC2BBC", x"FC3E1A", x"FC4DE7", x"FC5B0F",
+         x"FC6598", x"FC6DA0", x"FC735E", x"FC771D", x"FC793B", x"FC7A25", x"FC7A54", x"FC7A48",
+         x"FC7A81", x"FC7B80", x"FC7DBB", x"FC819F", x"FC8788", x"FC8FC0", x"FC9A7A", x"FCA7D3",
+         x"FCB7CE", x"FCCA57", x"FCDF40", x"FCF646", x"FD0F13", x"FD293E", x"FD4453", x"FD5FD4",
+         x"FD7B42", x"FD961C", x"FDAFE6", x"FDC831", x"FDDE98", x"FDF2CD", x"FE0491", x"FE13BF",
+         x"FE204C", x"FE2A40", x"FE31C2", x"FE370B", x"FE3A6B", x"FE3C43", x"FE3D04", x"FE3D28",
+         x"FE3D2D", x"FE3D96", x"FE3EDF", x"FE417E", x"FE45DB", x"FE4C4D", x"FE551A", x"FE6071",
+         x"FE6E66", x"FE7EFA", x"FE9210", x"FEA778", x"FEBEE9", x"FED809", x"FEF26C", x"FF0D9D",
+         x"FF291D", x"FF446B", x"FF5F08", x"FF787C", x"FF9059", x"FFA640", x"FFB9E5", x"FFCB10",
+         x"FFD9A2", x"FFE594", x"FFEEF5", x"FFF5EF", x"FFFAC3", x"FFFDC3", x"FFFF55", x"FFFFEA",
+         x"000000", x"000016", x"0000AB", x"00023D", x"00053D", x"000A11", x"00110B", x"001A6C",
+         x"00265E", x"0034F0", x"00461B", x"0059C0", x"006FA7", x"008784", x"00A0F8", x"00BB95",
+         x"00D6E3", x"00F263", x"010D94", x"0127F7", x"014117", x"015888", x"016DF0", x"018106",
+         x"01919A", x"019F8F", x"01AAE6", x"01B3B3", x"01BA25", x"01BE82", x"01C121", x"01C26A",
+         x"01C2D3", x"01C2D8", x"01C2FC", x"01C3BD", x"01C595", x"01C8F5", x"01CE3E", x"01D5C0",
+         x"01DFB4", x"01EC41", x"01FB6F", x"020D33", x"022168", x"0237CF", x"02501A", x"0269E4",
+         x"0284BE", x"02A02C", x"02BBAD", x"02D6C2", x"02F0ED", x"0309BA", x"0320C0", x"0335A9",
+         x"034832", x"03582D", x"036586", x"037040", x"037878", x"037E61", x"038245", x"038480",
+         x"03857F", x"0385B8", x"0385AC", x"0385DB", x"0386C5", x"0388E3", x"038CA2", x"039260",
+         x"039A68", x"03A4F1", x"03B219", x"03C1E6", x"03D444", x"03E90A", x"03FFF4", x"0418AF",
+         x"0432D2", x"044DEA", x"04697A", x"048500", x"049FFB", x"04B9EF", x"04D269", x"04E906",
+         x"04FD70", x"050F6A", x"051ECD", x"052B87", x"0535A3", x"053D43", x"0542A0", x"054609",
+         x"0547DE", x"05488F", x"054897", x"054876", x"0548AF", x"0549C1", x"054C23", x"055041",
+         x"055674", x"055F04", x"056A22", x"0577E7", x"058853", x"059B4F", x"05B0A8", x"05C819",
+         x"05E146", x"05FBC5", x"06171F", x"0632D3", x"064E5F", x"066942", x"068300", x"069B29",
+         x"06B15B", x"06C546", x"06D6B1", x"06E578", x"06F192", x"06FB0D", x"070212", x"0706E0",
+         x"0709C9", x"070B35", x"070B95", x"070B69", x"070B31", x"070B73", x"070CAB", x"070F51",
+         x"0713CD", x"071A76", x"07238F", x"072F44", x"073DA9", x"074EB9", x"076255", x"077846",
+         x"079040", x"07A9E4", x"07C4C3", x"07E061", x"07FC3C", x"0817D1", x"08329D", x"084C26",
+         x"0863FE", x"0879C4", x"088D2F", x"089E07", x"08AC31", x"08B7A6", x"08C07D", x"08C6E3",
+         x"08CB1D", x"08CD84", x"08CE81", x"08CE8E", x"08CE29", x"08CDD9", x"08CE20", x"08CF7E",
+         x"08D268", x"08D742", x"08DE63", x"08E807", x"08F456", x"090360", x"091517", x"092957",
+         x"093FE5", x"09586E", x"09728D", x"098DCF", x"09A9B5", x"09C5BB", x"09E15A", x"09FC11",
+         x"0A1566", x"0A2CEC", x"0A4246", x"0A552D", x"0A6570", x"0A72F8", x"0A7DC5", x"0A85F2",
+         x"0A8BB4", x"0A8F55", x"0A9134", x"0A91BF", x"0A9173", x"0A90D3", x"0A9066", x"0A90B2",
+         x"0A9235", x"0A9562", x"0A9A9D", x"0AA237", x"0AAC6A", x"0AB957", x"0AC909", x"0ADB6D",
+         x"0AF058", x"0B0788", x"0B20A5", x"0B3B45", x"0B56EF", x"0B7322", x"0B8F55", x"0BAB02",
+         x"0BC5A5", x"0BDEC5", x"0BF5F8", x"0C0AE4", x"0C1D44", x"0C2CEE", x"0C39CF", x"0C43EE",
+         x"0C4B6C", x"0C5083", x"0C5385", x"0C54D5", x"0C54E9", x"0C543F", x"0C5360", x"0C52D4",
+         x"0C5322", x"0C54C9", x"0C583A", x"0C5DD7", x"0C65EE", x"0C70B3", x"0C7E45", x"0C8EA5",
+         x"0CA1BC", x"0CB758", x"0CCF31", x"0CE8E9", x"0D0410", x"0D2029", x"0D3CAD", x"0D5911",
+         x"0D74CE", x"0D8F5E", x"0DA84A", x"0DBF28", x"0DD3A3", x"0DE579", x"0DF485", x"0E00B8",
+         x"0E0A21", x"0E10E8", x"0E154E", x"0E17A9", x"0E1864", x"0E17F9", x"0E16EC", x"0E15C8",
+         x"0E151A", x"0E1569", x"0E1733", x"0E1AEA", x"0E20EC", x"0E2983", x"0E34E0", x"0E431C",
+         x"0E5431", x"0E6803", x"0E7E5A", x"0E96E4", x"0EB13F", x"0ECCF5", x"0EE982", x"0F065D",
+         x"0F22F7", x"0F3EC6", x"0F5945", x"0F71FC", x"0F8884", x"0F9C89", x"0FADD0", x"0FBC36",
+         x"0FC7B5", x"0FD061", x"0FD668", x"0FDA12", x"0FDBBD", x"0FDBDB", x"0FDAE9", x"0FD972",
+         x"0FD805", x"0FD731", x"0FD77E", x"0FD96B", x"0FDD69", x"0FE3D3", x"0FECF0", x"0FF8EC",
+         x"1007D9", x"1019AE", x"102E44", x"10455E", x"105EA4", x"1079AC", x"1095F8", x"10B302",
+         x"10D03B", x"10ED10", x"1108F4", x"112363", x"113BE4", x"115212", x"11659D", x"11764E",
+         x"118407", x"118EC8", x"1196AC", x"119BE9", x"119ECD", x"119FBE", x"119F33", x"119DB2",
+         x"119BCA", x"119A0E", x"11990F", x"119958", x"119B69", x"119FB0", x"11A686", x"11B02F",
+         x"11BCD2", x"11CC7A", x"11DF17", x"11F47E", x"120C67", x"122675", x"124234", x"125F22",
+         x"127CB2", x"129A4F", x"12B764", x"12D361", x"12EDC1", x"13060B", x"131BDC", x"132EE7",
+         x"133EFA", x"134BFC", x"1355F5", x"135D05", x"13616A", x"13637B", x"1363A6", x"136267",
+         x"13604C", x"135DEA", x"135BD7", x"135AA9", x"135AED", x"135D21", x"1361B3", x"1368FC",
+         x"137338", x"13808B", x"1390F9", x"13A46D", x"13BAB1", x"13D378", x"13EE5A", x"140ADE",
+         x"14287A", x"14469A", x"1464A5", x"148200", x"149E1A", x"14B86B", x"14D07C", x"14E5EC",
+         x"14F870", x"1507DB", x"15141C", x"151D3E", x"15236C", x"1526EB", x"15281A", x"15276E",
+         x"15256F", x"1522AE", x"151FC6", x"151D55", x"151BF3", x"151C2E", x"151E86", x"152368",
+         x"152B28", x"153601", x"154410", x"155553", x"1569AB", x"1580DD", x"159A92", x"15B65A",
+         x"15D3B2", x"15F20B", x"1610C7", x"162F49", x"164CF2", x"16692D", x"168371", x"169B47",
+         x"16B04F", x"16C244", x"16D0FC", x"16DC6C", x"16E4A8", x"16E9E2", x"16EC69", x"16ECA4",
+         x"16EB11", x"16E840", x"16E4CA", x"16E152", x"16DE79", x"16DCDC", x"16DD0B", x"16DF89",
+         x"16E4BE", x"16ECFF", x"16F880", x"170758", x"171980", x"172ED0", x"174703", x"1761B9",
+         x"177E7A", x"179CBA", x"17BBDF", x"17DB47", x"17FA4B", x"18184B", x"1834AB", x"184EE2",
+         x"18667A", x"187B14", x"188C6F", x"189A66", x"18A4F5", x"18AC38", x"18B06A", x"18B1E3",
+         x"18B115", x"18AE86", x"18AACF", x"18A693", x"18A27C", x"189F30", x"189D51", x"189D73",
+         x"18A016", x"18A5A5", x"18AE6F", x"18BAA6", x"18CA59", x"18DD79", x"18F3D6", x"190D21",
+         x"1928F1", x"1946C2", x"1965FF", x"198606", x"19A62A", x"19C5C0", x"19E41F", x"1A00AA",
+         x"1A1AD6", x"1A322C", x"1A464F", x"1A5703", x"1A6428", x"1A6DC2", x"1A73F5", x"1A7706",
+         x"1A7758", x"1A7565", x"1A71C1", x"1A6D0E", x"1A67F8", x"1A6330", x"1A5F64", x"1A5D3B",
+         x"1A5D4B", x"1A6016", x"1A6606", x"1A6F66", x"1A7C62", x"1A8D04", x"1AA135", x"1AB8B9",
+         x"1AD339", x"1AF03E", x"1B0F3C", x"1B2F91", x"1B5091", x"1B7186", x"1B91BE", x"1BB088",
+         x"1BCD45", x"1BE766", x"1BFE75", x"1C1218", x"1C2214", x"1C2E53", x"1C36DF", x"1C3BE7",
+         x"1C3DB9", x"1C3CC3", x"1C398E", x"1C34B7", x"1C2EEB", x"1C28E1", x"1C2354", x"1C1EF9",
+         x"1C1C7C", x"1C1C76", x"1C1F6B", x"1C25C4", x"1C2FC8", x"1C3D9F", x"1C4F49", x"1C64A7",
+         x"1C7D73", x"1C9949", x"1CB7A7", x"1CD7F3", x"1CF981", x"1D1B97", x"1D3D77", x"1D5E64",
+         x"1D7DA8", x"1D9A9F", x"1DB4B6", x"1DCB77", x"1DDE8C", x"1DEDBE", x"1DF8FE", x"1E005E",
+         x"1E0417", x"1E0486", x"1E0223", x"1DFD85", x"1DF755", x"1DF04F", x"1DE934", x"1DE2C8",
+         x"1DDDCB", x"1DDAED", x"1DDACD", x"1DDDF0", x"1DE4BC", x"1DEF77", x"1DFE40", x"1E1112",
+         x"1E27C1", x"1E41FC", x"1E5F53", x"1E7F34", x"1EA0F8", x"1EC3E5", x"1EE736", x"1F0A1F",
+         x"1F2BDA", x"1F4BA9", x"1F68E2", x"1F82F0", x"1F995D", x"1FABD3", x"1FBA23", x"1FC443",
+         x"1FCA52", x"1FCC94", x"1FCB71", x"1FC772", x"1FC13C", x"1FB986", x"1FB11B", x"1FA8C9",
+         x"1FA161", x"1F9BAA", x"1F985E", x"1F981E", x"1F9B72", x"1FA2C0", x"1FAE47", x"1FBE23",
+         x"1FD242", x"1FEA6F", x"20064A", x"202554", x"2046EE", x"206A5E", x"208EDD", x"20B394",
+         x"20D7AC", x"20FA53", x"211AC3", x"213849", x"21524F", x"21685C", x"217A20", x"218770",
+         x"21904A", x"2194D9", x"21956F", x"219282", x"218CAB", x"2184A1", x"217B2D", x"217128",
+         x"216772", x"215EE6", x"215859", x"21548B", x"215425", x"2157B0", x"215F8F", x"216C01",
+         x"217D15", x"2192B3", x"21AC96", x"21CA4F", x"21EB4F", x"220EE3", x"223442", x"225A8F",
+         x"2280E5", x"22A65C", x"22CA16", x"22EB40", x"230922", x"232320", x"2338C2", x"2349B9",
+         x"2355E2", x"235D45", x"236018", x"235EBE", x"2359BE", x"2351C6", x"23479D", x"233C22",
+         x"233040", x"2324EA", x"231B0A", x"231382", x"230F1C", x"230E87", x"23124F", x"231AD7",
+         x"232857", x"233AD8", x"235232", x"236E12", x"238DFA", x"23B143", x"23D728", x"23FEC9",
+         x"242734", x"244F71", x"247685", x"249B81", x"24BD89", x"24DBD8", x"24F5CF", x"250AF5",
+         x"251AFD", x"2525CC", x"252B77", x"252C42", x"2528A1", x"252131", x"2516B5", x"250A0C",
+         x"24FC2C", x"24EE18", x"24E0D4", x"24D561", x"24CCAE", x"24C792", x"24C6C4", x"24CAD3",
+         x"24D421", x"24E2E0", x"24F70E", x"251076", x"252EB4", x"255131", x"257732", x"259FD8",
+         x"25CA29", x"25F51B", x"261F9C", x"26489E", x"266F1E", x"26922E", x"26B103", x"26CAF3",
+         x"26DF86", x"26EE73", x"26F7A7", x"26FB44", x"26F9A0", x"26F345", x"26E8E8", x"26DB67",
+         x"26CBBD", x"26BAFC", x"26AA40", x"269AAA", x"268D4F", x"268332", x"267D39", x"267C24",
+         x"268087", x"268AC2", x"269B01", x"26B135", x"26CD19", x"26EE32", x"2713D2", x"273D1F",
+         x"27691C", x"2796B2", x"27C4B8", x"27F1FE", x"281D5A", x"2845B3", x"286A09", x"288981",
+         x"28A36C", x"28B74E", x"28C4E2", x"28CC20", x"28CD3A", x"28C89C", x"28BEEA", x"28B0F7",
+         x"289FC0", x"288C64", x"287817", x"286417", x"2851A3", x"2841ED", x"28360F", x"282F03",
+         x"282D94", x"28325B", x"283DBA", x"284FD3", x"286889", x"288781", x"28AC25", x"28D5A9",
+         x"290310", x"293338", x"2964E1", x"2996BE", x"29C779", x"29F5C7", x"2A2072", x"2A4662",
+         x"2A66A9", x"2A808F", x"2A9394", x"2A9F7A", x"2AA442", x"2AA235", x"2A99D9", x"2A8BF1",
+         x"2A7977", x"2A6391", x"2A4B89", x"2A32BE", x"2A1A99", x"2A0481", x"29F1CC", x"29E3B3",
+         x"29DB46", x"29D962", x"29DEA9", x"29EB7A", x"29FFED", x"2A1BD5", x"2A3EBC", x"2A67EA",
+         x"2A966B", x"2AC915", x"2AFE97", x"2B357F", x"2B6C4D", x"2BA17F", x"2BD39C", x"2C0148",
+         x"2C294B", x"2C4AA1", x"2C6482", x"2C766B", x"2C8023", x"2C81BB", x"2C7B94", x"2C6E56",
+         x"2C5AF1", x"2C428E", x"2C2688", x"2C0860", x"2BE9B0", x"2BCC18", x"2BB136", x"2B9A8D",
+         x"2B8981", x"2B7F41", x"2B7CC2", x"2B82AE", x"2B9167", x"2BA8F9", x"2BC91E", x"2BF13F",
+         x"2C2077", x"2C559E", x"2C8F50", x"2CCBFA", x"2D09E9", x"2D475B", x"2D828D", x"2DB9CB",
+         x"2DEB84", x"2E1657", x"2E391D", x"2E52FA", x"2E6364", x"2E6A27", x"2E676B", x"2E5BB0",
+         x"2E47CD", x"2E2CE9", x"2E0C6F", x"2DE803", x"2DC173", x"2D9AA8", x"2D758F", x"2D540F",
+         x"2D37EF", x"2D22CC", x"2D1603", x"2D12A8", x"2D197A", x"2D2AD9", x"2D46C4", x"2D6CD5",
+         x"2D9C48", x"2DD3FB", x"2E127C", x"2E5616", x"2E9CDC", x"2EE4BE", x"2F2B9A", x"2F6F53",
+         x"2FADE0", x"2FE564", x"30143B", x"303912", x"3052EC", x"306131", x"3063B5", x"305AB9",
+         x"3046EC", x"302965", x"30039C", x"2FD758", x"2FA6A8", x"2F73CA", x"2F4117", x"2F10F3",
+         x"2EE5AF", x"2EC179", x"2EA644", x"2E95B4", x"2E9111", x"2E9936", x"2EAE8B", x"2ED0FB",
+         x"2EFFF5", x"2F3A72", x"2F7EF9", x"2FCBAC", x"301E59", x"30748C", x"30CBA8", x"3120FA",
+         x"3171D5", x"31BBAC", x"31FC28", x"323142", x"325953", x"327329", x"327E13", x"3279EA",
+         x"326713", x"32467F", x"3219A7", x"31E27D", x"31A35D", x"315EF9", x"311843", x"30D24F",
+         x"30903A", x"30550C", x"302399", x"2FFE68", x"2FE79C", x"2FE0D7", x"2FEB30", x"30071E",
+         x"30347A", x"307273", x"30BF9B", x"3119EA", x"317ED3", x"31EB55", x"325C1A", x"32CD8E",
+         x"333C03", x"33A3D1", x"34017C", x"3451CF", x"349204", x"34BFD8", x"34D9AA", x"34DE8A",
+         x"34CE48", x"34A979", x"34717A", x"342862", x"33D0FA", x"336EA2", x"330539", x"3298FD",
+         x"322E61", x"31C9EB", x"317005", x"3124D8", x"30EC20", x"30C908", x"30BE07", x"30CCC4",
+         x"30F602", x"31398F", x"319643", x"3209FC", x"3291B1", x"332981", x"33CCD4", x"34767C",
+         x"3520E2", x"35C634", x"36609B", x"36EA6D", x"375E68", x"37B7E0", x"37F2F6", x"380CBD",
+         x"380363", x"37D64D", x"378625", x"3714E5", x"3685D5", x"35DD77", x"352170", x"345860",
+         x"3389B6", x"32BD70", x"31FBE3", x"314D6C", x"30BA30", x"3049C6", x"3002F7", x"2FEB6E",
+         x"30077C", x"3059DE", x"30E38A", x"31A38C", x"3296F0", x"33B8BA", x"3501EA", x"366992",
+         x"37E4FB", x"3967DB", x"3AE492", x"3C4C77", x"3D9035", x"3EA021", x"3F6CA8", x"3FE6AF",
+         x"3FFFFF", x"3FABA7", x"3EDE5B", x"3D8ECE", x"3BB5F9", x"394F5A", x"365925", x"32D45F",
+         x"2EC4F1", x"2A3199", x"2523D9", x"1FA7CB", x"19CBE5", x"13A0AF", x"0D386B", x"06A6B1"),
+        -- octave 5
+        (x"000000", x"FCA005", x"F942C4", x"F5EAF6", x"F29B48", x"EF565F", x"EC1ECF", x"E8F718",
+         x"E5E1A6", x"E2E0CA", x"DFF6B5", x"DD257D", x"DA6F10", x"D7D53B", x"D559A0", x"D2FDB8",
+         x"D0C2D0", x"CEAA09", x"CCB455", x"CAE275", x"C934FD", x"C7AC4E", x"C6489C", x"C509E7",
+         x"C3F003", x"C2FA95", x"C22913", x"C17ACA", x"C0EEDB", x"C08440", x"C039CD", x"C00E33",
+         x"C00001", x"C00DAA", x"C03584", x"C075D0", x"C0CCB7", x"C13855", x"C1B6B3", x"C245D4",
+         x"C2E3B2", x"C38E43", x"C4437E", x"C5015C", x"C5C5DD", x"C68F0A", x"C75AFA", x"C827D2",
+         x"C8F3CA", x"C9BD2E", x"CA8263", x"CB41E6", x"CBFA50", x"CCAA55", x"CD50CA", x"CDECA4",
+         x"CE7CF7", x"CF00F9", x"CF7803", x"CFE18F", x"D03D3A", x"D08AC2", x"D0CA07", x"D0FB0A",
+         x"D11DEC", x"D132E9", x"D13A5F", x"D134C5", x"D122AA", x"D104B8", x"D0DBAD", x"D0A85B",
+         x"D06BA4", x"D0267B", x"CFD9DE", x"CF86D5", x"CF2E71", x"CED1C6", x"CE71EC", x"CE0FFA",
+         x"CDAD06", x"CD4A21", x"CCE854", x"CC889F", x"CC2BFB", x"CBD34E", x"CB7F74", x"CB3138",
+         x"CAE952", x"CAA869", x"CA6F0F", x"CA3DC3", x"CA14EC", x"C9F4DD", x"C9DDD5", x"C9CFF9",
+         x"C9CB5A", x"C9CFF3", x"C9DDAC", x"C9F454", x"CA13AA", x"CA3B59", x"CA6AFA", x"CAA216",
+         x"CAE026", x"CB2499", x"CB6ECD", x"CBBE18", x"CC11C9", x"CC6924", x"CCC36D", x"CD1FDF",
+         x"CD7DB9", x"CDDC36", x"CE3A94", x"CE9816", x"CEF404", x"CF4DAB", x"CFA461", x"CFF788",
+         x"D0468A", x"D090DE", x"D0D609", x"D1159E", x"D14F3D", x"D18298", x"D1AF6F", x"D1D593",
+         x"D1F4E4", x"D20D56", x"D21EE9", x"D229AF", x"D22DCB", x"D22B6D", x"D222D5", x"D2144E",
+         x"D20032", x"D1E6E8", x"D1C8DF", x"D1A690", x"D1807E", x"D15731", x"D12B37", x"D0FD25",
+         x"D0CD8F", x"D09D0C", x"D06C35", x"D03B9F", x"D00BDD", x"CFDD7F", x"CFB110", x"CF8714",
+         x"CF6007", x"CF3C5D", x"CF1C81", x"CF00D4", x"CEE9A9", x"CED74C", x"CEC9FA", x"CEC1E3",
+         x"CEBF2A", x"CEC1E8", x"CECA25", x"CED7DE", x"CEEB03", x"CF0377", x"CF2110", x"CF439B",
+         x"CF6AD7", x"CF967B", x"CFC633", x"CFF9A2", x"D03066", x"D06A12", x"D0A638", x"D0E462",
+         x"D12417", x"D164DF", x"D1A63B", x"D1E7B2", x"D228C8", x"D26904", x"D2A7F2", x"D2E521",
+         x"D32025", x"D35899", x"D38E1F", x"D3C060", x"D3EF10", x"D419EA", x"D440B2", x"D46339",
+         x"D48159", x"D49AF7", x"D4B003", x"D4C077", x"D4CC59", x"D4D3B9", x"D4D6B3", x"D4D56B",
+         x"D4D011", x"D4C6DC", x"D4BA0D", x"D4A9EC", x"D496C9", x"D480F9", x"D468D9", x"D44EC7",
+         x"D43329", x"D41663", x"D3F8E0", x"D3DB07", x"D3BD42", x"D39FF8", x"D3838F", x"D3686A",
+         x"D34EE7", x"D33761", x"D3222C", x"D30F97", x"D2FFE9", x"D2F361", x"D2EA39", x"D2E49F",
+         x"D2E2BA", x"D2E4A7", x"D2EA7B", x"D2F441", x"D301FA", x"D3139E", x"D3291C", x"D34259",
+         x"D35F34", x"D37F80", x"D3A30C", x"D3C99C", x"D3F2F0", x"D41EC1", x"D44CC3", x"D47CA5",
+         x"D4AE12", x"D4E0B4", x"D51430", x"D5482B", x"D57C49", x"D5B031", x"D5E387", x"D615F4",
+         x"D64722", x"D676C2", x"D6A484", x"D6D022", x"D6F959", x"D71FEC", x"D743A7", x"D7645A",
+         x"D781DE", x"D79C16", x"D7B2E9", x"D7C649", x"D7D630", x"D7E29E", x"D7EBA0", x"D7F145",
+         x"D7F3A9", x"D7F2EC", x"D7EF38", x"D7E8BC", x"D7DFAD", x"D7D446", x"D7C6C9", x"D7B77B",
+         x"D7A6A3", x"D7948F", x"D7818C", x"D76DEA", x"D759FC", x"D74611", x"D7327A", x"D71F87",
+         x"D70D85", x"D6FCBE", x"D6ED79", x"D6DFF9", x"D6D47D", x"D6CB3E", x"D6C46F", x"D6C03D",
+         x"D6BED0", x"D6C047", x"D6C4BB", x"D6CC3E", x"D6D6DA", x"D6E492", x"D6F562", x"D7093E",
+         x"D72012", x"D739C5", x"D75636", x"D7753F", x"D796B2", x"D7BA5D", x"D7E009", x"D8077B",
+         x"D83072", x"D85AAC", x"D885E5", x"D8B1D4", x"D8DE30", x"D90AB2", x"D93710", x"D96301",
+         x"D98E40", x"D9B886", x"D9E193", x"DA0927", x"DA2F08", x"DA52FE", x"DA74DA", x"DA946D",
+         x"DAB193", x"DACC29", x"DAE415", x"DAF945", x"DB0BAA", x"DB1B3D", x"DB2800", x"DB31F8",
+         x"DB3934", x"DB3DC7", x"DB3FCB", x"DB3F61", x"DB3CAE", x"DB37DC", x"DB311C", x"DB28A1",
+         x"DB1EA4", x"DB135F", x"DB0710", x"DAF9F7", x"DAEC56", x"DADE6F", x"DAD084", x"DAC2D9",
+         x"DAB5AE", x"DAA944", x"DA9DD8", x"DA93A5", x"DA8AE3", x"DA83C7", x"DA7E80", x"DA7B3A",
+         x"DA7A1B", x"DA7B44", x"DA7ED1", x"DA84D7", x"DA8D66", x"DA9888", x"DAA63F", x"DAB68A",
+         x"DAC95E", x"DADEAE", x"DAF665", x"DB1068", x"DB2C98", x"DB4AD0", x"DB6AE6", x"DB8CAE",
+         x"DBAFF5", x"DBD487", x"DBFA2D", x"DC20AD", x"DC47CA", x"DC6F49", x"DC96ED", x"DCBE77",
+         x"DCE5AA", x"DD0C4C", x"DD3222", x"DD56F3", x"DD7A8C", x"DD9CB8", x"DDBD4B", x"DDDC19",
+         x"DDF8FD", x"DE13D4", x"DE2C83", x"DE42F3", x"DE5711", x"DE68D3", x"DE7831", x"DE852B",
+         x"DE8FC6", x"DE980C", x"DE9E0E", x"DEA1E2", x"DEA3A1", x"DEA36C", x"DEA166", x"DE9DB7",
+         x"DE988B", x"DE9212", x"DE8A7D", x"DE8201", x"DE78D4", x"DE6F2F", x"DE654A", x"DE5B5D",
+         x"DE51A3", x"DE4853", x"DE3FA4", x"DE37CC", x"DE30FD", x"DE2B68", x"DE273A", x"DE249D",
+         x"DE23B6", x"DE24A7", x"DE278D", x"DE2C81", x"DE3396", x"DE3CD9", x"DE4854", x"DE560A",
+         x"DE65FA", x"DE781C", x"DE8C65", x"DEA2C2", x"DEBB1E", x"DED55E", x"DEF162", x"DF0F08",
+         x"DF2E27", x"DF4E97", x"DF7029", x"DF92AD", x"DFB5F1", x"DFD9C3", x"DFFDEC", x"E02238",
+         x"E04672", x"E06A64", x"E08DDA", x"E0B0A2", x"E0D28A", x"E0F363", x"E11302", x"E1313E",
+         x"E14DF0", x"E168F8", x"E18238", x"E19996", x"E1AEFE", x"E1C260", x"E1D3B1", x"E1E2EA",
+         x"E1F00B", x"E1FB17", x"E20418", x"E20B1B", x"E21032", x"E21375", x"E214FD", x"E214EC",
+         x"E21363", x"E21088", x"E20C85", x"E20786", x"E201B9", x"E1FB4E", x"E1F475", x"E1ED61",
+         x"E1E644", x"E1DF50", x"E1D8B7", x"E1D2AA", x"E1CD57", x"E1C8EC", x"E1C595", x"E1C378",
+         x"E1C2BC", x"E1C383", x"E1C5EA", x"E1CA0B", x"E1CFFD", x"E1D7D1", x"E1E194", x"E1ED4E",
+         x"E1FB02", x"E20AB1", x"E21C54", x"E22FE0", x"E24546", x"E25C74", x"E27552", x"E28FC3",
+         x"E2ABAA", x"E2C8E4", x"E2E74A", x"E306B6", x"E326FC", x"E347F0", x"E36964", x"E38B29",
+         x"E3AD10", x"E3CEE9", x"E3F084", x"E411B3", x"E43248", x"E45218", x"E470F8", x"E48EC1",
+         x"E4AB4D", x"E4C67B", x"E4E02C", x"E4F846", x"E50EB2", x"E5235C", x"E53636", x"E54736",
+         x"E55655", x"E56393", x"E56EF2", x"E5787B", x"E58038", x"E5863B", x"E58A96", x"E58D63",
+         x"E58EBE", x"E58EC4", x"E58D9A", x"E58B62", x"E58845", x"E5846C", x"E58003", x"E57B34",
+         x"E5762E", x"E5711D", x"E56C2F", x"E56791", x"E5636F", x"E55FF4", x"E55D48", x"E55B94",
+         x"E55AFB", x"E55B9F", x"E55D9F", x"E56117", x"E5661E", x"E56CCA", x"E57529", x"E57F49",
+         x"E58B30", x"E598E4", x"E5A862", x"E5B9A6", x"E5CCA7", x"E5E158", x"E5F7A7", x"E60F7F",
+         x"E628C8", x"E64365", x"E65F38", x"E67C1F", x"E699F5", x"E6B893", x"E6D7D2", x"E6F787",
+         x"E71788", x"E737AA", x"E757C1", x"E777A2", x"E79723", x"E7B618", x"E7D45C", x"E7F1C6",
+         x"E80E33", x"E82980", x"E8438F", x"E85C44", x"E87385", x"E8893D", x"E89D5B", x"E8AFD1",
+         x"E8C095", x"E8CFA2", x"E8DCF6", x"E8E894", x"E8F281", x"E8FACA", x"E9017C", x"E906A9",
+         x"E90A68", x"E90CD2", x"E90E02", x"E90E19", x"E90D38", x"E90B82", x"E9091E", x"E90633",
+         x"E902EA", x"E8FF6B", x"E8FBE1", x"E8F876", x"E8F552", x"E8F29E", x"E8F083", x"E8EF24",
+         x"E8EEA8", x"E8EF2F", x"E8F0DA", x"E8F3C4", x"E8F807", x"E8FDBA", x"E904F0", x"E90DB7",
+         x"E9181B", x"E92424", x"E931D5", x"E9412E", x"E9522B", x"E964C4", x"E978EB", x"E98E93",
+         x"E9A5A7", x"E9BE11", x"E9D7B7", x"E9F27D", x"EA0E43", x"EA2AE8", x"EA4849", x"EA663F",
+         x"EA84A5", x"EAA354", x"EAC222", x"EAE0E7", x"EAFF7D", x"EB1DBA", x"EB3B78", x"EB5892",
+         x"EB74E4", x"EB904C", x"EBAAAB", x"EBC3E3", x"EBDBDA", x"EBF278", x"EC07AA", x"EC1B60",
+         x"EC2D8B", x"EC3E24", x"EC4D23", x"EC5A89", x"EC6656", x"EC7090", x"EC7942", x"EC8079",
+         x"EC8645", x"EC8ABA", x"EC8DF1", x"EC9002", x"EC910B", x"EC912C", x"EC9085", x"EC8F3A",
+         x"EC8D6F", x"EC8B4B", x"EC88F4", x"EC8690", x"EC8447", x"EC8240", x"EC80A0", x"EC7F8D",
+         x"EC7F29", x"EC7F98", x"EC80F8", x"EC8367", x"EC8701", x"EC8BDD", x"EC9210", x"EC99AD",
+         x"ECA2C2", x"ECAD59", x"ECB97A", x"ECC729", x"ECD665", x"ECE72C", x"ECF974", x"ED0D34",
+         x"ED225D", x"ED38DC", x"ED509D", x"ED6989", x"ED8383", x"ED9E70", x"EDBA2F", x"EDD6A0",
+         x"EDF39F", x"EE1108", x"EE2EB6", x"EE4C84", x"EE6A4C", x"EE87E8", x"EEA531", x"EEC205",
+         x"EEDE40", x"EEF9C0", x"EF1464", x"EF2E0F", x"EF46A5", x"EF5E0E", x"EF7433", x"EF8901",
+         x"EF9C69", x"EFAE5D", x"EFBED5", x"EFCDCC", x"EFDB3F", x"EFE731", x"EFF1A6", x"EFFAA9",
+         x"F00244", x"F00888", x"F00D87", x"F01158", x"F01413", x"F015D3", x"F016B6", x"F016DB",
+         x"F01663", x"F01572", x"F0142A", x"F012B1", x"F0112A", x"F00FBC", x"F00E8A", x"F00DB9",
+         x"F00D6B", x"F00DC4", x"F00EE2", x"F010E4", x"F013E7", x"F01803", x"F01D51", x"F023E4",
+         x"F02BCD", x"F0351B", x"F03FD7", x"F04C0A", x"F059B6", x"F068DC", x"F07979", x"F08B84",
+         x"F09EF6", x"F0B3BE", x"F0C9CE", x"F0E110", x"F0F96F", x"F112D1", x"F12D1A", x"F1482D",
+         x"F163EA", x"F18030", x"F19CDC", x"F1B9CC", x"F1D6DB", x"F1F3E5", x"F210C6", x"F22D5B",
+         x"F24981", x"F26515", x"F27FF8", x"F29A0B", x"F2B332", x"F2CB51", x"F2E251", x"F2F81C",
+         x"F30CA1", x"F31FCF", x"F3319B", x"F341FD", x"F350EE", x"F35E6C", x"F36A7A", x"F3751C",
+         x"F37E5B", x"F38642", x"F38CE0", x"F39246", x"F3968A", x"F399C3", x"F39C0C", x"F39D7F",
+         x"F39E3B", x"F39E60", x"F39E0F", x"F39D6A", x"F39C95", x"F39BB1", x"F39AE3", x"F39A4F",
+         x"F39A16", x"F39A5A", x"F39B3C", x"F39CDB", x"F39F53", x"F3A2C1", x"F3A73D", x"F3ACDD",
+         x"F3B3B5", x"F3BBD6", x"F3C54C", x"F3D023", x"F3DC61", x"F3EA0A", x"F3F91E", x"F4099B",
+         x"F41B7A", x"F42EB0", x"F44332", x"F458EF", x"F46FD4", x"F487CB", x"F4A0BD", x"F4BA8F",
+         x"F4D524", x"F4F05E", x"F50C1D", x"F52840", x"F544A5", x"F56129", x"F57DAA", x"F59A05",
+         x"F5B617", x"F5D1BF", x"F5ECDC", x"F6074F", x"F620FA", x"F639C1", x"F6518C", x"F66841",
+         x"F67DCD", x"F6921E", x"F6A525", x"F6B6D6", x"F6C728", x"F6D616", x"F6E39E", x"F6EFC1",
+         x"F6FA85", x"F703F0", x"F70C0E", x"F712EC", x"F7189D", x"F71D35", x"F720C8", x"F72372",
+         x"F7254C", x"F72674", x"F72709", x"F7272A", x"F726F9", x"F72697", x"F72626", x"F725CA",
+         x"F725A4", x"F725D5", x"F7267F", x"F727C1", x"F729B9", x"F72C84", x"F7303C", x"F734F9",
+         x"F73AD2", x"F741D9", x"F74A1E", x"F753B0", x"F75E97", x"F76ADC", x"F77881", x"F78788",
+         x"F797ED", x"F7A9AB", x"F7BCB8", x"F7D107", x"F7E68A", x"F7FD2E", x"F814DD", x"F82D82",
+         x"F84701", x"F8613F", x"F87C1F", x"F89782", x"F8B347", x"F8CF4D", x"F8EB73", x"F90797",
+         x"F92397", x"F93F51", x"F95AA5", x"F97572", x"F98F9A", x"F9A901", x"F9C189", x"F9D91C",
+         x"F9EFA1", x"FA0504", x"FA1934", x"FA2C22", x"FA3DC2", x"FA4E0C", x"FA5CFA", x"FA6A8A",
+         x"FA76BD", x"FA8198", x"FA8B21", x"FA9365", x"FA9A70", x"FAA053", x"FAA521", x"FAA8F1",
+         x"FAABDB", x"FAADF9", x"FAAF68", x"FAB045", x"FAB0B0", x"FAB0C9", x"FAB0B1", x"FAB08A",
+         x"FAB076", x"FAB095", x"FAB10A", x"FAB1F3", x"FAB371", x"FAB5A0", x"FAB89E", x"FABC83",
+         x"FAC168", x"FAC762", x"FACE84", x"FAD6DF", x"FAE07F", x"FAEB6F", x"FAF7B6", x"FB0557",
+         x"FB1454", x"FB24A9", x"FB3651", x"FB4942", x"FB5D72", x"FB72D0", x"FB894B", x"FBA0CE",
+         x"FBB942", x"FBD28F", x"FBEC99", x"FC0743", x"FC226E", x"FC3DFC", x"FC59CB", x"FC75BA",
+         x"FC91A8", x"FCAD74", x"FCC8FD", x"FCE421", x"FCFEC2", x"FD18C1", x"FD3201", x"FD4A68",
+         x"FD61DD", x"FD7849", x"FD8D97", x"FDA1B7", x"FDB499", x"FDC633", x"FDD67A", x"FDE56B",
+         x"FDF301", x"FDFF40", x"FE0A29", x"FE13C6", x"FE1C1F", x"FE2343", x"FE2943", x"FE2E30",
+         x"FE3221", x"FE352D", x"FE376F", x"FE3902", x"FE3A05", x"FE3A95", x"FE3AD3", x"FE3AE1",
+         x"FE3ADE", x"FE3AEC", x"FE3B2C", x"FE3BC0", x"FE3CC6", x"FE3E5F", x"FE40A6", x"FE43B9",
+         x"FE47B1", x"FE4CA5", x"FE52AC", x"FE59D8", x"FE6239", x"FE6BDD", x"FE76CE", x"FE8312",
+         x"FE90AF", x"FE9FA4", x"FEAFEF", x"FEC18B", x"FED46F", x"FEE88E", x"FEFDDB", x"FF1444",
+         x"FF2BB4", x"FF4414", x"FF5D4C", x"FF7741", x"FF91D7", x"FFACEE", x"FFC867", x"FFE423",
+         x"000000", x"001BDD", x"003799", x"005312", x"006E29", x"0088BF", x"00A2B4", x"00BBEC",
+         x"00D44C", x"00EBBC", x"010225", x"011772", x"012B91", x"013E75", x"015011", x"01605C",
+         x"016F51", x"017CEE", x"018932", x"019423", x"019DC7", x"01A628", x"01AD54", x"01B35B",
+         x"01B84F", x"01BC47", x"01BF5A", x"01C1A1", x"01C33A", x"01C440", x"01C4D4", x"01C514",
+         x"01C522", x"01C51F", x"01C52D", x"01C56B", x"01C5FB", x"01C6FE", x"01C891", x"01CAD3",
+         x"01CDDF", x"01D1D0", x"01D6BD", x"01DCBD", x"01E3E1", x"01EC3A", x"01F5D7", x"0200C0",
+         x"020CFF", x"021A95", x"022986", x"0239CD", x"024B67", x"025E49", x"027269", x"0287B7",
+         x"029E23", x"02B598", x"02CDFF", x"02E73F", x"03013E", x"031BDF", x"033703", x"03528C",
+         x"036E58", x"038A46", x"03A635", x"03C204", x"03DD92", x"03F8BD", x"041367", x"042D71",
+         x"0446BE", x"045F32", x"0476B5", x"048D30", x"04A28E", x"04B6BE", x"04C9AF", x"04DB57",
+         x"04EBAC", x"04FAA9", x"05084A", x"051491", x"051F81", x"052921", x"05317C", x"05389E",
+         x"053E98", x"05437D", x"054762", x"054A60", x"054C8F", x"054E0D", x"054EF6", x"054F6B",
+         x"054F8A", x"054F76", x"054F4F", x"054F37", x"054F50", x"054FBB", x"055098", x"055207",
+         x"055425", x"05570F", x"055ADF", x"055FAD", x"056590", x"056C9B", x"0574DF", x"057E68",
+         x"058943", x"059576", x"05A306", x"05B1F4", x"05C23E", x"05D3DE", x"05E6CC", x"05FAFC",
+         x"06105F", x"0626E4", x"063E77", x"0656FF", x"067066", x"068A8E", x"06A55B", x"06C0AF",
+         x"06DC69", x"06F869", x"07148D", x"0730B3", x"074CB9", x"07687E", x"0783E1", x"079EC1",
+         x"07B8FF", x"07D27E", x"07EB23", x"0802D2", x"081976", x"082EF9", x"084348", x"085655",
+         x"086813", x"087878", x"08877F", x"089524", x"08A169", x"08AC50", x"08B5E2", x"08BE27",
+         x"08C52E", x"08CB07", x"08CFC4", x"08D37C", x"08D647", x"08D83F", x"08D981", x"08DA2B",
+         x"08DA5C", x"08DA36", x"08D9DA", x"08D969", x"08D907", x"08D8D6", x"08D8F7", x"08D98C",
+         x"08DAB4", x"08DC8E", x"08DF38", x"08E2CB", x"08E763", x"08ED14", x"08F3F2", x"08FC10",
+         x"09057B", x"09103F", x"091C62", x"0929EA", x"0938D8", x"09492A", x"095ADB", x"096DE2",
+         x"098233", x"0997BF", x"09AE74", x"09C63F", x"09DF06", x"09F8B1", x"0A1324", x"0A2E41",
+         x"0A49E9", x"0A65FB", x"0A8256", x"0A9ED7", x"0ABB5B", x"0AD7C0", x"0AF3E3", x"0B0FA2",
+         x"0B2ADC", x"0B4571", x"0B5F43", x"0B7835", x"0B902C", x"0BA711", x"0BBCCE", x"0BD150",
+         x"0BE486", x"0BF665", x"0C06E2", x"0C15F6", x"0C239F", x"0C2FDD", x"0C3AB4", x"0C442A",
+         x"0C4C4B", x"0C5323", x"0C58C3", x"0C5D3F", x"0C60AD", x"0C6325", x"0C64C4", x"0C65A6",
+         x"0C65EA", x"0C65B1", x"0C651D", x"0C644F", x"0C636B", x"0C6296", x"0C61F1", x"0C61A0",
+         x"0C61C5", x"0C6281", x"0C63F4", x"0C663D", x"0C6976", x"0C6DBA", x"0C7320", x"0C79BE",
+         x"0C81A5", x"0C8AE4", x"0C9586", x"0CA194", x"0CAF12", x"0CBE03", x"0CCE65", x"0CE031",
+         x"0CF35F", x"0D07E4", x"0D1DAF", x"0D34AF", x"0D4CCE", x"0D65F5", x"0D8008", x"0D9AEB",
+         x"0DB67F", x"0DD2A5", x"0DEF3A", x"0E0C1B", x"0E2925", x"0E4634", x"0E6324", x"0E7FD0",
+         x"0E9C16", x"0EB7D3", x"0ED2E6", x"0EED2F", x"0F0691", x"0F1EF0", x"0F3632", x"0F4C42",
+         x"0F610A", x"0F747C", x"0F8687", x"0F9724", x"0FA64A", x"0FB3F6", x"0FC029", x"0FCAE5",
+         x"0FD433", x"0FDC1C", x"0FE2AF", x"0FE7FD", x"0FEC19", x"0FEF1C", x"0FF11E", x"0FF23C",
+         x"0FF295", x"0FF247", x"0FF176", x"0FF044", x"0FEED6", x"0FED4F", x"0FEBD6", x"0FEA8E",
+         x"0FE99D", x"0FE925", x"0FE94A", x"0FEA2D", x"0FEBED", x"0FEEA8", x"0FF279", x"0FF778",
+         x"0FFDBC", x"100557", x"100E5A", x"1018CF", x"1024C1", x"103234", x"10412B", x"1051A3",
+         x"106397", x"1076FF", x"108BCD", x"10A1F2", x"10B95B", x"10D1F1", x"10EB9C", x"110640",
+         x"1121C0", x"113DFB", x"115ACF", x"117818", x"1195B4", x"11B37C", x"11D14A", x"11EEF8",
+         x"120C61", x"122960", x"1245D1", x"126190", x"127C7D", x"129677", x"12AF63", x"12C724",
+         x"12DDA3", x"12F2CC", x"13068C", x"1318D4", x"13299B", x"1338D7", x"134686", x"1352A7",
+         x"135D3E", x"136653", x"136DF0", x"137423", x"1378FF", x"137C99", x"137F08", x"138068",
+         x"1380D7", x"138073", x"137F60", x"137DC0", x"137BB9", x"137970", x"13770C", x"1374B5",
+         x"137291", x"1370C6", x"136F7B", x"136ED4", x"136EF5", x"136FFE", x"13720F", x"137546",
+         x"1379BB", x"137F87", x"1386BE", x"138F70", x"1399AA", x"13A577", x"13B2DD", x"13C1DC",
+         x"13D275", x"13E4A0", x"13F856", x"140D88", x"142426", x"143C1D", x"145555", x"146FB4",
+         x"148B1C", x"14A76E", x"14C488", x"14E246", x"150083", x"151F19", x"153DDE", x"155CAC",
+         x"157B5B", x"1599C1", x"15B7B7", x"15D518", x"15F1BD", x"160D83", x"162849", x"1641EF",
+         x"165A59", x"16716D", x"168715", x"169B3C", x"16ADD5", x"16BED2", x"16CE2B", x"16DBDC",
+         x"16E7E5", x"16F249", x"16FB10", x"170246", x"1707F9", x"170C3C", x"170F26", x"1710D1",
+         x"171158", x"1710DC", x"170F7D", x"170D62", x"170AAE", x"17078A", x"17041F", x"170095",
+         x"16FD16", x"16F9CD", x"16F6E2", x"16F47E", x"16F2C8", x"16F1E7", x"16F1FE", x"16F32E",
+         x"16F598", x"16F957", x"16FE84", x"170536", x"170D7F", x"17176C", x"17230A", x"17305E",
+         x"173F6B", x"17502F", x"1762A5", x"1776C3", x"178C7B", x"17A3BC", x"17BC71", x"17D680",
+         x"17F1CD", x"180E3A", x"182BA4", x"1849E8", x"1868DD", x"18885E", x"18A83F", x"18C856",
+         x"18E878", x"190879", x"19282E", x"19476D", x"19660B", x"1983E1", x"19A0C8", x"19BC9B",
+         x"19D738", x"19F081", x"1A0859", x"1A1EA8", x"1A3359", x"1A465A", x"1A579E", x"1A671C",
+         x"1A74D0", x"1A80B7", x"1A8AD7", x"1A9336", x"1A99E2", x"1A9EE9", x"1AA261", x"1AA461",
+         x"1AA505", x"1AA46C", x"1AA2B8", x"1AA00C", x"1A9C91", x"1A986F", x"1A93D1", x"1A8EE3",
+         x"1A89D2", x"1A84CC", x"1A7FFD", x"1A7B94", x"1A77BB", x"1A749E", x"1A7266", x"1A713C",
+         x"1A7142", x"1A729D", x"1A756A", x"1A79C5", x"1A7FC8", x"1A8785", x"1A910E", x"1A9C6D",
+         x"1AA9AB", x"1AB8CA", x"1AC9CA", x"1ADCA4", x"1AF14E", x"1B07BA", x"1B1FD4", x"1B3985",
+         x"1B54B3", x"1B713F", x"1B8F08", x"1BADE8", x"1BCDB8", x"1BEE4D", x"1C0F7C", x"1C3117",
+         x"1C52F0", x"1C74D7", x"1C969C", x"1CB810", x"1CD904", x"1CF94A", x"1D18B6", x"1D371C",
+         x"1D5456", x"1D703D", x"1D8AAE", x"1DA38C", x"1DBABA", x"1DD020", x"1DE3AC", x"1DF54F",
+         x"1E04FE", x"1E12B2", x"1E1E6C", x"1E282F", x"1E3003", x"1E35F5", x"1E3A16", x"1E3C7D",
+         x"1E3D44", x"1E3C88", x"1E3A6B", x"1E3714", x"1E32A9", x"1E2D56", x"1E2749", x"1E20B0",
+         x"1E19BC", x"1E129F", x"1E0B8B", x"1E04B2", x"1DFE47", x"1DF87A", x"1DF37B", x"1DEF78",
+         x"1DEC9D", x"1DEB14", x"1DEB03", x"1DEC8B", x"1DEFCE", x"1DF4E5", x"1DFBE8", x"1E04E9",
+         x"1E0FF5", x"1E1D16", x"1E2C4F", x"1E3DA0", x"1E5102", x"1E666A", x"1E7DC8", x"1E9708",
+         x"1EB210", x"1ECEC2", x"1EECFE", x"1F0C9D", x"1F2D76", x"1F4F5E", x"1F7226", x"1F959C",
+         x"1FB98E", x"1FDDC8", x"200214", x"20263D", x"204A0F", x"206D53", x"208FD7", x"20B169",
+         x"20D1D9", x"20F0F8", x"210E9E", x"212AA2", x"2144E2", x"215D3E", x"21739B", x"2187E4",
+         x"219A06", x"21A9F6", x"21B7AC", x"21C327", x"21CC6A", x"21D37F", x"21D873", x"21DB59",
+         x"21DC4A", x"21DB63", x"21D8C6", x"21D498", x"21CF03", x"21C834", x"21C05C", x"21B7AD",
+         x"21AE5D", x"21A4A3", x"219AB6", x"2190D1", x"21872C", x"217DFF", x"217583", x"216DEE",
+         x"216775", x"216249", x"215E9A", x"215C94", x"215C5F", x"215E1E", x"2161F2", x"2167F4",
+         x"21703A", x"217AD5", x"2187CF", x"21972D", x"21A8EF", x"21BD0D", x"21D37D", x"21EC2C",
+         x"220703", x"2223E7", x"2242B5", x"226348", x"228574", x"22A90D", x"22CDDE", x"22F3B4",
+         x"231A56", x"234189", x"236913", x"2390B7", x"23B836", x"23DF53", x"2405D3", x"242B79",
+         x"24500B", x"247352", x"24951A", x"24B530", x"24D368", x"24EF98", x"25099B", x"252152",
+         x"2536A2", x"254976", x"2559C1", x"256778", x"25729A", x"257B29", x"25812F", x"2584BC",
+         x"2585E5", x"2584C6", x"258180", x"257C39", x"25751D", x"256C5B", x"256228", x"2556BC",
+         x"254A52", x"253D27", x"252F7C", x"252191", x"2513AA", x"250609", x"24F8F0", x"24ECA1",
+         x"24E15C", x"24D75F", x"24CEE4", x"24C824", x"24C352", x"24C09F", x"24C035", x"24C239",
+         x"24C6CC", x"24CE08", x"24D800", x"24E4C3", x"24F456", x"2506BB", x"251BEB", x"2533D7",
+         x"254E6D", x"256B93", x"258B26", x"25AD02", x"25D0F8", x"25F6D9", x"261E6D", x"26477A",
+         x"2671C0", x"269CFF", x"26C8F0", x"26F54E", x"2721D0", x"274E2C", x"277A1B", x"27A554",
+         x"27CF8E", x"27F885", x"281FF7", x"2845A3", x"28694E", x"288AC1", x"28A9CA", x"28C63B",
+         x"28DFEE", x"28F6C2", x"290A9E", x"291B6E", x"292926", x"2933C2", x"293B45", x"293FB9",
+         x"294130", x"293FC3", x"293B91", x"2934C2", x"292B83", x"292007", x"291287", x"290342",
+         x"28F27B", x"28E079", x"28CD86", x"28B9EF", x"28A604", x"289216", x"287E74", x"286B71",
+         x"28595D", x"284885", x"283937", x"282BBA", x"282053", x"281744", x"2810C8", x"280D14",
+         x"280C57", x"280EBB", x"281460", x"281D62", x"2829D0", x"2839B7", x"284D17", x"2863EA",
+         x"287E22", x"289BA6", x"28BC59", x"28E014", x"2906A7", x"292FDE", x"295B7C", x"29893E",
+         x"29B8DE", x"29EA0C", x"2A1C79", x"2A4FCF", x"2A83B7", x"2AB7D5", x"2AEBD0", x"2B1F4C",
+         x"2B51EE", x"2B835B", x"2BB33D", x"2BE13F", x"2C0D10", x"2C3664", x"2C5CF4", x"2C8080",
+         x"2CA0CC", x"2CBDA7", x"2CD6E4", x"2CEC62", x"2CFE06", x"2D0BBF", x"2D1585", x"2D1B59",
+         x"2D1D46", x"2D1B61", x"2D15C7", x"2D0C9F", x"2D0017", x"2CF069", x"2CDDD4", x"2CC89F",
+         x"2CB119", x"2C9796", x"2C7C71", x"2C6008", x"2C42BE", x"2C24F9", x"2C0720", x"2BE99D",
+         x"2BCCD7", x"2BB139", x"2B9727", x"2B7F07", x"2B6937", x"2B5614", x"2B45F3", x"2B3924",
+         x"2B2FEF", x"2B2A95", x"2B294D", x"2B2C47", x"2B33A7", x"2B3F89", x"2B4FFD", x"2B6509",
+         x"2B7EA7", x"2B9CC7", x"2BBF4E", x"2BE616", x"2C10F0", x"2C3FA0", x"2C71E1", x"2CA767",
+         x"2CDFDB", x"2D1ADF", x"2D580E", x"2D96FC", x"2DD738", x"2E184E", x"2E59C5", x"2E9B21",
+         x"2EDBE9", x"2F1B9E", x"2F59C8", x"2F95EE", x"2FCF9A", x"30065E", x"3039CD", x"306985",
+         x"309529", x"30BC65", x"30DEF0", x"30FC89", x"3114FD", x"312822", x"3135DB", x"313E18",
+         x"3140D6", x"313E1D", x"313606", x"3128B4", x"311657", x"30FF2C", x"30E37F", x"30C3A3",
+         x"309FF9", x"3078EC", x"304EF0", x"302281", x"2FF423", x"2FC461", x"2F93CB", x"2F62F4",
+         x"2F3271", x"2F02DB", x"2ED4C9", x"2EA8CF", x"2E7F82", x"2E5970", x"2E3721", x"2E1918",
+         x"2DFFCE", x"2DEBB2", x"2DDD2B", x"2DD493", x"2DD235", x"2DD651", x"2DE117", x"2DF2AA",
+         x"2E0B1C", x"2E2A6D", x"2E5091", x"2E7D68", x"2EB0C3", x"2EEA62", x"2F29F7", x"2F6F22",
+         x"2FB976", x"300878", x"305B9F", x"30B255", x"310BFC", x"3167EA", x"31C56C", x"3223CA",
+         x"328247", x"32E021", x"333C93", x"3396DC", x"33EE37", x"3441E8", x"349133", x"34DB67",
+         x"351FDA", x"355DEA", x"359506", x"35C4A7", x"35EC56", x"360BAC", x"362254", x"36300D",
+         x"3634A6", x"363007", x"36222B", x"360B23", x"35EB14", x"35C23D", x"3590F1", x"355797",
+         x"3516AE", x"34CEC8", x"34808C", x"342CB2", x"33D405", x"337761", x"3317AC", x"32B5DF",
+         x"3252FA", x"31F006", x"318E14", x"312E3A", x"30D18F", x"30792B", x"302622", x"2FD985",
+         x"2F945C", x"2F57A5", x"2F2453", x"2EFB48", x"2EDD56", x"2ECB3B", x"2EC5A1", x"2ECD17",
+         x"2EE214", x"2F04F6", x"2F35F9", x"2F753E", x"2FC2C6", x"301E71", x"3087FD", x"30FF07",
+         x"318309", x"32135C", x"32AF36", x"3355AB", x"3405B0", x"34BE1A", x"357D9D", x"3642D2",
+         x"370C36", x"37D82E", x"38A506", x"3970F6", x"3A3A23", x"3AFEA4", x"3BBC82", x"3C71BD",
+         x"3D1C4E", x"3DBA2C", x"3E494D", x"3EC7AB", x"3F3349", x"3F8A30", x"3FCA7C", x"3FF256",
+         x"3FFFFF", x"3FF1CD", x"3FC633", x"3F7BC0", x"3F1125", x"3E8536", x"3DD6ED", x"3D056B",
+         x"3C0FFD", x"3AF619", x"39B764", x"3853B2", x"36CB03", x"351D8B", x"334BAB", x"3155F7",
+         x"2F3D30", x"2D0248", x"2AA660", x"282AC5", x"2590F0", x"22DA83", x"20094B", x"1D1F36",
+         x"1A1E5A", x"1708E8", x"13E131", x"10A9A1", x"0D64B8", x"0A150A", x"06BD3C", x"035FFB"),
+        -- octave 6
+        (x"000000", x"FE51E2", x"FCA419", x"FAF6FC", x"F94ADF", x"F7A018", x"F5F6FB", x"F44FDB",
+         x"F2AB0D", x"F108E2", x"EF69AD", x"EDCDBD", x"EC3562", x"EAA0EA", x"E910A2", x"E784D5",
+         x"E5FDCD", x"E47BD3", x"E2FF2C", x"E1881E", x"E016EB", x"DEABD4", x"DD4717", x"DBE8F1",
+         x"DA919C", x"D94151", x"D7F844", x"D6B6A9", x"D57CB0", x"D44A89", x"D3205D", x"D1FE56",
+         x"D0E49A", x"CFD34D", x"CECA8E", x"CDCA7C", x"CCD332", x"CBE4C8", x"CAFF53", x"CA22E5",
+         x"C94F8D", x"C88559", x"C7C452", x"C70C7E", x"C65DE1", x"C5B87D", x"C51C4E", x"C48952",
+         x"C3FF7F", x"C37ECB", x"C3072A", x"C2988B", x"C232DC", x"C1D607", x"C181F6", x"C1368D",
+         x"C0F3B0", x"C0B940", x"C0871B", x"C05D1D", x"C03B21", x"C020FF", x"C00E8C", x"C0039C",
+         x"C00001", x"C0038C", x"C00E0A", x"C01F49", x"C03714", x"C05535", x"C07974", x"C0A399",
+         x"C0D369", x"C108AA", x"C14320", x"C1828D", x"C1C6B5", x"C20F59", x"C25C3B", x"C2AD1B",
+         x"C301B9", x"C359D6", x"C3B531", x"C4138C", x"C474A5", x"C4D83D", x"C53E14", x"C5A5EB",
+         x"C60F84", x"C67AA0", x"C6E701", x"C7546A", x"C7C2A0", x"C83167", x"C8A085", x"C90FC0",
+         x"C97EE1", x"C9EDB1", x"CA5BFA", x"CAC988", x"CB3628", x"CBA1A9", x"CC0BDB", x"CC7491",
+         x"CCDB9D", x"CD40D5", x"CDA410", x"CE0527", x"CE63F4", x"CEC054", x"CF1A26", x"CF714A",
+         x"CFC5A3", x"D01715", x"D06586", x"D0B0DF", x"D0F90B", x"D13DF7", x"D17F90", x"D1BDC9",
+         x"D1F893", x"D22FE4", x"D263B2", x"D293F7", x"D2C0AE", x"D2E9D4", x"D30F67", x"D33169",
+         x"D34FDC", x"D36AC6", x"D3822D", x"D39618", x"D3A694", x"D3B3AA", x"D3BD6A", x"D3C3E1",
+         x"D3C721", x"D3C73D", x"D3C447", x"D3BE55", x"D3B57D", x"D3A9D7", x"D39B7C", x"D38A86",
+         x"D37711", x"D36137", x"D34916", x"D32ECD", x"D3127A", x"D2F43C", x"D2D433", x"D2B281",
+         x"D28F45", x"D26AA2", x"D244BA", x"D21DAE", x"D1F5A1", x"D1CCB6", x"D1A30F", x"D178CE",
+         x"D14E16", x"D12309", x"D0F7CA", x"D0CC79", x"D0A139", x"D0762A", x"D04B6C", x"D02120",
+         x"CFF764", x"CFCE58", x"CFA618", x"CF7EC3", x"CF5874", x"CF3346", x"CF0F54", x"CEECB8",
+         x"CECB89", x"CEABDE", x"CE8DCF", x"CE7170", x"CE56D5", x"CE3E11", x"CE2735", x"CE1251",
+         x"CDFF74", x"CDEEAC", x"CDE005", x"CDD38A", x"CDC944", x"CDC13D", x"CDBB7B", x"CDB804",
+         x"CDB6DB", x"CDB804", x"CDBB81", x"CDC152", x"CDC975", x"CDD3E9", x"CDE0AA", x"CDEFB3",
+         x"CE00FE", x"CE1484", x"CE2A3C", x"CE421C", x"CE5C1B", x"CE782B", x"CE9641", x"CEB64E",
+         x"CED843", x"CEFC11", x"CF21A7", x"CF48F3", x"CF71E3", x"CF9C64", x"CFC862", x"CFF5C8",
+         x"D02481", x"D05479", x"D08597", x"D0B7C7", x"D0EAF1", x"D11EFD", x"D153D4", x"D1895E",
+         x"D1BF83", x"D1F62A", x"D22D3B", x"D2649F", x"D29C3C", x"D2D3FA", x"D30BC2", x"D3437B",
+         x"D37B0D", x"D3B261", x"D3E961", x"D41FF5", x"D45607", x"D48B81", x"D4C04E", x"D4F459",
+         x"D5278E", x"D559D9", x"D58B28", x"D5BB69", x"D5EA89", x"D61879", x"D64528", x"D67088",
+         x"D69A8B", x"D6C322", x"D6EA42", x"D70FDF", x"D733F0", x"D75669", x"D77744", x"D79677",
+         x"D7B3FE", x"D7CFD1", x"D7E9ED", x"D8024D", x"D818F1", x"D82DD5", x"D840F9", x"D8525E",
+         x"D86205", x"D86FF1", x"D87C25", x"D886A6", x"D88F78", x"D896A2", x"D89C2B", x"D8A01B",
+         x"D8A27A", x"D8A353", x"D8A2B1", x"D8A09D", x"D89D24", x"D89853", x"D89238", x"D88ADF",
+         x"D88259", x"D878B3", x"D86DFE", x"D8624A", x"D855A8", x"D84829", x"D839DE", x"D82AD9",
+         x"D81B2C", x"D80AEA", x"D7FA25", x"D7E8F1", x"D7D75F", x"D7C582", x"D7B36F", x"D7A138",
+         x"D78EF0", x"D77CA9", x"D76A78", x"D7586D", x"D7469C", x"D73517", x"D723F0", x"D71338",
+         x"D70300", x"D6F35A", x"D6E456", x"D6D603", x"D6C872", x"D6BBB1", x"D6AFCE", x"D6A4D7",
+         x"D69ADA", x"D691E3", x"D689FE", x"D68336", x"D67D96", x"D67927", x"D675F2", x"D67400",
+         x"D67359", x"D67402", x"D67603", x"D67960", x"D67E1D", x"D6843E", x"D68BC7", x"D694B7",
+         x"D69F12", x"D6AAD7", x"D6B805", x"D6C69C", x"D6D698", x"D6E7F8", x"D6FAB7", x"D70ED2",
+         x"D72442", x"D73B02", x"D7530B", x"D76C56", x"D786DB", x"D7A291", x"D7BF6F", x"D7DD6B",
+         x"D7FC7A", x"D81C91", x"D83DA5", x"D85FA9", x"D88291", x"D8A650", x"D8CAD9", x"D8F01D",
+         x"D9160E", x"D93C9E", x"D963BE", x"D98B60", x"D9B373", x"D9DBE8", x"DA04B1", x"DA2DBC",
+         x"DA56FB", x"DA805E", x"DAA9D4", x"DAD34F", x"DAFCBE", x"DB2612", x"DB4F3C", x"DB782C",
+         x"DBA0D2", x"DBC922", x"DBF10B", x"DC187F", x"DC3F71", x"DC65D3", x"DC8B98", x"DCB0B3",
+         x"DCD517", x"DCF8BA", x"DD1B8F", x"DD3D8B", x"DD5EA5", x"DD7ED3", x"DD9E0A", x"DDBC44",
+         x"DDD977", x"DDF59D", x"DE10AE", x"DE2AA5", x"DE437C", x"DE5B2E", x"DE71B8", x"DE8716",
+         x"DE9B44", x"DEAE42", x"DEC00E", x"DED0A7", x"DEE00E", x"DEEE42", x"DEFB46", x"DF071B",
+         x"DF11C5", x"DF1B46", x"DF23A4", x"DF2AE1", x"DF3105", x"DF3614", x"DF3A16", x"DF3D11",
+         x"DF3F0E", x"DF4013", x"DF402B", x"DF3F5E", x"DF3DB6", x"DF3B3D", x"DF37FE", x"DF3403",
+         x"DF2F58", x"DF2A0A", x"DF2422", x"DF1DAF", x"DF16BD", x"DF0F58", x"DF078D", x"DEFF6A",
+         x"DEF6FB", x"DEEE4F", x"DEE573", x"DEDC75", x"DED361", x"DECA46", x"DEC132", x"DEB831",
+         x"DEAF51", x"DEA6A0", x"DE9E2A", x"DE95FC", x"DE8E23", x"DE86AC", x"DE7FA3", x"DE7914",
+         x"DE730A", x"DE6D90", x"DE68B2", x"DE6479", x"DE60F1", x"DE5E22", x"DE5C16", x"DE5AD6",
+         x"DE5A6A", x"DE5AD9", x"DE5C2A", x"DE5E66", x"DE6190", x"DE65B0", x"DE6ACA", x"DE70E2",
+         x"DE77FD", x"DE801D", x"DE8945", x"DE9378", x"DE9EB6", x"DEAB01", x"DEB858", x"DEC6BC",
+         x"DED62B", x"DEE6A4", x"DEF824", x"DF0AA9", x"DF1E30", x"DF32B4", x"DF4832", x"DF5EA3",
+         x"DF7603", x"DF8E4C", x"DFA777", x"DFC17C", x"DFDC55", x"DFF7FA", x"E01462", x"E03184",
+         x"E04F58", x"E06DD3", x"E08CEC", x"E0AC98", x"E0CCCE", x"E0ED82", x"E10EA9", x"E13038",
+         x"E15224", x"E17461", x"E196E3", x"E1B99F", x"E1DC88", x"E1FF92", x"E222B2", x"E245DB",
+         x"E26901", x"E28C18", x"E2AF15", x"E2D1EB", x"E2F48F", x"E316F5", x"E33912", x"E35ADA",
+         x"E37C44", x"E39D43", x"E3BDCD", x"E3DDD9", x"E3FD5D", x"E41C4E", x"E43AA5", x"E45857",
+         x"E4755E", x"E491B0", x"E4AD47", x"E4C81A", x"E4E225", x"E4FB60", x"E513C6", x"E52B51",
+         x"E541FD", x"E557C7", x"E56CA9", x"E580A2", x"E593AE", x"E5A5CC", x"E5B6FA", x"E5C737",
+         x"E5D683", x"E5E4DE", x"E5F248", x"E5FEC3", x"E60A51", x"E614F3", x"E61EAE", x"E62783",
+         x"E62F78", x"E6368F", x"E63CCF", x"E6423B", x"E646DB", x"E64AB4", x"E64DCD", x"E6502D",
+         x"E651DB", x"E652DF", x"E65342", x"E6530B", x"E65244", x"E650F5", x"E64F29", x"E64CE8",
+         x"E64A3D", x"E64732", x"E643D1", x"E64024", x"E63C37", x"E63813", x"E633C5", x"E62F55",
+         x"E62AD1", x"E62641", x"E621B2", x"E61D2F", x"E618C1", x"E61475", x"E61054", x"E60C69",
+         x"E608BE", x"E6055F", x"E60254", x"E5FFA8", x"E5FD64", x"E5FB92", x"E5FA3B", x"E5F966",
+         x"E5F91E", x"E5F969", x"E5FA50", x"E5FBD9", x"E5FE0D", x"E600F1", x"E6048C", x"E608E4",
+         x"E60DFD", x"E613DD", x"E61A88", x"E62201", x"E62A4E", x"E6336F", x"E63D69", x"E6483C",
+         x"E653EB", x"E66076", x"E66DDE", x"E67C23", x"E68B44", x"E69B41", x"E6AC18", x"E6BDC7",
+         x"E6D04C", x"E6E3A3", x"E6F7C9", x"E70CBB", x"E72274", x"E738F0", x"E75029", x"E7681A",
+         x"E780BC", x"E79A0A", x"E7B3FD", x"E7CE8D", x"E7E9B3", x"E80568", x"E821A4", x"E83E5D",
+         x"E85B8C", x"E87928", x"E89727", x"E8B581", x"E8D42C", x"E8F31E", x"E9124D", x"E931B1",
+         x"E9513E", x"E970EA", x"E990AD", x"E9B07A", x"E9D04A", x"E9F010", x"EA0FC4", x"EA2F5C",
+         x"EA4ECC", x"EA6E0C", x"EA8D12", x"EAABD5", x"EACA4A", x"EAE86A", x"EB062A", x"EB2383",
+         x"EB406B", x"EB5CDB", x"EB78CB", x"EB9433", x"EBAF0C", x"EBC94F", x"EBE2F5", x"EBFBF8",
+         x"EC1453", x"EC2BFF", x"EC42F8", x"EC5939", x"EC6EBF", x"EC8384", x"EC9786", x"ECAAC3",
+         x"ECBD36", x"ECCEE0", x"ECDFBD", x"ECEFCD", x"ECFF10", x"ED0D84", x"ED1B2B", x"ED2806",
+         x"ED3415", x"ED3F5A", x"ED49D8", x"ED5391", x"ED5C87", x"ED64C0", x"ED6C3D", x"ED7305",
+         x"ED791A", x"ED7E84", x"ED8346", x"ED8767", x"ED8AED", x"ED8DDE", x"ED9042", x"ED9220",
+         x"ED937E", x"ED9465", x"ED94DD", x"ED94EE", x"ED94A0", x"ED93FC", x"ED930B", x"ED91D5",
+         x"ED9065", x"ED8EC2", x"ED8CF6", x"ED8B0C", x"ED890B", x"ED86FF", x"ED84EF", x"ED82E6",
+         x"ED80ED", x"ED7F0E", x"ED7D51", x"ED7BC0", x"ED7A65", x"ED7947", x"ED7871", x"ED77EA",
+         x"ED77BB", x"ED77ED", x"ED7887", x"ED7991", x"ED7B12", x"ED7D12", x"ED7F98", x"ED82AB",
+         x"ED8650", x"ED8A8D", x"ED8F69", x"ED94E8", x"ED9B0F", x"EDA1E3", x"EDA968", x"EDB1A1",
+         x"EDBA92", x"EDC43D", x"EDCEA6", x"EDD9CD", x"EDE5B5", x"EDF25E", x"EDFFC9", x"EE0DF7",
+         x"EE1CE8", x"EE2C9A", x"EE3D0C", x"EE4E3E", x"EE602D", x"EE72D6", x"EE8638", x"EE9A4E",
+         x"EEAF16", x"EEC48B", x"EEDAA9", x"EEF16B", x"EF08CC", x"EF20C6", x"EF3955", x"EF5271",
+         x"EF6C15", x"EF8639", x"EFA0D6", x"EFBBE6", x"EFD761", x"EFF33F", x"F00F78", x"F02C04",
+         x"F048DA", x"F065F3", x"F08345", x"F0A0C8", x"F0BE73", x"F0DC3D", x"F0FA1E", x"F1180B",
+         x"F135FC", x"F153E9", x"F171C7", x"F18F8F", x"F1AD36", x"F1CAB6", x"F1E803", x"F20517",
+         x"F221E9", x"F23E70", x"F25AA4", x"F2767E", x"F291F5", x"F2AD02", x"F2C79F", x"F2E1C3",
+         x"F2FB69", x"F3148A", x"F32D20", x"F34525", x"F35C94", x"F37367", x"F3899A", x"F39F29",
+         x"F3B410", x"F3C84B", x"F3DBD6", x"F3EEB0", x"F400D5", x"F41244", x"F422FB", x"F432F9",
+         x"F4423D", x"F450C6", x"F45E96", x"F46BAD", x"F4780A", x"F483B1", x"F48EA2", x"F498DF",
+         x"F4A26C", x"F4AB4B", x"F4B37F", x"F4BB0D", x"F4C1F8", x"F4C846", x"F4CDF9", x"F4D319",
+         x"F4D7A9", x"F4DBB1", x"F4DF36", x"F4E23F", x"F4E4D2", x"F4E6F6", x"F4E8B2", x"F4EA0F",
+         x"F4EB12", x"F4EBC4", x"F4EC2E", x"F4EC57", x"F4EC47", x"F4EC07", x"F4EBA0", x"F4EB19",
+         x"F4EA7C", x"F4E9D1", x"F4E920", x"F4E874", x"F4E7D3", x"F4E748", x"F4E6D9", x"F4E691",
+         x"F4E677", x"F4E694", x"F4E6EF", x"F4E792", x"F4E883", x"F4E9CA", x"F4EB6F", x"F4ED7A",
+         x"F4EFF0", x"F4F2DA", x"F4F63C", x"F4FA1F", x"F4FE86", x"F50379", x"F508FD", x"F50F16",
+         x"F515C9", x"F51D1A", x"F5250E", x"F52DA7", x"F536EA", x"F540D8", x"F54B74", x"F556C1",
+         x"F562C0", x"F56F71", x"F57CD7", x"F58AF1", x"F599BF", x"F5A940", x"F5B975", x"F5CA5C",
+         x"F5DBF3", x"F5EE38", x"F60129", x"F614C2", x"F62902", x"F63DE4", x"F65364", x"F6697E",
+         x"F6802E", x"F6976F", x"F6AF3A", x"F6C78C", x"F6E05D", x"F6F9A8", x"F71367", x"F72D92",
+         x"F74823", x"F76312", x"F77E59", x"F799EF", x"F7B5CE", x"F7D1EC", x"F7EE43", x"F80ACA",
+         x"F82778", x"F84446", x"F8612B", x"F87E1F", x"F89B18", x"F8B810", x"F8D4FD", x"F8F1D7",
+         x"F90E95", x"F92B2F", x"F9479D", x"F963D7", x"F97FD5", x"F99B8F", x"F9B6FD", x"F9D218",
+         x"F9ECD9", x"FA0737", x"FA212D", x"FA3AB4", x"FA53C5", x"FA6C5B", x"FA846E", x"FA9BFB",
+         x"FAB2FB", x"FAC969", x"FADF42", x"FAF480", x"FB0920", x"FB1D1F", x"FB3078", x"FB432A",
+         x"FB5532", x"FB668D", x"FB773B", x"FB873A", x"FB9688", x"FBA526", x"FBB314", x"FBC051",
+         x"FBCCDE", x"FBD8BE", x"FBE3F0", x"FBEE78", x"FBF856", x"FC018F", x"FC0A25", x"FC121A",
+         x"FC1974", x"FC2037", x"FC2666", x"FC2C06", x"FC311D", x"FC35B0", x"FC39C4", x"FC3D60",
+         x"FC408A", x"FC4349", x"FC45A2", x"FC479D", x"FC4942", x"FC4A98", x"FC4BA5", x"FC4C72",
+         x"FC4D08", x"FC4D6C", x"FC4DA9", x"FC4DC6", x"FC4DCA", x"FC4DBF", x"FC4DAD", x"FC4D9D",
+         x"FC4D95", x"FC4D9F", x"FC4DC4", x"FC4E0A", x"FC4E7B", x"FC4F1E", x"FC4FFB", x"FC511B",
+         x"FC5284", x"FC543E", x"FC5651", x"FC58C3", x"FC5B9B", x"FC5EE0", x"FC6298", x"FC66CA",
+         x"FC6B7C", x"FC70B1", x"FC7671", x"FC7CC0", x"FC83A3", x"FC8B1D", x"FC9333", x"FC9BE9",
+         x"FCA541", x"FCAF3F", x"FCB9E4", x"FCC534", x"FCD12F", x"FCDDD7", x"FCEB2E", x"FCF933",
+         x"FD07E7", x"FD1749", x"FD2759", x"FD3816", x"FD497F", x"FD5B91", x"FD6E4B", x"FD81A9",
+         x"FD95AA", x"FDAA49", x"FDBF83", x"FDD555", x"FDEBB9", x"FE02AB", x"FE1A26", x"FE3225",
+         x"FE4AA2", x"FE6397", x"FE7CFF", x"FE96D2", x"FEB10A", x"FECBA1", x"FEE68E", x"FF01CC",
+         x"FF1D52", x"FF3918", x"FF5518", x"FF7148", x"FF8DA2", x"FFAA1C", x"FFC6B0", x"FFE354",
+         x"000000", x"001CAC", x"003950", x"0055E4", x"00725E", x"008EB8", x"00AAE8", x"00C6E8",
+         x"00E2AE", x"00FE34", x"011972", x"01345F", x"014EF6", x"01692E", x"018301", x"019C69",
+         x"01B55E", x"01CDDB", x"01E5DA", x"01FD55", x"021447", x"022AAB", x"02407D", x"0255B7",
+         x"026A56", x"027E57", x"0291B5", x"02A46F", x"02B681", x"02C7EA", x"02D8A7", x"02E8B7",
+         x"02F819", x"0306CD", x"0314D2", x"032229", x"032ED1", x"033ACC", x"03461C", x"0350C1",
+         x"035ABF", x"036417", x"036CCD", x"0374E3", x"037C5D", x"038340", x"03898F", x"038F4F",
+         x"039484", x"039936", x"039D68", x"03A120", x"03A465", x"03A73D", x"03A9AF", x"03ABC2",
+         x"03AD7C", x"03AEE5", x"03B005", x"03B0E2", x"03B185", x"03B1F6", x"03B23C", x"03B261",
+         x"03B26B", x"03B263", x"03B253", x"03B241", x"03B236", x"03B23A", x"03B257", x"03B294",
+         x"03B2F8", x"03B38E", x"03B45B", x"03B568", x"03B6BE", x"03B863", x"03BA5E", x"03BCB7",
+         x"03BF76", x"03C2A0", x"03C63C", x"03CA50", x"03CEE3", x"03D3FA", x"03D99A", x"03DFC9",
+         x"03E68C", x"03EDE6", x"03F5DB", x"03FE71", x"0407AA", x"041188", x"041C10", x"042742",
+         x"043322", x"043FAF", x"044CEC", x"045ADA", x"046978", x"0478C6", x"0488C5", x"049973",
+         x"04AACE", x"04BCD6", x"04CF88", x"04E2E1", x"04F6E0", x"050B80", x"0520BE", x"053697",
+         x"054D05", x"056405", x"057B92", x"0593A5", x"05AC3B", x"05C54C", x"05DED3", x"05F8C9",
+         x"061327", x"062DE8", x"064903", x"066471", x"06802B", x"069C29", x"06B863", x"06D4D1",
+         x"06F16B", x"070E29", x"072B03", x"0747F0", x"0764E8", x"0781E1", x"079ED5", x"07BBBA",
+         x"07D888", x"07F536", x"0811BD", x"082E14", x"084A32", x"086611", x"0881A7", x"089CEE",
+         x"08B7DD", x"08D26E", x"08EC99", x"090658", x"091FA3", x"093874", x"0950C6", x"096891",
+         x"097FD2", x"099682", x"09AC9C", x"09C21C", x"09D6FE", x"09EB3E", x"09FED7", x"0A11C8",
+         x"0A240D", x"0A35A4", x"0A468B", x"0A56C0", x"0A6641", x"0A750F", x"0A8329", x"0A908F",
+         x"0A9D40", x"0AA93F", x"0AB48C", x"0ABF28", x"0AC916", x"0AD259", x"0ADAF2", x"0AE2E6",
+         x"0AEA37", x"0AF0EA", x"0AF703", x"0AFC87", x"0B017A", x"0B05E1", x"0B09C4", x"0B0D26",
+         x"0B1010", x"0B1286", x"0B1491", x"0B1636", x"0B177D", x"0B186E", x"0B1911", x"0B196C",
+         x"0B1989", x"0B196F", x"0B1927", x"0B18B8", x"0B182D", x"0B178C", x"0B16E0", x"0B162F",
+         x"0B1584", x"0B14E7", x"0B1460", x"0B13F9", x"0B13B9", x"0B13A9", x"0B13D2", x"0B143C",
+         x"0B14EE", x"0B15F1", x"0B174E", x"0B190A", x"0B1B2E", x"0B1DC1", x"0B20CA", x"0B244F",
+         x"0B2857", x"0B2CE7", x"0B3207", x"0B37BA", x"0B3E08", x"0B44F3", x"0B4C81", x"0B54B5",
+         x"0B5D94", x"0B6721", x"0B715E", x"0B7C4F", x"0B87F6", x"0B9453", x"0BA16A", x"0BAF3A",
+         x"0BBDC3", x"0BCD07", x"0BDD05", x"0BEDBC", x"0BFF2B", x"0C1150", x"0C242A", x"0C37B5",
+         x"0C4BF0", x"0C60D7", x"0C7666", x"0C8C99", x"0CA36C", x"0CBADB", x"0CD2E0", x"0CEB76",
+         x"0D0497", x"0D1E3D", x"0D3861", x"0D52FE", x"0D6E0B", x"0D8982", x"0DA55C", x"0DC190",
+         x"0DDE17", x"0DFAE9", x"0E17FD", x"0E354A", x"0E52CA", x"0E7071", x"0E8E39", x"0EAC17",
+         x"0ECA04", x"0EE7F5", x"0F05E2", x"0F23C3", x"0F418D", x"0F5F38", x"0F7CBB", x"0F9A0D",
+         x"0FB726", x"0FD3FC", x"0FF088", x"100CC1", x"10289F", x"10441A", x"105F2A", x"1079C7",
+         x"1093EB", x"10AD8F", x"10C6AB", x"10DF3A", x"10F734", x"110E95", x"112557", x"113B75",
+         x"1150EA", x"1165B2", x"1179C8", x"118D2A", x"119FD3", x"11B1C2", x"11C2F4", x"11D366",
+         x"11E318", x"11F209", x"120037", x"120DA2", x"121A4B", x"122633", x"12315A", x"123BC3",
+         x"12456E", x"124E5F", x"125698", x"125E1D", x"1264F1", x"126B18", x"127097", x"127573",
+         x"1279B0", x"127D55", x"128068", x"1282EE", x"1284EE", x"12866F", x"128779", x"128813",
+         x"128845", x"128816", x"12878F", x"1286B9", x"12859B", x"128440", x"1282AF", x"1280F2",
+         x"127F13", x"127D1A", x"127B11", x"127901", x"1276F5", x"1274F4", x"12730A", x"12713E",
+         x"126F9B", x"126E2B", x"126CF5", x"126C04", x"126B60", x"126B12", x"126B23", x"126B9B",
+         x"126C82", x"126DE0", x"126FBE", x"127222", x"127513", x"127899", x"127CBA", x"12817C",
+         x"1286E6", x"128CFB", x"1293C3", x"129B40", x"12A379", x"12AC6F", x"12B628", x"12C0A6",
+         x"12CBEB", x"12D7FA", x"12E4D5", x"12F27C", x"1300F0", x"131033", x"132043", x"133120",
+         x"1342CA", x"13553D", x"13687A", x"137C7C", x"139141", x"13A6C7", x"13BD08", x"13D401",
+         x"13EBAD", x"140408", x"141D0B", x"1436B1", x"1450F4", x"146BCD", x"148735", x"14A325",
+         x"14BF95", x"14DC7D", x"14F9D6", x"151796", x"1535B6", x"15542B", x"1572EE", x"1591F4",
+         x"15B134", x"15D0A4", x"15F03C", x"160FF0", x"162FB6", x"164F86", x"166F53", x"168F16",
+         x"16AEC2", x"16CE4F", x"16EDB3", x"170CE2", x"172BD4", x"174A7F", x"1768D9", x"1786D8",
+         x"17A474", x"17C1A3", x"17DE5C", x"17FA98", x"18164D", x"183173", x"184C03", x"1865F6",
+         x"187F44", x"1897E6", x"18AFD7", x"18C710", x"18DD8C", x"18F345", x"190837", x"191C5D",
+         x"192FB4", x"194239", x"1953E8", x"1964BF", x"1974BC", x"1983DD", x"199222", x"199F8A",
+         x"19AC15", x"19B7C4", x"19C297", x"19CC91", x"19D5B2", x"19DDFF", x"19E578", x"19EC23",
+         x"19F203", x"19F71C", x"19FB74", x"19FF0F", x"1A01F3", x"1A0427", x"1A05B0", x"1A0697",
+         x"1A06E2", x"1A069A", x"1A05C5", x"1A046E", x"1A029C", x"1A0058", x"19FDAC", x"19FAA1",
+         x"19F742", x"19F397", x"19EFAC", x"19EB8B", x"19E73F", x"19E2D1", x"19DE4E", x"19D9BF",
+         x"19D52F", x"19D0AB", x"19CC3B", x"19C7ED", x"19C3C9", x"19BFDC", x"19BC2F", x"19B8CE",
+         x"19B5C3", x"19B318", x"19B0D7", x"19AF0B", x"19ADBC", x"19ACF5", x"19ACBE", x"19AD21",
+         x"19AE25", x"19AFD3", x"19B233", x"19B54C", x"19B925", x"19BDC5", x"19C331", x"19C971",
+         x"19D088", x"19D87D", x"19E152", x"19EB0D", x"19F5AF", x"1A013D", x"1A0DB8", x"1A1B22",
+         x"1A297D", x"1A38C9", x"1A4906", x"1A5A34", x"1A6C52", x"1A7F5E", x"1A9357", x"1AA839",
+         x"1ABE03", x"1AD4AF", x"1AEC3A", x"1B04A0", x"1B1DDB", x"1B37E6", x"1B52B9", x"1B6E50",
+         x"1B8AA2", x"1BA7A9", x"1BC55B", x"1BE3B2", x"1C02A3", x"1C2227", x"1C4233", x"1C62BD",
+         x"1C83BC", x"1CA526", x"1CC6EE", x"1CE90B", x"1D0B71", x"1D2E15", x"1D50EB", x"1D73E8",
+         x"1D96FF", x"1DBA25", x"1DDD4E", x"1E006E", x"1E2378", x"1E4661", x"1E691D", x"1E8B9F",
+         x"1EADDC", x"1ECFC8", x"1EF157", x"1F127E", x"1F3332", x"1F5368", x"1F7314", x"1F922D",
+         x"1FB0A8", x"1FCE7C", x"1FEB9E", x"200806", x"2023AB", x"203E84", x"205889", x"2071B4",
+         x"2089FD", x"20A15D", x"20B7CE", x"20CD4C", x"20E1D0", x"20F557", x"2107DC", x"21195C",
+         x"2129D5", x"213944", x"2147A8", x"2154FF", x"21614A", x"216C88", x"2176BB", x"217FE3",
+         x"218803", x"218F1E", x"219536", x"219A50", x"219E70", x"21A19A", x"21A3D6", x"21A527",
+         x"21A596", x"21A52A", x"21A3EA", x"21A1DE", x"219F0F", x"219B87", x"21974E", x"219270",
+         x"218CF6", x"2186EC", x"21805D", x"217954", x"2171DD", x"216A04", x"2161D6", x"215960",
+         x"2150AF", x"2147CF", x"213ECE", x"2135BA", x"212C9F", x"21238B", x"211A8D", x"2111B1",
+         x"210905", x"210096", x"20F873", x"20F0A8", x"20E943", x"20E251", x"20DBDE", x"20D5F6",
+         x"20D0A8", x"20CBFD", x"20C802", x"20C4C3", x"20C24A", x"20C0A2", x"20BFD5", x"20BFED",
+         x"20C0F2", x"20C2EF", x"20C5EA", x"20C9EC", x"20CEFB", x"20D51F", x"20DC5C", x"20E4BA",
+         x"20EE3B", x"20F8E5", x"2104BA", x"2111BE", x"211FF2", x"212F59", x"213FF2", x"2151BE",
+         x"2164BC", x"2178EA", x"218E48", x"21A4D2", x"21BC84", x"21D55B", x"21EF52", x"220A63",
+         x"222689", x"2243BC", x"2261F6", x"22812D", x"22A15B", x"22C275", x"22E471", x"230746",
+         x"232AE9", x"234F4D", x"237468", x"239A2D", x"23C08F", x"23E781", x"240EF5", x"2436DE",
+         x"245F2E", x"2487D4", x"24B0C4", x"24D9EE", x"250342", x"252CB1", x"25562C", x"257FA2",
+         x"25A905", x"25D244", x"25FB4F", x"262418", x"264C8D", x"2674A0", x"269C42", x"26C362",
+         x"26E9F2", x"270FE3", x"273527", x"2759B0", x"277D6F", x"27A057", x"27C25B", x"27E36F",
+         x"280386", x"282295", x"284091", x"285D6F", x"287925", x"2893AA", x"28ACF5", x"28C4FE",
+         x"28DBBE", x"28F12E", x"290549", x"291808", x"292968", x"293964", x"2947FB", x"295529",
+         x"2960EE", x"296B49", x"297439", x"297BC2", x"2981E3", x"2986A0", x"2989FD", x"298BFE",
+         x"298CA7", x"298C00", x"298A0E", x"2986D9", x"29826A", x"297CCA", x"297602", x"296E1D",
+         x"296526", x"295B29", x"295032", x"29444F", x"29378E", x"2929FD", x"291BAA", x"290CA6",
+         x"28FD00", x"28ECC8", x"28DC10", x"28CAE9", x"28B964", x"28A793", x"289588", x"288357",
+         x"287110", x"285EC8", x"284C91", x"283A7E", x"2828A1", x"28170F", x"2805DB", x"27F516",
+         x"27E4D4", x"27D527", x"27C622", x"27B7D7", x"27AA58", x"279DB6", x"279202", x"27874D",
+         x"277DA7", x"277521", x"276DC8", x"2767AD", x"2762DC", x"275F63", x"275D4F", x"275CAD",
+         x"275D86", x"275FE5", x"2763D5", x"27695E", x"277088", x"27795A", x"2783DB", x"27900F",
+         x"279DFB", x"27ADA2", x"27BF07", x"27D22B", x"27E70F", x"27FDB3", x"281613", x"28302F",
+         x"284C02", x"286989", x"2888BC", x"28A997", x"28CC10", x"28F021", x"2915BE", x"293CDE",
+         x"296575", x"298F78", x"29BAD8", x"29E787", x"2A1577", x"2A4497", x"2A74D8", x"2AA627",
+         x"2AD872", x"2B0BA7", x"2B3FB2", x"2B747F", x"2BA9F9", x"2BE00B", x"2C169F", x"2C4D9F",
+         x"2C84F3", x"2CBC85", x"2CF43E", x"2D2C06", x"2D63C4", x"2D9B61", x"2DD2C5", x"2E09D6",
+         x"2E407D", x"2E76A2", x"2EAC2C", x"2EE103", x"2F150F", x"2F4839", x"2F7A69", x"2FAB87",
+         x"2FDB7F", x"300A38", x"30379E", x"30639C", x"308E1D", x"30B70D", x"30DE59", x"3103EF",
+         x"3127BD", x"3149B2", x"3169BF", x"3187D5", x"31A3E5", x"31BDE4", x"31D5C4", x"31EB7C",
+         x"31FF02", x"32104D", x"321F56", x"322C17", x"32368B", x"323EAE", x"32447F", x"3247FC",
+         x"324925", x"3247FC", x"324485", x"323EC3", x"3236BC", x"322C76", x"321FFB", x"321154",
+         x"32008C", x"31EDAF", x"31D8CB", x"31C1EF", x"31A92B", x"318E90", x"317231", x"315422",
+         x"313477", x"311348", x"30F0AC", x"30CCBA", x"30A78C", x"30813D", x"3059E8", x"3031A8",
+         x"30089C", x"2FDEE0", x"2FB494", x"2F89D6", x"2F5EC7", x"2F3387", x"2F0836", x"2EDCF7",
+         x"2EB1EA", x"2E8732", x"2E5CF1", x"2E334A", x"2E0A5F", x"2DE252", x"2DBB46", x"2D955E",
+         x"2D70BB", x"2D4D7F", x"2D2BCD", x"2D0BC4", x"2CED86", x"2CD133", x"2CB6EA", x"2C9EC9",
+         x"2C88EF", x"2C757A", x"2C6484", x"2C5629", x"2C4A83", x"2C41AB", x"2C3BB9", x"2C38C3",
+         x"2C38DF", x"2C3C1F", x"2C4296", x"2C4C56", x"2C596C", x"2C69E8", x"2C7DD3", x"2C953A",
+         x"2CB024", x"2CCE97", x"2CF099", x"2D162C", x"2D3F52", x"2D6C09", x"2D9C4E", x"2DD01C",
+         x"2E076D", x"2E4237", x"2E8070", x"2EC209", x"2F06F5", x"2F4F21", x"2F9A7A", x"2FE8EB",
+         x"303A5D", x"308EB6", x"30E5DA", x"313FAC", x"319C0C", x"31FAD9", x"325BF0", x"32BF2B",
+         x"332463", x"338B6F", x"33F425", x"345E57", x"34C9D8", x"353678", x"35A406", x"36124F",
+         x"36811F", x"36F040", x"375F7B", x"37CE99", x"383D60", x"38AB96", x"3918FF", x"398560",
+         x"39F07C", x"3A5A15", x"3AC1EC", x"3B27C3", x"3B8B5B", x"3BEC74", x"3C4ACF", x"3CA62A",
+         x"3CFE47", x"3D52E5", x"3DA3C5", x"3DF0A7", x"3E394B", x"3E7D73", x"3EBCE0", x"3EF756",
+         x"3F2C97", x"3F5C67", x"3F868C", x"3FAACB", x"3FC8EC", x"3FE0B7", x"3FF1F6", x"3FFC74",
+         x"3FFFFF", x"3FFC64", x"3FF174", x"3FDF01", x"3FC4DF", x"3FA2E3", x"3F78E5", x"3F46C0",
+         x"3F0C50", x"3EC973", x"3E7E0A", x"3E29F9", x"3DCD24", x"3D6775", x"3CF8D6", x"3C8135",
+         x"3C0081", x"3B76AE", x"3AE3B2", x"3A4783", x"39A21F", x"38F382", x"383BAE", x"377AA7",
+         x"36B073", x"35DD1B", x"3500AD", x"341B38", x"332CCE", x"323584", x"313572", x"302CB3",
+         x"2F1B66", x"2E01AA", x"2CDFA3", x"2BB577", x"2A8350", x"294957", x"2807BC", x"26BEAF",
+         x"256E64", x"24170F", x"22B8E9", x"21542C", x"1FE915", x"1E77E2", x"1D00D4", x"1B842D",
+         x"1A0233", x"187B2B", x"16EF5E", x"155F16", x"13CA9E", x"123243", x"109653", x"0EF71E",
+         x"0D54F3", x"0BB025", x"0A0905", x"085FE8", x"06B521", x"050904", x"035BE7", x"01AE1E"),
+        -- octave 7
+        (x"000000", x"FF2AF4", x"FE55F2", x"FD8104", x"FCAC35", x"FBD790", x"FB031D", x"FA2EE8",
+         x"F95AFB", x"F88760", x"F7B421", x"F6E147", x"F60EDE", x"F53CF0", x"F46B85", x"F39AA9",
+         x"F2CA65", x"F1FAC3", x"F12BCD", x"F05D8D", x"EF900C", x"EEC354", x"EDF76F", x"ED2C66",
+         x"EC6243", x"EB990F", x"EAD0D3", x"EA0999", x"E94369", x"E87E4E", x"E7BA4F", x"E6F776",
+         x"E635CB", x"E57558", x"E4B625", x"E3F83A", x"E33B9F", x"E2805E", x"E1C67F", x"E10E08",
+         x"E05703", x"DFA178", x"DEED6D", x"DE3AEB", x"DD89F9", x"DCDA9F", x"DC2CE3", x"DB80CE",
+         x"DAD665", x"DA2DB0", x"D986B6", x"D8E17D", x"D83E0C", x"D79C68", x"D6FC99", x"D65EA4",
+         x"D5C28F", x"D5285F", x"D4901C", x"D3F9C9", x"D3656C", x"D2D30B", x"D242AA", x"D1B44E",
+         x"D127FC", x"D09DB9", x"D01588", x"CF8F6E", x"CF0B70", x"CE8990", x"CE09D3", x"CD8C3C",
+         x"CD10CF", x"CC978E", x"CC207E", x"CBABA0", x"CB38F8", x"CAC889", x"CA5A54", x"C9EE5B",
+         x"C984A2", x"C91D29", x"C8B7F3", x"C85501", x"C7F454", x"C795EE", x"C739D0", x"C6DFFB",
+         x"C6886F", x"C6332D", x"C5E035", x"C58F88", x"C54126", x"C4F50E", x"C4AB40", x"C463BC",
+         x"C41E82", x"C3DB90", x"C39AE5", x"C35C81", x"C32062", x"C2E687", x"C2AEEE", x"C27995",
+         x"C2467B", x"C2159E", x"C1E6FB", x"C1BA90", x"C1905B", x"C16858", x"C14285", x"C11EE0",
+         x"C0FD64", x"C0DE0F", x"C0C0DE", x"C0A5CC", x"C08CD7", x"C075FA", x"C06132", x"C04E79",
+         x"C03DCE", x"C02F29", x"C02289", x"C017E7", x"C00F3F", x"C0088C", x"C003C9", x"C000F2",
+         x"C00001", x"C000F0", x"C003BB", x"C0085C", x"C00ECC", x"C01707", x"C02107", x"C02CC5",
+         x"C03A3C", x"C04965", x"C05A3B", x"C06CB6", x"C080D1", x"C09685", x"C0ADCB", x"C0C69E",
+         x"C0E0F5", x"C0FCCB", x"C11A18", x"C138D6", x"C158FD", x"C17A87", x"C19D6C", x"C1C1A6",
+         x"C1E72C", x"C20DF8", x"C23603", x"C25F45", x"C289B6", x"C2B54F", x"C2E209", x"C30FDC",
+         x"C33EC0", x"C36EAF", x"C39FA0", x"C3D18B", x"C4046A", x"C43834", x"C46CE2", x"C4A26B",
+         x"C4D8C9", x"C50FF4", x"C547E3", x"C5808F", x"C5B9F1", x"C5F401", x"C62EB6", x"C66A0A",
+         x"C6A5F5", x"C6E26E", x"C71F6F", x"C75CEF", x"C79AE7", x"C7D950", x"C81822", x"C85756",
+         x"C896E3", x"C8D6C3", x"C916EE", x"C9575D", x"C99809", x"C9D8E9", x"CA19F8", x"CA5B2D",
+         x"CA9C83", x"CADDF1", x"CB1F70", x"CB60FB", x"CBA289", x"CBE415", x"CC2597", x"CC6708",
+         x"CCA863", x"CCE9A0", x"CD2ABA", x"CD6BAA", x"CDAC69", x"CDECF1", x"CE2D3D", x"CE6D46",
+         x"CEAD06", x"CEEC78", x"CF2B95", x"CF6A59", x"CFA8BD", x"CFE6BC", x"D02451", x"D06176",
+         x"D09E26", x"D0DA5C", x"D11614", x"D15148", x"D18BF3", x"D1C612", x"D1FF9E", x"D23895",
+         x"D270F2", x"D2A8AF", x"D2DFCA", x"D3163F", x"D34C09", x"D38125", x"D3B58E", x"D3E943",
+         x"D41C3E", x"D44E7E", x"D47FFE", x"D4B0BC", x"D4E0B4", x"D50FE5", x"D53E4B", x"D56BE3",
+         x"D598AC", x"D5C4A3", x"D5EFC5", x"D61A11", x"D64385", x"D66C1F", x"D693DC", x"D6BABD",
+         x"D6E0BE", x"D705DF", x"D72A1E", x"D74D7B", x"D76FF5", x"D79189", x"D7B239", x"D7D202",
+         x"D7F0E5", x"D80EE1", x"D82BF7", x"D84824", x"D8636B", x"D87DCA", x"D89742", x"D8AFD3",
+         x"D8C77E", x"D8DE43", x"D8F423", x"D9091E", x"D91D35", x"D9306A", x"D942BD", x"D9542F",
+         x"D964C2", x"D97477", x"D98350", x"D9914D", x"D99E72", x"D9AABF", x"D9B636", x"D9C0D9",
+         x"D9CAAB", x"D9D3AD", x"D9DBE2", x"D9E34C", x"D9E9EE", x"D9EFC9", x"D9F4E0", x"D9F937",
+         x"D9FCCF", x"D9FFAC", x"DA01D0", x"DA033F", x"DA03FB", x"DA0408", x"DA0368", x"DA021F",
+         x"DA0030", x"D9FD9F", x"D9FA6E", x"D9F6A2", x"D9F23E", x"D9ED45", x"D9E7BC", x"D9E1A5",
+         x"D9DB04", x"D9D3DE", x"D9CC36", x"D9C410", x"D9BB70", x"D9B25A", x"D9A8D1", x"D99EDA",
+         x"D9947A", x"D989B3", x"D97E89", x"D97303", x"D96722", x"D95AEC", x"D94E64", x"D9418F",
+         x"D93472", x"D9270F", x"D9196C", x"D90B8D", x"D8FD76", x"D8EF2B", x"D8E0B1", x"D8D20B",
+         x"D8C33F", x"D8B450", x"D8A542", x"D8961B", x"D886DD", x"D8778D", x"D86830", x"D858CA",
+         x"D8495F", x"D839F2", x"D82A89", x"D81B27", x"D80BD0", x"D7FC88", x"D7ED54", x"D7DE37",
+         x"D7CF36", x"D7C053", x"D7B194", x"D7A2FC", x"D7948F", x"D78650", x"D77843", x"D76A6D",
+         x"D75CD0", x"D74F70", x"D74251", x"D73576", x"D728E2", x"D71C9A", x"D710A0", x"D704F8",
+         x"D6F9A4", x"D6EEA9", x"D6E408", x"D6D9C6", x"D6CFE5", x"D6C667", x"D6BD50", x"D6B4A3",
+         x"D6AC63", x"D6A491", x"D69D30", x"D69644", x"D68FCE", x"D689D0", x"D6844E", x"D67F49",
+         x"D67AC3", x"D676BF", x"D6733E", x"D67042", x"D66DCD", x"D66BE2", x"D66A81", x"D669AC",
+         x"D66964", x"D669AC", x"D66A84", x"D66BEE", x"D66DEB", x"D6707C", x"D673A2", x"D6775E",
+         x"D67BB1", x"D6809C", x"D6861F", x"D68C3B", x"D692F0", x"D69A40", x"D6A22A", x"D6AAAF",
+         x"D6B3CF", x"D6BD8A", x"D6C7E0", x"D6D2D2", x"D6DE5E", x"D6EA86", x"D6F748", x"D704A4",
+         x"D7129A", x"D7212A", x"D73053", x"D74013", x"D7506C", x"D7615B", x"D772E0", x"D784FA",
+         x"D797A8", x"D7AAE8", x"D7BEBB", x"D7D31E", x"D7E810", x"D7FD90", x"D8139C", x"D82A34",
+         x"D84154", x"D858FD", x"D8712B", x"D889DE", x"D8A314", x"D8BCCA", x"D8D6FF", x"D8F1B0",
+         x"D90CDD", x"D92882", x"D9449D", x"D9612D", x"D97E2F", x"D99BA1", x"D9B980", x"D9D7CA",
+         x"D9F67C", x"DA1595", x"DA3511", x"DA54EE", x"DA752A", x"DA95C1", x"DAB6B1", x"DAD7F8",
+         x"DAF992", x"DB1B7D", x"DB3DB5", x"DB6039", x"DB8306", x"DBA617", x"DBC96B", x"DBECFE",
+         x"DC10CE", x"DC34D7", x"DC5917", x"DC7D8A", x"DCA22E", x"DCC6FE", x"DCEBF9", x"DD111C",
+         x"DD3662", x"DD5BC9", x"DD814E", x"DDA6EE", x"DDCCA6", x"DDF272", x"DE1850", x"DE3E3C",
+         x"DE6433", x"DE8A32", x"DEB036", x"DED63C", x"DEFC41", x"DF2242", x"DF483B", x"DF6E2A",
+         x"DF940C", x"DFB9DD", x"DFDF9C", x"E00543", x"E02AD2", x"E05044", x"E07597", x"E09AC9",
+         x"E0BFD5", x"E0E4BA", x"E10974", x"E12E01", x"E1525F", x"E1768A", x"E19A7F", x"E1BE3D",
+         x"E1E1C0", x"E20506", x"E2280D", x"E24AD1", x"E26D52", x"E28F8B", x"E2B17B", x"E2D320",
+         x"E2F478", x"E3157F", x"E33635", x"E35696", x"E376A2", x"E39655", x"E3B5AE", x"E3D4AB",
+         x"E3F34A", x"E4118A", x"E42F68", x"E44CE3", x"E469FA", x"E486AA", x"E4A2F3", x"E4BED2",
+         x"E4DA47", x"E4F550", x"E50FEC", x"E52A1A", x"E543D8", x"E55D25", x"E57601", x"E58E6A",
+         x"E5A660", x"E5BDE2", x"E5D4EE", x"E5EB84", x"E601A4", x"E6174D", x"E62C7F", x"E64138",
+         x"E65579", x"E66941", x"E67C90", x"E68F66", x"E6A1C2", x"E6B3A5", x"E6C50E", x"E6D5FE",
+         x"E6E674", x"E6F672", x"E705F6", x"E71502", x"E72395", x"E731B1", x"E73F55", x"E74C82",
+         x"E75939", x"E7657A", x"E77146", x"E77C9F", x"E78784", x"E791F6", x"E79BF7", x"E7A588",
+         x"E7AEA9", x"E7B75C", x"E7BFA2", x"E7C77C", x"E7CEEC", x"E7D5F2", x"E7DC90", x"E7E2C8",
+         x"E7E89B", x"E7EE0A", x"E7F317", x"E7F7C5", x"E7FC13", x"E80005", x"E8039B", x"E806D9",
+         x"E809BE", x"E80C4E", x"E80E8B", x"E81076", x"E81211", x"E8135E", x"E8145F", x"E81517",
+         x"E81588", x"E815B4", x"E8159C", x"E81544", x"E814AD", x"E813D9", x"E812CC", x"E81187",
+         x"E8100D", x"E80E60", x"E80C83", x"E80A77", x"E80840", x"E805E0", x"E80358", x"E800AD",
+         x"E7FDE0", x"E7FAF4", x"E7F7EA", x"E7F4C7", x"E7F18C", x"E7EE3C", x"E7EAD9", x"E7E767",
+         x"E7E3E7", x"E7E05C", x"E7DCC8", x"E7D92F", x"E7D592", x"E7D1F5", x"E7CE5A", x"E7CAC3",
+         x"E7C733", x"E7C3AC", x"E7C031", x"E7BCC5", x"E7B969", x"E7B621", x"E7B2EE", x"E7AFD4",
+         x"E7ACD5", x"E7A9F2", x"E7A72F", x"E7A48E", x"E7A210", x"E79FBA", x"E79D8C", x"E79B88",
+         x"E799B3", x"E7980C", x"E79697", x"E79556", x"E7944A", x"E79377", x"E792DD", x"E79280",
+         x"E79260", x"E79280", x"E792E2", x"E79388", x"E79473", x"E795A6", x"E79721", x"E798E8",
+         x"E79AFA", x"E79D5B", x"E7A00B", x"E7A30C", x"E7A660", x"E7AA08", x"E7AE05", x"E7B259",
+         x"E7B706", x"E7BC0B", x"E7C16B", x"E7C727", x"E7CD3F", x"E7D3B6", x"E7DA8B", x"E7E1C0",
+         x"E7E955", x"E7F14D", x"E7F9A6", x"E80263", x"E80B83", x"E81507", x"E81EF1", x"E82940",
+         x"E833F5", x"E83F11", x"E84A93", x"E8567C", x"E862CD", x"E86F85", x"E87CA5", x"E88A2D",
+         x"E8981C", x"E8A673", x"E8B532", x"E8C459", x"E8D3E7", x"E8E3DC", x"E8F438", x"E904FB",
+         x"E91624", x"E927B3", x"E939A7", x"E94C00", x"E95EBD", x"E971DD", x"E98560", x"E99946",
+         x"E9AD8C", x"E9C233", x"E9D739", x"E9EC9E", x"EA0261", x"EA1880", x"EA2EFB", x"EA45D0",
+         x"EA5CFE", x"EA7484", x"EA8C60", x"EAA492", x"EABD18", x"EAD5F1", x"EAEF1B", x"EB0895",
+         x"EB225C", x"EB3C71", x"EB56D0", x"EB7179", x"EB8C6A", x"EBA7A1", x"EBC31C", x"EBDEDA",
+         x"EBFAD9", x"EC1716", x"EC3391", x"EC5047", x"EC6D37", x"EC8A5D", x"ECA7BA", x"ECC54A",
+         x"ECE30B", x"ED00FB", x"ED1F19", x"ED3D63", x"ED5BD5", x"ED7A6F", x"ED992D", x"EDB80F",
+         x"EDD711", x"EDF631", x"EE156E", x"EE34C5", x"EE5433", x"EE73B7", x"EE934F", x"EEB2F8",
+         x"EED2B0", x"EEF274", x"EF1243", x"EF321A", x"EF51F7", x"EF71D8", x"EF91BA", x"EFB19C",
+         x"EFD17A", x"EFF153", x"F01124", x"F030EC", x"F050A8", x"F07055", x"F08FF2", x"F0AF7D",
+         x"F0CEF3", x"F0EE52", x"F10D97", x"F12CC2", x"F14BCF", x"F16ABD", x"F18989", x"F1A832",
+         x"F1C6B5", x"F1E511", x"F20343", x"F22149", x"F23F22", x"F25CCC", x"F27A44", x"F29789",
+         x"F2B499", x"F2D172", x"F2EE13", x"F30A79", x"F326A3", x"F34290", x"F35E3D", x"F379AA",
+         x"F394D3", x"F3AFB9", x"F3CA59", x"F3E4B3", x"F3FEC4", x"F4188B", x"F43207", x"F44B36",
+         x"F46418", x"F47CAB", x"F494EE", x"F4ACE0", x"F4C47F", x"F4DBCB", x"F4F2C3", x"F50965",
+         x"F51FB2", x"F535A7", x"F54B45", x"F56089", x"F57575", x"F58A06", x"F59E3D", x"F5B219",
+         x"F5C599", x"F5D8BD", x"F5EB84", x"F5FDEE", x"F60FFA", x"F621A9", x"F632FA", x"F643ED",
+         x"F65482", x"F664B9", x"F67491", x"F6840B", x"F69326", x"F6A1E4", x"F6B043", x"F6BE45",
+         x"F6CBE9", x"F6D930", x"F6E61A", x"F6F2A7", x"F6FED9", x"F70AAF", x"F7162A", x"F7214A",
+         x"F72C11", x"F7367E", x"F74094", x"F74A51", x"F753B8", x"F75CC9", x"F76585", x"F76DED",
+         x"F77602", x"F77DC5", x"F78537", x"F78C59", x"F7932D", x"F799B3", x"F79FED", x"F7A5DC",
+         x"F7AB81", x"F7B0DE", x"F7B5F4", x"F7BAC5", x"F7BF51", x"F7C39C", x"F7C7A5", x"F7CB6F",
+         x"F7CEFB", x"F7D24B", x"F7D560", x"F7D83C", x"F7DAE2", x"F7DD52", x"F7DF8E", x"F7E198",
+         x"F7E373", x"F7E51F", x"F7E69F", x"F7E7F4", x"F7E921", x"F7EA28", x"F7EB09", x"F7EBC8",
+         x"F7EC67", x"F7ECE6", x"F7ED49", x"F7ED91", x"F7EDC0", x"F7EDD9", x"F7EDDD", x"F7EDCF",
+         x"F7EDB0", x"F7ED83", x"F7ED4A", x"F7ED07", x"F7ECBB", x"F7EC69", x"F7EC14", x"F7EBBD",
+         x"F7EB66", x"F7EB11", x"F7EAC1", x"F7EA78", x"F7EA37", x"F7EA01", x"F7E9D8", x"F7E9BE",
+         x"F7E9B5", x"F7E9BF", x"F7E9DE", x"F7EA14", x"F7EA63", x"F7EACD", x"F7EB54", x"F7EBFB",
+         x"F7ECC2", x"F7EDAC", x"F7EEBB", x"F7EFF1", x"F7F14F", x"F7F2D7", x"F7F48C", x"F7F66F",
+         x"F7F882", x"F7FAC6", x"F7FD3E", x"F7FFEB", x"F802CE", x"F805E9", x"F8093F", x"F80CCF",
+         x"F8109D", x"F814AA", x"F818F6", x"F81D84", x"F82254", x"F82769", x"F82CC3", x"F83264",
+         x"F8384E", x"F83E80", x"F844FD", x"F84BC6", x"F852DB", x"F85A3F", x"F861F1", x"F869F3",
+         x"F87246", x"F87AEA", x"F883E1", x"F88D2B", x"F896C9", x"F8A0BC", x"F8AB05", x"F8B5A4",
+         x"F8C099", x"F8CBE5", x"F8D78A", x"F8E386", x"F8EFDC", x"F8FC8A", x"F90991", x"F916F2",
+         x"F924AC", x"F932C1", x"F94130", x"F94FF8", x"F95F1B", x"F96E98", x"F97E6F", x"F98EA0",
+         x"F99F2B", x"F9B00F", x"F9C14D", x"F9D2E3", x"F9E4D3", x"F9F71A", x"FA09BA", x"FA1CB1",
+         x"FA2FFE", x"FA43A2", x"FA579C", x"FA6BEB", x"FA808E", x"FA9584", x"FAAACD", x"FAC068",
+         x"FAD654", x"FAEC90", x"FB031C", x"FB19F5", x"FB311B", x"FB488E", x"FB604B", x"FB7852",
+         x"FB90A1", x"FBA938", x"FBC215", x"FBDB36", x"FBF49B", x"FC0E41", x"FC2828", x"FC424F",
+         x"FC5CB2", x"FC7752", x"FC922C", x"FCAD3F", x"FCC88A", x"FCE40A", x"FCFFBE", x"FD1BA5",
+         x"FD37BC", x"FD5402", x"FD7075", x"FD8D14", x"FDA9DB", x"FDC6CB", x"FDE3E0", x"FE011A",
+         x"FE1E75", x"FE3BF1", x"FE598A", x"FE7740", x"FE9511", x"FEB2F9", x"FED0F8", x"FEEF0C",
+         x"FF0D31", x"FF2B67", x"FF49AC", x"FF67FC", x"FF8657", x"FFA4BA", x"FFC323", x"FFE191",
+         x"000000", x"001E6F", x"003CDD", x"005B46", x"0079A9", x"009804", x"00B654", x"00D499",
+         x"00F2CF", x"0110F4", x"012F08", x"014D07", x"016AEF", x"0188C0", x"01A676", x"01C40F",
+         x"01E18B", x"01FEE6", x"021C20", x"023935", x"025625", x"0272EC", x"028F8B", x"02ABFE",
+         x"02C844", x"02E45B", x"030042", x"031BF6", x"033776", x"0352C1", x"036DD4", x"0388AE",
+         x"03A34E", x"03BDB1", x"03D7D8", x"03F1BF", x"040B65", x"0424CA", x"043DEB", x"0456C8",
+         x"046F5F", x"0487AE", x"049FB5", x"04B772", x"04CEE5", x"04E60B", x"04FCE4", x"051370",
+         x"0529AC", x"053F98", x"055533", x"056A7C", x"057F72", x"059415", x"05A864", x"05BC5E",
+         x"05D002", x"05E34F", x"05F646", x"0608E6", x"061B2D", x"062D1D", x"063EB3", x"064FF1",
+         x"0660D5", x"067160", x"068191", x"069168", x"06A0E5", x"06B008", x"06BED0", x"06CD3F",
+         x"06DB54", x"06E90E", x"06F66F", x"070376", x"071024", x"071C7A", x"072876", x"07341B",
+         x"073F67", x"074A5C", x"0754FB", x"075F44", x"076937", x"0772D5", x"077C1F", x"078516",
+         x"078DBA", x"07960D", x"079E0F", x"07A5C1", x"07AD25", x"07B43A", x"07BB03", x"07C180",
+         x"07C7B2", x"07CD9C", x"07D33D", x"07D897", x"07DDAC", x"07E27C", x"07E70A", x"07EB56",
+         x"07EF63", x"07F331", x"07F6C1", x"07FA17", x"07FD32", x"080015", x"0802C2", x"08053A",
+         x"08077E", x"080991", x"080B74", x"080D29", x"080EB1", x"08100F", x"081145", x"081254",
+         x"08133E", x"081405", x"0814AC", x"081533", x"08159D", x"0815EC", x"081622", x"081641",
+         x"08164B", x"081642", x"081628", x"0815FF", x"0815C9", x"081588", x"08153F", x"0814EF",
+         x"08149A", x"081443", x"0813EC", x"081397", x"081345", x"0812F9", x"0812B6", x"08127D",
+         x"081250", x"081231", x"081223", x"081227", x"081240", x"08126F", x"0812B7", x"08131A",
+         x"081399", x"081438", x"0814F7", x"0815D8", x"0816DF", x"08180C", x"081961", x"081AE1",
+         x"081C8D", x"081E68", x"082072", x"0822AE", x"08251E", x"0827C4", x"082AA0", x"082DB5",
+         x"083105", x"083491", x"08385B", x"083C64", x"0840AF", x"08453B", x"084A0C", x"084F22",
+         x"08547F", x"085A24", x"086013", x"08664D", x"086CD3", x"0873A7", x"087AC9", x"08823B",
+         x"0889FE", x"089213", x"089A7B", x"08A337", x"08AC48", x"08B5AF", x"08BF6C", x"08C982",
+         x"08D3EF", x"08DEB6", x"08E9D6", x"08F551", x"090127", x"090D59", x"0919E6", x"0926D0",
+         x"093417", x"0941BB", x"094FBD", x"095E1C", x"096CDA", x"097BF5", x"098B6F", x"099B47",
+         x"09AB7E", x"09BC13", x"09CD06", x"09DE57", x"09F006", x"0A0212", x"0A147C", x"0A2743",
+         x"0A3A67", x"0A4DE7", x"0A61C3", x"0A75FA", x"0A8A8B", x"0A9F77", x"0AB4BB", x"0ACA59",
+         x"0AE04E", x"0AF69B", x"0B0D3D", x"0B2435", x"0B3B81", x"0B5320", x"0B6B12", x"0B8355",
+         x"0B9BE8", x"0BB4CA", x"0BCDF9", x"0BE775", x"0C013C", x"0C1B4D", x"0C35A7", x"0C5047",
+         x"0C6B2D", x"0C8656", x"0CA1C3", x"0CBD70", x"0CD95D", x"0CF587", x"0D11ED", x"0D2E8E",
+         x"0D4B67", x"0D6877", x"0D85BC", x"0DA334", x"0DC0DE", x"0DDEB7", x"0DFCBD", x"0E1AEF",
+         x"0E394B", x"0E57CE", x"0E7677", x"0E9543", x"0EB431", x"0ED33E", x"0EF269", x"0F11AE",
+         x"0F310D", x"0F5083", x"0F700E", x"0F8FAB", x"0FAF58", x"0FCF14", x"0FEEDC", x"100EAD",
+         x"102E86", x"104E64", x"106E46", x"108E28", x"10AE09", x"10CDE6", x"10EDBD", x"110D8C",
+         x"112D50", x"114D08", x"116CB1", x"118C49", x"11ABCD", x"11CB3B", x"11EA92", x"1209CF",
+         x"1228EF", x"1247F1", x"1266D3", x"128591", x"12A42B", x"12C29D", x"12E0E7", x"12FF05",
+         x"131CF5", x"133AB6", x"135846", x"1375A3", x"1392C9", x"13AFB9", x"13CC6F", x"13E8EA",
+         x"140527", x"142126", x"143CE4", x"14585F", x"147396", x"148E87", x"14A930", x"14C38F",
+         x"14DDA4", x"14F76B", x"1510E5", x"152A0F", x"1542E8", x"155B6E", x"1573A0", x"158B7C",
+         x"15A302", x"15BA30", x"15D105", x"15E780", x"15FD9F", x"161362", x"1628C7", x"163DCD",
+         x"165274", x"1666BA", x"167AA0", x"168E23", x"16A143", x"16B400", x"16C659", x"16D84D",
+         x"16E9DC", x"16FB05", x"170BC8", x"171C24", x"172C19", x"173BA7", x"174ACE", x"17598D",
+         x"1767E4", x"1775D3", x"17835B", x"17907B", x"179D33", x"17A984", x"17B56D", x"17C0EF",
+         x"17CC0B", x"17D6C0", x"17E10F", x"17EAF9", x"17F47D", x"17FD9D", x"18065A", x"180EB3",
+         x"1816AB", x"181E40", x"182575", x"182C4A", x"1832C1", x"1838D9", x"183E95", x"1843F5",
+         x"1848FA", x"184DA7", x"1851FB", x"1855F8", x"1859A0", x"185CF4", x"185FF5", x"1862A5",
+         x"186506", x"186718", x"1868DF", x"186A5A", x"186B8D", x"186C78", x"186D1E", x"186D80",
+         x"186DA0", x"186D80", x"186D23", x"186C89", x"186BB6", x"186AAA", x"186969", x"1867F4",
+         x"18664D", x"186478", x"186274", x"186046", x"185DF0", x"185B72", x"1858D1", x"18560E",
+         x"18532B", x"18502C", x"184D12", x"1849DF", x"184697", x"18433B", x"183FCF", x"183C54",
+         x"1838CD", x"18353D", x"1831A6", x"182E0B", x"182A6E", x"1826D1", x"182338", x"181FA4",
+         x"181C19", x"181899", x"181527", x"1811C4", x"180E74", x"180B39", x"180816", x"18050C",
+         x"180220", x"17FF53", x"17FCA8", x"17FA20", x"17F7C0", x"17F589", x"17F37D", x"17F1A0",
+         x"17EFF3", x"17EE79", x"17ED34", x"17EC27", x"17EB53", x"17EABC", x"17EA64", x"17EA4C",
+         x"17EA78", x"17EAE9", x"17EBA1", x"17ECA2", x"17EDEF", x"17EF8A", x"17F175", x"17F3B2",
+         x"17F642", x"17F927", x"17FC65", x"17FFFB", x"1803ED", x"18083B", x"180CE9", x"1811F6",
+         x"181765", x"181D38", x"182370", x"182A0E", x"183114", x"183884", x"18405E", x"1848A4",
+         x"185157", x"185A78", x"186409", x"186E0A", x"18787C", x"188361", x"188EBA", x"189A86",
+         x"18A6C7", x"18B37E", x"18C0AB", x"18CE4F", x"18DC6B", x"18EAFE", x"18FA0A", x"19098E",
+         x"19198C", x"192A02", x"193AF2", x"194C5B", x"195E3E", x"19709A", x"198370", x"1996BF",
+         x"19AA87", x"19BEC8", x"19D381", x"19E8B3", x"19FE5C", x"1A147C", x"1A2B12", x"1A421E",
+         x"1A59A0", x"1A7196", x"1A89FF", x"1AA2DB", x"1ABC28", x"1AD5E6", x"1AF014", x"1B0AB0",
+         x"1B25B9", x"1B412E", x"1B5D0D", x"1B7956", x"1B9606", x"1BB31D", x"1BD098", x"1BEE76",
+         x"1C0CB6", x"1C2B55", x"1C4A52", x"1C69AB", x"1C895E", x"1CA96A", x"1CC9CB", x"1CEA81",
+         x"1D0B88", x"1D2CE0", x"1D4E85", x"1D7075", x"1D92AE", x"1DB52F", x"1DD7F3", x"1DFAFA",
+         x"1E1E40", x"1E41C3", x"1E6581", x"1E8976", x"1EADA1", x"1ED1FF", x"1EF68C", x"1F1B46",
+         x"1F402B", x"1F6537", x"1F8A69", x"1FAFBC", x"1FD52E", x"1FFABD", x"202064", x"204623",
+         x"206BF4", x"2091D6", x"20B7C5", x"20DDBE", x"2103BF", x"2129C4", x"214FCA", x"2175CE",
+         x"219BCD", x"21C1C4", x"21E7B0", x"220D8E", x"22335A", x"225912", x"227EB2", x"22A437",
+         x"22C99E", x"22EEE4", x"231407", x"233902", x"235DD2", x"238276", x"23A6E9", x"23CB29",
+         x"23EF32", x"241302", x"243695", x"2459E9", x"247CFA", x"249FC7", x"24C24B", x"24E483",
+         x"25066E", x"252808", x"25494F", x"256A3F", x"258AD6", x"25AB12", x"25CAEF", x"25EA6B",
+         x"260984", x"262836", x"264680", x"26645F", x"2681D1", x"269ED3", x"26BB63", x"26D77E",
+         x"26F323", x"270E50", x"272901", x"274336", x"275CEC", x"277622", x"278ED5", x"27A703",
+         x"27BEAC", x"27D5CC", x"27EC64", x"280270", x"2817F0", x"282CE2", x"284145", x"285518",
+         x"286858", x"287B06", x"288D20", x"289EA5", x"28AF94", x"28BFED", x"28CFAD", x"28DED6",
+         x"28ED66", x"28FB5C", x"2908B8", x"29157A", x"2921A2", x"292D2E", x"293820", x"294276",
+         x"294C31", x"295551", x"295DD6", x"2965C0", x"296D10", x"2973C5", x"2979E1", x"297F64",
+         x"29844F", x"2988A2", x"298C5E", x"298F84", x"299215", x"299412", x"29957C", x"299654",
+         x"29969C", x"299654", x"29957F", x"29941E", x"299233", x"298FBE", x"298CC2", x"298941",
+         x"29853D", x"2980B7", x"297BB2", x"297630", x"297032", x"2969BC", x"2962D0", x"295B6F",
+         x"29539D", x"294B5D", x"2942B0", x"293999", x"29301B", x"29263A", x"291BF8", x"291157",
+         x"29065C", x"28FB08", x"28EF60", x"28E366", x"28D71E", x"28CA8A", x"28BDAF", x"28B090",
+         x"28A330", x"289593", x"2887BD", x"2879B0", x"286B71", x"285D04", x"284E6C", x"283FAD",
+         x"2830CA", x"2821C9", x"2812AC", x"280378", x"27F430", x"27E4D9", x"27D577", x"27C60E",
+         x"27B6A1", x"27A736", x"2797D0", x"278873", x"277923", x"2769E5", x"275ABE", x"274BB0",
+         x"273CC1", x"272DF5", x"271F4F", x"2710D5", x"27028A", x"26F473", x"26E694", x"26D8F1",
+         x"26CB8E", x"26BE71", x"26B19C", x"26A514", x"2698DE", x"268CFD", x"268177", x"26764D",
+         x"266B86", x"266126", x"26572F", x"264DA6", x"264490", x"263BF0", x"2633CA", x"262C22",
+         x"2624FC", x"261E5B", x"261844", x"2612BB", x"260DC2", x"26095E", x"260592", x"260261",
+         x"25FFD0", x"25FDE1", x"25FC98", x"25FBF8", x"25FC05", x"25FCC1", x"25FE30", x"260054",
+         x"260331", x"2606C9", x"260B20", x"261037", x"261612", x"261CB4", x"26241E", x"262C53",
+         x"263555", x"263F27", x"2649CA", x"265541", x"26618E", x"266EB3", x"267CB0", x"268B89",
+         x"269B3E", x"26ABD1", x"26BD43", x"26CF96", x"26E2CB", x"26F6E2", x"270BDD", x"2721BD",
+         x"273882", x"27502D", x"2768BE", x"278236", x"279C95", x"27B7DC", x"27D409", x"27F11F",
+         x"280F1B", x"282DFE", x"284DC7", x"286E77", x"28900B", x"28B285", x"28D5E2", x"28FA21",
+         x"291F42", x"294543", x"296C24", x"2993E1", x"29BC7B", x"29E5EF", x"2A103B", x"2A3B5D",
+         x"2A6754", x"2A941D", x"2AC1B5", x"2AF01B", x"2B1F4C", x"2B4F44", x"2B8002", x"2BB182",
+         x"2BE3C2", x"2C16BD", x"2C4A72", x"2C7EDB", x"2CB3F7", x"2CE9C1", x"2D2036", x"2D5751",
+         x"2D8F0E", x"2DC76B", x"2E0062", x"2E39EE", x"2E740D", x"2EAEB8", x"2EE9EC", x"2F25A4",
+         x"2F61DA", x"2F9E8A", x"2FDBAF", x"301944", x"305743", x"3095A7", x"30D46B", x"311388",
+         x"3152FA", x"3192BA", x"31D2C3", x"32130F", x"325397", x"329456", x"32D546", x"331660",
+         x"33579D", x"3398F8", x"33DA69", x"341BEB", x"345D77", x"349F05", x"34E090", x"35220F",
+         x"35637D", x"35A4D3", x"35E608", x"362717", x"3667F7", x"36A8A3", x"36E912", x"37293D",
+         x"37691D", x"37A8AA", x"37E7DE", x"3826B0", x"386519", x"38A311", x"38E091", x"391D92",
+         x"395A0B", x"3995F6", x"39D14A", x"3A0BFF", x"3A460F", x"3A7F71", x"3AB81D", x"3AF00C",
+         x"3B2737", x"3B5D95", x"3B931E", x"3BC7CC", x"3BFB96", x"3C2E75", x"3C6060", x"3C9151",
+         x"3CC140", x"3CF024", x"3D1DF7", x"3D4AB1", x"3D764A", x"3DA0BB", x"3DC9FD", x"3DF208",
+         x"3E18D4", x"3E3E5A", x"3E6294", x"3E8579", x"3EA703", x"3EC72A", x"3EE5E8", x"3F0335",
+         x"3F1F0B", x"3F3962", x"3F5235", x"3F697B", x"3F7F2F", x"3F934A", x"3FA5C5", x"3FB69B",
+         x"3FC5C4", x"3FD33B", x"3FDEF9", x"3FE8F9", x"3FF134", x"3FF7A4", x"3FFC45", x"3FFF10",
+         x"3FFFFF", x"3FFF0E", x"3FFC37", x"3FF774", x"3FF0C1", x"3FE819", x"3FDD77", x"3FD0D7",
+         x"3FC232", x"3FB187", x"3F9ECE", x"3F8A06", x"3F7329", x"3F5A34", x"3F3F22", x"3F21F1",
+         x"3F029C", x"3EE120", x"3EBD7B", x"3E97A8", x"3E6FA5", x"3E4570", x"3E1905", x"3DEA62",
+         x"3DB985", x"3D866B", x"3D5112", x"3D1979", x"3CDF9E", x"3CA37F", x"3C651B", x"3C2470",
+         x"3BE17E", x"3B9C44", x"3B54C0", x"3B0AF2", x"3ABEDA", x"3A7078", x"3A1FCB", x"39CCD3",
+         x"397791", x"392005", x"38C630", x"386A12", x"380BAC", x"37AAFF", x"37480D", x"36E2D7",
+         x"367B5E", x"3611A5", x"35A5AC", x"353777", x"34C708", x"345460", x"33DF82", x"336872",
+         x"32EF31", x"3273C4", x"31F62D", x"317670", x"30F490", x"307092", x"2FEA78", x"2F6247",
+         x"2ED804", x"2E4BB2", x"2DBD56", x"2D2CF5", x"2C9A94", x"2C0637", x"2B6FE4", x"2AD7A1",
+         x"2A3D71", x"29A15C", x"290367", x"286398", x"27C1F4", x"271E83", x"26794A", x"25D250",
+         x"25299B", x"247F32", x"23D31D", x"232561", x"227607", x"21C515", x"211293", x"205E88",
+         x"1FA8FD", x"1EF1F8", x"1E3981", x"1D7FA2", x"1CC461", x"1C07C6", x"1B49DB", x"1A8AA8",
+         x"19CA35", x"19088A", x"1845B1", x"1781B2", x"16BC97", x"15F667", x"152F2D", x"1466F1",
+         x"139DBD", x"12D39A", x"120891", x"113CAC", x"106FF4", x"0FA273", x"0ED433", x"0E053D",
+         x"0D359B", x"0C6557", x"0B947B", x"0AC310", x"09F122", x"091EB9", x"084BDF", x"0778A0",
+         x"06A505", x"05D118", x"04FCE3", x"042870", x"0353CB", x"027EFC", x"01AA0E", x"00D50C"),
+        -- octave 8
+        (x"000000", x"FF977C", x"FF2EF9", x"FEC679", x"FE5DFC", x"FDF584", x"FD8D12", x"FD24A7",
+         x"FCBC44", x"FC53EA", x"FBEB9B", x"FB8358", x"FB1B22", x"FAB2F9", x"FA4AE0", x"F9E2D8",
+         x"F97AE1", x"F912FC", x"F8AB2C", x"F84371", x"F7DBCC", x"F7743E", x"F70CC9", x"F6A56E",
+         x"F63E2D", x"F5D709", x"F57002", x"F50919", x"F4A24F", x"F43BA6", x"F3D51F", x"F36EBB",
+         x"F3087B", x"F2A260", x"F23C6B", x"F1D69E", x"F170FA", x"F10B7F", x"F0A62F", x"F0410B",
+         x"EFDC14", x"EF774B", x"EF12B1", x"EEAE48", x"EE4A11", x"EDE60C", x"ED823B", x"ED1E9E",
+         x"ECBB38", x"EC5808", x"EBF511", x"EB9252", x"EB2FCE", x"EACD86", x"EA6B79", x"EA09AA",
+         x"E9A81A", x"E946C9", x"E8E5B9", x"E884EB", x"E8245F", x"E7C417", x"E76414", x"E70456",
+         x"E6A4E0", x"E645B1", x"E5E6CC", x"E58830", x"E529DF", x"E4CBDA", x"E46E22", x"E410B8",
+         x"E3B39D", x"E356D1", x"E2FA57", x"E29E2E", x"E24259", x"E1E6D7", x"E18BA9", x"E130D2",
+         x"E0D651", x"E07C28", x"E02257", x"DFC8DF", x"DF6FC2", x"DF1701", x"DEBE9B", x"DE6692",
+         x"DE0EE8", x"DDB79C", x"DD60B0", x"DD0A25", x"DCB3FC", x"DC5E34", x"DC08D0", x"DBB3D0",
+         x"DB5F35", x"DB0B00", x"DAB732", x"DA63CA", x"DA10CC", x"D9BE36", x"D96C0A", x"D91A49",
+         x"D8C8F4", x"D8780A", x"D8278E", x"D7D780", x"D787E0", x"D738B0", x"D6E9EF", x"D69BA0",
+         x"D64DC2", x"D60057", x"D5B35F", x"D566DA", x"D51ACA", x"D4CF2F", x"D4840A", x"D4395C",
+         x"D3EF25", x"D3A565", x"D35C1F", x"D31351", x"D2CAFE", x"D28325", x"D23BC7", x"D1F4E5",
+         x"D1AE7F", x"D16896", x"D1232B", x"D0DE3E", x"D099D0", x"D055E1", x"D01273", x"CFCF84",
+         x"CF8D17", x"CF4B2B", x"CF09C2", x"CEC8DB", x"CE8877", x"CE4897", x"CE093B", x"CDCA63",
+         x"CD8C11", x"CD4E45", x"CD10FE", x"CCD43F", x"CC9806", x"CC5C54", x"CC212B", x"CBE689",
+         x"CBAC71", x"CB72E2", x"CB39DC", x"CB0160", x"CAC96E", x"CA9207", x"CA5B2C", x"CA24DB",
+         x"C9EF16", x"C9B9DE", x"C98532", x"C95112", x"C91D80", x"C8EA7B", x"C8B803", x"C8861A",
+         x"C854BF", x"C823F2", x"C7F3B4", x"C7C405", x"C794E5", x"C76655", x"C73854", x"C70AE4",
+         x"C6DE03", x"C6B1B3", x"C685F3", x"C65AC4", x"C63026", x"C60619", x"C5DC9D", x"C5B3B2",
+         x"C58B59", x"C56391", x"C53C5B", x"C515B7", x"C4EFA5", x"C4CA24", x"C4A536", x"C480DA",
+         x"C45D10", x"C439D9", x"C41733", x"C3F521", x"C3D3A0", x"C3B2B2", x"C39256", x"C3728D",
+         x"C35356", x"C334B2", x"C316A0", x"C2F920", x"C2DC32", x"C2BFD7", x"C2A40E", x"C288D7",
+         x"C26E32", x"C2541F", x"C23A9E", x"C221AF", x"C20951", x"C1F185", x"C1DA4A", x"C1C3A1",
+         x"C1AD88", x"C19801", x"C1830A", x"C16EA4", x"C15ACF", x"C1478A", x"C134D4", x"C122AF",
+         x"C11119", x"C10013", x"C0EF9C", x"C0DFB4", x"C0D05B", x"C0C190", x"C0B353", x"C0A5A4",
+         x"C09883", x"C08BEF", x"C07FE8", x"C0746E", x"C06981", x"C05F1F", x"C05549", x"C04BFF",
+         x"C04340", x"C03B0C", x"C03362", x"C02C42", x"C025AC", x"C01F9F", x"C01A1B", x"C0151F",
+         x"C010AC", x"C00CC0", x"C0095C", x"C0067E", x"C00427", x"C00256", x"C0010A", x"C00043",
+         x"C00001", x"C00043", x"C00109", x"C00251", x"C0041D", x"C0066A", x"C0093A", x"C00C8A",
+         x"C0105B", x"C014AC", x"C0197D", x"C01ECC", x"C0249B", x"C02AE7", x"C031B0", x"C038F6",
+         x"C040B9", x"C048F7", x"C051B0", x"C05AE3", x"C06491", x"C06EB7", x"C07957", x"C0846E",
+         x"C08FFD", x"C09C02", x"C0A87E", x"C0B56F", x"C0C2D5", x"C0D0AF", x"C0DEFC", x"C0EDBD",
+         x"C0FCF0", x"C10C94", x"C11CA9", x"C12D2E", x"C13E23", x"C14F86", x"C16158", x"C17396",
+         x"C18642", x"C19959", x"C1ACDC", x"C1C0C9", x"C1D520", x"C1E9E0", x"C1FF08", x"C21497",
+         x"C22A8D", x"C240EA", x"C257AB", x"C26ED1", x"C2865B", x"C29E48", x"C2B697", x"C2CF47",
+         x"C2E857", x"C301C8", x"C31B98", x"C335C5", x"C35050", x"C36B38", x"C3867C", x"C3A21A",
+         x"C3BE13", x"C3DA65", x"C3F70F", x"C41411", x"C4316A", x"C44F19", x"C46D1D", x"C48B75",
+         x"C4AA21", x"C4C920", x"C4E870", x"C50811", x"C52803", x"C54843", x"C568D2", x"C589AF",
+         x"C5AAD8", x"C5CC4D", x"C5EE0C", x"C61016", x"C63269", x"C65504", x"C677E6", x"C69B0F",
+         x"C6BE7E", x"C6E231", x"C70628", x"C72A63", x"C74EDF", x"C7739C", x"C7989A", x"C7BDD7",
+         x"C7E352", x"C8090B", x"C82F01", x"C85533", x"C87B9F", x"C8A246", x"C8C925", x"C8F03D",
+         x"C9178C", x"C93F11", x"C966CC", x"C98EBB", x"C9B6DE", x"C9DF34", x"CA07BB", x"CA3074",
+         x"CA595C", x"CA8274", x"CAABBA", x"CAD52D", x"CAFECC", x"CB2897", x"CB528C", x"CB7CAB",
+         x"CBA6F3", x"CBD162", x"CBFBF9", x"CC26B5", x"CC5196", x"CC7C9C", x"CCA7C5", x"CCD310",
+         x"CCFE7D", x"CD2A0B", x"CD55B8", x"CD8183", x"CDAD6D", x"CDD974", x"CE0596", x"CE31D4",
+         x"CE5E2C", x"CE8A9E", x"CEB727", x"CEE3C9", x"CF1081", x"CF3D4F", x"CF6A32", x"CF9729",
+         x"CFC433", x"CFF150", x"D01E7E", x"D04BBC", x"D0790A", x"D0A667", x"D0D3D1", x"D10149",
+         x"D12ECD", x"D15C5C", x"D189F6", x"D1B799", x"D1E545", x"D212F9", x"D240B4", x"D26E75",
+         x"D29C3C", x"D2CA07", x"D2F7D5", x"D325A7", x"D3537A", x"D3814F", x"D3AF24", x"D3DCF9",
+         x"D40ACC", x"D4389D", x"D4666C", x"D49436", x"D4C1FC", x"D4EFBD", x"D51D78", x"D54B2C",
+         x"D578D8", x"D5A67B", x"D5D416", x"D601A6", x"D62F2B", x"D65CA5", x"D68A13", x"D6B773",
+         x"D6E4C6", x"D7120A", x"D73F3E", x"D76C63", x"D79976", x"D7C678", x"D7F368", x"D82045",
+         x"D84D0D", x"D879C2", x"D8A661", x"D8D2EB", x"D8FF5D", x"D92BB9", x"D957FC", x"D98427",
+         x"D9B039", x"D9DC30", x"DA080D", x"DA33CE", x"DA5F74", x"DA8AFC", x"DAB668", x"DAE1B5",
+         x"DB0CE4", x"DB37F3", x"DB62E3", x"DB8DB2", x"DBB860", x"DBE2EC", x"DC0D56", x"DC379D",
+         x"DC61C1", x"DC8BC0", x"DCB59A", x"DCDF50", x"DD08DF", x"DD3248", x"DD5B8A", x"DD84A4",
+         x"DDAD97", x"DDD660", x"DDFF01", x"DE2778", x"DE4FC4", x"DE77E6", x"DE9FDD", x"DEC7A7",
+         x"DEEF46", x"DF16B7", x"DF3DFC", x"DF6513", x"DF8BFB", x"DFB2B5", x"DFD93F", x"DFFF9A",
+         x"E025C5", x"E04BC0", x"E07189", x"E09721", x"E0BC88", x"E0E1BC", x"E106BD", x"E12B8C",
+         x"E15027", x"E1748E", x"E198C1", x"E1BCBF", x"E1E089", x"E2041D", x"E2277B", x"E24AA4",
+         x"E26D96", x"E29051", x"E2B2D5", x"E2D522", x"E2F737", x"E31914", x"E33AB9", x"E35C25",
+         x"E37D58", x"E39E52", x"E3BF13", x"E3DF9A", x"E3FFE7", x"E41FF9", x"E43FD1", x"E45F6F",
+         x"E47ED1", x"E49DF8", x"E4BCE4", x"E4DB94", x"E4FA08", x"E51840", x"E5363B", x"E553FB",
+         x"E5717D", x"E58EC3", x"E5ABCB", x"E5C897", x"E5E525", x"E60176", x"E61D89", x"E6395F",
+         x"E654F6", x"E67050", x"E68B6B", x"E6A648", x"E6C0E7", x"E6DB48", x"E6F569", x"E70F4D",
+         x"E728F2", x"E74258", x"E75B7F", x"E77467", x"E78D11", x"E7A57B", x"E7BDA7", x"E7D593",
+         x"E7ED41", x"E804AF", x"E81BDF", x"E832CF", x"E84981", x"E85FF3", x"E87627", x"E88C1B",
+         x"E8A1D1", x"E8B747", x"E8CC7F", x"E8E178", x"E8F632", x"E90AAE", x"E91EEB", x"E932E9",
+         x"E946A9", x"E95A2B", x"E96D6E", x"E98074", x"E9933B", x"E9A5C4", x"E9B80F", x"E9CA1D",
+         x"E9DBED", x"E9ED80", x"E9FED5", x"EA0FEE", x"EA20C9", x"EA3168", x"EA41CA", x"EA51EF",
+         x"EA61D9", x"EA7186", x"EA80F7", x"EA902D", x"EA9F27", x"EAADE6", x"EABC6A", x"EACAB3",
+         x"EAD8C1", x"EAE695", x"EAF42F", x"EB018F", x"EB0EB6", x"EB1BA3", x"EB2857", x"EB34D2",
+         x"EB4114", x"EB4D1F", x"EB58F1", x"EB648B", x"EB6FEE", x"EB7B1A", x"EB860F", x"EB90CE",
+         x"EB9B56", x"EBA5A9", x"EBAFC6", x"EBB9AE", x"EBC360", x"EBCCDF", x"EBD629", x"EBDF3F",
+         x"EBE822", x"EBF0D1", x"EBF94E", x"EC0198", x"EC09B0", x"EC1197", x"EC194C", x"EC20D1",
+         x"EC2825", x"EC2F48", x"EC363C", x"EC3D01", x"EC4397", x"EC49FE", x"EC5037", x"EC5642",
+         x"EC5C21", x"EC61D2", x"EC6757", x"EC6CB0", x"EC71DD", x"EC76E0", x"EC7BB8", x"EC8065",
+         x"EC84E9", x"EC8943", x"EC8D75", x"EC917F", x"EC9560", x"EC991A", x"EC9CAD", x"ECA01A",
+         x"ECA360", x"ECA681", x"ECA97E", x"ECAC55", x"ECAF09", x"ECB198", x"ECB405", x"ECB650",
+         x"ECB878", x"ECBA7F", x"ECBC64", x"ECBE2A", x"ECBFCF", x"ECC154", x"ECC2BB", x"ECC403",
+         x"ECC52D", x"ECC63A", x"ECC72A", x"ECC7FE", x"ECC8B6", x"ECC952", x"ECC9D4", x"ECCA3B",
+         x"ECCA89", x"ECCABE", x"ECCADA", x"ECCADE", x"ECCACA", x"ECCAA0", x"ECCA5F", x"ECCA08",
+         x"ECC99C", x"ECC91B", x"ECC886", x"ECC7DD", x"ECC721", x"ECC653", x"ECC572", x"ECC481",
+         x"ECC37E", x"ECC26B", x"ECC148", x"ECC016", x"ECBED6", x"ECBD87", x"ECBC2B", x"ECBAC2",
+         x"ECB94D", x"ECB7CC", x"ECB640", x"ECB4A9", x"ECB307", x"ECB15D", x"ECAFA9", x"ECADED",
+         x"ECAC29", x"ECAA5E", x"ECA88C", x"ECA6B5", x"ECA4D7", x"ECA2F5", x"ECA10E", x"EC9F23",
+         x"EC9D35", x"EC9B44", x"EC9951", x"EC975D", x"EC9567", x"EC9371", x"EC917B", x"EC8F85",
+         x"EC8D91", x"EC8B9F", x"EC89AF", x"EC87C1", x"EC85D7", x"EC83F2", x"EC8210", x"EC8034",
+         x"EC7E5D", x"EC7C8D", x"EC7AC3", x"EC7900", x"EC7746", x"EC7593", x"EC73EA", x"EC724A",
+         x"EC70B4", x"EC6F28", x"EC6DA8", x"EC6C33", x"EC6ACA", x"EC696E", x"EC681F", x"EC66DD",
+         x"EC65AA", x"EC6485", x"EC6370", x"EC626B", x"EC6175", x"EC6091", x"EC5FBE", x"EC5EFC",
+         x"EC5E4D", x"EC5DB0", x"EC5D27", x"EC5CB2", x"EC5C51", x"EC5C04", x"EC5BCD", x"EC5BAC",
+         x"EC5BA1", x"EC5BAC", x"EC5BCF", x"EC5C09", x"EC5C5B", x"EC5CC6", x"EC5D4A", x"EC5DE7",
+         x"EC5E9E", x"EC5F6F", x"EC605C", x"EC6163", x"EC6287", x"EC63C6", x"EC6522", x"EC669B",
+         x"EC6832", x"EC69E6", x"EC6BB8", x"EC6DAA", x"EC6FBA", x"EC71EA", x"EC7439", x"EC76A9",
+         x"EC793A", x"EC7BEC", x"EC7EBF", x"EC81B4", x"EC84CC", x"EC8806", x"EC8B63", x"EC8EE3",
+         x"EC9287", x"EC964F", x"EC9A3C", x"EC9E4D", x"ECA284", x"ECA6E0", x"ECAB61", x"ECB009",
+         x"ECB4D8", x"ECB9CD", x"ECBEE9", x"ECC42D", x"ECC998", x"ECCF2C", x"ECD4E8", x"ECDACC",
+         x"ECE0DA", x"ECE710", x"ECED70", x"ECF3FA", x"ECFAAE", x"ED018D", x"ED0895", x"ED0FC9",
+         x"ED1728", x"ED1EB2", x"ED2668", x"ED2E49", x"ED3657", x"ED3E91", x"ED46F7", x"ED4F8B",
+         x"ED584B", x"ED6138", x"ED6A52", x"ED739B", x"ED7D11", x"ED86B4", x"ED9086", x"ED9A87",
+         x"EDA4B5", x"EDAF13", x"EDB99F", x"EDC45A", x"EDCF44", x"EDDA5E", x"EDE5A7", x"EDF11F",
+         x"EDFCC7", x"EE089F", x"EE14A7", x"EE20DE", x"EE2D46", x"EE39DF", x"EE46A7", x"EE53A0",
+         x"EE60CA", x"EE6E24", x"EE7BAF", x"EE896A", x"EE9756", x"EEA574", x"EEB3C2", x"EEC241",
+         x"EED0F1", x"EEDFD3", x"EEEEE5", x"EEFE29", x"EF0D9E", x"EF1D44", x"EF2D1B", x"EF3D23",
+         x"EF4D5D", x"EF5DC8", x"EF6E64", x"EF7F31", x"EF9030", x"EFA160", x"EFB2C0", x"EFC452",
+         x"EFD615", x"EFE809", x"EFFA2E", x"F00C84", x"F01F0B", x"F031C3", x"F044AB", x"F057C4",
+         x"F06B0D", x"F07E87", x"F09232", x"F0A60C", x"F0BA17", x"F0CE52", x"F0E2BD", x"F0F758",
+         x"F10C22", x"F1211D", x"F13646", x"F14B9F", x"F16127", x"F176DF", x"F18CC5", x"F1A2DA",
+         x"F1B91D", x"F1CF8F", x"F1E62F", x"F1FCFD", x"F213F9", x"F22B23", x"F2427A", x"F259FF",
+         x"F271B1", x"F2898F", x"F2A19B", x"F2B9D3", x"F2D237", x"F2EAC7", x"F30383", x"F31C6A",
+         x"F3357D", x"F34EBB", x"F36824", x"F381B7", x"F39B75", x"F3B55D", x"F3CF6E", x"F3E9AA",
+         x"F4040E", x"F41E9B", x"F43952", x"F45430", x"F46F37", x"F48A65", x"F4A5BB", x"F4C139",
+         x"F4DCDD", x"F4F8A8", x"F51499", x"F530B0", x"F54CED", x"F5694F", x"F585D6", x"F5A282",
+         x"F5BF52", x"F5DC46", x"F5F95E", x"F61699", x"F633F7", x"F65177", x"F66F1A", x"F68CDE",
+         x"F6AAC4", x"F6C8CB", x"F6E6F3", x"F7053B", x"F723A3", x"F7422B", x"F760D2", x"F77F98",
+         x"F79E7C", x"F7BD7E", x"F7DC9E", x"F7FBDA", x"F81B34", x"F83AAA", x"F85A3C", x"F879EA",
+         x"F899B2", x"F8B996", x"F8D993", x"F8F9AB", x"F919DC", x"F93A26", x"F95A88", x"F97B02",
+         x"F99B95", x"F9BC3E", x"F9DCFE", x"F9FDD5", x"FA1EC1", x"FA3FC3", x"FA60DA", x"FA8205",
+         x"FAA345", x"FAC498", x"FAE5FE", x"FB0777", x"FB2902", x"FB4A9E", x"FB6C4C", x"FB8E0B",
+         x"FBAFDA", x"FBD1B9", x"FBF3A7", x"FC15A5", x"FC37B0", x"FC59CA", x"FC7BF0", x"FC9E24",
+         x"FCC065", x"FCE2B1", x"FD0509", x"FD276B", x"FD49D8", x"FD6C50", x"FD8ED0", x"FDB15A",
+         x"FDD3EC", x"FDF687", x"FE1929", x"FE3BD1", x"FE5E81", x"FE8136", x"FEA3F1", x"FEC6B1",
+         x"FEE975", x"FF0C3E", x"FF2F0A", x"FF51D9", x"FF74AB", x"FF977E", x"FFBA53", x"FFDD29",
+         x"000000", x"0022D7", x"0045AD", x"006882", x"008B55", x"00AE27", x"00D0F6", x"00F3C2",
+         x"01168B", x"01394F", x"015C0F", x"017ECA", x"01A17F", x"01C42F", x"01E6D7", x"020979",
+         x"022C14", x"024EA6", x"027130", x"0293B0", x"02B628", x"02D895", x"02FAF7", x"031D4F",
+         x"033F9B", x"0361DC", x"038410", x"03A636", x"03C850", x"03EA5B", x"040C59", x"042E47",
+         x"045026", x"0471F5", x"0493B4", x"04B562", x"04D6FE", x"04F889", x"051A02", x"053B68",
+         x"055CBB", x"057DFB", x"059F26", x"05C03D", x"05E13F", x"06022B", x"062302", x"0643C2",
+         x"06646B", x"0684FE", x"06A578", x"06C5DA", x"06E624", x"070655", x"07266D", x"07466A",
+         x"07664E", x"078616", x"07A5C4", x"07C556", x"07E4CC", x"080426", x"082362", x"084282",
+         x"086184", x"088068", x"089F2E", x"08BDD5", x"08DC5D", x"08FAC5", x"09190D", x"093735",
+         x"09553C", x"097322", x"0990E6", x"09AE89", x"09CC09", x"09E967", x"0A06A2", x"0A23BA",
+         x"0A40AE", x"0A5D7E", x"0A7A2A", x"0A96B1", x"0AB313", x"0ACF50", x"0AEB67", x"0B0758",
+         x"0B2323", x"0B3EC7", x"0B5A45", x"0B759B", x"0B90C9", x"0BABD0", x"0BC6AE", x"0BE165",
+         x"0BFBF2", x"0C1656", x"0C3092", x"0C4AA3", x"0C648B", x"0C7E49", x"0C97DC", x"0CB145",
+         x"0CCA83", x"0CE396", x"0CFC7D", x"0D1539", x"0D2DC9", x"0D462D", x"0D5E65", x"0D7671",
+         x"0D8E4F", x"0DA601", x"0DBD86", x"0DD4DD", x"0DEC07", x"0E0303", x"0E19D1", x"0E3071",
+         x"0E46E3", x"0E5D26", x"0E733B", x"0E8921", x"0E9ED9", x"0EB461", x"0EC9BA", x"0EDEE3",
+         x"0EF3DE", x"0F08A8", x"0F1D43", x"0F31AE", x"0F45E9", x"0F59F4", x"0F6DCE", x"0F8179",
+         x"0F94F3", x"0FA83C", x"0FBB55", x"0FCE3D", x"0FE0F5", x"0FF37C", x"1005D2", x"1017F7",
+         x"1029EB", x"103BAE", x"104D40", x"105EA0", x"106FD0", x"1080CF", x"10919C", x"10A238",
+         x"10B2A3", x"10C2DD", x"10D2E5", x"10E2BC", x"10F262", x"1101D7", x"11111B", x"11202D",
+         x"112F0F", x"113DBF", x"114C3E", x"115A8C", x"1168AA", x"117696", x"118451", x"1191DC",
+         x"119F36", x"11AC60", x"11B959", x"11C621", x"11D2BA", x"11DF22", x"11EB59", x"11F761",
+         x"120339", x"120EE1", x"121A59", x"1225A2", x"1230BC", x"123BA6", x"124661", x"1250ED",
+         x"125B4B", x"126579", x"126F7A", x"12794C", x"1282EF", x"128C65", x"1295AE", x"129EC8",
+         x"12A7B5", x"12B075", x"12B909", x"12C16F", x"12C9A9", x"12D1B7", x"12D998", x"12E14E",
+         x"12E8D8", x"12F037", x"12F76B", x"12FE73", x"130552", x"130C06", x"131290", x"1318F0",
+         x"131F26", x"132534", x"132B18", x"1330D4", x"133668", x"133BD3", x"134117", x"134633",
+         x"134B28", x"134FF7", x"13549F", x"135920", x"135D7C", x"1361B3", x"1365C4", x"1369B1",
+         x"136D79", x"13711D", x"13749D", x"1377FA", x"137B34", x"137E4C", x"138141", x"138414",
+         x"1386C6", x"138957", x"138BC7", x"138E16", x"139046", x"139256", x"139448", x"13961A",
+         x"1397CE", x"139965", x"139ADE", x"139C3A", x"139D79", x"139E9D", x"139FA4", x"13A091",
+         x"13A162", x"13A219", x"13A2B6", x"13A33A", x"13A3A5", x"13A3F7", x"13A431", x"13A454",
+         x"13A45F", x"13A454", x"13A433", x"13A3FC", x"13A3AF", x"13A34E", x"13A2D9", x"13A250",
+         x"13A1B3", x"13A104", x"13A042", x"139F6F", x"139E8B", x"139D95", x"139C90", x"139B7B",
+         x"139A56", x"139923", x"1397E1", x"139692", x"139536", x"1393CD", x"139258", x"1390D8",
+         x"138F4C", x"138DB6", x"138C16", x"138A6D", x"1388BA", x"138700", x"13853D", x"138373",
+         x"1381A3", x"137FCC", x"137DF0", x"137C0E", x"137A29", x"13783F", x"137651", x"137461",
+         x"13726F", x"13707B", x"136E85", x"136C8F", x"136A99", x"1368A3", x"1366AF", x"1364BC",
+         x"1362CB", x"1360DD", x"135EF2", x"135D0B", x"135B29", x"13594B", x"135774", x"1355A2",
+         x"1353D7", x"135213", x"135057", x"134EA3", x"134CF9", x"134B57", x"1349C0", x"134834",
+         x"1346B3", x"13453E", x"1343D5", x"134279", x"13412A", x"133FEA", x"133EB8", x"133D95",
+         x"133C82", x"133B7F", x"133A8E", x"1339AD", x"1338DF", x"133823", x"13377A", x"1336E5",
+         x"133664", x"1335F8", x"1335A1", x"133560", x"133536", x"133522", x"133526", x"133542",
+         x"133577", x"1335C5", x"13362C", x"1336AE", x"13374A", x"133802", x"1338D6", x"1339C6",
+         x"133AD3", x"133BFD", x"133D45", x"133EAC", x"134031", x"1341D6", x"13439C", x"134581",
+         x"134788", x"1349B0", x"134BFB", x"134E68", x"1350F7", x"1353AB", x"135682", x"13597F",
+         x"135CA0", x"135FE6", x"136353", x"1366E6", x"136AA0", x"136E81", x"13728B", x"1376BD",
+         x"137B17", x"137F9B", x"138448", x"138920", x"138E23", x"139350", x"1398A9", x"139E2E",
+         x"13A3DF", x"13A9BE", x"13AFC9", x"13B602", x"13BC69", x"13C2FF", x"13C9C4", x"13D0B8",
+         x"13D7DB", x"13DF2F", x"13E6B4", x"13EE69", x"13F650", x"13FE68", x"1406B2", x"140F2F",
+         x"1417DE", x"1420C1", x"1429D7", x"143321", x"143CA0", x"144652", x"14503A", x"145A57",
+         x"1464AA", x"146F32", x"1479F1", x"1484E6", x"149012", x"149B75", x"14A70F", x"14B2E1",
+         x"14BEEC", x"14CB2E", x"14D7A9", x"14E45D", x"14F14A", x"14FE71", x"150BD1", x"15196B",
+         x"15273F", x"15354D", x"154396", x"15521A", x"1560D9", x"156FD3", x"157F09", x"158E7A",
+         x"159E27", x"15AE11", x"15BE36", x"15CE98", x"15DF37", x"15F012", x"16012B", x"161280",
+         x"162413", x"1635E3", x"1647F1", x"165A3C", x"166CC5", x"167F8C", x"169292", x"16A5D5",
+         x"16B957", x"16CD17", x"16E115", x"16F552", x"1709CE", x"171E88", x"173381", x"1748B9",
+         x"175E2F", x"1773E5", x"1789D9", x"17A00D", x"17B67F", x"17CD31", x"17E421", x"17FB51",
+         x"1812BF", x"182A6D", x"184259", x"185A85", x"1872EF", x"188B99", x"18A481", x"18BDA8",
+         x"18D70E", x"18F0B3", x"190A97", x"1924B8", x"193F19", x"1959B8", x"197495", x"198FB0",
+         x"19AB0A", x"19C6A1", x"19E277", x"19FE8A", x"1A1ADB", x"1A3769", x"1A5435", x"1A713D",
+         x"1A8E83", x"1AAC05", x"1AC9C5", x"1AE7C0", x"1B05F8", x"1B246C", x"1B431C", x"1B6208",
+         x"1B812F", x"1BA091", x"1BC02F", x"1BE007", x"1C0019", x"1C2066", x"1C40ED", x"1C61AE",
+         x"1C82A8", x"1CA3DB", x"1CC547", x"1CE6EC", x"1D08C9", x"1D2ADE", x"1D4D2B", x"1D6FAF",
+         x"1D926A", x"1DB55C", x"1DD885", x"1DFBE3", x"1E1F77", x"1E4341", x"1E673F", x"1E8B72",
+         x"1EAFD9", x"1ED474", x"1EF943", x"1F1E44", x"1F4378", x"1F68DF", x"1F8E77", x"1FB440",
+         x"1FDA3B", x"200066", x"2026C1", x"204D4B", x"207405", x"209AED", x"20C204", x"20E949",
+         x"2110BA", x"213859", x"216023", x"21881A", x"21B03C", x"21D888", x"2200FF", x"2229A0",
+         x"225269", x"227B5C", x"22A476", x"22CDB8", x"22F721", x"2320B0", x"234A66", x"237440",
+         x"239E3F", x"23C863", x"23F2AA", x"241D14", x"2447A0", x"24724E", x"249D1D", x"24C80D",
+         x"24F31C", x"251E4B", x"254998", x"257504", x"25A08C", x"25CC32", x"25F7F3", x"2623D0",
+         x"264FC7", x"267BD9", x"26A804", x"26D447", x"2700A3", x"272D15", x"27599F", x"27863E",
+         x"27B2F3", x"27DFBB", x"280C98", x"283988", x"28668A", x"28939D", x"28C0C2", x"28EDF6",
+         x"291B3A", x"29488D", x"2975ED", x"29A35B", x"29D0D5", x"29FE5A", x"2A2BEA", x"2A5985",
+         x"2A8728", x"2AB4D4", x"2AE288", x"2B1043", x"2B3E04", x"2B6BCA", x"2B9994", x"2BC763",
+         x"2BF534", x"2C2307", x"2C50DC", x"2C7EB1", x"2CAC86", x"2CDA59", x"2D082B", x"2D35F9",
+         x"2D63C4", x"2D918B", x"2DBF4C", x"2DED07", x"2E1ABB", x"2E4867", x"2E760A", x"2EA3A4",
+         x"2ED133", x"2EFEB7", x"2F2C2F", x"2F5999", x"2F86F6", x"2FB444", x"2FE182", x"300EB0",
+         x"303BCD", x"3068D7", x"3095CE", x"30C2B1", x"30EF7F", x"311C37", x"3148D9", x"317562",
+         x"31A1D4", x"31CE2C", x"31FA6A", x"32268C", x"325293", x"327E7D", x"32AA48", x"32D5F5",
+         x"330183", x"332CF0", x"33583B", x"338364", x"33AE6A", x"33D94B", x"340407", x"342E9E",
+         x"34590D", x"348355", x"34AD74", x"34D769", x"350134", x"352AD3", x"355446", x"357D8C",
+         x"35A6A4", x"35CF8C", x"35F845", x"3620CC", x"364922", x"367145", x"369934", x"36C0EF",
+         x"36E874", x"370FC3", x"3736DB", x"375DBA", x"378461", x"37AACD", x"37D0FF", x"37F6F5",
+         x"381CAE", x"384229", x"386766", x"388C64", x"38B121", x"38D59D", x"38F9D8", x"391DCF",
+         x"394182", x"3964F1", x"39881A", x"39AAFC", x"39CD97", x"39EFEA", x"3A11F4", x"3A33B3",
+         x"3A5528", x"3A7651", x"3A972E", x"3AB7BD", x"3AD7FD", x"3AF7EF", x"3B1790", x"3B36E0",
+         x"3B55DF", x"3B748B", x"3B92E3", x"3BB0E7", x"3BCE96", x"3BEBEF", x"3C08F1", x"3C259B",
+         x"3C41ED", x"3C5DE6", x"3C7984", x"3C94C8", x"3CAFB0", x"3CCA3B", x"3CE468", x"3CFE38",
+         x"3D17A9", x"3D30B9", x"3D4969", x"3D61B8", x"3D79A5", x"3D912F", x"3DA855", x"3DBF16",
+         x"3DD573", x"3DEB69", x"3E00F8", x"3E1620", x"3E2AE0", x"3E3F37", x"3E5324", x"3E66A7",
+         x"3E79BE", x"3E8C6A", x"3E9EA8", x"3EB07A", x"3EC1DD", x"3ED2D2", x"3EE357", x"3EF36C",
+         x"3F0310", x"3F1243", x"3F2104", x"3F2F51", x"3F3D2B", x"3F4A91", x"3F5782", x"3F63FE",
+         x"3F7003", x"3F7B92", x"3F86A9", x"3F9149", x"3F9B6F", x"3FA51D", x"3FAE50", x"3FB709",
+         x"3FBF47", x"3FC70A", x"3FCE50", x"3FD519", x"3FDB65", x"3FE134", x"3FE683", x"3FEB54",
+         x"3FEFA5", x"3FF376", x"3FF6C6", x"3FF996", x"3FFBE3", x"3FFDAF", x"3FFEF7", x"3FFFBD",
+         x"3FFFFF", x"3FFFBD", x"3FFEF6", x"3FFDAA", x"3FFBD9", x"3FF982", x"3FF6A4", x"3FF340",
+         x"3FEF54", x"3FEAE1", x"3FE5E5", x"3FE061", x"3FDA54", x"3FD3BE", x"3FCC9E", x"3FC4F4",
+         x"3FBCC0", x"3FB401", x"3FAAB7", x"3FA0E1", x"3F967F", x"3F8B92", x"3F8018", x"3F7411",
+         x"3F677D", x"3F5A5C", x"3F4CAD", x"3F3E70", x"3F2FA5", x"3F204C", x"3F1064", x"3EFFED",
+         x"3EEEE7", x"3EDD51", x"3ECB2C", x"3EB876", x"3EA531", x"3E915C", x"3E7CF6", x"3E67FF",
+         x"3E5278", x"3E3C5F", x"3E25B6", x"3E0E7B", x"3DF6AF", x"3DDE51", x"3DC562", x"3DABE1",
+         x"3D91CE", x"3D7729", x"3D5BF2", x"3D4029", x"3D23CE", x"3D06E0", x"3CE960", x"3CCB4E",
+         x"3CACAA", x"3C8D73", x"3C6DAA", x"3C4D4E", x"3C2C60", x"3C0ADF", x"3BE8CD", x"3BC627",
+         x"3BA2F0", x"3B7F26", x"3B5ACA", x"3B35DC", x"3B105B", x"3AEA49", x"3AC3A5", x"3A9C6F",
+         x"3A74A7", x"3A4C4E", x"3A2363", x"39F9E7", x"39CFDA", x"39A53C", x"397A0D", x"394E4D",
+         x"3921FD", x"38F51C", x"38C7AC", x"3899AB", x"386B1B", x"383BFB", x"380C4C", x"37DC0E",
+         x"37AB41", x"3779E6", x"3747FD", x"371585", x"36E280", x"36AEEE", x"367ACE", x"364622",
+         x"3610EA", x"35DB25", x"35A4D4", x"356DF9", x"353692", x"34FEA0", x"34C624", x"348D1E",
+         x"34538F", x"341977", x"33DED5", x"33A3AC", x"3367FA", x"332BC1", x"32EF02", x"32B1BB",
+         x"3273EF", x"32359D", x"31F6C5", x"31B769", x"317789", x"313725", x"30F63E", x"30B4D5",
+         x"3072E9", x"30307C", x"2FED8D", x"2FAA1F", x"2F6630", x"2F21C2", x"2EDCD5", x"2E976A",
+         x"2E5181", x"2E0B1B", x"2DC439", x"2D7CDB", x"2D3502", x"2CECAF", x"2CA3E1", x"2C5A9B",
+         x"2C10DB", x"2BC6A4", x"2B7BF6", x"2B30D1", x"2AE536", x"2A9926", x"2A4CA1", x"29FFA9",
+         x"29B23E", x"296460", x"291611", x"28C750", x"287820", x"282880", x"27D872", x"2787F6",
+         x"27370C", x"26E5B7", x"2693F6", x"2641CA", x"25EF34", x"259C36", x"2548CE", x"24F500",
+         x"24A0CB", x"244C30", x"23F730", x"23A1CC", x"234C04", x"22F5DB", x"229F50", x"224864",
+         x"21F118", x"21996E", x"214165", x"20E8FF", x"20903E", x"203721", x"1FDDA9", x"1F83D8",
+         x"1F29AF", x"1ECF2E", x"1E7457", x"1E1929", x"1DBDA7", x"1D61D2", x"1D05A9", x"1CA92F",
+         x"1C4C63", x"1BEF48", x"1B91DE", x"1B3426", x"1AD621", x"1A77D0", x"1A1934", x"19BA4F",
+         x"195B20", x"18FBAA", x"189BEC", x"183BE9", x"17DBA1", x"177B15", x"171A47", x"16B937",
+         x"1657E6", x"15F656", x"159487", x"15327A", x"14D032", x"146DAE", x"140AEF", x"13A7F8",
+         x"1344C8", x"12E162", x"127DC5", x"1219F4", x"11B5EF", x"1151B8", x"10ED4F", x"1088B5",
+         x"1023EC", x"0FBEF5", x"0F59D1", x"0EF481", x"0E8F06", x"0E2962", x"0DC395", x"0D5DA0",
+         x"0CF785", x"0C9145", x"0C2AE1", x"0BC45A", x"0B5DB1", x"0AF6E7", x"0A8FFE", x"0A28F7",
+         x"09C1D3", x"095A92", x"08F337", x"088BC2", x"082434", x"07BC8F", x"0754D4", x"06ED04",
+         x"06851F", x"061D28", x"05B520", x"054D07", x"04E4DE", x"047CA8", x"041465", x"03AC16",
+         x"0343BC", x"02DB59", x"0272EE", x"020A7C", x"01A204", x"013987", x"00D107", x"006884"),
+        -- octave 9
+        (x"000000", x"FFCDBC", x"FF9B78", x"FF6935", x"FF36F1", x"FF04AF", x"FED26D", x"FEA02B",
+         x"FE6DEB", x"FE3BAB", x"FE096D", x"FDD72F", x"FDA4F3", x"FD72B9", x"FD4080", x"FD0E49",
+         x"FCDC13", x"FCA9E0", x"FC77AE", x"FC457F", x"FC1352", x"FBE128", x"FBAF00", x"FB7CDA",
+         x"FB4AB8", x"FB1898", x"FAE67C", x"FAB462", x"FA824C", x"FA5039", x"FA1E2A", x"F9EC1E",
+         x"F9BA16", x"F98812", x"F95612", x"F92416", x"F8F21F", x"F8C02B", x"F88E3C", x"F85C52",
+         x"F82A6D", x"F7F88C", x"F7C6B0", x"F794D9", x"F76308", x"F7313C", x"F6FF75", x"F6CDB3",
+         x"F69BF8", x"F66A42", x"F63892", x"F606E8", x"F5D545", x"F5A3A7", x"F57210", x"F54080",
+         x"F50EF6", x"F4DD73", x"F4ABF7", x"F47A81", x"F44913", x"F417AC", x"F3E64D", x"F3B4F5",
+         x"F383A4", x"F3525B", x"F3211A", x"F2EFE1", x"F2BEB0", x"F28D87", x"F25C67", x"F22B4F",
+         x"F1FA3F", x"F1C938", x"F1983A", x"F16745", x"F13658", x"F10575", x"F0D49B", x"F0A3CB",
+         x"F07304", x"F04246", x"F01192", x"EFE0E8", x"EFB048", x"EF7FB2", x"EF4F26", x"EF1EA5",
+         x"EEEE2E", x"EEBDC1", x"EE8D5F", x"EE5D08", x"EE2CBC", x"EDFC7B", x"EDCC45", x"ED9C1A",
+         x"ED6BFA", x"ED3BE6", x"ED0BDD", x"ECDBE1", x"ECABF0", x"EC7C0A", x"EC4C31", x"EC1C64",
+         x"EBECA4", x"EBBCEF", x"EB8D48", x"EB5DAD", x"EB2E1E", x"EAFE9C", x"EACF28", x"EA9FC0",
+         x"EA7066", x"EA4119", x"EA11D9", x"E9E2A7", x"E9B382", x"E9846C", x"E95563", x"E92668",
+         x"E8F77B", x"E8C89D", x"E899CC", x"E86B0A", x"E83C57", x"E80DB3", x"E7DF1D", x"E7B096",
+         x"E7821E", x"E753B5", x"E7255B", x"E6F711", x"E6C8D6", x"E69AAB", x"E66C8F", x"E63E83",
+         x"E61087", x"E5E29B", x"E5B4BF", x"E586F4", x"E55938", x"E52B8D", x"E4FDF3", x"E4D069",
+         x"E4A2F0", x"E47588", x"E44831", x"E41AEB", x"E3EDB7", x"E3C093", x"E39381", x"E36681",
+         x"E33992", x"E30CB5", x"E2DFEA", x"E2B330", x"E28689", x"E259F4", x"E22D71", x"E20101",
+         x"E1D4A3", x"E1A858", x"E17C20", x"E14FFA", x"E123E7", x"E0F7E7", x"E0CBFB", x"E0A022",
+         x"E0745C", x"E048A9", x"E01D0A", x"DFF17F", x"DFC607", x"DF9AA4", x"DF6F54", x"DF4419",
+         x"DF18F1", x"DEEDDE", x"DEC2E0", x"DE97F5", x"DE6D20", x"DE425F", x"DE17B3", x"DDED1C",
+         x"DDC29A", x"DD982D", x"DD6DD5", x"DD4393", x"DD1966", x"DCEF4E", x"DCC54C", x"DC9B60",
+         x"DC718A", x"DC47CA", x"DC1E1F", x"DBF48B", x"DBCB0D", x"DBA1A6", x"DB7855", x"DB4F1A",
+         x"DB25F6", x"DAFCE9", x"DAD3F2", x"DAAB13", x"DA824A", x"DA5999", x"DA30FF", x"DA087C",
+         x"D9E011", x"D9B7BD", x"D98F80", x"D9675C", x"D93F4F", x"D9175A", x"D8EF7E", x"D8C7B9",
+         x"D8A00C", x"D87878", x"D850FC", x"D82999", x"D8024E", x"D7DB1C", x"D7B402", x"D78D02",
+         x"D7661A", x"D73F4C", x"D71896", x"D6F1FA", x"D6CB77", x"D6A50E", x"D67EBE", x"D65888",
+         x"D6326B", x"D60C68", x"D5E67F", x"D5C0B0", x"D59AFC", x"D57561", x"D54FE0", x"D52A7A",
+         x"D5052E", x"D4DFFD", x"D4BAE6", x"D495EA", x"D47109", x"D44C43", x"D42798", x"D40307",
+         x"D3DE92", x"D3BA38", x"D395F9", x"D371D6", x"D34DCE", x"D329E2", x"D30612", x"D2E25D",
+         x"D2BEC4", x"D29B47", x"D277E6", x"D254A1", x"D23178", x"D20E6C", x"D1EB7B", x"D1C8A8",
+         x"D1A5F0", x"D18356", x"D160D8", x"D13E76", x"D11C32", x"D0FA0B", x"D0D800", x"D0B613",
+         x"D09442", x"D07290", x"D050FA", x"D02F82", x"D00E27", x"CFECEA", x"CFCBCA", x"CFAAC9",
+         x"CF89E5", x"CF691F", x"CF4877", x"CF27ED", x"CF0781", x"CEE733", x"CEC704", x"CEA6F3",
+         x"CE8700", x"CE672C", x"CE4776", x"CE27E0", x"CE0867", x"CDE90E", x"CDC9D4", x"CDAAB9",
+         x"CD8BBC", x"CD6CDF", x"CD4E21", x"CD2F82", x"CD1103", x"CCF2A3", x"CCD462", x"CCB642",
+         x"CC9840", x"CC7A5F", x"CC5C9D", x"CC3EFB", x"CC2179", x"CC0417", x"CBE6D5", x"CBC9B3",
+         x"CBACB2", x"CB8FD0", x"CB730F", x"CB566F", x"CB39EF", x"CB1D8F", x"CB0150", x"CAE532",
+         x"CAC935", x"CAAD58", x"CA919C", x"CA7601", x"CA5A88", x"CA3F2F", x"CA23F7", x"CA08E1",
+         x"C9EDEC", x"C9D319", x"C9B866", x"C99DD6", x"C98366", x"C96919", x"C94EED", x"C934E3",
+         x"C91AFA", x"C90134", x"C8E78F", x"C8CE0D", x"C8B4AC", x"C89B6E", x"C88251", x"C86957",
+         x"C85080", x"C837CA", x"C81F37", x"C806C7", x"C7EE79", x"C7D64D", x"C7BE44", x"C7A65E",
+         x"C78E9B", x"C776FA", x"C75F7D", x"C74822", x"C730EA", x"C719D6", x"C702E4", x"C6EC16",
+         x"C6D56B", x"C6BEE3", x"C6A87E", x"C6923D", x"C67C1F", x"C66625", x"C6504E", x"C63A9B",
+         x"C6250B", x"C60F9F", x"C5FA57", x"C5E533", x"C5D032", x"C5BB55", x"C5A69D", x"C59208",
+         x"C57D97", x"C5694B", x"C55522", x"C5411E", x"C52D3E", x"C51982", x"C505EB", x"C4F278",
+         x"C4DF29", x"C4CBFF", x"C4B8FA", x"C4A619", x"C4935C", x"C480C4", x"C46E51", x"C45C03",
+         x"C449DA", x"C437D5", x"C425F5", x"C4143A", x"C402A4", x"C3F133", x"C3DFE7", x"C3CEC1",
+         x"C3BDBF", x"C3ACE2", x"C39C2B", x"C38B99", x"C37B2C", x"C36AE5", x"C35AC3", x"C34AC6",
+         x"C33AEF", x"C32B3D", x"C31BB1", x"C30C4B", x"C2FD0A", x"C2EDEE", x"C2DEF9", x"C2D029",
+         x"C2C17E", x"C2B2FA", x"C2A49B", x"C29662", x"C2884F", x"C27A62", x"C26C9B", x"C25EFA",
+         x"C2517F", x"C2442A", x"C236FB", x"C229F2", x"C21D10", x"C21053", x"C203BD", x"C1F74D",
+         x"C1EB03", x"C1DEDF", x"C1D2E2", x"C1C70B", x"C1BB5B", x"C1AFD1", x"C1A46D", x"C19930",
+         x"C18E1A", x"C1832A", x"C17860", x"C16DBD", x"C16341", x"C158EB", x"C14EBC", x"C144B3",
+         x"C13AD1", x"C13116", x"C12782", x"C11E14", x"C114CE", x"C10BAE", x"C102B5", x"C0F9E2",
+         x"C0F137", x"C0E8B3", x"C0E055", x"C0D81E", x"C0D00F", x"C0C826", x"C0C064", x"C0B8CA",
+         x"C0B156", x"C0AA09", x"C0A2E4", x"C09BE5", x"C0950E", x"C08E5E", x"C087D5", x"C08173",
+         x"C07B38", x"C07525", x"C06F38", x"C06973", x"C063D5", x"C05E5E", x"C0590F", x"C053E7",
+         x"C04EE6", x"C04A0C", x"C0455A", x"C040CF", x"C03C6B", x"C0382F", x"C0341A", x"C0302C",
+         x"C02C66", x"C028C7", x"C0254F", x"C021FF", x"C01ED6", x"C01BD5", x"C018FB", x"C01648",
+         x"C013BD", x"C0115A", x"C00F1D", x"C00D08", x"C00B1B", x"C00955", x"C007B7", x"C00640",
+         x"C004F0", x"C003C8", x"C002C8", x"C001EE", x"C0013D", x"C000B3", x"C00050", x"C00015",
+         x"C00001", x"C00015", x"C00050", x"C000B3", x"C0013D", x"C001EE", x"C002C8", x"C003C8",
+         x"C004F0", x"C00640", x"C007B7", x"C00955", x"C00B1B", x"C00D08", x"C00F1D", x"C0115A",
+         x"C013BD", x"C01648", x"C018FB", x"C01BD5", x"C01ED6", x"C021FF", x"C0254F", x"C028C7",
+         x"C02C66", x"C0302C", x"C0341A", x"C0382F", x"C03C6B", x"C040CF", x"C0455A", x"C04A0C",
+         x"C04EE6", x"C053E7", x"C0590F", x"C05E5E", x"C063D5", x"C06973", x"C06F38", x"C07525",
+         x"C07B38", x"C08173", x"C087D5", x"C08E5E", x"C0950E", x"C09BE5", x"C0A2E4", x"C0AA09",
+         x"C0B156", x"C0B8CA", x"C0C064", x"C0C826", x"C0D00F", x"C0D81E", x"C0E055", x"C0E8B3",
+         x"C0F137", x"C0F9E2", x"C102B5", x"C10BAE", x"C114CE", x"C11E14", x"C12782", x"C13116",
+         x"C13AD1", x"C144B3", x"C14EBC", x"C158EB", x"C16341", x"C16DBD", x"C17860", x"C1832A",
+         x"C18E1A", x"C19930", x"C1A46D", x"C1AFD1", x"C1BB5B", x"C1C70B", x"C1D2E2", x"C1DEDF",
+         x"C1EB03", x"C1F74D", x"C203BD", x"C21053", x"C21D10", x"C229F2", x"C236FB", x"C2442A",
+         x"C2517F", x"C25EFA", x"C26C9B", x"C27A62", x"C2884F", x"C29662", x"C2A49B", x"C2B2FA",
+         x"C2C17E", x"C2D029", x"C2DEF9", x"C2EDEE", x"C2FD0A", x"C30C4B", x"C31BB1", x"C32B3D",
+         x"C33AEF", x"C34AC6", x"C35AC3", x"C36AE5", x"C37B2C", x"C38B99", x"C39C2B", x"C3ACE2",
+         x"C3BDBF", x"C3CEC1", x"C3DFE7", x"C3F133", x"C402A4", x"C4143A", x"C425F5", x"C437D5",
+         x"C449DA", x"C45C03", x"C46E51", x"C480C4", x"C4935C", x"C4A619", x"C4B8FA", x"C4CBFF",
+         x"C4DF29", x"C4F278", x"C505EB", x"C51982", x"C52D3E", x"C5411E", x"C55522", x"C5694B",
+         x"C57D97", x"C59208", x"C5A69D", x"C5BB55", x"C5D032", x"C5E533", x"C5FA57", x"C60F9F",
+         x"C6250B", x"C63A9B", x"C6504E", x"C66625", x"C67C1F", x"C6923D", x"C6A87E", x"C6BEE3",
+         x"C6D56B", x"C6EC16", x"C702E4", x"C719D6", x"C730EA", x"C74822", x"C75F7D", x"C776FA",
+         x"C78E9B", x"C7A65E", x"C7BE44", x"C7D64D", x"C7EE79", x"C806C7", x"C81F37", x"C837CA",
+         x"C85080", x"C86957", x"C88251", x"C89B6E", x"C8B4AC", x"C8CE0D", x"C8E78F", x"C90134",
+         x"C91AFA", x"C934E3", x"C94EED", x"C96919", x"C98366", x"C99DD6", x"C9B866", x"C9D319",
+         x"C9EDEC", x"CA08E1", x"CA23F7", x"CA3F2F", x"CA5A88", x"CA7601", x"CA919C", x"CAAD58",
+         x"CAC935", x"CAE532", x"CB0150", x"CB1D8F", x"CB39EF", x"CB566F", x"CB730F", x"CB8FD0",
+         x"CBACB2", x"CBC9B3", x"CBE6D5", x"CC0417", x"CC2179", x"CC3EFB", x"CC5C9D", x"CC7A5F",
+         x"CC9840", x"CCB642", x"CCD462", x"CCF2A3", x"CD1103", x"CD2F82", x"CD4E21", x"CD6CDF",
+         x"CD8BBC", x"CDAAB9", x"CDC9D4", x"CDE90E", x"CE0867", x"CE27E0", x"CE4776", x"CE672C",
+         x"CE8700", x"CEA6F3", x"CEC704", x"CEE733", x"CF0781", x"CF27ED", x"CF4877", x"CF691F",
+         x"CF89E5", x"CFAAC9", x"CFCBCA", x"CFECEA", x"D00E27", x"D02F82", x"D050FA", x"D07290",
+         x"D09442", x"D0B613", x"D0D800", x"D0FA0B", x"D11C32", x"D13E76", x"D160D8", x"D18356",
+         x"D1A5F0", x"D1C8A8", x"D1EB7B", x"D20E6C", x"D23178", x"D254A1", x"D277E6", x"D29B47",
+         x"D2BEC4", x"D2E25D", x"D30612", x"D329E2", x"D34DCE", x"D371D6", x"D395F9", x"D3BA38",
+         x"D3DE92", x"D40307", x"D42798", x"D44C43", x"D47109", x"D495EA", x"D4BAE6", x"D4DFFD",
+         x"D5052E", x"D52A7A", x"D54FE0", x"D57561", x"D59AFC", x"D5C0B0", x"D5E67F", x"D60C68",
+         x"D6326B", x"D65888", x"D67EBE", x"D6A50E", x"D6CB77", x"D6F1FA", x"D71896", x"D73F4C",
+         x"D7661A", x"D78D02", x"D7B402", x"D7DB1C", x"D8024E", x"D82999", x"D850FC", x"D87878",
+         x"D8A00C", x"D8C7B9", x"D8EF7E", x"D9175A", x"D93F4F", x"D9675C", x"D98F80", x"D9B7BD",
+         x"D9E011", x"DA087C", x"DA30FF", x"DA5999", x"DA824A", x"DAAB13", x"DAD3F2", x"DAFCE9",
+         x"DB25F6", x"DB4F1A", x"DB7855", x"DBA1A6", x"DBCB0D", x"DBF48B", x"DC1E1F", x"DC47CA",
+         x"DC718A", x"DC9B60", x"DCC54C", x"DCEF4E", x"DD1966", x"DD4393", x"DD6DD5", x"DD982D",
+         x"DDC29A", x"DDED1C", x"DE17B3", x"DE425F", x"DE6D20", x"DE97F5", x"DEC2E0", x"DEEDDE",
+         x"DF18F1", x"DF4419", x"DF6F54", x"DF9AA4", x"DFC607", x"DFF17F", x"E01D0A", x"E048A9",
+         x"E0745C", x"E0A022", x"E0CBFB", x"E0F7E7", x"E123E7", x"E14FFA", x"E17C20", x"E1A858",
+         x"E1D4A3", x"E20101", x"E22D71", x"E259F4", x"E28689", x"E2B330", x"E2DFEA", x"E30CB5",
+         x"E33992", x"E36681", x"E39381", x"E3C093", x"E3EDB7", x"E41AEB", x"E44831", x"E47588",
+         x"E4A2F0", x"E4D069", x"E4FDF3", x"E52B8D", x"E55938", x"E586F4", x"E5B4BF", x"E5E29B",
+         x"E61087", x"E63E83", x"E66C8F", x"E69AAB", x"E6C8D6", x"E6F711", x"E7255B", x"E753B5",
+         x"E7821E", x"E7B096", x"E7DF1D", x"E80DB3", x"E83C57", x"E86B0A", x"E899CC", x"E8C89D",
+         x"E8F77B", x"E92668", x"E95563", x"E9846C", x"E9B382", x"E9E2A7", x"EA11D9", x"EA4119",
+         x"EA7066", x"EA9FC0", x"EACF28", x"EAFE9C", x"EB2E1E", x"EB5DAD", x"EB8D48", x"EBBCEF",
+         x"EBECA4", x"EC1C64", x"EC4C31", x"EC7C0A", x"ECABF0", x"ECDBE1", x"ED0BDD", x"ED3BE6",
+         x"ED6BFA", x"ED9C1A", x"EDCC45", x"EDFC7B", x"EE2CBC", x"EE5D08", x"EE8D5F", x"EEBDC1",
+         x"EEEE2E", x"EF1EA5", x"EF4F26", x"EF7FB2", x"EFB048", x"EFE0E8", x"F01192", x"F04246",
+         x"F07304", x"F0A3CB", x"F0D49B", x"F10575", x"F13658", x"F16745", x"F1983A", x"F1C938",
+         x"F1FA3F", x"F22B4F", x"F25C67", x"F28D87", x"F2BEB0", x"F2EFE1", x"F3211A", x"F3525B",
+         x"F383A4", x"F3B4F5", x"F3E64D", x"F417AC", x"F44913", x"F47A81", x"F4ABF7", x"F4DD73",
+         x"F50EF6", x"F54080", x"F57210", x"F5A3A7", x"F5D545", x"F606E8", x"F63892", x"F66A42",
+         x"F69BF8", x"F6CDB3", x"F6FF75", x"F7313C", x"F76308", x"F794D9", x"F7C6B0", x"F7F88C",
+         x"F82A6D", x"F85C52", x"F88E3C", x"F8C02B", x"F8F21F", x"F92416", x"F95612", x"F98812",
+         x"F9BA16", x"F9EC1E", x"FA1E2A", x"FA5039", x"FA824C", x"FAB462", x"FAE67C", x"FB1898",
+         x"FB4AB8", x"FB7CDA", x"FBAF00", x"FBE128", x"FC1352", x"FC457F", x"FC77AE", x"FCA9E0",
+         x"FCDC13", x"FD0E49", x"FD4080", x"FD72B9", x"FDA4F3", x"FDD72F", x"FE096D", x"FE3BAB",
+         x"FE6DEB", x"FEA02B", x"FED26D", x"FF04AF", x"FF36F1", x"FF6935", x"FF9B78", x"FFCDBC",
+         x"000000", x"003244", x"006488", x"0096CB", x"00C90F", x"00FB51", x"012D93", x"015FD5",
+         x"019215", x"01C455", x"01F693", x"0228D1", x"025B0D", x"028D47", x"02BF80", x"02F1B7",
+         x"0323ED", x"035620", x"038852", x"03BA81", x"03ECAE", x"041ED8", x"045100", x"048326",
+         x"04B548", x"04E768", x"051984", x"054B9E", x"057DB4", x"05AFC7", x"05E1D6", x"0613E2",
+         x"0645EA", x"0677EE", x"06A9EE", x"06DBEA", x"070DE1", x"073FD5", x"0771C4", x"07A3AE",
+         x"07D593", x"080774", x"083950", x"086B27", x"089CF8", x"08CEC4", x"09008B", x"09324D",
+         x"096408", x"0995BE", x"09C76E", x"09F918", x"0A2ABB", x"0A5C59", x"0A8DF0", x"0ABF80",
+         x"0AF10A", x"0B228D", x"0B5409", x"0B857F", x"0BB6ED", x"0BE854", x"0C19B3", x"0C4B0B",
+         x"0C7C5C", x"0CADA5", x"0CDEE6", x"0D101F", x"0D4150", x"0D7279", x"0DA399", x"0DD4B1",
+         x"0E05C1", x"0E36C8", x"0E67C6", x"0E98BB", x"0EC9A8", x"0EFA8B", x"0F2B65", x"0F5C35",
+         x"0F8CFC", x"0FBDBA", x"0FEE6E", x"101F18", x"104FB8", x"10804E", x"10B0DA", x"10E15B",
+         x"1111D2", x"11423F", x"1172A1", x"11A2F8", x"11D344", x"120385", x"1233BB", x"1263E6",
+         x"129406", x"12C41A", x"12F423", x"13241F", x"135410", x"1383F6", x"13B3CF", x"13E39C",
+         x"14135C", x"144311", x"1472B8", x"14A253", x"14D1E2", x"150164", x"1530D8", x"156040",
+         x"158F9A", x"15BEE7", x"15EE27", x"161D59", x"164C7E", x"167B94", x"16AA9D", x"16D998",
+         x"170885", x"173763", x"176634", x"1794F6", x"17C3A9", x"17F24D", x"1820E3", x"184F6A",
+         x"187DE2", x"18AC4B", x"18DAA5", x"1908EF", x"19372A", x"196555", x"199371", x"19C17D",
+         x"19EF79", x"1A1D65", x"1A4B41", x"1A790C", x"1AA6C8", x"1AD473", x"1B020D", x"1B2F97",
+         x"1B5D10", x"1B8A78", x"1BB7CF", x"1BE515", x"1C1249", x"1C3F6D", x"1C6C7F", x"1C997F",
+         x"1CC66E", x"1CF34B", x"1D2016", x"1D4CD0", x"1D7977", x"1DA60C", x"1DD28F", x"1DFEFF",
+         x"1E2B5D", x"1E57A8", x"1E83E0", x"1EB006", x"1EDC19", x"1F0819", x"1F3405", x"1F5FDE",
+         x"1F8BA4", x"1FB757", x"1FE2F6", x"200E81", x"2039F9", x"20655C", x"2090AC", x"20BBE7",
+         x"20E70F", x"211222", x"213D20", x"21680B", x"2192E0", x"21BDA1", x"21E84D", x"2212E4",
+         x"223D66", x"2267D3", x"22922B", x"22BC6D", x"22E69A", x"2310B2", x"233AB4", x"2364A0",
+         x"238E76", x"23B836", x"23E1E1", x"240B75", x"2434F3", x"245E5A", x"2487AB", x"24B0E6",
+         x"24DA0A", x"250317", x"252C0E", x"2554ED", x"257DB6", x"25A667", x"25CF01", x"25F784",
+         x"261FEF", x"264843", x"267080", x"2698A4", x"26C0B1", x"26E8A6", x"271082", x"273847",
+         x"275FF4", x"278788", x"27AF04", x"27D667", x"27FDB2", x"2824E4", x"284BFE", x"2872FE",
+         x"2899E6", x"28C0B4", x"28E76A", x"290E06", x"293489", x"295AF2", x"298142", x"29A778",
+         x"29CD95", x"29F398", x"2A1981", x"2A3F50", x"2A6504", x"2A8A9F", x"2AB020", x"2AD586",
+         x"2AFAD2", x"2B2003", x"2B451A", x"2B6A16", x"2B8EF7", x"2BB3BD", x"2BD868", x"2BFCF9",
+         x"2C216E", x"2C45C8", x"2C6A07", x"2C8E2A", x"2CB232", x"2CD61E", x"2CF9EE", x"2D1DA3",
+         x"2D413C", x"2D64B9", x"2D881A", x"2DAB5F", x"2DCE88", x"2DF194", x"2E1485", x"2E3758",
+         x"2E5A10", x"2E7CAA", x"2E9F28", x"2EC18A", x"2EE3CE", x"2F05F5", x"2F2800", x"2F49ED",
+         x"2F6BBE", x"2F8D70", x"2FAF06", x"2FD07E", x"2FF1D9", x"301316", x"303436", x"305537",
+         x"30761B", x"3096E1", x"30B789", x"30D813", x"30F87F", x"3118CD", x"3138FC", x"31590D",
+         x"317900", x"3198D4", x"31B88A", x"31D820", x"31F799", x"3216F2", x"32362C", x"325547",
+         x"327444", x"329321", x"32B1DF", x"32D07E", x"32EEFD", x"330D5D", x"332B9E", x"3349BE",
+         x"3367C0", x"3385A1", x"33A363", x"33C105", x"33DE87", x"33FBE9", x"34192B", x"34364D",
+         x"34534E", x"347030", x"348CF1", x"34A991", x"34C611", x"34E271", x"34FEB0", x"351ACE",
+         x"3536CB", x"3552A8", x"356E64", x"3589FF", x"35A578", x"35C0D1", x"35DC09", x"35F71F",
+         x"361214", x"362CE7", x"36479A", x"36622A", x"367C9A", x"3696E7", x"36B113", x"36CB1D",
+         x"36E506", x"36FECC", x"371871", x"3731F3", x"374B54", x"376492", x"377DAF", x"3796A9",
+         x"37AF80", x"37C836", x"37E0C9", x"37F939", x"381187", x"3829B3", x"3841BC", x"3859A2",
+         x"387165", x"388906", x"38A083", x"38B7DE", x"38CF16", x"38E62A", x"38FD1C", x"3913EA",
+         x"392A95", x"39411D", x"395782", x"396DC3", x"3983E1", x"3999DB", x"39AFB2", x"39C565",
+         x"39DAF5", x"39F061", x"3A05A9", x"3A1ACD", x"3A2FCE", x"3A44AB", x"3A5963", x"3A6DF8",
+         x"3A8269", x"3A96B5", x"3AAADE", x"3ABEE2", x"3AD2C2", x"3AE67E", x"3AFA15", x"3B0D88",
+         x"3B20D7", x"3B3401", x"3B4706", x"3B59E7", x"3B6CA4", x"3B7F3C", x"3B91AF", x"3BA3FD",
+         x"3BB626", x"3BC82B", x"3BDA0B", x"3BEBC6", x"3BFD5C", x"3C0ECD", x"3C2019", x"3C313F",
+         x"3C4241", x"3C531E", x"3C63D5", x"3C7467", x"3C84D4", x"3C951B", x"3CA53D", x"3CB53A",
+         x"3CC511", x"3CD4C3", x"3CE44F", x"3CF3B5", x"3D02F6", x"3D1212", x"3D2107", x"3D2FD7",
+         x"3D3E82", x"3D4D06", x"3D5B65", x"3D699E", x"3D77B1", x"3D859E", x"3D9365", x"3DA106",
+         x"3DAE81", x"3DBBD6", x"3DC905", x"3DD60E", x"3DE2F0", x"3DEFAD", x"3DFC43", x"3E08B3",
+         x"3E14FD", x"3E2121", x"3E2D1E", x"3E38F5", x"3E44A5", x"3E502F", x"3E5B93", x"3E66D0",
+         x"3E71E6", x"3E7CD6", x"3E87A0", x"3E9243", x"3E9CBF", x"3EA715", x"3EB144", x"3EBB4D",
+         x"3EC52F", x"3ECEEA", x"3ED87E", x"3EE1EC", x"3EEB32", x"3EF452", x"3EFD4B", x"3F061E",
+         x"3F0EC9", x"3F174D", x"3F1FAB", x"3F27E2", x"3F2FF1", x"3F37DA", x"3F3F9C", x"3F4736",
+         x"3F4EAA", x"3F55F7", x"3F5D1C", x"3F641B", x"3F6AF2", x"3F71A2", x"3F782B", x"3F7E8D",
+         x"3F84C8", x"3F8ADB", x"3F90C8", x"3F968D", x"3F9C2B", x"3FA1A2", x"3FA6F1", x"3FAC19",
+         x"3FB11A", x"3FB5F4", x"3FBAA6", x"3FBF31", x"3FC395", x"3FC7D1", x"3FCBE6", x"3FCFD4",
+         x"3FD39A", x"3FD739", x"3FDAB1", x"3FDE01", x"3FE12A", x"3FE42B", x"3FE705", x"3FE9B8",
+         x"3FEC43", x"3FEEA6", x"3FF0E3", x"3FF2F8", x"3FF4E5", x"3FF6AB", x"3FF849", x"3FF9C0",
+         x"3FFB10", x"3FFC38", x"3FFD38", x"3FFE12", x"3FFEC3", x"3FFF4D", x"3FFFB0", x"3FFFEB",
+         x"3FFFFF", x"3FFFEB", x"3FFFB0", x"3FFF4D", x"3FFEC3", x"3FFE12", x"3FFD38", x"3FFC38",
+         x"3FFB10", x"3FF9C0", x"3FF849", x"3FF6AB", x"3FF4E5", x"3FF2F8", x"3FF0E3", x"3FEEA6",
+         x"3FEC43", x"3FE9B8", x"3FE705", x"3FE42B", x"3FE12A", x"3FDE01", x"3FDAB1", x"3FD739",
+         x"3FD39A", x"3FCFD4", x"3FCBE6", x"3FC7D1", x"3FC395", x"3FBF31", x"3FBAA6", x"3FB5F4",
+         x"3FB11A", x"3FAC19", x"3FA6F1", x"3FA1A2", x"3F9C2B", x"3F968D", x"3F90C8", x"3F8ADB",
+         x"3F84C8", x"3F7E8D", x"3F782B", x"3F71A2", x"3F6AF2", x"3F641B", x"3F5D1C", x"3F55F7",
+         x"3F4EAA", x"3F4736", x"3F3F9C", x"3F37DA", x"3F2FF1", x"3F27E2", x"3F1FAB", x"3F174D",
+         x"3F0EC9", x"3F061E", x"3EFD4B", x"3EF452", x"3EEB32", x"3EE1EC", x"3ED87E", x"3ECEEA",
+         x"3EC52F", x"3EBB4D", x"3EB144", x"3EA715", x"3E9CBF", x"3E9243", x"3E87A0", x"3E7CD6",
+         x"3E71E6", x"3E66D0", x"3E5B93", x"3E502F", x"3E44A5", x"3E38F5", x"3E2D1E", x"3E2121",
+         x"3E14FD", x"3E08B3", x"3DFC43", x"3DEFAD", x"3DE2F0", x"3DD60E", x"3DC905", x"3DBBD6",
+         x"3DAE81", x"3DA106", x"3D9365", x"3D859E", x"3D77B1", x"3D699E", x"3D5B65", x"3D4D06",
+         x"3D3E82", x"3D2FD7", x"3D2107", x"3D1212", x"3D02F6", x"3CF3B5", x"3CE44F", x"3CD4C3",
+         x"3CC511", x"3CB53A", x"3CA53D", x"3C951B", x"3C84D4", x"3C7467", x"3C63D5", x"3C531E",
+         x"3C4241", x"3C313F", x"3C2019", x"3C0ECD", x"3BFD5C", x"3BEBC6", x"3BDA0B", x"3BC82B",
+         x"3BB626", x"3BA3FD", x"3B91AF", x"3B7F3C", x"3B6CA4", x"3B59E7", x"3B4706", x"3B3401",
+         x"3B20D7", x"3B0D88", x"3AFA15", x"3AE67E", x"3AD2C2", x"3ABEE2", x"3AAADE", x"3A96B5",
+         x"3A8269", x"3A6DF8", x"3A5963", x"3A44AB", x"3A2FCE", x"3A1ACD", x"3A05A9", x"39F061",
+         x"39DAF5", x"39C565", x"39AFB2", x"3999DB", x"3983E1", x"396DC3", x"395782", x"39411D",
+         x"392A95", x"3913EA", x"38FD1C", x"38E62A", x"38CF16", x"38B7DE", x"38A083", x"388906",
+         x"387165", x"3859A2", x"3841BC", x"3829B3", x"381187", x"37F939", x"37E0C9", x"37C836",
+         x"37AF80", x"3796A9", x"377DAF", x"376492", x"374B54", x"3731F3", x"371871", x"36FECC",
+         x"36E506", x"36CB1D", x"36B113", x"3696E7", x"367C9A", x"36622A", x"36479A", x"362CE7",
+         x"361214", x"35F71F", x"35DC09", x"35C0D1", x"35A578", x"3589FF", x"356E64", x"3552A8",
+         x"3536CB", x"351ACE", x"34FEB0", x"34E271", x"34C611", x"34A991", x"348CF1", x"347030",
+         x"34534E", x"34364D", x"34192B", x"33FBE9", x"33DE87", x"33C105", x"33A363", x"3385A1",
+         x"3367C0", x"3349BE", x"332B9E", x"330D5D", x"32EEFD", x"32D07E", x"32B1DF", x"329321",
+         x"327444", x"325547", x"32362C", x"3216F2", x"31F799", x"31D820", x"31B88A", x"3198D4",
+         x"317900", x"31590D", x"3138FC", x"3118CD", x"30F87F", x"30D813", x"30B789", x"3096E1",
+         x"30761B", x"305537", x"303436", x"301316", x"2FF1D9", x"2FD07E", x"2FAF06", x"2F8D70",
+         x"2F6BBE", x"2F49ED", x"2F2800", x"2F05F5", x"2EE3CE", x"2EC18A", x"2E9F28", x"2E7CAA",
+         x"2E5A10", x"2E3758", x"2E1485", x"2DF194", x"2DCE88", x"2DAB5F", x"2D881A", x"2D64B9",
+         x"2D413C", x"2D1DA3", x"2CF9EE", x"2CD61E", x"2CB232", x"2C8E2A", x"2C6A07", x"2C45C8",
+         x"2C216E", x"2BFCF9", x"2BD868", x"2BB3BD", x"2B8EF7", x"2B6A16", x"2B451A", x"2B2003",
+         x"2AFAD2", x"2AD586", x"2AB020", x"2A8A9F", x"2A6504", x"2A3F50", x"2A1981", x"29F398",
+         x"29CD95", x"29A778", x"298142", x"295AF2", x"293489", x"290E06", x"28E76A", x"28C0B4",
+         x"2899E6", x"2872FE", x"284BFE", x"2824E4", x"27FDB2", x"27D667", x"27AF04", x"278788",
+         x"275FF4", x"273847", x"271082", x"26E8A6", x"26C0B1", x"2698A4", x"267080", x"264843",
+         x"261FEF", x"25F784", x"25CF01", x"25A667", x"257DB6", x"2554ED", x"252C0E", x"250317",
+         x"24DA0A", x"24B0E6", x"2487AB", x"245E5A", x"2434F3", x"240B75", x"23E1E1", x"23B836",
+         x"238E76", x"2364A0", x"233AB4", x"2310B2", x"22E69A", x"22BC6D", x"22922B", x"2267D3",
+         x"223D66", x"2212E4", x"21E84D", x"21BDA1", x"2192E0", x"21680B", x"213D20", x"211222",
+         x"20E70F", x"20BBE7", x"2090AC", x"20655C", x"2039F9", x"200E81", x"1FE2F6", x"1FB757",
+         x"1F8BA4", x"1F5FDE", x"1F3405", x"1F0819", x"1EDC19", x"1EB006", x"1E83E0", x"1E57A8",
+         x"1E2B5D", x"1DFEFF", x"1DD28F", x"1DA60C", x"1D7977", x"1D4CD0", x"1D2016", x"1CF34B",
+         x"1CC66E", x"1C997F", x"1C6C7F", x"1C3F6D", x"1C1249", x"1BE515", x"1BB7CF", x"1B8A78",
+         x"1B5D10", x"1B2F97", x"1B020D", x"1AD473", x"1AA6C8", x"1A790C", x"1A4B41", x"1A1D65",
+         x"19EF79", x"19C17D", x"199371", x"196555", x"19372A", x"1908EF", x"18DAA5", x"18AC4B",
+         x"187DE2", x"184F6A", x"1820E3", x"17F24D", x"17C3A9", x"1794F6", x"176634", x"173763",
+         x"170885", x"16D998", x"16AA9D", x"167B94", x"164C7E", x"161D59", x"15EE27", x"15BEE7",
+         x"158F9A", x"156040", x"1530D8", x"150164", x"14D1E2", x"14A253", x"1472B8", x"144311",
+         x"14135C", x"13E39C", x"13B3CF", x"1383F6", x"135410", x"13241F", x"12F423", x"12C41A",
+         x"129406", x"1263E6", x"1233BB", x"120385", x"11D344", x"11A2F8", x"1172A1", x"11423F",
+         x"1111D2", x"10E15B", x"10B0DA", x"10804E", x"104FB8", x"101F18", x"0FEE6E", x"0FBDBA",
+         x"0F8CFC", x"0F5C35", x"0F2B65", x"0EFA8B", x"0EC9A8", x"0E98BB", x"0E67C6", x"0E36C8",
+         x"0E05C1", x"0DD4B1", x"0DA399", x"0D7279", x"0D4150", x"0D101F", x"0CDEE6", x"0CADA5",
+         x"0C7C5C", x"0C4B0B", x"0C19B3", x"0BE854", x"0BB6ED", x"0B857F", x"0B5409", x"0B228D",
+         x"0AF10A", x"0ABF80", x"0A8DF0", x"0A5C59", x"0A2ABB", x"09F918", x"09C76E", x"0995BE",
+         x"096408", x"09324D", x"09008B", x"08CEC4", x"089CF8", x"086B27", x"083950", x"080774",
+         x"07D593", x"07A3AE", x"0771C4", x"073FD5", x"070DE1", x"06DBEA", x"06A9EE", x"0677EE",
+         x"0645EA", x"0613E2", x"05E1D6", x"05AFC7", x"057DB4", x"054B9E", x"051984", x"04E768",
+         x"04B548", x"048326", x"045100", x"041ED8", x"03ECAE", x"03BA81", x"038852", x"035620",
+         x"0323ED", x"02F1B7", x"02BF80", x"028D47", x"025B0D", x"0228D1", x"01F693", x"01C455",
+         x"019215", x"015FD5", x"012D93", x"00FB51", x"00C90F", x"0096CB", x"006488", x"003244")
+    );
+
+    constant c_TRIANGLE_ROM : t_rom_array := (
+        -- octave 0
+        (x"C00001", x"C01876", x"C039CF", x"C0591D", x"C079A5", x"C09939", x"C0B9A0", x"C0D947",
+         x"C0F9A2", x"C11951", x"C139A5", x"C1595B", x"C179A9", x"C19964", x"C1B9AE", x"C1D96D",
+         x"C1F9B2", x"C21976", x"C239B6", x"C2597F", x"C279BA", x"C29988", x"C2B9BF", x"C2D991",
+         x"C2F9C3", x"C3199A", x"C339C7", x"C359A3", x"C379CB", x"C399AD", x"C3B9CF", x"C3D9B6",
+         x"C3F9D3", x"C419BF", x"C439D7", x"C459C8", x"C479DB", x"C499D1", x"C4B9DF", x"C4D9DA",
+         x"C4F9E4", x"C519E3", x"C539E8", x"C559EC", x"C579ED", x"C599F4", x"C5B9F2", x"C5D9FC",
+         x"C5F9F7", x"C61A04", x"C639FD", x"C65A0C", x"C67A02", x"C69A14", x"C6BA08", x"C6DA1B",
+         x"C6FA0E", x"C71A22", x"C73A14", x"C75A29", x"C77A1B", x"C79A30", x"C7BA21", x"C7DA36",
+         x"C7FA28", x"C81A3D", x"C83A2F", x"C85A43", x"C87A36", x"C89A49", x"C8BA3E", x"C8DA4F",
+         x"C8FA45", x"C91A55", x"C93A4D", x"C95A5A", x"C97A54", x"C99A60", x"C9BA5C", x"C9DA66",
+         x"C9FA63", x"CA1A6B", x"CA3A6B", x"CA5A71", x"CA7A73", x"CA9A77", x"CABA7A", x"CADA7C",
+         x"CAFA82", x"CB1A82", x"CB3A89", x"CB5A88", x"CB7A91", x"CB9A8E", x"CBBA98", x"CBDA94",
+         x"CBFA9F", x"CC1A9A", x"CC3AA6", x"CC5AA0", x"CC7AAD", x"CC9AA7", x"CCBAB4", x"CCDAAD",
+         x"CCFABB", x"CD1AB4", x"CD3AC2", x"CD5ABA", x"CD7AC8", x"CD9AC1", x"CDBACF", x"CDDAC8",
+         x"CDFAD5", x"CE1ACF", x"CE3ADB", x"CE5AD6", x"CE7AE1", x"CE9ADD", x"CEBAE7", x"CEDAE5",
+         x"CEFAED", x"CF1AEC", x"CF3AF3", x"CF5AF3", x"CF7AF9", x"CF9AFA", x"CFBAFF", x"CFDB02",
+         x"CFFB05", x"D01B09", x"D03B0B", x"D05B10", x"D07B11", x"D09B17", x"D0BB17", x"D0DB1F",
+         x"D0FB1E", x"D11B26", x"D13B24", x"D15B2D", x"D17B2A", x"D19B34", x"D1BB30", x"D1DB3B",
+         x"D1FB37", x"D21B42", x"D23B3D", x"D25B48", x"D27B44", x"D29B4F", x"D2BB4B", x"D2DB55",
+         x"D2FB51", x"D31B5C", x"D33B58", x"D35B62", x"D37B5F", x"D39B69", x"D3BB66", x"D3DB6F",
+         x"D3FB6D", x"D41B75", x"D43B74", x"D45B7B", x"D47B7B", x"D49B82", x"D4BB82", x"D4DB88",
+         x"D4FB89", x"D51B8E", x"D53B91", x"D55B94", x"D57B98", x"D59B9A", x"D5BB9F", x"D5DBA0",
+         x"D5FBA6", x"D61BA6", x"D63BAD", x"D65BAD", x"D67BB4", x"D69BB3", x"D6BBBB", x"D6DBB9",
+         x"D6FBC2", x"D71BC0", x"D73BC9", x"D75BC6", x"D77BCF", x"D79BCD", x"D7BBD6", x"D7DBD3",
+         x"D7FBDD", x"D81BDA", x"D83BE3", x"D85BE1", x"D87BEA", x"D89BE8", x"D8BBF0", x"D8DBEE",
+         x"D8FBF7", x"D91BF5", x"D93BFD", x"D95BFC", x"D97C03", x"D99C03", x"D9BC0A", x"D9DC0A",
+         x"D9FC10", x"DA1C11", x"DA3C16", x"DA5C18", x"DA7C1C", x"DA9C1F", x"DABC23", x"DADC26",
+         x"DAFC29", x"DB1C2D", x"DB3C2F", x"DB5C35", x"DB7C35", x"DB9C3B", x"DBBC3C", x"DBDC42",
+         x"DBFC42", x"DC1C49", x"DC3C48", x"DC5C50", x"DC7C4F", x"DC9C57", x"DCBC55", x"DCDC5E",
+         x"DCFC5C", x"DD1C64", x"DD3C63", x"DD5C6B", x"DD7C69", x"DD9C72", x"DDBC70", x"DDDC78",
+         x"DDFC77", x"DE1C7F", x"DE3C7E", x"DE5C85", x"DE7C84", x"DE9C8B", x"DEBC8B", x"DEDC92",
+         x"DEFC92", x"DF1C98", x"DF3C99", x"DF5C9E", x"DF7CA0", x"DF9CA5", x"DFBCA7", x"DFDCAB",
+         x"DFFCAE", x"E01CB1", x"E03CB5", x"E05CB8", x"E07CBC", x"E09CBE", x"E0BCC3", x"E0DCC4",
+         x"E0FCCA", x"E11CCB", x"E13CD1", x"E15CD1", x"E17CD8", x"E19CD7", x"E1BCDF", x"E1DCDE",
+         x"E1FCE5", x"E21CE4", x"E23CEC", x"E25CEB", x"E27CF3", x"E29CF2", x"E2BCF9", x"E2DCF8",
+         x"E2FD00", x"E31CFF", x"E33D07", x"E35D06", x"E37D0D", x"E39D0D", x"E3BD14", x"E3DD13",
+         x"E3FD1A", x"E41D1A", x"E43D20", x"E45D21", x"E47D27", x"E49D28", x"E4BD2D", x"E4DD2F",
+         x"E4FD33", x"E51D36", x"E53D3A", x"E55D3D", x"E57D40", x"E59D44", x"E5BD46", x"E5DD4B",
+         x"E5FD4D", x"E61D52", x"E63D53", x"E65D59", x"E67D59", x"E69D60", x"E6BD60", x"E6DD66",
+         x"E6FD66", x"E71D6D", x"E73D6D", x"E75D74", x"E77D73", x"E79D7B", x"E7BD7A", x"E7DD81",
+         x"E7FD81", x"E81D88", x"E83D87", x"E85D8F", x"E87D8E", x"E89D95", x"E8BD95", x"E8DD9C",
+         x"E8FD9C", x"E91DA2", x"E93DA2", x"E95DA9", x"E97DA9", x"E99DAF", x"E9BDB0", x"E9DDB5",
+         x"E9FDB7", x"EA1DBC", x"EA3DBE", x"EA5DC2", x"EA7DC5", x"EA9DC8", x"EABDCC", x"EADDCF",
+         x"EAFDD3", x"EB1DD5", x"EB3DDA", x"EB5DDB", x"EB7DE1", x"EB9DE2", x"EBBDE7", x"EBDDE8",
+         x"EBFDEE", x"EC1DEF", x"EC3DF5", x"EC5DF5", x"EC7DFC", x"EC9DFC", x"ECBE03", x"ECDE02",
+         x"ECFE09", x"ED1E09", x"ED3E10", x"ED5E10", x"ED7E17", x"ED9E16", x"EDBE1D", x"EDDE1D",
+         x"EDFE24", x"EE1E24", x"EE3E2A", x"EE5E2A", x"EE7E31", x"EE9E31", x"EEBE37", x"EEDE38",
+         x"EEFE3E", x"EF1E3F", x"EF3E44", x"EF5E46", x"EF7E4A", x"EF9E4D", x"EFBE51", x"EFDE54",
+         x"EFFE57", x"F01E5B", x"F03E5D", x"F05E61", x"F07E64", x"F09E68", x"F0BE6A", x"F0DE6F",
+         x"F0FE71", x"F11E76", x"F13E77", x"F15E7D", x"F17E7E", x"F19E84", x"F1BE84", x"F1DE8B",
+         x"F1FE8B", x"F21E91", x"F23E91", x"F25E98", x"F27E98", x"F29E9F", x"F2BE9E", x"F2DEA5",
+         x"F2FEA5", x"F31EAC", x"F33EAC", x"F35EB2", x"F37EB2", x"F39EB9", x"F3BEB9", x"F3DEBF",
+         x"F3FEC0", x"F41EC6", x"F43EC7", x"F45ECC", x"F47ECE", x"F49ED3", x"F4BED5", x"F4DED9",
+         x"F4FEDC", x"F51EDF", x"F53EE2", x"F55EE6", x"F57EE9", x"F59EEC", x"F5BEF0", x"F5DEF3",
+         x"F5FEF7", x"F61EF9", x"F63EFE", x"F65EFF", x"F67F05", x"F69F06", x"F6BF0C", x"F6DF0C",
+         x"F6FF12", x"F71F13", x"F73F19", x"F75F19", x"F77F20", x"F79F20", x"F7BF27", x"F7DF27",
+         x"F7FF2D", x"F81F2D", x"F83F34", x"F85F34", x"F87F3A", x"F89F3B", x"F8BF41", x"F8DF41",
+         x"F8FF48", x"F91F48", x"F93F4E", x"F95F4F", x"F97F54", x"F99F56", x"F9BF5B", x"F9DF5D",
+         x"F9FF61", x"FA1F63", x"FA3F68", x"FA5F6A", x"FA7F6E", x"FA9F71", x"FABF74", x"FADF78",
+         x"FAFF7B", x"FB1F7F", x"FB3F81", x"FB5F86", x"FB7F88", x"FB9F8D", x"FBBF8E", x"FBDF94",
+         x"FBFF95", x"FC1F9A", x"FC3F9B", x"FC5FA1", x"FC7FA2", x"FC9FA8", x"FCBFA8", x"FCDFAF",
+         x"FCFFAF", x"FD1FB5", x"FD3FB5", x"FD5FBC", x"FD7FBC", x"FD9FC3", x"FDBFC3", x"FDDFC9",
+         x"FDFFC9", x"FE1FD0", x"FE3FD0", x"FE5FD6", x"FE7FD7", x"FE9FDD", x"FEBFDE", x"FEDFE3",
+         x"FEFFE4", x"FF1FEA", x"FF3FEB", x"FF5FF0", x"FF7FF2", x"FF9FF6", x"FFBFF9", x"FFDFFD",
+         x"000000", x"002003", x"004007", x"00600A", x"00800E", x"00A010", x"00C015", x"00E016",
+         x"01001C", x"01201D", x"014022", x"016023", x"018029", x"01A02A", x"01C030", x"01E030",
+         x"020037", x"022037", x"02403D", x"02603D", x"028044", x"02A044", x"02C04B", x"02E04B",
+         x"030051", x"032051", x"034058", x"036058", x"03805E", x"03A05F", x"03C065", x"03E066",
+         x"04006B", x"04206C", x"044072", x"046073", x"048078", x"04A07A", x"04C07F", x"04E081",
+         x"050085", x"052088", x"05408C", x"05608F", x"058092", x"05A096", x"05C098", x"05E09D",
+         x"06009F", x"0620A3", x"0640A5", x"0660AA", x"0680AC", x"06A0B1", x"06C0B2", x"06E0B8",
+         x"0700B8", x"0720BF", x"0740BF", x"0760C5", x"0780C6", x"07A0CC", x"07C0CC", x"07E0D3",
+         x"0800D3", x"0820D9", x"0840D9", x"0860E0", x"0880E0", x"08A0E7", x"08C0E7", x"08E0ED",
+         x"0900EE", x"0920F4", x"0940F4", x"0960FA", x"0980FB", x"09A101", x"09C102", x"09E107",
+         x"0A0109", x"0A210D", x"0A4110", x"0A6114", x"0A8117", x"0AA11A", x"0AC11E", x"0AE121",
+         x"0B0124", x"0B2127", x"0B412B", x"0B612D", x"0B8132", x"0BA134", x"0BC139", x"0BE13A",
+         x"0C0140", x"0C2141", x"0C4147", x"0C6147", x"0C814E", x"0CA14E", x"0CC154", x"0CE154",
+         x"0D015B", x"0D215B", x"0D4162", x"0D6161", x"0D8168", x"0DA168", x"0DC16F", x"0DE16F",
+         x"0E0175", x"0E2175", x"0E417C", x"0E617C", x"0E8182", x"0EA183", x"0EC189", x"0EE18A",
+         x"0F018F", x"0F2191", x"0F4196", x"0F6198", x"0F819C", x"0FA19F", x"0FC1A3", x"0FE1A5",
+         x"1001A9", x"1021AC", x"1041AF", x"1061B3", x"1081B6", x"10A1BA", x"10C1BC", x"10E1C1",
+         x"1101C2", x"1121C8", x"1141C9", x"1161CF", x"1181CF", x"11A1D6", x"11C1D6", x"11E1DC",
+         x"1201DC", x"1221E3", x"1241E3", x"1261EA", x"1281E9", x"12A1F0", x"12C1F0", x"12E1F7",
+         x"1301F7", x"1321FE", x"1341FD", x"136204", x"138204", x"13A20B", x"13C20B", x"13E211",
+         x"140212", x"142218", x"144219", x"14621E", x"14821F", x"14A225", x"14C226", x"14E22B",
+         x"15022D", x"152231", x"154234", x"156238", x"15823B", x"15A23E", x"15C242", x"15E244",
+         x"160249", x"16224B", x"164250", x"166251", x"168257", x"16A257", x"16C25E", x"16E25E",
+         x"170264", x"172264", x"17426B", x"17626B", x"178272", x"17A271", x"17C279", x"17E278",
+         x"18027F", x"18227F", x"184286", x"186285", x"18828D", x"18A28C", x"18C293", x"18E293",
+         x"19029A", x"19229A", x"1942A0", x"1962A0", x"1982A7", x"19A2A7", x"19C2AD", x"19E2AE",
+         x"1A02B3", x"1A22B5", x"1A42BA", x"1A62BC", x"1A82C0", x"1AA2C3", x"1AC2C6", x"1AE2CA",
+         x"1B02CD", x"1B22D1", x"1B42D3", x"1B62D8", x"1B82D9", x"1BA2DF", x"1BC2E0", x"1BE2E6",
+         x"1C02E6", x"1C22ED", x"1C42EC", x"1C62F3", x"1C82F3", x"1CA2FA", x"1CC2F9", x"1CE301",
+         x"1D0300", x"1D2308", x"1D4307", x"1D630E", x"1D830D", x"1DA315", x"1DC314", x"1DE31C",
+         x"1E031B", x"1E2322", x"1E4321", x"1E6329", x"1E8328", x"1EA32F", x"1EC32F", x"1EE335",
+         x"1F0336", x"1F233C", x"1F433D", x"1F6342", x"1F8344", x"1FA348", x"1FC34B", x"1FE34F",
+         x"200352", x"202355", x"204359", x"20635B", x"208360", x"20A362", x"20C367", x"20E368",
+         x"21036E", x"21236E", x"214375", x"216375", x"21837C", x"21A37B", x"21C382", x"21E381",
+         x"220389", x"222388", x"224390", x"22638E", x"228397", x"22A395", x"22C39D", x"22E39C",
+         x"2303A4", x"2323A2", x"2343AB", x"2363A9", x"2383B1", x"23A3B0", x"23C3B8", x"23E3B7",
+         x"2403BE", x"2423BE", x"2443C4", x"2463C5", x"2483CB", x"24A3CB", x"24C3D1", x"24E3D3",
+         x"2503D7", x"2523DA", x"2543DD", x"2563E1", x"2583E4", x"25A3E8", x"25C3EA", x"25E3EF",
+         x"2603F0", x"2623F6", x"2643F6", x"2663FD", x"2683FD", x"26A404", x"26C403", x"26E40B",
+         x"270409", x"272412", x"274410", x"276418", x"278416", x"27A41F", x"27C41D", x"27E426",
+         x"280423", x"28242D", x"28442A", x"286433", x"288431", x"28A43A", x"28C437", x"28E440",
+         x"29043E", x"292447", x"294445", x"29644D", x"29844C", x"29A453", x"29C453", x"29E45A",
+         x"2A045A", x"2A2460", x"2A4461", x"2A6466", x"2A8468", x"2AA46C", x"2AC46F", x"2AE472",
+         x"2B0477", x"2B2478", x"2B447E", x"2B647E", x"2B8485", x"2BA485", x"2BC48C", x"2BE48B",
+         x"2C0493", x"2C2491", x"2C449A", x"2C6497", x"2C84A1", x"2CA49E", x"2CC4A8", x"2CE4A4",
+         x"2D04AF", x"2D24AB", x"2D44B5", x"2D64B1", x"2D84BC", x"2DA4B8", x"2DC4C3", x"2DE4BE",
+         x"2E04C9", x"2E24C5", x"2E44D0", x"2E64CC", x"2E84D6", x"2EA4D3", x"2EC4DC", x"2EE4DA",
+         x"2F04E2", x"2F24E1", x"2F44E9", x"2F64E9", x"2F84EF", x"2FA4F0", x"2FC4F5", x"2FE4F7",
+         x"3004FB", x"3024FE", x"304501", x"306506", x"308507", x"30A50D", x"30C50D", x"30E514",
+         x"310513", x"31251B", x"314519", x"316523", x"31851F", x"31A52A", x"31C525", x"31E531",
+         x"32052B", x"322538", x"324531", x"32653F", x"328538", x"32A546", x"32C53E", x"32E54C",
+         x"330545", x"332553", x"33454C", x"336559", x"338553", x"33A560", x"33C55A", x"33E566",
+         x"340561", x"34256C", x"344568", x"346572", x"34856F", x"34A578", x"34C577", x"34E57E",
+         x"35057E", x"352584", x"354586", x"356589", x"35858D", x"35A58F", x"35C595", x"35E595",
+         x"36059D", x"36259A", x"3645A4", x"3665A0", x"3685AC", x"36A5A6", x"36C5B3", x"36E5AB",
+         x"3705BB", x"3725B1", x"3745C2", x"3765B7", x"3785CA", x"37A5BD", x"37C5D1", x"37E5C3",
+         x"3805D8", x"3825CA", x"3845DF", x"3865D0", x"3885E5", x"38A5D7", x"38C5EC", x"38E5DE",
+         x"3905F2", x"3925E5", x"3945F8", x"3965EC", x"3985FE", x"39A5F4", x"39C603", x"39E5FC",
+         x"3A0609", x"3A2604", x"3A460E", x"3A660C", x"3A8613", x"3AA614", x"3AC618", x"3AE61D",
+         x"3B061C", x"3B2626", x"3B4621", x"3B662F", x"3B8625", x"3BA638", x"3BC629", x"3BE641",
+         x"3C062D", x"3C264A", x"3C4631", x"3C6653", x"3C8635", x"3CA65D", x"3CC639", x"3CE666",
+         x"3D063D", x"3D266F", x"3D4641", x"3D6678", x"3D8646", x"3DA681", x"3DC64A", x"3DE68A",
+         x"3E064E", x"3E2693", x"3E4652", x"3E669C", x"3E8657", x"3EA6A5", x"3EC65B", x"3EE6AF",
+         x"3F065E", x"3F26B9", x"3F4660", x"3F66C7", x"3F865B", x"3FA6E3", x"3FC631", x"3FE78A",
+         x"3FFFFF", x"3FE78A", x"3FC631", x"3FA6E3", x"3F865B", x"3F66C7", x"3F4660", x"3F26B9",
+         x"3F065E", x"3EE6AF", x"3EC65B", x"3EA6A5", x"3E8657", x"3E669C", x"3E4652", x"3E2693",
+         x"3E064E", x"3DE68A", x"3DC64A", x"3DA681", x"3D8646", x"3D6678", x"3D4641", x"3D266F",
+         x"3D063D", x"3CE666", x"3CC639", x"3CA65D", x"3C8635", x"3C6653", x"3C4631", x"3C264A",
+         x"3C062D", x"3BE641", x"3BC629", x"3BA638", x"3B8625", x"3B662F", x"3B4621", x"3B2626",
+         x"3B061C", x"3AE61D", x"3AC618", x"3AA614", x"3A8613", x"3A660C", x"3A460E", x"3A2604",
+         x"3A0609", x"39E5FC", x"39C603", x"39A5F4", x"3985FE", x"3965EC", x"3945F8", x"3925E5",
+         x"3905F2", x"38E5DE", x"38C5EC", x"38A5D7", x"3885E5", x"3865D0", x"3845DF", x"3825CA",
+         x"3805D8", x"37E5C3", x"37C5D1", x"37A5BD", x"3785CA", x"3765B7", x"3745C2", x"3725B1",
+         x"3705BB", x"36E5AB", x"36C5B3", x"36A5A6", x"3685AC", x"3665A0", x"3645A4", x"36259A",
+         x"36059D", x"35E595", x"35C595", x"35A58F", x"35858D", x"356589", x"354586", x"352584",
+         x"35057E", x"34E57E", x"34C577", x"34A578", x"34856F", x"346572", x"344568", x"34256C",
+         x"340561", x"33E566", x"33C55A", x"33A560", x"338553", x"336559", x"33454C", x"332553",
+         x"330545", x"32E54C", x"32C53E", x"32A546", x"328538", x"32653F", x"324531", x"322538",
+         x"32052B", x"31E531", x"31C525", x"31A52A", x"31851F", x"316523", x"314519", x"31251B",
+         x"310513", x"30E514", x"30C50D", x"30A50D", x"308507", x"306506", x"304501", x"3024FE",
+         x"3004FB", x"2FE4F7", x"2FC4F5", x"2FA4F0", x"2F84EF", x"2F64E9", x"2F44E9", x"2F24E1",
+         x"2F04E2", x"2EE4DA", x"2EC4DC", x"2EA4D3", x"2E84D6", x"2E64CC", x"2E44D0", x"2E24C5",
+         x"2E04C9", x"2DE4BE", x"2DC4C3", x"2DA4B8", x"2D84BC", x"2D64B1", x"2D44B5", x"2D24AB",
+         x"2D04AF", x"2CE4A4", x"2CC4A8", x"2CA49E", x"2C84A1", x"2C6497", x"2C449A", x"2C2491",
+         x"2C0493", x"2BE48B", x"2BC48C", x"2BA485", x"2B8485", x"2B647E", x"2B447E", x"2B2478",
+         x"2B0477", x"2AE472", x"2AC46F", x"2AA46C", x"2A8468", x"2A6466", x"2A4461", x"2A2460",
+         x"2A045A", x"29E45A", x"29C453", x"29A453", x"29844C", x"29644D", x"294445", x"292447",
+         x"29043E", x"28E440", x"28C437", x"28A43A", x"288431", x"286433", x"28442A", x"28242D",
+         x"280423", x"27E426", x"27C41D", x"27A41F", x"278416", x"276418", x"274410", x"272412",
+         x"270409", x"26E40B", x"26C403", x"26A404", x"2683FD", x"2663FD", x"2643F6", x"2623F6",
+         x"2603F0", x"25E3EF", x"25C3EA", x"25A3E8", x"2583E4", x"2563E1", x"2543DD", x"2523DA",
+         x"2503D7", x"24E3D3", x"24C3D1", x"24A3CB", x"2483CB", x"2463C5", x"2443C4", x"2423BE",
+         x"2403BE", x"23E3B7", x"23C3B8", x"23A3B0", x"2383B1", x"2363A9", x"2343AB", x"2323A2",
+         x"2303A4", x"22E39C", x"22C39D", x"22A395", x"228397", x"22638E", x"224390", x"222388",
+         x"220389", x"21E381", x"21C382", x"21A37B", x"21837C", x"216375", x"214375", x"21236E",
+         x"21036E", x"20E368", x"20C367", x"20A362", x"208360", x"20635B", x"204359", x"202355",
+         x"200352", x"1FE34F", x"1FC34B", x"1FA348", x"1F8344", x"1F6342", x"1F433D", x"1F233C",
+         x"1F0336", x"1EE335", x"1EC32F", x"1EA32F", x"1E8328", x"1E6329", x"1E4321", x"1E2322",
+         x"1E031B", x"1DE31C", x"1DC314", x"1DA315", x"1D830D", x"1D630E", x"1D4307", x"1D2308",
+         x"1D0300", x"1CE301", x"1CC2F9", x"1CA2FA", x"1C82F3", x"1C62F3", x"1C42EC", x"1C22ED",
+         x"1C02E6", x"1BE2E6", x"1BC2E0", x"1BA2DF", x"1B82D9", x"1B62D8", x"1B42D3", x"1B22D1",
+         x"1B02CD", x"1AE2CA", x"1AC2C6", x"1AA2C3", x"1A82C0", x"1A62BC", x"1A42BA", x"1A22B5",
+         x"1A02B3", x"19E2AE", x"19C2AD", x"19A2A7", x"1982A7", x"1962A0", x"1942A0", x"19229A",
+         x"19029A", x"18E293", x"18C293", x"18A28C", x"18828D", x"186285", x"184286", x"18227F",
+         x"18027F", x"17E278", x"17C279", x"17A271", x"178272", x"17626B", x"17426B", x"172264",
+         x"170264", x"16E25E", x"16C25E", x"16A257", x"168257", x"166251", x"164250", x"16224B",
+         x"160249", x"15E244", x"15C242", x"15A23E", x"15823B", x"156238", x"154234", x"152231",
+         x"15022D", x"14E22B", x"14C226", x"14A225", x"14821F", x"14621E", x"144219", x"142218",
+         x"140212", x"13E211", x"13C20B", x"13A20B", x"138204", x"136204", x"1341FD", x"1321FE",
+         x"1301F7", x"12E1F7", x"12C1F0", x"12A1F0", x"1281E9", x"1261EA", x"1241E3", x"1221E3",
+         x"1201DC", x"11E1DC", x"11C1D6", x"11A1D6", x"1181CF", x"1161CF", x"1141C9", x"1121C8",
+         x"1101C2", x"10E1C1", x"10C1BC", x"10A1BA", x"1081B6", x"1061B3", x"1041AF", x"1021AC",
+         x"1001A9", x"0FE1A5", x"0FC1A3", x"0FA19F", x"0F819C", x"0F6198", x"0F4196", x"0F2191",
+         x"0F018F", x"0EE18A", x"0EC189", x"0EA183", x"0E8182", x"0E617C", x"0E417C", x"0E2175",
+         x"0E0175", x"0DE16F", x"0DC16F", x"0DA168", x"0D8168", x"0D6161", x"0D4162", x"0D215B",
+         x"0D015B", x"0CE154", x"0CC154", x"0CA14E", x"0C814E", x"0C6147", x"0C4147", x"0C2141",
+         x"0C0140", x"0BE13A", x"0BC139", x"0BA134", x"0B8132", x"0B612D", x"0B412B", x"0B2127",
+         x"0B0124", x"0AE121", x"0AC11E", x"0AA11A", x"0A8117", x"0A6114", x"0A4110", x"0A210D",
+         x"0A0109", x"09E107", x"09C102", x"09A101", x"0980FB", x"0960FA", x"0940F4", x"0920F4",
+         x"0900EE", x"08E0ED", x"08C0E7", x"08A0E7", x"0880E0", x"0860E0", x"0840D9", x"0820D9",
+         x"0800D3", x"07E0D3", x"07C0CC", x"07A0CC", x"0780C6", x"0760C5", x"0740BF", x"0720BF",
+         x"0700B8", x"06E0B8", x"06C0B2", x"06A0B1", x"0680AC", x"0660AA", x"0640A5", x"0620A3",
+         x"06009F", x"05E09D", x"05C098", x"05A096", x"058092", x"05608F", x"05408C", x"052088",
+         x"050085", x"04E081", x"04C07F", x"04A07A", x"048078", x"046073", x"044072", x"04206C",
+         x"04006B", x"03E066", x"03C065", x"03A05F", x"03805E", x"036058", x"034058", x"032051",
+         x"030051", x"02E04B", x"02C04B", x"02A044", x"028044", x"02603D", x"02403D", x"022037",
+         x"020037", x"01E030", x"01C030", x"01A02A", x"018029", x"016023", x"014022", x"01201D",
+         x"01001C", x"00E016", x"00C015", x"00A010", x"00800E", x"00600A", x"004007", x"002003",
+         x"000000", x"FFDFFD", x"FFBFF9", x"FF9FF6", x"FF7FF2", x"FF5FF0", x"FF3FEB", x"FF1FEA",
+         x"FEFFE4", x"FEDFE3", x"FEBFDE", x"FE9FDD", x"FE7FD7", x"FE5FD6", x"FE3FD0", x"FE1FD0",
+         x"FDFFC9", x"FDDFC9", x"FDBFC3", x"FD9FC3", x"FD7FBC", x"FD5FBC", x"FD3FB5", x"FD1FB5",
+         x"FCFFAF", x"FCDFAF", x"FCBFA8", x"FC9FA8", x"FC7FA2", x"FC5FA1", x"FC3F9B", x"FC1F9A",
+         x"FBFF95", x"FBDF94", x"FBBF8E", x"FB9F8D", x"FB7F88", x"FB5F86", x"FB3F81", x"FB1F7F",
+         x"FAFF7B", x"FADF78", x"FABF74", x"FA9F71", x"FA7F6E", x"FA5F6A", x"FA3F68", x"FA1F63",
+         x"F9FF61", x"F9DF5D", x"F9BF5B", x"F99F56", x"F97F54", x"F95F4F", x"F93F4E", x"F91F48",
+         x"F8FF48", x"F8DF41", x"F8BF41", x"F89F3B", x"F87F3A", x"F85F34", x"F83F34", x"F81F2D",
+         x"F7FF2D", x"F7DF27", x"F7BF27", x"F79F20", x"F77F20", x"F75F19", x"F73F19", x"F71F13",
+         x"F6FF12", x"F6DF0C", x"F6BF0C", x"F69F06", x"F67F05", x"F65EFF", x"F63EFE", x"F61EF9",
+         x"F5FEF7", x"F5DEF3", x"F5BEF0", x"F59EEC", x"F57EE9", x"F55EE6", x"F53EE2", x"F51EDF",
+         x"F4FEDC", x"F4DED9", x"F4BED5", x"F49ED3", x"F47ECE", x"F45ECC", x"F43EC7", x"F41EC6",
+         x"F3FEC0", x"F3DEBF", x"F3BEB9", x"F39EB9", x"F37EB2", x"F35EB2", x"F33EAC", x"F31EAC",
+         x"F2FEA5", x"F2DEA5", x"F2BE9E", x"F29E9F", x"F27E98", x"F25E98", x"F23E91", x"F21E91",
+         x"F1FE8B", x"F1DE8B", x"F1BE84", x"F19E84", x"F17E7E", x"F15E7D", x"F13E77", x"F11E76",
+         x"F0FE71", x"F0DE6F", x"F0BE6A", x"F09E68", x"F07E64", x"F05E61", x"F03E5D", x"F01E5B",
+         x"EFFE57", x"EFDE54", x"EFBE51", x"EF9E4D", x"EF7E4A", x"EF5E46", x"EF3E44", x"EF1E3F",
+         x"EEFE3E", x"EEDE38", x"EEBE37", x"EE9E31", x"EE7E31", x"EE5E2A", x"EE3E2A", x"EE1E24",
+         x"EDFE24", x"EDDE1D", x"EDBE1D", x"ED9E16", x"ED7E17", x"ED5E10", x"ED3E10", x"ED1E09",
+         x"ECFE09", x"ECDE02", x"ECBE03", x"EC9DFC", x"EC7DFC", x"EC5DF5", x"EC3DF5", x"EC1DEF",
+         x"EBFDEE", x"EBDDE8", x"EBBDE7", x"EB9DE2", x"EB7DE1", x"EB5DDB", x"EB3DDA", x"EB1DD5",
+         x"EAFDD3", x"EADDCF", x"EABDCC", x"EA9DC8", x"EA7DC5", x"EA5DC2", x"EA3DBE", x"EA1DBC",
+         x"E9FDB7", x"E9DDB5", x"E9BDB0", x"E99DAF", x"E97DA9", x"E95DA9", x"E93DA2", x"E91DA2",
+         x"E8FD9C", x"E8DD9C", x"E8BD95", x"E89D95", x"E87D8E", x"E85D8F", x"E83D87", x"E81D88",
+         x"E7FD81", x"E7DD81", x"E7BD7A", x"E79D7B", x"E77D73", x"E75D74", x"E73D6D", x"E71D6D",
+         x"E6FD66", x"E6DD66", x"E6BD60", x"E69D60", x"E67D59", x"E65D59", x"E63D53", x"E61D52",
+         x"E5FD4D", x"E5DD4B", x"E5BD46", x"E59D44", x"E57D40", x"E55D3D", x"E53D3A", x"E51D36",
+         x"E4FD33", x"E4DD2F", x"E4BD2D", x"E49D28", x"E47D27", x"E45D21", x"E43D20", x"E41D1A",
+         x"E3FD1A", x"E3DD13", x"E3BD14", x"E39D0D", x"E37D0D", x"E35D06", x"E33D07", x"E31CFF",
+         x"E2FD00", x"E2DCF8", x"E2BCF9", x"E29CF2", x"E27CF3", x"E25CEB", x"E23CEC", x"E21CE4",
+         x"E1FCE5", x"E1DCDE", x"E1BCDF", x"E19CD7", x"E17CD8", x"E15CD1", x"E13CD1", x"E11CCB",
+         x"E0FCCA", x"E0DCC4", x"E0BCC3", x"E09CBE", x"E07CBC", x"E05CB8", x"E03CB5", x"E01CB1",
+         x"DFFCAE", x"DFDCAB", x"DFBCA7", x"DF9CA5", x"DF7CA0", x"DF5C9E", x"DF3C99", x"DF1C98",
+         x"DEFC92", x"DEDC92", x"DEBC8B", x"DE9C8B", x"DE7C84", x"DE5C85", x"DE3C7E", x"DE1C7F",
+         x"DDFC77", x"DDDC78", x"DDBC70", x"DD9C72", x"DD7C69", x"DD5C6B", x"DD3C63", x"DD1C64",
+         x"DCFC5C", x"DCDC5E", x"DCBC55", x"DC9C57", x"DC7C4F", x"DC5C50", x"DC3C48", x"DC1C49",
+         x"DBFC42", x"DBDC42", x"DBBC3C", x"DB9C3B", x"DB7C35", x"DB5C35", x"DB3C2F", x"DB1C2D",
+         x"DAFC29", x"DADC26", x"DABC23", x"DA9C1F", x"DA7C1C", x"DA5C18", x"DA3C16", x"DA1C11",
+         x"D9FC10", x"D9DC0A", x"D9BC0A", x"D99C03", x"D97C03", x"D95BFC", x"D93BFD", x"D91BF5",
+         x"D8FBF7", x"D8DBEE", x"D8BBF0", x"D89BE8", x"D87BEA", x"D85BE1", x"D83BE3", x"D81BDA",
+         x"D7FBDD", x"D7DBD3", x"D7BBD6", x"D79BCD", x"D77BCF", x"D75BC6", x"D73BC9", x"D71BC0",
+         x"D6FBC2", x"D6DBB9", x"D6BBBB", x"D69BB3", x"D67BB4", x"D65BAD", x"D63BAD", x"D61BA6",
+         x"D5FBA6", x"D5DBA0", x"D5BB9F", x"D59B9A", x"D57B98", x"D55B94", x"D53B91", x"D51B8E",
+         x"D4FB89", x"D4DB88", x"D4BB82", x"D49B82", x"D47B7B", x"D45B7B", x"D43B74", x"D41B75",
+         x"D3FB6D", x"D3DB6F", x"D3BB66", x"D39B69", x"D37B5F", x"D35B62", x"D33B58", x"D31B5C",
+         x"D2FB51", x"D2DB55", x"D2BB4B", x"D29B4F", x"D27B44", x"D25B48", x"D23B3D", x"D21B42",
+         x"D1FB37", x"D1DB3B", x"D1BB30", x"D19B34", x"D17B2A", x"D15B2D", x"D13B24", x"D11B26",
+         x"D0FB1E", x"D0DB1F", x"D0BB17", x"D09B17", x"D07B11", x"D05B10", x"D03B0B", x"D01B09",
+         x"CFFB05", x"CFDB02", x"CFBAFF", x"CF9AFA", x"CF7AF9", x"CF5AF3", x"CF3AF3", x"CF1AEC",
+         x"CEFAED", x"CEDAE5", x"CEBAE7", x"CE9ADD", x"CE7AE1", x"CE5AD6", x"CE3ADB", x"CE1ACF",
+         x"CDFAD5", x"CDDAC8", x"CDBACF", x"CD9AC1", x"CD7AC8", x"CD5ABA", x"CD3AC2", x"CD1AB4",
+         x"CCFABB", x"CCDAAD", x"CCBAB4", x"CC9AA7", x"CC7AAD", x"CC5AA0", x"CC3AA6", x"CC1A9A",
+         x"CBFA9F", x"CBDA94", x"CBBA98", x"CB9A8E", x"CB7A91", x"CB5A88", x"CB3A89", x"CB1A82",
+         x"CAFA82", x"CADA7C", x"CABA7A", x"CA9A77", x"CA7A73", x"CA5A71", x"CA3A6B", x"CA1A6B",
+         x"C9FA63", x"C9DA66", x"C9BA5C", x"C99A60", x"C97A54", x"C95A5A", x"C93A4D", x"C91A55",
+         x"C8FA45", x"C8DA4F", x"C8BA3E", x"C89A49", x"C87A36", x"C85A43", x"C83A2F", x"C81A3D",
+         x"C7FA28", x"C7DA36", x"C7BA21", x"C79A30", x"C77A1B", x"C75A29", x"C73A14", x"C71A22",
+         x"C6FA0E", x"C6DA1B", x"C6BA08", x"C69A14", x"C67A02", x"C65A0C", x"C639FD", x"C61A04",
+         x"C5F9F7", x"C5D9FC", x"C5B9F2", x"C599F4", x"C579ED", x"C559EC", x"C539E8", x"C519E3",
+         x"C4F9E4", x"C4D9DA", x"C4B9DF", x"C499D1", x"C479DB", x"C459C8", x"C439D7", x"C419BF",
+         x"C3F9D3", x"C3D9B6", x"C3B9CF", x"C399AD", x"C379CB", x"C359A3", x"C339C7", x"C3199A",
+         x"C2F9C3", x"C2D991", x"C2B9BF", x"C29988", x"C279BA", x"C2597F", x"C239B6", x"C21976",
+         x"C1F9B2", x"C1D96D", x"C1B9AE", x"C19964", x"C179A9", x"C1595B", x"C139A5", x"C11951",
+         x"C0F9A2", x"C0D947", x"C0B9A0", x"C09939", x"C079A5", x"C0591D", x"C039CF", x"C01876"),
+        -- octave 1
+        (x"C00001", x"C00EAB", x"C030F0", x"C05512", x"C073A8", x"C09158", x"C0B24C", x"C0D3FC",
+         x"C0F362", x"C1121B", x"C13291", x"C153AC", x"C17365", x"C1927F", x"C1B2BA", x"C1D390",
+         x"C1F376", x"C212C4", x"C232DC", x"C25388", x"C2738B", x"C292FB", x"C2B2FC", x"C2D38B",
+         x"C2F3A0", x"C3132B", x"C3331B", x"C35393", x"C373B6", x"C39355", x"C3B33A", x"C3D39F",
+         x"C3F3CC", x"C4137D", x"C4335A", x"C453AE", x"C473E2", x"C493A2", x"C4B379", x"C4D3BF",
+         x"C4F3F8", x"C513C5", x"C53399", x"C553D2", x"C5740D", x"C593E7", x"C5B3B8", x"C5D3E6",
+         x"C5F423", x"C61408", x"C633D8", x"C653FB", x"C67438", x"C69427", x"C6B3F8", x"C6D411",
+         x"C6F44D", x"C71446", x"C73418", x"C75428", x"C77462", x"C79463", x"C7B438", x"C7D440",
+         x"C7F478", x"C81480", x"C83457", x"C85459", x"C8748D", x"C8949C", x"C8B477", x"C8D473",
+         x"C8F4A3", x"C914B7", x"C93496", x"C9548D", x"C974B9", x"C994D2", x"C9B4B5", x"C9D4A8",
+         x"C9F4CF", x"CA14EC", x"CA34D4", x"CA54C3", x"CA74E5", x"CA9506", x"CAB4F3", x"CAD4DF",
+         x"CAF4FC", x"CB151F", x"CB3511", x"CB54FB", x"CB7513", x"CB9537", x"CBB52F", x"CBD518",
+         x"CBF52B", x"CC1550", x"CC354C", x"CC5534", x"CC7543", x"CC9568", x"CCB569", x"CCD552",
+         x"CCF55B", x"CD1580", x"CD3586", x"CD556F", x"CD7574", x"CD9598", x"CDB5A2", x"CDD58C",
+         x"CDF58E", x"CE15B0", x"CE35BD", x"CE55AA", x"CE75A7", x"CE95C7", x"CEB5D8", x"CED5C7",
+         x"CEF5C2", x"CF15DF", x"CF35F3", x"CF55E4", x"CF75DC", x"CF95F7", x"CFB60E", x"CFD602",
+         x"CFF5F7", x"D0160F", x"D03628", x"D0561F", x"D07612", x"D09627", x"D0B641", x"D0D63C",
+         x"D0F62E", x"D1163F", x"D1365B", x"D15659", x"D1764A", x"D19658", x"D1B674", x"D1D675",
+         x"D1F666", x"D21670", x"D2368D", x"D25691", x"D27682", x"D2968A", x"D2B6A5", x"D2D6AD",
+         x"D2F69F", x"D316A3", x"D336BE", x"D356C9", x"D376BB", x"D396BD", x"D3B6D7", x"D3D6E4",
+         x"D3F6D8", x"D416D7", x"D436EF", x"D456FF", x"D476F5", x"D496F1", x"D4B708", x"D4D71A",
+         x"D4F711", x"D5170C", x"D53720", x"D55734", x"D5772E", x"D59726", x"D5B739", x"D5D74E",
+         x"D5F74A", x"D61742", x"D63751", x"D65768", x"D67767", x"D6975D", x"D6B76A", x"D6D782",
+         x"D6F783", x"D71779", x"D73783", x"D7579B", x"D7779F", x"D79794", x"D7B79D", x"D7D7B4",
+         x"D7F7BB", x"D817B0", x"D837B6", x"D857CD", x"D877D6", x"D897CD", x"D8B7D0", x"D8D7E6",
+         x"D8F7F2", x"D917E9", x"D937EA", x"D957FF", x"D9780D", x"D99805", x"D9B804", x"D9D818",
+         x"D9F828", x"DA1821", x"DA381E", x"DA5831", x"DA7842", x"DA983D", x"DAB839", x"DAD84A",
+         x"DAF85C", x"DB185A", x"DB3854", x"DB5863", x"DB7877", x"DB9876", x"DBB86F", x"DBD87C",
+         x"DBF891", x"DC1892", x"DC388A", x"DC5895", x"DC78AA", x"DC98AE", x"DCB8A6", x"DCD8AF",
+         x"DCF8C4", x"DD18C9", x"DD38C2", x"DD58C8", x"DD78DD", x"DD98E5", x"DDB8DD", x"DDD8E2",
+         x"DDF8F7", x"DE1900", x"DE38F9", x"DE58FC", x"DE7910", x"DE991B", x"DEB915", x"DED916",
+         x"DEF929", x"DF1936", x"DF3931", x"DF5930", x"DF7942", x"DF9951", x"DFB94D", x"DFD94B",
+         x"DFF95B", x"E0196B", x"E03969", x"E05966", x"E07974", x"E09986", x"E0B985", x"E0D981",
+         x"E0F98E", x"E119A0", x"E139A1", x"E1599C", x"E179A7", x"E199BA", x"E1B9BD", x"E1D9B7",
+         x"E1F9C0", x"E219D4", x"E239D8", x"E259D3", x"E279DA", x"E299ED", x"E2B9F4", x"E2D9EE",
+         x"E2F9F4", x"E31A07", x"E33A0F", x"E35A0A", x"E37A0E", x"E39A20", x"E3BA2A", x"E3DA26",
+         x"E3FA28", x"E41A3A", x"E43A45", x"E45A41", x"E47A42", x"E49A53", x"E4BA60", x"E4DA5D",
+         x"E4FA5C", x"E51A6C", x"E53A7B", x"E55A79", x"E57A77", x"E59A85", x"E5BA95", x"E5DA95",
+         x"E5FA92", x"E61A9F", x"E63AB0", x"E65AB1", x"E67AAD", x"E69AB8", x"E6BACA", x"E6DACC",
+         x"E6FAC8", x"E71AD2", x"E73AE4", x"E75AE8", x"E77AE3", x"E79AEB", x"E7BAFD", x"E7DB03",
+         x"E7FAFF", x"E81B05", x"E83B17", x"E85B1F", x"E87B1A", x"E89B1F", x"E8BB31", x"E8DB3A",
+         x"E8FB36", x"E91B39", x"E93B4A", x"E95B55", x"E97B51", x"E99B53", x"E9BB64", x"E9DB70",
+         x"E9FB6D", x"EA1B6E", x"EA3B7D", x"EA5B8B", x"EA7B89", x"EA9B88", x"EABB96", x"EADBA5",
+         x"EAFBA5", x"EB1BA3", x"EB3BB0", x"EB5BBF", x"EB7BC0", x"EB9BBE", x"EBBBC9", x"EBDBDA",
+         x"EBFBDC", x"EC1BD9", x"EC3BE3", x"EC5BF4", x"EC7BF8", x"EC9BF4", x"ECBBFC", x"ECDC0E",
+         x"ECFC13", x"ED1C0F", x"ED3C16", x"ED5C27", x"ED7C2E", x"ED9C2B", x"EDBC30", x"EDDC41",
+         x"EDFC4A", x"EE1C46", x"EE3C4A", x"EE5C5B", x"EE7C65", x"EE9C62", x"EEBC64", x"EEDC74",
+         x"EEFC80", x"EF1C7D", x"EF3C7F", x"EF5C8E", x"EF7C9A", x"EF9C99", x"EFBC99", x"EFDCA7",
+         x"EFFCB5", x"F01CB5", x"F03CB4", x"F05CC1", x"F07CCF", x"F09CD0", x"F0BCCE", x"F0DCDA",
+         x"F0FCEA", x"F11CEC", x"F13CE9", x"F15CF4", x"F17D04", x"F19D07", x"F1BD04", x"F1DD0D",
+         x"F1FD1E", x"F21D23", x"F23D20", x"F25D27", x"F27D38", x"F29D3E", x"F2BD3B", x"F2DD41",
+         x"F2FD52", x"F31D59", x"F33D56", x"F35D5B", x"F37D6B", x"F39D75", x"F3BD72", x"F3DD75",
+         x"F3FD85", x"F41D90", x"F43D8D", x"F45D8F", x"F47D9F", x"F49DAA", x"F4BDA9", x"F4DDAA",
+         x"F4FDB8", x"F51DC5", x"F53DC4", x"F55DC4", x"F57DD2", x"F59DE0", x"F5BDE0", x"F5DDDF",
+         x"F5FDEB", x"F61DFA", x"F63DFC", x"F65DFA", x"F67E05", x"F69E14", x"F6BE17", x"F6DE15",
+         x"F6FE1E", x"F71E2E", x"F73E33", x"F75E30", x"F77E38", x"F79E48", x"F7BE4E", x"F7DE4B",
+         x"F7FE52", x"F81E62", x"F83E69", x"F85E66", x"F87E6C", x"F89E7C", x"F8BE85", x"F8DE82",
+         x"F8FE86", x"F91E96", x"F93EA0", x"F95E9D", x"F97EA0", x"F99EAF", x"F9BEBA", x"F9DEB9",
+         x"F9FEBA", x"FA1EC9", x"FA3ED5", x"FA5ED4", x"FA7ED5", x"FA9EE2", x"FABEF0", x"FADEF0",
+         x"FAFEEF", x"FB1EFC", x"FB3F0A", x"FB5F0C", x"FB7F0A", x"FB9F16", x"FBBF25", x"FBDF27",
+         x"FBFF25", x"FC1F2F", x"FC3F3F", x"FC5F43", x"FC7F40", x"FC9F49", x"FCBF59", x"FCDF5E",
+         x"FCFF5B", x"FD1F63", x"FD3F73", x"FD5F79", x"FD7F77", x"FD9F7D", x"FDBF8D", x"FDDF95",
+         x"FDFF92", x"FE1F97", x"FE3FA6", x"FE5FB0", x"FE7FAD", x"FE9FB1", x"FEBFC0", x"FEDFCB",
+         x"FEFFC9", x"FF1FCB", x"FF3FDA", x"FF5FE5", x"FF7FE4", x"FF9FE5", x"FFBFF3", x"FFE000",
+         x"000000", x"002000", x"00400D", x"00601B", x"00801C", x"00A01B", x"00C026", x"00E035",
+         x"010037", x"012035", x"014040", x"01604F", x"018053", x"01A050", x"01C05A", x"01E069",
+         x"02006E", x"02206B", x"024073", x"026083", x"028089", x"02A087", x"02C08D", x"02E09D",
+         x"0300A5", x"0320A2", x"0340A7", x"0360B7", x"0380C0", x"03A0BD", x"03C0C1", x"03E0D1",
+         x"0400DB", x"0420D9", x"0440DB", x"0460EA", x"0480F6", x"04A0F4", x"04C0F6", x"04E104",
+         x"050111", x"052110", x"054110", x"05611E", x"05812B", x"05A12C", x"05C12B", x"05E137",
+         x"060146", x"062147", x"064146", x"066151", x"068160", x"06A163", x"06C160", x"06E16A",
+         x"07017A", x"07217E", x"07417B", x"076184", x"078194", x"07A19A", x"07C197", x"07E19E",
+         x"0801AE", x"0821B5", x"0841B2", x"0861B8", x"0881C8", x"08A1D0", x"08C1CD", x"08E1D2",
+         x"0901E2", x"0921EB", x"0941E9", x"0961EC", x"0981FB", x"09A206", x"09C204", x"09E206",
+         x"0A0215", x"0A2221", x"0A4220", x"0A6220", x"0A822E", x"0AA23C", x"0AC23C", x"0AE23B",
+         x"0B0248", x"0B2256", x"0B4257", x"0B6256", x"0B8261", x"0BA271", x"0BC273", x"0BE270",
+         x"0C027B", x"0C228B", x"0C428E", x"0C628B", x"0C8295", x"0CA2A5", x"0CC2AA", x"0CE2A7",
+         x"0D02AE", x"0D22BF", x"0D42C5", x"0D62C2", x"0D82C8", x"0DA2D9", x"0DC2E0", x"0DE2DD",
+         x"0E02E2", x"0E22F3", x"0E42FC", x"0E62F9", x"0E82FC", x"0EA30C", x"0EC317", x"0EE314",
+         x"0F0316", x"0F2326", x"0F4332", x"0F6330", x"0F8331", x"0FA33F", x"0FC34C", x"0FE34B",
+         x"10034B", x"102359", x"104367", x"106367", x"108366", x"10A372", x"10C381", x"10E383",
+         x"110380", x"11238C", x"11439C", x"11639E", x"11839B", x"11A3A5", x"11C3B6", x"11E3BA",
+         x"1203B6", x"1223BF", x"1243D0", x"1263D5", x"1283D2", x"12A3D9", x"12C3EA", x"12E3F1",
+         x"1303ED", x"1323F2", x"134404", x"13640C", x"138408", x"13A40C", x"13C41D", x"13E427",
+         x"140424", x"142426", x"144437", x"146442", x"148440", x"14A441", x"14C450", x"14E45D",
+         x"15045B", x"15245B", x"15446A", x"156478", x"158477", x"15A475", x"15C483", x"15E492",
+         x"160493", x"162490", x"16449C", x"1664AD", x"1684AF", x"16A4AB", x"16C4B6", x"16E4C7",
+         x"1704CA", x"1724C6", x"1744CF", x"1764E1", x"1784E6", x"17A4E1", x"17C4E9", x"17E4FB",
+         x"180501", x"1824FD", x"184503", x"186515", x"18851D", x"18A518", x"18C51C", x"18E52E",
+         x"190538", x"192534", x"194536", x"196548", x"198553", x"19A54F", x"19C550", x"19E561",
+         x"1A056E", x"1A256B", x"1A456B", x"1A657B", x"1A8589", x"1AA587", x"1AC585", x"1AE594",
+         x"1B05A4", x"1B25A3", x"1B45A0", x"1B65AD", x"1B85BE", x"1BA5BF", x"1BC5BB", x"1BE5C6",
+         x"1C05D8", x"1C25DA", x"1C45D6", x"1C65E0", x"1C85F2", x"1CA5F6", x"1CC5F1", x"1CE5F9",
+         x"1D060C", x"1D2612", x"1D460C", x"1D6613", x"1D8626", x"1DA62D", x"1DC628", x"1DE62C",
+         x"1E0640", x"1E2649", x"1E4643", x"1E6646", x"1E8659", x"1EA664", x"1EC65F", x"1EE660",
+         x"1F0672", x"1F267F", x"1F467B", x"1F667A", x"1F868C", x"1FA69A", x"1FC697", x"1FE695",
+         x"2006A5", x"2026B5", x"2046B3", x"2066AF", x"2086BE", x"20A6D0", x"20C6CF", x"20E6CA",
+         x"2106D7", x"2126EA", x"2146EB", x"2166E5", x"2186F0", x"21A704", x"21C707", x"21E700",
+         x"220709", x"22271E", x"224723", x"22671B", x"228723", x"22A738", x"22C73E", x"22E737",
+         x"23073C", x"232751", x"23475A", x"236752", x"238756", x"23A76B", x"23C776", x"23E76E",
+         x"24076F", x"242784", x"244791", x"24678A", x"248789", x"24A79D", x"24C7AC", x"24E7A6",
+         x"2507A4", x"2527B6", x"2547C7", x"2567C3", x"2587BE", x"25A7CF", x"25C7E2", x"25E7DF",
+         x"2607D8", x"2627E8", x"2647FC", x"2667FB", x"2687F3", x"26A801", x"26C816", x"26E817",
+         x"27080E", x"27281A", x"274830", x"276833", x"27882A", x"27A833", x"27C84A", x"27E850",
+         x"280845", x"28284C", x"284863", x"28686C", x"288861", x"28A865", x"28C87D", x"28E887",
+         x"29087D", x"29287E", x"294896", x"2968A3", x"298899", x"29A898", x"29C8AF", x"29E8BE",
+         x"2A08B6", x"2A28B2", x"2A48C7", x"2A68DA", x"2A88D2", x"2AA8CC", x"2AC8E0", x"2AE8F4",
+         x"2B08EF", x"2B28E6", x"2B48F8", x"2B690F", x"2B890B", x"2BA901", x"2BC911", x"2BE929",
+         x"2C0928", x"2C291C", x"2C4929", x"2C6943", x"2C8945", x"2CA937", x"2CC942", x"2CE95D",
+         x"2D0961", x"2D2953", x"2D495B", x"2D6976", x"2D897E", x"2DA96F", x"2DC973", x"2DE990",
+         x"2E099A", x"2E298B", x"2E498C", x"2E69A8", x"2E89B6", x"2EA9A7", x"2EC9A5", x"2EE9C1",
+         x"2F09D2", x"2F29C4", x"2F49BF", x"2F69D9", x"2F89EE", x"2FA9E1", x"2FC9D8", x"2FE9F1",
+         x"300A09", x"3029FE", x"3049F2", x"306A09", x"308A24", x"30AA1C", x"30CA0D", x"30EA21",
+         x"310A3E", x"312A39", x"314A28", x"316A39", x"318A59", x"31AA56", x"31CA43", x"31EA50",
+         x"320A72", x"322A74", x"324A5E", x"326A68", x"328A8C", x"32AA91", x"32CA7A", x"32EA80",
+         x"330AA5", x"332AAE", x"334A97", x"336A98", x"338ABD", x"33AACC", x"33CAB4", x"33EAB0",
+         x"340AD5", x"342AE8", x"344AD1", x"346AC9", x"348AED", x"34AB05", x"34CAEF", x"34EAE1",
+         x"350B04", x"352B21", x"354B0D", x"356AFA", x"358B1B", x"35AB3D", x"35CB2C", x"35EB14",
+         x"360B31", x"362B58", x"364B4B", x"366B2E", x"368B47", x"36AB73", x"36CB6A", x"36EB49",
+         x"370B5D", x"372B8D", x"374B89", x"376B64", x"378B73", x"37ABA7", x"37CBA9", x"37EB80",
+         x"380B88", x"382BC0", x"384BC8", x"386B9D", x"388B9E", x"38ABD8", x"38CBE8", x"38EBBA",
+         x"390BB3", x"392BEF", x"394C08", x"396BD9", x"398BC8", x"39AC05", x"39CC28", x"39EBF8",
+         x"3A0BDD", x"3A2C1A", x"3A4C48", x"3A6C19", x"3A8BF3", x"3AAC2E", x"3ACC67", x"3AEC3B",
+         x"3B0C08", x"3B2C41", x"3B4C87", x"3B6C5E", x"3B8C1E", x"3BAC52", x"3BCCA6", x"3BEC83",
+         x"3C0C34", x"3C2C61", x"3C4CC6", x"3C6CAB", x"3C8C4A", x"3CAC6D", x"3CCCE5", x"3CECD5",
+         x"3D0C60", x"3D2C75", x"3D4D04", x"3D6D05", x"3D8C75", x"3DAC78", x"3DCD24", x"3DED3C",
+         x"3E0C8A", x"3E2C70", x"3E4D46", x"3E6D81", x"3E8C9B", x"3EAC54", x"3ECD6F", x"3EEDE5",
+         x"3F0C9E", x"3F2C04", x"3F4DB4", x"3F6EA8", x"3F8C58", x"3FAAEE", x"3FCF10", x"3FF155",
+         x"3FFFFF", x"3FF155", x"3FCF10", x"3FAAEE", x"3F8C58", x"3F6EA8", x"3F4DB4", x"3F2C04",
+         x"3F0C9E", x"3EEDE5", x"3ECD6F", x"3EAC54", x"3E8C9B", x"3E6D81", x"3E4D46", x"3E2C70",
+         x"3E0C8A", x"3DED3C", x"3DCD24", x"3DAC78", x"3D8C75", x"3D6D05", x"3D4D04", x"3D2C75",
+         x"3D0C60", x"3CECD5", x"3CCCE5", x"3CAC6D", x"3C8C4A", x"3C6CAB", x"3C4CC6", x"3C2C61",
+         x"3C0C34", x"3BEC83", x"3BCCA6", x"3BAC52", x"3B8C1E", x"3B6C5E", x"3B4C87", x"3B2C41",
+         x"3B0C08", x"3AEC3B", x"3ACC67", x"3AAC2E", x"3A8BF3", x"3A6C19", x"3A4C48", x"3A2C1A",
+         x"3A0BDD", x"39EBF8", x"39CC28", x"39AC05", x"398BC8", x"396BD9", x"394C08", x"392BEF",
+         x"390BB3", x"38EBBA", x"38CBE8", x"38ABD8", x"388B9E", x"386B9D", x"384BC8", x"382BC0",
+         x"380B88", x"37EB80", x"37CBA9", x"37ABA7", x"378B73", x"376B64", x"374B89", x"372B8D",
+         x"370B5D", x"36EB49", x"36CB6A", x"36AB73", x"368B47", x"366B2E", x"364B4B", x"362B58",
+         x"360B31", x"35EB14", x"35CB2C", x"35AB3D", x"358B1B", x"356AFA", x"354B0D", x"352B21",
+         x"350B04", x"34EAE1", x"34CAEF", x"34AB05", x"348AED", x"346AC9", x"344AD1", x"342AE8",
+         x"340AD5", x"33EAB0", x"33CAB4", x"33AACC", x"338ABD", x"336A98", x"334A97", x"332AAE",
+         x"330AA5", x"32EA80", x"32CA7A", x"32AA91", x"328A8C", x"326A68", x"324A5E", x"322A74",
+         x"320A72", x"31EA50", x"31CA43", x"31AA56", x"318A59", x"316A39", x"314A28", x"312A39",
+         x"310A3E", x"30EA21", x"30CA0D", x"30AA1C", x"308A24", x"306A09", x"3049F2", x"3029FE",
+         x"300A09", x"2FE9F1", x"2FC9D8", x"2FA9E1", x"2F89EE", x"2F69D9", x"2F49BF", x"2F29C4",
+         x"2F09D2", x"2EE9C1", x"2EC9A5", x"2EA9A7", x"2E89B6", x"2E69A8", x"2E498C", x"2E298B",
+         x"2E099A", x"2DE990", x"2DC973", x"2DA96F", x"2D897E", x"2D6976", x"2D495B", x"2D2953",
+         x"2D0961", x"2CE95D", x"2CC942", x"2CA937", x"2C8945", x"2C6943", x"2C4929", x"2C291C",
+         x"2C0928", x"2BE929", x"2BC911", x"2BA901", x"2B890B", x"2B690F", x"2B48F8", x"2B28E6",
+         x"2B08EF", x"2AE8F4", x"2AC8E0", x"2AA8CC", x"2A88D2", x"2A68DA", x"2A48C7", x"2A28B2",
+         x"2A08B6", x"29E8BE", x"29C8AF", x"29A898", x"298899", x"2968A3", x"294896", x"29287E",
+         x"29087D", x"28E887", x"28C87D", x"28A865", x"288861", x"28686C", x"284863", x"28284C",
+         x"280845", x"27E850", x"27C84A", x"27A833", x"27882A", x"276833", x"274830", x"27281A",
+         x"27080E", x"26E817", x"26C816", x"26A801", x"2687F3", x"2667FB", x"2647FC", x"2627E8",
+         x"2607D8", x"25E7DF", x"25C7E2", x"25A7CF", x"2587BE", x"2567C3", x"2547C7", x"2527B6",
+         x"2507A4", x"24E7A6", x"24C7AC", x"24A79D", x"248789", x"24678A", x"244791", x"242784",
+         x"24076F", x"23E76E", x"23C776", x"23A76B", x"238756", x"236752", x"23475A", x"232751",
+         x"23073C", x"22E737", x"22C73E", x"22A738", x"228723", x"22671B", x"224723", x"22271E",
+         x"220709", x"21E700", x"21C707", x"21A704", x"2186F0", x"2166E5", x"2146EB", x"2126EA",
+         x"2106D7", x"20E6CA", x"20C6CF", x"20A6D0", x"2086BE", x"2066AF", x"2046B3", x"2026B5",
+         x"2006A5", x"1FE695", x"1FC697", x"1FA69A", x"1F868C", x"1F667A", x"1F467B", x"1F267F",
+         x"1F0672", x"1EE660", x"1EC65F", x"1EA664", x"1E8659", x"1E6646", x"1E4643", x"1E2649",
+         x"1E0640", x"1DE62C", x"1DC628", x"1DA62D", x"1D8626", x"1D6613", x"1D460C", x"1D2612",
+         x"1D060C", x"1CE5F9", x"1CC5F1", x"1CA5F6", x"1C85F2", x"1C65E0", x"1C45D6", x"1C25DA",
+         x"1C05D8", x"1BE5C6", x"1BC5BB", x"1BA5BF", x"1B85BE", x"1B65AD", x"1B45A0", x"1B25A3",
+         x"1B05A4", x"1AE594", x"1AC585", x"1AA587", x"1A8589", x"1A657B", x"1A456B", x"1A256B",
+         x"1A056E", x"19E561", x"19C550", x"19A54F", x"198553", x"196548", x"194536", x"192534",
+         x"190538", x"18E52E", x"18C51C", x"18A518", x"18851D", x"186515", x"184503", x"1824FD",
+         x"180501", x"17E4FB", x"17C4E9", x"17A4E1", x"1784E6", x"1764E1", x"1744CF", x"1724C6",
+         x"1704CA", x"16E4C7", x"16C4B6", x"16A4AB", x"1684AF", x"1664AD", x"16449C", x"162490",
+         x"160493", x"15E492", x"15C483", x"15A475", x"158477", x"156478", x"15446A", x"15245B",
+         x"15045B", x"14E45D", x"14C450", x"14A441", x"148440", x"146442", x"144437", x"142426",
+         x"140424", x"13E427", x"13C41D", x"13A40C", x"138408", x"13640C", x"134404", x"1323F2",
+         x"1303ED", x"12E3F1", x"12C3EA", x"12A3D9", x"1283D2", x"1263D5", x"1243D0", x"1223BF",
+         x"1203B6", x"11E3BA", x"11C3B6", x"11A3A5", x"11839B", x"11639E", x"11439C", x"11238C",
+         x"110380", x"10E383", x"10C381", x"10A372", x"108366", x"106367", x"104367", x"102359",
+         x"10034B", x"0FE34B", x"0FC34C", x"0FA33F", x"0F8331", x"0F6330", x"0F4332", x"0F2326",
+         x"0F0316", x"0EE314", x"0EC317", x"0EA30C", x"0E82FC", x"0E62F9", x"0E42FC", x"0E22F3",
+         x"0E02E2", x"0DE2DD", x"0DC2E0", x"0DA2D9", x"0D82C8", x"0D62C2", x"0D42C5", x"0D22BF",
+         x"0D02AE", x"0CE2A7", x"0CC2AA", x"0CA2A5", x"0C8295", x"0C628B", x"0C428E", x"0C228B",
+         x"0C027B", x"0BE270", x"0BC273", x"0BA271", x"0B8261", x"0B6256", x"0B4257", x"0B2256",
+         x"0B0248", x"0AE23B", x"0AC23C", x"0AA23C", x"0A822E", x"0A6220", x"0A4220", x"0A2221",
+         x"0A0215", x"09E206", x"09C204", x"09A206", x"0981FB", x"0961EC", x"0941E9", x"0921EB",
+         x"0901E2", x"08E1D2", x"08C1CD", x"08A1D0", x"0881C8", x"0861B8", x"0841B2", x"0821B5",
+         x"0801AE", x"07E19E", x"07C197", x"07A19A", x"078194", x"076184", x"07417B", x"07217E",
+         x"07017A", x"06E16A", x"06C160", x"06A163", x"068160", x"066151", x"064146", x"062147",
+         x"060146", x"05E137", x"05C12B", x"05A12C", x"05812B", x"05611E", x"054110", x"052110",
+         x"050111", x"04E104", x"04C0F6", x"04A0F4", x"0480F6", x"0460EA", x"0440DB", x"0420D9",
+         x"0400DB", x"03E0D1", x"03C0C1", x"03A0BD", x"0380C0", x"0360B7", x"0340A7", x"0320A2",
+         x"0300A5", x"02E09D", x"02C08D", x"02A087", x"028089", x"026083", x"024073", x"02206B",
+         x"02006E", x"01E069", x"01C05A", x"01A050", x"018053", x"01604F", x"014040", x"012035",
+         x"010037", x"00E035", x"00C026", x"00A01B", x"00801C", x"00601B", x"00400D", x"002000",
+         x"000000", x"FFE000", x"FFBFF3", x"FF9FE5", x"FF7FE4", x"FF5FE5", x"FF3FDA", x"FF1FCB",
+         x"FEFFC9", x"FEDFCB", x"FEBFC0", x"FE9FB1", x"FE7FAD", x"FE5FB0", x"FE3FA6", x"FE1F97",
+         x"FDFF92", x"FDDF95", x"FDBF8D", x"FD9F7D", x"FD7F77", x"FD5F79", x"FD3F73", x"FD1F63",
+         x"FCFF5B", x"FCDF5E", x"FCBF59", x"FC9F49", x"FC7F40", x"FC5F43", x"FC3F3F", x"FC1F2F",
+         x"FBFF25", x"FBDF27", x"FBBF25", x"FB9F16", x"FB7F0A", x"FB5F0C", x"FB3F0A", x"FB1EFC",
+         x"FAFEEF", x"FADEF0", x"FABEF0", x"FA9EE2", x"FA7ED5", x"FA5ED4", x"FA3ED5", x"FA1EC9",
+         x"F9FEBA", x"F9DEB9", x"F9BEBA", x"F99EAF", x"F97EA0", x"F95E9D", x"F93EA0", x"F91E96",
+         x"F8FE86", x"F8DE82", x"F8BE85", x"F89E7C", x"F87E6C", x"F85E66", x"F83E69", x"F81E62",
+         x"F7FE52", x"F7DE4B", x"F7BE4E", x"F79E48", x"F77E38", x"F75E30", x"F73E33", x"F71E2E",
+         x"F6FE1E", x"F6DE15", x"F6BE17", x"F69E14", x"F67E05", x"F65DFA", x"F63DFC", x"F61DFA",
+         x"F5FDEB", x"F5DDDF", x"F5BDE0", x"F59DE0", x"F57DD2", x"F55DC4", x"F53DC4", x"F51DC5",
+         x"F4FDB8", x"F4DDAA", x"F4BDA9", x"F49DAA", x"F47D9F", x"F45D8F", x"F43D8D", x"F41D90",
+         x"F3FD85", x"F3DD75", x"F3BD72", x"F39D75", x"F37D6B", x"F35D5B", x"F33D56", x"F31D59",
+         x"F2FD52", x"F2DD41", x"F2BD3B", x"F29D3E", x"F27D38", x"F25D27", x"F23D20", x"F21D23",
+         x"F1FD1E", x"F1DD0D", x"F1BD04", x"F19D07", x"F17D04", x"F15CF4", x"F13CE9", x"F11CEC",
+         x"F0FCEA", x"F0DCDA", x"F0BCCE", x"F09CD0", x"F07CCF", x"F05CC1", x"F03CB4", x"F01CB5",
+         x"EFFCB5", x"EFDCA7", x"EFBC99", x"EF9C99", x"EF7C9A", x"EF5C8E", x"EF3C7F", x"EF1C7D",
+         x"EEFC80", x"EEDC74", x"EEBC64", x"EE9C62", x"EE7C65", x"EE5C5B", x"EE3C4A", x"EE1C46",
+         x"EDFC4A", x"EDDC41", x"EDBC30", x"ED9C2B", x"ED7C2E", x"ED5C27", x"ED3C16", x"ED1C0F",
+         x"ECFC13", x"ECDC0E", x"ECBBFC", x"EC9BF4", x"EC7BF8", x"EC5BF4", x"EC3BE3", x"EC1BD9",
+         x"EBFBDC", x"EBDBDA", x"EBBBC9", x"EB9BBE", x"EB7BC0", x"EB5BBF", x"EB3BB0", x"EB1BA3",
+         x"EAFBA5", x"EADBA5", x"EABB96", x"EA9B88", x"EA7B89", x"EA5B8B", x"EA3B7D", x"EA1B6E",
+         x"E9FB6D", x"E9DB70", x"E9BB64", x"E99B53", x"E97B51", x"E95B55", x"E93B4A", x"E91B39",
+         x"E8FB36", x"E8DB3A", x"E8BB31", x"E89B1F", x"E87B1A", x"E85B1F", x"E83B17", x"E81B05",
+         x"E7FAFF", x"E7DB03", x"E7BAFD", x"E79AEB", x"E77AE3", x"E75AE8", x"E73AE4", x"E71AD2",
+         x"E6FAC8", x"E6DACC", x"E6BACA", x"E69AB8", x"E67AAD", x"E65AB1", x"E63AB0", x"E61A9F",
+         x"E5FA92", x"E5DA95", x"E5BA95", x"E59A85", x"E57A77", x"E55A79", x"E53A7B", x"E51A6C",
+         x"E4FA5C", x"E4DA5D", x"E4BA60", x"E49A53", x"E47A42", x"E45A41", x"E43A45", x"E41A3A",
+         x"E3FA28", x"E3DA26", x"E3BA2A", x"E39A20", x"E37A0E", x"E35A0A", x"E33A0F", x"E31A07",
+         x"E2F9F4", x"E2D9EE", x"E2B9F4", x"E299ED", x"E279DA", x"E259D3", x"E239D8", x"E219D4",
+         x"E1F9C0", x"E1D9B7", x"E1B9BD", x"E199BA", x"E179A7", x"E1599C", x"E139A1", x"E119A0",
+         x"E0F98E", x"E0D981", x"E0B985", x"E09986", x"E07974", x"E05966", x"E03969", x"E0196B",
+         x"DFF95B", x"DFD94B", x"DFB94D", x"DF9951", x"DF7942", x"DF5930", x"DF3931", x"DF1936",
+         x"DEF929", x"DED916", x"DEB915", x"DE991B", x"DE7910", x"DE58FC", x"DE38F9", x"DE1900",
+         x"DDF8F7", x"DDD8E2", x"DDB8DD", x"DD98E5", x"DD78DD", x"DD58C8", x"DD38C2", x"DD18C9",
+         x"DCF8C4", x"DCD8AF", x"DCB8A6", x"DC98AE", x"DC78AA", x"DC5895", x"DC388A", x"DC1892",
+         x"DBF891", x"DBD87C", x"DBB86F", x"DB9876", x"DB7877", x"DB5863", x"DB3854", x"DB185A",
+         x"DAF85C", x"DAD84A", x"DAB839", x"DA983D", x"DA7842", x"DA5831", x"DA381E", x"DA1821",
+         x"D9F828", x"D9D818", x"D9B804", x"D99805", x"D9780D", x"D957FF", x"D937EA", x"D917E9",
+         x"D8F7F2", x"D8D7E6", x"D8B7D0", x"D897CD", x"D877D6", x"D857CD", x"D837B6", x"D817B0",
+         x"D7F7BB", x"D7D7B4", x"D7B79D", x"D79794", x"D7779F", x"D7579B", x"D73783", x"D71779",
+         x"D6F783", x"D6D782", x"D6B76A", x"D6975D", x"D67767", x"D65768", x"D63751", x"D61742",
+         x"D5F74A", x"D5D74E", x"D5B739", x"D59726", x"D5772E", x"D55734", x"D53720", x"D5170C",
+         x"D4F711", x"D4D71A", x"D4B708", x"D496F1", x"D476F5", x"D456FF", x"D436EF", x"D416D7",
+         x"D3F6D8", x"D3D6E4", x"D3B6D7", x"D396BD", x"D376BB", x"D356C9", x"D336BE", x"D316A3",
+         x"D2F69F", x"D2D6AD", x"D2B6A5", x"D2968A", x"D27682", x"D25691", x"D2368D", x"D21670",
+         x"D1F666", x"D1D675", x"D1B674", x"D19658", x"D1764A", x"D15659", x"D1365B", x"D1163F",
+         x"D0F62E", x"D0D63C", x"D0B641", x"D09627", x"D07612", x"D0561F", x"D03628", x"D0160F",
+         x"CFF5F7", x"CFD602", x"CFB60E", x"CF95F7", x"CF75DC", x"CF55E4", x"CF35F3", x"CF15DF",
+         x"CEF5C2", x"CED5C7", x"CEB5D8", x"CE95C7", x"CE75A7", x"CE55AA", x"CE35BD", x"CE15B0",
+         x"CDF58E", x"CDD58C", x"CDB5A2", x"CD9598", x"CD7574", x"CD556F", x"CD3586", x"CD1580",
+         x"CCF55B", x"CCD552", x"CCB569", x"CC9568", x"CC7543", x"CC5534", x"CC354C", x"CC1550",
+         x"CBF52B", x"CBD518", x"CBB52F", x"CB9537", x"CB7513", x"CB54FB", x"CB3511", x"CB151F",
+         x"CAF4FC", x"CAD4DF", x"CAB4F3", x"CA9506", x"CA74E5", x"CA54C3", x"CA34D4", x"CA14EC",
+         x"C9F4CF", x"C9D4A8", x"C9B4B5", x"C994D2", x"C974B9", x"C9548D", x"C93496", x"C914B7",
+         x"C8F4A3", x"C8D473", x"C8B477", x"C8949C", x"C8748D", x"C85459", x"C83457", x"C81480",
+         x"C7F478", x"C7D440", x"C7B438", x"C79463", x"C77462", x"C75428", x"C73418", x"C71446",
+         x"C6F44D", x"C6D411", x"C6B3F8", x"C69427", x"C67438", x"C653FB", x"C633D8", x"C61408",
+         x"C5F423", x"C5D3E6", x"C5B3B8", x"C593E7", x"C5740D", x"C553D2", x"C53399", x"C513C5",
+         x"C4F3F8", x"C4D3BF", x"C4B379", x"C493A2", x"C473E2", x"C453AE", x"C4335A", x"C4137D",
+         x"C3F3CC", x"C3D39F", x"C3B33A", x"C39355", x"C373B6", x"C35393", x"C3331B", x"C3132B",
+         x"C2F3A0", x"C2D38B", x"C2B2FC", x"C292FB", x"C2738B", x"C25388", x"C232DC", x"C212C4",
+         x"C1F376", x"C1D390", x"C1B2BA", x"C1927F", x"C17365", x"C153AC", x"C13291", x"C1121B",
+         x"C0F362", x"C0D3FC", x"C0B24C", x"C09158", x"C073A8", x"C05512", x"C030F0", x"C00EAB"),
+        -- octave 2
+        (x"C00001", x"C007B4", x"C01D5A", x"C03D19", x"C061F4", x"C08753", x"C0AA47", x"C0CA02",
+         x"C0E780", x"C10499", x"C122EC", x"C14329", x"C164E2", x"C186FA", x"C1A84F", x"C1C84D",
+         x"C1E727", x"C205A5", x"C224A6", x"C244AD", x"C265A1", x"C286F0", x"C2A7E5", x"C2C80A",
+         x"C2E764", x"C30665", x"C325A4", x"C3458D", x"C36627", x"C3871A", x"C3A7E2", x"C3C81D",
+         x"C3E7BB", x"C40703", x"C42664", x"C4463C", x"C466A1", x"C4875B", x"C4A808", x"C4C850",
+         x"C4E81A", x"C5078F", x"C52707", x"C546D4", x"C56716", x"C587A9", x"C5A842", x"C5C893",
+         x"C5E87A", x"C60811", x"C6279B", x"C64762", x"C66789", x"C68800", x"C6A888", x"C6C8DE",
+         x"C6E8DB", x"C7088C", x"C72826", x"C747E9", x"C767FD", x"C7885C", x"C7A8D5", x"C7C92E",
+         x"C7E93C", x"C80903", x"C828AA", x"C8486C", x"C86871", x"C888BC", x"C8A928", x"C8C982",
+         x"C8E99D", x"C90976", x"C9292A", x"C948EB", x"C968E5", x"C9891F", x"C9A980", x"C9C9D8",
+         x"C9E9FE", x"CA09E6", x"CA29A6", x"CA4969", x"CA6959", x"CA8985", x"CAA9DA", x"CACA30",
+         x"CAEA5F", x"CB0A54", x"CB2A1F", x"CB49E5", x"CB69CD", x"CB89EC", x"CBAA37", x"CBCA8A",
+         x"CBEABF", x"CC0AC0", x"CC2A95", x"CC4A5F", x"CC6A42", x"CC8A56", x"CCAA96", x"CCCAE5",
+         x"CCEB1F", x"CD0B2A", x"CD2B0A", x"CD4AD8", x"CD6AB7", x"CD8AC2", x"CDAAF8", x"CDCB42",
+         x"CDEB7E", x"CE0B93", x"CE2B7C", x"CE4B4F", x"CE6B2C", x"CE8B2E", x"CEAB5B", x"CECBA0",
+         x"CEEBDE", x"CF0BFA", x"CF2BED", x"CF4BC5", x"CF6BA1", x"CF8B9C", x"CFABC0", x"CFCBFF",
+         x"CFEC3E", x"D00C61", x"D02C5C", x"D04C3A", x"D06C16", x"D08C0B", x"D0AC27", x"D0CC60",
+         x"D0EC9E", x"D10CC6", x"D12CC9", x"D14CAE", x"D16C8A", x"D18C7B", x"D1AC8F", x"D1CCC2",
+         x"D1ECFF", x"D20D2B", x"D22D35", x"D24D20", x"D26CFF", x"D28CEB", x"D2ACF8", x"D2CD25",
+         x"D2ED60", x"D30D8F", x"D32DA0", x"D34D91", x"D36D72", x"D38D5C", x"D3AD63", x"D3CD89",
+         x"D3EDC1", x"D40DF2", x"D42E0A", x"D44E01", x"D46DE6", x"D48DCE", x"D4ADCF", x"D4CDEE",
+         x"D4EE23", x"D50E56", x"D52E72", x"D54E70", x"D56E58", x"D58E3F", x"D5AE3B", x"D5CE55",
+         x"D5EE85", x"D60EB9", x"D62EDA", x"D64EDE", x"D66ECA", x"D68EB1", x"D6AEA9", x"D6CEBD",
+         x"D6EEE9", x"D70F1C", x"D72F40", x"D74F4A", x"D76F3B", x"D78F23", x"D7AF17", x"D7CF25",
+         x"D7EF4D", x"D80F7F", x"D82FA7", x"D84FB6", x"D86FAB", x"D88F95", x"D8AF86", x"D8CF8F",
+         x"D8EFB2", x"D90FE2", x"D9300C", x"D95020", x"D9701B", x"D99006", x"D9AFF6", x"D9CFFA",
+         x"D9F017", x"DA1045", x"DA3071", x"DA508A", x"DA7089", x"DA9078", x"DAB066", x"DAD066",
+         x"DAF07E", x"DB10A9", x"DB30D6", x"DB50F3", x"DB70F7", x"DB90E8", x"DBB0D6", x"DBD0D2",
+         x"DBF0E6", x"DC110D", x"DC313A", x"DC515B", x"DC7164", x"DC9158", x"DCB146", x"DCD13F",
+         x"DCF14E", x"DD1172", x"DD319F", x"DD51C2", x"DD71D0", x"DD91C8", x"DDB1B7", x"DDD1AD",
+         x"DDF1B8", x"DE11D8", x"DE3203", x"DE5228", x"DE723B", x"DE9237", x"DEB227", x"DED21B",
+         x"DEF222", x"DF123E", x"DF3267", x"DF528F", x"DF72A5", x"DF92A5", x"DFB298", x"DFD28A",
+         x"DFF28D", x"E012A5", x"E032CC", x"E052F4", x"E0730E", x"E09313", x"E0B307", x"E0D2FA",
+         x"E0F2F8", x"E1130C", x"E13331", x"E1535A", x"E17377", x"E19380", x"E1B377", x"E1D369",
+         x"E1F365", x"E21375", x"E23396", x"E253BF", x"E273DF", x"E293EC", x"E2B3E6", x"E2D3D9",
+         x"E2F3D2", x"E313DE", x"E333FC", x"E35424", x"E37446", x"E39457", x"E3B455", x"E3D448",
+         x"E3F440", x"E41447", x"E43463", x"E45489", x"E474AD", x"E494C2", x"E4B4C3", x"E4D4B8",
+         x"E4F4AE", x"E514B2", x"E534CA", x"E554EF", x"E57514", x"E5952C", x"E5B531", x"E5D527",
+         x"E5F51C", x"E6151D", x"E63531", x"E65554", x"E6757A", x"E69595", x"E6B59E", x"E6D596",
+         x"E6F58B", x"E71589", x"E73599", x"E755BA", x"E775E0", x"E795FE", x"E7B60A", x"E7D605",
+         x"E7F5FA", x"E815F6", x"E83602", x"E85620", x"E87646", x"E89666", x"E8B675", x"E8D674",
+         x"E8F669", x"E91663", x"E9366C", x"E95687", x"E976AB", x"E996CD", x"E9B6E0", x"E9D6E2",
+         x"E9F6D8", x"EA16D0", x"EA36D6", x"EA56EE", x"EA7711", x"EA9734", x"EAB74A", x"EAD74F",
+         x"EAF747", x"EB173E", x"EB3741", x"EB5755", x"EB7777", x"EB979B", x"EBB7B4", x"EBD7BC",
+         x"EBF7B6", x"EC17AD", x"EC37AD", x"EC57BD", x"EC77DD", x"EC9801", x"ECB81D", x"ECD829",
+         x"ECF825", x"ED181B", x"ED3819", x"ED5826", x"ED7843", x"ED9867", x"EDB885", x"EDD894",
+         x"EDF893", x"EE188A", x"EE3886", x"EE5890", x"EE78AA", x"EE98CD", x"EEB8ED", x"EED8FF",
+         x"EEF901", x"EF18F9", x"EF38F3", x"EF58FA", x"EF7911", x"EF9933", x"EFB955", x"EFD96A",
+         x"EFF96F", x"F01968", x"F03960", x"F05964", x"F07979", x"F09999", x"F0B9BC", x"F0D9D4",
+         x"F0F9DC", x"F119D6", x"F139CE", x"F159CF", x"F179E1", x"F19A00", x"F1BA22", x"F1DA3D",
+         x"F1FA48", x"F21A45", x"F23A3C", x"F25A3B", x"F27A49", x"F29A66", x"F2BA89", x"F2DAA6",
+         x"F2FAB4", x"F31AB3", x"F33AAB", x"F35AA8", x"F37AB2", x"F39ACD", x"F3BAEF", x"F3DB0E",
+         x"F3FB1F", x"F41B21", x"F43B19", x"F45B14", x"F47B1C", x"F49B34", x"F4BB55", x"F4DB76",
+         x"F4FB8A", x"F51B8E", x"F53B88", x"F55B82", x"F57B87", x"F59B9B", x"F5BBBC", x"F5DBDD",
+         x"F5FBF4", x"F61BFB", x"F63BF6", x"F65BEF", x"F67BF2", x"F69C03", x"F6BC22", x"F6DC44",
+         x"F6FC5D", x"F71C68", x"F73C65", x"F75C5D", x"F77C5D", x"F79C6C", x"F7BC88", x"F7DCAB",
+         x"F7FCC6", x"F81CD4", x"F83CD3", x"F85CCC", x"F87CC9", x"F89CD5", x"F8BCEF", x"F8DD11",
+         x"F8FD2F", x"F91D3F", x"F93D41", x"F95D3A", x"F97D36", x"F99D3E", x"F9BD56", x"F9DD77",
+         x"F9FD97", x"FA1DAA", x"FA3DAE", x"FA5DA8", x"FA7DA3", x"FA9DA9", x"FABDBE", x"FADDDE",
+         x"FAFDFE", x"FB1E15", x"FB3E1C", x"FB5E17", x"FB7E10", x"FB9E13", x"FBBE26", x"FBDE44",
+         x"FBFE66", x"FC1E7E", x"FC3E88", x"FC5E85", x"FC7E7E", x"FC9E7F", x"FCBE8E", x"FCDEAB",
+         x"FCFECC", x"FD1EE8", x"FD3EF5", x"FD5EF3", x"FD7EEC", x"FD9EEB", x"FDBEF7", x"FDDF11",
+         x"FDFF33", x"FE1F50", x"FE3F60", x"FE5F61", x"FE7F5A", x"FE9F57", x"FEBF60", x"FEDF78",
+         x"FEFF9A", x"FF1FB8", x"FF3FCB", x"FF5FCF", x"FF7FC9", x"FF9FC4", x"FFBFCA", x"FFDFE0",
+         x"000000", x"002020", x"004036", x"00603C", x"008037", x"00A031", x"00C035", x"00E048",
+         x"010066", x"012088", x"0140A0", x"0160A9", x"0180A6", x"01A09F", x"01C0A0", x"01E0B0",
+         x"0200CD", x"0220EF", x"024109", x"026115", x"028114", x"02A10D", x"02C10B", x"02E118",
+         x"030134", x"032155", x"034172", x"036181", x"038182", x"03A17B", x"03C178", x"03E182",
+         x"04019A", x"0421BC", x"0441DA", x"0461ED", x"0481F0", x"04A1E9", x"04C1E4", x"04E1EB",
+         x"050202", x"052222", x"054242", x"056257", x"05825D", x"05A258", x"05C252", x"05E256",
+         x"060269", x"062289", x"0642AA", x"0662C2", x"0682CA", x"06A2C6", x"06C2BF", x"06E2C1",
+         x"0702D1", x"0722EF", x"074311", x"07632B", x"078337", x"07A334", x"07C32D", x"07E32C",
+         x"08033A", x"082355", x"084378", x"086394", x"0883A3", x"08A3A3", x"08C39B", x"08E398",
+         x"0903A3", x"0923BC", x"0943DE", x"0963FD", x"09840E", x"09A411", x"09C40A", x"09E405",
+         x"0A040C", x"0A2423", x"0A4444", x"0A6465", x"0A8479", x"0AA47E", x"0AC478", x"0AE472",
+         x"0B0476", x"0B248A", x"0B44AB", x"0B64CC", x"0B84E4", x"0BA4EC", x"0BC4E7", x"0BE4DF",
+         x"0C04E1", x"0C24F2", x"0C4511", x"0C6533", x"0C854E", x"0CA558", x"0CC555", x"0CE54D",
+         x"0D054C", x"0D255A", x"0D4577", x"0D659A", x"0D85B7", x"0DA5C5", x"0DC5C4", x"0DE5BB",
+         x"0E05B8", x"0E25C3", x"0E45DE", x"0E6600", x"0E861F", x"0EA631", x"0EC632", x"0EE62A",
+         x"0F0624", x"0F262C", x"0F4644", x"0F6667", x"0F8687", x"0FA69C", x"0FC6A0", x"0FE698",
+         x"100691", x"102696", x"1046AB", x"1066CD", x"1086EF", x"10A706", x"10C70D", x"10E707",
+         x"1106FF", x"112701", x"114713", x"116733", x"118756", x"11A770", x"11C77A", x"11E776",
+         x"12076D", x"12276C", x"12477B", x"126799", x"1287BD", x"12A7DA", x"12C7E7", x"12E7E5",
+         x"1307DB", x"1327D7", x"1347E3", x"1367FF", x"138823", x"13A843", x"13C853", x"13E853",
+         x"14084A", x"142844", x"14484C", x"146865", x"148889", x"14A8AB", x"14C8BF", x"14E8C2",
+         x"1508B9", x"1528B1", x"1548B6", x"1568CC", x"1588EF", x"15A912", x"15C92A", x"15E930",
+         x"160928", x"16291E", x"164920", x"166933", x"168955", x"16A979", x"16C994", x"16E99D",
+         x"170997", x"17298C", x"17498B", x"17699A", x"1789BA", x"17A9E0", x"17C9FE", x"17EA0A",
+         x"180A06", x"1829FB", x"1849F6", x"186A02", x"188A20", x"18AA46", x"18CA67", x"18EA77",
+         x"190A75", x"192A6A", x"194A62", x"196A6B", x"198A86", x"19AAAC", x"19CACF", x"19EAE3",
+         x"1A0AE4", x"1A2AD9", x"1A4ACF", x"1A6AD4", x"1A8AEC", x"1AAB11", x"1ACB36", x"1AEB4E",
+         x"1B0B52", x"1B2B48", x"1B4B3D", x"1B6B3E", x"1B8B53", x"1BAB77", x"1BCB9D", x"1BEBB9",
+         x"1C0BC0", x"1C2BB8", x"1C4BAB", x"1C6BA9", x"1C8BBA", x"1CABDC", x"1CCC04", x"1CEC22",
+         x"1D0C2E", x"1D2C27", x"1D4C1A", x"1D6C14", x"1D8C21", x"1DAC41", x"1DCC6A", x"1DEC8B",
+         x"1E0C9B", x"1E2C97", x"1E4C89", x"1E6C80", x"1E8C89", x"1EACA6", x"1ECCCF", x"1EECF4",
+         x"1F0D08", x"1F2D06", x"1F4CF9", x"1F6CED", x"1F8CF2", x"1FAD0C", x"1FCD34", x"1FED5B",
+         x"200D73", x"202D76", x"204D68", x"206D5B", x"208D5B", x"20AD71", x"20CD99", x"20EDC2",
+         x"210DDE", x"212DE5", x"214DD9", x"216DC9", x"218DC5", x"21ADD8", x"21CDFD", x"21EE28",
+         x"220E48", x"222E53", x"224E49", x"226E38", x"228E30", x"22AE3E", x"22CE61", x"22EE8E",
+         x"230EB2", x"232EC1", x"234EBA", x"236EA8", x"238E9C", x"23AEA5", x"23CEC6", x"23EEF3",
+         x"240F1A", x"242F2E", x"244F2A", x"246F18", x"248F09", x"24AF0D", x"24CF2A", x"24EF57",
+         x"250F82", x"252F9A", x"254F9A", x"256F88", x"258F77", x"25AF76", x"25CF8F", x"25EFBB",
+         x"260FE9", x"263006", x"26500A", x"266FFA", x"268FE5", x"26AFE0", x"26CFF4", x"26F01E",
+         x"27104E", x"273071", x"27507A", x"27706B", x"279055", x"27B04A", x"27D059", x"27F081",
+         x"2810B3", x"2830DB", x"2850E9", x"2870DD", x"2890C5", x"28B0B6", x"28D0C0", x"28F0E4",
+         x"291117", x"293143", x"295157", x"29714F", x"299136", x"29B122", x"29D126", x"29F147",
+         x"2A117B", x"2A31AB", x"2A51C5", x"2A71C1", x"2A91A8", x"2AB190", x"2AD18E", x"2AF1AA",
+         x"2B11DD", x"2B3212", x"2B5231", x"2B7232", x"2B921A", x"2BB1FF", x"2BD1F6", x"2BF20E",
+         x"2C123F", x"2C3277", x"2C529D", x"2C72A4", x"2C928E", x"2CB26F", x"2CD260", x"2CF271",
+         x"2D12A0", x"2D32DB", x"2D5308", x"2D7315", x"2D9301", x"2DB2E0", x"2DD2CB", x"2DF2D5",
+         x"2E1301", x"2E333E", x"2E5371", x"2E7385", x"2E9376", x"2EB352", x"2ED337", x"2EF33A",
+         x"2F1362", x"2F33A0", x"2F53D9", x"2F73F5", x"2F93EA", x"2FB3C6", x"2FD3A4", x"2FF39F",
+         x"3013C2", x"303401", x"305440", x"307464", x"30945F", x"30B43B", x"30D413", x"30F406",
+         x"311422", x"313460", x"3154A5", x"3174D2", x"3194D4", x"31B4B1", x"31D484", x"31F46D",
+         x"321482", x"3234BE", x"325508", x"32753E", x"329549", x"32B528", x"32D4F6", x"32F4D6",
+         x"3314E1", x"33351B", x"33556A", x"3375AA", x"3395BE", x"33B5A1", x"33D56B", x"33F540",
+         x"341541", x"343576", x"3455C9", x"347614", x"349633", x"34B61B", x"34D5E1", x"34F5AC",
+         x"3515A1", x"3535D0", x"355626", x"35767B", x"3596A7", x"35B697", x"35D65A", x"35F61A",
+         x"361602", x"363628", x"365680", x"3676E1", x"36971B", x"36B715", x"36D6D6", x"36F68A",
+         x"371663", x"37367E", x"3756D8", x"377744", x"37978F", x"37B794", x"37D756", x"37F6FD",
+         x"3816C4", x"3836D2", x"38572B", x"3877A4", x"389803", x"38B817", x"38D7DA", x"38F774",
+         x"391725", x"393722", x"395778", x"397800", x"399877", x"39B89E", x"39D865", x"39F7EF",
+         x"3A1786", x"3A376D", x"3A57BE", x"3A7857", x"3A98EA", x"3AB92C", x"3AD8F9", x"3AF871",
+         x"3B17E6", x"3B37B0", x"3B57F8", x"3B78A5", x"3B995F", x"3BB9C4", x"3BD99C", x"3BF8FD",
+         x"3C1845", x"3C37E3", x"3C581E", x"3C78E6", x"3C99D9", x"3CBA73", x"3CDA5C", x"3CF99B",
+         x"3D189C", x"3D37F6", x"3D581B", x"3D7910", x"3D9A5F", x"3DBB53", x"3DDB5A", x"3DFA5B",
+         x"3E18D9", x"3E37B3", x"3E57B1", x"3E7906", x"3E9B1E", x"3EBCD7", x"3EDD14", x"3EFB67",
+         x"3F1880", x"3F35FE", x"3F55B9", x"3F78AD", x"3F9E0C", x"3FC2E7", x"3FE2A6", x"3FF84C",
+         x"3FFFFF", x"3FF84C", x"3FE2A6", x"3FC2E7", x"3F9E0C", x"3F78AD", x"3F55B9", x"3F35FE",
+         x"3F1880", x"3EFB67", x"3EDD14", x"3EBCD7", x"3E9B1E", x"3E7906", x"3E57B1", x"3E37B3",
+         x"3E18D9", x"3DFA5B", x"3DDB5A", x"3DBB53", x"3D9A5F", x"3D7910", x"3D581B", x"3D37F6",
+         x"3D189C", x"3CF99B", x"3CDA5C", x"3CBA73", x"3C99D9", x"3C78E6", x"3C581E", x"3C37E3",
+         x"3C1845", x"3BF8FD", x"3BD99C", x"3BB9C4", x"3B995F", x"3B78A5", x"3B57F8", x"3B37B0",
+         x"3B17E6", x"3AF871", x"3AD8F9", x"3AB92C", x"3A98EA", x"3A7857", x"3A57BE", x"3A376D",
+         x"3A1786", x"39F7EF", x"39D865", x"39B89E", x"399877", x"397800", x"395778", x"393722",
+         x"391725", x"38F774", x"38D7DA", x"38B817", x"389803", x"3877A4", x"38572B", x"3836D2",
+         x"3816C4", x"37F6FD", x"37D756", x"37B794", x"37978F", x"377744", x"3756D8", x"37367E",
+         x"371663", x"36F68A", x"36D6D6", x"36B715", x"36971B", x"3676E1", x"365680", x"363628",
+         x"361602", x"35F61A", x"35D65A", x"35B697", x"3596A7", x"35767B", x"355626", x"3535D0",
+         x"3515A1", x"34F5AC", x"34D5E1", x"34B61B", x"349633", x"347614", x"3455C9", x"343576",
+         x"341541", x"33F540", x"33D56B", x"33B5A1", x"3395BE", x"3375AA", x"33556A", x"33351B",
+         x"3314E1", x"32F4D6", x"32D4F6", x"32B528", x"329549", x"32753E", x"325508", x"3234BE",
+         x"321482", x"31F46D", x"31D484", x"31B4B1", x"3194D4", x"3174D2", x"3154A5", x"313460",
+         x"311422", x"30F406", x"30D413", x"30B43B", x"30945F", x"307464", x"305440", x"303401",
+         x"3013C2", x"2FF39F", x"2FD3A4", x"2FB3C6", x"2F93EA", x"2F73F5", x"2F53D9", x"2F33A0",
+         x"2F1362", x"2EF33A", x"2ED337", x"2EB352", x"2E9376", x"2E7385", x"2E5371", x"2E333E",
+         x"2E1301", x"2DF2D5", x"2DD2CB", x"2DB2E0", x"2D9301", x"2D7315", x"2D5308", x"2D32DB",
+         x"2D12A0", x"2CF271", x"2CD260", x"2CB26F", x"2C928E", x"2C72A4", x"2C529D", x"2C3277",
+         x"2C123F", x"2BF20E", x"2BD1F6", x"2BB1FF", x"2B921A", x"2B7232", x"2B5231", x"2B3212",
+         x"2B11DD", x"2AF1AA", x"2AD18E", x"2AB190", x"2A91A8", x"2A71C1", x"2A51C5", x"2A31AB",
+         x"2A117B", x"29F147", x"29D126", x"29B122", x"299136", x"29714F", x"295157", x"293143",
+         x"291117", x"28F0E4", x"28D0C0", x"28B0B6", x"2890C5", x"2870DD", x"2850E9", x"2830DB",
+         x"2810B3", x"27F081", x"27D059", x"27B04A", x"279055", x"27706B", x"27507A", x"273071",
+         x"27104E", x"26F01E", x"26CFF4", x"26AFE0", x"268FE5", x"266FFA", x"26500A", x"263006",
+         x"260FE9", x"25EFBB", x"25CF8F", x"25AF76", x"258F77", x"256F88", x"254F9A", x"252F9A",
+         x"250F82", x"24EF57", x"24CF2A", x"24AF0D", x"248F09", x"246F18", x"244F2A", x"242F2E",
+         x"240F1A", x"23EEF3", x"23CEC6", x"23AEA5", x"238E9C", x"236EA8", x"234EBA", x"232EC1",
+         x"230EB2", x"22EE8E", x"22CE61", x"22AE3E", x"228E30", x"226E38", x"224E49", x"222E53",
+         x"220E48", x"21EE28", x"21CDFD", x"21ADD8", x"218DC5", x"216DC9", x"214DD9", x"212DE5",
+         x"210DDE", x"20EDC2", x"20CD99", x"20AD71", x"208D5B", x"206D5B", x"204D68", x"202D76",
+         x"200D73", x"1FED5B", x"1FCD34", x"1FAD0C", x"1F8CF2", x"1F6CED", x"1F4CF9", x"1F2D06",
+         x"1F0D08", x"1EECF4", x"1ECCCF", x"1EACA6", x"1E8C89", x"1E6C80", x"1E4C89", x"1E2C97",
+         x"1E0C9B", x"1DEC8B", x"1DCC6A", x"1DAC41", x"1D8C21", x"1D6C14", x"1D4C1A", x"1D2C27",
+         x"1D0C2E", x"1CEC22", x"1CCC04", x"1CABDC", x"1C8BBA", x"1C6BA9", x"1C4BAB", x"1C2BB8",
+         x"1C0BC0", x"1BEBB9", x"1BCB9D", x"1BAB77", x"1B8B53", x"1B6B3E", x"1B4B3D", x"1B2B48",
+         x"1B0B52", x"1AEB4E", x"1ACB36", x"1AAB11", x"1A8AEC", x"1A6AD4", x"1A4ACF", x"1A2AD9",
+         x"1A0AE4", x"19EAE3", x"19CACF", x"19AAAC", x"198A86", x"196A6B", x"194A62", x"192A6A",
+         x"190A75", x"18EA77", x"18CA67", x"18AA46", x"188A20", x"186A02", x"1849F6", x"1829FB",
+         x"180A06", x"17EA0A", x"17C9FE", x"17A9E0", x"1789BA", x"17699A", x"17498B", x"17298C",
+         x"170997", x"16E99D", x"16C994", x"16A979", x"168955", x"166933", x"164920", x"16291E",
+         x"160928", x"15E930", x"15C92A", x"15A912", x"1588EF", x"1568CC", x"1548B6", x"1528B1",
+         x"1508B9", x"14E8C2", x"14C8BF", x"14A8AB", x"148889", x"146865", x"14484C", x"142844",
+         x"14084A", x"13E853", x"13C853", x"13A843", x"138823", x"1367FF", x"1347E3", x"1327D7",
+         x"1307DB", x"12E7E5", x"12C7E7", x"12A7DA", x"1287BD", x"126799", x"12477B", x"12276C",
+         x"12076D", x"11E776", x"11C77A", x"11A770", x"118756", x"116733", x"114713", x"112701",
+         x"1106FF", x"10E707", x"10C70D", x"10A706", x"1086EF", x"1066CD", x"1046AB", x"102696",
+         x"100691", x"0FE698", x"0FC6A0", x"0FA69C", x"0F8687", x"0F6667", x"0F4644", x"0F262C",
+         x"0F0624", x"0EE62A", x"0EC632", x"0EA631", x"0E861F", x"0E6600", x"0E45DE", x"0E25C3",
+         x"0E05B8", x"0DE5BB", x"0DC5C4", x"0DA5C5", x"0D85B7", x"0D659A", x"0D4577", x"0D255A",
+         x"0D054C", x"0CE54D", x"0CC555", x"0CA558", x"0C854E", x"0C6533", x"0C4511", x"0C24F2",
+         x"0C04E1", x"0BE4DF", x"0BC4E7", x"0BA4EC", x"0B84E4", x"0B64CC", x"0B44AB", x"0B248A",
+         x"0B0476", x"0AE472", x"0AC478", x"0AA47E", x"0A8479", x"0A6465", x"0A4444", x"0A2423",
+         x"0A040C", x"09E405", x"09C40A", x"09A411", x"09840E", x"0963FD", x"0943DE", x"0923BC",
+         x"0903A3", x"08E398", x"08C39B", x"08A3A3", x"0883A3", x"086394", x"084378", x"082355",
+         x"08033A", x"07E32C", x"07C32D", x"07A334", x"078337", x"07632B", x"074311", x"0722EF",
+         x"0702D1", x"06E2C1", x"06C2BF", x"06A2C6", x"0682CA", x"0662C2", x"0642AA", x"062289",
+         x"060269", x"05E256", x"05C252", x"05A258", x"05825D", x"056257", x"054242", x"052222",
+         x"050202", x"04E1EB", x"04C1E4", x"04A1E9", x"0481F0", x"0461ED", x"0441DA", x"0421BC",
+         x"04019A", x"03E182", x"03C178", x"03A17B", x"038182", x"036181", x"034172", x"032155",
+         x"030134", x"02E118", x"02C10B", x"02A10D", x"028114", x"026115", x"024109", x"0220EF",
+         x"0200CD", x"01E0B0", x"01C0A0", x"01A09F", x"0180A6", x"0160A9", x"0140A0", x"012088",
+         x"010066", x"00E048", x"00C035", x"00A031", x"008037", x"00603C", x"004036", x"002020",
+         x"000000", x"FFDFE0", x"FFBFCA", x"FF9FC4", x"FF7FC9", x"FF5FCF", x"FF3FCB", x"FF1FB8",
+         x"FEFF9A", x"FEDF78", x"FEBF60", x"FE9F57", x"FE7F5A", x"FE5F61", x"FE3F60", x"FE1F50",
+         x"FDFF33", x"FDDF11", x"FDBEF7", x"FD9EEB", x"FD7EEC", x"FD5EF3", x"FD3EF5", x"FD1EE8",
+         x"FCFECC", x"FCDEAB", x"FCBE8E", x"FC9E7F", x"FC7E7E", x"FC5E85", x"FC3E88", x"FC1E7E",
+         x"FBFE66", x"FBDE44", x"FBBE26", x"FB9E13", x"FB7E10", x"FB5E17", x"FB3E1C", x"FB1E15",
+         x"FAFDFE", x"FADDDE", x"FABDBE", x"FA9DA9", x"FA7DA3", x"FA5DA8", x"FA3DAE", x"FA1DAA",
+         x"F9FD97", x"F9DD77", x"F9BD56", x"F99D3E", x"F97D36", x"F95D3A", x"F93D41", x"F91D3F",
+         x"F8FD2F", x"F8DD11", x"F8BCEF", x"F89CD5", x"F87CC9", x"F85CCC", x"F83CD3", x"F81CD4",
+         x"F7FCC6", x"F7DCAB", x"F7BC88", x"F79C6C", x"F77C5D", x"F75C5D", x"F73C65", x"F71C68",
+         x"F6FC5D", x"F6DC44", x"F6BC22", x"F69C03", x"F67BF2", x"F65BEF", x"F63BF6", x"F61BFB",
+         x"F5FBF4", x"F5DBDD", x"F5BBBC", x"F59B9B", x"F57B87", x"F55B82", x"F53B88", x"F51B8E",
+         x"F4FB8A", x"F4DB76", x"F4BB55", x"F49B34", x"F47B1C", x"F45B14", x"F43B19", x"F41B21",
+         x"F3FB1F", x"F3DB0E", x"F3BAEF", x"F39ACD", x"F37AB2", x"F35AA8", x"F33AAB", x"F31AB3",
+         x"F2FAB4", x"F2DAA6", x"F2BA89", x"F29A66", x"F27A49", x"F25A3B", x"F23A3C", x"F21A45",
+         x"F1FA48", x"F1DA3D", x"F1BA22", x"F19A00", x"F179E1", x"F159CF", x"F139CE", x"F119D6",
+         x"F0F9DC", x"F0D9D4", x"F0B9BC", x"F09999", x"F07979", x"F05964", x"F03960", x"F01968",
+         x"EFF96F", x"EFD96A", x"EFB955", x"EF9933", x"EF7911", x"EF58FA", x"EF38F3", x"EF18F9",
+         x"EEF901", x"EED8FF", x"EEB8ED", x"EE98CD", x"EE78AA", x"EE5890", x"EE3886", x"EE188A",
+         x"EDF893", x"EDD894", x"EDB885", x"ED9867", x"ED7843", x"ED5826", x"ED3819", x"ED181B",
+         x"ECF825", x"ECD829", x"ECB81D", x"EC9801", x"EC77DD", x"EC57BD", x"EC37AD", x"EC17AD",
+         x"EBF7B6", x"EBD7BC", x"EBB7B4", x"EB979B", x"EB7777", x"EB5755", x"EB3741", x"EB173E",
+         x"EAF747", x"EAD74F", x"EAB74A", x"EA9734", x"EA7711", x"EA56EE", x"EA36D6", x"EA16D0",
+         x"E9F6D8", x"E9D6E2", x"E9B6E0", x"E996CD", x"E976AB", x"E95687", x"E9366C", x"E91663",
+         x"E8F669", x"E8D674", x"E8B675", x"E89666", x"E87646", x"E85620", x"E83602", x"E815F6",
+         x"E7F5FA", x"E7D605", x"E7B60A", x"E795FE", x"E775E0", x"E755BA", x"E73599", x"E71589",
+         x"E6F58B", x"E6D596", x"E6B59E", x"E69595", x"E6757A", x"E65554", x"E63531", x"E6151D",
+         x"E5F51C", x"E5D527", x"E5B531", x"E5952C", x"E57514", x"E554EF", x"E534CA", x"E514B2",
+         x"E4F4AE", x"E4D4B8", x"E4B4C3", x"E494C2", x"E474AD", x"E45489", x"E43463", x"E41447",
+         x"E3F440", x"E3D448", x"E3B455", x"E39457", x"E37446", x"E35424", x"E333FC", x"E313DE",
+         x"E2F3D2", x"E2D3D9", x"E2B3E6", x"E293EC", x"E273DF", x"E253BF", x"E23396", x"E21375",
+         x"E1F365", x"E1D369", x"E1B377", x"E19380", x"E17377", x"E1535A", x"E13331", x"E1130C",
+         x"E0F2F8", x"E0D2FA", x"E0B307", x"E09313", x"E0730E", x"E052F4", x"E032CC", x"E012A5",
+         x"DFF28D", x"DFD28A", x"DFB298", x"DF92A5", x"DF72A5", x"DF528F", x"DF3267", x"DF123E",
+         x"DEF222", x"DED21B", x"DEB227", x"DE9237", x"DE723B", x"DE5228", x"DE3203", x"DE11D8",
+         x"DDF1B8", x"DDD1AD", x"DDB1B7", x"DD91C8", x"DD71D0", x"DD51C2", x"DD319F", x"DD1172",
+         x"DCF14E", x"DCD13F", x"DCB146", x"DC9158", x"DC7164", x"DC515B", x"DC313A", x"DC110D",
+         x"DBF0E6", x"DBD0D2", x"DBB0D6", x"DB90E8", x"DB70F7", x"DB50F3", x"DB30D6", x"DB10A9",
+         x"DAF07E", x"DAD066", x"DAB066", x"DA9078", x"DA7089", x"DA508A", x"DA3071", x"DA1045",
+         x"D9F017", x"D9CFFA", x"D9AFF6", x"D99006", x"D9701B", x"D95020", x"D9300C", x"D90FE2",
+         x"D8EFB2", x"D8CF8F", x"D8AF86", x"D88F95", x"D86FAB", x"D84FB6", x"D82FA7", x"D80F7F",
+         x"D7EF4D", x"D7CF25", x"D7AF17", x"D78F23", x"D76F3B", x"D74F4A", x"D72F40", x"D70F1C",
+         x"D6EEE9", x"D6CEBD", x"D6AEA9", x"D68EB1", x"D66ECA", x"D64EDE", x"D62EDA", x"D60EB9",
+         x"D5EE85", x"D5CE55", x"D5AE3B", x"D58E3F", x"D56E58", x"D54E70", x"D52E72", x"D50E56",
+         x"D4EE23", x"D4CDEE", x"D4ADCF", x"D48DCE", x"D46DE6", x"D44E01", x"D42E0A", x"D40DF2",
+         x"D3EDC1", x"D3CD89", x"D3AD63", x"D38D5C", x"D36D72", x"D34D91", x"D32DA0", x"D30D8F",
+         x"D2ED60", x"D2CD25", x"D2ACF8", x"D28CEB", x"D26CFF", x"D24D20", x"D22D35", x"D20D2B",
+         x"D1ECFF", x"D1CCC2", x"D1AC8F", x"D18C7B", x"D16C8A", x"D14CAE", x"D12CC9", x"D10CC6",
+         x"D0EC9E", x"D0CC60", x"D0AC27", x"D08C0B", x"D06C16", x"D04C3A", x"D02C5C", x"D00C61",
+         x"CFEC3E", x"CFCBFF", x"CFABC0", x"CF8B9C", x"CF6BA1", x"CF4BC5", x"CF2BED", x"CF0BFA",
+         x"CEEBDE", x"CECBA0", x"CEAB5B", x"CE8B2E", x"CE6B2C", x"CE4B4F", x"CE2B7C", x"CE0B93",
+         x"CDEB7E", x"CDCB42", x"CDAAF8", x"CD8AC2", x"CD6AB7", x"CD4AD8", x"CD2B0A", x"CD0B2A",
+         x"CCEB1F", x"CCCAE5", x"CCAA96", x"CC8A56", x"CC6A42", x"CC4A5F", x"CC2A95", x"CC0AC0",
+         x"CBEABF", x"CBCA8A", x"CBAA37", x"CB89EC", x"CB69CD", x"CB49E5", x"CB2A1F", x"CB0A54",
+         x"CAEA5F", x"CACA30", x"CAA9DA", x"CA8985", x"CA6959", x"CA4969", x"CA29A6", x"CA09E6",
+         x"C9E9FE", x"C9C9D8", x"C9A980", x"C9891F", x"C968E5", x"C948EB", x"C9292A", x"C90976",
+         x"C8E99D", x"C8C982", x"C8A928", x"C888BC", x"C86871", x"C8486C", x"C828AA", x"C80903",
+         x"C7E93C", x"C7C92E", x"C7A8D5", x"C7885C", x"C767FD", x"C747E9", x"C72826", x"C7088C",
+         x"C6E8DB", x"C6C8DE", x"C6A888", x"C68800", x"C66789", x"C64762", x"C6279B", x"C60811",
+         x"C5E87A", x"C5C893", x"C5A842", x"C587A9", x"C56716", x"C546D4", x"C52707", x"C5078F",
+         x"C4E81A", x"C4C850", x"C4A808", x"C4875B", x"C466A1", x"C4463C", x"C42664", x"C40703",
+         x"C3E7BB", x"C3C81D", x"C3A7E2", x"C3871A", x"C36627", x"C3458D", x"C325A4", x"C30665",
+         x"C2E764", x"C2C80A", x"C2A7E5", x"C286F0", x"C265A1", x"C244AD", x"C224A6", x"C205A5",
+         x"C1E727", x"C1C84D", x"C1A84F", x"C186FA", x"C164E2", x"C14329", x"C122EC", x"C10499",
+         x"C0E780", x"C0CA02", x"C0AA47", x"C08753", x"C061F4", x"C03D19", x"C01D5A", x"C007B4"),
+        -- octave 3
+        (x"C00001", x"C003F0", x"C00F8C", x"C02243", x"C03B34", x"C0593E", x"C07B19", x"C09F75",
+         x"C0C50F", x"C0EACF", x"C10FD3", x"C13384", x"C15590", x"C175EE", x"C194D1", x"C1B298",
+         x"C1CFBD", x"C1ECC2", x"C20A1B", x"C22828", x"C24721", x"C2671B", x"C28803", x"C2A9A7",
+         x"C2CBBE", x"C2EDF5", x"C30FFB", x"C3318D", x"C3527D", x"C372B7", x"C39243", x"C3B140",
+         x"C3CFE0", x"C3EE61", x"C40D00", x"C42BF1", x"C44B5B", x"C46B52", x"C48BD2", x"C4ACC7",
+         x"C4CE0B", x"C4EF6E", x"C510C0", x"C531D4", x"C55288", x"C572CB", x"C5929B", x"C5B209",
+         x"C5D131", x"C5F039", x"C60F4C", x"C62E8D", x"C64E1C", x"C66E0A", x"C68E5A", x"C6AF00",
+         x"C6CFE5", x"C6F0E9", x"C711EA", x"C732C5", x"C75361", x"C773AB", x"C793A0", x"C7B349",
+         x"C7D2B7", x"C7F206", x"C81154", x"C830C0", x"C85061", x"C87049", x"C8907C", x"C8B0F4",
+         x"C8D1A3", x"C8F270", x"C91342", x"C933FD", x"C9548A", x"C974DA", x"C994E6", x"C9B4B3",
+         x"C9D44D", x"C9F3C8", x"CA133C", x"CA32C2", x"CA526F", x"CA7252", x"CA9271", x"CAB2CC",
+         x"CAD357", x"CAF400", x"CB14B3", x"CB3558", x"CB55DC", x"CB762F", x"CB964B", x"CBB631",
+         x"CBD5E9", x"CBF582", x"CC1511", x"CC34A9", x"CC545E", x"CC743E", x"CC9451", x"CCB496",
+         x"CCD507", x"CCF596", x"CD1632", x"CD36C7", x"CD5743", x"CD779A", x"CD97C1", x"CDB7B9",
+         x"CDD788", x"CDF738", x"CE16DB", x"CE3681", x"CE563D", x"CE761A", x"CE9623", x"CEB658",
+         x"CED6B6", x"CEF730", x"CF17BA", x"CF3843", x"CF58B9", x"CF7911", x"CF9941", x"CFB948",
+         x"CFD928", x"CFF8EA", x"D0189D", x"D0384F", x"D0580F", x"D077EC", x"D097ED", x"D0B815",
+         x"D0D863", x"D0F8CE", x"D11949", x"D139C7", x"D15A39", x"D17A91", x"D19AC8", x"D1BADA",
+         x"D1DAC8", x"D1FA99", x"D21A59", x"D23A15", x"D259DA", x"D279B6", x"D299B1", x"D2B9D0",
+         x"D2DA10", x"D2FA6D", x"D31ADD", x"D33B51", x"D35BBE", x"D37C18", x"D39C54", x"D3BC6F",
+         x"D3DC69", x"D3FC47", x"D41C12", x"D43BD6", x"D45BA0", x"D47B7C", x"D49B72", x"D4BB88",
+         x"D4DBBD", x"D4FC0F", x"D51C73", x"D53CE0", x"D55D49", x"D57DA2", x"D59DE3", x"D5BE05",
+         x"D5DE09", x"D5FDF2", x"D61DC7", x"D63D93", x"D65D61", x"D67D3D", x"D69D2F", x"D6BD3E",
+         x"D6DD6B", x"D6FDB2", x"D71E0D", x"D73E73", x"D75ED7", x"D77F30", x"D79F74", x"D7BF9D",
+         x"D7DFAA", x"D7FF9C", x"D81F7A", x"D83F4D", x"D85F1F", x"D87EFC", x"D89EEB", x"D8BEF4",
+         x"D8DF18", x"D8FF56", x"D91FA9", x"D94008", x"D96068", x"D980C1", x"D9A107", x"D9C136",
+         x"D9E14A", x"DA0145", x"DA212B", x"DA4104", x"DA60DB", x"DA80B8", x"DAA0A5", x"DAC0A9",
+         x"DAE0C6", x"DB00FC", x"DB2147", x"DB419F", x"DB61FC", x"DB8253", x"DBA29C", x"DBC2CF",
+         x"DBE2EA", x"DC02EC", x"DC22DA", x"DC42BA", x"DC6294", x"DC8272", x"DCA25E", x"DCC25D",
+         x"DCE274", x"DD02A3", x"DD22E7", x"DD4339", x"DD6392", x"DD83E7", x"DDA431", x"DDC469",
+         x"DDE48A", x"DE0493", x"DE2488", x"DE446D", x"DE644B", x"DE842B", x"DEA415", x"DEC411",
+         x"DEE422", x"DF044A", x"DF2488", x"DF44D4", x"DF6529", x"DF857D", x"DFA5C8", x"DFC603",
+         x"DFE629", x"E00639", x"E02634", x"E0461F", x"E06601", x"E085E3", x"E0A5CC", x"E0C5C4",
+         x"E0E5D1", x"E105F3", x"E1262A", x"E14671", x"E166C2", x"E18714", x"E1A760", x"E1C79D",
+         x"E1E7C8", x"E207DE", x"E227DF", x"E247CF", x"E267B5", x"E28799", x"E2A782", x"E2C778",
+         x"E2E780", x"E3079C", x"E327CD", x"E3480F", x"E3685C", x"E388AC", x"E3A8F8", x"E3C938",
+         x"E3E967", x"E40982", x"E42989", x"E4497F", x"E46969", x"E4894E", x"E4A937", x"E4C92B",
+         x"E4E92F", x"E50946", x"E52972", x"E549AE", x"E569F7", x"E58A45", x"E5AA91", x"E5CAD3",
+         x"E5EB06", x"E60B25", x"E62B32", x"E64B2D", x"E66B1B", x"E68B03", x"E6AAEC", x"E6CADE",
+         x"E6EADE", x"E70AF1", x"E72B17", x"E74B4E", x"E76B93", x"E78BDF", x"E7AC2A", x"E7CC6E",
+         x"E7ECA4", x"E80CC8", x"E82CDA", x"E84CDA", x"E86CCC", x"E88CB6", x"E8ACA0", x"E8CC91",
+         x"E8EC8E", x"E90C9C", x"E92CBD", x"E94CF0", x"E96D30", x"E98D79", x"E9ADC4", x"E9CE09",
+         x"E9EE42", x"EA0E6A", x"EA2E81", x"EA4E86", x"EA6E7C", x"EA8E69", x"EAAE54", x"EACE44",
+         x"EAEE3E", x"EB0E48", x"EB2E64", x"EB4E92", x"EB6ECF", x"EB8F15", x"EBAF5E", x"EBCFA4",
+         x"EBEFDF", x"EC100C", x"EC3027", x"EC5031", x"EC702B", x"EC901B", x"ECB007", x"ECCFF6",
+         x"ECEFEE", x"ED0FF5", x"ED300C", x"ED5035", x"ED706E", x"ED90B1", x"EDB0F9", x"EDD13F",
+         x"EDF17D", x"EE11AD", x"EE31CD", x"EE51DB", x"EE71D9", x"EE91CC", x"EEB1BA", x"EED1A9",
+         x"EEF19F", x"EF11A2", x"EF31B5", x"EF51D9", x"EF720E", x"EF924E", x"EFB294", x"EFD2DB",
+         x"EFF31A", x"F0134E", x"F03371", x"F05384", x"F07387", x"F0937D", x"F0B36C", x"F0D35B",
+         x"F0F34F", x"F1134F", x"F1335E", x"F1537E", x"F173AF", x"F193EC", x"F1B430", x"F1D476",
+         x"F1F4B7", x"F214EE", x"F23515", x"F2552C", x"F27533", x"F2952D", x"F2B51E", x"F2D50D",
+         x"F2F500", x"F314FD", x"F33509", x"F35524", x"F37550", x"F3958A", x"F3B5CC", x"F3D612",
+         x"F3F654", x"F4168D", x"F436B9", x"F456D4", x"F476DF", x"F496DC", x"F4B6CF", x"F4D6BF",
+         x"F4F6B1", x"F516AC", x"F536B3", x"F556CB", x"F576F3", x"F59729", x"F5B769", x"F5D7AE",
+         x"F5F7F1", x"F6182D", x"F6385C", x"F6587B", x"F6788A", x"F6988A", x"F6B880", x"F6D871",
+         x"F6F862", x"F7185B", x"F7385F", x"F75872", x"F77896", x"F798C9", x"F7B906", x"F7D94A",
+         x"F7F98E", x"F819CB", x"F839FE", x"F85A21", x"F87A34", x"F89A38", x"F8BA31", x"F8DA22",
+         x"F8FA13", x"F91A0A", x"F93A0B", x"F95A1B", x"F97A3A", x"F99A69", x"F9BAA4", x"F9DAE7",
+         x"F9FB2B", x"FA1B6A", x"FA3B9F", x"FA5BC6", x"FA7BDD", x"FA9BE5", x"FABBE1", x"FADBD4",
+         x"FAFBC5", x"FB1BB9", x"FB3BB8", x"FB5BC3", x"FB7BDF", x"FB9C0A", x"FBBC42", x"FBDC83",
+         x"FBFCC7", x"FC1D08", x"FC3D40", x"FC5D6B", x"FC7D86", x"FC9D92", x"FCBD90", x"FCDD85",
+         x"FCFD76", x"FD1D69", x"FD3D65", x"FD5D6D", x"FD7D85", x"FD9DAC", x"FDBDE1", x"FDDE20",
+         x"FDFE64", x"FE1EA6", x"FE3EE0", x"FE5F0F", x"FE7F2E", x"FE9F3E", x"FEBF3F", x"FEDF36",
+         x"FEFF27", x"FF1F1A", x"FF3F13", x"FF5F17", x"FF7F2B", x"FF9F4E", x"FFBF80", x"FFDFBD",
+         x"000000", x"002043", x"004080", x"0060B2", x"0080D5", x"00A0E9", x"00C0ED", x"00E0E6",
+         x"0100D9", x"0120CA", x"0140C1", x"0160C2", x"0180D2", x"01A0F1", x"01C120", x"01E15A",
+         x"02019C", x"0221E0", x"02421F", x"026254", x"02827B", x"02A293", x"02C29B", x"02E297",
+         x"03028A", x"03227B", x"034270", x"03626E", x"03827A", x"03A295", x"03C2C0", x"03E2F8",
+         x"040339", x"04237D", x"0443BE", x"0463F6", x"048421", x"04A43D", x"04C448", x"04E447",
+         x"05043B", x"05242C", x"05441F", x"05641B", x"058423", x"05A43A", x"05C461", x"05E496",
+         x"0604D5", x"062519", x"06455C", x"066597", x"0685C6", x"06A5E5", x"06C5F5", x"06E5F6",
+         x"0705ED", x"0725DE", x"0745CF", x"0765C8", x"0785CC", x"07A5DF", x"07C602", x"07E635",
+         x"080672", x"0826B6", x"0846FA", x"086737", x"08876A", x"08A78E", x"08C7A1", x"08E7A5",
+         x"09079E", x"09278F", x"094780", x"096776", x"098776", x"09A785", x"09C7A4", x"09E7D3",
+         x"0A080F", x"0A2852", x"0A4897", x"0A68D7", x"0A890D", x"0AA935", x"0AC94D", x"0AE954",
+         x"0B094F", x"0B2941", x"0B4931", x"0B6924", x"0B8921", x"0BA92C", x"0BC947", x"0BE973",
+         x"0C09AC", x"0C29EE", x"0C4A34", x"0C6A76", x"0C8AB0", x"0CAADC", x"0CCAF7", x"0CEB03",
+         x"0D0B00", x"0D2AF3", x"0D4AE2", x"0D6AD3", x"0D8ACD", x"0DAAD4", x"0DCAEB", x"0DEB12",
+         x"0E0B49", x"0E2B8A", x"0E4BD0", x"0E6C14", x"0E8C51", x"0EAC82", x"0ECCA2", x"0EECB1",
+         x"0F0CB1", x"0F2CA5", x"0F4C94", x"0F6C83", x"0F8C79", x"0FAC7C", x"0FCC8F", x"0FECB2",
+         x"100CE6", x"102D25", x"104D6C", x"106DB2", x"108DF2", x"10AE27", x"10CE4B", x"10EE5E",
+         x"110E61", x"112E57", x"114E46", x"116E34", x"118E27", x"11AE25", x"11CE33", x"11EE53",
+         x"120E83", x"122EC1", x"124F07", x"126F4F", x"128F92", x"12AFCB", x"12CFF4", x"12F00B",
+         x"131012", x"13300A", x"134FF9", x"136FE5", x"138FD5", x"13AFCF", x"13CFD9", x"13EFF4",
+         x"141021", x"14305C", x"1450A2", x"1470EB", x"149131", x"14B16E", x"14D19C", x"14F1B8",
+         x"1511C2", x"1531BC", x"1551AC", x"157197", x"159184", x"15B17A", x"15D17F", x"15F196",
+         x"1611BE", x"1631F7", x"16523C", x"167287", x"1692D0", x"16B310", x"16D343", x"16F364",
+         x"171372", x"17336F", x"175360", x"17734A", x"179334", x"17B326", x"17D326", x"17F338",
+         x"18135C", x"183392", x"1853D6", x"187421", x"18946D", x"18B4B2", x"18D4E9", x"18F50F",
+         x"191522", x"193522", x"195514", x"1974FD", x"1994E5", x"19B4D3", x"19D4CE", x"19F4DB",
+         x"1A14FA", x"1A352D", x"1A556F", x"1A75BB", x"1A9609", x"1AB652", x"1AD68E", x"1AF6BA",
+         x"1B16D1", x"1B36D5", x"1B56C9", x"1B76B2", x"1B9697", x"1BB681", x"1BD677", x"1BF67E",
+         x"1C1699", x"1C36C8", x"1C5708", x"1C7754", x"1C97A4", x"1CB7F1", x"1CD833", x"1CF864",
+         x"1D1880", x"1D3888", x"1D587E", x"1D7867", x"1D984B", x"1DB831", x"1DD821", x"1DF822",
+         x"1E1838", x"1E3863", x"1E58A0", x"1E78EC", x"1E993E", x"1EB98F", x"1ED9D6", x"1EFA0D",
+         x"1F1A2F", x"1F3A3C", x"1F5A34", x"1F7A1D", x"1F99FF", x"1FB9E1", x"1FD9CC", x"1FF9C7",
+         x"2019D7", x"2039FD", x"205A38", x"207A83", x"209AD7", x"20BB2C", x"20DB78", x"20FBB6",
+         x"211BDE", x"213BEF", x"215BEB", x"217BD5", x"219BB5", x"21BB93", x"21DB78", x"21FB6D",
+         x"221B76", x"223B97", x"225BCF", x"227C19", x"229C6E", x"22BCC7", x"22DD19", x"22FD5D",
+         x"231D8C", x"233DA3", x"235DA2", x"237D8E", x"239D6C", x"23BD46", x"23DD26", x"23FD14",
+         x"241D16", x"243D31", x"245D64", x"247DAD", x"249E04", x"24BE61", x"24DEB9", x"24FF04",
+         x"251F3A", x"253F57", x"255F5B", x"257F48", x"259F25", x"25BEFC", x"25DED5", x"25FEBB",
+         x"261EB6", x"263ECA", x"265EF9", x"267F3F", x"269F98", x"26BFF8", x"26E057", x"2700AA",
+         x"2720E8", x"27410C", x"276115", x"278104", x"27A0E1", x"27C0B3", x"27E086", x"280064",
+         x"282056", x"284063", x"28608C", x"2880D0", x"28A129", x"28C18D", x"28E1F3", x"29024E",
+         x"292295", x"2942C2", x"2962D1", x"2982C3", x"29A29F", x"29C26D", x"29E239", x"2A020E",
+         x"2A21F7", x"2A41FB", x"2A621D", x"2A825E", x"2AA2B7", x"2AC320", x"2AE38D", x"2B03F1",
+         x"2B2443", x"2B4478", x"2B648E", x"2B8484", x"2BA460", x"2BC42A", x"2BE3EE", x"2C03B9",
+         x"2C2397", x"2C4391", x"2C63AC", x"2C83E8", x"2CA442", x"2CC4AF", x"2CE523", x"2D0593",
+         x"2D25F0", x"2D4630", x"2D664F", x"2D864A", x"2DA626", x"2DC5EB", x"2DE5A7", x"2E0567",
+         x"2E2538", x"2E4526", x"2E6538", x"2E856F", x"2EA5C7", x"2EC639", x"2EE6B7", x"2F0732",
+         x"2F279D", x"2F47EB", x"2F6813", x"2F8814", x"2FA7F1", x"2FC7B1", x"2FE763", x"300716",
+         x"3026D8", x"3046B8", x"3066BF", x"3086EF", x"30A747", x"30C7BD", x"30E846", x"3108D0",
+         x"31294A", x"3149A8", x"3169DD", x"3189E6", x"31A9C3", x"31C97F", x"31E925", x"3208C8",
+         x"322878", x"324847", x"32683F", x"328866", x"32A8BD", x"32C939", x"32E9CE", x"330A6A",
+         x"332AF9", x"334B6A", x"336BAF", x"338BC2", x"33ABA2", x"33CB57", x"33EAEF", x"340A7E",
+         x"342A17", x"3449CF", x"3469B5", x"3489D1", x"34AA24", x"34CAA8", x"34EB4D", x"350C00",
+         x"352CA9", x"354D34", x"356D8F", x"358DAE", x"35AD91", x"35CD3E", x"35ECC4", x"360C38",
+         x"362BB3", x"364B4D", x"366B1A", x"368B26", x"36AB76", x"36CC03", x"36ECBE", x"370D90",
+         x"372E5D", x"374F0C", x"376F84", x"378FB7", x"37AF9F", x"37CF40", x"37EEAC", x"380DFA",
+         x"382D49", x"384CB7", x"386C60", x"388C55", x"38AC9F", x"38CD3B", x"38EE16", x"390F17",
+         x"39301B", x"395100", x"3971A6", x"3991F6", x"39B1E4", x"39D173", x"39F0B4", x"3A0FC7",
+         x"3A2ECF", x"3A4DF7", x"3A6D65", x"3A8D35", x"3AAD78", x"3ACE2C", x"3AEF40", x"3B1092",
+         x"3B31F5", x"3B5339", x"3B742E", x"3B94AE", x"3BB4A5", x"3BD40F", x"3BF300", x"3C119F",
+         x"3C3020", x"3C4EC0", x"3C6DBD", x"3C8D49", x"3CAD83", x"3CCE73", x"3CF005", x"3D120B",
+         x"3D3442", x"3D5659", x"3D77FD", x"3D98E5", x"3DB8DF", x"3DD7D8", x"3DF5E5", x"3E133E",
+         x"3E3043", x"3E4D68", x"3E6B2F", x"3E8A12", x"3EAA70", x"3ECC7C", x"3EF02D", x"3F1531",
+         x"3F3AF1", x"3F608B", x"3F84E7", x"3FA6C2", x"3FC4CC", x"3FDDBD", x"3FF074", x"3FFC10",
+         x"3FFFFF", x"3FFC10", x"3FF074", x"3FDDBD", x"3FC4CC", x"3FA6C2", x"3F84E7", x"3F608B",
+         x"3F3AF1", x"3F1531", x"3EF02D", x"3ECC7C", x"3EAA70", x"3E8A12", x"3E6B2F", x"3E4D68",
+         x"3E3043", x"3E133E", x"3DF5E5", x"3DD7D8", x"3DB8DF", x"3D98E5", x"3D77FD", x"3D5659",
+         x"3D3442", x"3D120B", x"3CF005", x"3CCE73", x"3CAD83", x"3C8D49", x"3C6DBD", x"3C4EC0",
+         x"3C3020", x"3C119F", x"3BF300", x"3BD40F", x"3BB4A5", x"3B94AE", x"3B742E", x"3B5339",
+         x"3B31F5", x"3B1092", x"3AEF40", x"3ACE2C", x"3AAD78", x"3A8D35", x"3A6D65", x"3A4DF7",
+         x"3A2ECF", x"3A0FC7", x"39F0B4", x"39D173", x"39B1E4", x"3991F6", x"3971A6", x"395100",
+         x"39301B", x"390F17", x"38EE16", x"38CD3B", x"38AC9F", x"388C55", x"386C60", x"384CB7",
+         x"382D49", x"380DFA", x"37EEAC", x"37CF40", x"37AF9F", x"378FB7", x"376F84", x"374F0C",
+         x"372E5D", x"370D90", x"36ECBE", x"36CC03", x"36AB76", x"368B26", x"366B1A", x"364B4D",
+         x"362BB3", x"360C38", x"35ECC4", x"35CD3E", x"35AD91", x"358DAE", x"356D8F", x"354D34",
+         x"352CA9", x"350C00", x"34EB4D", x"34CAA8", x"34AA24", x"3489D1", x"3469B5", x"3449CF",
+         x"342A17", x"340A7E", x"33EAEF", x"33CB57", x"33ABA2", x"338BC2", x"336BAF", x"334B6A",
+         x"332AF9", x"330A6A", x"32E9CE", x"32C939", x"32A8BD", x"328866", x"32683F", x"324847",
+         x"322878", x"3208C8", x"31E925", x"31C97F", x"31A9C3", x"3189E6", x"3169DD", x"3149A8",
+         x"31294A", x"3108D0", x"30E846", x"30C7BD", x"30A747", x"3086EF", x"3066BF", x"3046B8",
+         x"3026D8", x"300716", x"2FE763", x"2FC7B1", x"2FA7F1", x"2F8814", x"2F6813", x"2F47EB",
+         x"2F279D", x"2F0732", x"2EE6B7", x"2EC639", x"2EA5C7", x"2E856F", x"2E6538", x"2E4526",
+         x"2E2538", x"2E0567", x"2DE5A7", x"2DC5EB", x"2DA626", x"2D864A", x"2D664F", x"2D4630",
+         x"2D25F0", x"2D0593", x"2CE523", x"2CC4AF", x"2CA442", x"2C83E8", x"2C63AC", x"2C4391",
+         x"2C2397", x"2C03B9", x"2BE3EE", x"2BC42A", x"2BA460", x"2B8484", x"2B648E", x"2B4478",
+         x"2B2443", x"2B03F1", x"2AE38D", x"2AC320", x"2AA2B7", x"2A825E", x"2A621D", x"2A41FB",
+         x"2A21F7", x"2A020E", x"29E239", x"29C26D", x"29A29F", x"2982C3", x"2962D1", x"2942C2",
+         x"292295", x"29024E", x"28E1F3", x"28C18D", x"28A129", x"2880D0", x"28608C", x"284063",
+         x"282056", x"280064", x"27E086", x"27C0B3", x"27A0E1", x"278104", x"276115", x"27410C",
+         x"2720E8", x"2700AA", x"26E057", x"26BFF8", x"269F98", x"267F3F", x"265EF9", x"263ECA",
+         x"261EB6", x"25FEBB", x"25DED5", x"25BEFC", x"259F25", x"257F48", x"255F5B", x"253F57",
+         x"251F3A", x"24FF04", x"24DEB9", x"24BE61", x"249E04", x"247DAD", x"245D64", x"243D31",
+         x"241D16", x"23FD14", x"23DD26", x"23BD46", x"239D6C", x"237D8E", x"235DA2", x"233DA3",
+         x"231D8C", x"22FD5D", x"22DD19", x"22BCC7", x"229C6E", x"227C19", x"225BCF", x"223B97",
+         x"221B76", x"21FB6D", x"21DB78", x"21BB93", x"219BB5", x"217BD5", x"215BEB", x"213BEF",
+         x"211BDE", x"20FBB6", x"20DB78", x"20BB2C", x"209AD7", x"207A83", x"205A38", x"2039FD",
+         x"2019D7", x"1FF9C7", x"1FD9CC", x"1FB9E1", x"1F99FF", x"1F7A1D", x"1F5A34", x"1F3A3C",
+         x"1F1A2F", x"1EFA0D", x"1ED9D6", x"1EB98F", x"1E993E", x"1E78EC", x"1E58A0", x"1E3863",
+         x"1E1838", x"1DF822", x"1DD821", x"1DB831", x"1D984B", x"1D7867", x"1D587E", x"1D3888",
+         x"1D1880", x"1CF864", x"1CD833", x"1CB7F1", x"1C97A4", x"1C7754", x"1C5708", x"1C36C8",
+         x"1C1699", x"1BF67E", x"1BD677", x"1BB681", x"1B9697", x"1B76B2", x"1B56C9", x"1B36D5",
+         x"1B16D1", x"1AF6BA", x"1AD68E", x"1AB652", x"1A9609", x"1A75BB", x"1A556F", x"1A352D",
+         x"1A14FA", x"19F4DB", x"19D4CE", x"19B4D3", x"1994E5", x"1974FD", x"195514", x"193522",
+         x"191522", x"18F50F", x"18D4E9", x"18B4B2", x"18946D", x"187421", x"1853D6", x"183392",
+         x"18135C", x"17F338", x"17D326", x"17B326", x"179334", x"17734A", x"175360", x"17336F",
+         x"171372", x"16F364", x"16D343", x"16B310", x"1692D0", x"167287", x"16523C", x"1631F7",
+         x"1611BE", x"15F196", x"15D17F", x"15B17A", x"159184", x"157197", x"1551AC", x"1531BC",
+         x"1511C2", x"14F1B8", x"14D19C", x"14B16E", x"149131", x"1470EB", x"1450A2", x"14305C",
+         x"141021", x"13EFF4", x"13CFD9", x"13AFCF", x"138FD5", x"136FE5", x"134FF9", x"13300A",
+         x"131012", x"12F00B", x"12CFF4", x"12AFCB", x"128F92", x"126F4F", x"124F07", x"122EC1",
+         x"120E83", x"11EE53", x"11CE33", x"11AE25", x"118E27", x"116E34", x"114E46", x"112E57",
+         x"110E61", x"10EE5E", x"10CE4B", x"10AE27", x"108DF2", x"106DB2", x"104D6C", x"102D25",
+         x"100CE6", x"0FECB2", x"0FCC8F", x"0FAC7C", x"0F8C79", x"0F6C83", x"0F4C94", x"0F2CA5",
+         x"0F0CB1", x"0EECB1", x"0ECCA2", x"0EAC82", x"0E8C51", x"0E6C14", x"0E4BD0", x"0E2B8A",
+         x"0E0B49", x"0DEB12", x"0DCAEB", x"0DAAD4", x"0D8ACD", x"0D6AD3", x"0D4AE2", x"0D2AF3",
+         x"0D0B00", x"0CEB03", x"0CCAF7", x"0CAADC", x"0C8AB0", x"0C6A76", x"0C4A34", x"0C29EE",
+         x"0C09AC", x"0BE973", x"0BC947", x"0BA92C", x"0B8921", x"0B6924", x"0B4931", x"0B2941",
+         x"0B094F", x"0AE954", x"0AC94D", x"0AA935", x"0A890D", x"0A68D7", x"0A4897", x"0A2852",
+         x"0A080F", x"09E7D3", x"09C7A4", x"09A785", x"098776", x"096776", x"094780", x"09278F",
+         x"09079E", x"08E7A5", x"08C7A1", x"08A78E", x"08876A", x"086737", x"0846FA", x"0826B6",
+         x"080672", x"07E635", x"07C602", x"07A5DF", x"0785CC", x"0765C8", x"0745CF", x"0725DE",
+         x"0705ED", x"06E5F6", x"06C5F5", x"06A5E5", x"0685C6", x"066597", x"06455C", x"062519",
+         x"0604D5", x"05E496", x"05C461", x"05A43A", x"058423", x"05641B", x"05441F", x"05242C",
+         x"05043B", x"04E447", x"04C448", x"04A43D", x"048421", x"0463F6", x"0443BE", x"04237D",
+         x"040339", x"03E2F8", x"03C2C0", x"03A295", x"03827A", x"03626E", x"034270", x"03227B",
+         x"03028A", x"02E297", x"02C29B", x"02A293", x"02827B", x"026254", x"02421F", x"0221E0",
+         x"02019C", x"01E15A", x"01C120", x"01A0F1", x"0180D2", x"0160C2", x"0140C1", x"0120CA",
+         x"0100D9", x"00E0E6", x"00C0ED", x"00A0E9", x"0080D5", x"0060B2", x"004080", x"002043",
+         x"000000", x"FFDFBD", x"FFBF80", x"FF9F4E", x"FF7F2B", x"FF5F17", x"FF3F13", x"FF1F1A",
+         x"FEFF27", x"FEDF36", x"FEBF3F", x"FE9F3E", x"FE7F2E", x"FE5F0F", x"FE3EE0", x"FE1EA6",
+         x"FDFE64", x"FDDE20", x"FDBDE1", x"FD9DAC", x"FD7D85", x"FD5D6D", x"FD3D65", x"FD1D69",
+         x"FCFD76", x"FCDD85", x"FCBD90", x"FC9D92", x"FC7D86", x"FC5D6B", x"FC3D40", x"FC1D08",
+         x"FBFCC7", x"FBDC83", x"FBBC42", x"FB9C0A", x"FB7BDF", x"FB5BC3", x"FB3BB8", x"FB1BB9",
+         x"FAFBC5", x"FADBD4", x"FABBE1", x"FA9BE5", x"FA7BDD", x"FA5BC6", x"FA3B9F", x"FA1B6A",
+         x"F9FB2B", x"F9DAE7", x"F9BAA4", x"F99A69", x"F97A3A", x"F95A1B", x"F93A0B", x"F91A0A",
+         x"F8FA13", x"F8DA22", x"F8BA31", x"F89A38", x"F87A34", x"F85A21", x"F839FE", x"F819CB",
+         x"F7F98E", x"F7D94A", x"F7B906", x"F798C9", x"F77896", x"F75872", x"F7385F", x"F7185B",
+         x"F6F862", x"F6D871", x"F6B880", x"F6988A", x"F6788A", x"F6587B", x"F6385C", x"F6182D",
+         x"F5F7F1", x"F5D7AE", x"F5B769", x"F59729", x"F576F3", x"F556CB", x"F536B3", x"F516AC",
+         x"F4F6B1", x"F4D6BF", x"F4B6CF", x"F496DC", x"F476DF", x"F456D4", x"F436B9", x"F4168D",
+         x"F3F654", x"F3D612", x"F3B5CC", x"F3958A", x"F37550", x"F35524", x"F33509", x"F314FD",
+         x"F2F500", x"F2D50D", x"F2B51E", x"F2952D", x"F27533", x"F2552C", x"F23515", x"F214EE",
+         x"F1F4B7", x"F1D476", x"F1B430", x"F193EC", x"F173AF", x"F1537E", x"F1335E", x"F1134F",
+         x"F0F34F", x"F0D35B", x"F0B36C", x"F0937D", x"F07387", x"F05384", x"F03371", x"F0134E",
+         x"EFF31A", x"EFD2DB", x"EFB294", x"EF924E", x"EF720E", x"EF51D9", x"EF31B5", x"EF11A2",
+         x"EEF19F", x"EED1A9", x"EEB1BA", x"EE91CC", x"EE71D9", x"EE51DB", x"EE31CD", x"EE11AD",
+         x"EDF17D", x"EDD13F", x"EDB0F9", x"ED90B1", x"ED706E", x"ED5035", x"ED300C", x"ED0FF5",
+         x"ECEFEE", x"ECCFF6", x"ECB007", x"EC901B", x"EC702B", x"EC5031", x"EC3027", x"EC100C",
+         x"EBEFDF", x"EBCFA4", x"EBAF5E", x"EB8F15", x"EB6ECF", x"EB4E92", x"EB2E64", x"EB0E48",
+         x"EAEE3E", x"EACE44", x"EAAE54", x"EA8E69", x"EA6E7C", x"EA4E86", x"EA2E81", x"EA0E6A",
+         x"E9EE42", x"E9CE09", x"E9ADC4", x"E98D79", x"E96D30", x"E94CF0", x"E92CBD", x"E90C9C",
+         x"E8EC8E", x"E8CC91", x"E8ACA0", x"E88CB6", x"E86CCC", x"E84CDA", x"E82CDA", x"E80CC8",
+         x"E7ECA4", x"E7CC6E", x"E7AC2A", x"E78BDF", x"E76B93", x"E74B4E", x"E72B17", x"E70AF1",
+         x"E6EADE", x"E6CADE", x"E6AAEC", x"E68B03", x"E66B1B", x"E64B2D", x"E62B32", x"E60B25",
+         x"E5EB06", x"E5CAD3", x"E5AA91", x"E58A45", x"E569F7", x"E549AE", x"E52972", x"E50946",
+         x"E4E92F", x"E4C92B", x"E4A937", x"E4894E", x"E46969", x"E4497F", x"E42989", x"E40982",
+         x"E3E967", x"E3C938", x"E3A8F8", x"E388AC", x"E3685C", x"E3480F", x"E327CD", x"E3079C",
+         x"E2E780", x"E2C778", x"E2A782", x"E28799", x"E267B5", x"E247CF", x"E227DF", x"E207DE",
+         x"E1E7C8", x"E1C79D", x"E1A760", x"E18714", x"E166C2", x"E14671", x"E1262A", x"E105F3",
+         x"E0E5D1", x"E0C5C4", x"E0A5CC", x"E085E3", x"E06601", x"E0461F", x"E02634", x"E00639",
+         x"DFE629", x"DFC603", x"DFA5C8", x"DF857D", x"DF6529", x"DF44D4", x"DF2488", x"DF044A",
+         x"DEE422", x"DEC411", x"DEA415", x"DE842B", x"DE644B", x"DE446D", x"DE2488", x"DE0493",
+         x"DDE48A", x"DDC469", x"DDA431", x"DD83E7", x"DD6392", x"DD4339", x"DD22E7", x"DD02A3",
+         x"DCE274", x"DCC25D", x"DCA25E", x"DC8272", x"DC6294", x"DC42BA", x"DC22DA", x"DC02EC",
+         x"DBE2EA", x"DBC2CF", x"DBA29C", x"DB8253", x"DB61FC", x"DB419F", x"DB2147", x"DB00FC",
+         x"DAE0C6", x"DAC0A9", x"DAA0A5", x"DA80B8", x"DA60DB", x"DA4104", x"DA212B", x"DA0145",
+         x"D9E14A", x"D9C136", x"D9A107", x"D980C1", x"D96068", x"D94008", x"D91FA9", x"D8FF56",
+         x"D8DF18", x"D8BEF4", x"D89EEB", x"D87EFC", x"D85F1F", x"D83F4D", x"D81F7A", x"D7FF9C",
+         x"D7DFAA", x"D7BF9D", x"D79F74", x"D77F30", x"D75ED7", x"D73E73", x"D71E0D", x"D6FDB2",
+         x"D6DD6B", x"D6BD3E", x"D69D2F", x"D67D3D", x"D65D61", x"D63D93", x"D61DC7", x"D5FDF2",
+         x"D5DE09", x"D5BE05", x"D59DE3", x"D57DA2", x"D55D49", x"D53CE0", x"D51C73", x"D4FC0F",
+         x"D4DBBD", x"D4BB88", x"D49B72", x"D47B7C", x"D45BA0", x"D43BD6", x"D41C12", x"D3FC47",
+         x"D3DC69", x"D3BC6F", x"D39C54", x"D37C18", x"D35BBE", x"D33B51", x"D31ADD", x"D2FA6D",
+         x"D2DA10", x"D2B9D0", x"D299B1", x"D279B6", x"D259DA", x"D23A15", x"D21A59", x"D1FA99",
+         x"D1DAC8", x"D1BADA", x"D19AC8", x"D17A91", x"D15A39", x"D139C7", x"D11949", x"D0F8CE",
+         x"D0D863", x"D0B815", x"D097ED", x"D077EC", x"D0580F", x"D0384F", x"D0189D", x"CFF8EA",
+         x"CFD928", x"CFB948", x"CF9941", x"CF7911", x"CF58B9", x"CF3843", x"CF17BA", x"CEF730",
+         x"CED6B6", x"CEB658", x"CE9623", x"CE761A", x"CE563D", x"CE3681", x"CE16DB", x"CDF738",
+         x"CDD788", x"CDB7B9", x"CD97C1", x"CD779A", x"CD5743", x"CD36C7", x"CD1632", x"CCF596",
+         x"CCD507", x"CCB496", x"CC9451", x"CC743E", x"CC545E", x"CC34A9", x"CC1511", x"CBF582",
+         x"CBD5E9", x"CBB631", x"CB964B", x"CB762F", x"CB55DC", x"CB3558", x"CB14B3", x"CAF400",
+         x"CAD357", x"CAB2CC", x"CA9271", x"CA7252", x"CA526F", x"CA32C2", x"CA133C", x"C9F3C8",
+         x"C9D44D", x"C9B4B3", x"C994E6", x"C974DA", x"C9548A", x"C933FD", x"C91342", x"C8F270",
+         x"C8D1A3", x"C8B0F4", x"C8907C", x"C87049", x"C85061", x"C830C0", x"C81154", x"C7F206",
+         x"C7D2B7", x"C7B349", x"C793A0", x"C773AB", x"C75361", x"C732C5", x"C711EA", x"C6F0E9",
+         x"C6CFE5", x"C6AF00", x"C68E5A", x"C66E0A", x"C64E1C", x"C62E8D", x"C60F4C", x"C5F039",
+         x"C5D131", x"C5B209", x"C5929B", x"C572CB", x"C55288", x"C531D4", x"C510C0", x"C4EF6E",
+         x"C4CE0B", x"C4ACC7", x"C48BD2", x"C46B52", x"C44B5B", x"C42BF1", x"C40D00", x"C3EE61",
+         x"C3CFE0", x"C3B140", x"C39243", x"C372B7", x"C3527D", x"C3318D", x"C30FFB", x"C2EDF5",
+         x"C2CBBE", x"C2A9A7", x"C28803", x"C2671B", x"C24721", x"C22828", x"C20A1B", x"C1ECC2",
+         x"C1CFBD", x"C1B298", x"C194D1", x"C175EE", x"C15590", x"C13384", x"C10FD3", x"C0EACF",
+         x"C0C50F", x"C09F75", x"C07B19", x"C0593E", x"C03B34", x"C02243", x"C00F8C", x"C003F0"),
+        -- octave 4
+        (x"C00001", x"C001F4", x"C007C6", x"C01166", x"C01EB6", x"C02F8F", x"C043BD", x"C05B06",
+         x"C07527", x"C091D8", x"C0B0C9", x"C0D1AB", x"C0F42B", x"C117F7", x"C13CBD", x"C16230",
+         x"C18807", x"C1ADFF", x"C1D3DB", x"C1F967", x"C21E75", x"C242E3", x"C26695", x"C28979",
+         x"C2AB87", x"C2CCBC", x"C2ED21", x"C30CC1", x"C32BB0", x"C34A06", x"C367DE", x"C38557",
+         x"C3A290", x"C3BFA8", x"C3DCC0", x"C3F9F4", x"C4175E", x"C43516", x"C45330", x"C471B9",
+         x"C490BC", x"C4B03E", x"C4D040", x"C4F0BE", x"C511B0", x"C53309", x"C554BB", x"C576B5",
+         x"C598E3", x"C5BB31", x"C5DD8A", x"C5FFDA", x"C6220E", x"C64414", x"C665DE", x"C68760",
+         x"C6A88E", x"C6C965", x"C6E9E0", x"C70A01", x"C729CA", x"C74944", x"C76876", x"C7876E",
+         x"C7A637", x"C7C4E0", x"C7E37A", x"C80212", x"C820B8", x"C83F7A", x"C85E65", x"C87D83",
+         x"C89CDC", x"C8BC78", x"C8DC5A", x"C8FC83", x"C91CF2", x"C93DA3", x"C95E90", x"C97FB1",
+         x"C9A0FC", x"C9C266", x"C9E3E3", x"CA0568", x"CA26E7", x"CA4856", x"CA69A9", x"CA8AD7",
+         x"CAABD7", x"CACCA4", x"CAED39", x"CB0D94", x"CB2DB4", x"CB4D9D", x"CB6D51", x"CB8CD6",
+         x"CBAC34", x"CBCB73", x"CBEA9E", x"CC09BC", x"CC28DA", x"CC4801", x"CC673B", x"CC8690",
+         x"CCA607", x"CCC5A8", x"CCE577", x"CD0576", x"CD25A7", x"CD4609", x"CD6699", x"CD8754",
+         x"CDA834", x"CDC932", x"CDEA47", x"CE0B6A", x"CE2C92", x"CE4DB7", x"CE6ED0", x"CE8FD5",
+         x"CEB0BF", x"CED189", x"CEF22C", x"CF12A6", x"CF32F5", x"CF5319", x"CF7313", x"CF92E6",
+         x"CFB296", x"CFD228", x"CFF1A2", x"D0110D", x"D0306F", x"D04FCF", x"D06F37", x"D08EAC",
+         x"D0AE36", x"D0CDDB", x"D0ED9F", x"D10D86", x"D12D93", x"D14DC6", x"D16E1F", x"D18E9D",
+         x"D1AF3B", x"D1CFF7", x"D1F0CB", x"D211B0", x"D232A1", x"D25396", x"D27489", x"D29573",
+         x"D2B64D", x"D2D712", x"D2F7BD", x"D31849", x"D338B5", x"D358FF", x"D37926", x"D3992B",
+         x"D3B910", x"D3D8DA", x"D3F88B", x"D41829", x"D437BA", x"D45743", x"D476CB", x"D49659",
+         x"D4B5F2", x"D4D59B", x"D4F55B", x"D51533", x"D53529", x"D5553D", x"D57571", x"D595C4",
+         x"D5B636", x"D5D6C2", x"D5F767", x"D61820", x"D638E8", x"D659BA", x"D67A8F", x"D69B62",
+         x"D6BC2E", x"D6DCEE", x"D6FD9B", x"D71E33", x"D73EB2", x"D75F15", x"D77F5B", x"D79F84",
+         x"D7BF91", x"D7DF83", x"D7FF5D", x"D81F23", x"D83ED8", x"D85E82", x"D87E25", x"D89DC8",
+         x"D8BD6E", x"D8DD1E", x"D8FCDC", x"D91CAD", x"D93C93", x"D95C92", x"D97CAB", x"D99CDF",
+         x"D9BD2E", x"D9DD97", x"D9FE17", x"DA1EAD", x"DA3F53", x"DA6007", x"DA80C3", x"DAA183",
+         x"DAC241", x"DAE2F9", x"DB03A6", x"DB2444", x"DB44CF", x"DB6545", x"DB85A2", x"DBA5E6",
+         x"DBC611", x"DBE624", x"DC061F", x"DC2604", x"DC45D8", x"DC659E", x"DC8559", x"DCA50E",
+         x"DCC4C3", x"DCE47B", x"DD043B", x"DD2407", x"DD43E4", x"DD63D3", x"DD83D8", x"DDA3F4",
+         x"DDC428", x"DDE474", x"DE04D7", x"DE254E", x"DE45D9", x"DE6673", x"DE8718", x"DEA7C5",
+         x"DEC875", x"DEE925", x"DF09CE", x"DF2A6F", x"DF4B01", x"DF6B83", x"DF8BF2", x"DFAC4C",
+         x"DFCC8F", x"DFECBB", x"E00CD2", x"E02CD3", x"E04CC1", x"E06C9F", x"E08C70", x"E0AC38",
+         x"E0CBFB", x"E0EBBC", x"E10B81", x"E12B4D", x"E14B23", x"E16B08", x"E18AFE", x"E1AB08",
+         x"E1CB26", x"E1EB5A", x"E20BA3", x"E22C02", x"E24C73", x"E26CF5", x"E28D85", x"E2AE20",
+         x"E2CEC2", x"E2EF67", x"E3100B", x"E330AB", x"E35141", x"E371CC", x"E39247", x"E3B2B1",
+         x"E3D308", x"E3F34B", x"E41378", x"E43392", x"E45398", x"E4738C", x"E49372", x"E4B34C",
+         x"E4D31D", x"E4F2E9", x"E512B5", x"E53282", x"E55257", x"E57235", x"E59220", x"E5B21B",
+         x"E5D228", x"E5F248", x"E6127C", x"E632C3", x"E6531E", x"E6738A", x"E69406", x"E6B48F",
+         x"E6D522", x"E6F5BC", x"E71659", x"E736F4", x"E7578C", x"E7781C", x"E798A0", x"E7B917",
+         x"E7D97E", x"E7F9D2", x"E81A14", x"E83A43", x"E85A5E", x"E87A68", x"E89A62", x"E8BA4D",
+         x"E8DA2E", x"E8FA06", x"E919DA", x"E939AC", x"E95981", x"E9795C", x"E9993F", x"E9B92F",
+         x"E9D92E", x"E9F93D", x"EA195E", x"EA3991", x"EA59D7", x"EA7A2F", x"EA9A98", x"EABB0F",
+         x"EADB93", x"EAFC20", x"EB1CB3", x"EB3D4A", x"EB5DE0", x"EB7E71", x"EB9EFC", x"EBBF7C",
+         x"EBDFEF", x"EC0053", x"EC20A6", x"EC40E8", x"EC6117", x"EC8135", x"ECA141", x"ECC13F",
+         x"ECE12F", x"ED0114", x"ED20F2", x"ED40CB", x"ED60A3", x"ED807D", x"EDA05C", x"EDC044",
+         x"EDE038", x"EE0039", x"EE204A", x"EE406B", x"EE609E", x"EE80E3", x"EEA139", x"EEC19F",
+         x"EEE212", x"EF0292", x"EF231B", x"EF43A9", x"EF643B", x"EF84CC", x"EFA55A", x"EFC5E0",
+         x"EFE65D", x"F006CE", x"F02730", x"F04782", x"F067C4", x"F087F4", x"F0A813", x"F0C822",
+         x"F0E822", x"F10815", x"F127FE", x"F147E0", x"F167BD", x"F18798", x"F1A776", x"F1C759",
+         x"F1E744", x"F2073A", x"F2273D", x"F2474F", x"F26771", x"F287A4", x"F2A7E8", x"F2C83C",
+         x"F2E8A0", x"F30911", x"F3298D", x"F34A13", x"F36A9E", x"F38B2C", x"F3ABBA", x"F3CC45",
+         x"F3ECC8", x"F40D43", x"F42DB2", x"F44E13", x"F46E64", x"F48EA6", x"F4AED6", x"F4CEF7",
+         x"F4EF07", x"F50F09", x"F52EFF", x"F54EEB", x"F56ECF", x"F58EAF", x"F5AE8E", x"F5CE6E",
+         x"F5EE53", x"F60E41", x"F62E38", x"F64E3C", x"F66E4F", x"F68E71", x"F6AEA4", x"F6CEE7",
+         x"F6EF3A", x"F70F9C", x"F7300B", x"F75086", x"F77109", x"F79192", x"F7B21D", x"F7D2A9",
+         x"F7F332", x"F813B4", x"F8342D", x"F8549A", x"F874FB", x"F8954C", x"F8B58E", x"F8D5BF",
+         x"F8F5E0", x"F915F1", x"F935F5", x"F955ED", x"F975DA", x"F995C0", x"F9B5A2", x"F9D582",
+         x"F9F565", x"FA154B", x"FA353A", x"FA5532", x"FA7537", x"FA954A", x"FAB56C", x"FAD59F",
+         x"FAF5E1", x"FB1633", x"FB3694", x"FB5702", x"FB777B", x"FB97FD", x"FBB884", x"FBD90F",
+         x"FBF999", x"FC1A20", x"FC3AA2", x"FC5B1A", x"FC7B87", x"FC9BE7", x"FCBC39", x"FCDC7A",
+         x"FCFCAC", x"FD1CCD", x"FD3CE0", x"FD5CE4", x"FD7CDD", x"FD9CCB", x"FDBCB3", x"FDDC95",
+         x"FDFC77", x"FE1C5A", x"FE3C41", x"FE5C30", x"FE7C29", x"FE9C2E", x"FEBC40", x"FEDC62",
+         x"FEFC94", x"FF1CD6", x"FF3D28", x"FF5D88", x"FF7DF6", x"FF9E6E", x"FFBEEF", x"FFDF76",
+         x"000000", x"00208A", x"004111", x"006192", x"00820A", x"00A278", x"00C2D8", x"00E32A",
+         x"01036C", x"01239E", x"0143C0", x"0163D2", x"0183D7", x"01A3D0", x"01C3BF", x"01E3A6",
+         x"020389", x"02236B", x"02434D", x"026335", x"028323", x"02A31C", x"02C320", x"02E333",
+         x"030354", x"032386", x"0343C7", x"036419", x"038479", x"03A4E6", x"03C55E", x"03E5E0",
+         x"040667", x"0426F1", x"04477C", x"046803", x"048885", x"04A8FE", x"04C96C", x"04E9CD",
+         x"050A1F", x"052A61", x"054A94", x"056AB6", x"058AC9", x"05AACE", x"05CAC6", x"05EAB5",
+         x"060A9B", x"062A7E", x"064A5E", x"066A40", x"068A26", x"06AA13", x"06CA0B", x"06EA0F",
+         x"070A20", x"072A41", x"074A72", x"076AB4", x"078B05", x"07AB66", x"07CBD3", x"07EC4C",
+         x"080CCE", x"082D57", x"084DE3", x"086E6E", x"088EF7", x"08AF7A", x"08CFF5", x"08F064",
+         x"0910C6", x"093119", x"09515C", x"09718F", x"0991B1", x"09B1C4", x"09D1C8", x"09F1BF",
+         x"0A11AD", x"0A3192", x"0A5172", x"0A7151", x"0A9131", x"0AB115", x"0AD101", x"0AF0F7",
+         x"0B10F9", x"0B3109", x"0B512A", x"0B715A", x"0B919C", x"0BB1ED", x"0BD24E", x"0BF2BD",
+         x"0C1338", x"0C33BB", x"0C5446", x"0C74D4", x"0C9562", x"0CB5ED", x"0CD673", x"0CF6EF",
+         x"0D1760", x"0D37C4", x"0D5818", x"0D785C", x"0D988F", x"0DB8B1", x"0DD8C3", x"0DF8C6",
+         x"0E18BC", x"0E38A7", x"0E588A", x"0E7868", x"0E9843", x"0EB820", x"0ED802", x"0EF7EB",
+         x"0F17DE", x"0F37DE", x"0F57ED", x"0F780C", x"0F983C", x"0FB87E", x"0FD8D0", x"0FF932",
+         x"1019A3", x"103A20", x"105AA6", x"107B34", x"109BC5", x"10BC57", x"10DCE5", x"10FD6E",
+         x"111DEE", x"113E61", x"115EC7", x"117F1D", x"119F62", x"11BF95", x"11DFB6", x"11FFC7",
+         x"121FC8", x"123FBC", x"125FA4", x"127F83", x"129F5D", x"12BF35", x"12DF0E", x"12FEEC",
+         x"131ED1", x"133EC1", x"135EBF", x"137ECB", x"139EE9", x"13BF18", x"13DF5A", x"13FFAD",
+         x"142011", x"144084", x"146104", x"14818F", x"14A220", x"14C2B6", x"14E34D", x"1503E0",
+         x"15246D", x"1544F1", x"156568", x"1585D1", x"15A629", x"15C66F", x"15E6A2", x"1606C3",
+         x"1626D2", x"1646D1", x"1666C1", x"1686A4", x"16A67F", x"16C654", x"16E626", x"1705FA",
+         x"1725D2", x"1745B3", x"17659E", x"178598", x"17A5A2", x"17C5BD", x"17E5EC", x"18062E",
+         x"182682", x"1846E9", x"186760", x"1887E4", x"18A874", x"18C90C", x"18E9A7", x"190A44",
+         x"192ADE", x"194B71", x"196BFA", x"198C76", x"19ACE2", x"19CD3D", x"19ED84", x"1A0DB8",
+         x"1A2DD8", x"1A4DE5", x"1A6DE0", x"1A8DCB", x"1AADA9", x"1ACD7E", x"1AED4B", x"1B0D17",
+         x"1B2CE3", x"1B4CB4", x"1B6C8E", x"1B8C74", x"1BAC68", x"1BCC6E", x"1BEC88", x"1C0CB5",
+         x"1C2CF8", x"1C4D4F", x"1C6DB9", x"1C8E34", x"1CAEBF", x"1CCF55", x"1CEFF5", x"1D1099",
+         x"1D313E", x"1D51E0", x"1D727B", x"1D930B", x"1DB38D", x"1DD3FE", x"1DF45D", x"1E14A6",
+         x"1E34DA", x"1E54F8", x"1E7502", x"1E94F8", x"1EB4DD", x"1ED4B3", x"1EF47F", x"1F1444",
+         x"1F3405", x"1F53C8", x"1F7390", x"1F9361", x"1FB33F", x"1FD32D", x"1FF32E", x"201345",
+         x"203371", x"2053B4", x"20740E", x"20947D", x"20B4FF", x"20D591", x"20F632", x"2116DB",
+         x"21378B", x"21583B", x"2178E8", x"21998D", x"21BA27", x"21DAB2", x"21FB29", x"221B8C",
+         x"223BD8", x"225C0C", x"227C28", x"229C2D", x"22BC1C", x"22DBF9", x"22FBC5", x"231B85",
+         x"233B3D", x"235AF2", x"237AA7", x"239A62", x"23BA28", x"23D9FC", x"23F9E1", x"2419DC",
+         x"2439EF", x"245A1A", x"247A5E", x"249ABB", x"24BB31", x"24DBBC", x"24FC5A", x"251D07",
+         x"253DBF", x"255E7D", x"257F3D", x"259FF9", x"25C0AD", x"25E153", x"2601E9", x"262269",
+         x"2642D2", x"266321", x"268355", x"26A36E", x"26C36D", x"26E353", x"270324", x"2722E2",
+         x"274292", x"276238", x"2781DB", x"27A17E", x"27C128", x"27E0DD", x"2800A3", x"28207D",
+         x"28406F", x"28607C", x"2880A5", x"28A0EB", x"28C14E", x"28E1CD", x"290265", x"292312",
+         x"2943D2", x"29649E", x"298571", x"29A646", x"29C718", x"29E7E0", x"2A0899", x"2A293E",
+         x"2A49CA", x"2A6A3C", x"2A8A8F", x"2AAAC3", x"2ACAD7", x"2AEACD", x"2B0AA5", x"2B2A65",
+         x"2B4A0E", x"2B69A7", x"2B8935", x"2BA8BD", x"2BC846", x"2BE7D7", x"2C0775", x"2C2726",
+         x"2C46F0", x"2C66D5", x"2C86DA", x"2CA701", x"2CC74B", x"2CE7B7", x"2D0843", x"2D28EE",
+         x"2D49B3", x"2D6A8D", x"2D8B77", x"2DAC6A", x"2DCD5F", x"2DEE50", x"2E0F35", x"2E3009",
+         x"2E50C5", x"2E7163", x"2E91E1", x"2EB23A", x"2ED26D", x"2EF27A", x"2F1261", x"2F3225",
+         x"2F51CA", x"2F7154", x"2F90C9", x"2FB031", x"2FCF91", x"2FEEF3", x"300E5E", x"302DD8",
+         x"304D6A", x"306D1A", x"308CED", x"30ACE7", x"30CD0B", x"30ED5A", x"310DD4", x"312E77",
+         x"314F41", x"31702B", x"319130", x"31B249", x"31D36E", x"31F496", x"3215B9", x"3236CE",
+         x"3257CC", x"3278AC", x"329967", x"32B9F7", x"32DA59", x"32FA8A", x"331A89", x"333A58",
+         x"3359F9", x"337970", x"3398C5", x"33B7FF", x"33D726", x"33F644", x"341562", x"34348D",
+         x"3453CC", x"34732A", x"3492AF", x"34B263", x"34D24C", x"34F26C", x"3512C7", x"35335C",
+         x"355429", x"357529", x"359657", x"35B7AA", x"35D919", x"35FA98", x"361C1D", x"363D9A",
+         x"365F04", x"36804F", x"36A170", x"36C25D", x"36E30E", x"37037D", x"3723A6", x"374388",
+         x"376324", x"37827D", x"37A19B", x"37C086", x"37DF48", x"37FDEE", x"381C86", x"383B20",
+         x"3859C9", x"387892", x"38978A", x"38B6BC", x"38D636", x"38F5FF", x"391620", x"39369B",
+         x"395772", x"3978A0", x"399A22", x"39BBEC", x"39DDF2", x"3A0026", x"3A2276", x"3A44CF",
+         x"3A671D", x"3A894B", x"3AAB45", x"3ACCF7", x"3AEE50", x"3B0F42", x"3B2FC0", x"3B4FC2",
+         x"3B6F44", x"3B8E47", x"3BACD0", x"3BCAEA", x"3BE8A2", x"3C060C", x"3C2340", x"3C4058",
+         x"3C5D70", x"3C7AA9", x"3C9822", x"3CB5FA", x"3CD450", x"3CF33F", x"3D12DF", x"3D3344",
+         x"3D5479", x"3D7687", x"3D996B", x"3DBD1D", x"3DE18B", x"3E0699", x"3E2C25", x"3E5201",
+         x"3E77F9", x"3E9DD0", x"3EC343", x"3EE809", x"3F0BD5", x"3F2E55", x"3F4F37", x"3F6E28",
+         x"3F8AD9", x"3FA4FA", x"3FBC43", x"3FD071", x"3FE14A", x"3FEE9A", x"3FF83A", x"3FFE0C",
+         x"3FFFFF", x"3FFE0C", x"3FF83A", x"3FEE9A", x"3FE14A", x"3FD071", x"3FBC43", x"3FA4FA",
+         x"3F8AD9", x"3F6E28", x"3F4F37", x"3F2E55", x"3F0BD5", x"3EE809", x"3EC343", x"3E9DD0",
+         x"3E77F9", x"3E5201", x"3E2C25", x"3E0699", x"3DE18B", x"3DBD1D", x"3D996B", x"3D7687",
+         x"3D5479", x"3D3344", x"3D12DF", x"3CF33F", x"3CD450", x"3CB5FA", x"3C9822", x"3C7AA9",
+         x"3C5D70", x"3C4058", x"3C2340", x"3C060C", x"3BE8A2", x"3BCAEA", x"3BACD0", x"3B8E47",
+         x"3B6F44", x"3B4FC2", x"3B2FC0", x"3B0F42", x"3AEE50", x"3ACCF7", x"3AAB45", x"3A894B",
+         x"3A671D", x"3A44CF", x"3A2276", x"3A0026", x"39DDF2", x"39BBEC", x"399A22", x"3978A0",
+         x"395772", x"39369B", x"391620", x"38F5FF", x"38D636", x"38B6BC", x"38978A", x"387892",
+         x"3859C9", x"383B20", x"381C86", x"37FDEE", x"37DF48", x"37C086", x"37A19B", x"37827D",
+         x"376324", x"374388", x"3723A6", x"37037D", x"36E30E", x"36C25D", x"36A170", x"36804F",
+         x"365F04", x"363D9A", x"361C1D", x"35FA98", x"35D919", x"35B7AA", x"359657", x"357529",
+         x"355429", x"35335C", x"3512C7", x"34F26C", x"34D24C", x"34B263", x"3492AF", x"34732A",
+         x"3453CC", x"34348D", x"341562", x"33F644", x"33D726", x"33B7FF", x"3398C5", x"337970",
+         x"3359F9", x"333A58", x"331A89", x"32FA8A", x"32DA59", x"32B9F7", x"329967", x"3278AC",
+         x"3257CC", x"3236CE", x"3215B9", x"31F496", x"31D36E", x"31B249", x"319130", x"31702B",
+         x"314F41", x"312E77", x"310DD4", x"30ED5A", x"30CD0B", x"30ACE7", x"308CED", x"306D1A",
+         x"304D6A", x"302DD8", x"300E5E", x"2FEEF3", x"2FCF91", x"2FB031", x"2F90C9", x"2F7154",
+         x"2F51CA", x"2F3225", x"2F1261", x"2EF27A", x"2ED26D", x"2EB23A", x"2E91E1", x"2E7163",
+         x"2E50C5", x"2E3009", x"2E0F35", x"2DEE50", x"2DCD5F", x"2DAC6A", x"2D8B77", x"2D6A8D",
+         x"2D49B3", x"2D28EE", x"2D0843", x"2CE7B7", x"2CC74B", x"2CA701", x"2C86DA", x"2C66D5",
+         x"2C46F0", x"2C2726", x"2C0775", x"2BE7D7", x"2BC846", x"2BA8BD", x"2B8935", x"2B69A7",
+         x"2B4A0E", x"2B2A65", x"2B0AA5", x"2AEACD", x"2ACAD7", x"2AAAC3", x"2A8A8F", x"2A6A3C",
+         x"2A49CA", x"2A293E", x"2A0899", x"29E7E0", x"29C718", x"29A646", x"298571", x"29649E",
+         x"2943D2", x"292312", x"290265", x"28E1CD", x"28C14E", x"28A0EB", x"2880A5", x"28607C",
+         x"28406F", x"28207D", x"2800A3", x"27E0DD", x"27C128", x"27A17E", x"2781DB", x"276238",
+         x"274292", x"2722E2", x"270324", x"26E353", x"26C36D", x"26A36E", x"268355", x"266321",
+         x"2642D2", x"262269", x"2601E9", x"25E153", x"25C0AD", x"259FF9", x"257F3D", x"255E7D",
+         x"253DBF", x"251D07", x"24FC5A", x"24DBBC", x"24BB31", x"249ABB", x"247A5E", x"245A1A",
+         x"2439EF", x"2419DC", x"23F9E1", x"23D9FC", x"23BA28", x"239A62", x"237AA7", x"235AF2",
+         x"233B3D", x"231B85", x"22FBC5", x"22DBF9", x"22BC1C", x"229C2D", x"227C28", x"225C0C",
+         x"223BD8", x"221B8C", x"21FB29", x"21DAB2", x"21BA27", x"21998D", x"2178E8", x"21583B",
+         x"21378B", x"2116DB", x"20F632", x"20D591", x"20B4FF", x"20947D", x"20740E", x"2053B4",
+         x"203371", x"201345", x"1FF32E", x"1FD32D", x"1FB33F", x"1F9361", x"1F7390", x"1F53C8",
+         x"1F3405", x"1F1444", x"1EF47F", x"1ED4B3", x"1EB4DD", x"1E94F8", x"1E7502", x"1E54F8",
+         x"1E34DA", x"1E14A6", x"1DF45D", x"1DD3FE", x"1DB38D", x"1D930B", x"1D727B", x"1D51E0",
+         x"1D313E", x"1D1099", x"1CEFF5", x"1CCF55", x"1CAEBF", x"1C8E34", x"1C6DB9", x"1C4D4F",
+         x"1C2CF8", x"1C0CB5", x"1BEC88", x"1BCC6E", x"1BAC68", x"1B8C74", x"1B6C8E", x"1B4CB4",
+         x"1B2CE3", x"1B0D17", x"1AED4B", x"1ACD7E", x"1AADA9", x"1A8DCB", x"1A6DE0", x"1A4DE5",
+         x"1A2DD8", x"1A0DB8", x"19ED84", x"19CD3D", x"19ACE2", x"198C76", x"196BFA", x"194B71",
+         x"192ADE", x"190A44", x"18E9A7", x"18C90C", x"18A874", x"1887E4", x"186760", x"1846E9",
+         x"182682", x"18062E", x"17E5EC", x"17C5BD", x"17A5A2", x"178598", x"17659E", x"1745B3",
+         x"1725D2", x"1705FA", x"16E626", x"16C654", x"16A67F", x"1686A4", x"1666C1", x"1646D1",
+         x"1626D2", x"1606C3", x"15E6A2", x"15C66F", x"15A629", x"1585D1", x"156568", x"1544F1",
+         x"15246D", x"1503E0", x"14E34D", x"14C2B6", x"14A220", x"14818F", x"146104", x"144084",
+         x"142011", x"13FFAD", x"13DF5A", x"13BF18", x"139EE9", x"137ECB", x"135EBF", x"133EC1",
+         x"131ED1", x"12FEEC", x"12DF0E", x"12BF35", x"129F5D", x"127F83", x"125FA4", x"123FBC",
+         x"121FC8", x"11FFC7", x"11DFB6", x"11BF95", x"119F62", x"117F1D", x"115EC7", x"113E61",
+         x"111DEE", x"10FD6E", x"10DCE5", x"10BC57", x"109BC5", x"107B34", x"105AA6", x"103A20",
+         x"1019A3", x"0FF932", x"0FD8D0", x"0FB87E", x"0F983C", x"0F780C", x"0F57ED", x"0F37DE",
+         x"0F17DE", x"0EF7EB", x"0ED802", x"0EB820", x"0E9843", x"0E7868", x"0E588A", x"0E38A7",
+         x"0E18BC", x"0DF8C6", x"0DD8C3", x"0DB8B1", x"0D988F", x"0D785C", x"0D5818", x"0D37C4",
+         x"0D1760", x"0CF6EF", x"0CD673", x"0CB5ED", x"0C9562", x"0C74D4", x"0C5446", x"0C33BB",
+         x"0C1338", x"0BF2BD", x"0BD24E", x"0BB1ED", x"0B919C", x"0B715A", x"0B512A", x"0B3109",
+         x"0B10F9", x"0AF0F7", x"0AD101", x"0AB115", x"0A9131", x"0A7151", x"0A5172", x"0A3192",
+         x"0A11AD", x"09F1BF", x"09D1C8", x"09B1C4", x"0991B1", x"09718F", x"09515C", x"093119",
+         x"0910C6", x"08F064", x"08CFF5", x"08AF7A", x"088EF7", x"086E6E", x"084DE3", x"082D57",
+         x"080CCE", x"07EC4C", x"07CBD3", x"07AB66", x"078B05", x"076AB4", x"074A72", x"072A41",
+         x"070A20", x"06EA0F", x"06CA0B", x"06AA13", x"068A26", x"066A40", x"064A5E", x"062A7E",
+         x"060A9B", x"05EAB5", x"05CAC6", x"05AACE", x"058AC9", x"056AB6", x"054A94", x"052A61",
+         x"050A1F", x"04E9CD", x"04C96C", x"04A8FE", x"048885", x"046803", x"04477C", x"0426F1",
+         x"040667", x"03E5E0", x"03C55E", x"03A4E6", x"038479", x"036419", x"0343C7", x"032386",
+         x"030354", x"02E333", x"02C320", x"02A31C", x"028323", x"026335", x"02434D", x"02236B",
+         x"020389", x"01E3A6", x"01C3BF", x"01A3D0", x"0183D7", x"0163D2", x"0143C0", x"01239E",
+         x"01036C", x"00E32A", x"00C2D8", x"00A278", x"00820A", x"006192", x"004111", x"00208A",
+         x"000000", x"FFDF76", x"FFBEEF", x"FF9E6E", x"FF7DF6", x"FF5D88", x"FF3D28", x"FF1CD6",
+         x"FEFC94", x"FEDC62", x"FEBC40", x"FE9C2E", x"FE7C29", x"FE5C30", x"FE3C41", x"FE1C5A",
+         x"FDFC77", x"FDDC95", x"FDBCB3", x"FD9CCB", x"FD7CDD", x"FD5CE4", x"FD3CE0", x"FD1CCD",
+         x"FCFCAC", x"FCDC7A", x"FCBC39", x"FC9BE7", x"FC7B87", x"FC5B1A", x"FC3AA2", x"FC1A20",
+         x"FBF999", x"FBD90F", x"FBB884", x"FB97FD", x"FB777B", x"FB5702", x"FB3694", x"FB1633",
+         x"FAF5E1", x"FAD59F", x"FAB56C", x"FA954A", x"FA7537", x"FA5532", x"FA353A", x"FA154B",
+         x"F9F565", x"F9D582", x"F9B5A2", x"F995C0", x"F975DA", x"F955ED", x"F935F5", x"F915F1",
+         x"F8F5E0", x"F8D5BF", x"F8B58E", x"F8954C", x"F874FB", x"F8549A", x"F8342D", x"F813B4",
+         x"F7F332", x"F7D2A9", x"F7B21D", x"F79192", x"F77109", x"F75086", x"F7300B", x"F70F9C",
+         x"F6EF3A", x"F6CEE7", x"F6AEA4", x"F68E71", x"F66E4F", x"F64E3C", x"F62E38", x"F60E41",
+         x"F5EE53", x"F5CE6E", x"F5AE8E", x"F58EAF", x"F56ECF", x"F54EEB", x"F52EFF", x"F50F09",
+         x"F4EF07", x"F4CEF7", x"F4AED6", x"F48EA6", x"F46E64", x"F44E13", x"F42DB2", x"F40D43",
+         x"F3ECC8", x"F3CC45", x"F3ABBA", x"F38B2C", x"F36A9E", x"F34A13", x"F3298D", x"F30911",
+         x"F2E8A0", x"F2C83C", x"F2A7E8", x"F287A4", x"F26771", x"F2474F", x"F2273D", x"F2073A",
+         x"F1E744", x"F1C759", x"F1A776", x"F18798", x"F167BD", x"F147E0", x"F127FE", x"F10815",
+         x"F0E822", x"F0C822", x"F0A813", x"F087F4", x"F067C4", x"F04782", x"F02730", x"F006CE",
+         x"EFE65D", x"EFC5E0", x"EFA55A", x"EF84CC", x"EF643B", x"EF43A9", x"EF231B", x"EF0292",
+         x"EEE212", x"EEC19F", x"EEA139", x"EE80E3", x"EE609E", x"EE406B", x"EE204A", x"EE0039",
+         x"EDE038", x"EDC044", x"EDA05C", x"ED807D", x"ED60A3", x"ED40CB", x"ED20F2", x"ED0114",
+         x"ECE12F", x"ECC13F", x"ECA141", x"EC8135", x"EC6117", x"EC40E8", x"EC20A6", x"EC0053",
+         x"EBDFEF", x"EBBF7C", x"EB9EFC", x"EB7E71", x"EB5DE0", x"EB3D4A", x"EB1CB3", x"EAFC20",
+         x"EADB93", x"EABB0F", x"EA9A98", x"EA7A2F", x"EA59D7", x"EA3991", x"EA195E", x"E9F93D",
+         x"E9D92E", x"E9B92F", x"E9993F", x"E9795C", x"E95981", x"E939AC", x"E919DA", x"E8FA06",
+         x"E8DA2E", x"E8BA4D", x"E89A62", x"E87A68", x"E85A5E", x"E83A43", x"E81A14", x"E7F9D2",
+         x"E7D97E", x"E7B917", x"E798A0", x"E7781C", x"E7578C", x"E736F4", x"E71659", x"E6F5BC",
+         x"E6D522", x"E6B48F", x"E69406", x"E6738A", x"E6531E", x"E632C3", x"E6127C", x"E5F248",
+         x"E5D228", x"E5B21B", x"E59220", x"E57235", x"E55257", x"E53282", x"E512B5", x"E4F2E9",
+         x"E4D31D", x"E4B34C", x"E49372", x"E4738C", x"E45398", x"E43392", x"E41378", x"E3F34B",
+         x"E3D308", x"E3B2B1", x"E39247", x"E371CC", x"E35141", x"E330AB", x"E3100B", x"E2EF67",
+         x"E2CEC2", x"E2AE20", x"E28D85", x"E26CF5", x"E24C73", x"E22C02", x"E20BA3", x"E1EB5A",
+         x"E1CB26", x"E1AB08", x"E18AFE", x"E16B08", x"E14B23", x"E12B4D", x"E10B81", x"E0EBBC",
+         x"E0CBFB", x"E0AC38", x"E08C70", x"E06C9F", x"E04CC1", x"E02CD3", x"E00CD2", x"DFECBB",
+         x"DFCC8F", x"DFAC4C", x"DF8BF2", x"DF6B83", x"DF4B01", x"DF2A6F", x"DF09CE", x"DEE925",
+         x"DEC875", x"DEA7C5", x"DE8718", x"DE6673", x"DE45D9", x"DE254E", x"DE04D7", x"DDE474",
+         x"DDC428", x"DDA3F4", x"DD83D8", x"DD63D3", x"DD43E4", x"DD2407", x"DD043B", x"DCE47B",
+         x"DCC4C3", x"DCA50E", x"DC8559", x"DC659E", x"DC45D8", x"DC2604", x"DC061F", x"DBE624",
+         x"DBC611", x"DBA5E6", x"DB85A2", x"DB6545", x"DB44CF", x"DB2444", x"DB03A6", x"DAE2F9",
+         x"DAC241", x"DAA183", x"DA80C3", x"DA6007", x"DA3F53", x"DA1EAD", x"D9FE17", x"D9DD97",
+         x"D9BD2E", x"D99CDF", x"D97CAB", x"D95C92", x"D93C93", x"D91CAD", x"D8FCDC", x"D8DD1E",
+         x"D8BD6E", x"D89DC8", x"D87E25", x"D85E82", x"D83ED8", x"D81F23", x"D7FF5D", x"D7DF83",
+         x"D7BF91", x"D79F84", x"D77F5B", x"D75F15", x"D73EB2", x"D71E33", x"D6FD9B", x"D6DCEE",
+         x"D6BC2E", x"D69B62", x"D67A8F", x"D659BA", x"D638E8", x"D61820", x"D5F767", x"D5D6C2",
+         x"D5B636", x"D595C4", x"D57571", x"D5553D", x"D53529", x"D51533", x"D4F55B", x"D4D59B",
+         x"D4B5F2", x"D49659", x"D476CB", x"D45743", x"D437BA", x"D41829", x"D3F88B", x"D3D8DA",
+         x"D3B910", x"D3992B", x"D37926", x"D358FF", x"D338B5", x"D31849", x"D2F7BD", x"D2D712",
+         x"D2B64D", x"D29573", x"D27489", x"D25396", x"D232A1", x"D211B0", x"D1F0CB", x"D1CFF7",
+         x"D1AF3B", x"D18E9D", x"D16E1F", x"D14DC6", x"D12D93", x"D10D86", x"D0ED9F", x"D0CDDB",
+         x"D0AE36", x"D08EAC", x"D06F37", x"D04FCF", x"D0306F", x"D0110D", x"CFF1A2", x"CFD228",
+         x"CFB296", x"CF92E6", x"CF7313", x"CF5319", x"CF32F5", x"CF12A6", x"CEF22C", x"CED189",
+         x"CEB0BF", x"CE8FD5", x"CE6ED0", x"CE4DB7", x"CE2C92", x"CE0B6A", x"CDEA47", x"CDC932",
+         x"CDA834", x"CD8754", x"CD6699", x"CD4609", x"CD25A7", x"CD0576", x"CCE577", x"CCC5A8",
+         x"CCA607", x"CC8690", x"CC673B", x"CC4801", x"CC28DA", x"CC09BC", x"CBEA9E", x"CBCB73",
+         x"CBAC34", x"CB8CD6", x"CB6D51", x"CB4D9D", x"CB2DB4", x"CB0D94", x"CAED39", x"CACCA4",
+         x"CAABD7", x"CA8AD7", x"CA69A9", x"CA4856", x"CA26E7", x"CA0568", x"C9E3E3", x"C9C266",
+         x"C9A0FC", x"C97FB1", x"C95E90", x"C93DA3", x"C91CF2", x"C8FC83", x"C8DC5A", x"C8BC78",
+         x"C89CDC", x"C87D83", x"C85E65", x"C83F7A", x"C820B8", x"C80212", x"C7E37A", x"C7C4E0",
+         x"C7A637", x"C7876E", x"C76876", x"C74944", x"C729CA", x"C70A01", x"C6E9E0", x"C6C965",
+         x"C6A88E", x"C68760", x"C665DE", x"C64414", x"C6220E", x"C5FFDA", x"C5DD8A", x"C5BB31",
+         x"C598E3", x"C576B5", x"C554BB", x"C53309", x"C511B0", x"C4F0BE", x"C4D040", x"C4B03E",
+         x"C490BC", x"C471B9", x"C45330", x"C43516", x"C4175E", x"C3F9F4", x"C3DCC0", x"C3BFA8",
+         x"C3A290", x"C38557", x"C367DE", x"C34A06", x"C32BB0", x"C30CC1", x"C2ED21", x"C2CCBC",
+         x"C2AB87", x"C28979", x"C26695", x"C242E3", x"C21E75", x"C1F967", x"C1D3DB", x"C1ADFF",
+         x"C18807", x"C16230", x"C13CBD", x"C117F7", x"C0F42B", x"C0D1AB", x"C0B0C9", x"C091D8",
+         x"C07527", x"C05B06", x"C043BD", x"C02F8F", x"C01EB6", x"C01166", x"C007C6", x"C001F4"),
+        -- octave 5
+        (x"C00001", x"C00104", x"C0040D", x"C00919", x"C01024", x"C01928", x"C0241E", x"C030FD",
+         x"C03FBB", x"C0504B", x"C062A1", x"C076AE", x"C08C63", x"C0A3AE", x"C0BC7E", x"C0D6C1",
+         x"C0F261", x"C10F4C", x"C12D6D", x"C14CAD", x"C16CF7", x"C18E36", x"C1B052", x"C1D337",
+         x"C1F6CD", x"C21AFE", x"C23FB6", x"C264DF", x"C28A65", x"C2B032", x"C2D635", x"C2FC5A",
+         x"C32290", x"C348C6", x"C36EED", x"C394F5", x"C3BAD1", x"C3E076", x"C405D7", x"C42AEA",
+         x"C44FA8", x"C47408", x"C49804", x"C4BB98", x"C4DEBF", x"C50177", x"C523BE", x"C54594",
+         x"C566FA", x"C587F2", x"C5A87F", x"C5C8A3", x"C5E864", x"C607C6", x"C626D1", x"C6458A",
+         x"C663F8", x"C68223", x"C6A013", x"C6BDD1", x"C6DB63", x"C6F8D4", x"C7162C", x"C73373",
+         x"C750B2", x"C76DF1", x"C78B37", x"C7A88E", x"C7C5FB", x"C7E386", x"C80136", x"C81F10",
+         x"C83D19", x"C85B57", x"C879CD", x"C8987E", x"C8B76F", x"C8D6A0", x"C8F613", x"C915C9",
+         x"C935C3", x"C955FF", x"C9767C", x"C9973A", x"C9B835", x"C9D96A", x"C9FAD7", x"CA1C78",
+         x"CA3E48", x"CA6043", x"CA8264", x"CAA4A6", x"CAC704", x"CAE978", x"CB0BFD", x"CB2E8D",
+         x"CB5122", x"CB73B8", x"CB9648", x"CBB8CD", x"CBDB43", x"CBFDA4", x"CC1FEC", x"CC4217",
+         x"CC6421", x"CC8607", x"CCA7C4", x"CCC958", x"CCEAC0", x"CD0BF9", x"CD2D03", x"CD4DDE",
+         x"CD6E88", x"CD8F02", x"CDAF4C", x"CDCF68", x"CDEF58", x"CE0F1C", x"CE2EB8", x"CE4E2E",
+         x"CE6D81", x"CE8CB3", x"CEABCA", x"CECAC8", x"CEE9B1", x"CF088A", x"CF2756", x"CF4619",
+         x"CF64D9", x"CF8398", x"CFA25B", x"CFC127", x"CFDFFF", x"CFFEE6", x"D01DE1", x"D03CF2",
+         x"D05C1C", x"D07B63", x"D09AC9", x"D0BA4F", x"D0D9F8", x"D0F9C5", x"D119B6", x"D139CE",
+         x"D15A0B", x"D17A6E", x"D19AF7", x"D1BBA4", x"D1DC75", x"D1FD68", x"D21E7B", x"D23FAD",
+         x"D260FA", x"D28262", x"D2A3DF", x"D2C571", x"D2E713", x"D308C3", x"D32A7D", x"D34C3D",
+         x"D36E01", x"D38FC5", x"D3B186", x"D3D340", x"D3F4F0", x"D41694", x"D43828", x"D459A9",
+         x"D47B15", x"D49C6A", x"D4BDA6", x"D4DEC7", x"D4FFCB", x"D520B1", x"D54179", x"D56222",
+         x"D582AB", x"D5A315", x"D5C360", x"D5E38C", x"D6039A", x"D6238C", x"D64362", x"D66320",
+         x"D682C5", x"D6A256", x"D6C1D3", x"D6E13F", x"D7009E", x"D71FF1", x"D73F3C", x"D75E81",
+         x"D77DC3", x"D79D04", x"D7BC49", x"D7DB94", x"D7FAE6", x"D81A44", x"D839AF", x"D8592A",
+         x"D878B7", x"D89858", x"D8B80E", x"D8D7DC", x"D8F7C2", x"D917C1", x"D937DB", x"D95810",
+         x"D97860", x"D998CB", x"D9B951", x"D9D9F2", x"D9FAAC", x"DA1B7F", x"DA3C69", x"DA5D69",
+         x"DA7E7E", x"DA9FA6", x"DAC0DE", x"DAE225", x"DB0377", x"DB24D4", x"DB4639", x"DB67A2",
+         x"DB890E", x"DBAA7A", x"DBCBE3", x"DBED47", x"DC0EA4", x"DC2FF8", x"DC5140", x"DC7279",
+         x"DC93A3", x"DCB4BC", x"DCD5C1", x"DCF6B2", x"DD178D", x"DD3852", x"DD58FF", x"DD7995",
+         x"DD9A12", x"DDBA78", x"DDDAC5", x"DDFAFB", x"DE1B1A", x"DE3B24", x"DE5B18", x"DE7AF8",
+         x"DE9AC7", x"DEBA85", x"DEDA33", x"DEF9D5", x"DF196C", x"DF38FA", x"DF5882", x"DF7805",
+         x"DF9785", x"DFB706", x"DFD689", x"DFF610", x"E0159E", x"E03535", x"E054D6", x"E07484",
+         x"E09440", x"E0B40B", x"E0D3E8", x"E0F3D8", x"E113DB", x"E133F2", x"E1541F", x"E17461",
+         x"E194B9", x"E1B526", x"E1D5AA", x"E1F642", x"E216F0", x"E237B1", x"E25886", x"E2796C",
+         x"E29A63", x"E2BB69", x"E2DC7D", x"E2FD9C", x"E31EC5", x"E33FF7", x"E3612E", x"E3826A",
+         x"E3A3A8", x"E3C4E6", x"E3E621", x"E40759", x"E4288A", x"E449B4", x"E46AD4", x"E48BE9",
+         x"E4ACF0", x"E4CDE9", x"E4EED2", x"E50FAA", x"E53070", x"E55123", x"E571C3", x"E5924F",
+         x"E5B2C7", x"E5D32B", x"E5F37A", x"E613B6", x"E633DF", x"E653F5", x"E673FA", x"E693EE",
+         x"E6B3D3", x"E6D3AA", x"E6F375", x"E71334", x"E732EA", x"E75299", x"E77242", x"E791E7",
+         x"E7B18A", x"E7D12D", x"E7F0D2", x"E8107B", x"E8302A", x"E84FE0", x"E86F9F", x"E88F68",
+         x"E8AF3E", x"E8CF22", x"E8EF14", x"E90F16", x"E92F29", x"E94F4D", x"E96F84", x"E98FCD",
+         x"E9B029", x"E9D098", x"E9F11A", x"EA11AE", x"EA3254", x"EA530B", x"EA73D3", x"EA94AB",
+         x"EAB590", x"EAD683", x"EAF782", x"EB188B", x"EB399D", x"EB5AB6", x"EB7BD4", x"EB9CF6",
+         x"EBBE1A", x"EBDF3D", x"EC005F", x"EC217D", x"EC4296", x"EC63A8", x"EC84B2", x"ECA5B1",
+         x"ECC6A5", x"ECE78C", x"ED0865", x"ED292F", x"ED49E9", x"ED6A92", x"ED8B2A", x"EDABB1",
+         x"EDCC25", x"EDEC88", x"EE0CD9", x"EE2D19", x"EE4D47", x"EE6D65", x"EE8D73", x"EEAD73",
+         x"EECD64", x"EEED4A", x"EF0D24", x"EF2CF4", x"EF4CBC", x"EF6C7D", x"EF8C39", x"EFABF2",
+         x"EFCBA9", x"EFEB5F", x"F00B18", x"F02AD4", x"F04A95", x"F06A5D", x"F08A2D", x"F0AA07",
+         x"F0C9EB", x"F0E9DC", x"F109DB", x"F129E7", x"F14A03", x"F16A2F", x"F18A6C", x"F1AAB9",
+         x"F1CB17", x"F1EB87", x"F20C08", x"F22C9A", x"F24D3C", x"F26DED", x"F28EAE", x"F2AF7E",
+         x"F2D05A", x"F2F142", x"F31235", x"F33332", x"F35437", x"F37542", x"F39652", x"F3B765",
+         x"F3D87B", x"F3F990", x"F41AA3", x"F43BB3", x"F45CBE", x"F47DC3", x"F49EC0", x"F4BFB3",
+         x"F4E09C", x"F50179", x"F52249", x"F5430B", x"F563BE", x"F58462", x"F5A4F6", x"F5C579",
+         x"F5E5EC", x"F6064E", x"F6269F", x"F646E0", x"F66712", x"F68733", x"F6A746", x"F6C74C",
+         x"F6E744", x"F70731", x"F72713", x"F746EC", x"F766BD", x"F78688", x"F7A64E", x"F7C611",
+         x"F7E5D2", x"F80593", x"F82556", x"F8451C", x"F864E7", x"F884B8", x"F8A491", x"F8C473",
+         x"F8E45F", x"F90457", x"F9245C", x"F9446F", x"F96490", x"F984C0", x"F9A4FF", x"F9C54F",
+         x"F9E5AF", x"FA0620", x"FA26A0", x"FA4731", x"FA67D2", x"FA8881", x"FAA93F", x"FACA0B",
+         x"FAEAE3", x"FB0BC6", x"FB2CB4", x"FB4DAB", x"FB6EAA", x"FB8FAF", x"FBB0B9", x"FBD1C6",
+         x"FBF2D4", x"FC13E3", x"FC34F0", x"FC55F9", x"FC76FE", x"FC97FD", x"FCB8F4", x"FCD9E2",
+         x"FCFAC6", x"FD1B9E", x"FD3C6A", x"FD5D28", x"FD7DD8", x"FD9E79", x"FDBF0B", x"FDDF8C",
+         x"FDFFFE", x"FE205F", x"FE40B0", x"FE60F1", x"FE8123", x"FEA145", x"FEC15A", x"FEE161",
+         x"FF015B", x"FF214A", x"FF412F", x"FF610B", x"FF80DF", x"FFA0AC", x"FFC076", x"FFE03C",
+         x"000000", x"001FC4", x"003F8A", x"005F54", x"007F21", x"009EF5", x"00BED1", x"00DEB6",
+         x"00FEA5", x"011E9F", x"013EA6", x"015EBB", x"017EDD", x"019F0F", x"01BF50", x"01DFA1",
+         x"020002", x"022074", x"0240F5", x"026187", x"028228", x"02A2D8", x"02C396", x"02E462",
+         x"03053A", x"03261E", x"03470C", x"036803", x"038902", x"03AA07", x"03CB10", x"03EC1D",
+         x"040D2C", x"042E3A", x"044F47", x"047051", x"049156", x"04B255", x"04D34C", x"04F43A",
+         x"05151D", x"0535F5", x"0556C1", x"05777F", x"05982E", x"05B8CF", x"05D960", x"05F9E0",
+         x"061A51", x"063AB1", x"065B01", x"067B40", x"069B70", x"06BB91", x"06DBA4", x"06FBA9",
+         x"071BA1", x"073B8D", x"075B6F", x"077B48", x"079B19", x"07BAE4", x"07DAAA", x"07FA6D",
+         x"081A2E", x"0839EF", x"0859B2", x"087978", x"089943", x"08B914", x"08D8ED", x"08F8CF",
+         x"0918BC", x"0938B4", x"0958BA", x"0978CD", x"0998EE", x"09B920", x"09D961", x"09F9B2",
+         x"0A1A14", x"0A3A87", x"0A5B0A", x"0A7B9E", x"0A9C42", x"0ABCF5", x"0ADDB7", x"0AFE87",
+         x"0B1F64", x"0B404D", x"0B6140", x"0B823D", x"0BA342", x"0BC44D", x"0BE55D", x"0C0670",
+         x"0C2785", x"0C489B", x"0C69AE", x"0C8ABE", x"0CABC9", x"0CCCCE", x"0CEDCB", x"0D0EBE",
+         x"0D2FA6", x"0D5082", x"0D7152", x"0D9213", x"0DB2C4", x"0DD366", x"0DF3F8", x"0E1479",
+         x"0E34E9", x"0E5547", x"0E7594", x"0E95D1", x"0EB5FD", x"0ED619", x"0EF625", x"0F1624",
+         x"0F3615", x"0F55F9", x"0F75D3", x"0F95A3", x"0FB56B", x"0FD52C", x"0FF4E8", x"1014A1",
+         x"103457", x"10540E", x"1073C7", x"109383", x"10B344", x"10D30C", x"10F2DC", x"1112B6",
+         x"11329C", x"11528D", x"11728D", x"11929B", x"11B2B9", x"11D2E7", x"11F327", x"121378",
+         x"1233DB", x"12544F", x"1274D6", x"12956E", x"12B617", x"12D6D1", x"12F79B", x"131874",
+         x"13395B", x"135A4F", x"137B4E", x"139C58", x"13BD6A", x"13DE83", x"13FFA1", x"1420C3",
+         x"1441E6", x"14630A", x"14842C", x"14A54A", x"14C663", x"14E775", x"15087E", x"15297D",
+         x"154A70", x"156B55", x"158C2D", x"15ACF5", x"15CDAC", x"15EE52", x"160EE6", x"162F68",
+         x"164FD7", x"167033", x"16907C", x"16B0B3", x"16D0D7", x"16F0EA", x"1710EC", x"1730DE",
+         x"1750C2", x"177098", x"179061", x"17B020", x"17CFD6", x"17EF85", x"180F2E", x"182ED3",
+         x"184E76", x"186E19", x"188DBE", x"18AD67", x"18CD16", x"18ECCC", x"190C8B", x"192C56",
+         x"194C2D", x"196C12", x"198C06", x"19AC0B", x"19CC21", x"19EC4A", x"1A0C86", x"1A2CD5",
+         x"1A4D39", x"1A6DB1", x"1A8E3D", x"1AAEDD", x"1ACF90", x"1AF056", x"1B112E", x"1B3217",
+         x"1B5310", x"1B7417", x"1B952C", x"1BB64C", x"1BD776", x"1BF8A7", x"1C19DF", x"1C3B1A",
+         x"1C5C58", x"1C7D96", x"1C9ED2", x"1CC009", x"1CE13B", x"1D0264", x"1D2383", x"1D4497",
+         x"1D659D", x"1D8694", x"1DA77A", x"1DC84F", x"1DE910", x"1E09BE", x"1E2A56", x"1E4ADA",
+         x"1E6B47", x"1E8B9F", x"1EABE1", x"1ECC0E", x"1EEC25", x"1F0C28", x"1F2C18", x"1F4BF5",
+         x"1F6BC0", x"1F8B7C", x"1FAB2A", x"1FCACB", x"1FEA62", x"2009F0", x"202977", x"2048FA",
+         x"20687B", x"2087FB", x"20A77E", x"20C706", x"20E694", x"21062B", x"2125CD", x"21457B",
+         x"216539", x"218508", x"21A4E8", x"21C4DC", x"21E4E6", x"220505", x"22253B", x"224588",
+         x"2265EE", x"22866B", x"22A701", x"22C7AE", x"22E873", x"23094E", x"232A3F", x"234B44",
+         x"236C5D", x"238D87", x"23AEC0", x"23D008", x"23F15C", x"2412B9", x"24341D", x"245586",
+         x"2476F2", x"24985E", x"24B9C7", x"24DB2C", x"24FC89", x"251DDB", x"253F22", x"25605A",
+         x"258182", x"25A297", x"25C397", x"25E481", x"260554", x"26260E", x"2646AF", x"266735",
+         x"2687A0", x"26A7F0", x"26C825", x"26E83F", x"27083E", x"272824", x"2747F2", x"2767A8",
+         x"278749", x"27A6D6", x"27C651", x"27E5BC", x"28051A", x"28246C", x"2843B7", x"2862FC",
+         x"28823D", x"28A17F", x"28C0C4", x"28E00F", x"28FF62", x"291EC1", x"293E2D", x"295DAA",
+         x"297D3B", x"299CE0", x"29BC9E", x"29DC74", x"29FC66", x"2A1C74", x"2A3CA0", x"2A5CEB",
+         x"2A7D55", x"2A9DDE", x"2ABE87", x"2ADF4F", x"2B0035", x"2B2139", x"2B425A", x"2B6396",
+         x"2B84EB", x"2BA657", x"2BC7D8", x"2BE96C", x"2C0B10", x"2C2CC0", x"2C4E7A", x"2C703B",
+         x"2C91FF", x"2CB3C3", x"2CD583", x"2CF73D", x"2D18ED", x"2D3A8F", x"2D5C21", x"2D7D9E",
+         x"2D9F06", x"2DC053", x"2DE185", x"2E0298", x"2E238B", x"2E445C", x"2E6509", x"2E8592",
+         x"2EA5F5", x"2EC632", x"2EE64A", x"2F063B", x"2F2608", x"2F45B1", x"2F6537", x"2F849D",
+         x"2FA3E4", x"2FC30E", x"2FE21F", x"30011A", x"302001", x"303ED9", x"305DA5", x"307C68",
+         x"309B27", x"30B9E7", x"30D8AA", x"30F776", x"31164F", x"313538", x"315436", x"31734D",
+         x"31927F", x"31B1D2", x"31D148", x"31F0E4", x"3210A8", x"323098", x"3250B4", x"3270FE",
+         x"329178", x"32B222", x"32D2FD", x"32F407", x"331540", x"3336A8", x"33583C", x"3379F9",
+         x"339BDF", x"33BDE9", x"33E014", x"34025C", x"3424BD", x"344733", x"3469B8", x"348C48",
+         x"34AEDE", x"34D173", x"34F403", x"351688", x"3538FC", x"355B5A", x"357D9C", x"359FBD",
+         x"35C1B8", x"35E388", x"360529", x"362696", x"3647CB", x"3668C6", x"368984", x"36AA01",
+         x"36CA3D", x"36EA37", x"3709ED", x"372960", x"374891", x"376782", x"378633", x"37A4A9",
+         x"37C2E7", x"37E0F0", x"37FECA", x"381C7A", x"383A05", x"385772", x"3874C9", x"38920F",
+         x"38AF4E", x"38CC8D", x"38E9D4", x"39072C", x"39249D", x"39422F", x"395FED", x"397DDD",
+         x"399C08", x"39BA76", x"39D92F", x"39F83A", x"3A179C", x"3A375D", x"3A5781", x"3A780E",
+         x"3A9906", x"3ABA6C", x"3ADC42", x"3AFE89", x"3B2141", x"3B4468", x"3B67FC", x"3B8BF8",
+         x"3BB058", x"3BD516", x"3BFA29", x"3C1F8A", x"3C452F", x"3C6B0B", x"3C9113", x"3CB73A",
+         x"3CDD70", x"3D03A6", x"3D29CB", x"3D4FCE", x"3D759B", x"3D9B21", x"3DC04A", x"3DE502",
+         x"3E0933", x"3E2CC9", x"3E4FAE", x"3E71CA", x"3E9309", x"3EB353", x"3ED293", x"3EF0B4",
+         x"3F0D9F", x"3F293F", x"3F4382", x"3F5C52", x"3F739D", x"3F8952", x"3F9D5F", x"3FAFB5",
+         x"3FC045", x"3FCF03", x"3FDBE2", x"3FE6D8", x"3FEFDC", x"3FF6E7", x"3FFBF3", x"3FFEFC",
+         x"3FFFFF", x"3FFEFC", x"3FFBF3", x"3FF6E7", x"3FEFDC", x"3FE6D8", x"3FDBE2", x"3FCF03",
+         x"3FC045", x"3FAFB5", x"3F9D5F", x"3F8952", x"3F739D", x"3F5C52", x"3F4382", x"3F293F",
+         x"3F0D9F", x"3EF0B4", x"3ED293", x"3EB353", x"3E9309", x"3E71CA", x"3E4FAE", x"3E2CC9",
+         x"3E0933", x"3DE502", x"3DC04A", x"3D9B21", x"3D759B", x"3D4FCE", x"3D29CB", x"3D03A6",
+         x"3CDD70", x"3CB73A", x"3C9113", x"3C6B0B", x"3C452F", x"3C1F8A", x"3BFA29", x"3BD516",
+         x"3BB058", x"3B8BF8", x"3B67FC", x"3B4468", x"3B2141", x"3AFE89", x"3ADC42", x"3ABA6C",
+         x"3A9906", x"3A780E", x"3A5781", x"3A375D", x"3A179C", x"39F83A", x"39D92F", x"39BA76",
+         x"399C08", x"397DDD", x"395FED", x"39422F", x"39249D", x"39072C", x"38E9D4", x"38CC8D",
+         x"38AF4E", x"38920F", x"3874C9", x"385772", x"383A05", x"381C7A", x"37FECA", x"37E0F0",
+         x"37C2E7", x"37A4A9", x"378633", x"376782", x"374891", x"372960", x"3709ED", x"36EA37",
+         x"36CA3D", x"36AA01", x"368984", x"3668C6", x"3647CB", x"362696", x"360529", x"35E388",
+         x"35C1B8", x"359FBD", x"357D9C", x"355B5A", x"3538FC", x"351688", x"34F403", x"34D173",
+         x"34AEDE", x"348C48", x"3469B8", x"344733", x"3424BD", x"34025C", x"33E014", x"33BDE9",
+         x"339BDF", x"3379F9", x"33583C", x"3336A8", x"331540", x"32F407", x"32D2FD", x"32B222",
+         x"329178", x"3270FE", x"3250B4", x"323098", x"3210A8", x"31F0E4", x"31D148", x"31B1D2",
+         x"31927F", x"31734D", x"315436", x"313538", x"31164F", x"30F776", x"30D8AA", x"30B9E7",
+         x"309B27", x"307C68", x"305DA5", x"303ED9", x"302001", x"30011A", x"2FE21F", x"2FC30E",
+         x"2FA3E4", x"2F849D", x"2F6537", x"2F45B1", x"2F2608", x"2F063B", x"2EE64A", x"2EC632",
+         x"2EA5F5", x"2E8592", x"2E6509", x"2E445C", x"2E238B", x"2E0298", x"2DE185", x"2DC053",
+         x"2D9F06", x"2D7D9E", x"2D5C21", x"2D3A8F", x"2D18ED", x"2CF73D", x"2CD583", x"2CB3C3",
+         x"2C91FF", x"2C703B", x"2C4E7A", x"2C2CC0", x"2C0B10", x"2BE96C", x"2BC7D8", x"2BA657",
+         x"2B84EB", x"2B6396", x"2B425A", x"2B2139", x"2B0035", x"2ADF4F", x"2ABE87", x"2A9DDE",
+         x"2A7D55", x"2A5CEB", x"2A3CA0", x"2A1C74", x"29FC66", x"29DC74", x"29BC9E", x"299CE0",
+         x"297D3B", x"295DAA", x"293E2D", x"291EC1", x"28FF62", x"28E00F", x"28C0C4", x"28A17F",
+         x"28823D", x"2862FC", x"2843B7", x"28246C", x"28051A", x"27E5BC", x"27C651", x"27A6D6",
+         x"278749", x"2767A8", x"2747F2", x"272824", x"27083E", x"26E83F", x"26C825", x"26A7F0",
+         x"2687A0", x"266735", x"2646AF", x"26260E", x"260554", x"25E481", x"25C397", x"25A297",
+         x"258182", x"25605A", x"253F22", x"251DDB", x"24FC89", x"24DB2C", x"24B9C7", x"24985E",
+         x"2476F2", x"245586", x"24341D", x"2412B9", x"23F15C", x"23D008", x"23AEC0", x"238D87",
+         x"236C5D", x"234B44", x"232A3F", x"23094E", x"22E873", x"22C7AE", x"22A701", x"22866B",
+         x"2265EE", x"224588", x"22253B", x"220505", x"21E4E6", x"21C4DC", x"21A4E8", x"218508",
+         x"216539", x"21457B", x"2125CD", x"21062B", x"20E694", x"20C706", x"20A77E", x"2087FB",
+         x"20687B", x"2048FA", x"202977", x"2009F0", x"1FEA62", x"1FCACB", x"1FAB2A", x"1F8B7C",
+         x"1F6BC0", x"1F4BF5", x"1F2C18", x"1F0C28", x"1EEC25", x"1ECC0E", x"1EABE1", x"1E8B9F",
+         x"1E6B47", x"1E4ADA", x"1E2A56", x"1E09BE", x"1DE910", x"1DC84F", x"1DA77A", x"1D8694",
+         x"1D659D", x"1D4497", x"1D2383", x"1D0264", x"1CE13B", x"1CC009", x"1C9ED2", x"1C7D96",
+         x"1C5C58", x"1C3B1A", x"1C19DF", x"1BF8A7", x"1BD776", x"1BB64C", x"1B952C", x"1B7417",
+         x"1B5310", x"1B3217", x"1B112E", x"1AF056", x"1ACF90", x"1AAEDD", x"1A8E3D", x"1A6DB1",
+         x"1A4D39", x"1A2CD5", x"1A0C86", x"19EC4A", x"19CC21", x"19AC0B", x"198C06", x"196C12",
+         x"194C2D", x"192C56", x"190C8B", x"18ECCC", x"18CD16", x"18AD67", x"188DBE", x"186E19",
+         x"184E76", x"182ED3", x"180F2E", x"17EF85", x"17CFD6", x"17B020", x"179061", x"177098",
+         x"1750C2", x"1730DE", x"1710EC", x"16F0EA", x"16D0D7", x"16B0B3", x"16907C", x"167033",
+         x"164FD7", x"162F68", x"160EE6", x"15EE52", x"15CDAC", x"15ACF5", x"158C2D", x"156B55",
+         x"154A70", x"15297D", x"15087E", x"14E775", x"14C663", x"14A54A", x"14842C", x"14630A",
+         x"1441E6", x"1420C3", x"13FFA1", x"13DE83", x"13BD6A", x"139C58", x"137B4E", x"135A4F",
+         x"13395B", x"131874", x"12F79B", x"12D6D1", x"12B617", x"12956E", x"1274D6", x"12544F",
+         x"1233DB", x"121378", x"11F327", x"11D2E7", x"11B2B9", x"11929B", x"11728D", x"11528D",
+         x"11329C", x"1112B6", x"10F2DC", x"10D30C", x"10B344", x"109383", x"1073C7", x"10540E",
+         x"103457", x"1014A1", x"0FF4E8", x"0FD52C", x"0FB56B", x"0F95A3", x"0F75D3", x"0F55F9",
+         x"0F3615", x"0F1624", x"0EF625", x"0ED619", x"0EB5FD", x"0E95D1", x"0E7594", x"0E5547",
+         x"0E34E9", x"0E1479", x"0DF3F8", x"0DD366", x"0DB2C4", x"0D9213", x"0D7152", x"0D5082",
+         x"0D2FA6", x"0D0EBE", x"0CEDCB", x"0CCCCE", x"0CABC9", x"0C8ABE", x"0C69AE", x"0C489B",
+         x"0C2785", x"0C0670", x"0BE55D", x"0BC44D", x"0BA342", x"0B823D", x"0B6140", x"0B404D",
+         x"0B1F64", x"0AFE87", x"0ADDB7", x"0ABCF5", x"0A9C42", x"0A7B9E", x"0A5B0A", x"0A3A87",
+         x"0A1A14", x"09F9B2", x"09D961", x"09B920", x"0998EE", x"0978CD", x"0958BA", x"0938B4",
+         x"0918BC", x"08F8CF", x"08D8ED", x"08B914", x"089943", x"087978", x"0859B2", x"0839EF",
+         x"081A2E", x"07FA6D", x"07DAAA", x"07BAE4", x"079B19", x"077B48", x"075B6F", x"073B8D",
+         x"071BA1", x"06FBA9", x"06DBA4", x"06BB91", x"069B70", x"067B40", x"065B01", x"063AB1",
+         x"061A51", x"05F9E0", x"05D960", x"05B8CF", x"05982E", x"05777F", x"0556C1", x"0535F5",
+         x"05151D", x"04F43A", x"04D34C", x"04B255", x"049156", x"047051", x"044F47", x"042E3A",
+         x"040D2C", x"03EC1D", x"03CB10", x"03AA07", x"038902", x"036803", x"03470C", x"03261E",
+         x"03053A", x"02E462", x"02C396", x"02A2D8", x"028228", x"026187", x"0240F5", x"022074",
+         x"020002", x"01DFA1", x"01BF50", x"019F0F", x"017EDD", x"015EBB", x"013EA6", x"011E9F",
+         x"00FEA5", x"00DEB6", x"00BED1", x"009EF5", x"007F21", x"005F54", x"003F8A", x"001FC4",
+         x"000000", x"FFE03C", x"FFC076", x"FFA0AC", x"FF80DF", x"FF610B", x"FF412F", x"FF214A",
+         x"FF015B", x"FEE161", x"FEC15A", x"FEA145", x"FE8123", x"FE60F1", x"FE40B0", x"FE205F",
+         x"FDFFFE", x"FDDF8C", x"FDBF0B", x"FD9E79", x"FD7DD8", x"FD5D28", x"FD3C6A", x"FD1B9E",
+         x"FCFAC6", x"FCD9E2", x"FCB8F4", x"FC97FD", x"FC76FE", x"FC55F9", x"FC34F0", x"FC13E3",
+         x"FBF2D4", x"FBD1C6", x"FBB0B9", x"FB8FAF", x"FB6EAA", x"FB4DAB", x"FB2CB4", x"FB0BC6",
+         x"FAEAE3", x"FACA0B", x"FAA93F", x"FA8881", x"FA67D2", x"FA4731", x"FA26A0", x"FA0620",
+         x"F9E5AF", x"F9C54F", x"F9A4FF", x"F984C0", x"F96490", x"F9446F", x"F9245C", x"F90457",
+         x"F8E45F", x"F8C473", x"F8A491", x"F884B8", x"F864E7", x"F8451C", x"F82556", x"F80593",
+         x"F7E5D2", x"F7C611", x"F7A64E", x"F78688", x"F766BD", x"F746EC", x"F72713", x"F70731",
+         x"F6E744", x"F6C74C", x"F6A746", x"F68733", x"F66712", x"F646E0", x"F6269F", x"F6064E",
+         x"F5E5EC", x"F5C579", x"F5A4F6", x"F58462", x"F563BE", x"F5430B", x"F52249", x"F50179",
+         x"F4E09C", x"F4BFB3", x"F49EC0", x"F47DC3", x"F45CBE", x"F43BB3", x"F41AA3", x"F3F990",
+         x"F3D87B", x"F3B765", x"F39652", x"F37542", x"F35437", x"F33332", x"F31235", x"F2F142",
+         x"F2D05A", x"F2AF7E", x"F28EAE", x"F26DED", x"F24D3C", x"F22C9A", x"F20C08", x"F1EB87",
+         x"F1CB17", x"F1AAB9", x"F18A6C", x"F16A2F", x"F14A03", x"F129E7", x"F109DB", x"F0E9DC",
+         x"F0C9EB", x"F0AA07", x"F08A2D", x"F06A5D", x"F04A95", x"F02AD4", x"F00B18", x"EFEB5F",
+         x"EFCBA9", x"EFABF2", x"EF8C39", x"EF6C7D", x"EF4CBC", x"EF2CF4", x"EF0D24", x"EEED4A",
+         x"EECD64", x"EEAD73", x"EE8D73", x"EE6D65", x"EE4D47", x"EE2D19", x"EE0CD9", x"EDEC88",
+         x"EDCC25", x"EDABB1", x"ED8B2A", x"ED6A92", x"ED49E9", x"ED292F", x"ED0865", x"ECE78C",
+         x"ECC6A5", x"ECA5B1", x"EC84B2", x"EC63A8", x"EC4296", x"EC217D", x"EC005F", x"EBDF3D",
+         x"EBBE1A", x"EB9CF6", x"EB7BD4", x"EB5AB6", x"EB399D", x"EB188B", x"EAF782", x"EAD683",
+         x"EAB590", x"EA94AB", x"EA73D3", x"EA530B", x"EA3254", x"EA11AE", x"E9F11A", x"E9D098",
+         x"E9B029", x"E98FCD", x"E96F84", x"E94F4D", x"E92F29", x"E90F16", x"E8EF14", x"E8CF22",
+         x"E8AF3E", x"E88F68", x"E86F9F", x"E84FE0", x"E8302A", x"E8107B", x"E7F0D2", x"E7D12D",
+         x"E7B18A", x"E791E7", x"E77242", x"E75299", x"E732EA", x"E71334", x"E6F375", x"E6D3AA",
+         x"E6B3D3", x"E693EE", x"E673FA", x"E653F5", x"E633DF", x"E613B6", x"E5F37A", x"E5D32B",
+         x"E5B2C7", x"E5924F", x"E571C3", x"E55123", x"E53070", x"E50FAA", x"E4EED2", x"E4CDE9",
+         x"E4ACF0", x"E48BE9", x"E46AD4", x"E449B4", x"E4288A", x"E40759", x"E3E621", x"E3C4E6",
+         x"E3A3A8", x"E3826A", x"E3612E", x"E33FF7", x"E31EC5", x"E2FD9C", x"E2DC7D", x"E2BB69",
+         x"E29A63", x"E2796C", x"E25886", x"E237B1", x"E216F0", x"E1F642", x"E1D5AA", x"E1B526",
+         x"E194B9", x"E17461", x"E1541F", x"E133F2", x"E113DB", x"E0F3D8", x"E0D3E8", x"E0B40B",
+         x"E09440", x"E07484", x"E054D6", x"E03535", x"E0159E", x"DFF610", x"DFD689", x"DFB706",
+         x"DF9785", x"DF7805", x"DF5882", x"DF38FA", x"DF196C", x"DEF9D5", x"DEDA33", x"DEBA85",
+         x"DE9AC7", x"DE7AF8", x"DE5B18", x"DE3B24", x"DE1B1A", x"DDFAFB", x"DDDAC5", x"DDBA78",
+         x"DD9A12", x"DD7995", x"DD58FF", x"DD3852", x"DD178D", x"DCF6B2", x"DCD5C1", x"DCB4BC",
+         x"DC93A3", x"DC7279", x"DC5140", x"DC2FF8", x"DC0EA4", x"DBED47", x"DBCBE3", x"DBAA7A",
+         x"DB890E", x"DB67A2", x"DB4639", x"DB24D4", x"DB0377", x"DAE225", x"DAC0DE", x"DA9FA6",
+         x"DA7E7E", x"DA5D69", x"DA3C69", x"DA1B7F", x"D9FAAC", x"D9D9F2", x"D9B951", x"D998CB",
+         x"D97860", x"D95810", x"D937DB", x"D917C1", x"D8F7C2", x"D8D7DC", x"D8B80E", x"D89858",
+         x"D878B7", x"D8592A", x"D839AF", x"D81A44", x"D7FAE6", x"D7DB94", x"D7BC49", x"D79D04",
+         x"D77DC3", x"D75E81", x"D73F3C", x"D71FF1", x"D7009E", x"D6E13F", x"D6C1D3", x"D6A256",
+         x"D682C5", x"D66320", x"D64362", x"D6238C", x"D6039A", x"D5E38C", x"D5C360", x"D5A315",
+         x"D582AB", x"D56222", x"D54179", x"D520B1", x"D4FFCB", x"D4DEC7", x"D4BDA6", x"D49C6A",
+         x"D47B15", x"D459A9", x"D43828", x"D41694", x"D3F4F0", x"D3D340", x"D3B186", x"D38FC5",
+         x"D36E01", x"D34C3D", x"D32A7D", x"D308C3", x"D2E713", x"D2C571", x"D2A3DF", x"D28262",
+         x"D260FA", x"D23FAD", x"D21E7B", x"D1FD68", x"D1DC75", x"D1BBA4", x"D19AF7", x"D17A6E",
+         x"D15A0B", x"D139CE", x"D119B6", x"D0F9C5", x"D0D9F8", x"D0BA4F", x"D09AC9", x"D07B63",
+         x"D05C1C", x"D03CF2", x"D01DE1", x"CFFEE6", x"CFDFFF", x"CFC127", x"CFA25B", x"CF8398",
+         x"CF64D9", x"CF4619", x"CF2756", x"CF088A", x"CEE9B1", x"CECAC8", x"CEABCA", x"CE8CB3",
+         x"CE6D81", x"CE4E2E", x"CE2EB8", x"CE0F1C", x"CDEF58", x"CDCF68", x"CDAF4C", x"CD8F02",
+         x"CD6E88", x"CD4DDE", x"CD2D03", x"CD0BF9", x"CCEAC0", x"CCC958", x"CCA7C4", x"CC8607",
+         x"CC6421", x"CC4217", x"CC1FEC", x"CBFDA4", x"CBDB43", x"CBB8CD", x"CB9648", x"CB73B8",
+         x"CB5122", x"CB2E8D", x"CB0BFD", x"CAE978", x"CAC704", x"CAA4A6", x"CA8264", x"CA6043",
+         x"CA3E48", x"CA1C78", x"C9FAD7", x"C9D96A", x"C9B835", x"C9973A", x"C9767C", x"C955FF",
+         x"C935C3", x"C915C9", x"C8F613", x"C8D6A0", x"C8B76F", x"C8987E", x"C879CD", x"C85B57",
+         x"C83D19", x"C81F10", x"C80136", x"C7E386", x"C7C5FB", x"C7A88E", x"C78B37", x"C76DF1",
+         x"C750B2", x"C73373", x"C7162C", x"C6F8D4", x"C6DB63", x"C6BDD1", x"C6A013", x"C68223",
+         x"C663F8", x"C6458A", x"C626D1", x"C607C6", x"C5E864", x"C5C8A3", x"C5A87F", x"C587F2",
+         x"C566FA", x"C54594", x"C523BE", x"C50177", x"C4DEBF", x"C4BB98", x"C49804", x"C47408",
+         x"C44FA8", x"C42AEA", x"C405D7", x"C3E076", x"C3BAD1", x"C394F5", x"C36EED", x"C348C6",
+         x"C32290", x"C2FC5A", x"C2D635", x"C2B032", x"C28A65", x"C264DF", x"C23FB6", x"C21AFE",
+         x"C1F6CD", x"C1D337", x"C1B052", x"C18E36", x"C16CF7", x"C14CAD", x"C12D6D", x"C10F4C",
+         x"C0F261", x"C0D6C1", x"C0BC7E", x"C0A3AE", x"C08C63", x"C076AE", x"C062A1", x"C0504B",
+         x"C03FBB", x"C030FD", x"C0241E", x"C01928", x"C01024", x"C00919", x"C0040D", x"C00104"),
+        -- octave 6
+        (x"C00001", x"C00084", x"C0020E", x"C0049E", x"C00834", x"C00CCF", x"C0126D", x"C0190F",
+         x"C020B2", x"C02955", x"C032F6", x"C03D94", x"C0492B", x"C055BA", x"C0633F", x"C071B6",
+         x"C0811D", x"C09170", x"C0A2AC", x"C0B4CF", x"C0C7D3", x"C0DBB7", x"C0F075", x"C10609",
+         x"C11C70", x"C133A5", x"C14BA4", x"C16468", x"C17DED", x"C1982D", x"C1B324", x"C1CECC",
+         x"C1EB21", x"C2081E", x"C225BD", x"C243F9", x"C262CC", x"C28231", x"C2A223", x"C2C29C",
+         x"C2E397", x"C3050D", x"C326FA", x"C34957", x"C36C1F", x"C38F4D", x"C3B2DB", x"C3D6C2",
+         x"C3FAFF", x"C41F8A", x"C4445F", x"C46979", x"C48ED1", x"C4B462", x"C4DA28", x"C5001C",
+         x"C5263A", x"C54C7E", x"C572E0", x"C5995E", x"C5BFF2", x"C5E698", x"C60D4A", x"C63405",
+         x"C65AC4", x"C68183", x"C6A83E", x"C6CEF1", x"C6F599", x"C71C31", x"C742B6", x"C76924",
+         x"C78F79", x"C7B5B1", x"C7DBCA", x"C801C0", x"C82792", x"C84D3C", x"C872BC", x"C89810",
+         x"C8BD36", x"C8E22D", x"C906F2", x"C92B84", x"C94FE2", x"C9740A", x"C997FC", x"C9BBB6",
+         x"C9DF38", x"CA0281", x"CA2591", x"CA4867", x"CA6B03", x"CA8D66", x"CAAF8F", x"CAD17E",
+         x"CAF335", x"CB14B3", x"CB35F9", x"CB5708", x"CB77E0", x"CB9884", x"CBB8F3", x"CBD92F",
+         x"CBF939", x"CC1913", x"CC38BE", x"CC583C", x"CC778E", x"CC96B6", x"CCB5B6", x"CCD490",
+         x"CCF345", x"CD11D8", x"CD304B", x"CD4E9F", x"CD6CD6", x"CD8AF4", x"CDA8F9", x"CDC6E9",
+         x"CDE4C5", x"CE0290", x"CE204B", x"CE3DF9", x"CE5B9D", x"CE7938", x"CE96CC", x"CEB45C",
+         x"CED1EA", x"CEEF78", x"CF0D08", x"CF2A9C", x"CF4837", x"CF65D9", x"CF8386", x"CFA13E",
+         x"CFBF05", x"CFDCDA", x"CFFAC1", x"D018BB", x"D036C9", x"D054ED", x"D07328", x"D0917C",
+         x"D0AFEA", x"D0CE73", x"D0ED19", x"D10BDB", x"D12ABC", x"D149BC", x"D168DC", x"D1881D",
+         x"D1A77E", x"D1C702", x"D1E6A7", x"D20670", x"D2265A", x"D24668", x"D26699", x"D286ED",
+         x"D2A764", x"D2C7FE", x"D2E8BA", x"D30998", x"D32A99", x"D34BBA", x"D36CFD", x"D38E60",
+         x"D3AFE2", x"D3D183", x"D3F342", x"D4151E", x"D43717", x"D4592A", x"D47B57", x"D49D9E",
+         x"D4BFFC", x"D4E270", x"D504FA", x"D52798", x"D54A49", x"D56D0B", x"D58FDD", x"D5B2BE",
+         x"D5D5AC", x"D5F8A5", x"D61BA9", x"D63EB6", x"D661CA", x"D684E4", x"D6A803", x"D6CB24",
+         x"D6EE47", x"D71169", x"D7348B", x"D757A9", x"D77AC3", x"D79DD8", x"D7C0E5", x"D7E3EA",
+         x"D806E6", x"D829D7", x"D84CBB", x"D86F92", x"D8925B", x"D8B514", x"D8D7BC", x"D8FA53",
+         x"D91CD8", x"D93F48", x"D961A5", x"D983EC", x"D9A61E", x"D9C839", x"D9EA3D", x"DA0C29",
+         x"DA2DFD", x"DA4FB8", x"DA715A", x"DA92E3", x"DAB452", x"DAD5A8", x"DAF6E4", x"DB1805",
+         x"DB390D", x"DB59FB", x"DB7ACF", x"DB9B8A", x"DBBC2B", x"DBDCB4", x"DBFD23", x"DC1D7B",
+         x"DC3DBA", x"DC5DE3", x"DC7DF5", x"DC9DF1", x"DCBDD7", x"DCDDA9", x"DCFD67", x"DD1D12",
+         x"DD3CAB", x"DD5C33", x"DD7BAA", x"DD9B12", x"DDBA6C", x"DDD9B8", x"DDF8F7", x"DE182C",
+         x"DE3756", x"DE5677", x"DE7590", x"DE94A3", x"DEB3AF", x"DED2B7", x"DEF1BC", x"DF10BE",
+         x"DF2FBF", x"DF4EC0", x"DF6DC2", x"DF8CC7", x"DFABCE", x"DFCADB", x"DFE9ED", x"E00905",
+         x"E02825", x"E0474E", x"E06681", x"E085BE", x"E0A506", x"E0C45B", x"E0E3BE", x"E1032E",
+         x"E122AE", x"E1423D", x"E161DC", x"E1818D", x"E1A14F", x"E1C123", x"E1E10A", x"E20105",
+         x"E22113", x"E24135", x"E2616B", x"E281B6", x"E2A216", x"E2C28A", x"E2E315", x"E303B4",
+         x"E32468", x"E34532", x"E36611", x"E38705", x"E3A80E", x"E3C92B", x"E3EA5D", x"E40BA2",
+         x"E42CFC", x"E44E69", x"E46FE8", x"E4917A", x"E4B31D", x"E4D4D2", x"E4F697", x"E5186C",
+         x"E53A50", x"E55C42", x"E57E43", x"E5A050", x"E5C269", x"E5E48D", x"E606BC", x"E628F5",
+         x"E64B36", x"E66D7E", x"E68FCE", x"E6B223", x"E6D47D", x"E6F6DB", x"E7193C", x"E73B9F",
+         x"E75E03", x"E78066", x"E7A2C9", x"E7C52A", x"E7E788", x"E809E2", x"E82C38", x"E84E88",
+         x"E870D1", x"E89313", x"E8B54C", x"E8D77D", x"E8F9A3", x"E91BBF", x"E93DCF", x"E95FD3",
+         x"E981CA", x"E9A3B4", x"E9C590", x"E9E75C", x"EA091A", x"EA2AC8", x"EA4C65", x"EA6DF2",
+         x"EA8F6E", x"EAB0D8", x"EAD230", x"EAF377", x"EB14AB", x"EB35CD", x"EB56DD", x"EB77DA",
+         x"EB98C4", x"EBB99C", x"EBDA61", x"EBFB13", x"EC1BB4", x"EC3C42", x"EC5CBE", x"EC7D29",
+         x"EC9D82", x"ECBDCB", x"ECDE02", x"ECFE2A", x"ED1E42", x"ED3E4B", x"ED5E45", x"ED7E31",
+         x"ED9E0F", x"EDBDE1", x"EDDDA7", x"EDFD61", x"EE1D10", x"EE3CB5", x"EE5C51", x"EE7BE5",
+         x"EE9B70", x"EEBAF5", x"EEDA74", x"EEF9EE", x"EF1963", x"EF38D5", x"EF5845", x"EF77B2",
+         x"EF971F", x"EFB68B", x"EFD5F9", x"EFF568", x"F014DA", x"F0344F", x"F053C9", x"F07348",
+         x"F092CC", x"F0B258", x"F0D1EA", x"F0F186", x"F1112A", x"F130D8", x"F15090", x"F17053",
+         x"F19022", x"F1AFFE", x"F1CFE6", x"F1EFDC", x"F20FE0", x"F22FF2", x"F25013", x"F27043",
+         x"F29083", x"F2B0D3", x"F2D133", x"F2F1A4", x"F31225", x"F332B8", x"F3535B", x"F3740F",
+         x"F394D5", x"F3B5AC", x"F3D693", x"F3F78C", x"F41896", x"F439B1", x"F45ADC", x"F47C17",
+         x"F49D63", x"F4BEBE", x"F4E028", x"F501A2", x"F5232A", x"F544C0", x"F56664", x"F58815",
+         x"F5A9D3", x"F5CB9C", x"F5ED71", x"F60F50", x"F6313A", x"F6532D", x"F67529", x"F6972C",
+         x"F6B937", x"F6DB48", x"F6FD5F", x"F71F7B", x"F7419B", x"F763BE", x"F785E3", x"F7A80B",
+         x"F7CA33", x"F7EC5B", x"F80E82", x"F830A7", x"F852CB", x"F874EA", x"F89706", x"F8B91D",
+         x"F8DB2F", x"F8FD3A", x"F91F3D", x"F94139", x"F9632D", x"F98517", x"F9A6F7", x"F9C8CD",
+         x"F9EA98", x"FA0C57", x"FA2E09", x"FA4FAF", x"FA7148", x"FA92D3", x"FAB44F", x"FAD5BD",
+         x"FAF71C", x"FB186C", x"FB39AC", x"FB5ADC", x"FB7BFC", x"FB9D0D", x"FBBE0C", x"FBDEFC",
+         x"FBFFDB", x"FC20A9", x"FC4167", x"FC6215", x"FC82B2", x"FCA33F", x"FCC3BC", x"FCE429",
+         x"FD0487", x"FD24D6", x"FD4516", x"FD6547", x"FD856A", x"FDA57F", x"FDC588", x"FDE583",
+         x"FE0573", x"FE2556", x"FE452F", x"FE64FE", x"FE84C2", x"FEA47D", x"FEC430", x"FEE3DC",
+         x"FF0380", x"FF231E", x"FF42B6", x"FF624A", x"FF81D9", x"FFA166", x"FFC0F0", x"FFE078",
+         x"000000", x"001F88", x"003F10", x"005E9A", x"007E27", x"009DB6", x"00BD4A", x"00DCE2",
+         x"00FC80", x"011C24", x"013BD0", x"015B83", x"017B3E", x"019B02", x"01BAD1", x"01DAAA",
+         x"01FA8D", x"021A7D", x"023A78", x"025A81", x"027A96", x"029AB9", x"02BAEA", x"02DB2A",
+         x"02FB79", x"031BD7", x"033C44", x"035CC1", x"037D4E", x"039DEB", x"03BE99", x"03DF57",
+         x"040025", x"042104", x"0441F4", x"0462F3", x"048404", x"04A524", x"04C654", x"04E794",
+         x"0508E4", x"052A43", x"054BB1", x"056D2D", x"058EB8", x"05B051", x"05D1F7", x"05F3A9",
+         x"061568", x"063733", x"065909", x"067AE9", x"069CD3", x"06BEC7", x"06E0C3", x"0702C6",
+         x"0724D1", x"0746E3", x"0768FA", x"078B16", x"07AD35", x"07CF59", x"07F17E", x"0813A5",
+         x"0835CD", x"0857F5", x"087A1D", x"089C42", x"08BE65", x"08E085", x"0902A1", x"0924B8",
+         x"0946C9", x"0968D4", x"098AD7", x"09ACD3", x"09CEC6", x"09F0B0", x"0A128F", x"0A3464",
+         x"0A562D", x"0A77EB", x"0A999C", x"0ABB40", x"0ADCD6", x"0AFE5E", x"0B1FD8", x"0B4142",
+         x"0B629D", x"0B83E9", x"0BA524", x"0BC64F", x"0BE76A", x"0C0874", x"0C296D", x"0C4A54",
+         x"0C6B2B", x"0C8BF1", x"0CACA5", x"0CCD48", x"0CEDDB", x"0D0E5C", x"0D2ECD", x"0D4F2D",
+         x"0D6F7D", x"0D8FBD", x"0DAFED", x"0DD00E", x"0DF020", x"0E1024", x"0E301A", x"0E5002",
+         x"0E6FDE", x"0E8FAD", x"0EAF70", x"0ECF28", x"0EEED6", x"0F0E7A", x"0F2E16", x"0F4DA8",
+         x"0F6D34", x"0F8CB8", x"0FAC37", x"0FCBB1", x"0FEB26", x"100A98", x"102A07", x"104975",
+         x"1068E1", x"10884E", x"10A7BB", x"10C72B", x"10E69D", x"110612", x"11258C", x"11450B",
+         x"116490", x"11841B", x"11A3AF", x"11C34B", x"11E2F0", x"12029F", x"122259", x"12421F",
+         x"1261F1", x"1281CF", x"12A1BB", x"12C1B5", x"12E1BE", x"1301D6", x"1321FE", x"134235",
+         x"13627E", x"1382D7", x"13A342", x"13C3BE", x"13E44C", x"1404ED", x"14259F", x"144664",
+         x"14673C", x"148826", x"14A923", x"14CA33", x"14EB55", x"150C89", x"152DD0", x"154F28",
+         x"157092", x"15920E", x"15B39B", x"15D538", x"15F6E6", x"1618A4", x"163A70", x"165C4C",
+         x"167E36", x"16A02D", x"16C231", x"16E441", x"17065D", x"172883", x"174AB4", x"176CED",
+         x"178F2F", x"17B178", x"17D3C8", x"17F61E", x"181878", x"183AD6", x"185D37", x"187F9A",
+         x"18A1FD", x"18C461", x"18E6C4", x"190925", x"192B83", x"194DDD", x"197032", x"199282",
+         x"19B4CA", x"19D70B", x"19F944", x"1A1B73", x"1A3D97", x"1A5FB0", x"1A81BD", x"1AA3BE",
+         x"1AC5B0", x"1AE794", x"1B0969", x"1B2B2E", x"1B4CE3", x"1B6E86", x"1B9018", x"1BB197",
+         x"1BD304", x"1BF45E", x"1C15A3", x"1C36D5", x"1C57F2", x"1C78FB", x"1C99EF", x"1CBACE",
+         x"1CDB98", x"1CFC4C", x"1D1CEB", x"1D3D76", x"1D5DEA", x"1D7E4A", x"1D9E95", x"1DBECB",
+         x"1DDEED", x"1DFEFB", x"1E1EF6", x"1E3EDD", x"1E5EB1", x"1E7E73", x"1E9E24", x"1EBDC3",
+         x"1EDD52", x"1EFCD2", x"1F1C42", x"1F3BA5", x"1F5AFA", x"1F7A42", x"1F997F", x"1FB8B2",
+         x"1FD7DB", x"1FF6FB", x"201613", x"203525", x"205432", x"207339", x"20923E", x"20B140",
+         x"20D041", x"20EF42", x"210E44", x"212D49", x"214C51", x"216B5D", x"218A70", x"21A989",
+         x"21C8AA", x"21E7D4", x"220709", x"222648", x"224594", x"2264EE", x"228456", x"22A3CD",
+         x"22C355", x"22E2EE", x"230299", x"232257", x"234229", x"23620F", x"23820B", x"23A21D",
+         x"23C246", x"23E285", x"2402DD", x"24234C", x"2443D5", x"246476", x"248531", x"24A605",
+         x"24C6F3", x"24E7FB", x"25091C", x"252A58", x"254BAE", x"256D1D", x"258EA6", x"25B048",
+         x"25D203", x"25F3D7", x"2615C3", x"2637C7", x"2659E2", x"267C14", x"269E5B", x"26C0B8",
+         x"26E328", x"2705AD", x"272844", x"274AEC", x"276DA5", x"27906E", x"27B345", x"27D629",
+         x"27F91A", x"281C16", x"283F1B", x"286228", x"28853D", x"28A857", x"28CB75", x"28EE97",
+         x"2911B9", x"2934DC", x"2957FD", x"297B1C", x"299E36", x"29C14A", x"29E457", x"2A075B",
+         x"2A2A54", x"2A4D42", x"2A7023", x"2A92F5", x"2AB5B7", x"2AD868", x"2AFB06", x"2B1D90",
+         x"2B4004", x"2B6262", x"2B84A9", x"2BA6D6", x"2BC8E9", x"2BEAE2", x"2C0CBE", x"2C2E7D",
+         x"2C501E", x"2C71A0", x"2C9303", x"2CB446", x"2CD567", x"2CF668", x"2D1746", x"2D3802",
+         x"2D589C", x"2D7913", x"2D9967", x"2DB998", x"2DD9A6", x"2DF990", x"2E1959", x"2E38FE",
+         x"2E5882", x"2E77E3", x"2E9724", x"2EB644", x"2ED544", x"2EF425", x"2F12E7", x"2F318D",
+         x"2F5016", x"2F6E84", x"2F8CD8", x"2FAB13", x"2FC937", x"2FE745", x"30053F", x"302326",
+         x"3040FB", x"305EC2", x"307C7A", x"309A27", x"30B7C9", x"30D564", x"30F2F8", x"311088",
+         x"312E16", x"314BA4", x"316934", x"3186C8", x"31A463", x"31C207", x"31DFB5", x"31FD70",
+         x"321B3B", x"323917", x"325707", x"32750C", x"32932A", x"32B161", x"32CFB5", x"32EE28",
+         x"330CBB", x"332B70", x"334A4A", x"33694A", x"338872", x"33A7C4", x"33C742", x"33E6ED",
+         x"3406C7", x"3426D1", x"34470D", x"34677C", x"348820", x"34A8F8", x"34CA07", x"34EB4D",
+         x"350CCB", x"352E82", x"355071", x"35729A", x"3594FD", x"35B799", x"35DA6F", x"35FD7F",
+         x"3620C8", x"36444A", x"366804", x"368BF6", x"36B01E", x"36D47C", x"36F90E", x"371DD3",
+         x"3742CA", x"3767F0", x"378D44", x"37B2C4", x"37D86E", x"37FE40", x"382436", x"384A4F",
+         x"387087", x"3896DC", x"38BD4A", x"38E3CF", x"390A67", x"39310F", x"3957C2", x"397E7D",
+         x"39A53C", x"39CBFB", x"39F2B6", x"3A1968", x"3A400E", x"3A66A2", x"3A8D20", x"3AB382",
+         x"3AD9C6", x"3AFFE4", x"3B25D8", x"3B4B9E", x"3B712F", x"3B9687", x"3BBBA1", x"3BE076",
+         x"3C0501", x"3C293E", x"3C4D25", x"3C70B3", x"3C93E1", x"3CB6A9", x"3CD906", x"3CFAF3",
+         x"3D1C69", x"3D3D64", x"3D5DDD", x"3D7DCF", x"3D9D34", x"3DBC07", x"3DDA43", x"3DF7E2",
+         x"3E14DF", x"3E3134", x"3E4CDC", x"3E67D3", x"3E8213", x"3E9B98", x"3EB45C", x"3ECC5B",
+         x"3EE390", x"3EF9F7", x"3F0F8B", x"3F2449", x"3F382D", x"3F4B31", x"3F5D54", x"3F6E90",
+         x"3F7EE3", x"3F8E4A", x"3F9CC1", x"3FAA46", x"3FB6D5", x"3FC26C", x"3FCD0A", x"3FD6AB",
+         x"3FDF4E", x"3FE6F1", x"3FED93", x"3FF331", x"3FF7CC", x"3FFB62", x"3FFDF2", x"3FFF7C",
+         x"3FFFFF", x"3FFF7C", x"3FFDF2", x"3FFB62", x"3FF7CC", x"3FF331", x"3FED93", x"3FE6F1",
+         x"3FDF4E", x"3FD6AB", x"3FCD0A", x"3FC26C", x"3FB6D5", x"3FAA46", x"3F9CC1", x"3F8E4A",
+         x"3F7EE3", x"3F6E90", x"3F5D54", x"3F4B31", x"3F382D", x"3F2449", x"3F0F8B", x"3EF9F7",
+         x"3EE390", x"3ECC5B", x"3EB45C", x"3E9B98", x"3E8213", x"3E67D3", x"3E4CDC", x"3E3134",
+         x"3E14DF", x"3DF7E2", x"3DDA43", x"3DBC07", x"3D9D34", x"3D7DCF", x"3D5DDD", x"3D3D64",
+         x"3D1C69", x"3CFAF3", x"3CD906", x"3CB6A9", x"3C93E1", x"3C70B3", x"3C4D25", x"3C293E",
+         x"3C0501", x"3BE076", x"3BBBA1", x"3B9687", x"3B712F", x"3B4B9E", x"3B25D8", x"3AFFE4",
+         x"3AD9C6", x"3AB382", x"3A8D20", x"3A66A2", x"3A400E", x"3A1968", x"39F2B6", x"39CBFB",
+         x"39A53C", x"397E7D", x"3957C2", x"39310F", x"390A67", x"38E3CF", x"38BD4A", x"3896DC",
+         x"387087", x"384A4F", x"382436", x"37FE40", x"37D86E", x"37B2C4", x"378D44", x"3767F0",
+         x"3742CA", x"371DD3", x"36F90E", x"36D47C", x"36B01E", x"368BF6", x"366804", x"36444A",
+         x"3620C8", x"35FD7F", x"35DA6F", x"35B799", x"3594FD", x"35729A", x"355071", x"352E82",
+         x"350CCB", x"34EB4D", x"34CA07", x"34A8F8", x"348820", x"34677C", x"34470D", x"3426D1",
+         x"3406C7", x"33E6ED", x"33C742", x"33A7C4", x"338872", x"33694A", x"334A4A", x"332B70",
+         x"330CBB", x"32EE28", x"32CFB5", x"32B161", x"32932A", x"32750C", x"325707", x"323917",
+         x"321B3B", x"31FD70", x"31DFB5", x"31C207", x"31A463", x"3186C8", x"316934", x"314BA4",
+         x"312E16", x"311088", x"30F2F8", x"30D564", x"30B7C9", x"309A27", x"307C7A", x"305EC2",
+         x"3040FB", x"302326", x"30053F", x"2FE745", x"2FC937", x"2FAB13", x"2F8CD8", x"2F6E84",
+         x"2F5016", x"2F318D", x"2F12E7", x"2EF425", x"2ED544", x"2EB644", x"2E9724", x"2E77E3",
+         x"2E5882", x"2E38FE", x"2E1959", x"2DF990", x"2DD9A6", x"2DB998", x"2D9967", x"2D7913",
+         x"2D589C", x"2D3802", x"2D1746", x"2CF668", x"2CD567", x"2CB446", x"2C9303", x"2C71A0",
+         x"2C501E", x"2C2E7D", x"2C0CBE", x"2BEAE2", x"2BC8E9", x"2BA6D6", x"2B84A9", x"2B6262",
+         x"2B4004", x"2B1D90", x"2AFB06", x"2AD868", x"2AB5B7", x"2A92F5", x"2A7023", x"2A4D42",
+         x"2A2A54", x"2A075B", x"29E457", x"29C14A", x"299E36", x"297B1C", x"2957FD", x"2934DC",
+         x"2911B9", x"28EE97", x"28CB75", x"28A857", x"28853D", x"286228", x"283F1B", x"281C16",
+         x"27F91A", x"27D629", x"27B345", x"27906E", x"276DA5", x"274AEC", x"272844", x"2705AD",
+         x"26E328", x"26C0B8", x"269E5B", x"267C14", x"2659E2", x"2637C7", x"2615C3", x"25F3D7",
+         x"25D203", x"25B048", x"258EA6", x"256D1D", x"254BAE", x"252A58", x"25091C", x"24E7FB",
+         x"24C6F3", x"24A605", x"248531", x"246476", x"2443D5", x"24234C", x"2402DD", x"23E285",
+         x"23C246", x"23A21D", x"23820B", x"23620F", x"234229", x"232257", x"230299", x"22E2EE",
+         x"22C355", x"22A3CD", x"228456", x"2264EE", x"224594", x"222648", x"220709", x"21E7D4",
+         x"21C8AA", x"21A989", x"218A70", x"216B5D", x"214C51", x"212D49", x"210E44", x"20EF42",
+         x"20D041", x"20B140", x"20923E", x"207339", x"205432", x"203525", x"201613", x"1FF6FB",
+         x"1FD7DB", x"1FB8B2", x"1F997F", x"1F7A42", x"1F5AFA", x"1F3BA5", x"1F1C42", x"1EFCD2",
+         x"1EDD52", x"1EBDC3", x"1E9E24", x"1E7E73", x"1E5EB1", x"1E3EDD", x"1E1EF6", x"1DFEFB",
+         x"1DDEED", x"1DBECB", x"1D9E95", x"1D7E4A", x"1D5DEA", x"1D3D76", x"1D1CEB", x"1CFC4C",
+         x"1CDB98", x"1CBACE", x"1C99EF", x"1C78FB", x"1C57F2", x"1C36D5", x"1C15A3", x"1BF45E",
+         x"1BD304", x"1BB197", x"1B9018", x"1B6E86", x"1B4CE3", x"1B2B2E", x"1B0969", x"1AE794",
+         x"1AC5B0", x"1AA3BE", x"1A81BD", x"1A5FB0", x"1A3D97", x"1A1B73", x"19F944", x"19D70B",
+         x"19B4CA", x"199282", x"197032", x"194DDD", x"192B83", x"190925", x"18E6C4", x"18C461",
+         x"18A1FD", x"187F9A", x"185D37", x"183AD6", x"181878", x"17F61E", x"17D3C8", x"17B178",
+         x"178F2F", x"176CED", x"174AB4", x"172883", x"17065D", x"16E441", x"16C231", x"16A02D",
+         x"167E36", x"165C4C", x"163A70", x"1618A4", x"15F6E6", x"15D538", x"15B39B", x"15920E",
+         x"157092", x"154F28", x"152DD0", x"150C89", x"14EB55", x"14CA33", x"14A923", x"148826",
+         x"14673C", x"144664", x"14259F", x"1404ED", x"13E44C", x"13C3BE", x"13A342", x"1382D7",
+         x"13627E", x"134235", x"1321FE", x"1301D6", x"12E1BE", x"12C1B5", x"12A1BB", x"1281CF",
+         x"1261F1", x"12421F", x"122259", x"12029F", x"11E2F0", x"11C34B", x"11A3AF", x"11841B",
+         x"116490", x"11450B", x"11258C", x"110612", x"10E69D", x"10C72B", x"10A7BB", x"10884E",
+         x"1068E1", x"104975", x"102A07", x"100A98", x"0FEB26", x"0FCBB1", x"0FAC37", x"0F8CB8",
+         x"0F6D34", x"0F4DA8", x"0F2E16", x"0F0E7A", x"0EEED6", x"0ECF28", x"0EAF70", x"0E8FAD",
+         x"0E6FDE", x"0E5002", x"0E301A", x"0E1024", x"0DF020", x"0DD00E", x"0DAFED", x"0D8FBD",
+         x"0D6F7D", x"0D4F2D", x"0D2ECD", x"0D0E5C", x"0CEDDB", x"0CCD48", x"0CACA5", x"0C8BF1",
+         x"0C6B2B", x"0C4A54", x"0C296D", x"0C0874", x"0BE76A", x"0BC64F", x"0BA524", x"0B83E9",
+         x"0B629D", x"0B4142", x"0B1FD8", x"0AFE5E", x"0ADCD6", x"0ABB40", x"0A999C", x"0A77EB",
+         x"0A562D", x"0A3464", x"0A128F", x"09F0B0", x"09CEC6", x"09ACD3", x"098AD7", x"0968D4",
+         x"0946C9", x"0924B8", x"0902A1", x"08E085", x"08BE65", x"089C42", x"087A1D", x"0857F5",
+         x"0835CD", x"0813A5", x"07F17E", x"07CF59", x"07AD35", x"078B16", x"0768FA", x"0746E3",
+         x"0724D1", x"0702C6", x"06E0C3", x"06BEC7", x"069CD3", x"067AE9", x"065909", x"063733",
+         x"061568", x"05F3A9", x"05D1F7", x"05B051", x"058EB8", x"056D2D", x"054BB1", x"052A43",
+         x"0508E4", x"04E794", x"04C654", x"04A524", x"048404", x"0462F3", x"0441F4", x"042104",
+         x"040025", x"03DF57", x"03BE99", x"039DEB", x"037D4E", x"035CC1", x"033C44", x"031BD7",
+         x"02FB79", x"02DB2A", x"02BAEA", x"029AB9", x"027A96", x"025A81", x"023A78", x"021A7D",
+         x"01FA8D", x"01DAAA", x"01BAD1", x"019B02", x"017B3E", x"015B83", x"013BD0", x"011C24",
+         x"00FC80", x"00DCE2", x"00BD4A", x"009DB6", x"007E27", x"005E9A", x"003F10", x"001F88",
+         x"000000", x"FFE078", x"FFC0F0", x"FFA166", x"FF81D9", x"FF624A", x"FF42B6", x"FF231E",
+         x"FF0380", x"FEE3DC", x"FEC430", x"FEA47D", x"FE84C2", x"FE64FE", x"FE452F", x"FE2556",
+         x"FE0573", x"FDE583", x"FDC588", x"FDA57F", x"FD856A", x"FD6547", x"FD4516", x"FD24D6",
+         x"FD0487", x"FCE429", x"FCC3BC", x"FCA33F", x"FC82B2", x"FC6215", x"FC4167", x"FC20A9",
+         x"FBFFDB", x"FBDEFC", x"FBBE0C", x"FB9D0D", x"FB7BFC", x"FB5ADC", x"FB39AC", x"FB186C",
+         x"FAF71C", x"FAD5BD", x"FAB44F", x"FA92D3", x"FA7148", x"FA4FAF", x"FA2E09", x"FA0C57",
+         x"F9EA98", x"F9C8CD", x"F9A6F7", x"F98517", x"F9632D", x"F94139", x"F91F3D", x"F8FD3A",
+         x"F8DB2F", x"F8B91D", x"F89706", x"F874EA", x"F852CB", x"F830A7", x"F80E82", x"F7EC5B",
+         x"F7CA33", x"F7A80B", x"F785E3", x"F763BE", x"F7419B", x"F71F7B", x"F6FD5F", x"F6DB48",
+         x"F6B937", x"F6972C", x"F67529", x"F6532D", x"F6313A", x"F60F50", x"F5ED71", x"F5CB9C",
+         x"F5A9D3", x"F58815", x"F56664", x"F544C0", x"F5232A", x"F501A2", x"F4E028", x"F4BEBE",
+         x"F49D63", x"F47C17", x"F45ADC", x"F439B1", x"F41896", x"F3F78C", x"F3D693", x"F3B5AC",
+         x"F394D5", x"F3740F", x"F3535B", x"F332B8", x"F31225", x"F2F1A4", x"F2D133", x"F2B0D3",
+         x"F29083", x"F27043", x"F25013", x"F22FF2", x"F20FE0", x"F1EFDC", x"F1CFE6", x"F1AFFE",
+         x"F19022", x"F17053", x"F15090", x"F130D8", x"F1112A", x"F0F186", x"F0D1EA", x"F0B258",
+         x"F092CC", x"F07348", x"F053C9", x"F0344F", x"F014DA", x"EFF568", x"EFD5F9", x"EFB68B",
+         x"EF971F", x"EF77B2", x"EF5845", x"EF38D5", x"EF1963", x"EEF9EE", x"EEDA74", x"EEBAF5",
+         x"EE9B70", x"EE7BE5", x"EE5C51", x"EE3CB5", x"EE1D10", x"EDFD61", x"EDDDA7", x"EDBDE1",
+         x"ED9E0F", x"ED7E31", x"ED5E45", x"ED3E4B", x"ED1E42", x"ECFE2A", x"ECDE02", x"ECBDCB",
+         x"EC9D82", x"EC7D29", x"EC5CBE", x"EC3C42", x"EC1BB4", x"EBFB13", x"EBDA61", x"EBB99C",
+         x"EB98C4", x"EB77DA", x"EB56DD", x"EB35CD", x"EB14AB", x"EAF377", x"EAD230", x"EAB0D8",
+         x"EA8F6E", x"EA6DF2", x"EA4C65", x"EA2AC8", x"EA091A", x"E9E75C", x"E9C590", x"E9A3B4",
+         x"E981CA", x"E95FD3", x"E93DCF", x"E91BBF", x"E8F9A3", x"E8D77D", x"E8B54C", x"E89313",
+         x"E870D1", x"E84E88", x"E82C38", x"E809E2", x"E7E788", x"E7C52A", x"E7A2C9", x"E78066",
+         x"E75E03", x"E73B9F", x"E7193C", x"E6F6DB", x"E6D47D", x"E6B223", x"E68FCE", x"E66D7E",
+         x"E64B36", x"E628F5", x"E606BC", x"E5E48D", x"E5C269", x"E5A050", x"E57E43", x"E55C42",
+         x"E53A50", x"E5186C", x"E4F697", x"E4D4D2", x"E4B31D", x"E4917A", x"E46FE8", x"E44E69",
+         x"E42CFC", x"E40BA2", x"E3EA5D", x"E3C92B", x"E3A80E", x"E38705", x"E36611", x"E34532",
+         x"E32468", x"E303B4", x"E2E315", x"E2C28A", x"E2A216", x"E281B6", x"E2616B", x"E24135",
+         x"E22113", x"E20105", x"E1E10A", x"E1C123", x"E1A14F", x"E1818D", x"E161DC", x"E1423D",
+         x"E122AE", x"E1032E", x"E0E3BE", x"E0C45B", x"E0A506", x"E085BE", x"E06681", x"E0474E",
+         x"E02825", x"E00905", x"DFE9ED", x"DFCADB", x"DFABCE", x"DF8CC7", x"DF6DC2", x"DF4EC0",
+         x"DF2FBF", x"DF10BE", x"DEF1BC", x"DED2B7", x"DEB3AF", x"DE94A3", x"DE7590", x"DE5677",
+         x"DE3756", x"DE182C", x"DDF8F7", x"DDD9B8", x"DDBA6C", x"DD9B12", x"DD7BAA", x"DD5C33",
+         x"DD3CAB", x"DD1D12", x"DCFD67", x"DCDDA9", x"DCBDD7", x"DC9DF1", x"DC7DF5", x"DC5DE3",
+         x"DC3DBA", x"DC1D7B", x"DBFD23", x"DBDCB4", x"DBBC2B", x"DB9B8A", x"DB7ACF", x"DB59FB",
+         x"DB390D", x"DB1805", x"DAF6E4", x"DAD5A8", x"DAB452", x"DA92E3", x"DA715A", x"DA4FB8",
+         x"DA2DFD", x"DA0C29", x"D9EA3D", x"D9C839", x"D9A61E", x"D983EC", x"D961A5", x"D93F48",
+         x"D91CD8", x"D8FA53", x"D8D7BC", x"D8B514", x"D8925B", x"D86F92", x"D84CBB", x"D829D7",
+         x"D806E6", x"D7E3EA", x"D7C0E5", x"D79DD8", x"D77AC3", x"D757A9", x"D7348B", x"D71169",
+         x"D6EE47", x"D6CB24", x"D6A803", x"D684E4", x"D661CA", x"D63EB6", x"D61BA9", x"D5F8A5",
+         x"D5D5AC", x"D5B2BE", x"D58FDD", x"D56D0B", x"D54A49", x"D52798", x"D504FA", x"D4E270",
+         x"D4BFFC", x"D49D9E", x"D47B57", x"D4592A", x"D43717", x"D4151E", x"D3F342", x"D3D183",
+         x"D3AFE2", x"D38E60", x"D36CFD", x"D34BBA", x"D32A99", x"D30998", x"D2E8BA", x"D2C7FE",
+         x"D2A764", x"D286ED", x"D26699", x"D24668", x"D2265A", x"D20670", x"D1E6A7", x"D1C702",
+         x"D1A77E", x"D1881D", x"D168DC", x"D149BC", x"D12ABC", x"D10BDB", x"D0ED19", x"D0CE73",
+         x"D0AFEA", x"D0917C", x"D07328", x"D054ED", x"D036C9", x"D018BB", x"CFFAC1", x"CFDCDA",
+         x"CFBF05", x"CFA13E", x"CF8386", x"CF65D9", x"CF4837", x"CF2A9C", x"CF0D08", x"CEEF78",
+         x"CED1EA", x"CEB45C", x"CE96CC", x"CE7938", x"CE5B9D", x"CE3DF9", x"CE204B", x"CE0290",
+         x"CDE4C5", x"CDC6E9", x"CDA8F9", x"CD8AF4", x"CD6CD6", x"CD4E9F", x"CD304B", x"CD11D8",
+         x"CCF345", x"CCD490", x"CCB5B6", x"CC96B6", x"CC778E", x"CC583C", x"CC38BE", x"CC1913",
+         x"CBF939", x"CBD92F", x"CBB8F3", x"CB9884", x"CB77E0", x"CB5708", x"CB35F9", x"CB14B3",
+         x"CAF335", x"CAD17E", x"CAAF8F", x"CA8D66", x"CA6B03", x"CA4867", x"CA2591", x"CA0281",
+         x"C9DF38", x"C9BBB6", x"C997FC", x"C9740A", x"C94FE2", x"C92B84", x"C906F2", x"C8E22D",
+         x"C8BD36", x"C89810", x"C872BC", x"C84D3C", x"C82792", x"C801C0", x"C7DBCA", x"C7B5B1",
+         x"C78F79", x"C76924", x"C742B6", x"C71C31", x"C6F599", x"C6CEF1", x"C6A83E", x"C68183",
+         x"C65AC4", x"C63405", x"C60D4A", x"C5E698", x"C5BFF2", x"C5995E", x"C572E0", x"C54C7E",
+         x"C5263A", x"C5001C", x"C4DA28", x"C4B462", x"C48ED1", x"C46979", x"C4445F", x"C41F8A",
+         x"C3FAFF", x"C3D6C2", x"C3B2DB", x"C38F4D", x"C36C1F", x"C34957", x"C326FA", x"C3050D",
+         x"C2E397", x"C2C29C", x"C2A223", x"C28231", x"C262CC", x"C243F9", x"C225BD", x"C2081E",
+         x"C1EB21", x"C1CECC", x"C1B324", x"C1982D", x"C17DED", x"C16468", x"C14BA4", x"C133A5",
+         x"C11C70", x"C10609", x"C0F075", x"C0DBB7", x"C0C7D3", x"C0B4CF", x"C0A2AC", x"C09170",
+         x"C0811D", x"C071B6", x"C0633F", x"C055BA", x"C0492B", x"C03D94", x"C032F6", x"C02955",
+         x"C020B2", x"C0190F", x"C0126D", x"C00CCF", x"C00834", x"C0049E", x"C0020E", x"C00084"),
+        -- octave 7
+        (x"C00001", x"C00044", x"C0010F", x"C0025F", x"C00437", x"C00695", x"C0097A", x"C00CE5",
+         x"C010D6", x"C0154D", x"C01A4A", x"C01FCC", x"C025D3", x"C02C5F", x"C03370", x"C03B05",
+         x"C0431E", x"C04BBA", x"C054DA", x"C05E7B", x"C0689F", x"C07344", x"C07E6B", x"C08A11",
+         x"C09638", x"C0A2DE", x"C0B002", x"C0BDA4", x"C0CBC4", x"C0DA60", x"C0E978", x"C0F90C",
+         x"C10919", x"C119A0", x"C12AA0", x"C13C18", x"C14E07", x"C1606C", x"C17346", x"C18694",
+         x"C19A56", x"C1AE8B", x"C1C331", x"C1D847", x"C1EDCD", x"C203C1", x"C21A23", x"C230F0",
+         x"C24829", x"C25FCD", x"C277D9", x"C2904D", x"C2A927", x"C2C267", x"C2DC0C", x"C2F613",
+         x"C3107D", x"C32B47", x"C34670", x"C361F8", x"C37DDC", x"C39A1D", x"C3B6B7", x"C3D3AA",
+         x"C3F0F6", x"C40E97", x"C42C8E", x"C44AD8", x"C46974", x"C48862", x"C4A79F", x"C4C72A",
+         x"C4E703", x"C50726", x"C52794", x"C5484A", x"C56947", x"C58A8A", x"C5AC12", x"C5CDDC",
+         x"C5EFE8", x"C61234", x"C634BF", x"C65787", x"C67A8B", x"C69DC8", x"C6C13F", x"C6E4ED",
+         x"C708D1", x"C72CEA", x"C75136", x"C775B3", x"C79A61", x"C7BF3D", x"C7E447", x"C8097D",
+         x"C82EDD", x"C85466", x"C87A16", x"C89FED", x"C8C5E9", x"C8EC08", x"C91249", x"C938AB",
+         x"C95F2C", x"C985CB", x"C9AC86", x"C9D35C", x"C9FA4C", x"CA2155", x"CA4875", x"CA6FAA",
+         x"CA96F4", x"CABE51", x"CAE5C0", x"CB0D3F", x"CB34CE", x"CB5C6A", x"CB8414", x"CBABC9",
+         x"CBD388", x"CBFB51", x"CC2322", x"CC4AF9", x"CC72D6", x"CC9AB7", x"CCC29C", x"CCEA82",
+         x"CD126A", x"CD3A52", x"CD6239", x"CD8A1E", x"CDB1FF", x"CDD9DD", x"CE01B5", x"CE2987",
+         x"CE5152", x"CE7914", x"CEA0CE", x"CEC87E", x"CEF022", x"CF17BB", x"CF3F48", x"CF66C7",
+         x"CF8E38", x"CFB599", x"CFDCEB", x"D0042C", x"D02B5C", x"D0527A", x"D07985", x"D0A07C",
+         x"D0C75F", x"D0EE2E", x"D114E7", x"D13B8A", x"D16216", x"D1888B", x"D1AEE8", x"D1D52D",
+         x"D1FB59", x"D2216C", x"D24765", x"D26D45", x"D29309", x"D2B8B2", x"D2DE40", x"D303B3",
+         x"D32909", x"D34E42", x"D3735F", x"D3985F", x"D3BD42", x"D3E207", x"D406AF", x"D42B39",
+         x"D44FA4", x"D473F1", x"D49820", x"D4BC30", x"D4E022", x"D503F5", x"D527A9", x"D54B3E",
+         x"D56EB4", x"D5920B", x"D5B544", x"D5D85E", x"D5FB58", x"D61E35", x"D640F2", x"D66391",
+         x"D68611", x"D6A873", x"D6CAB7", x"D6ECDD", x"D70EE5", x"D730D0", x"D7529D", x"D7744D",
+         x"D795DF", x"D7B756", x"D7D8AF", x"D7F9ED", x"D81B0F", x"D83C15", x"D85D00", x"D87DD0",
+         x"D89E86", x"D8BF21", x"D8DFA3", x"D9000C", x"D9205B", x"D94092", x"D960B1", x"D980B8",
+         x"D9A0A8", x"D9C081", x"D9E044", x"D9FFF1", x"DA1F89", x"DA3F0C", x"DA5E7A", x"DA7DD5",
+         x"DA9D1C", x"DABC51", x"DADB73", x"DAFA84", x"DB1983", x"DB3872", x"DB5751", x"DB7620",
+         x"DB94E1", x"DBB393", x"DBD237", x"DBF0CE", x"DC0F59", x"DC2DD8", x"DC4C4B", x"DC6AB3",
+         x"DC8912", x"DCA766", x"DCC5B2", x"DCE3F5", x"DD0231", x"DD2065", x"DD3E93", x"DD5CBA",
+         x"DD7ADD", x"DD98FA", x"DDB714", x"DDD529", x"DDF33C", x"DE114D", x"DE2F5C", x"DE4D69",
+         x"DE6B76", x"DE8983", x"DEA791", x"DEC59F", x"DEE3B0", x"DF01C3", x"DF1FD8", x"DF3DF1",
+         x"DF5C0E", x"DF7A30", x"DF9857", x"DFB683", x"DFD4B6", x"DFF2EF", x"E0112F", x"E02F77",
+         x"E04DC7", x"E06C20", x"E08A82", x"E0A8EE", x"E0C764", x"E0E5E5", x"E10470", x"E12307",
+         x"E141AA", x"E1605A", x"E17F16", x"E19DDF", x"E1BCB6", x"E1DB9B", x"E1FA8E", x"E21990",
+         x"E238A1", x"E257C2", x"E276F2", x"E29632", x"E2B583", x"E2D4E4", x"E2F456", x"E313DA",
+         x"E3336F", x"E35316", x"E372CF", x"E3929A", x"E3B277", x"E3D267", x"E3F26A", x"E41281",
+         x"E432AA", x"E452E7", x"E47337", x"E4939B", x"E4B413", x"E4D49E", x"E4F53E", x"E515F1",
+         x"E536B9", x"E55795", x"E57885", x"E5998A", x"E5BAA3", x"E5DBD0", x"E5FD12", x"E61E68",
+         x"E63FD2", x"E66150", x"E682E3", x"E6A48A", x"E6C645", x"E6E814", x"E709F6", x"E72BED",
+         x"E74DF7", x"E77015", x"E79247", x"E7B48B", x"E7D6E3", x"E7F94D", x"E81BCB", x"E83E5B",
+         x"E860FD", x"E883B1", x"E8A678", x"E8C950", x"E8EC39", x"E90F34", x"E93240", x"E9555C",
+         x"E97889", x"E99BC6", x"E9BF12", x"E9E26E", x"EA05DA", x"EA2954", x"EA4CDC", x"EA7073",
+         x"EA9418", x"EAB7CA", x"EADB8A", x"EAFF56", x"EB232F", x"EB4713", x"EB6B04", x"EB8EFF",
+         x"EBB306", x"EBD717", x"EBFB32", x"EC1F56", x"EC4384", x"EC67BB", x"EC8BFA", x"ECB041",
+         x"ECD490", x"ECF8E6", x"ED1D43", x"ED41A6", x"ED660E", x"ED8A7C", x"EDAEEF", x"EDD367",
+         x"EDF7E2", x"EE1C61", x"EE40E4", x"EE6569", x"EE89F0", x"EEAE79", x"EED303", x"EEF78E",
+         x"EF1C1A", x"EF40A6", x"EF6531", x"EF89BB", x"EFAE45", x"EFD2CC", x"EFF751", x"F01BD3",
+         x"F04052", x"F064CE", x"F08946", x"F0ADB9", x"F0D228", x"F0F691", x"F11AF5", x"F13F53",
+         x"F163AA", x"F187FB", x"F1AC44", x"F1D085", x"F1F4BF", x"F218F0", x"F23D19", x"F26138",
+         x"F2854E", x"F2A959", x"F2CD5B", x"F2F152", x"F3153E", x"F3391F", x"F35CF5", x"F380BF",
+         x"F3A47C", x"F3C82D", x"F3EBD1", x"F40F69", x"F432F3", x"F4566F", x"F479DE", x"F49D3E",
+         x"F4C090", x"F4E3D4", x"F50709", x"F52A2F", x"F54D46", x"F5704D", x"F59345", x"F5B62D",
+         x"F5D906", x"F5FBCE", x"F61E86", x"F6412E", x"F663C5", x"F6864C", x"F6A8C2", x"F6CB27",
+         x"F6ED7B", x"F70FBF", x"F731F1", x"F75412", x"F77623", x"F79822", x"F7BA10", x"F7DBEC",
+         x"F7FDB8", x"F81F72", x"F8411C", x"F862B4", x"F8843B", x"F8A5B1", x"F8C716", x"F8E86A",
+         x"F909AD", x"F92ADF", x"F94C01", x"F96D12", x"F98E13", x"F9AF03", x"F9CFE3", x"F9F0B4",
+         x"FA1174", x"FA3224", x"FA52C5", x"FA7357", x"FA93D9", x"FAB44C", x"FAD4B1", x"FAF507",
+         x"FB154F", x"FB3588", x"FB55B4", x"FB75D2", x"FB95E2", x"FBB5E6", x"FBD5DD", x"FBF5C7",
+         x"FC15A5", x"FC3577", x"FC553D", x"FC74F8", x"FC94A8", x"FCB44D", x"FCD3E8", x"FCF378",
+         x"FD12FF", x"FD327D", x"FD51F1", x"FD715D", x"FD90C1", x"FDB01C", x"FDCF70", x"FDEEBD",
+         x"FE0E03", x"FE2D42", x"FE4C7B", x"FE6BAF", x"FE8ADE", x"FEAA07", x"FEC92C", x"FEE84D",
+         x"FF076A", x"FF2684", x"FF459B", x"FF64B0", x"FF83C2", x"FFA2D3", x"FFC1E3", x"FFE0F2",
+         x"000000", x"001F0E", x"003E1D", x"005D2D", x"007C3E", x"009B50", x"00BA65", x"00D97C",
+         x"00F896", x"0117B3", x"0136D4", x"0155F9", x"017522", x"019451", x"01B385", x"01D2BE",
+         x"01F1FD", x"021143", x"023090", x"024FE4", x"026F3F", x"028EA3", x"02AE0F", x"02CD83",
+         x"02ED01", x"030C88", x"032C18", x"034BB3", x"036B58", x"038B08", x"03AAC3", x"03CA89",
+         x"03EA5B", x"040A39", x"042A23", x"044A1A", x"046A1E", x"048A2E", x"04AA4C", x"04CA78",
+         x"04EAB1", x"050AF9", x"052B4F", x"054BB4", x"056C27", x"058CA9", x"05AD3B", x"05CDDC",
+         x"05EE8C", x"060F4C", x"06301D", x"0650FD", x"0671ED", x"0692EE", x"06B3FF", x"06D521",
+         x"06F653", x"071796", x"0738EA", x"075A4F", x"077BC5", x"079D4C", x"07BEE4", x"07E08E",
+         x"080248", x"082414", x"0845F0", x"0867DE", x"0889DD", x"08ABEE", x"08CE0F", x"08F041",
+         x"091285", x"0934D9", x"09573E", x"0979B4", x"099C3B", x"09BED2", x"09E17A", x"0A0432",
+         x"0A26FA", x"0A49D3", x"0A6CBB", x"0A8FB3", x"0AB2BA", x"0AD5D1", x"0AF8F7", x"0B1C2C",
+         x"0B3F70", x"0B62C2", x"0B8622", x"0BA991", x"0BCD0D", x"0BF097", x"0C142F", x"0C37D3",
+         x"0C5B84", x"0C7F41", x"0CA30B", x"0CC6E1", x"0CEAC2", x"0D0EAE", x"0D32A5", x"0D56A7",
+         x"0D7AB2", x"0D9EC8", x"0DC2E7", x"0DE710", x"0E0B41", x"0E2F7B", x"0E53BC", x"0E7805",
+         x"0E9C56", x"0EC0AD", x"0EE50B", x"0F096F", x"0F2DD8", x"0F5247", x"0F76BA", x"0F9B32",
+         x"0FBFAE", x"0FE42D", x"1008AF", x"102D34", x"1051BB", x"107645", x"109ACF", x"10BF5A",
+         x"10E3E6", x"110872", x"112CFD", x"115187", x"117610", x"119A97", x"11BF1C", x"11E39F",
+         x"12081E", x"122C99", x"125111", x"127584", x"1299F2", x"12BE5A", x"12E2BD", x"13071A",
+         x"132B70", x"134FBF", x"137406", x"139845", x"13BC7C", x"13E0AA", x"1404CE", x"1428E9",
+         x"144CFA", x"147101", x"1494FC", x"14B8ED", x"14DCD1", x"1500AA", x"152476", x"154836",
+         x"156BE8", x"158F8D", x"15B324", x"15D6AC", x"15FA26", x"161D92", x"1640EE", x"16643A",
+         x"168777", x"16AAA4", x"16CDC0", x"16F0CC", x"1713C7", x"1736B0", x"175988", x"177C4F",
+         x"179F03", x"17C1A5", x"17E435", x"1806B3", x"18291D", x"184B75", x"186DB9", x"188FEB",
+         x"18B209", x"18D413", x"18F60A", x"1917EC", x"1939BB", x"195B76", x"197D1D", x"199EB0",
+         x"19C02E", x"19E198", x"1A02EE", x"1A2430", x"1A455D", x"1A6676", x"1A877B", x"1AA86B",
+         x"1AC947", x"1AEA0F", x"1B0AC2", x"1B2B62", x"1B4BED", x"1B6C65", x"1B8CC9", x"1BAD19",
+         x"1BCD56", x"1BED7F", x"1C0D96", x"1C2D99", x"1C4D89", x"1C6D66", x"1C8D31", x"1CACEA",
+         x"1CCC91", x"1CEC26", x"1D0BAA", x"1D2B1C", x"1D4A7D", x"1D69CE", x"1D890E", x"1DA83E",
+         x"1DC75F", x"1DE670", x"1E0572", x"1E2465", x"1E434A", x"1E6221", x"1E80EA", x"1E9FA6",
+         x"1EBE56", x"1EDCF9", x"1EFB90", x"1F1A1B", x"1F389C", x"1F5712", x"1F757E", x"1F93E0",
+         x"1FB239", x"1FD089", x"1FEED1", x"200D11", x"202B4A", x"20497D", x"2067A9", x"2085D0",
+         x"20A3F2", x"20C20F", x"20E028", x"20FE3D", x"211C50", x"213A61", x"21586F", x"21767D",
+         x"21948A", x"21B297", x"21D0A4", x"21EEB3", x"220CC4", x"222AD7", x"2248EC", x"226706",
+         x"228523", x"22A346", x"22C16D", x"22DF9B", x"22FDCF", x"231C0B", x"233A4E", x"23589A",
+         x"2376EE", x"23954D", x"23B3B5", x"23D228", x"23F0A7", x"240F32", x"242DC9", x"244C6D",
+         x"246B1F", x"2489E0", x"24A8AF", x"24C78E", x"24E67D", x"25057C", x"25248D", x"2543AF",
+         x"2562E4", x"25822B", x"25A186", x"25C0F4", x"25E077", x"26000F", x"261FBC", x"263F7F",
+         x"265F58", x"267F48", x"269F4F", x"26BF6E", x"26DFA5", x"26FFF4", x"27205D", x"2740DF",
+         x"27617A", x"278230", x"27A300", x"27C3EB", x"27E4F1", x"280613", x"282751", x"2848AA",
+         x"286A21", x"288BB3", x"28AD63", x"28CF30", x"28F11B", x"291323", x"293549", x"29578D",
+         x"2979EF", x"299C6F", x"29BF0E", x"29E1CB", x"2A04A8", x"2A27A2", x"2A4ABC", x"2A6DF5",
+         x"2A914C", x"2AB4C2", x"2AD857", x"2AFC0B", x"2B1FDE", x"2B43D0", x"2B67E0", x"2B8C0F",
+         x"2BB05C", x"2BD4C7", x"2BF951", x"2C1DF9", x"2C42BE", x"2C67A1", x"2C8CA1", x"2CB1BE",
+         x"2CD6F7", x"2CFC4D", x"2D21C0", x"2D474E", x"2D6CF7", x"2D92BB", x"2DB89B", x"2DDE94",
+         x"2E04A7", x"2E2AD3", x"2E5118", x"2E7775", x"2E9DEA", x"2EC476", x"2EEB19", x"2F11D2",
+         x"2F38A1", x"2F5F84", x"2F867B", x"2FAD86", x"2FD4A4", x"2FFBD4", x"302315", x"304A67",
+         x"3071C8", x"309939", x"30C0B8", x"30E845", x"310FDE", x"313782", x"315F32", x"3186EC",
+         x"31AEAE", x"31D679", x"31FE4B", x"322623", x"324E01", x"3275E2", x"329DC7", x"32C5AE",
+         x"32ED96", x"33157E", x"333D64", x"336549", x"338D2A", x"33B507", x"33DCDE", x"3404AF",
+         x"342C78", x"345437", x"347BEC", x"34A396", x"34CB32", x"34F2C1", x"351A40", x"3541AF",
+         x"35690C", x"359056", x"35B78B", x"35DEAB", x"3605B4", x"362CA4", x"36537A", x"367A35",
+         x"36A0D4", x"36C755", x"36EDB7", x"3713F8", x"373A17", x"376013", x"3785EA", x"37AB9A",
+         x"37D123", x"37F683", x"381BB9", x"3840C3", x"38659F", x"388A4D", x"38AECA", x"38D316",
+         x"38F72F", x"391B13", x"393EC1", x"396238", x"398575", x"39A879", x"39CB41", x"39EDCC",
+         x"3A1018", x"3A3224", x"3A53EE", x"3A7576", x"3A96B9", x"3AB7B6", x"3AD86C", x"3AF8DA",
+         x"3B18FD", x"3B38D6", x"3B5861", x"3B779E", x"3B968C", x"3BB528", x"3BD372", x"3BF169",
+         x"3C0F0A", x"3C2C56", x"3C4949", x"3C65E3", x"3C8224", x"3C9E08", x"3CB990", x"3CD4B9",
+         x"3CEF83", x"3D09ED", x"3D23F4", x"3D3D99", x"3D56D9", x"3D6FB3", x"3D8827", x"3DA033",
+         x"3DB7D7", x"3DCF10", x"3DE5DD", x"3DFC3F", x"3E1233", x"3E27B9", x"3E3CCF", x"3E5175",
+         x"3E65AA", x"3E796C", x"3E8CBA", x"3E9F94", x"3EB1F9", x"3EC3E8", x"3ED560", x"3EE660",
+         x"3EF6E7", x"3F06F4", x"3F1688", x"3F25A0", x"3F343C", x"3F425C", x"3F4FFE", x"3F5D22",
+         x"3F69C8", x"3F75EF", x"3F8195", x"3F8CBC", x"3F9761", x"3FA185", x"3FAB26", x"3FB446",
+         x"3FBCE2", x"3FC4FB", x"3FCC90", x"3FD3A1", x"3FDA2D", x"3FE034", x"3FE5B6", x"3FEAB3",
+         x"3FEF2A", x"3FF31B", x"3FF686", x"3FF96B", x"3FFBC9", x"3FFDA1", x"3FFEF1", x"3FFFBC",
+         x"3FFFFF", x"3FFFBC", x"3FFEF1", x"3FFDA1", x"3FFBC9", x"3FF96B", x"3FF686", x"3FF31B",
+         x"3FEF2A", x"3FEAB3", x"3FE5B6", x"3FE034", x"3FDA2D", x"3FD3A1", x"3FCC90", x"3FC4FB",
+         x"3FBCE2", x"3FB446", x"3FAB26", x"3FA185", x"3F9761", x"3F8CBC", x"3F8195", x"3F75EF",
+         x"3F69C8", x"3F5D22", x"3F4FFE", x"3F425C", x"3F343C", x"3F25A0", x"3F1688", x"3F06F4",
+         x"3EF6E7", x"3EE660", x"3ED560", x"3EC3E8", x"3EB1F9", x"3E9F94", x"3E8CBA", x"3E796C",
+         x"3E65AA", x"3E5175", x"3E3CCF", x"3E27B9", x"3E1233", x"3DFC3F", x"3DE5DD", x"3DCF10",
+         x"3DB7D7", x"3DA033", x"3D8827", x"3D6FB3", x"3D56D9", x"3D3D99", x"3D23F4", x"3D09ED",
+         x"3CEF83", x"3CD4B9", x"3CB990", x"3C9E08", x"3C8224", x"3C65E3", x"3C4949", x"3C2C56",
+         x"3C0F0A", x"3BF169", x"3BD372", x"3BB528", x"3B968C", x"3B779E", x"3B5861", x"3B38D6",
+         x"3B18FD", x"3AF8DA", x"3AD86C", x"3AB7B6", x"3A96B9", x"3A7576", x"3A53EE", x"3A3224",
+         x"3A1018", x"39EDCC", x"39CB41", x"39A879", x"398575", x"396238", x"393EC1", x"391B13",
+         x"38F72F", x"38D316", x"38AECA", x"388A4D", x"38659F", x"3840C3", x"381BB9", x"37F683",
+         x"37D123", x"37AB9A", x"3785EA", x"376013", x"373A17", x"3713F8", x"36EDB7", x"36C755",
+         x"36A0D4", x"367A35", x"36537A", x"362CA4", x"3605B4", x"35DEAB", x"35B78B", x"359056",
+         x"35690C", x"3541AF", x"351A40", x"34F2C1", x"34CB32", x"34A396", x"347BEC", x"345437",
+         x"342C78", x"3404AF", x"33DCDE", x"33B507", x"338D2A", x"336549", x"333D64", x"33157E",
+         x"32ED96", x"32C5AE", x"329DC7", x"3275E2", x"324E01", x"322623", x"31FE4B", x"31D679",
+         x"31AEAE", x"3186EC", x"315F32", x"313782", x"310FDE", x"30E845", x"30C0B8", x"309939",
+         x"3071C8", x"304A67", x"302315", x"2FFBD4", x"2FD4A4", x"2FAD86", x"2F867B", x"2F5F84",
+         x"2F38A1", x"2F11D2", x"2EEB19", x"2EC476", x"2E9DEA", x"2E7775", x"2E5118", x"2E2AD3",
+         x"2E04A7", x"2DDE94", x"2DB89B", x"2D92BB", x"2D6CF7", x"2D474E", x"2D21C0", x"2CFC4D",
+         x"2CD6F7", x"2CB1BE", x"2C8CA1", x"2C67A1", x"2C42BE", x"2C1DF9", x"2BF951", x"2BD4C7",
+         x"2BB05C", x"2B8C0F", x"2B67E0", x"2B43D0", x"2B1FDE", x"2AFC0B", x"2AD857", x"2AB4C2",
+         x"2A914C", x"2A6DF5", x"2A4ABC", x"2A27A2", x"2A04A8", x"29E1CB", x"29BF0E", x"299C6F",
+         x"2979EF", x"29578D", x"293549", x"291323", x"28F11B", x"28CF30", x"28AD63", x"288BB3",
+         x"286A21", x"2848AA", x"282751", x"280613", x"27E4F1", x"27C3EB", x"27A300", x"278230",
+         x"27617A", x"2740DF", x"27205D", x"26FFF4", x"26DFA5", x"26BF6E", x"269F4F", x"267F48",
+         x"265F58", x"263F7F", x"261FBC", x"26000F", x"25E077", x"25C0F4", x"25A186", x"25822B",
+         x"2562E4", x"2543AF", x"25248D", x"25057C", x"24E67D", x"24C78E", x"24A8AF", x"2489E0",
+         x"246B1F", x"244C6D", x"242DC9", x"240F32", x"23F0A7", x"23D228", x"23B3B5", x"23954D",
+         x"2376EE", x"23589A", x"233A4E", x"231C0B", x"22FDCF", x"22DF9B", x"22C16D", x"22A346",
+         x"228523", x"226706", x"2248EC", x"222AD7", x"220CC4", x"21EEB3", x"21D0A4", x"21B297",
+         x"21948A", x"21767D", x"21586F", x"213A61", x"211C50", x"20FE3D", x"20E028", x"20C20F",
+         x"20A3F2", x"2085D0", x"2067A9", x"20497D", x"202B4A", x"200D11", x"1FEED1", x"1FD089",
+         x"1FB239", x"1F93E0", x"1F757E", x"1F5712", x"1F389C", x"1F1A1B", x"1EFB90", x"1EDCF9",
+         x"1EBE56", x"1E9FA6", x"1E80EA", x"1E6221", x"1E434A", x"1E2465", x"1E0572", x"1DE670",
+         x"1DC75F", x"1DA83E", x"1D890E", x"1D69CE", x"1D4A7D", x"1D2B1C", x"1D0BAA", x"1CEC26",
+         x"1CCC91", x"1CACEA", x"1C8D31", x"1C6D66", x"1C4D89", x"1C2D99", x"1C0D96", x"1BED7F",
+         x"1BCD56", x"1BAD19", x"1B8CC9", x"1B6C65", x"1B4BED", x"1B2B62", x"1B0AC2", x"1AEA0F",
+         x"1AC947", x"1AA86B", x"1A877B", x"1A6676", x"1A455D", x"1A2430", x"1A02EE", x"19E198",
+         x"19C02E", x"199EB0", x"197D1D", x"195B76", x"1939BB", x"1917EC", x"18F60A", x"18D413",
+         x"18B209", x"188FEB", x"186DB9", x"184B75", x"18291D", x"1806B3", x"17E435", x"17C1A5",
+         x"179F03", x"177C4F", x"175988", x"1736B0", x"1713C7", x"16F0CC", x"16CDC0", x"16AAA4",
+         x"168777", x"16643A", x"1640EE", x"161D92", x"15FA26", x"15D6AC", x"15B324", x"158F8D",
+         x"156BE8", x"154836", x"152476", x"1500AA", x"14DCD1", x"14B8ED", x"1494FC", x"147101",
+         x"144CFA", x"1428E9", x"1404CE", x"13E0AA", x"13BC7C", x"139845", x"137406", x"134FBF",
+         x"132B70", x"13071A", x"12E2BD", x"12BE5A", x"1299F2", x"127584", x"125111", x"122C99",
+         x"12081E", x"11E39F", x"11BF1C", x"119A97", x"117610", x"115187", x"112CFD", x"110872",
+         x"10E3E6", x"10BF5A", x"109ACF", x"107645", x"1051BB", x"102D34", x"1008AF", x"0FE42D",
+         x"0FBFAE", x"0F9B32", x"0F76BA", x"0F5247", x"0F2DD8", x"0F096F", x"0EE50B", x"0EC0AD",
+         x"0E9C56", x"0E7805", x"0E53BC", x"0E2F7B", x"0E0B41", x"0DE710", x"0DC2E7", x"0D9EC8",
+         x"0D7AB2", x"0D56A7", x"0D32A5", x"0D0EAE", x"0CEAC2", x"0CC6E1", x"0CA30B", x"0C7F41",
+         x"0C5B84", x"0C37D3", x"0C142F", x"0BF097", x"0BCD0D", x"0BA991", x"0B8622", x"0B62C2",
+         x"0B3F70", x"0B1C2C", x"0AF8F7", x"0AD5D1", x"0AB2BA", x"0A8FB3", x"0A6CBB", x"0A49D3",
+         x"0A26FA", x"0A0432", x"09E17A", x"09BED2", x"099C3B", x"0979B4", x"09573E", x"0934D9",
+         x"091285", x"08F041", x"08CE0F", x"08ABEE", x"0889DD", x"0867DE", x"0845F0", x"082414",
+         x"080248", x"07E08E", x"07BEE4", x"079D4C", x"077BC5", x"075A4F", x"0738EA", x"071796",
+         x"06F653", x"06D521", x"06B3FF", x"0692EE", x"0671ED", x"0650FD", x"06301D", x"060F4C",
+         x"05EE8C", x"05CDDC", x"05AD3B", x"058CA9", x"056C27", x"054BB4", x"052B4F", x"050AF9",
+         x"04EAB1", x"04CA78", x"04AA4C", x"048A2E", x"046A1E", x"044A1A", x"042A23", x"040A39",
+         x"03EA5B", x"03CA89", x"03AAC3", x"038B08", x"036B58", x"034BB3", x"032C18", x"030C88",
+         x"02ED01", x"02CD83", x"02AE0F", x"028EA3", x"026F3F", x"024FE4", x"023090", x"021143",
+         x"01F1FD", x"01D2BE", x"01B385", x"019451", x"017522", x"0155F9", x"0136D4", x"0117B3",
+         x"00F896", x"00D97C", x"00BA65", x"009B50", x"007C3E", x"005D2D", x"003E1D", x"001F0E",
+         x"000000", x"FFE0F2", x"FFC1E3", x"FFA2D3", x"FF83C2", x"FF64B0", x"FF459B", x"FF2684",
+         x"FF076A", x"FEE84D", x"FEC92C", x"FEAA07", x"FE8ADE", x"FE6BAF", x"FE4C7B", x"FE2D42",
+         x"FE0E03", x"FDEEBD", x"FDCF70", x"FDB01C", x"FD90C1", x"FD715D", x"FD51F1", x"FD327D",
+         x"FD12FF", x"FCF378", x"FCD3E8", x"FCB44D", x"FC94A8", x"FC74F8", x"FC553D", x"FC3577",
+         x"FC15A5", x"FBF5C7", x"FBD5DD", x"FBB5E6", x"FB95E2", x"FB75D2", x"FB55B4", x"FB3588",
+         x"FB154F", x"FAF507", x"FAD4B1", x"FAB44C", x"FA93D9", x"FA7357", x"FA52C5", x"FA3224",
+         x"FA1174", x"F9F0B4", x"F9CFE3", x"F9AF03", x"F98E13", x"F96D12", x"F94C01", x"F92ADF",
+         x"F909AD", x"F8E86A", x"F8C716", x"F8A5B1", x"F8843B", x"F862B4", x"F8411C", x"F81F72",
+         x"F7FDB8", x"F7DBEC", x"F7BA10", x"F79822", x"F77623", x"F75412", x"F731F1", x"F70FBF",
+         x"F6ED7B", x"F6CB27", x"F6A8C2", x"F6864C", x"F663C5", x"F6412E", x"F61E86", x"F5FBCE",
+         x"F5D906", x"F5B62D", x"F59345", x"F5704D", x"F54D46", x"F52A2F", x"F50709", x"F4E3D4",
+         x"F4C090", x"F49D3E", x"F479DE", x"F4566F", x"F432F3", x"F40F69", x"F3EBD1", x"F3C82D",
+         x"F3A47C", x"F380BF", x"F35CF5", x"F3391F", x"F3153E", x"F2F152", x"F2CD5B", x"F2A959",
+         x"F2854E", x"F26138", x"F23D19", x"F218F0", x"F1F4BF", x"F1D085", x"F1AC44", x"F187FB",
+         x"F163AA", x"F13F53", x"F11AF5", x"F0F691", x"F0D228", x"F0ADB9", x"F08946", x"F064CE",
+         x"F04052", x"F01BD3", x"EFF751", x"EFD2CC", x"EFAE45", x"EF89BB", x"EF6531", x"EF40A6",
+         x"EF1C1A", x"EEF78E", x"EED303", x"EEAE79", x"EE89F0", x"EE6569", x"EE40E4", x"EE1C61",
+         x"EDF7E2", x"EDD367", x"EDAEEF", x"ED8A7C", x"ED660E", x"ED41A6", x"ED1D43", x"ECF8E6",
+         x"ECD490", x"ECB041", x"EC8BFA", x"EC67BB", x"EC4384", x"EC1F56", x"EBFB32", x"EBD717",
+         x"EBB306", x"EB8EFF", x"EB6B04", x"EB4713", x"EB232F", x"EAFF56", x"EADB8A", x"EAB7CA",
+         x"EA9418", x"EA7073", x"EA4CDC", x"EA2954", x"EA05DA", x"E9E26E", x"E9BF12", x"E99BC6",
+         x"E97889", x"E9555C", x"E93240", x"E90F34", x"E8EC39", x"E8C950", x"E8A678", x"E883B1",
+         x"E860FD", x"E83E5B", x"E81BCB", x"E7F94D", x"E7D6E3", x"E7B48B", x"E79247", x"E77015",
+         x"E74DF7", x"E72BED", x"E709F6", x"E6E814", x"E6C645", x"E6A48A", x"E682E3", x"E66150",
+         x"E63FD2", x"E61E68", x"E5FD12", x"E5DBD0", x"E5BAA3", x"E5998A", x"E57885", x"E55795",
+         x"E536B9", x"E515F1", x"E4F53E", x"E4D49E", x"E4B413", x"E4939B", x"E47337", x"E452E7",
+         x"E432AA", x"E41281", x"E3F26A", x"E3D267", x"E3B277", x"E3929A", x"E372CF", x"E35316",
+         x"E3336F", x"E313DA", x"E2F456", x"E2D4E4", x"E2B583", x"E29632", x"E276F2", x"E257C2",
+         x"E238A1", x"E21990", x"E1FA8E", x"E1DB9B", x"E1BCB6", x"E19DDF", x"E17F16", x"E1605A",
+         x"E141AA", x"E12307", x"E10470", x"E0E5E5", x"E0C764", x"E0A8EE", x"E08A82", x"E06C20",
+         x"E04DC7", x"E02F77", x"E0112F", x"DFF2EF", x"DFD4B6", x"DFB683", x"DF9857", x"DF7A30",
+         x"DF5C0E", x"DF3DF1", x"DF1FD8", x"DF01C3", x"DEE3B0", x"DEC59F", x"DEA791", x"DE8983",
+         x"DE6B76", x"DE4D69", x"DE2F5C", x"DE114D", x"DDF33C", x"DDD529", x"DDB714", x"DD98FA",
+         x"DD7ADD", x"DD5CBA", x"DD3E93", x"DD2065", x"DD0231", x"DCE3F5", x"DCC5B2", x"DCA766",
+         x"DC8912", x"DC6AB3", x"DC4C4B", x"DC2DD8", x"DC0F59", x"DBF0CE", x"DBD237", x"DBB393",
+         x"DB94E1", x"DB7620", x"DB5751", x"DB3872", x"DB1983", x"DAFA84", x"DADB73", x"DABC51",
+         x"DA9D1C", x"DA7DD5", x"DA5E7A", x"DA3F0C", x"DA1F89", x"D9FFF1", x"D9E044", x"D9C081",
+         x"D9A0A8", x"D980B8", x"D960B1", x"D94092", x"D9205B", x"D9000C", x"D8DFA3", x"D8BF21",
+         x"D89E86", x"D87DD0", x"D85D00", x"D83C15", x"D81B0F", x"D7F9ED", x"D7D8AF", x"D7B756",
+         x"D795DF", x"D7744D", x"D7529D", x"D730D0", x"D70EE5", x"D6ECDD", x"D6CAB7", x"D6A873",
+         x"D68611", x"D66391", x"D640F2", x"D61E35", x"D5FB58", x"D5D85E", x"D5B544", x"D5920B",
+         x"D56EB4", x"D54B3E", x"D527A9", x"D503F5", x"D4E022", x"D4BC30", x"D49820", x"D473F1",
+         x"D44FA4", x"D42B39", x"D406AF", x"D3E207", x"D3BD42", x"D3985F", x"D3735F", x"D34E42",
+         x"D32909", x"D303B3", x"D2DE40", x"D2B8B2", x"D29309", x"D26D45", x"D24765", x"D2216C",
+         x"D1FB59", x"D1D52D", x"D1AEE8", x"D1888B", x"D16216", x"D13B8A", x"D114E7", x"D0EE2E",
+         x"D0C75F", x"D0A07C", x"D07985", x"D0527A", x"D02B5C", x"D0042C", x"CFDCEB", x"CFB599",
+         x"CF8E38", x"CF66C7", x"CF3F48", x"CF17BB", x"CEF022", x"CEC87E", x"CEA0CE", x"CE7914",
+         x"CE5152", x"CE2987", x"CE01B5", x"CDD9DD", x"CDB1FF", x"CD8A1E", x"CD6239", x"CD3A52",
+         x"CD126A", x"CCEA82", x"CCC29C", x"CC9AB7", x"CC72D6", x"CC4AF9", x"CC2322", x"CBFB51",
+         x"CBD388", x"CBABC9", x"CB8414", x"CB5C6A", x"CB34CE", x"CB0D3F", x"CAE5C0", x"CABE51",
+         x"CA96F4", x"CA6FAA", x"CA4875", x"CA2155", x"C9FA4C", x"C9D35C", x"C9AC86", x"C985CB",
+         x"C95F2C", x"C938AB", x"C91249", x"C8EC08", x"C8C5E9", x"C89FED", x"C87A16", x"C85466",
+         x"C82EDD", x"C8097D", x"C7E447", x"C7BF3D", x"C79A61", x"C775B3", x"C75136", x"C72CEA",
+         x"C708D1", x"C6E4ED", x"C6C13F", x"C69DC8", x"C67A8B", x"C65787", x"C634BF", x"C61234",
+         x"C5EFE8", x"C5CDDC", x"C5AC12", x"C58A8A", x"C56947", x"C5484A", x"C52794", x"C50726",
+         x"C4E703", x"C4C72A", x"C4A79F", x"C48862", x"C46974", x"C44AD8", x"C42C8E", x"C40E97",
+         x"C3F0F6", x"C3D3AA", x"C3B6B7", x"C39A1D", x"C37DDC", x"C361F8", x"C34670", x"C32B47",
+         x"C3107D", x"C2F613", x"C2DC0C", x"C2C267", x"C2A927", x"C2904D", x"C277D9", x"C25FCD",
+         x"C24829", x"C230F0", x"C21A23", x"C203C1", x"C1EDCD", x"C1D847", x"C1C331", x"C1AE8B",
+         x"C19A56", x"C18694", x"C17346", x"C1606C", x"C14E07", x"C13C18", x"C12AA0", x"C119A0",
+         x"C10919", x"C0F90C", x"C0E978", x"C0DA60", x"C0CBC4", x"C0BDA4", x"C0B002", x"C0A2DE",
+         x"C09638", x"C08A11", x"C07E6B", x"C07344", x"C0689F", x"C05E7B", x"C054DA", x"C04BBA",
+         x"C0431E", x"C03B05", x"C03370", x"C02C5F", x"C025D3", x"C01FCC", x"C01A4A", x"C0154D",
+         x"C010D6", x"C00CE5", x"C0097A", x"C00695", x"C00437", x"C0025F", x"C0010F", x"C00044"),
+        -- octave 8
+        (x"C00001", x"C00025", x"C0008F", x"C00141", x"C00239", x"C00379", x"C00500", x"C006CE",
+         x"C008E2", x"C00B3E", x"C00DE1", x"C010CA", x"C013FB", x"C01772", x"C01B30", x"C01F34",
+         x"C02380", x"C02812", x"C02CEA", x"C03209", x"C0376F", x"C03D1B", x"C0430D", x"C04946",
+         x"C04FC4", x"C05689", x"C05D94", x"C064E5", x"C06C7B", x"C07458", x"C07C7A", x"C084E2",
+         x"C08D8F", x"C09681", x"C09FB9", x"C0A935", x"C0B2F7", x"C0BCFE", x"C0C74A", x"C0D1DA",
+         x"C0DCAF", x"C0E7C8", x"C0F325", x"C0FEC7", x"C10AAC", x"C116D6", x"C12343", x"C12FF4",
+         x"C13CE8", x"C14A20", x"C1579A", x"C16558", x"C17358", x"C1819B", x"C19020", x"C19EE8",
+         x"C1ADF1", x"C1BD3D", x"C1CCCB", x"C1DC99", x"C1ECAA", x"C1FCFB", x"C20D8E", x"C21E61",
+         x"C22F75", x"C240C9", x"C2525E", x"C26432", x"C27646", x"C2889A", x"C29B2D", x"C2ADFF",
+         x"C2C110", x"C2D460", x"C2E7EE", x"C2FBBB", x"C30FC5", x"C3240D", x"C33893", x"C34D56",
+         x"C36256", x"C37793", x"C38D0C", x"C3A2C2", x"C3B8B4", x"C3CEE1", x"C3E54A", x"C3FBEF",
+         x"C412CE", x"C429E8", x"C4413C", x"C458CB", x"C47094", x"C48896", x"C4A0D2", x"C4B947",
+         x"C4D1F4", x"C4EADA", x"C503F9", x"C51D4F", x"C536DD", x"C550A3", x"C56A9F", x"C584D3",
+         x"C59F3D", x"C5B9DD", x"C5D4B3", x"C5EFBE", x"C60AFF", x"C62675", x"C6421F", x"C65DFE",
+         x"C67A11", x"C69657", x"C6B2D1", x"C6CF7E", x"C6EC5E", x"C70970", x"C726B5", x"C7442B",
+         x"C761D2", x"C77FAB", x"C79DB5", x"C7BBEE", x"C7DA59", x"C7F8F2", x"C817BC", x"C836B4",
+         x"C855DB", x"C87531", x"C894B5", x"C8B466", x"C8D445", x"C8F451", x"C91489", x"C934EE",
+         x"C9557F", x"C9763B", x"C99723", x"C9B836", x"C9D973", x"C9FADA", x"CA1C6C", x"CA3E26",
+         x"CA600A", x"CA8217", x"CAA44C", x"CAC6A9", x"CAE92E", x"CB0BD9", x"CB2EAC", x"CB51A6",
+         x"CB74C5", x"CB980B", x"CBBB76", x"CBDF06", x"CC02BA", x"CC2693", x"CC4A90", x"CC6EB0",
+         x"CC92F4", x"CCB75B", x"CCDBE4", x"CD008E", x"CD255B", x"CD4A49", x"CD6F58", x"CD9487",
+         x"CDB9D7", x"CDDF46", x"CE04D5", x"CE2A83", x"CE5050", x"CE763A", x"CE9C43", x"CEC269",
+         x"CEE8AC", x"CF0F0C", x"CF3588", x"CF5C21", x"CF82D5", x"CFA9A4", x"CFD08D", x"CFF792",
+         x"D01EB0", x"D045E8", x"D06D39", x"D094A4", x"D0BC26", x"D0E3C1", x"D10B74", x"D1333E",
+         x"D15B1F", x"D18316", x"D1AB24", x"D1D348", x"D1FB81", x"D223CF", x"D24C32", x"D274AA",
+         x"D29D35", x"D2C5D4", x"D2EE86", x"D3174A", x"D34022", x"D3690B", x"D39206", x"D3BB12",
+         x"D3E430", x"D40D5D", x"D4369C", x"D45FE9", x"D48947", x"D4B2B3", x"D4DC2E", x"D505B8",
+         x"D52F4F", x"D558F4", x"D582A6", x"D5AC66", x"D5D631", x"D60009", x"D629ED", x"D653DC",
+         x"D67DD6", x"D6A7DB", x"D6D1EA", x"D6FC03", x"D72626", x"D75052", x"D77A88", x"D7A4C5",
+         x"D7CF0B", x"D7F959", x"D823AE", x"D84E0B", x"D8786F", x"D8A2D9", x"D8CD49", x"D8F7BF",
+         x"D9223A", x"D94CBB", x"D97740", x"D9A1CA", x"D9CC58", x"D9F6EA", x"DA2180", x"DA4C18",
+         x"DA76B4", x"DAA152", x"DACBF2", x"DAF694", x"DB2138", x"DB4BDD", x"DB7683", x"DBA129",
+         x"DBCBD0", x"DBF677", x"DC211D", x"DC4BC3", x"DC7668", x"DCA10C", x"DCCBAE", x"DCF64E",
+         x"DD20ED", x"DD4B88", x"DD7622", x"DDA0B8", x"DDCB4B", x"DDF5DA", x"DE2066", x"DE4AED",
+         x"DE7570", x"DE9FEE", x"DECA68", x"DEF4DC", x"DF1F4B", x"DF49B3", x"DF7416", x"DF9E73",
+         x"DFC8C9", x"DFF318", x"E01D60", x"E047A1", x"E071DA", x"E09C0C", x"E0C635", x"E0F056",
+         x"E11A6F", x"E1447E", x"E16E85", x"E19882", x"E1C276", x"E1EC60", x"E21641", x"E24017",
+         x"E269E2", x"E293A3", x"E2BD5A", x"E2E705", x"E310A4", x"E33A39", x"E363C2", x"E38D3E",
+         x"E3B6AF", x"E3E013", x"E4096B", x"E432B7", x"E45BF5", x"E48526", x"E4AE4B", x"E4D761",
+         x"E5006A", x"E52966", x"E55253", x"E57B32", x"E5A403", x"E5CCC5", x"E5F579", x"E61E1E",
+         x"E646B4", x"E66F3B", x"E697B3", x"E6C01B", x"E6E874", x"E710BD", x"E738F6", x"E7611F",
+         x"E78938", x"E7B141", x"E7D939", x"E80121", x"E828F8", x"E850BF", x"E87875", x"E8A019",
+         x"E8C7AD", x"E8EF2F", x"E916A0", x"E93DFF", x"E9654D", x"E98C8A", x"E9B3B4", x"E9DACD",
+         x"EA01D4", x"EA28C9", x"EA4FAC", x"EA767C", x"EA9D3B", x"EAC3E7", x"EAEA80", x"EB1107",
+         x"EB377C", x"EB5DDE", x"EB842D", x"EBAA6A", x"EBD094", x"EBF6AB", x"EC1CAF", x"EC42A0",
+         x"EC687E", x"EC8E49", x"ECB401", x"ECD9A6", x"ECFF37", x"ED24B6", x"ED4A21", x"ED6F7A",
+         x"ED94BE", x"EDB9F0", x"EDDF0E", x"EE0419", x"EE2911", x"EE4DF5", x"EE72C6", x"EE9784",
+         x"EEBC2F", x"EEE0C6", x"EF0549", x"EF29BA", x"EF4E17", x"EF7260", x"EF9697", x"EFBABA",
+         x"EFDECA", x"F002C7", x"F026B0", x"F04A86", x"F06E49", x"F091FA", x"F0B596", x"F0D920",
+         x"F0FC97", x"F11FFB", x"F1434C", x"F1668B", x"F189B6", x"F1ACCF", x"F1CFD5", x"F1F2C8",
+         x"F215A9", x"F23877", x"F25B33", x"F27DDD", x"F2A074", x"F2C2F9", x"F2E56C", x"F307CC",
+         x"F32A1B", x"F34C58", x"F36E83", x"F3909C", x"F3B2A4", x"F3D49A", x"F3F67F", x"F41852",
+         x"F43A14", x"F45BC5", x"F47D65", x"F49EF4", x"F4C072", x"F4E1E0", x"F5033C", x"F52489",
+         x"F545C4", x"F566F0", x"F5880C", x"F5A917", x"F5CA13", x"F5EAFF", x"F60BDB", x"F62CA8",
+         x"F64D65", x"F66E13", x"F68EB2", x"F6AF42", x"F6CFC4", x"F6F036", x"F7109A", x"F730F0",
+         x"F75137", x"F77171", x"F7919C", x"F7B1BA", x"F7D1CA", x"F7F1CD", x"F811C2", x"F831AB",
+         x"F85186", x"F87154", x"F89116", x"F8B0CB", x"F8D075", x"F8F011", x"F90FA2", x"F92F28",
+         x"F94EA1", x"F96E0F", x"F98D72", x"F9ACCA", x"F9CC17", x"F9EB59", x"FA0A90", x"FA29BE",
+         x"FA48E1", x"FA67FA", x"FA8709", x"FAA60F", x"FAC50B", x"FAE3FE", x"FB02E8", x"FB21CA",
+         x"FB40A2", x"FB5F72", x"FB7E3A", x"FB9CFA", x"FBBBB2", x"FBDA63", x"FBF90C", x"FC17AD",
+         x"FC3648", x"FC54DC", x"FC7369", x"FC91F0", x"FCB070", x"FCCEEB", x"FCED60", x"FD0BCF",
+         x"FD2A39", x"FD489D", x"FD66FD", x"FD8558", x"FDA3AF", x"FDC201", x"FDE04F", x"FDFE99",
+         x"FE1CDF", x"FE3B22", x"FE5962", x"FE779E", x"FE95D8", x"FEB40F", x"FED244", x"FEF077",
+         x"FF0EA7", x"FF2CD6", x"FF4B03", x"FF6930", x"FF875B", x"FFA585", x"FFC3AE", x"FFE1D7",
+         x"000000", x"001E29", x"003C52", x"005A7B", x"0078A5", x"0096D0", x"00B4FD", x"00D32A",
+         x"00F159", x"010F89", x"012DBC", x"014BF1", x"016A28", x"018862", x"01A69E", x"01C4DE",
+         x"01E321", x"020167", x"021FB1", x"023DFF", x"025C51", x"027AA8", x"029903", x"02B763",
+         x"02D5C7", x"02F431", x"0312A0", x"033115", x"034F90", x"036E10", x"038C97", x"03AB24",
+         x"03C9B8", x"03E853", x"0406F4", x"04259D", x"04444E", x"046306", x"0481C6", x"04A08E",
+         x"04BF5E", x"04DE36", x"04FD18", x"051C02", x"053AF5", x"0559F1", x"0578F7", x"059806",
+         x"05B71F", x"05D642", x"05F570", x"0614A7", x"0633E9", x"065336", x"06728E", x"0691F1",
+         x"06B15F", x"06D0D8", x"06F05E", x"070FEF", x"072F8B", x"074F35", x"076EEA", x"078EAC",
+         x"07AE7A", x"07CE55", x"07EE3E", x"080E33", x"082E36", x"084E46", x"086E64", x"088E8F",
+         x"08AEC9", x"08CF10", x"08EF66", x"090FCA", x"09303C", x"0950BE", x"09714E", x"0991ED",
+         x"09B29B", x"09D358", x"09F425", x"0A1501", x"0A35ED", x"0A56E9", x"0A77F4", x"0A9910",
+         x"0ABA3C", x"0ADB77", x"0AFCC4", x"0B1E20", x"0B3F8E", x"0B610C", x"0B829B", x"0BA43B",
+         x"0BC5EC", x"0BE7AE", x"0C0981", x"0C2B66", x"0C4D5C", x"0C6F64", x"0C917D", x"0CB3A8",
+         x"0CD5E5", x"0CF834", x"0D1A94", x"0D3D07", x"0D5F8C", x"0D8223", x"0DA4CD", x"0DC789",
+         x"0DEA57", x"0E0D38", x"0E302B", x"0E5331", x"0E764A", x"0E9975", x"0EBCB4", x"0EE005",
+         x"0F0369", x"0F26E0", x"0F4A6A", x"0F6E06", x"0F91B7", x"0FB57A", x"0FD950", x"0FFD39",
+         x"102136", x"104546", x"106969", x"108DA0", x"10B1E9", x"10D646", x"10FAB7", x"111F3A",
+         x"1143D1", x"11687C", x"118D3A", x"11B20B", x"11D6EF", x"11FBE7", x"1220F2", x"124610",
+         x"126B42", x"129086", x"12B5DF", x"12DB4A", x"1300C9", x"13265A", x"134BFF", x"1371B7",
+         x"139782", x"13BD60", x"13E351", x"140955", x"142F6C", x"145596", x"147BD3", x"14A222",
+         x"14C884", x"14EEF9", x"151580", x"153C19", x"1562C5", x"158984", x"15B054", x"15D737",
+         x"15FE2C", x"162533", x"164C4C", x"167376", x"169AB3", x"16C201", x"16E960", x"1710D1",
+         x"173853", x"175FE7", x"17878B", x"17AF41", x"17D708", x"17FEDF", x"1826C7", x"184EBF",
+         x"1876C8", x"189EE1", x"18C70A", x"18EF43", x"19178C", x"193FE5", x"19684D", x"1990C5",
+         x"19B94C", x"19E1E2", x"1A0A87", x"1A333B", x"1A5BFD", x"1A84CE", x"1AADAD", x"1AD69A",
+         x"1AFF96", x"1B289F", x"1B51B5", x"1B7ADA", x"1BA40B", x"1BCD49", x"1BF695", x"1C1FED",
+         x"1C4951", x"1C72C2", x"1C9C3E", x"1CC5C7", x"1CEF5C", x"1D18FB", x"1D42A6", x"1D6C5D",
+         x"1D961E", x"1DBFE9", x"1DE9BF", x"1E13A0", x"1E3D8A", x"1E677E", x"1E917B", x"1EBB82",
+         x"1EE591", x"1F0FAA", x"1F39CB", x"1F63F4", x"1F8E26", x"1FB85F", x"1FE2A0", x"200CE8",
+         x"203737", x"20618D", x"208BEA", x"20B64D", x"20E0B5", x"210B24", x"213598", x"216012",
+         x"218A90", x"21B513", x"21DF9A", x"220A26", x"2234B5", x"225F48", x"2289DE", x"22B478",
+         x"22DF13", x"2309B2", x"233452", x"235EF4", x"238998", x"23B43D", x"23DEE3", x"240989",
+         x"243430", x"245ED7", x"24897D", x"24B423", x"24DEC8", x"25096C", x"25340E", x"255EAE",
+         x"25894C", x"25B3E8", x"25DE80", x"260916", x"2633A8", x"265E36", x"2688C0", x"26B345",
+         x"26DDC6", x"270841", x"2732B7", x"275D27", x"278791", x"27B1F5", x"27DC52", x"2806A7",
+         x"2830F5", x"285B3B", x"288578", x"28AFAE", x"28D9DA", x"2903FD", x"292E16", x"295825",
+         x"29822A", x"29AC24", x"29D613", x"29FFF7", x"2A29CF", x"2A539A", x"2A7D5A", x"2AA70C",
+         x"2AD0B1", x"2AFA48", x"2B23D2", x"2B4D4D", x"2B76B9", x"2BA017", x"2BC964", x"2BF2A3",
+         x"2C1BD0", x"2C44EE", x"2C6DFA", x"2C96F5", x"2CBFDE", x"2CE8B6", x"2D117A", x"2D3A2C",
+         x"2D62CB", x"2D8B56", x"2DB3CE", x"2DDC31", x"2E047F", x"2E2CB8", x"2E54DC", x"2E7CEA",
+         x"2EA4E1", x"2ECCC2", x"2EF48C", x"2F1C3F", x"2F43DA", x"2F6B5C", x"2F92C7", x"2FBA18",
+         x"2FE150", x"30086E", x"302F73", x"30565C", x"307D2B", x"30A3DF", x"30CA78", x"30F0F4",
+         x"311754", x"313D97", x"3163BD", x"3189C6", x"31AFB0", x"31D57D", x"31FB2B", x"3220BA",
+         x"324629", x"326B79", x"3290A8", x"32B5B7", x"32DAA5", x"32FF72", x"33241C", x"3348A5",
+         x"336D0C", x"339150", x"33B570", x"33D96D", x"33FD46", x"3420FA", x"34448A", x"3467F5",
+         x"348B3B", x"34AE5A", x"34D154", x"34F427", x"3516D2", x"353957", x"355BB4", x"357DE9",
+         x"359FF6", x"35C1DA", x"35E394", x"360526", x"36268D", x"3647CA", x"3668DD", x"3689C5",
+         x"36AA81", x"36CB12", x"36EB77", x"370BAF", x"372BBB", x"374B9A", x"376B4B", x"378ACF",
+         x"37AA25", x"37C94C", x"37E844", x"38070E", x"3825A7", x"384412", x"38624B", x"388055",
+         x"389E2E", x"38BBD5", x"38D94B", x"38F690", x"3913A2", x"393082", x"394D2F", x"3969A9",
+         x"3985EF", x"39A202", x"39BDE1", x"39D98B", x"39F501", x"3A1042", x"3A2B4D", x"3A4623",
+         x"3A60C3", x"3A7B2D", x"3A9561", x"3AAF5D", x"3AC923", x"3AE2B1", x"3AFC07", x"3B1526",
+         x"3B2E0C", x"3B46B9", x"3B5F2E", x"3B776A", x"3B8F6C", x"3BA735", x"3BBEC4", x"3BD618",
+         x"3BED32", x"3C0411", x"3C1AB6", x"3C311F", x"3C474C", x"3C5D3E", x"3C72F4", x"3C886D",
+         x"3C9DAA", x"3CB2AA", x"3CC76D", x"3CDBF3", x"3CF03B", x"3D0445", x"3D1812", x"3D2BA0",
+         x"3D3EF0", x"3D5201", x"3D64D3", x"3D7766", x"3D89BA", x"3D9BCE", x"3DADA2", x"3DBF37",
+         x"3DD08B", x"3DE19F", x"3DF272", x"3E0305", x"3E1356", x"3E2367", x"3E3335", x"3E42C3",
+         x"3E520F", x"3E6118", x"3E6FE0", x"3E7E65", x"3E8CA8", x"3E9AA8", x"3EA866", x"3EB5E0",
+         x"3EC318", x"3ED00C", x"3EDCBD", x"3EE92A", x"3EF554", x"3F0139", x"3F0CDB", x"3F1838",
+         x"3F2351", x"3F2E26", x"3F38B6", x"3F4302", x"3F4D09", x"3F56CB", x"3F6047", x"3F697F",
+         x"3F7271", x"3F7B1E", x"3F8386", x"3F8BA8", x"3F9385", x"3F9B1B", x"3FA26C", x"3FA977",
+         x"3FB03C", x"3FB6BA", x"3FBCF3", x"3FC2E5", x"3FC891", x"3FCDF7", x"3FD316", x"3FD7EE",
+         x"3FDC80", x"3FE0CC", x"3FE4D0", x"3FE88E", x"3FEC05", x"3FEF36", x"3FF21F", x"3FF4C2",
+         x"3FF71E", x"3FF932", x"3FFB00", x"3FFC87", x"3FFDC7", x"3FFEBF", x"3FFF71", x"3FFFDB",
+         x"3FFFFF", x"3FFFDB", x"3FFF71", x"3FFEBF", x"3FFDC7", x"3FFC87", x"3FFB00", x"3FF932",
+         x"3FF71E", x"3FF4C2", x"3FF21F", x"3FEF36", x"3FEC05", x"3FE88E", x"3FE4D0", x"3FE0CC",
+         x"3FDC80", x"3FD7EE", x"3FD316", x"3FCDF7", x"3FC891", x"3FC2E5", x"3FBCF3", x"3FB6BA",
+         x"3FB03C", x"3FA977", x"3FA26C", x"3F9B1B", x"3F9385", x"3F8BA8", x"3F8386", x"3F7B1E",
+         x"3F7271", x"3F697F", x"3F6047", x"3F56CB", x"3F4D09", x"3F4302", x"3F38B6", x"3F2E26",
+         x"3F2351", x"3F1838", x"3F0CDB", x"3F0139", x"3EF554", x"3EE92A", x"3EDCBD", x"3ED00C",
+         x"3EC318", x"3EB5E0", x"3EA866", x"3E9AA8", x"3E8CA8", x"3E7E65", x"3E6FE0", x"3E6118",
+         x"3E520F", x"3E42C3", x"3E3335", x"3E2367", x"3E1356", x"3E0305", x"3DF272", x"3DE19F",
+         x"3DD08B", x"3DBF37", x"3DADA2", x"3D9BCE", x"3D89BA", x"3D7766", x"3D64D3", x"3D5201",
+         x"3D3EF0", x"3D2BA0", x"3D1812", x"3D0445", x"3CF03B", x"3CDBF3", x"3CC76D", x"3CB2AA",
+         x"3C9DAA", x"3C886D", x"3C72F4", x"3C5D3E", x"3C474C", x"3C311F", x"3C1AB6", x"3C0411",
+         x"3BED32", x"3BD618", x"3BBEC4", x"3BA735", x"3B8F6C", x"3B776A", x"3B5F2E", x"3B46B9",
+         x"3B2E0C", x"3B1526", x"3AFC07", x"3AE2B1", x"3AC923", x"3AAF5D", x"3A9561", x"3A7B2D",
+         x"3A60C3", x"3A4623", x"3A2B4D", x"3A1042", x"39F501", x"39D98B", x"39BDE1", x"39A202",
+         x"3985EF", x"3969A9", x"394D2F", x"393082", x"3913A2", x"38F690", x"38D94B", x"38BBD5",
+         x"389E2E", x"388055", x"38624B", x"384412", x"3825A7", x"38070E", x"37E844", x"37C94C",
+         x"37AA25", x"378ACF", x"376B4B", x"374B9A", x"372BBB", x"370BAF", x"36EB77", x"36CB12",
+         x"36AA81", x"3689C5", x"3668DD", x"3647CA", x"36268D", x"360526", x"35E394", x"35C1DA",
+         x"359FF6", x"357DE9", x"355BB4", x"353957", x"3516D2", x"34F427", x"34D154", x"34AE5A",
+         x"348B3B", x"3467F5", x"34448A", x"3420FA", x"33FD46", x"33D96D", x"33B570", x"339150",
+         x"336D0C", x"3348A5", x"33241C", x"32FF72", x"32DAA5", x"32B5B7", x"3290A8", x"326B79",
+         x"324629", x"3220BA", x"31FB2B", x"31D57D", x"31AFB0", x"3189C6", x"3163BD", x"313D97",
+         x"311754", x"30F0F4", x"30CA78", x"30A3DF", x"307D2B", x"30565C", x"302F73", x"30086E",
+         x"2FE150", x"2FBA18", x"2F92C7", x"2F6B5C", x"2F43DA", x"2F1C3F", x"2EF48C", x"2ECCC2",
+         x"2EA4E1", x"2E7CEA", x"2E54DC", x"2E2CB8", x"2E047F", x"2DDC31", x"2DB3CE", x"2D8B56",
+         x"2D62CB", x"2D3A2C", x"2D117A", x"2CE8B6", x"2CBFDE", x"2C96F5", x"2C6DFA", x"2C44EE",
+         x"2C1BD0", x"2BF2A3", x"2BC964", x"2BA017", x"2B76B9", x"2B4D4D", x"2B23D2", x"2AFA48",
+         x"2AD0B1", x"2AA70C", x"2A7D5A", x"2A539A", x"2A29CF", x"29FFF7", x"29D613", x"29AC24",
+         x"29822A", x"295825", x"292E16", x"2903FD", x"28D9DA", x"28AFAE", x"288578", x"285B3B",
+         x"2830F5", x"2806A7", x"27DC52", x"27B1F5", x"278791", x"275D27", x"2732B7", x"270841",
+         x"26DDC6", x"26B345", x"2688C0", x"265E36", x"2633A8", x"260916", x"25DE80", x"25B3E8",
+         x"25894C", x"255EAE", x"25340E", x"25096C", x"24DEC8", x"24B423", x"24897D", x"245ED7",
+         x"243430", x"240989", x"23DEE3", x"23B43D", x"238998", x"235EF4", x"233452", x"2309B2",
+         x"22DF13", x"22B478", x"2289DE", x"225F48", x"2234B5", x"220A26", x"21DF9A", x"21B513",
+         x"218A90", x"216012", x"213598", x"210B24", x"20E0B5", x"20B64D", x"208BEA", x"20618D",
+         x"203737", x"200CE8", x"1FE2A0", x"1FB85F", x"1F8E26", x"1F63F4", x"1F39CB", x"1F0FAA",
+         x"1EE591", x"1EBB82", x"1E917B", x"1E677E", x"1E3D8A", x"1E13A0", x"1DE9BF", x"1DBFE9",
+         x"1D961E", x"1D6C5D", x"1D42A6", x"1D18FB", x"1CEF5C", x"1CC5C7", x"1C9C3E", x"1C72C2",
+         x"1C4951", x"1C1FED", x"1BF695", x"1BCD49", x"1BA40B", x"1B7ADA", x"1B51B5", x"1B289F",
+         x"1AFF96", x"1AD69A", x"1AADAD", x"1A84CE", x"1A5BFD", x"1A333B", x"1A0A87", x"19E1E2",
+         x"19B94C", x"1990C5", x"19684D", x"193FE5", x"19178C", x"18EF43", x"18C70A", x"189EE1",
+         x"1876C8", x"184EBF", x"1826C7", x"17FEDF", x"17D708", x"17AF41", x"17878B", x"175FE7",
+         x"173853", x"1710D1", x"16E960", x"16C201", x"169AB3", x"167376", x"164C4C", x"162533",
+         x"15FE2C", x"15D737", x"15B054", x"158984", x"1562C5", x"153C19", x"151580", x"14EEF9",
+         x"14C884", x"14A222", x"147BD3", x"145596", x"142F6C", x"140955", x"13E351", x"13BD60",
+         x"139782", x"1371B7", x"134BFF", x"13265A", x"1300C9", x"12DB4A", x"12B5DF", x"129086",
+         x"126B42", x"124610", x"1220F2", x"11FBE7", x"11D6EF", x"11B20B", x"118D3A", x"11687C",
+         x"1143D1", x"111F3A", x"10FAB7", x"10D646", x"10B1E9", x"108DA0", x"106969", x"104546",
+         x"102136", x"0FFD39", x"0FD950", x"0FB57A", x"0F91B7", x"0F6E06", x"0F4A6A", x"0F26E0",
+         x"0F0369", x"0EE005", x"0EBCB4", x"0E9975", x"0E764A", x"0E5331", x"0E302B", x"0E0D38",
+         x"0DEA57", x"0DC789", x"0DA4CD", x"0D8223", x"0D5F8C", x"0D3D07", x"0D1A94", x"0CF834",
+         x"0CD5E5", x"0CB3A8", x"0C917D", x"0C6F64", x"0C4D5C", x"0C2B66", x"0C0981", x"0BE7AE",
+         x"0BC5EC", x"0BA43B", x"0B829B", x"0B610C", x"0B3F8E", x"0B1E20", x"0AFCC4", x"0ADB77",
+         x"0ABA3C", x"0A9910", x"0A77F4", x"0A56E9", x"0A35ED", x"0A1501", x"09F425", x"09D358",
+         x"09B29B", x"0991ED", x"09714E", x"0950BE", x"09303C", x"090FCA", x"08EF66", x"08CF10",
+         x"08AEC9", x"088E8F", x"086E64", x"084E46", x"082E36", x"080E33", x"07EE3E", x"07CE55",
+         x"07AE7A", x"078EAC", x"076EEA", x"074F35", x"072F8B", x"070FEF", x"06F05E", x"06D0D8",
+         x"06B15F", x"0691F1", x"06728E", x"065336", x"0633E9", x"0614A7", x"05F570", x"05D642",
+         x"05B71F", x"059806", x"0578F7", x"0559F1", x"053AF5", x"051C02", x"04FD18", x"04DE36",
+         x"04BF5E", x"04A08E", x"0481C6", x"046306", x"04444E", x"04259D", x"0406F4", x"03E853",
+         x"03C9B8", x"03AB24", x"038C97", x"036E10", x"034F90", x"033115", x"0312A0", x"02F431",
+         x"02D5C7", x"02B763", x"029903", x"027AA8", x"025C51", x"023DFF", x"021FB1", x"020167",
+         x"01E321", x"01C4DE", x"01A69E", x"018862", x"016A28", x"014BF1", x"012DBC", x"010F89",
+         x"00F159", x"00D32A", x"00B4FD", x"0096D0", x"0078A5", x"005A7B", x"003C52", x"001E29",
+         x"000000", x"FFE1D7", x"FFC3AE", x"FFA585", x"FF875B", x"FF6930", x"FF4B03", x"FF2CD6",
+         x"FF0EA7", x"FEF077", x"FED244", x"FEB40F", x"FE95D8", x"FE779E", x"FE5962", x"FE3B22",
+         x"FE1CDF", x"FDFE99", x"FDE04F", x"FDC201", x"FDA3AF", x"FD8558", x"FD66FD", x"FD489D",
+         x"FD2A39", x"FD0BCF", x"FCED60", x"FCCEEB", x"FCB070", x"FC91F0", x"FC7369", x"FC54DC",
+         x"FC3648", x"FC17AD", x"FBF90C", x"FBDA63", x"FBBBB2", x"FB9CFA", x"FB7E3A", x"FB5F72",
+         x"FB40A2", x"FB21CA", x"FB02E8", x"FAE3FE", x"FAC50B", x"FAA60F", x"FA8709", x"FA67FA",
+         x"FA48E1", x"FA29BE", x"FA0A90", x"F9EB59", x"F9CC17", x"F9ACCA", x"F98D72", x"F96E0F",
+         x"F94EA1", x"F92F28", x"F90FA2", x"F8F011", x"F8D075", x"F8B0CB", x"F89116", x"F87154",
+         x"F85186", x"F831AB", x"F811C2", x"F7F1CD", x"F7D1CA", x"F7B1BA", x"F7919C", x"F77171",
+         x"F75137", x"F730F0", x"F7109A", x"F6F036", x"F6CFC4", x"F6AF42", x"F68EB2", x"F66E13",
+         x"F64D65", x"F62CA8", x"F60BDB", x"F5EAFF", x"F5CA13", x"F5A917", x"F5880C", x"F566F0",
+         x"F545C4", x"F52489", x"F5033C", x"F4E1E0", x"F4C072", x"F49EF4", x"F47D65", x"F45BC5",
+         x"F43A14", x"F41852", x"F3F67F", x"F3D49A", x"F3B2A4", x"F3909C", x"F36E83", x"F34C58",
+         x"F32A1B", x"F307CC", x"F2E56C", x"F2C2F9", x"F2A074", x"F27DDD", x"F25B33", x"F23877",
+         x"F215A9", x"F1F2C8", x"F1CFD5", x"F1ACCF", x"F189B6", x"F1668B", x"F1434C", x"F11FFB",
+         x"F0FC97", x"F0D920", x"F0B596", x"F091FA", x"F06E49", x"F04A86", x"F026B0", x"F002C7",
+         x"EFDECA", x"EFBABA", x"EF9697", x"EF7260", x"EF4E17", x"EF29BA", x"EF0549", x"EEE0C6",
+         x"EEBC2F", x"EE9784", x"EE72C6", x"EE4DF5", x"EE2911", x"EE0419", x"EDDF0E", x"EDB9F0",
+         x"ED94BE", x"ED6F7A", x"ED4A21", x"ED24B6", x"ECFF37", x"ECD9A6", x"ECB401", x"EC8E49",
+         x"EC687E", x"EC42A0", x"EC1CAF", x"EBF6AB", x"EBD094", x"EBAA6A", x"EB842D", x"EB5DDE",
+         x"EB377C", x"EB1107", x"EAEA80", x"EAC3E7", x"EA9D3B", x"EA767C", x"EA4FAC", x"EA28C9",
+         x"EA01D4", x"E9DACD", x"E9B3B4", x"E98C8A", x"E9654D", x"E93DFF", x"E916A0", x"E8EF2F",
+         x"E8C7AD", x"E8A019", x"E87875", x"E850BF", x"E828F8", x"E80121", x"E7D939", x"E7B141",
+         x"E78938", x"E7611F", x"E738F6", x"E710BD", x"E6E874", x"E6C01B", x"E697B3", x"E66F3B",
+         x"E646B4", x"E61E1E", x"E5F579", x"E5CCC5", x"E5A403", x"E57B32", x"E55253", x"E52966",
+         x"E5006A", x"E4D761", x"E4AE4B", x"E48526", x"E45BF5", x"E432B7", x"E4096B", x"E3E013",
+         x"E3B6AF", x"E38D3E", x"E363C2", x"E33A39", x"E310A4", x"E2E705", x"E2BD5A", x"E293A3",
+         x"E269E2", x"E24017", x"E21641", x"E1EC60", x"E1C276", x"E19882", x"E16E85", x"E1447E",
+         x"E11A6F", x"E0F056", x"E0C635", x"E09C0C", x"E071DA", x"E047A1", x"E01D60", x"DFF318",
+         x"DFC8C9", x"DF9E73", x"DF7416", x"DF49B3", x"DF1F4B", x"DEF4DC", x"DECA68", x"DE9FEE",
+         x"DE7570", x"DE4AED", x"DE2066", x"DDF5DA", x"DDCB4B", x"DDA0B8", x"DD7622", x"DD4B88",
+         x"DD20ED", x"DCF64E", x"DCCBAE", x"DCA10C", x"DC7668", x"DC4BC3", x"DC211D", x"DBF677",
+         x"DBCBD0", x"DBA129", x"DB7683", x"DB4BDD", x"DB2138", x"DAF694", x"DACBF2", x"DAA152",
+         x"DA76B4", x"DA4C18", x"DA2180", x"D9F6EA", x"D9CC58", x"D9A1CA", x"D97740", x"D94CBB",
+         x"D9223A", x"D8F7BF", x"D8CD49", x"D8A2D9", x"D8786F", x"D84E0B", x"D823AE", x"D7F959",
+         x"D7CF0B", x"D7A4C5", x"D77A88", x"D75052", x"D72626", x"D6FC03", x"D6D1EA", x"D6A7DB",
+         x"D67DD6", x"D653DC", x"D629ED", x"D60009", x"D5D631", x"D5AC66", x"D582A6", x"D558F4",
+         x"D52F4F", x"D505B8", x"D4DC2E", x"D4B2B3", x"D48947", x"D45FE9", x"D4369C", x"D40D5D",
+         x"D3E430", x"D3BB12", x"D39206", x"D3690B", x"D34022", x"D3174A", x"D2EE86", x"D2C5D4",
+         x"D29D35", x"D274AA", x"D24C32", x"D223CF", x"D1FB81", x"D1D348", x"D1AB24", x"D18316",
+         x"D15B1F", x"D1333E", x"D10B74", x"D0E3C1", x"D0BC26", x"D094A4", x"D06D39", x"D045E8",
+         x"D01EB0", x"CFF792", x"CFD08D", x"CFA9A4", x"CF82D5", x"CF5C21", x"CF3588", x"CF0F0C",
+         x"CEE8AC", x"CEC269", x"CE9C43", x"CE763A", x"CE5050", x"CE2A83", x"CE04D5", x"CDDF46",
+         x"CDB9D7", x"CD9487", x"CD6F58", x"CD4A49", x"CD255B", x"CD008E", x"CCDBE4", x"CCB75B",
+         x"CC92F4", x"CC6EB0", x"CC4A90", x"CC2693", x"CC02BA", x"CBDF06", x"CBBB76", x"CB980B",
+         x"CB74C5", x"CB51A6", x"CB2EAC", x"CB0BD9", x"CAE92E", x"CAC6A9", x"CAA44C", x"CA8217",
+         x"CA600A", x"CA3E26", x"CA1C6C", x"C9FADA", x"C9D973", x"C9B836", x"C99723", x"C9763B",
+         x"C9557F", x"C934EE", x"C91489", x"C8F451", x"C8D445", x"C8B466", x"C894B5", x"C87531",
+         x"C855DB", x"C836B4", x"C817BC", x"C7F8F2", x"C7DA59", x"C7BBEE", x"C79DB5", x"C77FAB",
+         x"C761D2", x"C7442B", x"C726B5", x"C70970", x"C6EC5E", x"C6CF7E", x"C6B2D1", x"C69657",
+         x"C67A11", x"C65DFE", x"C6421F", x"C62675", x"C60AFF", x"C5EFBE", x"C5D4B3", x"C5B9DD",
+         x"C59F3D", x"C584D3", x"C56A9F", x"C550A3", x"C536DD", x"C51D4F", x"C503F9", x"C4EADA",
+         x"C4D1F4", x"C4B947", x"C4A0D2", x"C48896", x"C47094", x"C458CB", x"C4413C", x"C429E8",
+         x"C412CE", x"C3FBEF", x"C3E54A", x"C3CEE1", x"C3B8B4", x"C3A2C2", x"C38D0C", x"C37793",
+         x"C36256", x"C34D56", x"C33893", x"C3240D", x"C30FC5", x"C2FBBB", x"C2E7EE", x"C2D460",
+         x"C2C110", x"C2ADFF", x"C29B2D", x"C2889A", x"C27646", x"C26432", x"C2525E", x"C240C9",
+         x"C22F75", x"C21E61", x"C20D8E", x"C1FCFB", x"C1ECAA", x"C1DC99", x"C1CCCB", x"C1BD3D",
+         x"C1ADF1", x"C19EE8", x"C19020", x"C1819B", x"C17358", x"C16558", x"C1579A", x"C14A20",
+         x"C13CE8", x"C12FF4", x"C12343", x"C116D6", x"C10AAC", x"C0FEC7", x"C0F325", x"C0E7C8",
+         x"C0DCAF", x"C0D1DA", x"C0C74A", x"C0BCFE", x"C0B2F7", x"C0A935", x"C09FB9", x"C09681",
+         x"C08D8F", x"C084E2", x"C07C7A", x"C07458", x"C06C7B", x"C064E5", x"C05D94", x"C05689",
+         x"C04FC4", x"C04946", x"C0430D", x"C03D1B", x"C0376F", x"C03209", x"C02CEA", x"C02812",
+         x"C02380", x"C01F34", x"C01B30", x"C01772", x"C013FB", x"C010CA", x"C00DE1", x"C00B3E",
+         x"C008E2", x"C006CE", x"C00500", x"C00379", x"C00239", x"C00141", x"C0008F", x"C00025"),
+        -- octave 9
+        (x"C00001", x"C00015", x"C00050", x"C000B3", x"C0013D", x"C001EE", x"C002C8", x"C003C8",
+         x"C004F0", x"C00640", x"C007B7", x"C00955", x"C00B1B", x"C00D08", x"C00F1D", x"C0115A",
+         x"C013BD", x"C01648", x"C018FB", x"C01BD5", x"C01ED6", x"C021FF", x"C0254F", x"C028C7",
+         x"C02C66", x"C0302C", x"C0341A", x"C0382F", x"C03C6B", x"C040CF", x"C0455A", x"C04A0C",
+         x"C04EE6", x"C053E7", x"C0590F", x"C05E5E", x"C063D5", x"C06973", x"C06F38", x"C07525",
+         x"C07B38", x"C08173", x"C087D5", x"C08E5E", x"C0950E", x"C09BE5", x"C0A2E4", x"C0AA09",
+         x"C0B156", x"C0B8CA", x"C0C064", x"C0C826", x"C0D00F", x"C0D81E", x"C0E055", x"C0E8B3",
+         x"C0F137", x"C0F9E2", x"C102B5", x"C10BAE", x"C114CE", x"C11E14", x"C12782", x"C13116",
+         x"C13AD1", x"C144B3", x"C14EBC", x"C158EB", x"C16341", x"C16DBD", x"C17860", x"C1832A",
+         x"C18E1A", x"C19930", x"C1A46D", x"C1AFD1", x"C1BB5B", x"C1C70B", x"C1D2E2", x"C1DEDF",
+         x"C1EB03", x"C1F74D", x"C203BD", x"C21053", x"C21D10", x"C229F2", x"C236FB", x"C2442A",
+         x"C2517F", x"C25EFA", x"C26C9B", x"C27A62", x"C2884F", x"C29662", x"C2A49B", x"C2B2FA",
+         x"C2C17E", x"C2D029", x"C2DEF9", x"C2EDEE", x"C2FD0A", x"C30C4B", x"C31BB1", x"C32B3D",
+         x"C33AEF", x"C34AC6", x"C35AC3", x"C36AE5", x"C37B2C", x"C38B99", x"C39C2B", x"C3ACE2",
+         x"C3BDBF", x"C3CEC1", x"C3DFE7", x"C3F133", x"C402A4", x"C4143A", x"C425F5", x"C437D5",
+         x"C449DA", x"C45C03", x"C46E51", x"C480C4", x"C4935C", x"C4A619", x"C4B8FA", x"C4CBFF",
+         x"C4DF29", x"C4F278", x"C505EB", x"C51982", x"C52D3E", x"C5411E", x"C55522", x"C5694B",
+         x"C57D97", x"C59208", x"C5A69D", x"C5BB55", x"C5D032", x"C5E533", x"C5FA57", x"C60F9F",
+         x"C6250B", x"C63A9B", x"C6504E", x"C66625", x"C67C1F", x"C6923D", x"C6A87E", x"C6BEE3",
+         x"C6D56B", x"C6EC16", x"C702E4", x"C719D6", x"C730EA", x"C74822", x"C75F7D", x"C776FA",
+         x"C78E9B", x"C7A65E", x"C7BE44", x"C7D64D", x"C7EE79", x"C806C7", x"C81F37", x"C837CA",
+         x"C85080", x"C86957", x"C88251", x"C89B6E", x"C8B4AC", x"C8CE0D", x"C8E78F", x"C90134",
+         x"C91AFA", x"C934E3", x"C94EED", x"C96919", x"C98366", x"C99DD6", x"C9B866", x"C9D319",
+         x"C9EDEC", x"CA08E1", x"CA23F7", x"CA3F2F", x"CA5A88", x"CA7601", x"CA919C", x"CAAD58",
+         x"CAC935", x"CAE532", x"CB0150", x"CB1D8F", x"CB39EF", x"CB566F", x"CB730F", x"CB8FD0",
+         x"CBACB2", x"CBC9B3", x"CBE6D5", x"CC0417", x"CC2179", x"CC3EFB", x"CC5C9D", x"CC7A5F",
+         x"CC9840", x"CCB642", x"CCD462", x"CCF2A3", x"CD1103", x"CD2F82", x"CD4E21", x"CD6CDF",
+         x"CD8BBC", x"CDAAB9", x"CDC9D4", x"CDE90E", x"CE0867", x"CE27E0", x"CE4776", x"CE672C",
+         x"CE8700", x"CEA6F3", x"CEC704", x"CEE733", x"CF0781", x"CF27ED", x"CF4877", x"CF691F",
+         x"CF89E5", x"CFAAC9", x"CFCBCA", x"CFECEA", x"D00E27", x"D02F82", x"D050FA", x"D07290",
+         x"D09442", x"D0B613", x"D0D800", x"D0FA0B", x"D11C32", x"D13E76", x"D160D8", x"D18356",
+         x"D1A5F0", x"D1C8A8", x"D1EB7B", x"D20E6C", x"D23178", x"D254A1", x"D277E6", x"D29B47",
+         x"D2BEC4", x"D2E25D", x"D30612", x"D329E2", x"D34DCE", x"D371D6", x"D395F9", x"D3BA38",
+         x"D3DE92", x"D40307", x"D42798", x"D44C43", x"D47109", x"D495EA", x"D4BAE6", x"D4DFFD",
+         x"D5052E", x"D52A7A", x"D54FE0", x"D57561", x"D59AFC", x"D5C0B0", x"D5E67F", x"D60C68",
+         x"D6326B", x"D65888", x"D67EBE", x"D6A50E", x"D6CB77", x"D6F1FA", x"D71896", x"D73F4C",
+         x"D7661A", x"D78D02", x"D7B402", x"D7DB1C", x"D8024E", x"D82999", x"D850FC", x"D87878",
+         x"D8A00C", x"D8C7B9", x"D8EF7E", x"D9175A", x"D93F4F", x"D9675C", x"D98F80", x"D9B7BD",
+         x"D9E011", x"DA087C", x"DA30FF", x"DA5999", x"DA824A", x"DAAB13", x"DAD3F2", x"DAFCE9",
+         x"DB25F6", x"DB4F1A", x"DB7855", x"DBA1A6", x"DBCB0D", x"DBF48B", x"DC1E1F", x"DC47CA",
+         x"DC718A", x"DC9B60", x"DCC54C", x"DCEF4E", x"DD1966", x"DD4393", x"DD6DD5", x"DD982D",
+         x"DDC29A", x"DDED1C", x"DE17B3", x"DE425F", x"DE6D20", x"DE97F5", x"DEC2E0", x"DEEDDE",
+         x"DF18F1", x"DF4419", x"DF6F54", x"DF9AA4", x"DFC607", x"DFF17F", x"E01D0A", x"E048A9",
+         x"E0745C", x"E0A022", x"E0CBFB", x"E0F7E7", x"E123E7", x"E14FFA", x"E17C20", x"E1A858",
+         x"E1D4A3", x"E20101", x"E22D71", x"E259F4", x"E28689", x"E2B330", x"E2DFEA", x"E30CB5",
+         x"E33992", x"E36681", x"E39381", x"E3C093", x"E3EDB7", x"E41AEB", x"E44831", x"E47588",
+         x"E4A2F0", x"E4D069", x"E4FDF3", x"E52B8D", x"E55938", x"E586F4", x"E5B4BF", x"E5E29B",
+         x"E61087", x"E63E83", x"E66C8F", x"E69AAB", x"E6C8D6", x"E6F711", x"E7255B", x"E753B5",
+         x"E7821E", x"E7B096", x"E7DF1D", x"E80DB3", x"E83C57", x"E86B0A", x"E899CC", x"E8C89D",
+         x"E8F77B", x"E92668", x"E95563", x"E9846C", x"E9B382", x"E9E2A7", x"EA11D9", x"EA4119",
+         x"EA7066", x"EA9FC0", x"EACF28", x"EAFE9C", x"EB2E1E", x"EB5DAD", x"EB8D48", x"EBBCEF",
+         x"EBECA4", x"EC1C64", x"EC4C31", x"EC7C0A", x"ECABF0", x"ECDBE1", x"ED0BDD", x"ED3BE6",
+         x"ED6BFA", x"ED9C1A", x"EDCC45", x"EDFC7B", x"EE2CBC", x"EE5D08", x"EE8D5F", x"EEBDC1",
+         x"EEEE2E", x"EF1EA5", x"EF4F26", x"EF7FB2", x"EFB048", x"EFE0E8", x"F01192", x"F04246",
+         x"F07304", x"F0A3CB", x"F0D49B", x"F10575", x"F13658", x"F16745", x"F1983A", x"F1C938",
+         x"F1FA3F", x"F22B4F", x"F25C67", x"F28D87", x"F2BEB0", x"F2EFE1", x"F3211A", x"F3525B",
+         x"F383A4", x"F3B4F5", x"F3E64D", x"F417AC", x"F44913", x"F47A81", x"F4ABF7", x"F4DD73",
+         x"F50EF6", x"F54080", x"F57210", x"F5A3A7", x"F5D545", x"F606E8", x"F63892", x"F66A42",
+         x"F69BF8", x"F6CDB3", x"F6FF75", x"F7313C", x"F76308", x"F794D9", x"F7C6B0", x"F7F88C",
+         x"F82A6D", x"F85C52", x"F88E3C", x"F8C02B", x"F8F21F", x"F92416", x"F95612", x"F98812",
+         x"F9BA16", x"F9EC1E", x"FA1E2A", x"FA5039", x"FA824C", x"FAB462", x"FAE67C", x"FB1898",
+         x"FB4AB8", x"FB7CDA", x"FBAF00", x"FBE128", x"FC1352", x"FC457F", x"FC77AE", x"FCA9E0",
+         x"FCDC13", x"FD0E49", x"FD4080", x"FD72B9", x"FDA4F3", x"FDD72F", x"FE096D", x"FE3BAB",
+         x"FE6DEB", x"FEA02B", x"FED26D", x"FF04AF", x"FF36F1", x"FF6935", x"FF9B78", x"FFCDBC",
+         x"000000", x"003244", x"006488", x"0096CB", x"00C90F", x"00FB51", x"012D93", x"015FD5",
+         x"019215", x"01C455", x"01F693", x"0228D1", x"025B0D", x"028D47", x"02BF80", x"02F1B7",
+         x"0323ED", x"035620", x"038852", x"03BA81", x"03ECAE", x"041ED8", x"045100", x"048326",
+         x"04B548", x"04E768", x"051984", x"054B9E", x"057DB4", x"05AFC7", x"05E1D6", x"0613E2",
+         x"0645EA", x"0677EE", x"06A9EE", x"06DBEA", x"070DE1", x"073FD5", x"0771C4", x"07A3AE",
+         x"07D593", x"080774", x"083950", x"086B27", x"089CF8", x"08CEC4", x"09008B", x"09324D",
+         x"096408", x"0995BE", x"09C76E", x"09F918", x"0A2ABB", x"0A5C59", x"0A8DF0", x"0ABF80",
+         x"0AF10A", x"0B228D", x"0B5409", x"0B857F", x"0BB6ED", x"0BE854", x"0C19B3", x"0C4B0B",
+         x"0C7C5C", x"0CADA5", x"0CDEE6", x"0D101F", x"0D4150", x"0D7279", x"0DA399", x"0DD4B1",
+         x"0E05C1", x"0E36C8", x"0E67C6", x"0E98BB", x"0EC9A8", x"0EFA8B", x"0F2B65", x"0F5C35",
+         x"0F8CFC", x"0FBDBA", x"0FEE6E", x"101F18", x"104FB8", x"10804E", x"10B0DA", x"10E15B",
+         x"1111D2", x"11423F", x"1172A1", x"11A2F8", x"11D344", x"120385", x"1233BB", x"1263E6",
+         x"129406", x"12C41A", x"12F423", x"13241F", x"135410", x"1383F6", x"13B3CF", x"13E39C",
+         x"14135C", x"144311", x"1472B8", x"14A253", x"14D1E2", x"150164", x"1530D8", x"156040",
+         x"158F9A", x"15BEE7", x"15EE27", x"161D59", x"164C7E", x"167B94", x"16AA9D", x"16D998",
+         x"170885", x"173763", x"176634", x"1794F6", x"17C3A9", x"17F24D", x"1820E3", x"184F6A",
+         x"187DE2", x"18AC4B", x"18DAA5", x"1908EF", x"19372A", x"196555", x"199371", x"19C17D",
+         x"19EF79", x"1A1D65", x"1A4B41", x"1A790C", x"1AA6C8", x"1AD473", x"1B020D", x"1B2F97",
+         x"1B5D10", x"1B8A78", x"1BB7CF", x"1BE515", x"1C1249", x"1C3F6D", x"1C6C7F", x"1C997F",
+         x"1CC66E", x"1CF34B", x"1D2016", x"1D4CD0", x"1D7977", x"1DA60C", x"1DD28F", x"1DFEFF",
+         x"1E2B5D", x"1E57A8", x"1E83E0", x"1EB006", x"1EDC19", x"1F0819", x"1F3405", x"1F5FDE",
+         x"1F8BA4", x"1FB757", x"1FE2F6", x"200E81", x"2039F9", x"20655C", x"2090AC", x"20BBE7",
+         x"20E70F", x"211222", x"213D20", x"21680B", x"2192E0", x"21BDA1", x"21E84D", x"2212E4",
+         x"223D66", x"2267D3", x"22922B", x"22BC6D", x"22E69A", x"2310B2", x"233AB4", x"2364A0",
+         x"238E76", x"23B836", x"23E1E1", x"240B75", x"2434F3", x"245E5A", x"2487AB", x"24B0E6",
+         x"24DA0A", x"250317", x"252C0E", x"2554ED", x"257DB6", x"25A667", x"25CF01", x"25F784",
+         x"261FEF", x"264843", x"267080", x"2698A4", x"26C0B1", x"26E8A6", x"271082", x"273847",
+         x"275FF4", x"278788", x"27AF04", x"27D667", x"27FDB2", x"2824E4", x"284BFE", x"2872FE",
+         x"2899E6", x"28C0B4", x"28E76A", x"290E06", x"293489", x"295AF2", x"298142", x"29A778",
+         x"29CD95", x"29F398", x"2A1981", x"2A3F50", x"2A6504", x"2A8A9F", x"2AB020", x"2AD586",
+         x"2AFAD2", x"2B2003", x"2B451A", x"2B6A16", x"2B8EF7", x"2BB3BD", x"2BD868", x"2BFCF9",
+         x"2C216E", x"2C45C8", x"2C6A07", x"2C8E2A", x"2CB232", x"2CD61E", x"2CF9EE", x"2D1DA3",
+         x"2D413C", x"2D64B9", x"2D881A", x"2DAB5F", x"2DCE88", x"2DF194", x"2E1485", x"2E3758",
+         x"2E5A10", x"2E7CAA", x"2E9F28", x"2EC18A", x"2EE3CE", x"2F05F5", x"2F2800", x"2F49ED",
+         x"2F6BBE", x"2F8D70", x"2FAF06", x"2FD07E", x"2FF1D9", x"301316", x"303436", x"305537",
+         x"30761B", x"3096E1", x"30B789", x"30D813", x"30F87F", x"3118CD", x"3138FC", x"31590D",
+         x"317900", x"3198D4", x"31B88A", x"31D820", x"31F799", x"3216F2", x"32362C", x"325547",
+         x"327444", x"329321", x"32B1DF", x"32D07E", x"32EEFD", x"330D5D", x"332B9E", x"3349BE",
+         x"3367C0", x"3385A1", x"33A363", x"33C105", x"33DE87", x"33FBE9", x"34192B", x"34364D",
+         x"34534E", x"347030", x"348CF1", x"34A991", x"34C611", x"34E271", x"34FEB0", x"351ACE",
+         x"3536CB", x"3552A8", x"356E64", x"3589FF", x"35A578", x"35C0D1", x"35DC09", x"35F71F",
+         x"361214", x"362CE7", x"36479A", x"36622A", x"367C9A", x"3696E7", x"36B113", x"36CB1D",
+         x"36E506", x"36FECC", x"371871", x"3731F3", x"374B54", x"376492", x"377DAF", x"3796A9",
+         x"37AF80", x"37C836", x"37E0C9", x"37F939", x"381187", x"3829B3", x"3841BC", x"3859A2",
+         x"387165", x"388906", x"38A083", x"38B7DE", x"38CF16", x"38E62A", x"38FD1C", x"3913EA",
+         x"392A95", x"39411D", x"395782", x"396DC3", x"3983E1", x"3999DB", x"39AFB2", x"39C565",
+         x"39DAF5", x"39F061", x"3A05A9", x"3A1ACD", x"3A2FCE", x"3A44AB", x"3A5963", x"3A6DF8",
+         x"3A8269", x"3A96B5", x"3AAADE", x"3ABEE2", x"3AD2C2", x"3AE67E", x"3AFA15", x"3B0D88",
+         x"3B20D7", x"3B3401", x"3B4706", x"3B59E7", x"3B6CA4", x"3B7F3C", x"3B91AF", x"3BA3FD",
+         x"3BB626", x"3BC82B", x"3BDA0B", x"3BEBC6", x"3BFD5C", x"3C0ECD", x"3C2019", x"3C313F",
+         x"3C4241", x"3C531E", x"3C63D5", x"3C7467", x"3C84D4", x"3C951B", x"3CA53D", x"3CB53A",
+         x"3CC511", x"3CD4C3", x"3CE44F", x"3CF3B5", x"3D02F6", x"3D1212", x"3D2107", x"3D2FD7",
+         x"3D3E82", x"3D4D06", x"3D5B65", x"3D699E", x"3D77B1", x"3D859E", x"3D9365", x"3DA106",
+         x"3DAE81", x"3DBBD6", x"3DC905", x"3DD60E", x"3DE2F0", x"3DEFAD", x"3DFC43", x"3E08B3",
+         x"3E14FD", x"3E2121", x"3E2D1E", x"3E38F5", x"3E44A5", x"3E502F", x"3E5B93", x"3E66D0",
+         x"3E71E6", x"3E7CD6", x"3E87A0", x"3E9243", x"3E9CBF", x"3EA715", x"3EB144", x"3EBB4D",
+         x"3EC52F", x"3ECEEA", x"3ED87E", x"3EE1EC", x"3EEB32", x"3EF452", x"3EFD4B", x"3F061E",
+         x"3F0EC9", x"3F174D", x"3F1FAB", x"3F27E2", x"3F2FF1", x"3F37DA", x"3F3F9C", x"3F4736",
+         x"3F4EAA", x"3F55F7", x"3F5D1C", x"3F641B", x"3F6AF2", x"3F71A2", x"3F782B", x"3F7E8D",
+         x"3F84C8", x"3F8ADB", x"3F90C8", x"3F968D", x"3F9C2B", x"3FA1A2", x"3FA6F1", x"3FAC19",
+         x"3FB11A", x"3FB5F4", x"3FBAA6", x"3FBF31", x"3FC395", x"3FC7D1", x"3FCBE6", x"3FCFD4",
+         x"3FD39A", x"3FD739", x"3FDAB1", x"3FDE01", x"3FE12A", x"3FE42B", x"3FE705", x"3FE9B8",
+         x"3FEC43", x"3FEEA6", x"3FF0E3", x"3FF2F8", x"3FF4E5", x"3FF6AB", x"3FF849", x"3FF9C0",
+         x"3FFB10", x"3FFC38", x"3FFD38", x"3FFE12", x"3FFEC3", x"3FFF4D", x"3FFFB0", x"3FFFEB",
+         x"3FFFFF", x"3FFFEB", x"3FFFB0", x"3FFF4D", x"3FFEC3", x"3FFE12", x"3FFD38", x"3FFC38",
+         x"3FFB10", x"3FF9C0", x"3FF849", x"3FF6AB", x"3FF4E5", x"3FF2F8", x"3FF0E3", x"3FEEA6",
+         x"3FEC43", x"3FE9B8", x"3FE705", x"3FE42B", x"3FE12A", x"3FDE01", x"3FDAB1", x"3FD739",
+         x"3FD39A", x"3FCFD4", x"3FCBE6", x"3FC7D1", x"3FC395", x"3FBF31", x"3FBAA6", x"3FB5F4",
+         x"3FB11A", x"3FAC19", x"3FA6F1", x"3FA1A2", x"3F9C2B", x"3F968D", x"3F90C8", x"3F8ADB",
+         x"3F84C8", x"3F7E8D", x"3F782B", x"3F71A2", x"3F6AF2", x"3F641B", x"3F5D1C", x"3F55F7",
+         x"3F4EAA", x"3F4736", x"3F3F9C", x"3F37DA", x"3F2FF1", x"3F27E2", x"3F1FAB", x"3F174D",
+         x"3F0EC9", x"3F061E", x"3EFD4B", x"3EF452", x"3EEB32", x"3EE1EC", x"3ED87E", x"3ECEEA",
+         x"3EC52F", x"3EBB4D", x"3EB144", x"3EA715", x"3E9CBF", x"3E9243", x"3E87A0", x"3E7CD6",
+         x"3E71E6", x"3E66D0", x"3E5B93", x"3E502F", x"3E44A5", x"3E38F5", x"3E2D1E", x"3E2121",
+         x"3E14FD", x"3E08B3", x"3DFC43", x"3DEFAD", x"3DE2F0", x"3DD60E", x"3DC905", x"3DBBD6",
+         x"3DAE81", x"3DA106", x"3D9365", x"3D859E", x"3D77B1", x"3D699E", x"3D5B65", x"3D4D06",
+         x"3D3E82", x"3D2FD7", x"3D2107", x"3D1212", x"3D02F6", x"3CF3B5", x"3CE44F", x"3CD4C3",
+         x"3CC511", x"3CB53A", x"3CA53D", x"3C951B", x"3C84D4", x"3C7467", x"3C63D5", x"3C531E",
+         x"3C4241", x"3C313F", x"3C2019", x"3C0ECD", x"3BFD5C", x"3BEBC6", x"3BDA0B", x"3BC82B",
+         x"3BB626", x"3BA3FD", x"3B91AF", x"3B7F3C", x"3B6CA4", x"3B59E7", x"3B4706", x"3B3401",
+         x"3B20D7", x"3B0D88", x"3AFA15", x"3AE67E", x"3AD2C2", x"3ABEE2", x"3AAADE", x"3A96B5",
+         x"3A8269", x"3A6DF8", x"3A5963", x"3A44AB", x"3A2FCE", x"3A1ACD", x"3A05A9", x"39F061",
+         x"39DAF5", x"39C565", x"39AFB2", x"3999DB", x"3983E1", x"396DC3", x"395782", x"39411D",
+         x"392A95", x"3913EA", x"38FD1C", x"38E62A", x"38CF16", x"38B7DE", x"38A083", x"388906",
+         x"387165", x"3859A2", x"3841BC", x"3829B3", x"381187", x"37F939", x"37E0C9", x"37C836",
+         x"37AF80", x"3796A9", x"377DAF", x"376492", x"374B54", x"3731F3", x"371871", x"36FECC",
+         x"36E506", x"36CB1D", x"36B113", x"3696E7", x"367C9A", x"36622A", x"36479A", x"362CE7",
+         x"361214", x"35F71F", x"35DC09", x"35C0D1", x"35A578", x"3589FF", x"356E64", x"3552A8",
+         x"3536CB", x"351ACE", x"34FEB0", x"34E271", x"34C611", x"34A991", x"348CF1", x"347030",
+         x"34534E", x"34364D", x"34192B", x"33FBE9", x"33DE87", x"33C105", x"33A363", x"3385A1",
+         x"3367C0", x"3349BE", x"332B9E", x"330D5D", x"32EEFD", x"32D07E", x"32B1DF", x"329321",
+         x"327444", x"325547", x"32362C", x"3216F2", x"31F799", x"31D820", x"31B88A", x"3198D4",
+         x"317900", x"31590D", x"3138FC", x"3118CD", x"30F87F", x"30D813", x"30B789", x"3096E1",
+         x"30761B", x"305537", x"303436", x"301316", x"2FF1D9", x"2FD07E", x"2FAF06", x"2F8D70",
+         x"2F6BBE", x"2F49ED", x"2F2800", x"2F05F5", x"2EE3CE", x"2EC18A", x"2E9F28", x"2E7CAA",
+         x"2E5A10", x"2E3758", x"2E1485", x"2DF194", x"2DCE88", x"2DAB5F", x"2D881A", x"2D64B9",
+         x"2D413C", x"2D1DA3", x"2CF9EE", x"2CD61E", x"2CB232", x"2C8E2A", x"2C6A07", x"2C45C8",
+         x"2C216E", x"2BFCF9", x"2BD868", x"2BB3BD", x"2B8EF7", x"2B6A16", x"2B451A", x"2B2003",
+         x"2AFAD2", x"2AD586", x"2AB020", x"2A8A9F", x"2A6504", x"2A3F50", x"2A1981", x"29F398",
+         x"29CD95", x"29A778", x"298142", x"295AF2", x"293489", x"290E06", x"28E76A", x"28C0B4",
+         x"2899E6", x"2872FE", x"284BFE", x"2824E4", x"27FDB2", x"27D667", x"27AF04", x"278788",
+         x"275FF4", x"273847", x"271082", x"26E8A6", x"26C0B1", x"2698A4", x"267080", x"264843",
+         x"261FEF", x"25F784", x"25CF01", x"25A667", x"257DB6", x"2554ED", x"252C0E", x"250317",
+         x"24DA0A", x"24B0E6", x"2487AB", x"245E5A", x"2434F3", x"240B75", x"23E1E1", x"23B836",
+         x"238E76", x"2364A0", x"233AB4", x"2310B2", x"22E69A", x"22BC6D", x"22922B", x"2267D3",
+         x"223D66", x"2212E4", x"21E84D", x"21BDA1", x"2192E0", x"21680B", x"213D20", x"211222",
+         x"20E70F", x"20BBE7", x"2090AC", x"20655C", x"2039F9", x"200E81", x"1FE2F6", x"1FB757",
+         x"1F8BA4", x"1F5FDE", x"1F3405", x"1F0819", x"1EDC19", x"1EB006", x"1E83E0", x"1E57A8",
+         x"1E2B5D", x"1DFEFF", x"1DD28F", x"1DA60C", x"1D7977", x"1D4CD0", x"1D2016", x"1CF34B",
+         x"1CC66E", x"1C997F", x"1C6C7F", x"1C3F6D", x"1C1249", x"1BE515", x"1BB7CF", x"1B8A78",
+         x"1B5D10", x"1B2F97", x"1B020D", x"1AD473", x"1AA6C8", x"1A790C", x"1A4B41", x"1A1D65",
+         x"19EF79", x"19C17D", x"199371", x"196555", x"19372A", x"1908EF", x"18DAA5", x"18AC4B",
+         x"187DE2", x"184F6A", x"1820E3", x"17F24D", x"17C3A9", x"1794F6", x"176634", x"173763",
+         x"170885", x"16D998", x"16AA9D", x"167B94", x"164C7E", x"161D59", x"15EE27", x"15BEE7",
+         x"158F9A", x"156040", x"1530D8", x"150164", x"14D1E2", x"14A253", x"1472B8", x"144311",
+         x"14135C", x"13E39C", x"13B3CF", x"1383F6", x"135410", x"13241F", x"12F423", x"12C41A",
+         x"129406", x"1263E6", x"1233BB", x"120385", x"11D344", x"11A2F8", x"1172A1", x"11423F",
+         x"1111D2", x"10E15B", x"10B0DA", x"10804E", x"104FB8", x"101F18", x"0FEE6E", x"0FBDBA",
+         x"0F8CFC", x"0F5C35", x"0F2B65", x"0EFA8B", x"0EC9A8", x"0E98BB", x"0E67C6", x"0E36C8",
+         x"0E05C1", x"0DD4B1", x"0DA399", x"0D7279", x"0D4150", x"0D101F", x"0CDEE6", x"0CADA5",
+         x"0C7C5C", x"0C4B0B", x"0C19B3", x"0BE854", x"0BB6ED", x"0B857F", x"0B5409", x"0B228D",
+         x"0AF10A", x"0ABF80", x"0A8DF0", x"0A5C59", x"0A2ABB", x"09F918", x"09C76E", x"0995BE",
+         x"096408", x"09324D", x"09008B", x"08CEC4", x"089CF8", x"086B27", x"083950", x"080774",
+         x"07D593", x"07A3AE", x"0771C4", x"073FD5", x"070DE1", x"06DBEA", x"06A9EE", x"0677EE",
+         x"0645EA", x"0613E2", x"05E1D6", x"05AFC7", x"057DB4", x"054B9E", x"051984", x"04E768",
+         x"04B548", x"048326", x"045100", x"041ED8", x"03ECAE", x"03BA81", x"038852", x"035620",
+         x"0323ED", x"02F1B7", x"02BF80", x"028D47", x"025B0D", x"0228D1", x"01F693", x"01C455",
+         x"019215", x"015FD5", x"012D93", x"00FB51", x"00C90F", x"0096CB", x"006488", x"003244",
+         x"000000", x"FFCDBC", x"FF9B78", x"FF6935", x"FF36F1", x"FF04AF", x"FED26D", x"FEA02B",
+         x"FE6DEB", x"FE3BAB", x"FE096D", x"FDD72F", x"FDA4F3", x"FD72B9", x"FD4080", x"FD0E49",
+         x"FCDC13", x"FCA9E0", x"FC77AE", x"FC457F", x"FC1352", x"FBE128", x"FBAF00", x"FB7CDA",
+         x"FB4AB8", x"FB1898", x"FAE67C", x"FAB462", x"FA824C", x"FA5039", x"FA1E2A", x"F9EC1E",
+         x"F9BA16", x"F98812", x"F95612", x"F92416", x"F8F21F", x"F8C02B", x"F88E3C", x"F85C52",
+         x"F82A6D", x"F7F88C", x"F7C6B0", x"F794D9", x"F76308", x"F7313C", x"F6FF75", x"F6CDB3",
+         x"F69BF8", x"F66A42", x"F63892", x"F606E8", x"F5D545", x"F5A3A7", x"F57210", x"F54080",
+         x"F50EF6", x"F4DD73", x"F4ABF7", x"F47A81", x"F44913", x"F417AC", x"F3E64D", x"F3B4F5",
+         x"F383A4", x"F3525B", x"F3211A", x"F2EFE1", x"F2BEB0", x"F28D87", x"F25C67", x"F22B4F",
+         x"F1FA3F", x"F1C938", x"F1983A", x"F16745", x"F13658", x"F10575", x"F0D49B", x"F0A3CB",
+         x"F07304", x"F04246", x"F01192", x"EFE0E8", x"EFB048", x"EF7FB2", x"EF4F26", x"EF1EA5",
+         x"EEEE2E", x"EEBDC1", x"EE8D5F", x"EE5D08", x"EE2CBC", x"EDFC7B", x"EDCC45", x"ED9C1A",
+         x"ED6BFA", x"ED3BE6", x"ED0BDD", x"ECDBE1", x"ECABF0", x"EC7C0A", x"EC4C31", x"EC1C64",
+         x"EBECA4", x"EBBCEF", x"EB8D48", x"EB5DAD", x"EB2E1E", x"EAFE9C", x"EACF28", x"EA9FC0",
+         x"EA7066", x"EA4119", x"EA11D9", x"E9E2A7", x"E9B382", x"E9846C", x"E95563", x"E92668",
+         x"E8F77B", x"E8C89D", x"E899CC", x"E86B0A", x"E83C57", x"E80DB3", x"E7DF1D", x"E7B096",
+         x"E7821E", x"E753B5", x"E7255B", x"E6F711", x"E6C8D6", x"E69AAB", x"E66C8F", x"E63E83",
+         x"E61087", x"E5E29B", x"E5B4BF", x"E586F4", x"E55938", x"E52B8D", x"E4FDF3", x"E4D069",
+         x"E4A2F0", x"E47588", x"E44831", x"E41AEB", x"E3EDB7", x"E3C093", x"E39381", x"E36681",
+         x"E33992", x"E30CB5", x"E2DFEA", x"E2B330", x"E28689", x"E259F4", x"E22D71", x"E20101",
+         x"E1D4A3", x"E1A858", x"E17C20", x"E14FFA", x"E123E7", x"E0F7E7", x"E0CBFB", x"E0A022",
+         x"E0745C", x"E048A9", x"E01D0A", x"DFF17F", x"DFC607", x"DF9AA4", x"DF6F54", x"DF4419",
+         x"DF18F1", x"DEEDDE", x"DEC2E0", x"DE97F5", x"DE6D20", x"DE425F", x"DE17B3", x"DDED1C",
+         x"DDC29A", x"DD982D", x"DD6DD5", x"DD4393", x"DD1966", x"DCEF4E", x"DCC54C", x"DC9B60",
+         x"DC718A", x"DC47CA", x"DC1E1F", x"DBF48B", x"DBCB0D", x"DBA1A6", x"DB7855", x"DB4F1A",
+         x"DB25F6", x"DAFCE9", x"DAD3F2", x"DAAB13", x"DA824A", x"DA5999", x"DA30FF", x"DA087C",
+         x"D9E011", x"D9B7BD", x"D98F80", x"D9675C", x"D93F4F", x"D9175A", x"D8EF7E", x"D8C7B9",
+         x"D8A00C", x"D87878", x"D850FC", x"D82999", x"D8024E", x"D7DB1C", x"D7B402", x"D78D02",
+         x"D7661A", x"D73F4C", x"D71896", x"D6F1FA", x"D6CB77", x"D6A50E", x"D67EBE", x"D65888",
+         x"D6326B", x"D60C68", x"D5E67F", x"D5C0B0", x"D59AFC", x"D57561", x"D54FE0", x"D52A7A",
+         x"D5052E", x"D4DFFD", x"D4BAE6", x"D495EA", x"D47109", x"D44C43", x"D42798", x"D40307",
+         x"D3DE92", x"D3BA38", x"D395F9", x"D371D6", x"D34DCE", x"D329E2", x"D30612", x"D2E25D",
+         x"D2BEC4", x"D29B47", x"D277E6", x"D254A1", x"D23178", x"D20E6C", x"D1EB7B", x"D1C8A8",
+         x"D1A5F0", x"D18356", x"D160D8", x"D13E76", x"D11C32", x"D0FA0B", x"D0D800", x"D0B613",
+         x"D09442", x"D07290", x"D050FA", x"D02F82", x"D00E27", x"CFECEA", x"CFCBCA", x"CFAAC9",
+         x"CF89E5", x"CF691F", x"CF4877", x"CF27ED", x"CF0781", x"CEE733", x"CEC704", x"CEA6F3",
+         x"CE8700", x"CE672C", x"CE4776", x"CE27E0", x"CE0867", x"CDE90E", x"CDC9D4", x"CDAAB9",
+         x"CD8BBC", x"CD6CDF", x"CD4E21", x"CD2F82", x"CD1103", x"CCF2A3", x"CCD462", x"CCB642",
+         x"CC9840", x"CC7A5F", x"CC5C9D", x"CC3EFB", x"CC2179", x"CC0417", x"CBE6D5", x"CBC9B3",
+         x"CBACB2", x"CB8FD0", x"CB730F", x"CB566F", x"CB39EF", x"CB1D8F", x"CB0150", x"CAE532",
+         x"CAC935", x"CAAD58", x"CA919C", x"CA7601", x"CA5A88", x"CA3F2F", x"CA23F7", x"CA08E1",
+         x"C9EDEC", x"C9D319", x"C9B866", x"C99DD6", x"C98366", x"C96919", x"C94EED", x"C934E3",
+         x"C91AFA", x"C90134", x"C8E78F", x"C8CE0D", x"C8B4AC", x"C89B6E", x"C88251", x"C86957",
+         x"C85080", x"C837CA", x"C81F37", x"C806C7", x"C7EE79", x"C7D64D", x"C7BE44", x"C7A65E",
+         x"C78E9B", x"C776FA", x"C75F7D", x"C74822", x"C730EA", x"C719D6", x"C702E4", x"C6EC16",
+         x"C6D56B", x"C6BEE3", x"C6A87E", x"C6923D", x"C67C1F", x"C66625", x"C6504E", x"C63A9B",
+         x"C6250B", x"C60F9F", x"C5FA57", x"C5E533", x"C5D032", x"C5BB55", x"C5A69D", x"C59208",
+         x"C57D97", x"C5694B", x"C55522", x"C5411E", x"C52D3E", x"C51982", x"C505EB", x"C4F278",
+         x"C4DF29", x"C4CBFF", x"C4B8FA", x"C4A619", x"C4935C", x"C480C4", x"C46E51", x"C45C03",
+         x"C449DA", x"C437D5", x"C425F5", x"C4143A", x"C402A4", x"C3F133", x"C3DFE7", x"C3CEC1",
+         x"C3BDBF", x"C3ACE2", x"C39C2B", x"C38B99", x"C37B2C", x"C36AE5", x"C35AC3", x"C34AC6",
+         x"C33AEF", x"C32B3D", x"C31BB1", x"C30C4B", x"C2FD0A", x"C2EDEE", x"C2DEF9", x"C2D029",
+         x"C2C17E", x"C2B2FA", x"C2A49B", x"C29662", x"C2884F", x"C27A62", x"C26C9B", x"C25EFA",
+         x"C2517F", x"C2442A", x"C236FB", x"C229F2", x"C21D10", x"C21053", x"C203BD", x"C1F74D",
+         x"C1EB03", x"C1DEDF", x"C1D2E2", x"C1C70B", x"C1BB5B", x"C1AFD1", x"C1A46D", x"C19930",
+         x"C18E1A", x"C1832A", x"C17860", x"C16DBD", x"C16341", x"C158EB", x"C14EBC", x"C144B3",
+         x"C13AD1", x"C13116", x"C12782", x"C11E14", x"C114CE", x"C10BAE", x"C102B5", x"C0F9E2",
+         x"C0F137", x"C0E8B3", x"C0E055", x"C0D81E", x"C0D00F", x"C0C826", x"C0C064", x"C0B8CA",
+         x"C0B156", x"C0AA09", x"C0A2E4", x"C09BE5", x"C0950E", x"C08E5E", x"C087D5", x"C08173",
+         x"C07B38", x"C07525", x"C06F38", x"C06973", x"C063D5", x"C05E5E", x"C0590F", x"C053E7",
+         x"C04EE6", x"C04A0C", x"C0455A", x"C040CF", x"C03C6B", x"C0382F", x"C0341A", x"C0302C",
+         x"C02C66", x"C028C7", x"C0254F", x"C021FF", x"C01ED6", x"C01BD5", x"C018FB", x"C01648",
+         x"C013BD", x"C0115A", x"C00F1D", x"C00D08", x"C00B1B", x"C00955", x"C007B7", x"C00640",
+         x"C004F0", x"C003C8", x"C002C8", x"C001EE", x"C0013D", x"C000B3", x"C00050", x"C00015")
+    );
+
+end package wavetable_rom_package;
@@ -0,0 +1,227 @@
+library ieee;
+use ieee.std_logic_1164.all;
+use ieee.numeric_std.all;
+
+entity Param_Stream_v1_0 is
+	generic (
+		-- Users to add parameters here
+        g_FIFO_DEPTH : integer := 16;
+		-- User parameters ends
+		-- Do not modify the parameters beyond this line
+
+		-- Parameters of Axi Slave Bus Interface S_AXI_CTRL
+		C_S_AXI_CTRL_DATA_WIDTH	: integer	:= 32;
+		C_S_AXI_CTRL_ADDR_WIDTH	: integer	:= 6;
+
+		-- Parameters of Axi Slave Bus Interface S_AXIS_CMD
+		C_S_AXIS_CMD_TDATA_WIDTH	: integer	:= 64;
+
+		-- Parameters of Axi Master Bus Interface M_AXI
+		C_M_AXI_ADDR_WIDTH	: integer	:= 32;
+		C_M_AXI_DATA_WIDTH	: integer	:= 32
+	);
+	port (
+		-- Users to add ports here
+
+		-- User ports ends
+		-- Do not modify the ports beyond this line
+
+		-- Ports of Axi Slave Bus Interface S_AXI_CTRL
+		s_axi_ctrl_aclk	: in std_logic;
+		s_axi_ctrl_aresetn	: in std_logic;
+		s_axi_ctrl_awaddr	: in std_logic_vector(C_S_AXI_CTRL_ADDR_WIDTH-1 downto 0);
+		s_axi_ctrl_awprot	: in std_logic_vector(2 downto 0);
+		s_axi_ctrl_awvalid	: in std_logic;
+		s_axi_ctrl_awready	: out std_logic;
+		s_axi_ctrl_wdata	: in std_logic_vector(C_S_AXI_CTRL_DATA_WIDTH-1 downto 0);
+		s_axi_ctrl_wstrb	: in std_logic_vector((C_S_AXI_CTRL_DATA_WIDTH/8)-1 downto 0);
+		s_axi_ctrl_wvalid	: in std_logic;
+		s_axi_ctrl_wready	: out std_logic;
+		s_axi_ctrl_bresp	: out std_logic_vector(1 downto 0);
+		s_axi_ctrl_bvalid	: out std_logic;
+		s_axi_ctrl_bready	: in std_logic;
+		s_axi_ctrl_araddr	: in std_logic_vector(C_S_AXI_CTRL_ADDR_WIDTH-1 downto 0);
+		s_axi_ctrl_arprot	: in std_logic_vector(2 downto 0);
+		s_axi_ctrl_arvalid	: in std_logic;
+		s_axi_ctrl_arready	: out std_logic;
+		s_axi_ctrl_rdata	: out std_logic_vector(C_S_AXI_CTRL_DATA_WIDTH-1 downto 0);
+		s_axi_ctrl_rresp	: out std_logic_vector(1 downto 0);
+		s_axi_ctrl_rvalid	: out std_logic;
+		s_axi_ctrl_rready	: in std_logic;
+
+		-- Ports of Axi Slave Bus Interface S_AXIS_CMD
+		s_axis_cmd_aclk	: in std_logic;
+		s_axis_cmd_aresetn	: in std_logic;
+		s_axis_cmd_tready	: out std_logic;
+		s_axis_cmd_tdata	: in std_logic_vector(C_S_AXIS_CMD_TDATA_WIDTH-1 downto 0);
+		s_axis_cmd_tstrb	: in std_logic_vector((C_S_AXIS_CMD_TDATA_WIDTH/8)-1 downto 0);
+		s_axis_cmd_tlast	: in std_logic;
+		s_axis_cmd_tvalid	: in std_logic;
+
+		-- Ports of Axi Master Bus Interface M_AXI
+		m_axi_aclk	: in std_logic;
+		m_axi_aresetn	: in std_logic;
+		m_axi_awaddr	: out std_logic_vector(C_M_AXI_ADDR_WIDTH-1 downto 0);
+		m_axi_awprot	: out std_logic_vector(2 downto 0);
+		m_axi_awvalid	: out std_logic;
+		m_axi_awready	: in std_logic;
+		m_axi_wdata	: out std_logic_vector(C_M_AXI_DATA_WIDTH-1 downto 0);
+		m_axi_wstrb	: out std_logic_vector(C_M_AXI_DATA_WIDTH/8-1 downto 0);
+		m_axi_wvalid	: out std_logic;
+		m_axi_wready	: in std_logic;
+		m_axi_bresp	: in std_logic_vector(1 downto 0);
+		m_axi_bvalid	: in std_logic;
+		m_axi_bready	: out std_logic
+	);
+end Param_Stream_v1_0;
+
+architecture arch_imp of Param_Stream_v1_0 is
+
+    constant c_NUM_TARGETS : integer := 8;
+
+    -- command fifo signals
+    signal w_cmd_fifo_rd_en   : std_logic;
+    signal w_cmd_fifo_rd_data : std_logic_vector(63 downto 0);
+    signal w_cmd_fifo_empty   : std_logic;
+
+    -- write master signals
+    signal w_wr_start : std_logic;
+    signal w_wr_addr  : std_logic_vector(C_M_AXI_ADDR_WIDTH-1 downto 0);
+    signal w_wr_data  : std_logic_vector(C_M_AXI_DATA_WIDTH-1 downto 0);
+    signal w_wr_busy  : std_logic;
+    signal w_wr_done  : std_logic;
+    signal w_wr_error : std_logic;
+
+    -- control signals
+    signal w_target_base  : std_logic_vector(c_NUM_TARGETS*32-1 downto 0);
+    signal w_status_clear : std_logic;
+    signal w_busy         : std_logic;
+    signal w_reset        : std_logic;
+
+    -- status signals
+    signal w_command_status        : std_logic_vector(31 downto 0);
+    signal w_cmd_fifo_level_status : std_logic_vector(31 downto 0);
+    signal w_cmd_fifo_error_status : std_logic_vector(31 downto 0);
+
+begin
+
+    -- Instantiation of Axi Bus Interface S_AXI_CTRL
+    Param_Stream_v1_0_S_AXI_CTRL_inst : entity work.Param_Stream_v1_0_S_AXI_CTRL
+	generic map (
+		C_S_AXI_DATA_WIDTH	=> C_S_AXI_CTRL_DATA_WIDTH,
+		C_S_AXI_ADDR_WIDTH	=> C_S_AXI_CTRL_ADDR_WIDTH
+	)
+	port map (
+	    o_target_base       => w_target_base,
+	    o_status_clear      => w_status_clear,
+	    i_command_status    => w_command_status,
+	    i_busy              => w_busy,
+	    i_fifo_level_status => w_cmd_fifo_level_status,
+	    i_fifo_error_status => w_cmd_fifo_error_status,
+		S_AXI_ACLK	=> s_axi_ctrl_aclk,
+		S_AXI_ARESETN	=> s_axi_ctrl_aresetn,
+		S_AXI_AWADDR	=> s_axi_ctrl_awaddr,
+		S_AXI_AWPROT	=> s_axi_ctrl_awprot,
+		S_AXI_AWVALID	=> s_axi_ctrl_awvalid,
+		S_AXI_AWREADY	=> s_axi_ctrl_awready,
+		S_AXI_WDATA	=> s_axi_ctrl_wdata,
+		S_AXI_WSTRB	=> s_axi_ctrl_wstrb,
+		S_AXI_WVALID	=> s_axi_ctrl_wvalid,
+		S_AXI_WREADY	=> s_axi_ctrl_wready,
+		S_AXI_BRESP	=> s_axi_ctrl_bresp,
+		S_AXI_BVALID	=> s_axi_ctrl_bvalid,
+		S_AXI_BREADY	=> s_axi_ctrl_bready,
+		S_AXI_ARADDR	=> s_axi_ctrl_araddr,
+		S_AXI_ARPROT	=> s_axi_ctrl_arprot,
+		S_AXI_ARVALID	=> s_axi_ctrl_arvalid,
+		S_AXI_ARREADY	=> s_axi_ctrl_arready,
+		S_AXI_RDATA	=> s_axi_ctrl_rdata,
+		S_AXI_RRESP	=> s_axi_ctrl_rresp,
+		S_AXI_RVALID	=> s_axi_ctrl_rvalid,
+		S_AXI_RREADY	=> s_axi_ctrl_rready
+	);
+
+    -- Instantiation of Axi Bus Interface S_AXIS_CMD
+    Param_Stream_v1_0_S_AXIS_CMD_inst : entity work.Param_Stream_v1_0_S_AXIS_CMD
+	generic map (
+	    g_FIFO_DEPTH         => g_FIFO_DEPTH,
+		C_S_AXIS_TDATA_WIDTH => C_S_AXIS_CMD_TDATA_WIDTH
+	)
+	port map (
+	    -- fifo command read interface
+	    i_fifo_rd_en    => w_cmd_fifo_rd_en,
+        o_fifo_rd_data  => w_cmd_fifo_rd_data,
+	    o_fifo_empty    => w_cmd_fifo_empty,
+        o_fifo_level_status => w_cmd_fifo_level_status,
+        o_fifo_error_status => w_cmd_fifo_error_status,
+	    -- axi stream slave
+		S_AXIS_ACLK	=> s_axis_cmd_aclk,
+		S_AXIS_ARESETN	=> s_axis_cmd_aresetn,
+		S_AXIS_TREADY	=> s_axis_cmd_tready,
+		S_AXIS_TDATA	=> s_axis_cmd_tdata,
+		S_AXIS_TSTRB	=> s_axis_cmd_tstrb,
+		S_AXIS_TLAST	=> s_axis_cmd_tlast,
+		S_AXIS_TVALID	=> s_axis_cmd_tvalid
+	);
+
+    -- Instantiation of Axi Bus Interface M_AXI
+    Param_Stream_v1_0_M_AXI_inst : entity work.Param_Stream_v1_0_M_AXI
+	generic map (
+		C_M_AXI_ADDR_WIDTH	=> C_M_AXI_ADDR_WIDTH,
+		C_M_AXI_DATA_WIDTH	=> C_M_AXI_DATA_WIDTH
+	)
+	port map (
+	    -- write request interface
+	    i_wr_start  => w_wr_start,
+	    i_wr_addr   => w_wr_addr,
+	    i_wr_data   => w_wr_data,
+	    o_wr_busy   => w_wr_busy,
+	    o_wr_done   => w_wr_done,
+	    o_wr_error  => w_wr_error,
+	    -- axi lite master
+		M_AXI_ACLK	=> m_axi_aclk,
+		M_AXI_ARESETN	=> m_axi_aresetn,
+		M_AXI_AWADDR	=> m_axi_awaddr,
+		M_AXI_AWPROT	=> m_axi_awprot,
+		M_AXI_AWVALID	=> m_axi_awvalid,
+		M_AXI_AWREADY	=> m_axi_awready,
+		M_AXI_WDATA	=> m_axi_wdata,
+		M_AXI_WSTRB	=> m_axi_wstrb,
+		M_AXI_WVALID	=> m_axi_wvalid,
+		M_AXI_WREADY	=> m_axi_wready,
+		M_AXI_BRESP	=> m_axi_bresp,
+		M_AXI_BVALID	=> m_axi_bvalid,
+		M_AXI_BREADY	=> m_axi_bready
+	);
+
+	-- Add user logic here
+    w_reset <= not m_axi_aresetn;
+
+    -- Instantiation of the command decoder
+    param_stream_unit : entity work.param_stream
+    generic map(
+        g_NUM_TARGETS => c_NUM_TARGETS,
+        g_ADDR_WIDTH  => C_M_AXI_ADDR_WIDTH,
+        g_DATA_WIDTH  => C_M_AXI_DATA_WIDTH
+    )
+    port map(
+        i_clk              => m_axi_aclk,
+        i_reset            => w_reset,
+        i_target_base      => w_target_base,
+        o_cmd_fifo_rd_en   => w_cmd_fifo_rd_en,
+        i_cmd_fifo_rd_data => w_cmd_fifo_rd_data,
+        i_cmd_fifo_empty   => w_cmd_fifo_empty,
+        o_wr_start         => w_wr_start,
+        o_wr_addr          => w_wr_addr,
+        o_wr_data          => w_wr_data,
+        i_wr_busy          => w_wr_busy,
+        i_wr_done          => w_wr_done,
+        i_wr_error         => w_wr_error,
+        i_status_clear     => w_status_clear,
+        o_command_count    => w_command_status(15 downto 0),
+        o_error_count      => w_command_status(31 downto 16),
+        o_busy             => w_busy
+    );
+	-- User logic ends
+
+end arch_imp;
@@ -0,0 +1,149 @@
+library ieee;
+use ieee.std_logic_1164.all;
+use ieee.numeric_std.all;
+
+entity Param_Stream_v1_0_M_AXI is
+	generic (
+		-- Users to add parameters here
+
+		-- User parameters ends
+		-- Do not modify the parameters beyond this line
+
+		-- Width of M_AXI address bus.
+		C_M_AXI_ADDR_WIDTH	: integer	:= 32;
+		-- Width of M_AXI data bus.
+		C_M_AXI_DATA_WIDTH	: integer	:= 32
+	);
+	port (
+		-- Users to add ports here
+        -- single write request, accepted when o_wr_busy is low
+        i_wr_start : in  std_logic;
+        i_wr_addr  : in  std_logic_vector(C_M_AXI_ADDR_WIDTH-1 downto 0);
+        i_wr_data  : in  std_logic_vector(C_M_AXI_DATA_WIDTH-1 downto 0);
+        o_wr_busy  : out std_logic;
+        -- pulsed with the write response, o_wr_error for SLVERR/DECERR
+        o_wr_done  : out std_logic;
+        o_wr_error : out std_logic;
+		-- User ports ends
+		-- Do not modify the ports beyond this line
+
+		-- AXI clock signal
+		M_AXI_ACLK	: in std_logic;
+		-- AXI active low reset signal
+		M_AXI_ARESETN	: in std_logic;
+		-- Master Interface Write Address Channel ports. Write address (issued by master)
+		M_AXI_AWADDR	: out std_logic_vector(C_M_AXI_ADDR_WIDTH-1 downto 0);
+		-- Write channel Protection type.
+    -- This signal indicates the privilege and security level of the transaction,
+    -- and whether the transaction is a data access or an instruction access.
+		M_AXI_AWPROT	: out std_logic_vector(2 downto 0);
+		-- Write address valid.
+    -- This signal indicates that the master signaling valid write address and control information.
+		M_AXI_AWVALID	: out std_logic;
+		-- Write address ready.
+    -- This signal indicates that the slave is ready to accept an address and associated control signals.
+		M_AXI_AWREADY	: in std_logic;
+		-- Master Interface Write Data Channel ports. Write data (issued by master)
+		M_AXI_WDATA	: out std_logic_vector(C_M_AXI_DATA_WIDTH-1 downto 0);
+		-- Write strobes.
+    -- This signal indicates which byte lanes hold valid data.
+    -- There is one write strobe bit for each eight bits of the write data bus.
+		M_AXI_WSTRB	: out std_logic_vector(C_M_AXI_DATA_WIDTH/8-1 downto 0);
+		-- Write valid. This signal indicates that valid write data and strobes are available.
+		M_AXI_WVALID	: out std_logic;
+		-- Write ready. This signal indicates that the slave can accept the write data.
+		M_AXI_WREADY	: in std_logic;
+		-- Master Interface Write Response Channel ports.
+    -- This signal indicates the status of the write transaction.
+		M_AXI_BRESP	: in std_logic_vector(1 downto 0);
+		-- Write response valid.
+    -- This signal indicates that the channel is signaling a valid write response
+		M_AXI_BVALID	: in std_logic;
+		-- Response ready. This signal indicates that the master can accept a write response.
+		M_AXI_BREADY	: out std_logic
+	);
+end Param_Stream_v1_0_M_AXI;
+
+architecture implementation of Param_Stream_v1_0_M_AXI is
+
+	-- AXI4LITE signals
+	--write address valid
+	signal axi_awvalid	: std_logic;
+	--write data valid
+	signal axi_wvalid	: std_logic;
+	--write response acceptance
+	signal axi_bready	: std_logic;
+	--write address
+	signal axi_awaddr	: std_logic_vector(C_M_AXI_ADDR_WIDTH-1 downto 0);
+	--write data
+	signal axi_wdata	: std_logic_vector(C_M_AXI_DATA_WIDTH-1 downto 0);
+
+	-- the address and data channels are handshaked independently, the
+	-- write is complete with the response
+	signal r_busy : std_logic;
+
+begin
+	-- I/O Connections assignments
+
+	--Adding the offset address to the base addr of the slave
+	M_AXI_AWADDR	<= axi_awaddr;
+	--AXI 4 write data
+	M_AXI_WDATA	<= axi_wdata;
+	M_AXI_AWPROT	<= "000";
+	M_AXI_AWVALID	<= axi_awvalid;
+	--Write Data(W)
+	M_AXI_WVALID	<= axi_wvalid;
+	--Set all byte strobes in this example
+	M_AXI_WSTRB	<= (others => '1');
+	--Write Response (B)
+	M_AXI_BREADY	<= axi_bready;
+
+	o_wr_busy <= r_busy;
+
+	process(M_AXI_ACLK)
+	begin
+	  if rising_edge(M_AXI_ACLK) then
+	    if M_AXI_ARESETN = '0' then
+	      axi_awvalid <= '0';
+	      axi_wvalid  <= '0';
+	      axi_bready  <= '0';
+	      axi_awaddr  <= (others => '0');
+	      axi_wdata   <= (others => '0');
+	      r_busy      <= '0';
+	      o_wr_done   <= '0';
+	      o_wr_error  <= '0';
+	    else
+	      o_wr_done <= '0';
+
+	      if r_busy = '0' then
+	        if i_wr_start = '1' then
+	          -- start the address and data channels together
+	          axi_awaddr  <= i_wr_addr;
+	          axi_wdata   <= i_wr_data;
+	          axi_awvalid <= '1';
+	          axi_wvalid  <= '1';
+	          axi_bready  <= '1';
+	          r_busy      <= '1';
+	        end if;
+	      else
+	        if axi_awvalid = '1' and M_AXI_AWREADY = '1' then
+	          axi_awvalid <= '0';
+	        end if;
+
+	        if axi_wvalid = '1' and M_AXI_WREADY = '1' then
+	          axi_wvalid <= '0';
+	        end if;
+
+	        -- the response can only follow both handshakes
+	        if axi_bready = '1' and M_AXI_BVALID = '1' then
+	          axi_bready <= '0';
+	          r_busy     <= '0';
+	          o_wr_done  <= '1';
+	          o_wr_error <= M_AXI_BRESP(1);
+	        end if;
+	      end if;
+	    end if;
+	  end if;
+	end process;
+
+end implementation;
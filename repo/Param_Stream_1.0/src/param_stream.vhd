@@ -0,0 +1,114 @@
+-- Parameter Stream
+-- Description:
+-- Command decoder that turns a stream of (module, register, value) commands,
+-- read from DDR by an AXI DMA, into AXI-Lite register writes to the control
+-- interfaces of the synth modules. Patch loads and bulk voice updates are
+-- built as a command list by the firmware and sent with a single DMA transfer
+-- instead of one GP0 store per register.
+--
+-- Command format (one 64 bit stream beat):
+-- bits 31..0:  register value
+-- bits 47..32: register byte offset within the module
+-- bits 50..48: module, index of the base address table
+-- bits 63..51: reserved, zero
+--
+-- Commands are executed in order with one write outstanding, so a command
+-- always sees the effect of the previous one (e.g. the ADSR decay after the
+-- sustain level).
+--
+-- Inputs:
+-- i_clk: system clk
+-- i_target_base: base address of each module
+-- command fifo read interface
+-- write master done/error
+--
+-- Outputs:
+-- o_wr_start/o_wr_addr/o_wr_data: write request to the AXI-Lite master
+-- o_command_count/o_error_count: executed commands/error responses since cleared
+-- o_busy: commands pending or a write in flight
+
+library ieee;
+use ieee.std_logic_1164.all;
+use ieee.numeric_std.all;
+
+entity param_stream is
+    generic(
+        g_NUM_TARGETS : integer := 8;
+        g_ADDR_WIDTH  : integer := 32;
+        g_DATA_WIDTH  : integer := 32
+    );
+    port(
+        i_clk               : in std_logic;
+        i_reset             : in std_logic;
+        -- base address table
+        i_target_base       : in std_logic_vector(g_NUM_TARGETS*g_ADDR_WIDTH-1 downto 0);
+        -- command fifo interface
+        o_cmd_fifo_rd_en    : out std_logic;
+        i_cmd_fifo_rd_data  : in std_logic_vector(63 downto 0);
+        i_cmd_fifo_empty    : in std_logic;
+        -- write master interface
+        o_wr_start          : out std_logic;
+        o_wr_addr           : out std_logic_vector(g_ADDR_WIDTH-1 downto 0);
+        o_wr_data           : out std_logic_vector(g_DATA_WIDTH-1 downto 0);
+        i_wr_busy           : in std_logic;
+        i_wr_done           : in std_logic;
+        i_wr_error          : in std_logic;
+        -- status
+        i_status_clear      : in std_logic;
+        o_command_count     : out std_logic_vector(15 downto 0);
+        o_error_count       : out std_logic_vector(15 downto 0);
+        o_busy              : out std_logic
+    );
+end param_stream;
+
+architecture arch of param_stream is
+
+    constant c_MAX_COUNT : integer := 2**16-1;
+
+    signal w_issue  : std_logic;
+    signal w_target : integer range 0 to g_NUM_TARGETS-1;
+    signal w_base   : unsigned(g_ADDR_WIDTH-1 downto 0);
+    signal w_offset : unsigned(15 downto 0);
+
+    signal r_command_count : integer range 0 to c_MAX_COUNT := 0;
+    signal r_error_count   : integer range 0 to c_MAX_COUNT := 0;
+
+begin
+
+    -- the head of the fifo is issued as soon as the master is idle
+    w_issue <= '1' when i_cmd_fifo_empty = '0' and i_wr_busy = '0' else '0';
+
+    w_target <= to_integer(unsigned(i_cmd_fifo_rd_data(50 downto 48))) mod g_NUM_TARGETS;
+    w_base   <= unsigned(i_target_base((w_target+1)*g_ADDR_WIDTH-1 downto w_target*g_ADDR_WIDTH));
+    w_offset <= unsigned(i_cmd_fifo_rd_data(47 downto 32));
+
+    o_cmd_fifo_rd_en <= w_issue;
+    o_wr_start       <= w_issue;
+    o_wr_addr        <= std_logic_vector(w_base + w_offset);
+    o_wr_data        <= i_cmd_fifo_rd_data(g_DATA_WIDTH-1 downto 0);
+
+    o_busy <= not i_cmd_fifo_empty or i_wr_busy;
+
+    -- status counters, saturate until cleared
+    process(i_clk)
+    begin
+        if rising_edge(i_clk) then
+            if i_reset = '1' or i_status_clear = '1' then
+                r_command_count <= 0;
+                r_error_count   <= 0;
+            else
+                if i_wr_done = '1' and r_command_count /= c_MAX_COUNT then
+                    r_command_count <= r_command_count + 1;
+                end if;
+
+                if i_wr_done = '1' and i_wr_error = '1' and r_error_count /= c_MAX_COUNT then
+                    r_error_count <= r_error_count + 1;
+                end if;
+            end if;
+        end if;
+    end process;
+
+    o_command_count <= std_logic_vector(to_unsigned(r_command_count, 16));
+    o_error_count   <= std_logic_vector(to_unsigned(r_error_count, 16));
+
+end arch;
@@ -0,0 +1,556 @@
+library ieee;
+use ieee.std_logic_1164.all;
+use ieee.numeric_std.all;
+use work.synth_config_package.all;
+
+entity Voice_Engine_v1_0 is
+	generic (
+		-- Voice engine parameters
+        g_NUM_CHANNELS        : integer := c_NUM_CHANNELS;
+        g_NUM_OSCILLATORS     : integer := c_NUM_OSCILLATORS;
+        g_DATA_WIDTH          : integer := 24;
+        g_TANH_IMPLEMENTATION : integer := 0;  -- {polynomial, lookup table}
+        g_CYCLES_PER_SAMPLE   : integer := c_SAMPLE_CYCLES;
+
+		-- Parameters of Axi Slave Bus Interface S_AXI_OSC_CTRL
+		C_S_AXI_OSC_CTRL_DATA_WIDTH	: integer	:= 32;
+		C_S_AXI_OSC_CTRL_ADDR_WIDTH	: integer	:= 6;
+
+		-- Parameters of Axi Slave Bus Interface S_AXI_FILTER_CTRL
+		C_S_AXI_FILTER_CTRL_DATA_WIDTH	: integer	:= 32;
+		C_S_AXI_FILTER_CTRL_ADDR_WIDTH	: integer	:= 6;
+
+		-- Parameters of Axi Master Bus Interface M_AXIS_OUTPUT
+		C_M_AXIS_OUTPUT_TDATA_WIDTH	: integer	:= 32;
+		C_M_AXIS_OUTPUT_START_COUNT	: integer	:= 32;
+
+		-- Parameters of Axi Slave Bus Interface S_AXIS_FREQ_MOD
+		C_S_AXIS_FREQ_MOD_TDATA_WIDTH	: integer	:= 32;
+
+		-- Parameters of Axi Slave Bus Interface S_AXIS_PWM
+		C_S_AXIS_PWM_TDATA_WIDTH	: integer	:= 32;
+
+		-- Parameters of Axi Slave Bus Interface S_AXIS_AMP_ENVELOPE
+		C_S_AXIS_AMP_ENVELOPE_TDATA_WIDTH	: integer	:= 32;
+
+		-- Parameters of Axi Slave Bus Interface S_AXIS_FILTER_ENVELOPE
+		C_S_AXIS_FILTER_ENVELOPE_TDATA_WIDTH	: integer	:= 32;
+
+		-- Parameters of Axi Slave Bus Interface S_AXIS_FILTER_MODULATION
+		C_S_AXIS_FILTER_MODULATION_TDATA_WIDTH	: integer	:= 32
+	);
+	port (
+		-- Users to add ports here
+        i_enable : in std_logic;
+
+		-- Ports of Axi Slave Bus Interface S_AXI_OSC_CTRL
+		s_axi_osc_ctrl_aclk	: in std_logic;
+		s_axi_osc_ctrl_aresetn	: in std_logic;
+		s_axi_osc_ctrl_awaddr	: in std_logic_vector(C_S_AXI_OSC_CTRL_ADDR_WIDTH-1 downto 0);
+		s_axi_osc_ctrl_awprot	: in std_logic_vector(2 downto 0);
+		s_axi_osc_ctrl_awvalid	: in std_logic;
+		s_axi_osc_ctrl_awready	: out std_logic;
+		s_axi_osc_ctrl_wdata	: in std_logic_vector(C_S_AXI_OSC_CTRL_DATA_WIDTH-1 downto 0);
+		s_axi_osc_ctrl_wstrb	: in std_logic_vector((C_S_AXI_OSC_CTRL_DATA_WIDTH/8)-1 downto 0);
+		s_axi_osc_ctrl_wvalid	: in std_logic;
+		s_axi_osc_ctrl_wready	: out std_logic;
+		s_axi_osc_ctrl_bresp	: out std_logic_vector(1 downto 0);
+		s_axi_osc_ctrl_bvalid	: out std_logic;
+		s_axi_osc_ctrl_bready	: in std_logic;
+		s_axi_osc_ctrl_araddr	: in std_logic_vector(C_S_AXI_OSC_CTRL_ADDR_WIDTH-1 downto 0);
+		s_axi_osc_ctrl_arprot	: in std_logic_vector(2 downto 0);
+		s_axi_osc_ctrl_arvalid	: in std_logic;
+		s_axi_osc_ctrl_arready	: out std_logic;
+		s_axi_osc_ctrl_rdata	: out std_logic_vector(C_S_AXI_OSC_CTRL_DATA_WIDTH-1 downto 0);
+		s_axi_osc_ctrl_rresp	: out std_logic_vector(1 downto 0);
+		s_axi_osc_ctrl_rvalid	: out std_logic;
+		s_axi_osc_ctrl_rready	: in std_logic;
+
+		-- Ports of Axi Slave Bus Interface S_AXI_FILTER_CTRL
+		s_axi_filter_ctrl_aclk	: in std_logic;
+		s_axi_filter_ctrl_aresetn	: in std_logic;
+		s_axi_filter_ctrl_awaddr	: in std_logic_vector(C_S_AXI_FILTER_CTRL_ADDR_WIDTH-1 downto 0);
+		s_axi_filter_ctrl_awprot	: in std_logic_vector(2 downto 0);
+		s_axi_filter_ctrl_awvalid	: in std_logic;
+		s_axi_filter_ctrl_awready	: out std_logic;
+		s_axi_filter_ctrl_wdata	: in std_logic_vector(C_S_AXI_FILTER_CTRL_DATA_WIDTH-1 downto 0);
+		s_axi_filter_ctrl_wstrb	: in std_logic_vector((C_S_AXI_FILTER_CTRL_DATA_WIDTH/8)-1 downto 0);
+		s_axi_filter_ctrl_wvalid	: in std_logic;
+		s_axi_filter_ctrl_wready	: out std_logic;
+		s_axi_filter_ctrl_bresp	: out std_logic_vector(1 downto 0);
+		s_axi_filter_ctrl_bvalid	: out std_logic;
+		s_axi_filter_ctrl_bready	: in std_logic;
+		s_axi_filter_ctrl_araddr	: in std_logic_vector(C_S_AXI_FILTER_CTRL_ADDR_WIDTH-1 downto 0);
+		s_axi_filter_ctrl_arprot	: in std_logic_vector(2 downto 0);
+		s_axi_filter_ctrl_arvalid	: in std_logic;
+		s_axi_filter_ctrl_arready	: out std_logic;
+		s_axi_filter_ctrl_rdata	: out std_logic_vector(C_S_AXI_FILTER_CTRL_DATA_WIDTH-1 downto 0);
+		s_axi_filter_ctrl_rresp	: out std_logic_vector(1 downto 0);
+		s_axi_filter_ctrl_rvalid	: out std_logic;
+		s_axi_filter_ctrl_rready	: in std_logic;
+
+		-- Ports of Axi Master Bus Interface M_AXIS_OUTPUT
+		m_axis_output_aclk	: in std_logic;
+		m_axis_output_aresetn	: in std_logic;
+		m_axis_output_tvalid	: out std_logic;
+		m_axis_output_tdata	: out std_logic_vector(C_M_AXIS_OUTPUT_TDATA_WIDTH-1 downto 0);
+		m_axis_output_tstrb	: out std_logic_vector((C_M_AXIS_OUTPUT_TDATA_WIDTH/8)-1 downto 0);
+		m_axis_output_tlast	: out std_logic;
+		m_axis_output_tready	: in std_logic;
+
+		-- Ports of Axi Slave Bus Interface S_AXIS_FREQ_MOD
+		s_axis_freq_mod_aclk	: in std_logic;
+		s_axis_freq_mod_aresetn	: in std_logic;
+		s_axis_freq_mod_tready	: out std_logic;
+		s_axis_freq_mod_tdata	: in std_logic_vector(C_S_AXIS_FREQ_MOD_TDATA_WIDTH-1 downto 0);
+		s_axis_freq_mod_tstrb	: in std_logic_vector((C_S_AXIS_FREQ_MOD_TDATA_WIDTH/8)-1 downto 0);
+		s_axis_freq_mod_tlast	: in std_logic;
+		s_axis_freq_mod_tvalid	: in std_logic;
+
+		-- Ports of Axi Slave Bus Interface S_AXIS_PWM
+		s_axis_pwm_aclk	: in std_logic;
+		s_axis_pwm_aresetn	: in std_logic;
+		s_axis_pwm_tready	: out std_logic;
+		s_axis_pwm_tdata	: in std_logic_vector(C_S_AXIS_PWM_TDATA_WIDTH-1 downto 0);
+		s_axis_pwm_tstrb	: in std_logic_vector((C_S_AXIS_PWM_TDATA_WIDTH/8)-1 downto 0);
+		s_axis_pwm_tlast	: in std_logic;
+		s_axis_pwm_tvalid	: in std_logic;
+
+		-- Ports of Axi Slave Bus Interface S_AXIS_AMP_ENVELOPE
+		s_axis_amp_envelope_aclk	: in std_logic;
+		s_axis_amp_envelope_aresetn	: in std_logic;
+		s_axis_amp_envelope_tready	: out std_logic;
+		s_axis_amp_envelope_tdata	: in std_logic_vector(C_S_AXIS_AMP_ENVELOPE_TDATA_WIDTH-1 downto 0);
+		s_axis_amp_envelope_tstrb	: in std_logic_vector((C_S_AXIS_AMP_ENVELOPE_TDATA_WIDTH/8)-1 downto 0);
+		s_axis_amp_envelope_tlast	: in std_logic;
+		s_axis_amp_envelope_tvalid	: in std_logic;
+
+		-- Ports of Axi Slave Bus Interface S_AXIS_FILTER_ENVELOPE
+		s_axis_filter_envelope_aclk	: in std_logic;
+		s_axis_filter_envelope_aresetn	: in std_logic;
+		s_axis_filter_envelope_tready	: out std_logic;
+		s_axis_filter_envelope_tdata	: in std_logic_vector(C_S_AXIS_FILTER_ENVELOPE_TDATA_WIDTH-1 downto 0);
+		s_axis_filter_envelope_tstrb	: in std_logic_vector((C_S_AXIS_FILTER_ENVELOPE_TDATA_WIDTH/8)-1 downto 0);
+		s_axis_filter_envelope_tlast	: in std_logic;
+		s_axis_filter_envelope_tvalid	: in std_logic;
+
+		-- Ports of Axi Slave Bus Interface S_AXIS_FILTER_MODULATION
+		s_axis_filter_modulation_aclk	: in std_logic;
+		s_axis_filter_modulation_aresetn	: in std_logic;
+		s_axis_filter_modulation_tready	: out std_logic;
+		s_axis_filter_modulation_tdata	: in std_logic_vector(C_S_AXIS_FILTER_MODULATION_TDATA_WIDTH-1 downto 0);
+		s_axis_filter_modulation_tstrb	: in std_logic_vector((C_S_AXIS_FILTER_MODULATION_TDATA_WIDTH/8)-1 downto 0);
+		s_axis_filter_modulation_tlast	: in std_logic;
+		s_axis_filter_modulation_tvalid	: in std_logic
+	);
+end Voice_Engine_v1_0;
+
+architecture arch_imp of Voice_Engine_v1_0 is
+
+	-- output fifo signals
+	signal w_output_fifo_wr_en   : std_logic;
+	signal w_output_fifo_wr_data : std_logic_vector(g_DATA_WIDTH-1 downto 0);
+	signal w_output_fifo_full    : std_logic;
+	
+	-- oscillator modulation fifo signals
+	signal w_freq_mod_fifo_rd_en   : std_logic;
+    signal w_freq_mod_fifo_rd_data : std_logic_vector(g_DATA_WIDTH-1 downto 0);
+	signal w_freq_mod_fifo_empty   : std_logic;
+	
+	signal w_pwm_fifo_rd_en   : std_logic;
+    signal w_pwm_fifo_rd_data : std_logic_vector(g_DATA_WIDTH-1 downto 0);
+	signal w_pwm_fifo_empty   : std_logic;
+	
+	-- amplifier envelope fifo signals
+	signal w_amp_envelope_fifo_rd_en   : std_logic;
+    signal w_amp_envelope_fifo_rd_data : std_logic_vector(g_DATA_WIDTH-1 downto 0);
+	signal w_amp_envelope_fifo_empty   : std_logic;
+	
+	-- filter envelope and modulation fifo signals
+	signal w_filter_envelope_fifo_rd_en   : std_logic;
+    signal w_filter_envelope_fifo_rd_data : std_logic_vector(g_DATA_WIDTH-1 downto 0);
+	signal w_filter_envelope_fifo_empty   : std_logic;
+	
+	signal w_filter_modulation_fifo_rd_en   : std_logic;
+    signal w_filter_modulation_fifo_rd_data : std_logic_vector(g_DATA_WIDTH-1 downto 0);
+	signal w_filter_modulation_fifo_empty   : std_logic;
+	
+    -- oscillator control signals
+    signal w_oscillator_select         : std_logic_vector(1 downto 0);
+    signal w_oscillator_channel_select : std_logic_vector(6 downto 0);
+    signal w_freq_mod_enable : std_logic;
+    signal w_pwm_enable      : std_logic;
+    signal w_pulse_width     : std_logic_vector(g_DATA_WIDTH-1 downto 0);
+    signal w_wave_select     : std_logic_vector(1 downto 0);
+    signal w_amplitude       : std_logic_vector(17 downto 0);
+    signal w_fcw             : std_logic_vector(17 downto 0);
+    signal w_detune          : std_logic_vector(17 downto 0);
+    
+    -- filter control signals
+    signal w_cutoff_frequency   : std_logic_vector(17 downto 0);
+    signal w_resonance          : std_logic_vector(17 downto 0);
+    signal w_adsr_amount        : std_logic_vector(17 downto 0);
+    signal w_modulation_en      : std_logic;
+    signal w_modulation_amount  : std_logic_vector(17 downto 0);
+    signal w_filter_type        : std_logic_vector(1 downto 0);
+    signal w_filter_attenuation : std_logic;
+    
+    signal w_filter_channel_select : std_logic_vector(c_CHANNEL_WIDTH-1 downto 0);
+    signal w_cutoff_offset         : std_logic_vector(17 downto 0);
+    signal w_key_note              : std_logic_vector(6 downto 0);
+    signal w_key_tracking_amount   : std_logic_vector(17 downto 0);
+    
+    signal w_oversample_en     : std_logic;
+    signal w_frame_cycles_1x   : std_logic_vector(15 downto 0);
+    signal w_frame_cycles_2x   : std_logic_vector(15 downto 0);
+    signal w_sample_cycles     : std_logic_vector(15 downto 0);
+
+    -- fifo status signals
+    signal w_osc_fifo_select                     : std_logic_vector(1 downto 0);
+    signal w_osc_fifo_level_status               : std_logic_vector(31 downto 0);
+    signal w_osc_fifo_error_status               : std_logic_vector(31 downto 0);
+    signal w_filter_fifo_select                  : std_logic_vector(1 downto 0);
+    signal w_filter_fifo_level_status            : std_logic_vector(31 downto 0);
+    signal w_filter_fifo_error_status            : std_logic_vector(31 downto 0);
+    signal w_output_fifo_level_status            : std_logic_vector(31 downto 0);
+    signal w_output_fifo_error_status            : std_logic_vector(31 downto 0);
+    signal w_freq_mod_fifo_level_status          : std_logic_vector(31 downto 0);
+    signal w_freq_mod_fifo_error_status          : std_logic_vector(31 downto 0);
+    signal w_pwm_fifo_level_status               : std_logic_vector(31 downto 0);
+    signal w_pwm_fifo_error_status               : std_logic_vector(31 downto 0);
+    signal w_amp_envelope_fifo_level_status      : std_logic_vector(31 downto 0);
+    signal w_amp_envelope_fifo_error_status      : std_logic_vector(31 downto 0);
+    signal w_filter_envelope_fifo_level_status   : std_logic_vector(31 downto 0);
+    signal w_filter_envelope_fifo_error_status   : std_logic_vector(31 downto 0);
+    signal w_filter_modulation_fifo_level_status : std_logic_vector(31 downto 0);
+    signal w_filter_modulation_fifo_error_status : std_logic_vector(31 downto 0);
+
+begin
+
+    -- Instantiation of Axi Bus Interface S_AXI_OSC_CTRL (Oscillator register map)
+    Oscillator_v2_0_S_AXI_CTRL_inst : entity work.Oscillator_v2_0_S_AXI_CTRL
+	generic map (
+	    g_NUM_CHANNELS      => g_NUM_CHANNELS,
+		g_NUM_OSCILLATORS   => g_NUM_OSCILLATORS,
+		C_S_AXI_DATA_WIDTH	=> C_S_AXI_OSC_CTRL_DATA_WIDTH,
+		C_S_AXI_ADDR_WIDTH	=> C_S_AXI_OSC_CTRL_ADDR_WIDTH
+	)
+	port map (
+	    i_oscillator_select => w_oscillator_select,
+		i_channel_select    => w_oscillator_channel_select,
+		o_mod_enable    => w_freq_mod_enable,
+        o_pwm_enable    => w_pwm_enable,
+        o_pulse_width   => w_pulse_width,
+        o_wave_select   => w_wave_select,
+        o_amplitude     => w_amplitude,
+        o_fcw           => w_fcw,
+        o_detune        => w_detune,
+        o_param_source  => open,
+        o_fifo_select       => w_osc_fifo_select,
+        i_fifo_level_status => w_osc_fifo_level_status,
+        i_fifo_error_status => w_osc_fifo_error_status,
+        o_flow_status_clear => open,
+        i_flow_status       => (others => '0'),
+		S_AXI_ACLK    	=> s_axi_osc_ctrl_aclk,
+		S_AXI_ARESETN 	=> s_axi_osc_ctrl_aresetn,
+		S_AXI_AWADDR  	=> s_axi_osc_ctrl_awaddr,
+		S_AXI_AWPROT  	=> s_axi_osc_ctrl_awprot,
+		S_AXI_AWVALID 	=> s_axi_osc_ctrl_awvalid,
+		S_AXI_AWREADY 	=> s_axi_osc_ctrl_awready,
+		S_AXI_WDATA   	=> s_axi_osc_ctrl_wdata,
+		S_AXI_WSTRB   	=> s_axi_osc_ctrl_wstrb,
+		S_AXI_WVALID  	=> s_axi_osc_ctrl_wvalid,
+		S_AXI_WREADY  	=> s_axi_osc_ctrl_wready,
+		S_AXI_BRESP   	=> s_axi_osc_ctrl_bresp,
+		S_AXI_BVALID  	=> s_axi_osc_ctrl_bvalid,
+		S_AXI_BREADY  	=> s_axi_osc_ctrl_bready,
+		S_AXI_ARADDR  	=> s_axi_osc_ctrl_araddr,
+		S_AXI_ARPROT  	=> s_axi_osc_ctrl_arprot,
+		S_AXI_ARVALID 	=> s_axi_osc_ctrl_arvalid,
+		S_AXI_ARREADY 	=> s_axi_osc_ctrl_arready,
+		S_AXI_RDATA   	=> s_axi_osc_ctrl_rdata,
+		S_AXI_RRESP   	=> s_axi_osc_ctrl_rresp,
+		S_AXI_RVALID  	=> s_axi_osc_ctrl_rvalid,
+		S_AXI_RREADY  	=> s_axi_osc_ctrl_rready
+	);
+
+    -- Instantiation of Axi Bus Interface S_AXI_FILTER_CTRL (Moog ladder filter register map)
+    Moog_Ladder_Filter_v1_0_S_AXI_CTRL_inst : entity work.Moog_Ladder_Filter_v1_0_S_AXI_CTRL
+	generic map (
+		g_NUM_CHANNELS	    => g_NUM_CHANNELS,
+		C_S_AXI_DATA_WIDTH	=> C_S_AXI_FILTER_CTRL_DATA_WIDTH,
+		C_S_AXI_ADDR_WIDTH	=> C_S_AXI_FILTER_CTRL_ADDR_WIDTH
+	)
+	port map (
+	    i_channel_select      => w_filter_channel_select,
+	    o_cutoff_frequency    => w_cutoff_frequency,
+        o_resonance           => w_resonance,
+        o_adsr_amount         => w_adsr_amount,
+        o_modulation_en       => w_modulation_en,
+        o_modulation_amount   => w_modulation_amount,
+        o_filter_type         => w_filter_type,
+        o_filter_attenuation  => w_filter_attenuation,
+        o_cutoff_offset       => w_cutoff_offset,
+        o_key_note            => w_key_note,
+        o_key_tracking_amount => w_key_tracking_amount,
+        o_oversample_en       => w_oversample_en,
+        i_frame_cycles_1x     => w_frame_cycles_1x,
+        i_frame_cycles_2x     => w_frame_cycles_2x,
+        i_sample_cycles       => w_sample_cycles,
+        o_fifo_select         => w_filter_fifo_select,
+        i_fifo_level_status   => w_filter_fifo_level_status,
+        i_fifo_error_status   => w_filter_fifo_error_status,
+		S_AXI_ACLK    	=> s_axi_filter_ctrl_aclk,
+		S_AXI_ARESETN 	=> s_axi_filter_ctrl_aresetn,
+		S_AXI_AWADDR  	=> s_axi_filter_ctrl_awaddr,
+		S_AXI_AWPROT  	=> s_axi_filter_ctrl_awprot,
+		S_AXI_AWVALID 	=> s_axi_filter_ctrl_awvalid,
+		S_AXI_AWREADY 	=> s_axi_filter_ctrl_awready,
+		S_AXI_WDATA   	=> s_axi_filter_ctrl_wdata,
+		S_AXI_WSTRB   	=> s_axi_filter_ctrl_wstrb,
+		S_AXI_WVALID  	=> s_axi_filter_ctrl_wvalid,
+		S_AXI_WREADY  	=> s_axi_filter_ctrl_wready,
+		S_AXI_BRESP   	=> s_axi_filter_ctrl_bresp,
+		S_AXI_BVALID  	=> s_axi_filter_ctrl_bvalid,
+		S_AXI_BREADY  	=> s_axi_filter_ctrl_bready,
+		S_AXI_ARADDR  	=> s_axi_filter_ctrl_araddr,
+		S_AXI_ARPROT  	=> s_axi_filter_ctrl_arprot,
+		S_AXI_ARVALID 	=> s_axi_filter_ctrl_arvalid,
+		S_AXI_ARREADY 	=> s_axi_filter_ctrl_arready,
+		S_AXI_RDATA   	=> s_axi_filter_ctrl_rdata,
+		S_AXI_RRESP   	=> s_axi_filter_ctrl_rresp,
+		S_AXI_RVALID  	=> s_axi_filter_ctrl_rvalid,
+		S_AXI_RREADY  	=> s_axi_filter_ctrl_rready
+	);
+
+    -- Instantiation of Axi Bus Interface M_AXIS_OUTPUT
+    Moog_Ladder_Filter_v1_0_M_AXIS_OUTPUT_inst : entity work.Moog_Ladder_Filter_v1_0_M_AXIS_OUTPUT
+	generic map (
+	    g_NUM_CHANNELS       => g_NUM_CHANNELS,
+	    g_DATA_WIDTH         => g_DATA_WIDTH,
+		C_M_AXIS_TDATA_WIDTH => C_M_AXIS_OUTPUT_TDATA_WIDTH,
+		C_M_START_COUNT	     => C_M_AXIS_OUTPUT_START_COUNT
+	)
+	port map (
+	    -- fifo output write interface 
+	    i_fifo_wr_en    => w_output_fifo_wr_en,
+        i_fifo_wr_data  => w_output_fifo_wr_data,
+	    o_fifo_full     => w_output_fifo_full,
+        o_fifo_level_status => w_output_fifo_level_status,
+        o_fifo_error_status => w_output_fifo_error_status,
+	    -- axi stream master
+		M_AXIS_ACLK  	=> m_axis_output_aclk,
+		M_AXIS_ARESETN	=> m_axis_output_aresetn,
+		M_AXIS_TVALID	=> m_axis_output_tvalid,
+		M_AXIS_TDATA	=> m_axis_output_tdata,
+		M_AXIS_TSTRB	=> m_axis_output_tstrb,
+		M_AXIS_TLAST	=> m_axis_output_tlast,
+		M_AXIS_TREADY	=> m_axis_output_tready
+	);
+
+    -- Instantiation of Axi Bus Interface S_AXIS_FREQ_MOD
+    Oscillator_v2_0_S_AXIS_FREQ_MOD_inst : entity work.Oscillator_v2_0_S_AXIS_FREQ_MOD
+	generic map (
+	    g_NUM_CHANNELS       => g_NUM_CHANNELS,
+	    g_DATA_WIDTH         => g_DATA_WIDTH,
+		C_S_AXIS_TDATA_WIDTH => C_S_AXIS_FREQ_MOD_TDATA_WIDTH
+	)
+	port map (
+	    -- fifo freq modulation read interface
+	    i_fifo_rd_en    => w_freq_mod_fifo_rd_en,
+        o_fifo_rd_data  => w_freq_mod_fifo_rd_data,
+	    o_fifo_empty    => w_freq_mod_fifo_empty,
+        o_fifo_level_status => w_freq_mod_fifo_level_status,
+        o_fifo_error_status => w_freq_mod_fifo_error_status,
+	    -- axi stream slave
+		S_AXIS_ACLK   	=> s_axis_freq_mod_aclk,
+		S_AXIS_ARESETN	=> s_axis_freq_mod_aresetn,
+		S_AXIS_TREADY 	=> s_axis_freq_mod_tready,
+		S_AXIS_TDATA  	=> s_axis_freq_mod_tdata,
+		S_AXIS_TSTRB  	=> s_axis_freq_mod_tstrb,
+		S_AXIS_TLAST  	=> s_axis_freq_mod_tlast,
+		S_AXIS_TVALID 	=> s_axis_freq_mod_tvalid
+	);
+
+    -- Instantiation of Axi Bus Interface S_AXIS_PWM
+    Oscillator_v2_0_S_AXIS_PWM_inst : entity work.Oscillator_v2_0_S_AXIS_PWM
+	generic map (
+	    g_NUM_CHANNELS       => g_NUM_CHANNELS,
+	    g_DATA_WIDTH         => g_DATA_WIDTH,
+		C_S_AXIS_TDATA_WIDTH => C_S_AXIS_PWM_TDATA_WIDTH
+	)
+	port map (
+	    -- fifo pulse width modulation read interface
+	    i_fifo_rd_en    => w_pwm_fifo_rd_en,
+        o_fifo_rd_data  => w_pwm_fifo_rd_data,
+	    o_fifo_empty    => w_pwm_fifo_empty,
+        o_fifo_level_status => w_pwm_fifo_level_status,
+        o_fifo_error_status => w_pwm_fifo_error_status,
+	    -- axi stream slave
+		S_AXIS_ACLK   	=> s_axis_pwm_aclk,
+		S_AXIS_ARESETN	=> s_axis_pwm_aresetn,
+		S_AXIS_TREADY 	=> s_axis_pwm_tready,
+		S_AXIS_TDATA  	=> s_axis_pwm_tdata,
+		S_AXIS_TSTRB  	=> s_axis_pwm_tstrb,
+		S_AXIS_TLAST  	=> s_axis_pwm_tlast,
+		S_AXIS_TVALID 	=> s_axis_pwm_tvalid
+	);
+
+    -- Instantiation of Axi Bus Interface S_AXIS_AMP_ENVELOPE
+    Multiplier_v2_0_S_AXIS_ENVELOPE_inst : entity work.Multiplier_v2_0_S_AXIS_ENVELOPE
+	generic map (
+	    g_NUM_CHANNELS       => g_NUM_CHANNELS,
+	    g_DATA_WIDTH         => g_DATA_WIDTH,
+		C_S_AXIS_TDATA_WIDTH => C_S_AXIS_AMP_ENVELOPE_TDATA_WIDTH
+	)
+	port map (
+	    -- fifo amplifier envelope read interface
+	    i_fifo_rd_en    => w_amp_envelope_fifo_rd_en,
+        o_fifo_rd_data  => w_amp_envelope_fifo_rd_data,
+	    o_fifo_empty    => w_amp_envelope_fifo_empty,
+        o_fifo_level_status => w_amp_envelope_fifo_level_status,
+        o_fifo_error_status => w_amp_envelope_fifo_error_status,
+	    -- axi stream slave
+		S_AXIS_ACLK   	=> s_axis_amp_envelope_aclk,
+		S_AXIS_ARESETN	=> s_axis_amp_envelope_aresetn,
+		S_AXIS_TREADY 	=> s_axis_amp_envelope_tready,
+		S_AXIS_TDATA  	=> s_axis_amp_envelope_tdata,
+		S_AXIS_TSTRB  	=> s_axis_amp_envelope_tstrb,
+		S_AXIS_TLAST  	=> s_axis_amp_envelope_tlast,
+		S_AXIS_TVALID 	=> s_axis_amp_envelope_tvalid
+	);
+
+    -- Instantiation of Axi Bus Interface S_AXIS_FILTER_ENVELOPE
+    Moog_Ladder_Filter_v1_0_S_AXIS_ADSR_inst : entity work.Moog_Ladder_Filter_v1_0_S_AXIS_ADSR
+	generic map (
+	    g_NUM_CHANNELS       => g_NUM_CHANNELS,
+	    g_DATA_WIDTH         => g_DATA_WIDTH,
+		C_S_AXIS_TDATA_WIDTH => C_S_AXIS_FILTER_ENVELOPE_TDATA_WIDTH
+	)
+	port map (
+	    -- fifo filter envelope read interface
+	    i_fifo_rd_en    => w_filter_envelope_fifo_rd_en,
+        o_fifo_rd_data  => w_filter_envelope_fifo_rd_data,
+	    o_fifo_empty    => w_filter_envelope_fifo_empty,
+        o_fifo_level_status => w_filter_envelope_fifo_level_status,
+        o_fifo_error_status => w_filter_envelope_fifo_error_status,
+	    -- axi stream slave
+		S_AXIS_ACLK   	=> s_axis_filter_envelope_aclk,
+		S_AXIS_ARESETN	=> s_axis_filter_envelope_aresetn,
+		S_AXIS_TREADY 	=> s_axis_filter_envelope_tready,
+		S_AXIS_TDATA  	=> s_axis_filter_envelope_tdata,
+		S_AXIS_TSTRB  	=> s_axis_filter_envelope_tstrb,
+		S_AXIS_TLAST  	=> s_axis_filter_envelope_tlast,
+		S_AXIS_TVALID 	=> s_axis_filter_envelope_tvalid
+	);
+
+    -- Instantiation of Axi Bus Interface S_AXIS_FILTER_MODULATION
+    Moog_Ladder_Filter_v1_0_S_AXI_MODULATION_inst : entity work.Moog_Ladder_Filter_v1_0_S_AXI_MODULATION
+	generic map (
+	    g_NUM_CHANNELS       => g_NUM_CHANNELS,
+	    g_DATA_WIDTH         => g_DATA_WIDTH,
+		C_S_AXIS_TDATA_WIDTH => C_S_AXIS_FILTER_MODULATION_TDATA_WIDTH
+	)
+	port map (
+	    -- fifo filter modulation read interface
+	    i_fifo_rd_en    => w_filter_modulation_fifo_rd_en,
+        o_fifo_rd_data  => w_filter_modulation_fifo_rd_data,
+	    o_fifo_empty    => w_filter_modulation_fifo_empty,
+        o_fifo_level_status => w_filter_modulation_fifo_level_status,
+        o_fifo_error_status => w_filter_modulation_fifo_error_status,
+	    -- axi stream slave
+		S_AXIS_ACLK   	=> s_axis_filter_modulation_aclk,
+		S_AXIS_ARESETN	=> s_axis_filter_modulation_aresetn,
+		S_AXIS_TREADY 	=> s_axis_filter_modulation_tready,
+		S_AXIS_TDATA  	=> s_axis_filter_modulation_tdata,
+		S_AXIS_TSTRB  	=> s_axis_filter_modulation_tstrb,
+		S_AXIS_TLAST  	=> s_axis_filter_modulation_tlast,
+		S_AXIS_TVALID 	=> s_axis_filter_modulation_tvalid
+	);
+
+    -- Instantiation of the fused oscillator, amplifier and filter pipeline
+    voice_engine_unit : entity work.voice_engine
+    generic map(
+        g_NUM_CHANNELS        => g_NUM_CHANNELS,
+        g_NUM_OSCILLATORS     => g_NUM_OSCILLATORS,
+        g_DATA_WIDTH          => g_DATA_WIDTH,
+        g_TANH_IMPLEMENTATION => g_TANH_IMPLEMENTATION,
+        g_CYCLES_PER_SAMPLE   => g_CYCLES_PER_SAMPLE
+    )
+    port map(
+        i_clk                             => m_axis_output_aclk,
+        i_en                              => i_enable,
+        -- oscillator parameters
+        o_oscillator_select               => w_oscillator_select,
+        o_oscillator_channel_select       => w_oscillator_channel_select,
+        i_wave_select                     => w_wave_select,
+        i_fcw                             => w_fcw,
+        i_detune                          => w_detune,
+        i_amplitude                       => w_amplitude,
+        i_pulse_width                     => w_pulse_width,
+        -- oscillator frequency modulation
+        i_freq_mod_en                     => w_freq_mod_enable,
+        o_freq_mod_fifo_rd_en             => w_freq_mod_fifo_rd_en,
+        i_freq_mod_fifo_rd_data           => w_freq_mod_fifo_rd_data(23 downto 6),
+        i_freq_mod_fifo_empty             => w_freq_mod_fifo_empty,
+        -- oscillator pulse width modulation
+        i_pwm_en                          => w_pwm_enable,
+        o_pwm_fifo_rd_en                  => w_pwm_fifo_rd_en,
+        i_pwm_fifo_rd_data                => w_pwm_fifo_rd_data,
+        i_pwm_fifo_empty                  => w_pwm_fifo_empty,
+        -- amplifier envelope
+        o_amp_envelope_fifo_rd_en         => w_amp_envelope_fifo_rd_en,
+        i_amp_envelope_fifo_rd_data       => w_amp_envelope_fifo_rd_data(23 downto 6),
+        i_amp_envelope_fifo_empty         => w_amp_envelope_fifo_empty,
+        -- filter parameters
+        i_resonance                       => w_resonance,
+        i_cutoff_frequency                => w_cutoff_frequency,
+        -- filter ADSR envelope
+        o_filter_envelope_fifo_rd_en      => w_filter_envelope_fifo_rd_en,
+        i_filter_envelope_fifo_rd_data    => w_filter_envelope_fifo_rd_data(23 downto 6),
+        i_filter_envelope_fifo_empty      => w_filter_envelope_fifo_empty,
+        i_filter_envelope_amount          => w_adsr_amount,
+        -- filter modulation (LFO)
+        i_filter_modulation_en            => w_modulation_en,
+        o_filter_modulation_fifo_rd_en    => w_filter_modulation_fifo_rd_en,
+        i_filter_modulation_fifo_rd_data  => w_filter_modulation_fifo_rd_data(23 downto 6),
+        i_filter_modulation_fifo_empty    => w_filter_modulation_fifo_empty,
+        i_filter_modulation_amount        => w_modulation_amount,
+        -- filter per channel cutoff offset and key tracking
+        o_filter_channel_select           => w_filter_channel_select,
+        i_cutoff_offset                   => w_cutoff_offset,
+        i_key_note                        => w_key_note,
+        i_key_tracking_amount             => w_key_tracking_amount,
+        -- filter oversampling
+        i_oversample_en                   => w_oversample_en,
+        o_frame_cycles_1x                 => w_frame_cycles_1x,
+        o_frame_cycles_2x                 => w_frame_cycles_2x,
+        o_sample_cycles                   => w_sample_cycles,
+        -- filter type
+        i_filter_type                     => w_filter_type,
+        i_filter_attenuation              => w_filter_attenuation,
+        -- outputs
+        o_output_fifo_wr_en               => w_output_fifo_wr_en,
+        o_output_fifo_wr_data             => w_output_fifo_wr_data,
+        i_output_fifo_full                => w_output_fifo_full
+    );
+
+    -- fifo status register select
+    -- oscillator {frequency modulation, pwm, amplifier envelope}
+    w_osc_fifo_level_status <= w_freq_mod_fifo_level_status when w_osc_fifo_select = "00" else
+                               w_pwm_fifo_level_status      when w_osc_fifo_select = "01" else
+                               w_amp_envelope_fifo_level_status;
+    w_osc_fifo_error_status <= w_freq_mod_fifo_error_status when w_osc_fifo_select = "00" else
+                               w_pwm_fifo_error_status      when w_osc_fifo_select = "01" else
+                               w_amp_envelope_fifo_error_status;
+    -- filter {none, ADSR, modulation, output}, as the standalone filter without the input fifo
+    w_filter_fifo_level_status <= (others => '0')                       when w_filter_fifo_select = "00" else
+                                  w_filter_envelope_fifo_level_status   when w_filter_fifo_select = "01" else
+                                  w_filter_modulation_fifo_level_status when w_filter_fifo_select = "10" else
+                                  w_output_fifo_level_status;
+    w_filter_fifo_error_status <= (others => '0')                       when w_filter_fifo_select = "00" else
+                                  w_filter_envelope_fifo_error_status   when w_filter_fifo_select = "01" else
+                                  w_filter_modulation_fifo_error_status when w_filter_fifo_select = "10" else
+                                  w_output_fifo_error_status;
+
+end arch_imp;
@@ -0,0 +1,248 @@
+-- Voice Engine
+-- Description:
+-- Fused oscillator, amplifier (NCA) and Moog ladder filter voice pipeline.
+-- The oscillator and filter wrappers of the standalone IPs are used as the
+-- building blocks, but the samples are passed between them directly instead
+-- of through AXI-Stream links and FIFOs, so a voice sample is oscillated,
+-- amplified and filtered within a single sample period.
+--
+-- The oscillator produces one voice every g_NUM_OSCILLATORS cycles, which is
+-- multiplied by the amplifier envelope as it arrives and stored in a per voice
+-- shift register. The filter needs the voices of a pass on consecutive cycles
+-- (the feedback shift register shifts on both input and output data valid),
+-- so once the last voice is stored the filter wrapper is started and reads the
+-- shift register in place of its input FIFO.
+--
+-- The oscillator and filter passes are not overlapped, the filter starts
+-- after the oscillator has produced every voice. At 128 voices, 3 oscillators
+-- and 96 kHz (750 clocks) the oscillator ends about 396 clocks into the sample
+-- period, the filter 168 clocks later in 1x mode and 336 clocks later in 2x
+-- oversampling mode, which leaves less than 20 clocks of margin in 2x mode.
+--
+-- Inputs:
+-- i_clk: system clk
+-- i_en: sample rate enable, starts the processing of all voices
+-- oscillator, amplifier envelope and filter parameters and modulation FIFOs
+--
+-- Outputs:
+-- o_output_fifo_wr_en/o_output_fifo_wr_data: filtered voice samples
+
+library ieee;
+use ieee.std_logic_1164.all;
+use ieee.numeric_std.all;
+use work.synth_config_package.all;
+
+entity voice_engine is
+    generic(
+        g_NUM_CHANNELS        : integer := c_NUM_CHANNELS;
+        g_NUM_OSCILLATORS     : integer := c_NUM_OSCILLATORS;
+        g_DATA_WIDTH          : integer := 24;
+        g_ENVELOPE_WIDTH      : integer := 18;
+        g_TANH_IMPLEMENTATION : integer := 0;  -- {polynomial, lookup table}
+        g_CYCLES_PER_SAMPLE   : integer := c_SAMPLE_CYCLES
+    );
+    port(
+        i_clk                             : in std_logic;
+        i_en                              : in std_logic;
+        -- oscillator parameters
+        o_oscillator_select               : out std_logic_vector(1 downto 0);
+        o_oscillator_channel_select       : out std_logic_vector(6 downto 0);
+        i_wave_select                     : in std_logic_vector(1 downto 0);
+        i_fcw                             : in std_logic_vector(17 downto 0);
+        i_detune                          : in std_logic_vector(17 downto 0);
+        i_amplitude                       : in std_logic_vector(17 downto 0);
+        i_pulse_width                     : in std_logic_vector(23 downto 0);
+        -- oscillator frequency modulation
+        i_freq_mod_en                     : in std_logic;
+        o_freq_mod_fifo_rd_en             : out std_logic;
+        i_freq_mod_fifo_rd_data           : in std_logic_vector(17 downto 0); -- Q1.17
+        i_freq_mod_fifo_empty             : in std_logic;
+        -- oscillator pulse width modulation
+        i_pwm_en                          : in std_logic;
+        o_pwm_fifo_rd_en                  : out std_logic;
+        i_pwm_fifo_rd_data                : in std_logic_vector(23 downto 0);
+        i_pwm_fifo_empty                  : in std_logic;
+        -- amplifier envelope
+        o_amp_envelope_fifo_rd_en         : out std_logic;
+        i_amp_envelope_fifo_rd_data       : in std_logic_vector(g_ENVELOPE_WIDTH-1 downto 0); -- Q1.17
+        i_amp_envelope_fifo_empty         : in std_logic;
+        -- filter parameters
+        i_resonance                       : in std_logic_vector(17 downto 0);
+        i_cutoff_frequency                : in std_logic_vector(17 downto 0); -- Q3.15
+        -- filter ADSR envelope
+        o_filter_envelope_fifo_rd_en      : out std_logic;
+        i_filter_envelope_fifo_rd_data    : in std_logic_vector(17 downto 0); -- Q1.17
+        i_filter_envelope_fifo_empty      : in std_logic;
+        i_filter_envelope_amount          : in std_logic_vector(17 downto 0); -- Q3.15
+        -- filter modulation (LFO)
+        i_filter_modulation_en            : in std_logic;
+        o_filter_modulation_fifo_rd_en    : out std_logic;
+        i_filter_modulation_fifo_rd_data  : in std_logic_vector(17 downto 0); -- Q1.17
+        i_filter_modulation_fifo_empty    : in std_logic;
+        i_filter_modulation_amount        : in std_logic_vector(17 downto 0); -- Q3.15
+        -- filter per channel cutoff offset and key tracking
+        o_filter_channel_select           : out std_logic_vector(c_CHANNEL_WIDTH-1 downto 0);
+        i_cutoff_offset                   : in std_logic_vector(17 downto 0); -- Q3.15
+        i_key_note                        : in std_logic_vector(6 downto 0);
+        i_key_tracking_amount             : in std_logic_vector(17 downto 0); -- Q3.15
+        -- filter oversampling
+        i_oversample_en                   : in std_logic;
+        o_frame_cycles_1x                 : out std_logic_vector(15 downto 0);
+        o_frame_cycles_2x                 : out std_logic_vector(15 downto 0);
+        o_sample_cycles                   : out std_logic_vector(15 downto 0);
+        -- filter type
+        i_filter_type                     : in std_logic_vector(1 downto 0);  -- {low pass, high pass, bandpass}
+        i_filter_attenuation              : in std_logic;                     -- {12dB/Oct, 24dB/Oct}
+        -- outputs
+        o_output_fifo_wr_en               : out std_logic;
+        o_output_fifo_wr_data             : out std_logic_vector(g_DATA_WIDTH-1 downto 0); -- Q1.23
+        i_output_fifo_full                : in std_logic
+    );
+end voice_engine;
+
+architecture arch of voice_engine is
+
+    constant c_PROD_WIDTH : integer := g_DATA_WIDTH + g_ENVELOPE_WIDTH;
+
+    -- oscillator output
+    signal w_oscillator_valid  : std_logic;
+    signal w_oscillator_output : std_logic_vector(g_DATA_WIDTH-1 downto 0);
+
+    -- amplifier
+    signal r_amp_envelope_empty : std_logic := '0';
+    signal w_amp_envelope       : signed(g_ENVELOPE_WIDTH-1 downto 0);
+    signal r_amp_product        : signed(c_PROD_WIDTH-1 downto 0) := (others => '0');
+    signal r_amp_valid          : std_logic := '0';
+    signal w_amp_output         : std_logic_vector(g_DATA_WIDTH-1 downto 0);
+
+    signal r_voice_count : integer range 0 to g_NUM_CHANNELS-1 := 0;
+
+    -- voice buffer between the amplifier and the filter
+    signal w_voice_buffer_en     : std_logic;
+    signal w_voice_buffer_rd_en  : std_logic;
+    signal w_voice_buffer_output : std_logic_vector(g_DATA_WIDTH-1 downto 0);
+
+    signal r_filter_start : std_logic := '0';
+
+begin
+
+    -- oscillator (g_NUM_OSCILLATORS cycles per voice)
+    oscillator_unit : entity work.oscillator_wrapper
+    generic map(
+        g_NUM_CHANNELS    => g_NUM_CHANNELS,
+        g_NUM_OSCILLATORS => g_NUM_OSCILLATORS,
+        g_DATA_WIDTH      => g_DATA_WIDTH
+    )
+    port map(
+        i_clk                     => i_clk,
+        i_en                      => i_en,
+        o_oscillator_select       => o_oscillator_select,
+        o_channel_select          => o_oscillator_channel_select,
+        i_wave_select             => i_wave_select,
+        i_fcw                     => i_fcw,
+        i_detune                  => i_detune,
+        i_amplitude               => i_amplitude,
+        i_pulse_width             => i_pulse_width,
+        i_modulation_en           => i_freq_mod_en,
+        o_modulation_fifo_rd_en   => o_freq_mod_fifo_rd_en,
+        i_modulation_fifo_rd_data => i_freq_mod_fifo_rd_data,
+        i_modulation_fifo_empty   => i_freq_mod_fifo_empty,
+        i_pwm_en                  => i_pwm_en,
+        o_pwm_fifo_rd_en          => o_pwm_fifo_rd_en,
+        i_pwm_fifo_rd_data        => i_pwm_fifo_rd_data,
+        i_pwm_fifo_empty          => i_pwm_fifo_empty,
+        o_output_fifo_wr_en       => w_oscillator_valid,
+        o_output_fifo_wr_data     => w_oscillator_output,
+        i_output_fifo_almost_full => '0',
+        i_flow_status_clear       => '0',
+        o_overflow_count          => open,
+        o_underrun_count          => open
+    );
+
+    -- amplifier, the envelope is read as each voice leaves the oscillator
+    -- if the envelope fifo is initially not empty
+    w_amp_envelope <= signed(i_amp_envelope_fifo_rd_data) when r_amp_envelope_empty = '0' else (others => '0');
+
+    o_amp_envelope_fifo_rd_en <= w_oscillator_valid and not r_amp_envelope_empty;
+
+    process(i_clk)
+    begin
+        if rising_edge(i_clk) then
+            if i_en = '1' then
+                r_amp_envelope_empty <= i_amp_envelope_fifo_empty;
+            end if;
+
+            r_amp_product <= signed(w_oscillator_output) * w_amp_envelope;
+            r_amp_valid   <= w_oscillator_valid;
+
+            -- start the filter once the last voice is in the voice buffer
+            r_filter_start <= '0';
+            if r_amp_valid = '1' then
+                if r_voice_count = g_NUM_CHANNELS-1 then
+                    r_voice_count  <= 0;
+                    r_filter_start <= '1';
+                else
+                    r_voice_count  <= r_voice_count + 1;
+                end if;
+            end if;
+        end if;
+    end process;
+
+    w_amp_output <= std_logic_vector(resize(shift_right(r_amp_product, g_ENVELOPE_WIDTH-1), g_DATA_WIDTH));
+
+    -- voice buffer, written by the amplifier and read by the filter
+    w_voice_buffer_en <= r_amp_valid or w_voice_buffer_rd_en;
+
+    shift_reg_voice_buffer : entity work.shift_register
+    generic map(
+        g_LENGTH    => g_NUM_CHANNELS,
+        g_DATA_SIZE => g_DATA_WIDTH
+    )
+    port map(
+        i_clk  => i_clk,
+        i_en   => w_voice_buffer_en,
+        i_in   => w_amp_output,
+        o_out  => w_voice_buffer_output
+    );
+
+    -- Moog ladder filter
+    ladder_filter : entity work.moog_ladder_filter_wrapper
+    generic map(
+        g_NUM_CHANNELS        => g_NUM_CHANNELS,
+        g_DATA_WIDTH          => g_DATA_WIDTH,
+        g_TANH_IMPLEMENTATION => g_TANH_IMPLEMENTATION,
+        g_CYCLES_PER_SAMPLE   => g_CYCLES_PER_SAMPLE
+    )
+    port map(
+        i_clk                     => i_clk,
+        i_en                      => r_filter_start,
+        o_input_fifo_rd_en        => w_voice_buffer_rd_en,
+        i_input_fifo_rd_data      => w_voice_buffer_output,
+        i_input_fifo_empty        => '0',
+        i_resonance               => i_resonance,
+        i_cutoff_frequency        => i_cutoff_frequency,
+        o_adsr_fifo_rd_en         => o_filter_envelope_fifo_rd_en,
+        i_adsr_fifo_rd_data       => i_filter_envelope_fifo_rd_data,
+        i_adsr_fifo_empty         => i_filter_envelope_fifo_empty,
+        i_adsr_amount             => i_filter_envelope_amount,
+        i_modulation_en           => i_filter_modulation_en,
+        o_modulation_fifo_rd_en   => o_filter_modulation_fifo_rd_en,
+        i_modulation_fifo_rd_data => i_filter_modulation_fifo_rd_data,
+        i_modulation_fifo_empty   => i_filter_modulation_fifo_empty,
+        i_modulation_amount       => i_filter_modulation_amount,
+        o_channel_select          => o_filter_channel_select,
+        i_cutoff_offset           => i_cutoff_offset,
+        i_key_note                => i_key_note,
+        i_key_tracking_amount     => i_key_tracking_amount,
+        i_oversample_en           => i_oversample_en,
+        o_frame_cycles_1x         => o_frame_cycles_1x,
+        o_frame_cycles_2x         => o_frame_cycles_2x,
+        o_sample_cycles           => o_sample_cycles,
+        i_filter_type             => i_filter_type,
+        i_filter_attenuation      => i_filter_attenuation,
+        o_output_fifo_wr_en       => o_output_fifo_wr_en,
+        o_output_fifo_wr_data     => o_output_fifo_wr_data,
+        i_output_fifo_full        => i_output_fifo_full
+    );
+
+end arch;
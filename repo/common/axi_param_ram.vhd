@@ -0,0 +1,285 @@
+-- AXI Parameter RAM
+-- Description:
+-- Per voice parameter memory with an AXI4 (full) slave interface, so the
+-- parameters of many voices can be loaded or updated with burst transactions.
+-- The memory is split into g_NUM_BANKS banks of 2**g_INDEX_WIDTH words, one
+-- bank per parameter, so the core can read all parameters of a voice in the
+-- same cycle. The AXI address of a word is
+--     (bank * 2**g_INDEX_WIDTH + index) * 4
+-- INCR, WRAP and FIXED bursts of full width transfers are supported, reads
+-- and writes are served one burst at a time so each bank needs one port for
+-- the AXI interface and one for the core. The storage is selected with
+-- g_MEMORY_TYPE as for the FIFO.
+--
+-- Inputs:
+-- i_rd_index: core read index per bank, bank n in bits (n+1)*g_INDEX_WIDTH-1 downto n*g_INDEX_WIDTH
+-- S_AXI_*: AXI4 slave interface
+--
+-- Outputs:
+-- o_rd_data: core read data per bank, bank n in bits (n+1)*32-1 downto n*32,
+--            valid the cycle after i_rd_index
+
+library ieee;
+use ieee.std_logic_1164.all;
+use ieee.numeric_std.all;
+
+entity axi_param_ram is
+    generic(
+        g_NUM_BANKS        : integer := 4;
+        g_INDEX_WIDTH      : integer := 7;
+        g_MEMORY_TYPE      : string  := "block"; -- {"registers", "distributed", "block"}
+        C_S_AXI_ID_WIDTH   : integer := 1;
+        C_S_AXI_DATA_WIDTH : integer := 32;
+        C_S_AXI_ADDR_WIDTH : integer := 11
+    );
+    port(
+        -- core read interface
+        i_rd_index    : in  std_logic_vector(g_NUM_BANKS*g_INDEX_WIDTH-1 downto 0);
+        o_rd_data     : out std_logic_vector(g_NUM_BANKS*C_S_AXI_DATA_WIDTH-1 downto 0);
+        -- AXI4 slave interface
+        S_AXI_ACLK    : in  std_logic;
+        S_AXI_ARESETN : in  std_logic;
+        S_AXI_AWID    : in  std_logic_vector(C_S_AXI_ID_WIDTH-1 downto 0);
+        S_AXI_AWADDR  : in  std_logic_vector(C_S_AXI_ADDR_WIDTH-1 downto 0);
+        S_AXI_AWLEN   : in  std_logic_vector(7 downto 0);
+        S_AXI_AWSIZE  : in  std_logic_vector(2 downto 0);
+        S_AXI_AWBURST : in  std_logic_vector(1 downto 0);
+        S_AXI_AWLOCK  : in  std_logic;
+        S_AXI_AWCACHE : in  std_logic_vector(3 downto 0);
+        S_AXI_AWPROT  : in  std_logic_vector(2 downto 0);
+        S_AXI_AWVALID : in  std_logic;
+        S_AXI_AWREADY : out std_logic;
+        S_AXI_WDATA   : in  std_logic_vector(C_S_AXI_DATA_WIDTH-1 downto 0);
+        S_AXI_WSTRB   : in  std_logic_vector((C_S_AXI_DATA_WIDTH/8)-1 downto 0);
+        S_AXI_WLAST   : in  std_logic;
+        S_AXI_WVALID  : in  std_logic;
+        S_AXI_WREADY  : out std_logic;
+        S_AXI_BID     : out std_logic_vector(C_S_AXI_ID_WIDTH-1 downto 0);
+        S_AXI_BRESP   : out std_logic_vector(1 downto 0);
+        S_AXI_BVALID  : out std_logic;
+        S_AXI_BREADY  : in  std_logic;
+        S_AXI_ARID    : in  std_logic_vector(C_S_AXI_ID_WIDTH-1 downto 0);
+        S_AXI_ARADDR  : in  std_logic_vector(C_S_AXI_ADDR_WIDTH-1 downto 0);
+        S_AXI_ARLEN   : in  std_logic_vector(7 downto 0);
+        S_AXI_ARSIZE  : in  std_logic_vector(2 downto 0);
+        S_AXI_ARBURST : in  std_logic_vector(1 downto 0);
+        S_AXI_ARLOCK  : in  std_logic;
+        S_AXI_ARCACHE : in  std_logic_vector(3 downto 0);
+        S_AXI_ARPROT  : in  std_logic_vector(2 downto 0);
+        S_AXI_ARVALID : in  std_logic;
+        S_AXI_ARREADY : out std_logic;
+        S_AXI_RID     : out std_logic_vector(C_S_AXI_ID_WIDTH-1 downto 0);
+        S_AXI_RDATA   : out std_logic_vector(C_S_AXI_DATA_WIDTH-1 downto 0);
+        S_AXI_RRESP   : out std_logic_vector(1 downto 0);
+        S_AXI_RLAST   : out std_logic;
+        S_AXI_RVALID  : out std_logic;
+        S_AXI_RREADY  : in  std_logic
+    );
+end axi_param_ram;
+
+architecture arch of axi_param_ram is
+
+    function clog2(n : integer) return integer is
+        variable r : integer := 0;
+    begin
+        while 2**r < n loop
+            r := r + 1;
+        end loop;
+        return r;
+    end function;
+
+    -- addressing
+    constant c_ADDR_LSB    : integer := clog2(C_S_AXI_DATA_WIDTH/8);
+    constant c_BANK_BITS   : integer := clog2(g_NUM_BANKS);
+    constant c_WORD_WIDTH  : integer := g_INDEX_WIDTH + c_BANK_BITS;
+    constant c_BANK_DEPTH  : integer := 2**g_INDEX_WIDTH;
+
+    constant c_BURST_FIXED : std_logic_vector(1 downto 0) := "00";
+    constant c_BURST_WRAP  : std_logic_vector(1 downto 0) := "10";
+
+    -- AXI4 signals
+    signal axi_awready : std_logic := '0';
+    signal axi_wready  : std_logic := '0';
+    signal axi_bvalid  : std_logic := '0';
+    signal axi_bid     : std_logic_vector(C_S_AXI_ID_WIDTH-1 downto 0) := (others => '0');
+    signal axi_arready : std_logic := '0';
+    signal axi_rvalid  : std_logic := '0';
+    signal axi_rid     : std_logic_vector(C_S_AXI_ID_WIDTH-1 downto 0) := (others => '0');
+
+    -- a write or read burst is in progress, only one is served at a time
+    signal axi_awv_awr_flag : std_logic := '0';
+    signal axi_arv_arr_flag : std_logic := '0';
+
+    signal axi_awaddr     : unsigned(c_WORD_WIDTH-1 downto 0) := (others => '0');
+    signal axi_awlen      : unsigned(7 downto 0) := (others => '0');
+    signal axi_awburst    : std_logic_vector(1 downto 0) := (others => '0');
+    signal axi_araddr     : unsigned(c_WORD_WIDTH-1 downto 0) := (others => '0');
+    signal axi_arlen      : unsigned(7 downto 0) := (others => '0');
+    signal axi_arburst    : std_logic_vector(1 downto 0) := (others => '0');
+    signal axi_arlen_cntr : unsigned(7 downto 0) := (others => '0');
+
+    signal w_wr_beat      : std_logic;
+    signal w_rd_beat      : std_logic;
+    signal w_araddr_next  : unsigned(c_WORD_WIDTH-1 downto 0);
+    signal w_ram_addr     : unsigned(c_WORD_WIDTH-1 downto 0);
+
+    -- memory
+    type t_bank_data is array (0 to g_NUM_BANKS-1) of std_logic_vector(C_S_AXI_DATA_WIDTH-1 downto 0);
+    signal r_axi_rd_data : t_bank_data;
+
+    -- next word address of a burst
+    function burst_next(addr : unsigned; len : unsigned; burst : std_logic_vector) return unsigned is
+        variable v_mask : unsigned(addr'range);
+    begin
+        if burst = c_BURST_FIXED then
+            return addr;
+        elsif burst = c_BURST_WRAP then
+            -- wrap bursts are 2, 4, 8 or 16 beats, so len is the wrap mask
+            v_mask := resize(len, addr'length);
+            return (addr and not v_mask) or ((addr + 1) and v_mask);
+        else
+            return addr + 1;
+        end if;
+    end function;
+
+begin
+
+    S_AXI_AWREADY <= axi_awready;
+    S_AXI_WREADY  <= axi_wready;
+    S_AXI_BID     <= axi_bid;
+    S_AXI_BRESP   <= "00";
+    S_AXI_BVALID  <= axi_bvalid;
+    S_AXI_ARREADY <= axi_arready;
+    S_AXI_RID     <= axi_rid;
+    S_AXI_RDATA   <= r_axi_rd_data(to_integer(axi_araddr(c_WORD_WIDTH-1 downto g_INDEX_WIDTH)));
+    S_AXI_RRESP   <= "00";
+    S_AXI_RLAST   <= '1' when axi_rvalid = '1' and axi_arlen_cntr = axi_arlen else '0';
+    S_AXI_RVALID  <= axi_rvalid;
+
+    w_wr_beat <= axi_wready and S_AXI_WVALID;
+    w_rd_beat <= axi_rvalid and S_AXI_RREADY;
+
+    -- write address, data and response channels
+    process(S_AXI_ACLK)
+    begin
+        if rising_edge(S_AXI_ACLK) then
+            if S_AXI_ARESETN = '0' then
+                axi_awready      <= '0';
+                axi_wready       <= '0';
+                axi_bvalid       <= '0';
+                axi_awv_awr_flag <= '0';
+            else
+                axi_awready <= '0';
+                if axi_awready = '0' and S_AXI_AWVALID = '1' and axi_awv_awr_flag = '0' and axi_bvalid = '0' and
+                   axi_arready = '0' and axi_arv_arr_flag = '0' and S_AXI_ARVALID = '0' then
+                    axi_awready <= '1';
+                end if;
+
+                if axi_awready = '1' and S_AXI_AWVALID = '1' then
+                    axi_awv_awr_flag <= '1';
+                    axi_awaddr       <= unsigned(S_AXI_AWADDR(c_ADDR_LSB+c_WORD_WIDTH-1 downto c_ADDR_LSB));
+                    axi_awlen        <= unsigned(S_AXI_AWLEN);
+                    axi_awburst      <= S_AXI_AWBURST;
+                    axi_bid          <= S_AXI_AWID;
+                    axi_wready       <= '1';
+                end if;
+
+                if w_wr_beat = '1' then
+                    axi_awaddr <= burst_next(axi_awaddr, axi_awlen, axi_awburst);
+                    if S_AXI_WLAST = '1' then
+                        axi_wready       <= '0';
+                        axi_awv_awr_flag <= '0';
+                        axi_bvalid       <= '1';
+                    end if;
+                end if;
+
+                if axi_bvalid = '1' and S_AXI_BREADY = '1' then
+                    axi_bvalid <= '0';
+                end if;
+            end if;
+        end if;
+    end process;
+
+    -- read address and data channels, the memory is read at the address of
+    -- the next beat so the data of the current beat is held while RREADY is low
+    w_araddr_next <= unsigned(S_AXI_ARADDR(c_ADDR_LSB+c_WORD_WIDTH-1 downto c_ADDR_LSB)) when axi_arready = '1' and S_AXI_ARVALID = '1' else
+                     burst_next(axi_araddr, axi_arlen, axi_arburst)                     when w_rd_beat = '1' else
+                     axi_araddr;
+
+    w_ram_addr <= axi_awaddr when axi_awv_awr_flag = '1' else w_araddr_next;
+
+    process(S_AXI_ACLK)
+    begin
+        if rising_edge(S_AXI_ACLK) then
+            if S_AXI_ARESETN = '0' then
+                axi_arready      <= '0';
+                axi_rvalid       <= '0';
+                axi_arv_arr_flag <= '0';
+            else
+                axi_arready <= '0';
+                if axi_arready = '0' and S_AXI_ARVALID = '1' and axi_arv_arr_flag = '0' and
+                   axi_awready = '0' and axi_awv_awr_flag = '0' and axi_bvalid = '0' then
+                    axi_arready <= '1';
+                end if;
+
+                axi_araddr <= w_araddr_next;
+
+                if axi_arready = '1' and S_AXI_ARVALID = '1' then
+                    axi_arv_arr_flag <= '1';
+                    axi_arlen        <= unsigned(S_AXI_ARLEN);
+                    axi_arburst      <= S_AXI_ARBURST;
+                    axi_arlen_cntr   <= (others => '0');
+                    axi_rid          <= S_AXI_ARID;
+                    axi_rvalid       <= '1';
+                elsif w_rd_beat = '1' then
+                    if axi_arlen_cntr = axi_arlen then
+                        axi_rvalid       <= '0';
+                        axi_arv_arr_flag <= '0';
+                    else
+                        axi_arlen_cntr <= axi_arlen_cntr + 1;
+                    end if;
+                end if;
+            end if;
+        end if;
+    end process;
+
+    -- parameter banks, port A is used by the AXI interface and port B by the core
+    bank_gen : for B in 0 to g_NUM_BANKS-1 generate
+        type t_ram is array (0 to c_BANK_DEPTH-1) of std_logic_vector(C_S_AXI_DATA_WIDTH-1 downto 0);
+        signal r_ram : t_ram := (others => (others => '0'));
+
+        attribute ram_style : string;
+        attribute ram_style of r_ram : signal is g_MEMORY_TYPE;
+
+        signal w_bank_select : std_logic;
+        signal w_index       : integer range 0 to c_BANK_DEPTH-1;
+    begin
+        w_bank_select <= '1' when to_integer(w_ram_addr(c_WORD_WIDTH-1 downto g_INDEX_WIDTH)) = B else '0';
+        w_index       <= to_integer(w_ram_addr(g_INDEX_WIDTH-1 downto 0));
+
+        -- port A
+        process(S_AXI_ACLK)
+        begin
+            if rising_edge(S_AXI_ACLK) then
+                if w_wr_beat = '1' and w_bank_select = '1' then
+                    for byte_index in 0 to (C_S_AXI_DATA_WIDTH/8-1) loop
+                        if S_AXI_WSTRB(byte_index) = '1' then
+                            r_ram(w_index)(byte_index*8+7 downto byte_index*8) <= S_AXI_WDATA(byte_index*8+7 downto byte_index*8);
+                        end if;
+                    end loop;
+                end if;
+                r_axi_rd_data(B) <= r_ram(w_index);
+            end if;
+        end process;
+
+        -- port B
+        process(S_AXI_ACLK)
+        begin
+            if rising_edge(S_AXI_ACLK) then
+                o_rd_data((B+1)*C_S_AXI_DATA_WIDTH-1 downto B*C_S_AXI_DATA_WIDTH) <=
+                    r_ram(to_integer(unsigned(i_rd_index((B+1)*g_INDEX_WIDTH-1 downto B*g_INDEX_WIDTH))));
+            end if;
+        end process;
+    end generate;
+
+end arch;
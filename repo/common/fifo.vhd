@@ -0,0 +1,234 @@
+-- FIFO
+-- Description:
+-- Shared synchronous FIFO used by the AXI-Stream interfaces of every IP.
+-- The storage is selected with g_MEMORY_TYPE and is passed to the synthesis
+-- tool as the ram_style of the data array, the read and write logic is the
+-- same for all storage types.
+--
+-- With g_READ_LATENCY = 0 the FIFO is first word fall through, the head of the
+-- FIFO is on o_rd_data whenever o_empty is low and i_rd_en pops it. With
+-- g_READ_LATENCY = 1 the head is registered, o_rd_data is valid on the cycle
+-- after i_rd_en, qualified by o_rd_valid.
+--
+-- Occupancy, the high watermark since reset and saturating counts of writes
+-- when full (overflow) and reads when empty (underflow) are output so the
+-- FIFO sizing can be checked on hardware.
+--
+-- Inputs:
+-- i_clk: system clk
+-- i_reset: synchronous reset, also clears the watermark and error counts
+-- i_wr_en/i_wr_data: write interface, ignored when full
+-- i_rd_en: read interface, ignored when empty
+--
+-- Outputs:
+-- o_full/o_almost_full: no space/g_ALMOST_FULL_OFFSET or fewer spaces left
+-- o_empty/o_almost_empty: no data/g_ALMOST_EMPTY_OFFSET or fewer words left
+-- o_rd_data/o_rd_valid: read data
+-- o_level: number of words in the FIFO
+-- o_high_watermark: highest level since reset
+-- o_overflow_count/o_underflow_count: rejected writes/reads since reset
+
+library ieee;
+use ieee.std_logic_1164.all;
+use ieee.numeric_std.all;
+
+entity fifo is
+    generic(
+        g_WIDTH               : integer := 24;
+        g_DEPTH               : integer := 128;
+        g_MEMORY_TYPE         : string  := "registers"; -- {"registers", "distributed", "block"}
+        g_READ_LATENCY        : integer := 0;           -- {first word fall through, registered}
+        g_ALMOST_FULL_OFFSET  : integer := 1;
+        g_ALMOST_EMPTY_OFFSET : integer := 1
+    );
+    port(
+        i_clk             : in  std_logic;
+        i_reset           : in  std_logic;
+        -- FIFO write interface
+        i_wr_en           : in  std_logic;
+        i_wr_data         : in  std_logic_vector(g_WIDTH-1 downto 0);
+        o_full            : out std_logic;
+        o_almost_full     : out std_logic;
+        -- FIFO read interface
+        i_rd_en           : in  std_logic;
+        o_rd_data         : out std_logic_vector(g_WIDTH-1 downto 0);
+        o_rd_valid        : out std_logic;
+        o_empty           : out std_logic;
+        o_almost_empty    : out std_logic;
+        -- FIFO status
+        o_level           : out std_logic_vector(15 downto 0);
+        o_high_watermark  : out std_logic_vector(15 downto 0);
+        o_overflow_count  : out std_logic_vector(15 downto 0);
+        o_underflow_count : out std_logic_vector(15 downto 0)
+    );
+end fifo;
+
+architecture arch of fifo is
+
+    constant c_MAX_COUNT : integer := 2**16-1;
+
+    type t_fifo_data is array (0 to g_DEPTH-1) of std_logic_vector(g_WIDTH-1 downto 0);
+    signal r_fifo_data : t_fifo_data := (others => (others => '0'));
+
+    attribute ram_style : string;
+    attribute ram_style of r_fifo_data : signal is g_MEMORY_TYPE;
+
+    signal r_wr_index : integer range 0 to g_DEPTH-1 := 0;
+    signal r_rd_index : integer range 0 to g_DEPTH-1 := 0;
+
+    signal w_rd_en : std_logic;
+    signal w_wr_en : std_logic;
+
+    signal r_fifo_count : integer range 0 to g_DEPTH := 0;
+
+    signal w_full  : std_logic;
+    signal w_empty : std_logic;
+
+    signal r_bypass_valid : std_logic := '0';
+    signal r_bypass_data  : std_logic_vector(g_WIDTH-1 downto 0) := (others => '0');
+    signal w_rd_next_index : integer range 0 to g_DEPTH-1 := 0;
+
+    signal r_rd_data : std_logic_vector(g_WIDTH-1 downto 0) := (others => '0');
+    signal w_head    : std_logic_vector(g_WIDTH-1 downto 0);
+
+    -- status
+    signal r_high_watermark  : integer range 0 to g_DEPTH := 0;
+    signal r_overflow_count  : integer range 0 to c_MAX_COUNT := 0;
+    signal r_underflow_count : integer range 0 to c_MAX_COUNT := 0;
+
+begin
+
+    w_rd_next_index <= 0 when r_rd_index = g_DEPTH - 1 else
+                       r_rd_index + 1;
+
+    w_full  <= '1' when r_fifo_count = g_DEPTH else '0';
+    w_empty <= '1' when r_fifo_count = 0       else '0';
+
+    w_rd_en <= '1' when i_rd_en = '1' and w_empty = '0' else '0';
+    w_wr_en <= '1' when i_wr_en = '1' and w_full = '0'  else '0';
+
+    o_full  <= w_full;
+    o_empty <= w_empty;
+
+    o_almost_full  <= '1' when r_fifo_count >= g_DEPTH - g_ALMOST_FULL_OFFSET else '0';
+    o_almost_empty <= '1' when r_fifo_count <= g_ALMOST_EMPTY_OFFSET          else '0';
+
+    process (i_clk)
+    begin
+        if rising_edge(i_clk) then
+            if i_reset = '1' then
+                r_fifo_count <= 0;
+                r_wr_index   <= 0;
+                r_rd_index   <= 0;
+            else
+                -- update fifo count
+                if (w_wr_en = '1' and w_rd_en = '0') then
+                    r_fifo_count <= r_fifo_count + 1;
+                elsif (w_wr_en = '0' and w_rd_en = '1') then
+                    r_fifo_count <= r_fifo_count - 1;
+                end if;
+
+                -- update write index
+                if w_wr_en = '1' then
+                    if r_wr_index = g_DEPTH-1 then
+                        r_wr_index <= 0;
+                    else
+                        r_wr_index <= r_wr_index + 1;
+                    end if;
+                end if;
+
+                -- update read index
+                if w_rd_en = '1' then
+                    if r_rd_index = g_DEPTH-1 then
+                        r_rd_index <= 0;
+                    else
+                        r_rd_index <= r_rd_index + 1;
+                    end if;
+                end if;
+
+                r_bypass_data <= i_wr_data;
+
+                r_bypass_valid <= '0';
+                if w_wr_en = '0' then
+                    r_bypass_valid <= '0';
+                elsif (w_empty = '1' or (i_rd_en = '1' and r_fifo_count = 1)) then
+                    r_bypass_valid <= '1';
+                end if;
+
+            end if;
+        end if;
+    end process;
+
+    -- memory, kept free of the reset so it can be mapped to RAM
+    process (i_clk)
+    begin
+        if rising_edge(i_clk) then
+            -- write data to fifo
+            if w_wr_en = '1' then
+                r_fifo_data(r_wr_index) <= i_wr_data;
+            end if;
+
+            if w_rd_en = '1' then
+                r_rd_data <= r_fifo_data(w_rd_next_index);
+            else
+                r_rd_data <= r_fifo_data(r_rd_index);
+            end if;
+        end if;
+    end process;
+
+    w_head <= r_bypass_data when r_bypass_valid = '1' else r_rd_data;
+
+    -- read latency
+    read_latency_0_gen : if g_READ_LATENCY = 0 generate
+        o_rd_data  <= w_head;
+        o_rd_valid <= not w_empty;
+    end generate;
+
+    read_latency_1_gen : if g_READ_LATENCY = 1 generate
+        signal r_rd_data_out  : std_logic_vector(g_WIDTH-1 downto 0) := (others => '0');
+        signal r_rd_valid_out : std_logic := '0';
+    begin
+        process (i_clk)
+        begin
+            if rising_edge(i_clk) then
+                if w_rd_en = '1' then
+                    r_rd_data_out <= w_head;
+                end if;
+                r_rd_valid_out <= w_rd_en and not i_reset;
+            end if;
+        end process;
+
+        o_rd_data  <= r_rd_data_out;
+        o_rd_valid <= r_rd_valid_out;
+    end generate;
+
+    -- status
+    process (i_clk)
+    begin
+        if rising_edge(i_clk) then
+            if i_reset = '1' then
+                r_high_watermark  <= 0;
+                r_overflow_count  <= 0;
+                r_underflow_count <= 0;
+            else
+                if r_fifo_count > r_high_watermark then
+                    r_high_watermark <= r_fifo_count;
+                end if;
+
+                if i_wr_en = '1' and w_full = '1' and r_overflow_count /= c_MAX_COUNT then
+                    r_overflow_count <= r_overflow_count + 1;
+                end if;
+
+                if i_rd_en = '1' and w_empty = '1' and r_underflow_count /= c_MAX_COUNT then
+                    r_underflow_count <= r_underflow_count + 1;
+                end if;
+            end if;
+        end if;
+    end process;
+
+    o_level           <= std_logic_vector(to_unsigned(r_fifo_count, 16));
+    o_high_watermark  <= std_logic_vector(to_unsigned(r_high_watermark, 16));
+    o_overflow_count  <= std_logic_vector(to_unsigned(r_overflow_count, 16));
+    o_underflow_count <= std_logic_vector(to_unsigned(r_underflow_count, 16));
+
+end arch;
@@ -0,0 +1,50 @@
+-- Package: Synthesizer Configuration
+-- Description: The voice count, oscillators per voice, sample rate and DSP clock of
+-- the synthesizer and the widths and budgets derived from them. Generated by
+-- src/config/generate_config.tcl from src/config/synth_config.tcl, do not edit.
+
+library ieee;
+use ieee.std_logic_1164.all;
+use ieee.math_real.all;
+
+package synth_config_package is
+    constant c_NUM_CHANNELS    : integer := 128;
+    constant c_NUM_OSCILLATORS : integer := 3;
+    constant c_SAMPLE_RATE     : integer := 96000;
+    constant c_CLOCK_HZ        : integer := 72000000;
+
+    -- bits of a channel index, at least one for a single channel
+    constant c_CHANNEL_WIDTH : integer := integer(ceil(log2(real(c_NUM_CHANNELS + boolean'pos(c_NUM_CHANNELS = 1)))));
+    -- bits of the active channel count, 0 to c_NUM_CHANNELS
+    constant c_COUNT_WIDTH   : integer := integer(ceil(log2(real(c_NUM_CHANNELS + 1))));
+    -- 32 bit registers of a bit per channel, the note on and channel free registers
+    constant c_CHANNEL_WORDS : integer := (c_NUM_CHANNELS + 31) / 32;
+    -- clocks of a sample period, the g_CYCLES_PER_SAMPLE of the modules
+    constant c_SAMPLE_CYCLES : integer := c_CLOCK_HZ / c_SAMPLE_RATE;
+    -- clocks the oscillator takes for a sample period, the most of the modules
+    constant c_FRAME_CYCLES  : integer := c_NUM_CHANNELS * c_NUM_OSCILLATORS;
+
+    -- checked when the package is elaborated
+    constant c_CONFIG_VALID : boolean;
+end package synth_config_package;
+
+package body synth_config_package is
+
+    function f_check_config return boolean is
+    begin
+        assert c_NUM_CHANNELS >= 1 and c_NUM_CHANNELS <= 128
+            report "c_NUM_CHANNELS is " & integer'image(c_NUM_CHANNELS) &
+                   ", the channel field of the registers holds 1 to 128 channels"
+            severity failure;
+        assert c_NUM_OSCILLATORS >= 1
+            report "c_NUM_OSCILLATORS is " & integer'image(c_NUM_OSCILLATORS) severity failure;
+        assert c_FRAME_CYCLES < c_SAMPLE_CYCLES
+            report "the oscillator takes " & integer'image(c_FRAME_CYCLES) & " clocks of the " &
+                   integer'image(c_SAMPLE_CYCLES) & " clocks of a sample period"
+            severity failure;
+        return true;
+    end function;
+
+    constant c_CONFIG_VALID : boolean := f_check_config;
+
+end package body synth_config_package;
@@ -8,6 +8,8 @@
 #ifndef SRC_SYNTHESIZER_H_
 #define SRC_SYNTHESIZER_H_
 
+#include "synth_config.h"
+
 enum MESSAGES
 {
     MIDI,
@@ -49,19 +51,35 @@ enum MESSAGES
 	SEQUENCER_PLAY_PAUSE,
 	SEQUENCER_TEMPO,
 	SEQUENCER_TIME_DIV,
-	SEQUENCER_GATE
+	SEQUENCER_GATE,
+	UNISON_VOICES,
+	UNISON_DETUNE,
+	UNISON_SPREAD,
+	VOICE_STEAL
 
 };
 
-#define NUM_CHANNELS				64
+#define NUM_CHANNELS				SYNTH_NUM_CHANNELS
 
 #define OSCILLATOR_ADDR				XPAR_OSCILLATOR_0_S_AXI_CTRL_BASEADDR
 #define ADSR_ADDR 					XPAR_ADSR_0_S_AXI_CTRL_BASEADDR
 #define FILTER_ADSR_ADDR 			XPAR_ADSR_1_S_AXI_CTRL_BASEADDR
 #define FILTER_ADDR					XPAR_MOOG_LADDER_FILTER_0_S_AXI_CTRL_BASEADDR
-#define LFO_A_ADDR					XPAR_LFO_0_S_AXI_CTRL_BASEADDR
-#define LFO_B_ADDR					XPAR_LFO_1_S_AXI_CTRL_BASEADDR
-#define LFO_C_ADDR					XPAR_LFO_2_S_AXI_CTRL_BASEADDR
+#define LFO_ADDR					XPAR_LFO_0_S_AXI_CTRL_BASEADDR
+#define LFO_A_ADDR					(LFO_ADDR + 0*LFO_BANK_SIZE)
+#define LFO_B_ADDR					(LFO_ADDR + 1*LFO_BANK_SIZE)
+#define LFO_C_ADDR					(LFO_ADDR + 2*LFO_BANK_SIZE)
+#define MULTIPLIER_ADDR				XPAR_MULTIPLIER_0_S_AXI_CTRL_BASEADDR
+#define MOD_MATRIX_ADDR				XPAR_MOD_MATRIX_0_S_AXI_CTRL_BASEADDR
+#define OSCILLATOR_PARAM_ADDR		XPAR_OSCILLATOR_0_S_AXI_PARAM_BASEADDR
+#define ADSR_PARAM_ADDR				XPAR_ADSR_0_S_AXI_PARAM_BASEADDR
+#define FILTER_ADSR_PARAM_ADDR		XPAR_ADSR_1_S_AXI_PARAM_BASEADDR
+#define PARAM_STREAM_ADDR			XPAR_PARAM_STREAM_0_S_AXI_CTRL_BASEADDR
+#define PARAM_DMA_ADDR				XPAR_AXI_DMA_0_BASEADDR
+#define AUDIO_CAPTURE_ADDR			XPAR_AUDIO_CAPTURE_0_S_AXI_CTRL_BASEADDR
+#define SAMPLE_RATE_ADDR			XPAR_AXI_GPIO_2_BASEADDR
+#define MIXER_ADDR					XPAR_MIXER_0_S_AXI_CTRL_BASEADDR
+#define EFFECTS_ADDR				XPAR_EFFECTS_0_S_AXI_CTRL_BASEADDR
 
 // MIDI message types
 #define NOTE_OFF                 0x80
@@ -81,6 +99,28 @@ enum MESSAGES
 #define OSCILLATOR_MODULATION_EN_REG	16
 #define OSCILLATOR_DETUNE_REG			20
 #define OSCILLATOR_MIX_REG				24
+#define OSCILLATOR_FLOW_STATUS_REG		28
+#define OSCILLATOR_PARAM_SOURCE_REG		32
+#define OSCILLATOR_UNISON_REG			36
+#define OSCILLATOR_UNISON_DETUNE_REG	40
+#define OSCILLATOR_FIFO_SELECT_REG		52
+#define OSCILLATOR_FIFO_LEVEL_REG		56
+#define OSCILLATOR_FIFO_ERROR_REG		60
+
+#define OSCILLATOR_FREQ_MOD_FIFO		0
+#define OSCILLATOR_PWM_FIFO				1
+#define OSCILLATOR_OUTPUT_FIFO			2
+
+// A note plays on 1, 2, 4 or 8 aligned channels, each with the detune of its slot
+#define MAX_UNISON_VOICES				8
+
+// Per voice parameter RAM banks, the frequency is indexed by channel, the
+// others by oscillator*128 + channel
+#define OSCILLATOR_FREQUENCY_PARAM		0
+#define OSCILLATOR_DETUNE_PARAM			1
+#define OSCILLATOR_MIX_PARAM			2
+#define OSCILLATOR_PW_PARAM				3
+#define OSCILLATOR_PARAM_BANK_SIZE		2048
 
 // ADSR module registers
 #define ADSR_NOTE_ON_OFF_REG		0
@@ -89,10 +129,35 @@ enum MESSAGES
 #define ADSR_SUSTAIN_LEVEL_REG		6
 #define ADSR_RELEASE_CW_REG			7
 #define ADSR_CHANNEL_FREE_REG		8
+#define ADSR_PARAM_SOURCE_REG		12
+#define ADSR_STEAL_REG				13		// the quietest channel on read
+#define ADSR_FIFO_LEVEL_REG			14
+#define ADSR_FIFO_ERROR_REG			15
+#define ADSR_FREED_REG				16		// 16 to 19, cleared by the read
+#define ADSR_FREED_IRQ_EN_REG		20
+
+// Per voice parameter RAM banks, indexed by channel
+#define ADSR_ATTACK_PARAM			0
+#define ADSR_DECAY_PARAM			1
+#define ADSR_SUSTAIN_PARAM			2
+#define ADSR_RELEASE_PARAM			3
+#define ADSR_PARAM_BANK_SIZE		512
+
+// Voice stealing, the channel group a note on takes when no group is free
+#define STEAL_NONE					0		// the note is dropped
+#define STEAL_OLDEST				1		// the group of the oldest note on
+#define STEAL_QUIETEST				2		// the group of the quietest channel, released notes first
+#define STEAL_SAME_NOTE				3		// the group playing the note, else the oldest
 
 #define ADSR_MAX_VALUE				8388607		// Max 23 bit unsigned value
 #define ADSR_MAX_TIME				10.0 		// Max time of 10 seconds
-#define AUDIO_FREQ					96000.0		// Audio frequency of 96kHz
+#define AUDIO_FREQ					((float)SYNTH_SAMPLE_RATE)	// Audio frequency at reset
+
+// Sample rate select of the I2S transceiver relative to SYNTH_SAMPLE_RATE, applied
+// at the next frame
+#define SAMPLE_RATE_HALF			0
+#define SAMPLE_RATE_NOMINAL			1
+#define SAMPLE_RATE_DOUBLE			2
 
 // Filter module registers
 #define FILTER_CUTOFF_FREQUENCY_REG  0
@@ -102,12 +167,149 @@ enum MESSAGES
 #define FILTER_MODULATION_AMOUNT_REG 16
 #define FILTER_TYPE_REG				 20
 #define FILTER_ATTENUATION_REG		 24
+#define FILTER_CUTOFF_OFFSET_REG	 28
+#define FILTER_KEY_NOTE_REG			 32
+#define FILTER_KEY_TRACKING_REG		 36
+#define FILTER_OVERSAMPLE_REG		 40
+#define FILTER_FRAME_CYCLES_REG		 48
+#define FILTER_FIFO_SELECT_REG		 52		// cycles per sample in the upper half on read
+#define FILTER_FIFO_LEVEL_REG		 56
+#define FILTER_FIFO_ERROR_REG		 60
+
+#define FILTER_INPUT_FIFO			 0
+#define FILTER_ADSR_FIFO			 1
+#define FILTER_MODULATION_FIFO		 2
+#define FILTER_OUTPUT_FIFO			 3
 
-// LFO module registers
+// LFO module registers, each LFO has its own bank, the status registers are shared
+#define LFO_BANK_SIZE				0x20
 #define LFO_CHANNEL_ON_OFF_REG		0
 #define LFO_RATE_REG				4
 #define LFO_AMOUNT_REG				8
 #define LFO_WAVEFORM_REG			12
+#define LFO_FLOW_STATUS_REG			20
+#define LFO_FIFO_LEVEL_REG			24
+#define LFO_FIFO_ERROR_REG			28
+
+// Multiplier (NCA) module registers
+#define MULTIPLIER_FLOW_STATUS_REG	0
+#define MULTIPLIER_FIFO_SELECT_REG	4
+#define MULTIPLIER_FIFO_LEVEL_REG	8
+#define MULTIPLIER_FIFO_ERROR_REG	12
+
+#define MULTIPLIER_INPUT_FIFO		0
+#define MULTIPLIER_ENVELOPE_FIFO	1
+#define MULTIPLIER_OUTPUT_FIFO		2
+
+// Modulation matrix registers, one bank of source amounts per destination, the
+// status registers follow the last bank
+#define MOD_MATRIX_BANK_SIZE			0x20
+#define MOD_MATRIX_FLOW_STATUS_REG		0x80
+#define MOD_MATRIX_FIFO_SELECT_REG		0x84
+#define MOD_MATRIX_FIFO_LEVEL_REG		0x88
+#define MOD_MATRIX_FIFO_ERROR_REG		0x8C
+
+#define MOD_MATRIX_LFO_FIFO				0
+#define MOD_MATRIX_ENVELOPE_FIFO		1
+#define MOD_MATRIX_OUTPUT_FIFO			2
+
+// Modulation sources, LFO n is slot n and envelope n is slot 4+n
+#define MOD_SOURCE_LFO_A				0
+#define MOD_SOURCE_LFO_B				1
+#define MOD_SOURCE_LFO_C				2
+#define MOD_SOURCE_AMP_ENVELOPE			4
+#define MOD_SOURCE_FILTER_ENVELOPE		5
+
+// Modulation destinations
+#define MOD_DEST_PITCH					0
+#define MOD_DEST_PULSE_WIDTH			1
+#define MOD_DEST_CUTOFF					2
+#define MOD_DEST_AMPLITUDE				3
+
+// Parameter stream module registers
+#define PARAM_STREAM_TARGET_BASE_REG	0
+#define PARAM_STREAM_STATUS_REG			32
+#define PARAM_STREAM_BUSY_REG			36
+#define PARAM_STREAM_FIFO_LEVEL_REG		40
+#define PARAM_STREAM_FIFO_ERROR_REG		44
+
+// Parameter stream targets, index of the base address table
+#define PARAM_TARGET_OSCILLATOR		0
+#define PARAM_TARGET_ADSR			1
+#define PARAM_TARGET_FILTER			2
+#define PARAM_TARGET_FILTER_ADSR	3
+#define PARAM_TARGET_LFO_A			4
+#define PARAM_TARGET_LFO_B			5
+#define PARAM_TARGET_LFO_C			6
+#define PARAM_TARGET_MOD_MATRIX		7
+
+// AXI DMA (simple mode) MM2S registers
+#define DMA_MM2S_CONTROL_REG		0x00
+#define DMA_MM2S_STATUS_REG			0x04
+#define DMA_MM2S_SOURCE_REG			0x18
+#define DMA_MM2S_LENGTH_REG			0x28
+
+#define DMA_CONTROL_RUN				0x1
+#define DMA_STATUS_IDLE				0x2
+
+// Audio capture module registers
+#define AUDIO_CAPTURE_CONTROL_REG		0
+#define AUDIO_CAPTURE_VOICE_REG			4
+#define AUDIO_CAPTURE_BASE_REG			8
+#define AUDIO_CAPTURE_SIZE_REG			12
+#define AUDIO_CAPTURE_HEAD_REG			16
+#define AUDIO_CAPTURE_TAIL_REG			20
+#define AUDIO_CAPTURE_SAMPLE_COUNT_REG	24
+#define AUDIO_CAPTURE_ERROR_REG			28
+#define AUDIO_CAPTURE_FIFO_LEVEL_REG	32
+#define AUDIO_CAPTURE_FIFO_ERROR_REG	36
+
+#define AUDIO_CAPTURE_CONTROL_ENABLE	0x1
+#define AUDIO_CAPTURE_CONTROL_VOICE		0x2
+
+#define AUDIO_CAPTURE_SOURCE_MIX		0
+#define AUDIO_CAPTURE_SOURCE_VOICE		1
+
+// The buffer is written in bursts of 16 samples
+#define AUDIO_CAPTURE_BURST_BYTES	64
+
+// Mixer module registers
+#define MIXER_STEREO_REG			0
+#define MIXER_PAN_REG				4
+#define MIXER_FIFO_LEVEL_REG		8
+#define MIXER_FIFO_ERROR_REG		12
+
+// Pan coefficient, 0 is hard left and 256 hard right
+#define MIXER_PAN_CENTER			128
+
+// Effects module registers, a control bank, a status bank and one bank per tap
+#define EFFECTS_CONTROL_REG			0x00
+#define EFFECTS_BASE_REG			0x04
+#define EFFECTS_SIZE_REG			0x08
+#define EFFECTS_DRY_LEVEL_REG		0x0C
+#define EFFECTS_FLOW_STATUS_REG		0x20
+#define EFFECTS_FIFO_SELECT_REG		0x24
+#define EFFECTS_FIFO_LEVEL_REG		0x28
+#define EFFECTS_FIFO_ERROR_REG		0x2C
+#define EFFECTS_WRITE_BURST_REG		0x30
+#define EFFECTS_READ_BURST_REG		0x34
+#define EFFECTS_ERROR_REG			0x38
+#define EFFECTS_TAP_BANK			0x40
+#define EFFECTS_TAP_BANK_SIZE		0x20
+#define EFFECTS_TAP_DELAY_REG		0x00
+#define EFFECTS_TAP_LEVEL_REG		0x04
+#define EFFECTS_TAP_FEEDBACK_REG	0x08
+
+#define EFFECTS_CONTROL_ENABLE		0x1
+#define EFFECTS_NUM_TAPS			4
+
+// The write FIFO is FIFO 0, the prefetch FIFO of tap n is FIFO n+1
+#define EFFECTS_WRITE_FIFO			0
+#define EFFECTS_TAP_FIFO(tap)		((tap)+1)
+
+// A frame is the left and the right sample, the delay line is accessed in bursts of 8 frames
+#define EFFECTS_FRAME_BYTES			8
+#define EFFECTS_BURST_BYTES			64
 
 
 /* Standard message*/
@@ -124,6 +326,36 @@ typedef struct
     uint8_t velocity;
 } MESSAGE_MIDI;
 
+/* FIFO status*/
+typedef struct
+{
+    uint16_t level;
+    uint16_t highWatermark;
+    uint16_t overflowCount;
+    uint16_t underflowCount;
+} FIFO_STATUS;
+
+/* Flow status*/
+typedef struct
+{
+    uint16_t overflowCount;
+    uint16_t underrunCount;
+} FLOW_STATUS;
+
+/* Parameter stream command, one 64 bit stream beat*/
+typedef struct
+{
+    u32 value;
+    u32 header;		// module in bits 18..16, register byte offset in bits 15..0
+} PARAM_COMMAND;
+
+/* Parameter stream status*/
+typedef struct
+{
+    uint16_t commandCount;
+    uint16_t errorCount;
+} PARAM_STREAM_STATUS;
+
 
 static int8_t assignedChannels[NUM_CHANNELS];
 
@@ -135,6 +367,12 @@ void OscillatorSetFrequency(uint32_t channel, float freq);
 
 void SynthNoteOn(uint32_t note);
 void SynthNoteOff(uint32_t note);
+int SynthMidiDataLength(uint8_t status);
+void SynthMidiMessage(uint8_t status, const u8 *data);
+void SynthSetUnison(unsigned voices);
+void SynthSetUnisonSpread(float detune, float spread);
+void SynthSetStealPolicy(unsigned policy);
+void SynthVoiceFreed(void);
 
 void SequencerRecord();
 void SequencerStop();
@@ -142,13 +380,84 @@ void SequencerPlay();
 void SequencerPause();
 void SequencerStep(int8_t note);
 
-static uint32_t freeChannels[4];
+// Free voice pool, the channels that are off and unassigned. SynthSetUnison
+// fills it from the channel free registers, SynthNoteOn takes groups from it
+// and SynthVoiceFreed returns the channels the ADSR interrupt reports
+static uint32_t freeChannels[SYNTH_CHANNEL_WORDS];
+
+// Voices per note, the polyphony is NUM_CHANNELS/unisonVoices, and the
+// detune (cents) and pan spread of the outer unison slots
+static unsigned unisonVoices = 1;
+static float unisonDetune = 0.0;
+static float unisonSpread = 0.0;
+
+// Note on order of the channel groups by their first channel, the oldest group
+// is stolen first, and the notes played on a stolen group
+static unsigned stealPolicy = STEAL_QUIETEST;
+static u32 noteOnCount = 0;
+static u32 groupNoteOn[NUM_CHANNELS];
+static u32 voiceSteals = 0;
+
+static float audioFreq = AUDIO_FREQ;
+
+// FIFO status functions
+
+void getFifoStatus(u32 levelAddress, u32 errorAddress, FIFO_STATUS *status)
+{
+	u32 level = Xil_In32(levelAddress);
+	u32 error = Xil_In32(errorAddress);
+	status->level          = level & 0xFFFF;
+	status->highWatermark  = level >> 16;
+	status->overflowCount  = error & 0xFFFF;
+	status->underflowCount = error >> 16;
+}
+
+// Flow status functions, the counters are sticky until the register is written
+
+void getFlowStatus(u32 flowAddress, FLOW_STATUS *status)
+{
+	u32 flow = Xil_In32(flowAddress);
+	status->overflowCount = flow & 0xFFFF;
+	status->underrunCount = flow >> 16;
+}
+
+void clearFlowStatus(u32 flowAddress)
+{
+	Xil_Out32(flowAddress, 0);
+}
+
+// Sample rate functions, every frequency and time conversion follows the active
+// rate so the oscillator, ADSR, filter and LFO parameters have to be set again
+// after a change
+
+// The modules process every channel in each sample period and take
+// SYNTH_FRAME_CYCLES clocks at any rate, so a rate whose period is shorter than
+// that is refused, as is a select the transceiver ignores. Returns -1 when the
+// rate is refused
+int setSampleRate(unsigned rate)
+{
+	if (rate > SAMPLE_RATE_DOUBLE)
+		return -1;
+
+	u32 rateHz = ((u32)SYNTH_SAMPLE_RATE << rate) / 2;
+	if (SYNTH_FRAME_CYCLES >= SYNTH_CLOCK_HZ / rateHz)
+		return -1;
+
+	Xil_Out32(SAMPLE_RATE_ADDR, (u32)rate);
+	audioFreq = (float)rateHz;
+	return 0;
+}
+
+float getSampleRate()
+{
+	return audioFreq;
+}
 
 // Oscillator module functions
 
 void setOscillatorFrequency(u32 address, uint32_t channel, float freq)
 {
-	float fcw = freq*1048576.0/96000.0;
+	float fcw = freq*1048576.0/audioFreq;
 	u32 config = (channel << 25) + (u32)fcw;
 	Xil_Out32(address+OSCILLATOR_FREQUENCY_REG, config);
 }
@@ -191,11 +500,55 @@ void enableOscillatorModulation(u32 address, unsigned channel, unsigned enable)
 	Xil_Out32(address+OSCILLATOR_MODULATION_EN_REG, value);
 }
 
+void getOscillatorFifoStatus(u32 address, unsigned fifo, FIFO_STATUS *status)
+{
+	Xil_Out32(address+OSCILLATOR_FIFO_SELECT_REG, (u32)fifo);
+	getFifoStatus(address+OSCILLATOR_FIFO_LEVEL_REG, address+OSCILLATOR_FIFO_ERROR_REG, status);
+}
+
+void getOscillatorFlowStatus(u32 address, FLOW_STATUS *status)
+{
+	getFlowStatus(address+OSCILLATOR_FLOW_STATUS_REG, status);
+}
+
+// voices is 1, 2, 4 or 8, the slot of a channel is channel % voices
+void setOscillatorUnison(u32 address, unsigned voices)
+{
+	u32 size = 0;
+	while ((1u << size) < voices && (1u << size) < MAX_UNISON_VOICES)
+		size++;
+	Xil_Out32(address+OSCILLATOR_UNISON_REG, size);
+}
+
+// The slot detune in cents is applied on top of the oscillator detune
+void setOscillatorUnisonDetune(u32 address, unsigned slot, float cents)
+{
+	u32 msg = (u32)(powf(2.0, cents/1200.0) * 16384.0 + 0.5);
+	msg = msg + (slot << 25);
+	Xil_Out32(address+OSCILLATOR_UNISON_DETUNE_REG, msg);
+}
+
+// Selects the per voice parameter RAM (bit set) or the registers (bit clear) for each
+// parameter, bit n is the bank n parameter
+void setOscillatorParamSource(u32 address, unsigned source)
+{
+	Xil_Out32(address+OSCILLATOR_PARAM_SOURCE_REG, (u32)source);
+}
+
+// Loads count consecutive entries of a parameter bank in register format without the
+// channel/oscillator field, the entries are contiguous so a DMA transfer can replace this loop
+void loadOscillatorParams(u32 paramAddress, unsigned bank, unsigned first, const u32 *values, unsigned count)
+{
+	u32 address = paramAddress + bank*OSCILLATOR_PARAM_BANK_SIZE + first*4;
+	for (unsigned i = 0; i < count; i++)
+		Xil_Out32(address + i*4, values[i]);
+}
+
 // ADSR envelope generator module functions
 
 void setAdsrAttack(u32 adsrAddress, float time)
 {
-	u32 attackCW = time == 0 ? ADSR_MAX_VALUE : ADSR_MAX_VALUE / (time * AUDIO_FREQ);
+	u32 attackCW = time == 0 ? ADSR_MAX_VALUE : ADSR_MAX_VALUE / (time * audioFreq);
 	Xil_Out32(adsrAddress+ADSR_ATTACK_CW_REG*4, (u32)attackCW);
 }
 
@@ -208,44 +561,101 @@ void setAdsrSustain(u32 adsrAddress, float level)
 void setAdsrDecay(u32 adsrAddress, float time)
 {
 	u32 sustainLevel = Xil_In32(adsrAddress+ADSR_SUSTAIN_LEVEL_REG*4);
-	u32 decayCW = (time == 0) ? (ADSR_MAX_VALUE - sustainLevel) : (ADSR_MAX_VALUE - sustainLevel) / (time * AUDIO_FREQ);
+	u32 decayCW = (time == 0) ? (ADSR_MAX_VALUE - sustainLevel) : (ADSR_MAX_VALUE - sustainLevel) / (time * audioFreq);
 	Xil_Out32(adsrAddress+ADSR_DECAY_CW_REG*4, (u32)decayCW);
 }
 
 void setAdsrRelease(u32 adsrAddress, float time)
 {
 	u32 sustainLevel = Xil_In32(adsrAddress+ADSR_SUSTAIN_LEVEL_REG*4);
-	u32 releaseCW = (time == 0) ? sustainLevel : sustainLevel / (time * AUDIO_FREQ);
+	u32 releaseCW = (time == 0) ? sustainLevel : sustainLevel / (time * audioFreq);
 	Xil_Out32(adsrAddress+ADSR_RELEASE_CW_REG*4, (u32)releaseCW);
 }
 
+// Gates count channels from firstChannel with a single register write, so the
+// envelopes of a unison group start and stop on the same sample. The channels
+// must not cross a 32 channel register
+void setAdsrGroupNoteOn(u32 BaseAddress, u32 firstChannel, u32 count)
+{
+	u32 address = BaseAddress+ADSR_NOTE_ON_OFF_REG*4+(firstChannel/32)*4;
+	u32 mask = (count >= 32) ? 0xFFFFFFFF : ((0x1u << count) - 1) << (firstChannel % 32);
+	Xil_Out32(address, Xil_In32(address) | mask);
+}
+
+void setAdsrGroupNoteOff(u32 BaseAddress, u32 firstChannel, u32 count)
+{
+	u32 address = BaseAddress+ADSR_NOTE_ON_OFF_REG*4+(firstChannel/32)*4;
+	u32 mask = (count >= 32) ? 0xFFFFFFFF : ((0x1u << count) - 1) << (firstChannel % 32);
+	Xil_Out32(address, Xil_In32(address) & ~mask);
+}
+
 void setAdsrNoteOn(u32 BaseAddress, u32 channel)
 {
-	u32 on_off_notes = Xil_In32(BaseAddress+ADSR_NOTE_ON_OFF_REG*4);
-	on_off_notes |= (0x1 << channel);
-	Xil_Out32(BaseAddress+ADSR_NOTE_ON_OFF_REG*4, on_off_notes);
+	setAdsrGroupNoteOn(BaseAddress, channel, 1);
 }
 
 void setAdsrNoteOff(u32 BaseAddress, u32 channel)
 {
-	u32 on_off_notes = Xil_In32(BaseAddress+ADSR_NOTE_ON_OFF_REG*4);
-	on_off_notes &= ~(0x1 << channel);
-	Xil_Out32(BaseAddress+ADSR_NOTE_ON_OFF_REG*4, on_off_notes);
+	setAdsrGroupNoteOff(BaseAddress, channel, 1);
 }
 
 void getAdsrFreeChannels(u32 adsrAddress)
 {
-	freeChannels[0] = Xil_In32(adsrAddress+ADSR_CHANNEL_FREE_REG*4);
-	freeChannels[1] = Xil_In32(adsrAddress+ADSR_CHANNEL_FREE_REG*4+4);
-	freeChannels[2] = Xil_In32(adsrAddress+ADSR_CHANNEL_FREE_REG*4+8);
-	freeChannels[3] = Xil_In32(adsrAddress+ADSR_CHANNEL_FREE_REG*4+16);
+	for (u32 reg = 0; reg < SYNTH_CHANNEL_WORDS; reg++)
+		freeChannels[reg] = Xil_In32(adsrAddress+ADSR_CHANNEL_FREE_REG*4+reg*4);
+}
+
+// The channels 32*reg to 32*reg+31 that reached off since the register was
+// last read, the read clears them and the interrupt is high while any is set
+u32 getAdsrFreedChannels(u32 adsrAddress, u32 reg)
+{
+	return Xil_In32(adsrAddress+ADSR_FREED_REG*4+reg*4);
+}
+
+void setAdsrVoiceFreedIrq(u32 adsrAddress, unsigned enable)
+{
+	Xil_Out32(adsrAddress+ADSR_FREED_IRQ_EN_REG*4, (u32)enable);
+}
+
+// Fades count channels from firstChannel out with the fast release of the ADSR,
+// 1 ms from full scale. The channels restart their attack when they reach zero
+// if their note on bit is set, the count is at most 8
+void setAdsrGroupSteal(u32 adsrAddress, u32 firstChannel, u32 count)
+{
+	Xil_Out32(adsrAddress+ADSR_STEAL_REG*4, (firstChannel << 25) + count);
+}
+
+// The quietest sounding channel of the last sample period that is not being
+// stolen, released channels before held ones and held ones before those in
+// their attack, -1 when there is none
+int getAdsrQuietestChannel(u32 adsrAddress)
+{
+	u32 quietest = Xil_In32(adsrAddress+ADSR_STEAL_REG*4);
+	return (quietest & (0x1 << 24)) ? (int)(quietest >> 25) : -1;
+}
+
+void getAdsrFifoStatus(u32 adsrAddress, FIFO_STATUS *status)
+{
+	getFifoStatus(adsrAddress+ADSR_FIFO_LEVEL_REG*4, adsrAddress+ADSR_FIFO_ERROR_REG*4, status);
+}
+
+void setAdsrParamSource(u32 adsrAddress, unsigned source)
+{
+	Xil_Out32(adsrAddress+ADSR_PARAM_SOURCE_REG*4, (u32)source);
+}
+
+void loadAdsrParams(u32 paramAddress, unsigned bank, unsigned first, const u32 *values, unsigned count)
+{
+	u32 address = paramAddress + bank*ADSR_PARAM_BANK_SIZE + first*4;
+	for (unsigned i = 0; i < count; i++)
+		Xil_Out32(address + i*4, values[i]);
 }
 
 // Filter module functions
 
 void setFilterCutoffFrequency(u32 address, float frequency)
 {
-	u32 freq = frequency*32768/96000.0*2*3.14159;
+	u32 freq = frequency*32768/audioFreq*2*3.14159;
 	Xil_Out32(address+FILTER_CUTOFF_FREQUENCY_REG, (u32)freq);
 }
 
@@ -263,7 +673,7 @@ void setFilterResonance(u32 address, float resonance)
 
 void setFilterEnvelopeAmount(u32 address, float amount)
 {
-	u32 am = amount*20000.0/96000.0*2*3.14159*32767;
+	u32 am = amount*20000.0/audioFreq*2*3.14159*32767;
 	Xil_Out32(address+FILTER_ENVELOPE_AMOUNT_REG, (u32)am);
 }
 
@@ -278,6 +688,48 @@ void setFilterModulationAmount(u32 address, float amount)
 	Xil_Out32(address+FILTER_MODULATION_AMOUNT_REG, (u32)value);
 }
 
+void setFilterCutoffOffset(u32 address, uint32_t channel, float frequency)
+{
+	int32_t offset = frequency*32768/audioFreq*2*3.14159;
+	u32 msg = (channel << 25) + ((u32)offset & 0x3FFFF);
+	Xil_Out32(address+FILTER_CUTOFF_OFFSET_REG, msg);
+}
+
+void setFilterKeyNote(u32 address, uint32_t channel, uint32_t note)
+{
+	u32 msg = (channel << 25) + (note & 0x7F);
+	Xil_Out32(address+FILTER_KEY_NOTE_REG, msg);
+}
+
+void setFilterKeyTracking(u32 address, float amount)
+{
+	u32 value = amount * 32768;
+	Xil_Out32(address+FILTER_KEY_TRACKING_REG, value);
+}
+
+void setFilterOversampling(u32 address, unsigned value)
+{
+	Xil_Out32(address+FILTER_OVERSAMPLE_REG, (u32)value);
+}
+
+u32 getFilterFrameCycles(u32 address, unsigned oversampling)
+{
+	u32 cycles = Xil_In32(address+FILTER_FRAME_CYCLES_REG);
+	return oversampling ? (cycles >> 16) : (cycles & 0xFFFF);
+}
+
+// Clock cycles of the last sample period, a filter frame has to fit in it
+u32 getFilterSampleCycles(u32 address)
+{
+	return Xil_In32(address+FILTER_FIFO_SELECT_REG) >> 16;
+}
+
+void getFilterFifoStatus(u32 address, unsigned fifo, FIFO_STATUS *status)
+{
+	Xil_Out32(address+FILTER_FIFO_SELECT_REG, (u32)fifo);
+	getFifoStatus(address+FILTER_FIFO_LEVEL_REG, address+FILTER_FIFO_ERROR_REG, status);
+}
+
 // LFO module functions
 
 void setLfoChannelOn(u32 BaseAddress, u32 channel)
@@ -300,7 +752,7 @@ void setLfoWaveform(u32 BaseAddress, u32 waveform)
 
 void setLfoRate(u32 BaseAddress, float period)
 {
-	u32 fcw = 16777216.0/96000.0/period;
+	u32 fcw = 16777216.0/audioFreq/period;
 	Xil_Out32(BaseAddress+LFO_RATE_REG, fcw);
 }
 
@@ -310,59 +762,528 @@ void setLfoAmount(u32 BaseAddress, float amount)
 	Xil_Out32(BaseAddress+LFO_AMOUNT_REG, value);
 }
 
+void getLfoFifoStatus(u32 BaseAddress, FIFO_STATUS *status)
+{
+	getFifoStatus(BaseAddress+LFO_FIFO_LEVEL_REG, BaseAddress+LFO_FIFO_ERROR_REG, status);
+}
+
+void getLfoFlowStatus(u32 BaseAddress, FLOW_STATUS *status)
+{
+	getFlowStatus(BaseAddress+LFO_FLOW_STATUS_REG, status);
+}
+
+// Multiplier (NCA) module functions
+
+void getMultiplierFifoStatus(u32 address, unsigned fifo, FIFO_STATUS *status)
+{
+	Xil_Out32(address+MULTIPLIER_FIFO_SELECT_REG, (u32)fifo);
+	getFifoStatus(address+MULTIPLIER_FIFO_LEVEL_REG, address+MULTIPLIER_FIFO_ERROR_REG, status);
+}
+
+void getMultiplierFlowStatus(u32 address, FLOW_STATUS *status)
+{
+	getFlowStatus(address+MULTIPLIER_FLOW_STATUS_REG, status);
+}
+
+
+// Modulation matrix functions, every destination is the sum of all sources scaled by
+// their amount, any source can drive any destination
+
+// amount in [-4.0, 4.0), a destination is saturated and the amplitude is never negative
+void setModMatrixAmount(u32 address, unsigned destination, unsigned source, float amount)
+{
+	int32_t value = amount * 32768;
+	Xil_Out32(address+destination*MOD_MATRIX_BANK_SIZE+source*4, (u32)value & 0x3FFFF);
+}
+
+void getModMatrixFifoStatus(u32 address, unsigned fifo, FIFO_STATUS *status)
+{
+	Xil_Out32(address+MOD_MATRIX_FIFO_SELECT_REG, (u32)fifo);
+	getFifoStatus(address+MOD_MATRIX_FIFO_LEVEL_REG, address+MOD_MATRIX_FIFO_ERROR_REG, status);
+}
+
+void getModMatrixFlowStatus(u32 address, FLOW_STATUS *status)
+{
+	getFlowStatus(address+MOD_MATRIX_FLOW_STATUS_REG, status);
+}
+
+
+// Parameter stream functions, a command list in DDR is sent to the module registers
+// with a single DMA transfer instead of one register write per parameter
+
+void initParamStream(u32 address)
+{
+	const u32 targets[] = {OSCILLATOR_ADDR, ADSR_ADDR, FILTER_ADDR, FILTER_ADSR_ADDR,
+						   LFO_A_ADDR, LFO_B_ADDR, LFO_C_ADDR, MOD_MATRIX_ADDR};
+	for (unsigned i = 0; i < sizeof(targets)/sizeof(targets[0]); i++)
+		Xil_Out32(address+PARAM_STREAM_TARGET_BASE_REG+i*4, targets[i]);
+	Xil_Out32(address+PARAM_STREAM_STATUS_REG, 0);
+	Xil_Out32(PARAM_DMA_ADDR+DMA_MM2S_CONTROL_REG, DMA_CONTROL_RUN);
+}
+
+// reg is the register byte offset within the module
+void setParamCommand(PARAM_COMMAND *command, unsigned target, unsigned reg, u32 value)
+{
+	command->value  = value;
+	command->header = ((target & 0x7) << 16) | (reg & 0xFFFF);
+}
+
+// The DMA idle bit is only set once a transfer has completed
+static int paramDmaStarted = 0;
+
+int isParamDmaBusy()
+{
+	return paramDmaStarted && !(Xil_In32(PARAM_DMA_ADDR+DMA_MM2S_STATUS_REG) & DMA_STATUS_IDLE);
+}
+
+// The commands are executed in order, the list must stay unchanged until the stream is idle
+int sendParamCommands(const PARAM_COMMAND *commands, unsigned count)
+{
+	if (count == 0)
+		return 0;
+	if (isParamDmaBusy())
+		return -1;
+	Xil_DCacheFlushRange((UINTPTR)commands, count*sizeof(PARAM_COMMAND));
+	Xil_Out32(PARAM_DMA_ADDR+DMA_MM2S_SOURCE_REG, (u32)(UINTPTR)commands);
+	Xil_Out32(PARAM_DMA_ADDR+DMA_MM2S_LENGTH_REG, count*sizeof(PARAM_COMMAND));
+	paramDmaStarted = 1;
+	return 0;
+}
+
+int isParamStreamBusy(u32 address)
+{
+	return isParamDmaBusy() || (Xil_In32(address+PARAM_STREAM_BUSY_REG) & 0x1);
+}
+
+// The counters saturate until the status register is written
+void getParamStreamStatus(u32 address, PARAM_STREAM_STATUS *status)
+{
+	u32 commandStatus = Xil_In32(address+PARAM_STREAM_STATUS_REG);
+	status->commandCount = commandStatus & 0xFFFF;
+	status->errorCount   = commandStatus >> 16;
+}
+
+void getParamStreamFifoStatus(u32 address, FIFO_STATUS *status)
+{
+	getFifoStatus(address+PARAM_STREAM_FIFO_LEVEL_REG, address+PARAM_STREAM_FIFO_ERROR_REG, status);
+}
+
+
+// Audio capture functions, the mixer or voice output is written to a circular buffer in DDR
+// and read in place between the tail and the head
+
+// buffer and size must be multiples of AUDIO_CAPTURE_BURST_BYTES, the capture restarts
+// at the beginning of the buffer
+void startAudioCapture(u32 address, int32_t *buffer, u32 size, unsigned source, unsigned voice)
+{
+	Xil_Out32(address+AUDIO_CAPTURE_CONTROL_REG, 0);
+	Xil_DCacheInvalidateRange((UINTPTR)buffer, size);
+	Xil_Out32(address+AUDIO_CAPTURE_VOICE_REG, voice);
+	Xil_Out32(address+AUDIO_CAPTURE_BASE_REG, (u32)(UINTPTR)buffer);
+	Xil_Out32(address+AUDIO_CAPTURE_SIZE_REG, size);
+	Xil_Out32(address+AUDIO_CAPTURE_TAIL_REG, 0);
+	Xil_Out32(address+AUDIO_CAPTURE_ERROR_REG, 0);
+	Xil_Out32(address+AUDIO_CAPTURE_CONTROL_REG, AUDIO_CAPTURE_CONTROL_ENABLE |
+			  (source == AUDIO_CAPTURE_SOURCE_VOICE ? AUDIO_CAPTURE_CONTROL_VOICE : 0));
+}
+
+void stopAudioCapture(u32 address)
+{
+	Xil_Out32(address+AUDIO_CAPTURE_CONTROL_REG, 0);
+}
+
+// Returns the number of captured samples that can be read from *samples, up to the end
+// of the buffer. The samples are not overwritten until they are released
+u32 getAudioCaptureSamples(u32 address, const int32_t **samples)
+{
+	u32 base = Xil_In32(address+AUDIO_CAPTURE_BASE_REG);
+	u32 size = Xil_In32(address+AUDIO_CAPTURE_SIZE_REG);
+	u32 head = Xil_In32(address+AUDIO_CAPTURE_HEAD_REG);
+	u32 tail = Xil_In32(address+AUDIO_CAPTURE_TAIL_REG);
+	u32 bytes = (head >= tail) ? head - tail : size - tail;
+
+	*samples = (const int32_t *)(UINTPTR)(base + tail);
+	if (bytes)
+		Xil_DCacheInvalidateRange((UINTPTR)(base + tail), bytes);
+	return bytes / 4;
+}
+
+void releaseAudioCaptureSamples(u32 address, u32 count)
+{
+	u32 size = Xil_In32(address+AUDIO_CAPTURE_SIZE_REG);
+	u32 tail = Xil_In32(address+AUDIO_CAPTURE_TAIL_REG) + count*4;
+
+	if (tail >= size)
+		tail -= size;
+	Xil_Out32(address+AUDIO_CAPTURE_TAIL_REG, tail);
+}
+
+u32 getAudioCaptureSampleCount(u32 address)
+{
+	return Xil_In32(address+AUDIO_CAPTURE_SAMPLE_COUNT_REG);
+}
+
+// Bursts with an error response, saturates until the register is written
+u32 getAudioCaptureErrorCount(u32 address)
+{
+	return Xil_In32(address+AUDIO_CAPTURE_ERROR_REG);
+}
+
+// The FIFO overflow count is the number of samples dropped while the buffer was full
+void getAudioCaptureFifoStatus(u32 address, FIFO_STATUS *status)
+{
+	getFifoStatus(address+AUDIO_CAPTURE_FIFO_LEVEL_REG, address+AUDIO_CAPTURE_FIFO_ERROR_REG, status);
+}
+
+
+// Mixer functions, in mono mode both outputs carry the same mix
+
+void setMixerStereo(u32 address, u32 enable)
+{
+	Xil_Out32(address+MIXER_STEREO_REG, enable);
+}
+
+// pan from -1.0 (left) to 1.0 (right), constant power
+void setMixerVoicePan(u32 address, u32 channel, float pan)
+{
+	if (pan < -1.0)
+		pan = -1.0;
+	else if (pan > 1.0)
+		pan = 1.0;
+	u32 msg = (channel << 25) + (u32)((pan + 1.0) * MIXER_PAN_CENTER + 0.5);
+	Xil_Out32(address+MIXER_PAN_REG, msg);
+}
+
+// Spreads count voices starting at firstChannel evenly from -spread to spread,
+// used to place the voices of a unison group across the stereo field
+void setMixerPanSpread(u32 address, u32 firstChannel, u32 count, float spread)
+{
+	for (u32 i = 0; i < count; i++)
+	{
+		float pan = (count > 1) ? spread * (2.0 * i / (count - 1) - 1.0) : 0.0;
+		setMixerVoicePan(address, (firstChannel + i) % NUM_CHANNELS, pan);
+	}
+}
+
+void getMixerFifoStatus(u32 address, FIFO_STATUS *status)
+{
+	getFifoStatus(address+MIXER_FIFO_LEVEL_REG, address+MIXER_FIFO_ERROR_REG, status);
+}
+
+
+// Effects functions, the mix is written to a delay line in DDR and read back by up to
+// four taps, each tap has an output level and a feedback level into the line
+
+// buffer and size must be multiples of EFFECTS_BURST_BYTES, the line restarts empty and
+// the taps stay silent until the line holds their delay
+void startEffects(u32 address, int32_t *buffer, u32 size)
+{
+	Xil_Out32(address+EFFECTS_CONTROL_REG, 0);
+	// the line was cleared through the cache, write it out and drop the lines so
+	// neither an eviction nor a stale read gets between the core and the line
+	Xil_DCacheFlushRange((UINTPTR)buffer, size);
+	Xil_DCacheInvalidateRange((UINTPTR)buffer, size);
+	Xil_Out32(address+EFFECTS_BASE_REG,(u32)(UINTPTR)buffer);
+	Xil_Out32(address+EFFECTS_SIZE_REG, size);
+	Xil_Out32(address+EFFECTS_FLOW_STATUS_REG, 0);
+	Xil_Out32(address+EFFECTS_ERROR_REG, 0);
+	Xil_Out32(address+EFFECTS_CONTROL_REG, EFFECTS_CONTROL_ENABLE);
+}
+
+// The mix is passed through unchanged while the effects are stopped
+void stopEffects(u32 address)
+{
+	Xil_Out32(address+EFFECTS_CONTROL_REG, 0);
+}
+
+// level in [-1.0, 1.0), Q1.15
+static u32 effectsLevel(float level)
+{
+	if (level < -1.0)
+		level = -1.0;
+	else if (level > 32767.0/32768.0)
+		level = 32767.0/32768.0;
+	return (u32)(int32_t)(level * 32768) & 0xFFFF;
+}
+
+void setEffectsDryLevel(u32 address, float level)
+{
+	Xil_Out32(address+EFFECTS_DRY_LEVEL_REG, effectsLevel(level));
+}
+
+void setEffectsTapLevel(u32 address, unsigned tap, float level)
+{
+	Xil_Out32(address+EFFECTS_TAP_BANK+tap*EFFECTS_TAP_BANK_SIZE+EFFECTS_TAP_LEVEL_REG, effectsLevel(level));
+}
+
+// The sum of the feedback levels must stay below 1.0 for the line to decay
+void setEffectsTapFeedback(u32 address, unsigned tap, float level)
+{
+	Xil_Out32(address+EFFECTS_TAP_BANK+tap*EFFECTS_TAP_BANK_SIZE+EFFECTS_TAP_FEEDBACK_REG, effectsLevel(level));
+}
+
+// The delay is rounded down to whole bursts and limited to the line size, it is applied
+// when the effects are enabled so a running line is restarted
+void setEffectsTapDelay(u32 address, unsigned tap, float time)
+{
+	u32 frames = (u32)(time * audioFreq);
+	u32 control = Xil_In32(address+EFFECTS_CONTROL_REG);
+
+	Xil_Out32(address+EFFECTS_TAP_BANK+tap*EFFECTS_TAP_BANK_SIZE+EFFECTS_TAP_DELAY_REG, frames & 0xFFFFFF);
+	if (control & EFFECTS_CONTROL_ENABLE)
+	{
+		Xil_Out32(address+EFFECTS_CONTROL_REG, 0);
+		Xil_Out32(address+EFFECTS_CONTROL_REG, control);
+	}
+}
+
+// Bursts since the effects were enabled, the DDR bandwidth is one write and one read
+// burst per tap every 8 frames
+void getEffectsBurstCounts(u32 address, u32 *writeBursts, u32 *readBursts)
+{
+	*writeBursts = Xil_In32(address+EFFECTS_WRITE_BURST_REG);
+	*readBursts  = Xil_In32(address+EFFECTS_READ_BURST_REG);
+}
+
+// Bursts with an error response, saturates until the register is written
+u32 getEffectsErrorCount(u32 address)
+{
+	return Xil_In32(address+EFFECTS_ERROR_REG);
+}
+
+// Overflows are frames dropped on a full write FIFO, underruns are tap samples
+// not prefetched in time
+void getEffectsFlowStatus(u32 address, FLOW_STATUS *status)
+{
+	getFlowStatus(address+EFFECTS_FLOW_STATUS_REG, status);
+}
+
+void getEffectsFifoStatus(u32 address, unsigned fifo, FIFO_STATUS *status)
+{
+	Xil_Out32(address+EFFECTS_FIFO_SELECT_REG, (u32)fifo);
+	getFifoStatus(address+EFFECTS_FIFO_LEVEL_REG, address+EFFECTS_FIFO_ERROR_REG, status);
+}
+
 
 // Synthesizer functions
 
-void SynthNoteOn(uint32_t note)
+// The first channel of the group a note on steals when no group is free, -1 when
+// the note is dropped
+int SynthStealGroup(uint32_t note)
 {
-	getAdsrFreeChannels(ADSR_ADDR);
-	uint32_t temp;
+	int victim = -1;
+
+	if (stealPolicy == STEAL_NONE)
+		return -1;
+	if (stealPolicy == STEAL_SAME_NOTE)
+	{
+		for (int i = 0; i < NUM_CHANNELS && victim < 0; i += unisonVoices)
+		{
+			if (assignedChannels[i] == (int8_t)note)
+				victim = i;
+		}
+	}
+	else if (stealPolicy == STEAL_QUIETEST)
+	{
+		victim = getAdsrQuietestChannel(ADSR_ADDR);
+		if (victim >= 0)
+			victim -= victim % unisonVoices;
+	}
+	// the oldest note on, also when the policy finds no group
+	if (victim < 0)
+	{
+		victim = 0;
+		for (int i = unisonVoices; i < NUM_CHANNELS; i += unisonVoices)
+		{
+			if (noteOnCount - groupNoteOn[i] > noteOnCount - groupNoteOn[victim])
+				victim = i;
+		}
+	}
+	return victim;
+}
+
+// The first channel of the first group of the free voice pool that no note is
+// assigned to, NUM_CHANNELS when there is none
+int SynthFreeGroup(void)
+{
+	u32 mask = ((0x1u << unisonVoices) - 1);
 	int i = 0;
-	while( ((temp = (freeChannels[i/32] & (1 << i))) == 0) && (i < NUM_CHANNELS) )
+	while ((i < NUM_CHANNELS) &&
+		   (((freeChannels[i/32] >> (i % 32)) & mask) != mask || assignedChannels[i] != -1))
 	{
-		i++;
+		i += unisonVoices;
 	}
+	return i;
+}
 
-	if (i < NUM_CHANNELS) // channel available
+// A note claims a group of unisonVoices aligned channels, the group is reserved and
+// released as a whole so its voices start and stop together. The group is taken from
+// the free voice pool, which is read from the channel free registers only when it is
+// empty, as a freed interrupt may not have been serviced yet. When no group is free
+// the steal policy picks one, its envelopes fade out in 1 ms and restart with the
+// new note, the oscillators take the new frequency during the fade
+void SynthNoteOn(uint32_t note)
+{
+	int i = SynthFreeGroup();
+	if (i >= NUM_CHANNELS)
+	{
+		getAdsrFreeChannels(ADSR_ADDR);
+		i = SynthFreeGroup();
+	}
+
+	if (i >= NUM_CHANNELS) // no group available
+	{
+		i = SynthStealGroup(note);
+		if (i < 0)
+			return;
+		setAdsrGroupSteal(ADSR_ADDR, i, unisonVoices);
+		setAdsrGroupSteal(FILTER_ADSR_ADDR, i, unisonVoices);
+		voiceSteals++;
+	}
+
+	float freq = 8.18*powf(2.0, note/12.0);
+	for (int c = i; c < i + (int)unisonVoices; c++)
 	{
-		float freq = 8.18*powf(2.0, note/12.0);
-		// set oscillator channel frequency
-		setOscillatorFrequency(OSCILLATOR_ADDR, i, freq);
-		// turn on ADSR channel
-		setAdsrNoteOn(ADSR_ADDR, i);
-		setAdsrNoteOn(FILTER_ADSR_ADDR, i);
+		// set oscillator channel frequency, the slot detune is applied by the oscillator
+		setOscillatorFrequency(OSCILLATOR_ADDR, c, freq);
+		// set filter key tracking note
+		setFilterKeyNote(FILTER_ADDR, c, note);
 		// turn on LFO channel
-		enableOscillatorModulation(OSCILLATOR_ADDR,i, 1);
-		setLfoChannelOn(LFO_A_ADDR, i);
-		setLfoChannelOn(LFO_B_ADDR, i);
-		setLfoChannelOn(LFO_C_ADDR, i);
+		enableOscillatorModulation(OSCILLATOR_ADDR, c, 1);
+		setLfoChannelOn(LFO_A_ADDR, c);
+		setLfoChannelOn(LFO_B_ADDR, c);
+		setLfoChannelOn(LFO_C_ADDR, c);
 		// assign key to channel
-		assignedChannels[i] = note;
+		assignedChannels[c] = note;
 	}
-
+	freeChannels[i/32] &= ~(((0x1u << unisonVoices) - 1) << (i % 32));
+	groupNoteOn[i] = ++noteOnCount;
+	// turn on the ADSR channels of the group
+	setAdsrGroupNoteOn(ADSR_ADDR, i, unisonVoices);
+	setAdsrGroupNoteOn(FILTER_ADSR_ADDR, i, unisonVoices);
 }
 
 void SynthNoteOff(uint32_t note)
 {
 	int i = 0;
-	while ((assignedChannels[i] != note) && (i < NUM_CHANNELS))
+	while ((i < NUM_CHANNELS) && (assignedChannels[i] != (int8_t)note))
 	{
-		i++;
+		i += unisonVoices;
 	}
 
 	if (i < NUM_CHANNELS)
 	{
 		// channels had been assigned
-		setAdsrNoteOff(ADSR_ADDR, i);
-		setAdsrNoteOff(FILTER_ADSR_ADDR, i);
-		// turn off LFO channel
-		setLfoChannelOff(LFO_A_ADDR, i);
-		setLfoChannelOff(LFO_B_ADDR, i);
-		setLfoChannelOff(LFO_C_ADDR, i);
-		assignedChannels[i] = -1;
+		setAdsrGroupNoteOff(ADSR_ADDR, i, unisonVoices);
+		setAdsrGroupNoteOff(FILTER_ADSR_ADDR, i, unisonVoices);
+		// the LFOs modulate the release, SynthVoiceFreed turns them off
+		for (int c = i; c < i + (int)unisonVoices; c++)
+			assignedChannels[c] = -1;
+	}
+
+}
+
+// The voice freed interrupt of the amplitude ADSR. The channels that reached off
+// return to the free voice pool with their LFO and modulation turned off. A stolen
+// channel reaches off at the end of its fade and is left, it restarts with its new note
+void SynthVoiceFreed(void)
+{
+	for (u32 reg = 0; reg < SYNTH_CHANNEL_WORDS; reg++)
+	{
+		u32 freed = getAdsrFreedChannels(ADSR_ADDR, reg);
+		for (int c = reg*32; freed != 0; c++, freed >>= 1)
+		{
+			if ((freed & 0x1) == 0 || assignedChannels[c] != -1)
+				continue;
+			setLfoChannelOff(LFO_A_ADDR, c);
+			setLfoChannelOff(LFO_B_ADDR, c);
+			setLfoChannelOff(LFO_C_ADDR, c);
+			enableOscillatorModulation(OSCILLATOR_ADDR, c, 0);
+			freeChannels[reg] |= 0x1u << (c % 32);
+		}
+	}
+}
+
+// Detune in cents and pan spread of the unison slots, from -detune/-spread on the first
+// slot to detune/spread on the last. Every group uses the same slot pans, so the pans are
+// written once here and not on each note
+void SynthSetUnisonSpread(float detune, float spread)
+{
+	unisonDetune = detune;
+	unisonSpread = spread;
+	for (unsigned slot = 0; slot < unisonVoices; slot++)
+	{
+		float position = (unisonVoices > 1) ? 2.0 * slot / (unisonVoices - 1) - 1.0 : 0.0;
+		setOscillatorUnisonDetune(OSCILLATOR_ADDR, slot, detune * position);
 	}
+	for (unsigned first = 0; first < NUM_CHANNELS; first += unisonVoices)
+		setMixerPanSpread(MIXER_ADDR, first, unisonVoices, spread);
+}
+
+// Trades polyphony for unison, voices is 1, 2, 4 or 8 per note. The held notes are
+// released since their channel groups change, the free voice pool starts from the
+// channels that are off and the rest return through SynthVoiceFreed
+void SynthSetUnison(unsigned voices)
+{
+	unsigned size = 1;
+	while (size * 2 <= voices && size < MAX_UNISON_VOICES)
+		size *= 2;
+
+	for (u32 reg = 0; reg < SYNTH_CHANNEL_WORDS; reg++)
+	{
+		Xil_Out32(ADSR_ADDR+ADSR_NOTE_ON_OFF_REG*4+reg*4, 0);
+		Xil_Out32(FILTER_ADSR_ADDR+ADSR_NOTE_ON_OFF_REG*4+reg*4, 0);
+	}
+	for (int c = 0; c < NUM_CHANNELS; c++)
+		assignedChannels[c] = -1;
+	getAdsrFreeChannels(ADSR_ADDR);
 
+	unisonVoices = size;
+	setOscillatorUnison(OSCILLATOR_ADDR, unisonVoices);
+	SynthSetUnisonSpread(unisonDetune, unisonSpread);
+}
+
+// policy is one of STEAL_NONE, STEAL_OLDEST, STEAL_QUIETEST or STEAL_SAME_NOTE
+void SynthSetStealPolicy(unsigned policy)
+{
+	stealPolicy = (policy <= STEAL_SAME_NOTE) ? policy : STEAL_QUIETEST;
 }
 
+// Number of data bytes that follow a MIDI status byte, system messages and data
+// bytes without a status (running status) are skipped
+int SynthMidiDataLength(uint8_t status)
+{
+	switch (status & 0xF0)
+	{
+	case NOTE_OFF:
+	case NOTE_ON:
+	case POLYPHONIC_PRESSURE:
+	case CONTROL_CHANGE:
+	case PITCH_BEND:
+		return 2;
+	case PROGRAM_CHANGE:
+	case CHANNEL_PRESSURE:
+		return 1;
+	default:
+		return 0;
+	}
+}
+
+// A MIDI message received on the MIDI UART, data holds SynthMidiDataLength(status)
+// bytes. Notes are played on every MIDI channel, the other messages are ignored
+void SynthMidiMessage(uint8_t status, const u8 *data)
+{
+	switch (status & 0xF0)
+	{
+	case NOTE_OFF:
+		SynthNoteOff(data[0]);
+		break;
+	case NOTE_ON:
+		SynthNoteOn(data[0]);
+		break;
+	default:
+		break;
+	}
+}
 
 #endif /* SRC_SYNTHESIZER_H_ */
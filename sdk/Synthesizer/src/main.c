@@ -16,6 +16,7 @@
 #include "xscutimer.h"
 #include "xil_exception.h"
 #include "xil_printf.h"
+#include "xil_cache.h"
 
 #include "sleep.h"
 
@@ -47,10 +48,14 @@
 #define MIDI_INT_IRQ_ID		XPAR_XUARTPS_0_INTR
 #define INTR_ID				61
 #define TIMER_INT_IRQ_ID	XPAR_SCUTIMER_INTR
+#define VOICE_FREED_INT_IRQ_ID	62		// IRQ_F2P[1], the voice freed interrupt of ADSR_0
 
 /* UART receive buffer size*/
 #define UART_BUFFER_SIZE	100
 
+/* Effects delay line, 2.7 s at 48 kHz*/
+#define EFFECTS_BUFFER_FRAMES	131072
+
 
 /************************** Function Prototypes *****************************/
 
@@ -72,6 +77,7 @@ static void UARTInterruptHandler(void *CallBackRef, u32 Event, unsigned int Even
 static void MIDIInterruptHandler(void *CallBackRef, u32 Event, unsigned int EventData);
 static void XAdcInterruptHandler(void *CallBackRef);
 static void TimerInterruptHandler(void *CallBackRef);
+static void VoiceFreedInterruptHandler(void *CallBackRef);
 
 void MessageReceived(uint8_t command, void *data, uint8_t size);
 void readUart(XUartPs *instancePtr, u8 *buffer, int bytes);
@@ -88,6 +94,9 @@ XGpio input, output;
 static u8 RecvBuffer[UART_BUFFER_SIZE];	/* UART receive buffer */
 static u8 MidiBuffer[UART_BUFFER_SIZE];	/* UART receive buffer */
 
+/* Effects delay line in DDR, only accessed by the effects module */
+static int32_t EffectsBuffer[EFFECTS_BUFFER_FRAMES*2] __attribute__((aligned(EFFECTS_BURST_BYTES)));
+
 int adcData[32];
 
 int main(void)
@@ -160,10 +169,37 @@ int main(void)
 	setFilterCutoffFrequency(FILTER_ADDR, 20000);	// cutoff 20kHz
 	setFilterResonance(FILTER_ADDR, 0);				// resonance 0
 	setFilterType(FILTER_ADDR, 0, 1);				// low pass, 12 dB/Oct
-	setFilterEnvelopeAmount(FILTER_ADDR, 0.0);		// envelope amount 0
+	setFilterEnvelopeAmount(FILTER_ADDR, 0.0);		// envelope routed through the modulation matrix
 	setFilterModulationEnable(FILTER_ADDR, 1);		// enable cut-off frequency modulation
 	setFilterModulationAmount(FILTER_ADDR, 1.0);	// set modulation amount to zero
-
+	setFilterKeyTracking(FILTER_ADDR, 0.0);			// key tracking off
+	setFilterOversampling(FILTER_ADDR, 0);			// 2x oversampling off
+	DEBUG_PRINT(("Filter frame cycles: %u (1x), %u (2x) of %u per sample\n", (unsigned)getFilterFrameCycles(FILTER_ADDR, 0), (unsigned)getFilterFrameCycles(FILTER_ADDR, 1), (unsigned)getFilterSampleCycles(FILTER_ADDR)));
+
+	// Modulation matrix routing, LFO A to pitch, LFO B to cut-off, LFO C to pulse width,
+	// the amplitude envelope to the NCA and the filter envelope to cut-off
+	setModMatrixAmount(MOD_MATRIX_ADDR, MOD_DEST_PITCH, MOD_SOURCE_LFO_A, 1.0);
+	setModMatrixAmount(MOD_MATRIX_ADDR, MOD_DEST_PULSE_WIDTH, MOD_SOURCE_LFO_C, 1.0);
+	setModMatrixAmount(MOD_MATRIX_ADDR, MOD_DEST_CUTOFF, MOD_SOURCE_LFO_B, 1.0);
+	setModMatrixAmount(MOD_MATRIX_ADDR, MOD_DEST_CUTOFF, MOD_SOURCE_FILTER_ENVELOPE, 0.0);
+	setModMatrixAmount(MOD_MATRIX_ADDR, MOD_DEST_AMPLITUDE, MOD_SOURCE_AMP_ENVELOPE, 1.0);
+
+	// One voice per note, all channels available for polyphony, a note on with
+	// every channel playing steals the quietest
+	SynthSetUnison(1);
+	SynthSetStealPolicy(STEAL_QUIETEST);
+	// The voice freed interrupt returns the released voices to the free voice pool
+	setAdsrVoiceFreedIrq(ADSR_ADDR, 1);
+
+	// Effects initial values, taps at unrelated delays for a short reverb tail, muted
+	setEffectsDryLevel(EFFECTS_ADDR, 1.0);
+	for (int tap = 0; tap < EFFECTS_NUM_TAPS; tap++)
+	{
+		setEffectsTapDelay(EFFECTS_ADDR, tap, 0.05 + 0.0773*tap);
+		setEffectsTapLevel(EFFECTS_ADDR, tap, 0.0);
+		setEffectsTapFeedback(EFFECTS_ADDR, tap, 0.2);
+	}
+	startEffects(EFFECTS_ADDR, EffectsBuffer, sizeof(EffectsBuffer));
 
 	XScuTimer_LoadTimer(&TimerInst, 10000);
 	XScuTimer_Start(&TimerInst);
@@ -483,8 +519,8 @@ void MessageReceived(uint8_t command, void *data, uint8_t size)
 			STD_MESSAGE message;
 			memcpy(&message, data, size);
 			float amount = message.data/4095.0;
-			setFilterEnvelopeAmount(FILTER_ADDR, amount);
-			DEBUG_PRINT(("Received Filter Envelope Amount Message: %i\n", Xil_In32(FILTER_ADDR+FILTER_ENVELOPE_AMOUNT_REG)));
+			setModMatrixAmount(MOD_MATRIX_ADDR, MOD_DEST_CUTOFF, MOD_SOURCE_FILTER_ENVELOPE, amount);
+			DEBUG_PRINT(("Received Filter Envelope Amount Message: %i\n", message.data));
 		}
 			break;
 		case FILTER_ATTACK:
@@ -601,6 +637,40 @@ void MessageReceived(uint8_t command, void *data, uint8_t size)
 			DEBUG_PRINT(("Received LFO C Amount Message: %i\n\r", message.data));
 		}
 		break;
+		case UNISON_VOICES:
+		{
+			STD_MESSAGE message;
+			memcpy(&message, data, size);
+			SynthSetUnison(message.data);
+			DEBUG_PRINT(("Received Unison Voices Message: %i\n\r", message.data));
+		}
+		break;
+		case UNISON_DETUNE:
+		{
+			STD_MESSAGE message;
+			memcpy(&message, data, size);
+			float detune = message.data/4095.0*50.0;
+			SynthSetUnisonSpread(detune, unisonSpread);
+			DEBUG_PRINT(("Received Unison Detune Message: %i\n\r", message.data));
+		}
+		break;
+		case UNISON_SPREAD:
+		{
+			STD_MESSAGE message;
+			memcpy(&message, data, size);
+			float spread = message.data/4095.0;
+			SynthSetUnisonSpread(unisonDetune, spread);
+			DEBUG_PRINT(("Received Unison Spread Message: %i\n\r", message.data));
+		}
+		break;
+		case VOICE_STEAL:
+		{
+			STD_MESSAGE message;
+			memcpy(&message, data, size);
+			SynthSetStealPolicy(message.data);
+			DEBUG_PRINT(("Received Voice Steal Message: %i\n\r", message.data));
+		}
+		break;
 		default:
 			DEBUG_PRINT(("Error: Unknown command\n\r"));
 			break;
@@ -861,6 +931,18 @@ static int SetupInterruptSystem(XScuGic *IntcInstancePtr,
 
 	XScuTimer_EnableInterrupt(TimerInstPtr);
 
+	/* ADSR voice freed interrupt, active high level */
+	Status = XScuGic_Connect(IntcInstancePtr, VOICE_FREED_INT_IRQ_ID,
+						  (Xil_InterruptHandler) VoiceFreedInterruptHandler,
+						  NULL);
+	if (Status != XST_SUCCESS)
+	{
+		return XST_FAILURE;
+	}
+
+	XScuGic_SetPriorityTriggerType(IntcInstancePtr, VOICE_FREED_INT_IRQ_ID, 0xa0, 1);
+	XScuGic_Enable(IntcInstancePtr, VOICE_FREED_INT_IRQ_ID);
+
 	/* Enable interrupts */
 	Xil_ExceptionEnable();
 
@@ -940,42 +1022,9 @@ void MIDIInterruptHandler(void *CallBackRef, u32 Event, unsigned int EventData)
 		count = XUartPs_Recv(MidiInstPtr, MidiBuffer, 1);
 		if (count != 0)
 		{
-			char command = (MidiBuffer[0] & 0xF0);
-			char note;
-			switch (command)
-			{
-			case NOTE_OFF:
-				readUart(MidiInstPtr, MidiBuffer, 2);
-				note = MidiBuffer[0];
-				SynthNoteOff(note);
-				break;
-			case NOTE_ON:
-				readUart(MidiInstPtr, MidiBuffer, 2);
-				note = MidiBuffer[0];
-				SynthNoteOn(note);
-				break;
-			case POLYPHONIC_PRESSURE:
-				readUart(MidiInstPtr, MidiBuffer, 2);
-				break;
-			case CONTROL_CHANGE:
-				readUart(MidiInstPtr, MidiBuffer, 2);
-				break;
-			case PROGRAM_CHANGE:
-				readUart(MidiInstPtr, MidiBuffer, 1);
-				break;
-			case CHANNEL_PRESSURE:
-				readUart(MidiInstPtr, MidiBuffer, 1);
-				break;
-			case PITCH_BEND:
-				readUart(MidiInstPtr, MidiBuffer, 2);
-				break;
-			case SYSTEM:
-
-				break;
-			default:
-				// unknown command
-				break;
-			}
+			uint8_t status = MidiBuffer[0];
+			readUart(MidiInstPtr, MidiBuffer, SynthMidiDataLength(status));
+			SynthMidiMessage(status, MidiBuffer);
 		}
 	} while (XUartPs_IsReceiveData(XPAR_XUARTPS_1_BASEADDR));
 }
@@ -1008,6 +1057,12 @@ static void TimerInterruptHandler(void *CallBackRef)
 	XSysMon_SetSequencerMode(&SysMonInst, XSM_SEQ_MODE_ONEPASS);
 }
 
+static void VoiceFreedInterruptHandler(void *CallBackRef)
+{
+	// the reads of the freed registers clear the interrupt
+	SynthVoiceFreed();
+}
+
 void readUart(XUartPs *instancePtr, u8 *buffer, int bytes)
 {
 	int count = 0;
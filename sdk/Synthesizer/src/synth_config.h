@@ -0,0 +1,33 @@
+/*
+ * synth_config.h
+ *
+ * The voice count, oscillators per voice, sample rate and DSP clock of the
+ * synthesizer and the values derived from them. Generated by
+ * src/config/generate_config.tcl from src/config/synth_config.tcl, do not edit.
+ */
+
+#ifndef SRC_SYNTH_CONFIG_H_
+#define SRC_SYNTH_CONFIG_H_
+
+#define SYNTH_NUM_CHANNELS			128
+#define SYNTH_NUM_OSCILLATORS		3
+#define SYNTH_SAMPLE_RATE			96000
+#define SYNTH_CLOCK_HZ				72000000
+
+// 32 bit registers of a bit per channel, the note on and channel free registers
+#define SYNTH_CHANNEL_WORDS			((SYNTH_NUM_CHANNELS + 31) / 32)
+// Clocks of a sample period and the clocks the oscillator takes for it
+#define SYNTH_SAMPLE_CYCLES			(SYNTH_CLOCK_HZ / SYNTH_SAMPLE_RATE)
+#define SYNTH_FRAME_CYCLES			(SYNTH_NUM_CHANNELS * SYNTH_NUM_OSCILLATORS)
+
+#if SYNTH_NUM_CHANNELS < 1 || SYNTH_NUM_CHANNELS > 128
+#error "the channel field of the registers holds 1 to 128 channels"
+#endif
+#if SYNTH_NUM_OSCILLATORS < 1
+#error "at least one oscillator per voice"
+#endif
+#if SYNTH_FRAME_CYCLES >= SYNTH_SAMPLE_CYCLES
+#error "the oscillator does not finish the channels in a sample period"
+#endif
+
+#endif /* SRC_SYNTH_CONFIG_H_ */
@@ -17,6 +17,10 @@ proc get_script_folder {} {
 variable script_folder
 set script_folder [_tcl::get_script_folder]
 
+# Voice count, oscillators per voice and sample rate of src/config/synth_config.tcl,
+# regenerates the configuration package of the IPs and the header of the firmware
+source [file join $script_folder .. config generate_config.tcl]
+
 ################################################################
 # Check if script is running in correct Vivado version.
 ################################################################
@@ -125,13 +129,18 @@ set bCheckIPs 1
 if { $bCheckIPs == 1 } {
    set list_check_ips "\ 
 xilinx.com:user:ADSR:2.0\
+xilinx.com:user:Audio_Capture:1.0\
+xilinx.com:user:Effects:1.0\
 xilinx.com:ip:xlconstant:1.1\
 xilinx.com:Synth:I2S_Transceiver:1.0\
 xilinx.com:user:LFO:1.0\
 xilinx.com:user:Mixer:2.0\
+xilinx.com:user:Mod_Matrix:1.0\
 xilinx.com:user:Moog_Ladder_Filter:1.0\
 xilinx.com:user:Multiplier:2.0\
 xilinx.com:user:Oscillator:2.0\
+xilinx.com:user:Param_Stream:1.0\
+xilinx.com:ip:axi_dma:7.1\
 xilinx.com:ip:axi_gpio:2.0\
 xilinx.com:ip:clk_wiz:6.0\
 xilinx.com:ip:processing_system7:5.5\
@@ -222,15 +231,28 @@ proc create_root_design { parentCell } {
   # Create instance: ADSR_0, and set properties
   set ADSR_0 [ create_bd_cell -type ip -vlnv xilinx.com:user:ADSR:2.0 ADSR_0 ]
   set_property -dict [ list \
-   CONFIG.g_NUM_CHANNELS {128} \
+   CONFIG.g_NUM_CHANNELS $::SYNTH_NUM_CHANNELS \
  ] $ADSR_0
 
   # Create instance: ADSR_1, and set properties
   set ADSR_1 [ create_bd_cell -type ip -vlnv xilinx.com:user:ADSR:2.0 ADSR_1 ]
   set_property -dict [ list \
-   CONFIG.g_NUM_CHANNELS {128} \
+   CONFIG.g_NUM_CHANNELS $::SYNTH_NUM_CHANNELS \
  ] $ADSR_1
 
+  # Create instance: Audio_Capture_0, and set properties
+  set Audio_Capture_0 [ create_bd_cell -type ip -vlnv xilinx.com:user:Audio_Capture:1.0 Audio_Capture_0 ]
+  set_property -dict [ list \
+   CONFIG.g_FIFO_DEPTH {64} \
+ ] $Audio_Capture_0
+
+  # Create instance: Effects_0, and set properties
+  set Effects_0 [ create_bd_cell -type ip -vlnv xilinx.com:user:Effects:1.0 Effects_0 ]
+  set_property -dict [ list \
+   CONFIG.g_FIFO_DEPTH {64} \
+   CONFIG.g_NUM_TAPS {4} \
+ ] $Effects_0
+
   # Create instance: GND, and set properties
   set GND [ create_bd_cell -type ip -vlnv xilinx.com:ip:xlconstant:1.1 GND ]
   set_property -dict [ list \
@@ -243,52 +265,67 @@ proc create_root_design { parentCell } {
   # Create instance: LFO_0, and set properties
   set LFO_0 [ create_bd_cell -type ip -vlnv xilinx.com:user:LFO:1.0 LFO_0 ]
   set_property -dict [ list \
-   CONFIG.g_NUM_CHANNELS {128} \
+   CONFIG.g_NUM_CHANNELS $::SYNTH_NUM_CHANNELS \
+   CONFIG.g_NUM_LFOS {3} \
  ] $LFO_0
 
-  # Create instance: LFO_1, and set properties
-  set LFO_1 [ create_bd_cell -type ip -vlnv xilinx.com:user:LFO:1.0 LFO_1 ]
-  set_property -dict [ list \
-   CONFIG.g_NUM_CHANNELS {128} \
- ] $LFO_1
-
-  # Create instance: LFO_2, and set properties
-  set LFO_2 [ create_bd_cell -type ip -vlnv xilinx.com:user:LFO:1.0 LFO_2 ]
-  set_property -dict [ list \
-   CONFIG.g_NUM_CHANNELS {128} \
- ] $LFO_2
-
   # Create instance: Mixer_0, and set properties
   set Mixer_0 [ create_bd_cell -type ip -vlnv xilinx.com:user:Mixer:2.0 Mixer_0 ]
   set_property -dict [ list \
-   CONFIG.g_NUM_CHANNELS {128} \
+   CONFIG.g_NUM_CHANNELS $::SYNTH_NUM_CHANNELS \
  ] $Mixer_0
 
+  # Create instance: Mod_Matrix_0, and set properties
+  set Mod_Matrix_0 [ create_bd_cell -type ip -vlnv xilinx.com:user:Mod_Matrix:1.0 Mod_Matrix_0 ]
+  set_property -dict [ list \
+   CONFIG.g_NUM_CHANNELS $::SYNTH_NUM_CHANNELS \
+   CONFIG.g_NUM_LFOS {3} \
+   CONFIG.g_NUM_ENVELOPES {2} \
+ ] $Mod_Matrix_0
+
   # Create instance: Moog_Ladder_Filter_0, and set properties
   set Moog_Ladder_Filter_0 [ create_bd_cell -type ip -vlnv xilinx.com:user:Moog_Ladder_Filter:1.0 Moog_Ladder_Filter_0 ]
   set_property -dict [ list \
-   CONFIG.g_NUM_CHANNELS {128} \
+   CONFIG.g_NUM_CHANNELS $::SYNTH_NUM_CHANNELS \
+   CONFIG.g_CYCLES_PER_SAMPLE [expr {$::SYNTH_CLOCK_HZ / $::SYNTH_SAMPLE_RATE}] \
  ] $Moog_Ladder_Filter_0
 
   # Create instance: Multiplier_0, and set properties
   set Multiplier_0 [ create_bd_cell -type ip -vlnv xilinx.com:user:Multiplier:2.0 Multiplier_0 ]
   set_property -dict [ list \
-   CONFIG.g_NUM_CHANNELS {128} \
+   CONFIG.g_NUM_CHANNELS $::SYNTH_NUM_CHANNELS \
  ] $Multiplier_0
 
   # Create instance: Oscillator_0, and set properties
   set Oscillator_0 [ create_bd_cell -type ip -vlnv xilinx.com:user:Oscillator:2.0 Oscillator_0 ]
   set_property -dict [ list \
-   CONFIG.g_NUM_CHANNELS {128} \
-   CONFIG.g_NUM_OSCILLATORS {3} \
+   CONFIG.g_NUM_CHANNELS $::SYNTH_NUM_CHANNELS \
+   CONFIG.g_NUM_OSCILLATORS $::SYNTH_NUM_OSCILLATORS \
  ] $Oscillator_0
 
+  # Create instance: Param_Stream_0, and set properties
+  set Param_Stream_0 [ create_bd_cell -type ip -vlnv xilinx.com:user:Param_Stream:1.0 Param_Stream_0 ]
+  set_property -dict [ list \
+   CONFIG.g_FIFO_DEPTH {16} \
+ ] $Param_Stream_0
+
   # Create instance: VDD, and set properties
   set VDD [ create_bd_cell -type ip -vlnv xilinx.com:ip:xlconstant:1.1 VDD ]
   set_property -dict [ list \
    CONFIG.CONST_VAL {1} \
  ] $VDD
 
+  # Create instance: axi_dma_0, and set properties
+  set axi_dma_0 [ create_bd_cell -type ip -vlnv xilinx.com:ip:axi_dma:7.1 axi_dma_0 ]
+  set_property -dict [ list \
+   CONFIG.c_include_s2mm {0} \
+   CONFIG.c_include_sg {0} \
+   CONFIG.c_m_axi_mm2s_data_width {64} \
+   CONFIG.c_m_axis_mm2s_tdata_width {64} \
+   CONFIG.c_mm2s_burst_size {16} \
+   CONFIG.c_sg_length_width {16} \
+ ] $axi_dma_0
+
   # Create instance: axi_gpio_0, and set properties
   set axi_gpio_0 [ create_bd_cell -type ip -vlnv xilinx.com:ip:axi_gpio:2.0 axi_gpio_0 ]
   set_property -dict [ list \
@@ -315,6 +352,40 @@ proc create_root_design { parentCell } {
    CONFIG.USE_BOARD_FLOW {true} \
  ] $axi_gpio_1
 
+  # Create instance: axi_gpio_2, and set properties
+  set axi_gpio_2 [ create_bd_cell -type ip -vlnv xilinx.com:ip:axi_gpio:2.0 axi_gpio_2 ]
+  set_property -dict [ list \
+   CONFIG.C_ALL_OUTPUTS {1} \
+   CONFIG.C_DOUT_DEFAULT {0x00000001} \
+   CONFIG.C_GPIO_WIDTH {2} \
+ ] $axi_gpio_2
+
+  # Create instance: axis_broadcaster_0, and set properties
+  set axis_broadcaster_0 [ create_bd_cell -type ip -vlnv xilinx.com:ip:axis_broadcaster:1.1 axis_broadcaster_0 ]
+  set_property -dict [ list \
+   CONFIG.M00_TDATA_REMAP {tdata[31:0]} \
+   CONFIG.M01_TDATA_REMAP {tdata[63:32]} \
+   CONFIG.M02_TDATA_REMAP {tdata[95:64]} \
+   CONFIG.M03_TDATA_REMAP {tdata[127:96]} \
+   CONFIG.M_TDATA_NUM_BYTES {4} \
+   CONFIG.NUM_MI {4} \
+   CONFIG.S_TDATA_NUM_BYTES {16} \
+ ] $axis_broadcaster_0
+
+  # Create instance: axis_combiner_0, and set properties
+  set axis_combiner_0 [ create_bd_cell -type ip -vlnv xilinx.com:ip:axis_combiner:1.1 axis_combiner_0 ]
+  set_property -dict [ list \
+   CONFIG.NUM_SI {2} \
+   CONFIG.TDATA_NUM_BYTES {4} \
+ ] $axis_combiner_0
+
+  # Create instance: axi_mem_intercon, and set properties
+  set axi_mem_intercon [ create_bd_cell -type ip -vlnv xilinx.com:ip:axi_interconnect:2.1 axi_mem_intercon ]
+  set_property -dict [ list \
+   CONFIG.NUM_MI {1} \
+   CONFIG.NUM_SI {3} \
+ ] $axi_mem_intercon
+
   # Create instance: clk_wiz_0, and set properties
   set clk_wiz_0 [ create_bd_cell -type ip -vlnv xilinx.com:ip:clk_wiz:6.0 clk_wiz_0 ]
   set_property -dict [ list \
@@ -735,13 +806,15 @@ proc create_root_design { parentCell } {
    CONFIG.PCW_USB_RESET_ENABLE {1} \
    CONFIG.PCW_USB_RESET_SELECT {Share reset pin} \
    CONFIG.PCW_USE_FABRIC_INTERRUPT {1} \
+   CONFIG.PCW_USE_S_AXI_HP0 {1} \
    CONFIG.preset {ZedBoard} \
  ] $processing_system7_0
 
   # Create instance: ps7_0_axi_periph, and set properties
   set ps7_0_axi_periph [ create_bd_cell -type ip -vlnv xilinx.com:ip:axi_interconnect:2.1 ps7_0_axi_periph ]
   set_property -dict [ list \
-   CONFIG.NUM_MI {10} \
+   CONFIG.NUM_MI {19} \
+   CONFIG.NUM_SI {2} \
  ] $ps7_0_axi_periph
 
   # Create instance: rst_clk_wiz_0_36M, and set properties
@@ -780,6 +853,10 @@ proc create_root_design { parentCell } {
    CONFIG.IN1_WIDTH {1} \
  ] $xlconcat_0
 
+  # Create instance: xlconcat_1, and set properties, IRQ_F2P[0] the XADC end of
+  # sequence and IRQ_F2P[1] the ADSR_0 voice freed interrupt
+  set xlconcat_1 [ create_bd_cell -type ip -vlnv xilinx.com:ip:xlconcat:2.1 xlconcat_1 ]
+
   # Create instance: xlslice_0, and set properties
   set xlslice_0 [ create_bd_cell -type ip -vlnv xilinx.com:ip:xlslice:1.0 xlslice_0 ]
   set_property -dict [ list \
@@ -790,13 +867,23 @@ proc create_root_design { parentCell } {
  ] $xlslice_0
 
   # Create interface connections
-  connect_bd_intf_net -intf_net ADSR_0_M_AXIS_OUTPUT [get_bd_intf_pins ADSR_0/M_AXIS_OUTPUT] [get_bd_intf_pins Multiplier_0/S_AXIS_ENVELOPE]
-  connect_bd_intf_net -intf_net ADSR_1_M_AXIS_OUTPUT [get_bd_intf_pins ADSR_1/M_AXIS_OUTPUT] [get_bd_intf_pins Moog_Ladder_Filter_0/S_AXIS_ADSR]
-  connect_bd_intf_net -intf_net LFO_0_M_AXIS_OUTPUT [get_bd_intf_pins LFO_0/M_AXIS_OUTPUT] [get_bd_intf_pins Oscillator_0/S_AXIS_FREQ_MOD]
-  connect_bd_intf_net -intf_net LFO_1_M_AXIS_OUTPUT [get_bd_intf_pins LFO_1/M_AXIS_OUTPUT] [get_bd_intf_pins Moog_Ladder_Filter_0/S_AXI_MODULATION]
-  connect_bd_intf_net -intf_net LFO_2_M_AXIS_OUTPUT [get_bd_intf_pins LFO_2/M_AXIS_OUTPUT] [get_bd_intf_pins Oscillator_0/S_AXIS_PWM]
+  connect_bd_intf_net -intf_net ADSR_0_M_AXIS_OUTPUT [get_bd_intf_pins ADSR_0/M_AXIS_OUTPUT] [get_bd_intf_pins axis_combiner_0/S00_AXIS]
+  connect_bd_intf_net -intf_net ADSR_1_M_AXIS_OUTPUT [get_bd_intf_pins ADSR_1/M_AXIS_OUTPUT] [get_bd_intf_pins axis_combiner_0/S01_AXIS]
+  connect_bd_intf_net -intf_net Audio_Capture_0_M_AXI [get_bd_intf_pins Audio_Capture_0/M_AXI] [get_bd_intf_pins axi_mem_intercon/S01_AXI]
+  connect_bd_intf_net -intf_net Effects_0_M_AXI [get_bd_intf_pins Effects_0/M_AXI] [get_bd_intf_pins axi_mem_intercon/S02_AXI]
+  connect_bd_intf_net -intf_net LFO_0_M_AXIS_OUTPUT [get_bd_intf_pins LFO_0/M_AXIS_OUTPUT] [get_bd_intf_pins Mod_Matrix_0/S_AXIS_LFO]
+  connect_bd_intf_net -intf_net Mod_Matrix_0_M_AXIS_OUTPUT [get_bd_intf_pins Mod_Matrix_0/M_AXIS_OUTPUT] [get_bd_intf_pins axis_broadcaster_0/S_AXIS]
   connect_bd_intf_net -intf_net Moog_Ladder_Filter_0_M_AXIS_OUTPUT [get_bd_intf_pins Mixer_0/S_AXIS_INPUT] [get_bd_intf_pins Moog_Ladder_Filter_0/M_AXIS_OUTPUT]
   connect_bd_intf_net -intf_net Multiplier_0_M_AXIS_OUTPUT [get_bd_intf_pins Moog_Ladder_Filter_0/S_AXIS_INPUT] [get_bd_intf_pins Multiplier_0/M_AXIS_OUTPUT]
+  connect_bd_intf_net -intf_net Param_Stream_0_M_AXI [get_bd_intf_pins Param_Stream_0/M_AXI] [get_bd_intf_pins ps7_0_axi_periph/S01_AXI]
+  connect_bd_intf_net -intf_net axi_dma_0_M_AXIS_MM2S [get_bd_intf_pins Param_Stream_0/S_AXIS_CMD] [get_bd_intf_pins axi_dma_0/M_AXIS_MM2S]
+  connect_bd_intf_net -intf_net axi_dma_0_M_AXI_MM2S [get_bd_intf_pins axi_dma_0/M_AXI_MM2S] [get_bd_intf_pins axi_mem_intercon/S00_AXI]
+  connect_bd_intf_net -intf_net axis_broadcaster_0_M00_AXIS [get_bd_intf_pins Oscillator_0/S_AXIS_FREQ_MOD] [get_bd_intf_pins axis_broadcaster_0/M00_AXIS]
+  connect_bd_intf_net -intf_net axis_broadcaster_0_M01_AXIS [get_bd_intf_pins Oscillator_0/S_AXIS_PWM] [get_bd_intf_pins axis_broadcaster_0/M01_AXIS]
+  connect_bd_intf_net -intf_net axis_broadcaster_0_M02_AXIS [get_bd_intf_pins Moog_Ladder_Filter_0/S_AXI_MODULATION] [get_bd_intf_pins axis_broadcaster_0/M02_AXIS]
+  connect_bd_intf_net -intf_net axis_broadcaster_0_M03_AXIS [get_bd_intf_pins Multiplier_0/S_AXIS_ENVELOPE] [get_bd_intf_pins axis_broadcaster_0/M03_AXIS]
+  connect_bd_intf_net -intf_net axis_combiner_0_M_AXIS [get_bd_intf_pins Mod_Matrix_0/S_AXIS_ENVELOPE] [get_bd_intf_pins axis_combiner_0/M_AXIS]
+  connect_bd_intf_net -intf_net axi_mem_intercon_M00_AXI [get_bd_intf_pins axi_mem_intercon/M00_AXI] [get_bd_intf_pins processing_system7_0/S_AXI_HP0]
   connect_bd_intf_net -intf_net Oscillator_0_M_AXIS_OUTPUT [get_bd_intf_pins Multiplier_0/S_AXIS_INPUT] [get_bd_intf_pins Oscillator_0/M_AXIS_OUTPUT]
   connect_bd_intf_net -intf_net Vp_Vn_0_1 [get_bd_intf_ports Vp_Vn_0] [get_bd_intf_pins xadc_wiz_0/Vp_Vn]
   connect_bd_intf_net -intf_net processing_system7_0_DDR [get_bd_intf_ports DDR] [get_bd_intf_pins processing_system7_0/DDR]
@@ -810,44 +897,81 @@ proc create_root_design { parentCell } {
   connect_bd_intf_net -intf_net ps7_0_axi_periph_M05_AXI [get_bd_intf_pins Moog_Ladder_Filter_0/S_AXI_CTRL] [get_bd_intf_pins ps7_0_axi_periph/M05_AXI]
   connect_bd_intf_net -intf_net ps7_0_axi_periph_M06_AXI [get_bd_intf_pins ADSR_1/S_AXI_CTRL] [get_bd_intf_pins ps7_0_axi_periph/M06_AXI]
   connect_bd_intf_net -intf_net ps7_0_axi_periph_M07_AXI [get_bd_intf_pins LFO_0/S_AXI_CTRL] [get_bd_intf_pins ps7_0_axi_periph/M07_AXI]
-  connect_bd_intf_net -intf_net ps7_0_axi_periph_M08_AXI [get_bd_intf_pins LFO_1/S_AXI_CTRL] [get_bd_intf_pins ps7_0_axi_periph/M08_AXI]
-  connect_bd_intf_net -intf_net ps7_0_axi_periph_M09_AXI [get_bd_intf_pins LFO_2/S_AXI_CTRL] [get_bd_intf_pins ps7_0_axi_periph/M09_AXI]
+  connect_bd_intf_net -intf_net ps7_0_axi_periph_M08_AXI [get_bd_intf_pins Mixer_0/S_AXI_CTRL] [get_bd_intf_pins ps7_0_axi_periph/M08_AXI]
+  connect_bd_intf_net -intf_net ps7_0_axi_periph_M09_AXI [get_bd_intf_pins axi_gpio_2/S_AXI] [get_bd_intf_pins ps7_0_axi_periph/M09_AXI]
+  connect_bd_intf_net -intf_net ps7_0_axi_periph_M10_AXI [get_bd_intf_pins Multiplier_0/S_AXI_CTRL] [get_bd_intf_pins ps7_0_axi_periph/M10_AXI]
+  connect_bd_intf_net -intf_net ps7_0_axi_periph_M11_AXI [get_bd_intf_pins Oscillator_0/S_AXI_PARAM] [get_bd_intf_pins ps7_0_axi_periph/M11_AXI]
+  connect_bd_intf_net -intf_net ps7_0_axi_periph_M12_AXI [get_bd_intf_pins ADSR_0/S_AXI_PARAM] [get_bd_intf_pins ps7_0_axi_periph/M12_AXI]
+  connect_bd_intf_net -intf_net ps7_0_axi_periph_M13_AXI [get_bd_intf_pins ADSR_1/S_AXI_PARAM] [get_bd_intf_pins ps7_0_axi_periph/M13_AXI]
+  connect_bd_intf_net -intf_net ps7_0_axi_periph_M14_AXI [get_bd_intf_pins axi_dma_0/S_AXI_LITE] [get_bd_intf_pins ps7_0_axi_periph/M14_AXI]
+  connect_bd_intf_net -intf_net ps7_0_axi_periph_M15_AXI [get_bd_intf_pins Param_Stream_0/S_AXI_CTRL] [get_bd_intf_pins ps7_0_axi_periph/M15_AXI]
+  connect_bd_intf_net -intf_net ps7_0_axi_periph_M16_AXI [get_bd_intf_pins Audio_Capture_0/S_AXI_CTRL] [get_bd_intf_pins ps7_0_axi_periph/M16_AXI]
+  connect_bd_intf_net -intf_net ps7_0_axi_periph_M17_AXI [get_bd_intf_pins Mod_Matrix_0/S_AXI_CTRL] [get_bd_intf_pins ps7_0_axi_periph/M17_AXI]
+  connect_bd_intf_net -intf_net ps7_0_axi_periph_M18_AXI [get_bd_intf_pins Effects_0/S_AXI_CTRL] [get_bd_intf_pins ps7_0_axi_periph/M18_AXI]
 
   # Create port connections
+  connect_bd_net -net ADSR_0_o_voice_freed_irq [get_bd_pins ADSR_0/o_voice_freed_irq] [get_bd_pins xlconcat_1/In1]
   connect_bd_net -net ADSR_0_o_active_channel_count [get_bd_pins ADSR_0/o_active_channel_count] [get_bd_pins Mixer_0/i_active_channels]
   connect_bd_net -net GND_dout [get_bd_pins GND/dout] [get_bd_pins I2S_Transceiver_0/reset] [get_bd_pins I2S_Transceiver_0/sdata_rx]
   connect_bd_net -net I2S_Transceiver_0_lrck [get_bd_ports lrck] [get_bd_pins I2S_Transceiver_0/lrck]
-  connect_bd_net -net I2S_Transceiver_0_ready [get_bd_pins ADSR_0/i_enable] [get_bd_pins ADSR_1/i_enable] [get_bd_pins I2S_Transceiver_0/ready] [get_bd_pins LFO_0/i_enable] [get_bd_pins LFO_1/i_enable] [get_bd_pins LFO_2/i_enable] [get_bd_pins Mixer_0/i_en] [get_bd_pins Moog_Ladder_Filter_0/i_enable] [get_bd_pins Multiplier_0/i_enable] [get_bd_pins Oscillator_0/i_en]
+  connect_bd_net -net Audio_Capture_0_o_voice_select [get_bd_pins Audio_Capture_0/o_voice_select] [get_bd_pins Mixer_0/i_voice_select]
+  connect_bd_net -net I2S_Transceiver_0_ready [get_bd_pins ADSR_0/i_enable] [get_bd_pins ADSR_1/i_enable] [get_bd_pins I2S_Transceiver_0/ready] [get_bd_pins LFO_0/i_enable] [get_bd_pins Mixer_0/i_en] [get_bd_pins Mod_Matrix_0/i_enable] [get_bd_pins Moog_Ladder_Filter_0/i_enable] [get_bd_pins Multiplier_0/i_enable] [get_bd_pins Oscillator_0/i_en]
   connect_bd_net -net I2S_Transceiver_0_sclk [get_bd_ports sclk] [get_bd_pins I2S_Transceiver_0/sclk]
   connect_bd_net -net I2S_Transceiver_0_sdata_tx [get_bd_ports sdata_tx] [get_bd_pins I2S_Transceiver_0/sdata_tx]
-  connect_bd_net -net Mixer_0_o_output [get_bd_pins I2S_Transceiver_0/data_tx_left] [get_bd_pins I2S_Transceiver_0/data_tx_right] [get_bd_pins Mixer_0/o_output]
+  connect_bd_net -net Mixer_0_o_output [get_bd_pins Audio_Capture_0/i_mix_sample] [get_bd_pins Mixer_0/o_output]
+  connect_bd_net -net Effects_0_o_left [get_bd_pins Effects_0/o_left] [get_bd_pins I2S_Transceiver_0/data_tx_left]
+  connect_bd_net -net Effects_0_o_right [get_bd_pins Effects_0/o_right] [get_bd_pins I2S_Transceiver_0/data_tx_right]
+  connect_bd_net -net Mixer_0_o_output_left [get_bd_pins Effects_0/i_left] [get_bd_pins Mixer_0/o_output_left]
+  connect_bd_net -net Mixer_0_o_output_right [get_bd_pins Effects_0/i_right] [get_bd_pins Mixer_0/o_output_right]
+  connect_bd_net -net Mixer_0_o_output_valid [get_bd_pins Audio_Capture_0/i_sample_valid] [get_bd_pins Effects_0/i_sample_valid] [get_bd_pins Mixer_0/o_output_valid]
+  connect_bd_net -net Mixer_0_o_voice_output [get_bd_pins Audio_Capture_0/i_voice_sample] [get_bd_pins Mixer_0/o_voice_output]
   connect_bd_net -net VDD_dout [get_bd_pins VDD/dout] [get_bd_pins rst_clk_wiz_0_36M/ext_reset_in] [get_bd_pins rst_clk_wiz_0_72M/ext_reset_in]
   connect_bd_net -net axi_gpio_0_gpio2_io_o [get_bd_pins axi_gpio_0/gpio2_io_o] [get_bd_pins xlconcat_0/In1]
   connect_bd_net -net axi_gpio_0_gpio_io_o [get_bd_ports leds] [get_bd_pins axi_gpio_0/gpio_io_o]
+  connect_bd_net -net axi_gpio_2_gpio_io_o [get_bd_pins I2S_Transceiver_0/rate_sel] [get_bd_pins axi_gpio_2/gpio_io_o]
   connect_bd_net -net btns_1 [get_bd_ports btns] [get_bd_pins axi_gpio_1/gpio_io_i]
   connect_bd_net -net clk_wiz_0_MCLK [get_bd_ports mclk] [get_bd_pins I2S_Transceiver_0/mclk] [get_bd_pins clk_wiz_0/MCLK] [get_bd_pins rst_clk_wiz_0_36M/slowest_sync_clk]
-  connect_bd_net -net clk_wiz_0_clk_out2 [get_bd_pins ADSR_0/m_axis_output_aclk] [get_bd_pins ADSR_0/s_axi_ctrl_aclk] [get_bd_pins ADSR_1/m_axis_output_aclk] [get_bd_pins ADSR_1/s_axi_ctrl_aclk] [get_bd_pins LFO_0/m_axis_output_aclk] [get_bd_pins LFO_0/s_axi_ctrl_aclk] [get_bd_pins LFO_1/m_axis_output_aclk] [get_bd_pins LFO_1/s_axi_ctrl_aclk] [get_bd_pins LFO_2/m_axis_output_aclk] [get_bd_pins LFO_2/s_axi_ctrl_aclk] [get_bd_pins Mixer_0/s_axis_input_aclk] [get_bd_pins Moog_Ladder_Filter_0/m_axis_output_aclk] [get_bd_pins Moog_Ladder_Filter_0/s_axi_ctrl_aclk] [get_bd_pins Moog_Ladder_Filter_0/s_axi_modulation_aclk] [get_bd_pins Moog_Ladder_Filter_0/s_axis_adsr_aclk] [get_bd_pins Moog_Ladder_Filter_0/s_axis_input_aclk] [get_bd_pins Multiplier_0/m_axis_output_aclk] [get_bd_pins Multiplier_0/s_axis_envelope_aclk] [get_bd_pins Multiplier_0/s_axis_input_aclk] [get_bd_pins Oscillator_0/m_axis_output_aclk] [get_bd_pins Oscillator_0/s_axi_ctrl_aclk] [get_bd_pins Oscillator_0/s_axis_freq_mod_aclk] [get_bd_pins Oscillator_0/s_axis_pwm_aclk] [get_bd_pins clk_wiz_0/MCLKx2] [get_bd_pins ps7_0_axi_periph/M03_ACLK] [get_bd_pins ps7_0_axi_periph/M04_ACLK] [get_bd_pins ps7_0_axi_periph/M05_ACLK] [get_bd_pins ps7_0_axi_periph/M06_ACLK] [get_bd_pins ps7_0_axi_periph/M07_ACLK] [get_bd_pins ps7_0_axi_periph/M08_ACLK] [get_bd_pins ps7_0_axi_periph/M09_ACLK] [get_bd_pins rst_clk_wiz_0_72M/slowest_sync_clk]
+  connect_bd_net -net clk_wiz_0_clk_out2 [get_bd_pins ADSR_0/m_axis_output_aclk] [get_bd_pins ADSR_0/s_axi_ctrl_aclk] [get_bd_pins ADSR_0/s_axi_param_aclk] [get_bd_pins ADSR_1/m_axis_output_aclk] [get_bd_pins ADSR_1/s_axi_ctrl_aclk] [get_bd_pins ADSR_1/s_axi_param_aclk] [get_bd_pins Audio_Capture_0/m_axi_aclk] [get_bd_pins Audio_Capture_0/s_axi_ctrl_aclk] [get_bd_pins Effects_0/m_axi_aclk] [get_bd_pins Effects_0/s_axi_ctrl_aclk] [get_bd_pins LFO_0/m_axis_output_aclk] [get_bd_pins LFO_0/s_axi_ctrl_aclk] [get_bd_pins Mixer_0/s_axi_ctrl_aclk] [get_bd_pins Mixer_0/s_axis_input_aclk] [get_bd_pins Mod_Matrix_0/m_axis_output_aclk] [get_bd_pins Mod_Matrix_0/s_axi_ctrl_aclk] [get_bd_pins Mod_Matrix_0/s_axis_envelope_aclk] [get_bd_pins Mod_Matrix_0/s_axis_lfo_aclk] [get_bd_pins Moog_Ladder_Filter_0/m_axis_output_aclk] [get_bd_pins Moog_Ladder_Filter_0/s_axi_ctrl_aclk] [get_bd_pins Moog_Ladder_Filter_0/s_axi_modulation_aclk] [get_bd_pins Moog_Ladder_Filter_0/s_axis_adsr_aclk] [get_bd_pins Moog_Ladder_Filter_0/s_axis_input_aclk] [get_bd_pins Multiplier_0/m_axis_output_aclk] [get_bd_pins Multiplier_0/s_axi_ctrl_aclk] [get_bd_pins Multiplier_0/s_axis_envelope_aclk] [get_bd_pins Multiplier_0/s_axis_input_aclk] [get_bd_pins Oscillator_0/m_axis_output_aclk] [get_bd_pins Oscillator_0/s_axi_ctrl_aclk] [get_bd_pins Oscillator_0/s_axi_param_aclk] [get_bd_pins Oscillator_0/s_axis_freq_mod_aclk] [get_bd_pins Oscillator_0/s_axis_pwm_aclk] [get_bd_pins Param_Stream_0/m_axi_aclk] [get_bd_pins Param_Stream_0/s_axi_ctrl_aclk] [get_bd_pins Param_Stream_0/s_axis_cmd_aclk] [get_bd_pins axi_dma_0/m_axi_mm2s_aclk] [get_bd_pins axi_dma_0/s_axi_lite_aclk] [get_bd_pins clk_wiz_0/MCLKx2] [get_bd_pins ps7_0_axi_periph/M03_ACLK] [get_bd_pins ps7_0_axi_periph/M04_ACLK] [get_bd_pins ps7_0_axi_periph/M05_ACLK] [get_bd_pins ps7_0_axi_periph/M06_ACLK] [get_bd_pins ps7_0_axi_periph/M07_ACLK] [get_bd_pins ps7_0_axi_periph/M08_ACLK] [get_bd_pins ps7_0_axi_periph/M10_ACLK] [get_bd_pins ps7_0_axi_periph/M11_ACLK] [get_bd_pins ps7_0_axi_periph/M12_ACLK] [get_bd_pins ps7_0_axi_periph/M13_ACLK] [get_bd_pins ps7_0_axi_periph/M14_ACLK] [get_bd_pins ps7_0_axi_periph/M15_ACLK] [get_bd_pins ps7_0_axi_periph/M16_ACLK] [get_bd_pins ps7_0_axi_periph/M17_ACLK] [get_bd_pins ps7_0_axi_periph/M18_ACLK] [get_bd_pins ps7_0_axi_periph/S01_ACLK] [get_bd_pins processing_system7_0/S_AXI_HP0_ACLK] [get_bd_pins rst_clk_wiz_0_72M/slowest_sync_clk] [get_bd_pins axis_broadcaster_0/aclk] [get_bd_pins axis_combiner_0/aclk] [get_bd_pins axi_mem_intercon/ACLK] [get_bd_pins axi_mem_intercon/M00_ACLK] [get_bd_pins axi_mem_intercon/S00_ACLK] [get_bd_pins axi_mem_intercon/S01_ACLK] [get_bd_pins axi_mem_intercon/S02_ACLK]
   connect_bd_net -net clk_wiz_0_locked [get_bd_pins clk_wiz_0/locked] [get_bd_pins rst_clk_wiz_0_36M/dcm_locked] [get_bd_pins rst_clk_wiz_0_72M/dcm_locked]
-  connect_bd_net -net processing_system7_0_FCLK_CLK0 [get_bd_pins axi_gpio_0/s_axi_aclk] [get_bd_pins axi_gpio_1/s_axi_aclk] [get_bd_pins clk_wiz_0/clk_in1] [get_bd_pins processing_system7_0/FCLK_CLK0] [get_bd_pins processing_system7_0/M_AXI_GP0_ACLK] [get_bd_pins ps7_0_axi_periph/ACLK] [get_bd_pins ps7_0_axi_periph/M00_ACLK] [get_bd_pins ps7_0_axi_periph/M01_ACLK] [get_bd_pins ps7_0_axi_periph/M02_ACLK] [get_bd_pins ps7_0_axi_periph/S00_ACLK] [get_bd_pins rst_ps7_0_100M/slowest_sync_clk] [get_bd_pins xadc_wiz_0/s_axi_aclk]
+  connect_bd_net -net processing_system7_0_FCLK_CLK0 [get_bd_pins axi_gpio_0/s_axi_aclk] [get_bd_pins axi_gpio_1/s_axi_aclk] [get_bd_pins axi_gpio_2/s_axi_aclk] [get_bd_pins clk_wiz_0/clk_in1] [get_bd_pins processing_system7_0/FCLK_CLK0] [get_bd_pins processing_system7_0/M_AXI_GP0_ACLK] [get_bd_pins ps7_0_axi_periph/ACLK] [get_bd_pins ps7_0_axi_periph/M00_ACLK] [get_bd_pins ps7_0_axi_periph/M01_ACLK] [get_bd_pins ps7_0_axi_periph/M02_ACLK] [get_bd_pins ps7_0_axi_periph/M09_ACLK] [get_bd_pins ps7_0_axi_periph/S00_ACLK] [get_bd_pins rst_ps7_0_100M/slowest_sync_clk] [get_bd_pins xadc_wiz_0/s_axi_aclk]
   connect_bd_net -net processing_system7_0_FCLK_RESET0_N [get_bd_pins processing_system7_0/FCLK_RESET0_N] [get_bd_pins rst_ps7_0_100M/ext_reset_in]
-  connect_bd_net -net rst_clk_wiz_0_72M_peripheral_aresetn [get_bd_pins ADSR_0/m_axis_output_aresetn] [get_bd_pins ADSR_0/s_axi_ctrl_aresetn] [get_bd_pins ADSR_1/m_axis_output_aresetn] [get_bd_pins ADSR_1/s_axi_ctrl_aresetn] [get_bd_pins LFO_0/m_axis_output_aresetn] [get_bd_pins LFO_0/s_axi_ctrl_aresetn] [get_bd_pins LFO_1/m_axis_output_aresetn] [get_bd_pins LFO_1/s_axi_ctrl_aresetn] [get_bd_pins LFO_2/m_axis_output_aresetn] [get_bd_pins LFO_2/s_axi_ctrl_aresetn] [get_bd_pins Mixer_0/s_axis_input_aresetn] [get_bd_pins Moog_Ladder_Filter_0/m_axis_output_aresetn] [get_bd_pins Moog_Ladder_Filter_0/s_axi_ctrl_aresetn] [get_bd_pins Moog_Ladder_Filter_0/s_axi_modulation_aresetn] [get_bd_pins Moog_Ladder_Filter_0/s_axis_adsr_aresetn] [get_bd_pins Moog_Ladder_Filter_0/s_axis_input_aresetn] [get_bd_pins Multiplier_0/m_axis_output_aresetn] [get_bd_pins Multiplier_0/s_axis_envelope_aresetn] [get_bd_pins Multiplier_0/s_axis_input_aresetn] [get_bd_pins Oscillator_0/m_axis_output_aresetn] [get_bd_pins Oscillator_0/s_axi_ctrl_aresetn] [get_bd_pins Oscillator_0/s_axis_freq_mod_aresetn] [get_bd_pins Oscillator_0/s_axis_pwm_aresetn] [get_bd_pins ps7_0_axi_periph/M03_ARESETN] [get_bd_pins ps7_0_axi_periph/M04_ARESETN] [get_bd_pins ps7_0_axi_periph/M05_ARESETN] [get_bd_pins ps7_0_axi_periph/M06_ARESETN] [get_bd_pins ps7_0_axi_periph/M07_ARESETN] [get_bd_pins ps7_0_axi_periph/M08_ARESETN] [get_bd_pins ps7_0_axi_periph/M09_ARESETN] [get_bd_pins rst_clk_wiz_0_72M/peripheral_aresetn]
-  connect_bd_net -net rst_ps7_0_100M_peripheral_aresetn [get_bd_pins axi_gpio_0/s_axi_aresetn] [get_bd_pins axi_gpio_1/s_axi_aresetn] [get_bd_pins ps7_0_axi_periph/ARESETN] [get_bd_pins ps7_0_axi_periph/M00_ARESETN] [get_bd_pins ps7_0_axi_periph/M01_ARESETN] [get_bd_pins ps7_0_axi_periph/M02_ARESETN] [get_bd_pins ps7_0_axi_periph/S00_ARESETN] [get_bd_pins rst_ps7_0_100M/peripheral_aresetn] [get_bd_pins xadc_wiz_0/s_axi_aresetn]
+  connect_bd_net -net rst_clk_wiz_0_72M_peripheral_aresetn [get_bd_pins ADSR_0/m_axis_output_aresetn] [get_bd_pins ADSR_0/s_axi_ctrl_aresetn] [get_bd_pins ADSR_0/s_axi_param_aresetn] [get_bd_pins ADSR_1/m_axis_output_aresetn] [get_bd_pins ADSR_1/s_axi_ctrl_aresetn] [get_bd_pins ADSR_1/s_axi_param_aresetn] [get_bd_pins Audio_Capture_0/m_axi_aresetn] [get_bd_pins Audio_Capture_0/s_axi_ctrl_aresetn] [get_bd_pins Effects_0/m_axi_aresetn] [get_bd_pins Effects_0/s_axi_ctrl_aresetn] [get_bd_pins LFO_0/m_axis_output_aresetn] [get_bd_pins LFO_0/s_axi_ctrl_aresetn] [get_bd_pins Mixer_0/s_axi_ctrl_aresetn] [get_bd_pins Mixer_0/s_axis_input_aresetn] [get_bd_pins Mod_Matrix_0/m_axis_output_aresetn] [get_bd_pins Mod_Matrix_0/s_axi_ctrl_aresetn] [get_bd_pins Mod_Matrix_0/s_axis_envelope_aresetn] [get_bd_pins Mod_Matrix_0/s_axis_lfo_aresetn] [get_bd_pins Moog_Ladder_Filter_0/m_axis_output_aresetn] [get_bd_pins Moog_Ladder_Filter_0/s_axi_ctrl_aresetn] [get_bd_pins Moog_Ladder_Filter_0/s_axi_modulation_aresetn] [get_bd_pins Moog_Ladder_Filter_0/s_axis_adsr_aresetn] [get_bd_pins Moog_Ladder_Filter_0/s_axis_input_aresetn] [get_bd_pins Multiplier_0/m_axis_output_aresetn] [get_bd_pins Multiplier_0/s_axi_ctrl_aresetn] [get_bd_pins Multiplier_0/s_axis_envelope_aresetn] [get_bd_pins Multiplier_0/s_axis_input_aresetn] [get_bd_pins Oscillator_0/m_axis_output_aresetn] [get_bd_pins Oscillator_0/s_axi_ctrl_aresetn] [get_bd_pins Oscillator_0/s_axi_param_aresetn] [get_bd_pins Oscillator_0/s_axis_freq_mod_aresetn] [get_bd_pins Oscillator_0/s_axis_pwm_aresetn] [get_bd_pins Param_Stream_0/m_axi_aresetn] [get_bd_pins Param_Stream_0/s_axi_ctrl_aresetn] [get_bd_pins Param_Stream_0/s_axis_cmd_aresetn] [get_bd_pins ps7_0_axi_periph/M03_ARESETN] [get_bd_pins ps7_0_axi_periph/M04_ARESETN] [get_bd_pins ps7_0_axi_periph/M05_ARESETN] [get_bd_pins ps7_0_axi_periph/M06_ARESETN] [get_bd_pins ps7_0_axi_periph/M07_ARESETN] [get_bd_pins ps7_0_axi_periph/M08_ARESETN] [get_bd_pins ps7_0_axi_periph/M10_ARESETN] [get_bd_pins ps7_0_axi_periph/M11_ARESETN] [get_bd_pins ps7_0_axi_periph/M12_ARESETN] [get_bd_pins ps7_0_axi_periph/M13_ARESETN] [get_bd_pins ps7_0_axi_periph/M14_ARESETN] [get_bd_pins ps7_0_axi_periph/M15_ARESETN] [get_bd_pins ps7_0_axi_periph/M16_ARESETN] [get_bd_pins ps7_0_axi_periph/M17_ARESETN] [get_bd_pins ps7_0_axi_periph/M18_ARESETN] [get_bd_pins ps7_0_axi_periph/S01_ARESETN] [get_bd_pins rst_clk_wiz_0_72M/peripheral_aresetn] [get_bd_pins axi_dma_0/axi_resetn] [get_bd_pins axis_broadcaster_0/aresetn] [get_bd_pins axis_combiner_0/aresetn] [get_bd_pins axi_mem_intercon/ARESETN] [get_bd_pins axi_mem_intercon/M00_ARESETN] [get_bd_pins axi_mem_intercon/S00_ARESETN] [get_bd_pins axi_mem_intercon/S01_ARESETN] [get_bd_pins axi_mem_intercon/S02_ARESETN]
+  connect_bd_net -net rst_ps7_0_100M_peripheral_aresetn [get_bd_pins axi_gpio_0/s_axi_aresetn] [get_bd_pins axi_gpio_1/s_axi_aresetn] [get_bd_pins axi_gpio_2/s_axi_aresetn] [get_bd_pins ps7_0_axi_periph/ARESETN] [get_bd_pins ps7_0_axi_periph/M00_ARESETN] [get_bd_pins ps7_0_axi_periph/M01_ARESETN] [get_bd_pins ps7_0_axi_periph/M02_ARESETN] [get_bd_pins ps7_0_axi_periph/M09_ARESETN] [get_bd_pins ps7_0_axi_periph/S00_ARESETN] [get_bd_pins rst_ps7_0_100M/peripheral_aresetn] [get_bd_pins xadc_wiz_0/s_axi_aresetn]
   connect_bd_net -net sw_1 [get_bd_ports sw] [get_bd_pins axi_gpio_1/gpio2_io_i]
-  connect_bd_net -net xadc_wiz_0_eos_out [get_bd_pins processing_system7_0/IRQ_F2P] [get_bd_pins xadc_wiz_0/eos_out]
+  connect_bd_net -net xadc_wiz_0_eos_out [get_bd_pins xadc_wiz_0/eos_out] [get_bd_pins xlconcat_1/In0]
   connect_bd_net -net xadc_wiz_0_muxaddr_out [get_bd_pins xadc_wiz_0/muxaddr_out] [get_bd_pins xlslice_0/Din]
   connect_bd_net -net xlconcat_0_dout [get_bd_ports XADC_GIO] [get_bd_pins xlconcat_0/dout]
+  connect_bd_net -net xlconcat_1_dout [get_bd_pins processing_system7_0/IRQ_F2P] [get_bd_pins xlconcat_1/dout]
   connect_bd_net -net xlslice_0_Dout [get_bd_pins xlconcat_0/In0] [get_bd_pins xlslice_0/Dout]
 
   # Create address segments
+  create_bd_addr_seg -range 0x20000000 -offset 0x00000000 [get_bd_addr_spaces Audio_Capture_0/M_AXI] [get_bd_addr_segs processing_system7_0/S_AXI_HP0/HP0_DDR_LOWOCM] SEG_processing_system7_0_HP0_DDR_LOWOCM
   create_bd_addr_seg -range 0x00010000 -offset 0x43C20000 [get_bd_addr_spaces processing_system7_0/Data] [get_bd_addr_segs ADSR_0/S_AXI_CTRL/S_AXI_CTRL_reg] SEG_ADSR_0_S_AXI_CTRL_reg
+  create_bd_addr_seg -range 0x00010000 -offset 0x43CD0000 [get_bd_addr_spaces processing_system7_0/Data] [get_bd_addr_segs ADSR_0/S_AXI_PARAM/S_AXI_PARAM_mem] SEG_ADSR_0_S_AXI_PARAM_mem
+  create_bd_addr_seg -range 0x00010000 -offset 0x43C90000 [get_bd_addr_spaces processing_system7_0/Data] [get_bd_addr_segs Audio_Capture_0/S_AXI_CTRL/S_AXI_CTRL_reg] SEG_Audio_Capture_0_S_AXI_CTRL_reg
+  create_bd_addr_seg -range 0x20000000 -offset 0x00000000 [get_bd_addr_spaces Effects_0/M_AXI] [get_bd_addr_segs processing_system7_0/S_AXI_HP0/HP0_DDR_LOWOCM] SEG_processing_system7_0_HP0_DDR_LOWOCM
+  create_bd_addr_seg -range 0x00010000 -offset 0x43C70000 [get_bd_addr_spaces processing_system7_0/Data] [get_bd_addr_segs Effects_0/S_AXI_CTRL/S_AXI_CTRL_reg] SEG_Effects_0_S_AXI_CTRL_reg
+  create_bd_addr_seg -range 0x00010000 -offset 0x43C20000 [get_bd_addr_spaces Param_Stream_0/M_AXI] [get_bd_addr_segs ADSR_0/S_AXI_CTRL/S_AXI_CTRL_reg] SEG_ADSR_0_S_AXI_CTRL_reg
+  create_bd_addr_seg -range 0x00010000 -offset 0x43C40000 [get_bd_addr_spaces Param_Stream_0/M_AXI] [get_bd_addr_segs ADSR_1/S_AXI_CTRL/S_AXI_CTRL_reg] SEG_ADSR_1_S_AXI_CTRL_reg
+  create_bd_addr_seg -range 0x00010000 -offset 0x43C50000 [get_bd_addr_spaces Param_Stream_0/M_AXI] [get_bd_addr_segs LFO_0/S_AXI_CTRL/S_AXI_CTRL_reg] SEG_LFO_0_S_AXI_CTRL_reg
+  create_bd_addr_seg -range 0x00010000 -offset 0x43C60000 [get_bd_addr_spaces Param_Stream_0/M_AXI] [get_bd_addr_segs Mod_Matrix_0/S_AXI_CTRL/S_AXI_CTRL_reg] SEG_Mod_Matrix_0_S_AXI_CTRL_reg
+  create_bd_addr_seg -range 0x00010000 -offset 0x43C30000 [get_bd_addr_spaces Param_Stream_0/M_AXI] [get_bd_addr_segs Moog_Ladder_Filter_0/S_AXI_CTRL/S_AXI_CTRL_reg] SEG_Moog_Ladder_Filter_0_S_AXI_CTRL_reg
+  create_bd_addr_seg -range 0x00010000 -offset 0x43C00000 [get_bd_addr_spaces Param_Stream_0/M_AXI] [get_bd_addr_segs Oscillator_0/S_AXI_CTRL/S_AXI_CTRL_reg] SEG_Oscillator_0_S_AXI_CTRL_reg
+  create_bd_addr_seg -range 0x00010000 -offset 0x43C80000 [get_bd_addr_spaces processing_system7_0/Data] [get_bd_addr_segs Param_Stream_0/S_AXI_CTRL/S_AXI_CTRL_reg] SEG_Param_Stream_0_S_AXI_CTRL_reg
+  create_bd_addr_seg -range 0x20000000 -offset 0x00000000 [get_bd_addr_spaces axi_dma_0/Data_MM2S] [get_bd_addr_segs processing_system7_0/S_AXI_HP0/HP0_DDR_LOWOCM] SEG_processing_system7_0_HP0_DDR_LOWOCM
+  create_bd_addr_seg -range 0x00010000 -offset 0x40400000 [get_bd_addr_spaces processing_system7_0/Data] [get_bd_addr_segs axi_dma_0/S_AXI_LITE/Reg] SEG_axi_dma_0_Reg
   create_bd_addr_seg -range 0x00010000 -offset 0x43C40000 [get_bd_addr_spaces processing_system7_0/Data] [get_bd_addr_segs ADSR_1/S_AXI_CTRL/S_AXI_CTRL_reg] SEG_ADSR_1_S_AXI_CTRL_reg
+  create_bd_addr_seg -range 0x00010000 -offset 0x43CE0000 [get_bd_addr_spaces processing_system7_0/Data] [get_bd_addr_segs ADSR_1/S_AXI_PARAM/S_AXI_PARAM_mem] SEG_ADSR_1_S_AXI_PARAM_mem
   create_bd_addr_seg -range 0x00010000 -offset 0x43C50000 [get_bd_addr_spaces processing_system7_0/Data] [get_bd_addr_segs LFO_0/S_AXI_CTRL/S_AXI_CTRL_reg] SEG_LFO_0_S_AXI_CTRL_reg
-  create_bd_addr_seg -range 0x00010000 -offset 0x43C60000 [get_bd_addr_spaces processing_system7_0/Data] [get_bd_addr_segs LFO_1/S_AXI_CTRL/S_AXI_CTRL_reg] SEG_LFO_1_S_AXI_CTRL_reg
-  create_bd_addr_seg -range 0x00010000 -offset 0x43C70000 [get_bd_addr_spaces processing_system7_0/Data] [get_bd_addr_segs LFO_2/S_AXI_CTRL/S_AXI_CTRL_reg] SEG_LFO_2_S_AXI_CTRL_reg
+  create_bd_addr_seg -range 0x00010000 -offset 0x43CA0000 [get_bd_addr_spaces processing_system7_0/Data] [get_bd_addr_segs Mixer_0/S_AXI_CTRL/S_AXI_CTRL_reg] SEG_Mixer_0_S_AXI_CTRL_reg
+  create_bd_addr_seg -range 0x00010000 -offset 0x43C60000 [get_bd_addr_spaces processing_system7_0/Data] [get_bd_addr_segs Mod_Matrix_0/S_AXI_CTRL/S_AXI_CTRL_reg] SEG_Mod_Matrix_0_S_AXI_CTRL_reg
   create_bd_addr_seg -range 0x00010000 -offset 0x43C30000 [get_bd_addr_spaces processing_system7_0/Data] [get_bd_addr_segs Moog_Ladder_Filter_0/S_AXI_CTRL/S_AXI_CTRL_reg] SEG_Moog_Ladder_Filter_0_S_AXI_CTRL_reg
+  create_bd_addr_seg -range 0x00010000 -offset 0x43CB0000 [get_bd_addr_spaces processing_system7_0/Data] [get_bd_addr_segs Multiplier_0/S_AXI_CTRL/S_AXI_CTRL_reg] SEG_Multiplier_0_S_AXI_CTRL_reg
   create_bd_addr_seg -range 0x00010000 -offset 0x43C00000 [get_bd_addr_spaces processing_system7_0/Data] [get_bd_addr_segs Oscillator_0/S_AXI_CTRL/S_AXI_CTRL_reg] SEG_Oscillator_0_S_AXI_CTRL_reg
+  create_bd_addr_seg -range 0x00010000 -offset 0x43CC0000 [get_bd_addr_spaces processing_system7_0/Data] [get_bd_addr_segs Oscillator_0/S_AXI_PARAM/S_AXI_PARAM_mem] SEG_Oscillator_0_S_AXI_PARAM_mem
   create_bd_addr_seg -range 0x00010000 -offset 0x41200000 [get_bd_addr_spaces processing_system7_0/Data] [get_bd_addr_segs axi_gpio_0/S_AXI/Reg] SEG_axi_gpio_0_Reg
   create_bd_addr_seg -range 0x00010000 -offset 0x41210000 [get_bd_addr_spaces processing_system7_0/Data] [get_bd_addr_segs axi_gpio_1/S_AXI/Reg] SEG_axi_gpio_1_Reg
+  create_bd_addr_seg -range 0x00010000 -offset 0x41220000 [get_bd_addr_spaces processing_system7_0/Data] [get_bd_addr_segs axi_gpio_2/S_AXI/Reg] SEG_axi_gpio_2_Reg
   create_bd_addr_seg -range 0x00010000 -offset 0x43C10000 [get_bd_addr_spaces processing_system7_0/Data] [get_bd_addr_segs xadc_wiz_0/s_axi_lite/Reg] SEG_xadc_wiz_0_Reg
 
 
@@ -0,0 +1,134 @@
+# Generate Configuration
+#
+# Writes synth_config.tcl as the VHDL package of the IPs and the C header of
+# the firmware:
+#
+#   tclsh src/config/generate_config.tcl
+#
+# or source it in Vivado, src/bd/system.tcl does before it sets the generics.
+# Only the values are written, the derived widths and the cycle budget check
+# are expressions of them that the VHDL elaboration and the C preprocessor
+# evaluate, so both fail on a configuration the hardware can not run.
+
+namespace eval synth_config {
+    variable dir  [file dirname [file normalize [info script]]]
+    variable root [file dirname [file dirname $dir]]
+    variable names {SYNTH_NUM_CHANNELS SYNTH_NUM_OSCILLATORS SYNTH_SAMPLE_RATE SYNTH_CLOCK_HZ}
+
+    proc write_file {path text} {
+        set file [open $path w]
+        fconfigure $file -translation lf
+        puts -nonewline $file $text
+        close $file
+        puts "generate_config: wrote $path"
+    }
+
+    proc vhdl_package {} {
+        return "-- Package: Synthesizer Configuration
+-- Description: The voice count, oscillators per voice, sample rate and DSP clock of
+-- the synthesizer and the widths and budgets derived from them. Generated by
+-- src/config/generate_config.tcl from src/config/synth_config.tcl, do not edit.
+
+library ieee;
+use ieee.std_logic_1164.all;
+use ieee.math_real.all;
+
+package synth_config_package is
+    constant c_NUM_CHANNELS    : integer := $::SYNTH_NUM_CHANNELS;
+    constant c_NUM_OSCILLATORS : integer := $::SYNTH_NUM_OSCILLATORS;
+    constant c_SAMPLE_RATE     : integer := $::SYNTH_SAMPLE_RATE;
+    constant c_CLOCK_HZ        : integer := $::SYNTH_CLOCK_HZ;
+
+    -- bits of a channel index, at least one for a single channel
+    constant c_CHANNEL_WIDTH : integer := integer(ceil(log2(real(c_NUM_CHANNELS + boolean'pos(c_NUM_CHANNELS = 1)))));
+    -- bits of the active channel count, 0 to c_NUM_CHANNELS
+    constant c_COUNT_WIDTH   : integer := integer(ceil(log2(real(c_NUM_CHANNELS + 1))));
+    -- 32 bit registers of a bit per channel, the note on and channel free registers
+    constant c_CHANNEL_WORDS : integer := (c_NUM_CHANNELS + 31) / 32;
+    -- clocks of a sample period, the g_CYCLES_PER_SAMPLE of the modules
+    constant c_SAMPLE_CYCLES : integer := c_CLOCK_HZ / c_SAMPLE_RATE;
+    -- clocks the oscillator takes for a sample period, the most of the modules
+    constant c_FRAME_CYCLES  : integer := c_NUM_CHANNELS * c_NUM_OSCILLATORS;
+
+    -- checked when the package is elaborated
+    constant c_CONFIG_VALID : boolean;
+end package synth_config_package;
+
+package body synth_config_package is
+
+    function f_check_config return boolean is
+    begin
+        assert c_NUM_CHANNELS >= 1 and c_NUM_CHANNELS <= 128
+            report \"c_NUM_CHANNELS is \" & integer'image(c_NUM_CHANNELS) &
+                   \", the channel field of the registers holds 1 to 128 channels\"
+            severity failure;
+        assert c_NUM_OSCILLATORS >= 1
+            report \"c_NUM_OSCILLATORS is \" & integer'image(c_NUM_OSCILLATORS) severity failure;
+        assert c_FRAME_CYCLES < c_SAMPLE_CYCLES
+            report \"the oscillator takes \" & integer'image(c_FRAME_CYCLES) & \" clocks of the \" &
+                   integer'image(c_SAMPLE_CYCLES) & \" clocks of a sample period\"
+            severity failure;
+        return true;
+    end function;
+
+    constant c_CONFIG_VALID : boolean := f_check_config;
+
+end package body synth_config_package;
+"
+    }
+
+    proc c_header {} {
+        return "/*
+ * synth_config.h
+ *
+ * The voice count, oscillators per voice, sample rate and DSP clock of the
+ * synthesizer and the values derived from them. Generated by
+ * src/config/generate_config.tcl from src/config/synth_config.tcl, do not edit.
+ */
+
+#ifndef SRC_SYNTH_CONFIG_H_
+#define SRC_SYNTH_CONFIG_H_
+
+#define SYNTH_NUM_CHANNELS			$::SYNTH_NUM_CHANNELS
+#define SYNTH_NUM_OSCILLATORS		$::SYNTH_NUM_OSCILLATORS
+#define SYNTH_SAMPLE_RATE			$::SYNTH_SAMPLE_RATE
+#define SYNTH_CLOCK_HZ				$::SYNTH_CLOCK_HZ
+
+// 32 bit registers of a bit per channel, the note on and channel free registers
+#define SYNTH_CHANNEL_WORDS			((SYNTH_NUM_CHANNELS + 31) / 32)
+// Clocks of a sample period and the clocks the oscillator takes for it
+#define SYNTH_SAMPLE_CYCLES			(SYNTH_CLOCK_HZ / SYNTH_SAMPLE_RATE)
+#define SYNTH_FRAME_CYCLES			(SYNTH_NUM_CHANNELS * SYNTH_NUM_OSCILLATORS)
+
+#if SYNTH_NUM_CHANNELS < 1 || SYNTH_NUM_CHANNELS > 128
+#error \"the channel field of the registers holds 1 to 128 channels\"
+#endif
+#if SYNTH_NUM_OSCILLATORS < 1
+#error \"at least one oscillator per voice\"
+#endif
+#if SYNTH_FRAME_CYCLES >= SYNTH_SAMPLE_CYCLES
+#error \"the oscillator does not finish the channels in a sample period\"
+#endif
+
+#endif /* SRC_SYNTH_CONFIG_H_ */
+"
+    }
+
+    proc generate {} {
+        variable dir
+        variable root
+        variable names
+        source [file join $dir synth_config.tcl]
+        foreach name $names {
+            set value [set $name]
+            if {![string is integer -strict $value] || $value < 1} {
+                error "generate_config: $name must be a positive integer, not '$value'"
+            }
+            set ::$name $value
+        }
+        write_file [file join $root repo common synth_config_package.vhd] [vhdl_package]
+        write_file [file join $root sdk Synthesizer src synth_config.h] [c_header]
+    }
+}
+
+synth_config::generate
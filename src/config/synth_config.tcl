@@ -0,0 +1,16 @@
+# Synthesizer configuration
+#
+# The voice count, the oscillators per voice, the sample rate and the clock
+# of the DSP modules, set here and nowhere else. generate_config.tcl writes
+# them with the widths and budgets derived from them to
+# repo/common/synth_config_package.vhd and sdk/Synthesizer/src/synth_config.h,
+# src/bd/system.tcl runs it before it sets the IP generics and src/hdl/Makefile
+# reads this file.
+#
+# The channel field of the registers is 7 bits, 1 to 128 channels, and the
+# oscillator takes a clock per channel and oscillator of each sample period.
+
+set SYNTH_NUM_CHANNELS    128
+set SYNTH_NUM_OSCILLATORS 3
+set SYNTH_SAMPLE_RATE     96000
+set SYNTH_CLOCK_HZ        72000000
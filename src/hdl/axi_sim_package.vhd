@@ -1,6 +1,7 @@
 library ieee;
 use ieee.std_logic_1164.all;
 use ieee.numeric_std.all;
+use std.textio.all;
 
 package axi_sim_package is
 
@@ -8,7 +9,7 @@ package axi_sim_package is
         -- write address channel
         awvalid : std_logic;
         awready : std_logic;
-        awaddr  : std_logic_vector(5 downto 0);
+        awaddr  : std_logic_vector(7 downto 0);
         awprot  : std_logic_vector(2 downto 0);
         -- write data channel
         wvalid  : std_logic;
@@ -22,7 +23,7 @@ package axi_sim_package is
         -- read address channel
         arvalid : std_logic;
         arready : std_logic;
-        araddr  : std_logic_vector(5 downto 0);
+        araddr  : std_logic_vector(7 downto 0);
         arprot  : std_logic_vector(2 downto 0);
         -- read data channel
         rvalid  : std_logic;
@@ -54,6 +55,17 @@ package axi_sim_package is
                          signal axi_slave     : inout t_axi_slave;
                          constant C_AXI_ADDR : in integer;
                          variable data : out std_logic_vector(31 downto 0));
+
+    -- writes every transfer of a stream to a file until the end of the
+    -- simulation, one line per transfer: "<sample period> <data>". The sample
+    -- period counts i_en from 0, a transfer on the clock of i_en belongs to
+    -- the sample period before, and the data is tdata(width-1 downto 0) as a
+    -- signed integer. Called as a concurrent procedure, it does not return.
+    procedure axis_log(signal axi_aclk : in std_logic;
+                       signal i_en     : in std_logic;
+                       signal axis     : in t_axi_stream_slave;
+                       constant width  : in integer;
+                       constant path   : in string);
                          
 end package axi_sim_package;
 
@@ -122,4 +134,27 @@ package body axi_sim_package is
         data := axi_slave.rdata;
     end procedure;
 
+    procedure axis_log(signal axi_aclk : in std_logic;
+                       signal i_en     : in std_logic;
+                       signal axis     : in t_axi_stream_slave;
+                       constant width  : in integer;
+                       constant path   : in string) is
+        file     v_file   : text open write_mode is path;
+        variable v_line   : line;
+        variable v_period : integer := -1;
+    begin
+        loop
+            wait until rising_edge(axi_aclk);
+            if axis.tvalid = '1' and axis.tready = '1' then
+                write(v_line, v_period);
+                write(v_line, ' ');
+                write(v_line, to_integer(signed(axis.tdata(width-1 downto 0))));
+                writeline(v_file, v_line);
+            end if;
+            if i_en = '1' then
+                v_period := v_period + 1;
+            end if;
+        end loop;
+    end procedure;
+
 end package body axi_sim_package;
\ No newline at end of file
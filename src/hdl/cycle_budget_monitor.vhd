@@ -0,0 +1,82 @@
+library ieee;
+use ieee.std_logic_1164.all;
+
+-- Cycle Budget Monitor
+-- Description:
+-- Simulation only. Counts the clocks from each i_en to the last of
+-- g_NUM_BEATS transfers on a stream, the clocks a module takes to produce
+-- every channel of a sample period, and fails the simulation when the count
+-- exceeds g_BUDGET or the next i_en arrives first. The first g_WARMUP sample
+-- periods, while the FIFOs between the modules fill, are not checked. After
+-- g_PERIODS checked periods the worst count is reported on one line for the
+-- GHDL run target (src/hdl/Makefile):
+--
+--   CYCLE_BUDGET <name> channels <n> cycles <worst> budget <budget>
+
+entity cycle_budget_monitor is
+    generic(
+        g_NAME      : string  := "module";
+        g_NUM_BEATS : integer := 128;
+        g_BUDGET    : integer := 750;
+        g_WARMUP    : integer := 4;
+        g_PERIODS   : integer := 16
+    );
+    port(
+        i_clk    : in std_logic;
+        i_en     : in std_logic;
+        i_tvalid : in std_logic;
+        i_tready : in std_logic
+    );
+end cycle_budget_monitor;
+
+architecture sim of cycle_budget_monitor is
+begin
+
+    process(i_clk)
+        variable v_period   : integer := 0;      -- sample periods started
+        variable v_measured : integer := 0;      -- sample periods checked
+        variable v_cycles   : integer := 0;      -- clocks since i_en
+        variable v_beats    : integer := 0;      -- transfers since i_en
+        variable v_worst    : integer := 0;
+        variable v_done     : boolean := true;   -- all transfers of the period seen
+    begin
+        if rising_edge(i_clk) then
+            v_cycles := v_cycles + 1;
+
+            -- a transfer on the clock of i_en still belongs to the last period
+            if i_tvalid = '1' and i_tready = '1' and not v_done then
+                v_beats := v_beats + 1;
+                if v_beats = g_NUM_BEATS then
+                    v_done := true;
+                    if v_period > g_WARMUP then
+                        v_measured := v_measured + 1;
+                        if v_cycles > v_worst then
+                            v_worst := v_cycles;
+                        end if;
+                        assert v_cycles <= g_BUDGET
+                            report g_NAME & ": " & integer'image(v_cycles) & " cycles from i_en to the last of " &
+                                   integer'image(g_NUM_BEATS) & " channels, budget " & integer'image(g_BUDGET)
+                            severity failure;
+                        if v_measured = g_PERIODS then
+                            report "CYCLE_BUDGET " & g_NAME & " channels " & integer'image(g_NUM_BEATS) &
+                                   " cycles " & integer'image(v_worst) & " budget " & integer'image(g_BUDGET)
+                            severity note;
+                        end if;
+                    end if;
+                end if;
+            end if;
+
+            if i_en = '1' then
+                assert v_done or v_period <= g_WARMUP
+                    report g_NAME & ": " & integer'image(v_beats) & " of " & integer'image(g_NUM_BEATS) &
+                           " channels out when the next i_en arrived"
+                    severity failure;
+                v_period := v_period + 1;
+                v_cycles := 0;
+                v_beats  := 0;
+                v_done   := false;
+            end if;
+        end if;
+    end process;
+
+end sim;
@@ -2,6 +2,7 @@ library ieee;
 use ieee.std_logic_1164.all;
 use ieee.numeric_std.all;
 use IEEE.math_real.all;
+use std.textio.all;
 
 use work.axi_sim_package.all;
 
@@ -22,6 +23,13 @@ package synth_module_sim_package is
     constant OSC_MODULATION_ENABLE : integer := 4;
     constant OSC_DETUNE_REG        : integer := 5;
     constant OSC_AMPLITUDE_REG     : integer := 6;
+    constant OSC_FLOW_STATUS_REG   : integer := 7;
+    constant OSC_PARAM_SOURCE_REG  : integer := 8;
+    constant OSC_UNISON_REG        : integer := 9;
+    constant OSC_UNISON_DETUNE_REG : integer := 10;
+    constant OSC_FIFO_SELECT_REG   : integer := 13;
+    constant OSC_FIFO_LEVEL_REG    : integer := 14;
+    constant OSC_FIFO_ERROR_REG    : integer := 15;
 
     -- ADSR MODULE REGISTERS
     constant ADSR_ON_OFF_REG        : integer := 0;
@@ -29,6 +37,12 @@ package synth_module_sim_package is
     constant ADSR_DECAY_CW_REG      : integer := 5;
     constant ADSR_SUSTAIN_LEVEL_REG : integer := 6;
     constant ADSR_RELEASE_CW_REG    : integer := 7;
+    constant ADSR_PARAM_SOURCE_REG  : integer := 12;
+    constant ADSR_STEAL_REG         : integer := 13;
+    constant ADSR_FIFO_LEVEL_REG    : integer := 14;
+    constant ADSR_FIFO_ERROR_REG    : integer := 15;
+    constant ADSR_FREED_REG         : integer := 16;
+    constant ADSR_FREED_IRQ_EN_REG  : integer := 20;
 
     constant ADSR_MAX_CW_VALUE : integer := 2**23-1;
 
@@ -40,6 +54,14 @@ package synth_module_sim_package is
     constant FILTER_MODULATION_AMOUNT_REG   : integer := 4;
     constant FILTER_TYPE_REG                : integer := 5;
     constant FILTER_ATTENUATION_REG         : integer := 6;
+    constant FILTER_CUTOFF_OFFSET_REG       : integer := 7;
+    constant FILTER_KEY_NOTE_REG            : integer := 8;
+    constant FILTER_KEY_TRACKING_REG        : integer := 9;
+    constant FILTER_OVERSAMPLE_REG          : integer := 10;
+    constant FILTER_FRAME_CYCLES_REG        : integer := 12;
+    constant FILTER_FIFO_SELECT_REG         : integer := 13;
+    constant FILTER_FIFO_LEVEL_REG          : integer := 14;
+    constant FILTER_FIFO_ERROR_REG          : integer := 15;
     
     -- LFO MODULE REGISTERS
     constant LFO_VOICE_ON_OFF_REG      : integer := 0;
@@ -47,6 +69,65 @@ package synth_module_sim_package is
     constant LFO_AMOUNT_REG            : integer := 2;
     constant LFO_WAVEFORM_REG          : integer := 3;
     constant LFO_POLYPHONY_ENABLE_REG  : integer := 4;
+    constant LFO_FLOW_STATUS_REG       : integer := 5;
+    constant LFO_FIFO_LEVEL_REG        : integer := 6;
+    constant LFO_FIFO_ERROR_REG        : integer := 7;
+    constant LFO_BANK_REGS             : integer := 8; -- registers per LFO bank, status registers are shared
+
+    -- MULTIPLIER MODULE REGISTERS
+    constant MULT_FLOW_STATUS_REG : integer := 0;
+    constant MULT_FIFO_SELECT_REG : integer := 1;
+    constant MULT_FIFO_LEVEL_REG  : integer := 2;
+    constant MULT_FIFO_ERROR_REG  : integer := 3;
+
+    -- MODULATION MATRIX REGISTERS
+    constant MOD_MATRIX_BANK_REGS         : integer := 8; -- source amounts per destination bank
+    constant MOD_MATRIX_FLOW_STATUS_REG   : integer := 32;
+    constant MOD_MATRIX_FIFO_SELECT_REG   : integer := 33;
+    constant MOD_MATRIX_FIFO_LEVEL_REG    : integer := 34;
+    constant MOD_MATRIX_FIFO_ERROR_REG    : integer := 35;
+
+    -- MIXER MODULE REGISTERS
+    constant MIXER_STEREO_REG     : integer := 0;
+    constant MIXER_PAN_REG        : integer := 1;
+    constant MIXER_FIFO_LEVEL_REG : integer := 2;
+    constant MIXER_FIFO_ERROR_REG : integer := 3;
+
+    -- PARAMETER STREAM MODULE REGISTERS
+    constant PARAM_STREAM_TARGET_BASE_REG : integer := 0;
+    constant PARAM_STREAM_STATUS_REG      : integer := 8;
+    constant PARAM_STREAM_BUSY_REG        : integer := 9;
+    constant PARAM_STREAM_FIFO_LEVEL_REG  : integer := 10;
+    constant PARAM_STREAM_FIFO_ERROR_REG  : integer := 11;
+
+    -- AUDIO CAPTURE MODULE REGISTERS
+    constant CAPTURE_CONTROL_REG      : integer := 0;
+    constant CAPTURE_VOICE_REG        : integer := 1;
+    constant CAPTURE_BASE_REG         : integer := 2;
+    constant CAPTURE_SIZE_REG         : integer := 3;
+    constant CAPTURE_HEAD_REG         : integer := 4;
+    constant CAPTURE_TAIL_REG         : integer := 5;
+    constant CAPTURE_SAMPLE_COUNT_REG : integer := 6;
+    constant CAPTURE_ERROR_REG        : integer := 7;
+    constant CAPTURE_FIFO_LEVEL_REG   : integer := 8;
+    constant CAPTURE_FIFO_ERROR_REG   : integer := 9;
+
+    -- EFFECTS MODULE REGISTERS
+    constant EFFECTS_CONTROL_REG      : integer := 0;
+    constant EFFECTS_BASE_REG         : integer := 1;
+    constant EFFECTS_SIZE_REG         : integer := 2;
+    constant EFFECTS_DRY_LEVEL_REG    : integer := 3;
+    constant EFFECTS_FLOW_STATUS_REG  : integer := 8;
+    constant EFFECTS_FIFO_SELECT_REG  : integer := 9;
+    constant EFFECTS_FIFO_LEVEL_REG   : integer := 10;
+    constant EFFECTS_FIFO_ERROR_REG   : integer := 11;
+    constant EFFECTS_WRITE_BURST_REG  : integer := 12;
+    constant EFFECTS_READ_BURST_REG   : integer := 13;
+    constant EFFECTS_ERROR_REG        : integer := 14;
+    constant EFFECTS_TAP_BANK_REGS    : integer := 8; -- tap n bank at register 16+8*n
+    constant EFFECTS_TAP_DELAY_REG    : integer := 16;
+    constant EFFECTS_TAP_LEVEL_REG    : integer := 17;
+    constant EFFECTS_TAP_FEEDBACK_REG : integer := 18;
 
    ------------------ OSCILLATOR MODULE FUNCTIONS ------------------
 
@@ -78,6 +159,11 @@ package synth_module_sim_package is
                              signal axi_slave : inout t_axi_slave;
                              constant osc     : in integer);
 
+    procedure osc_set_unison(signal axi_aclk   : in std_logic;
+                             signal axi_slave  : inout t_axi_slave;
+                             constant voices   : in integer;
+                             constant detune   : in real);
+
     ------------------ ADSR MODULE FUNCTIONS ------------------    
     
     procedure adsr_set_voice_on(signal axi_aclk  : in std_logic;
@@ -104,6 +190,27 @@ package synth_module_sim_package is
                                     signal axi_slave : inout t_axi_slave;
                                     constant time    : in real);
 
+    procedure adsr_steal_voices(signal axi_aclk  : in std_logic;
+                                signal axi_slave : inout t_axi_slave;
+                                constant voice   : in integer;
+                                constant count   : in integer);
+
+    procedure adsr_get_quietest_voice(signal axi_aclk  : in std_logic;
+                                      signal axi_slave : inout t_axi_slave;
+                                      variable valid   : out boolean;
+                                      variable voice   : out integer;
+                                      variable level   : out integer);
+
+    procedure adsr_set_voice_freed_irq(signal axi_aclk  : in std_logic;
+                                       signal axi_slave : inout t_axi_slave;
+                                       constant enable  : in boolean);
+
+    -- reads and clears the voices 32*word to 32*word+31 freed since the last read
+    procedure adsr_get_freed_voices(signal axi_aclk  : in std_logic;
+                                    signal axi_slave : inout t_axi_slave;
+                                    constant word    : in integer;
+                                    variable freed   : out std_logic_vector(31 downto 0));
+
     ------------------ FILTER MODULE FUNCTIONS ------------------ 
 
     procedure filter_set_cutoff_frequency(signal axi_aclk : in std_logic;
@@ -121,32 +228,90 @@ package synth_module_sim_package is
     procedure filter_set_attenuation(signal axi_aclk      : in std_logic;
                                      signal axi_slave         : inout t_axi_slave;
                                      constant attenuation : in t_filter_attenuation);    
+
+    procedure filter_set_voice_cutoff_offset(signal axi_aclk  : in std_logic;
+                                             signal axi_slave : inout t_axi_slave;
+                                             constant voice   : in integer;
+                                             constant freq    : in real);
+
+    procedure filter_set_voice_note(signal axi_aclk  : in std_logic;
+                                    signal axi_slave : inout t_axi_slave;
+                                    constant voice   : in integer;
+                                    constant note    : in integer);
+
+    procedure filter_set_key_tracking(signal axi_aclk  : in std_logic;
+                                      signal axi_slave : inout t_axi_slave;
+                                      constant amount  : in real);
+                                      
+    procedure filter_set_oversampling(signal axi_aclk  : in std_logic;
+                                      signal axi_slave : inout t_axi_slave;
+                                      constant enable  : in integer);
                                                           
     ------------------ LFO MODULE FUNCTIONS ------------------ 
     procedure lfo_set_voice_on(signal axi_aclk  : in std_logic;
                                 signal axi_slave : inout t_axi_slave;
-                                constant voice   : in integer);
+                                constant voice   : in integer;
+                                constant lfo      : in integer := 0);
 
     procedure lfo_set_voice_off(signal axi_aclk  : in std_logic;
                                  signal axi_slave : inout t_axi_slave;
-                                 constant voice   : in integer);
+                                 constant voice   : in integer;
+                                 constant lfo      : in integer := 0);
                                  
     procedure lfo_set_rate(signal axi_aclk : in std_logic;
                                 signal axi_slave    : inout t_axi_slave;
-                                constant period   : in real);
+                                constant period   : in real;
+                                constant lfo      : in integer := 0);
 
     procedure lfo_set_amount(signal axi_aclk   : in std_logic;
                                  signal axi_slave      : inout t_axi_slave;
-                                 constant amp      : in real);   
+                                 constant amp      : in real;
+                                 constant lfo      : in integer := 0);   
                                  
     procedure lfo_set_waveform(signal axi_aclk   : in std_logic;
                                 signal axi_slave      : inout t_axi_slave;
-                                constant wavetype : in t_wavetype);                               
+                                constant wavetype : in t_wavetype;
+                                constant lfo      : in integer := 0);                               
     
     procedure lfo_enable_polyphony(signal axi_aclk   : in std_logic;
                                 signal axi_slave      : inout t_axi_slave;
-                                constant enable : in std_logic);                               
-
+                                constant enable : in std_logic;
+                                constant lfo      : in integer := 0);                               
+
+    ------------------ MODULATION MATRIX FUNCTIONS ------------------
+    procedure mod_matrix_set_amount(signal axi_aclk    : in std_logic;
+                                    signal axi_slave   : inout t_axi_slave;
+                                    constant dest      : in integer;
+                                    constant source    : in integer;
+                                    constant amount    : in real);
+
+    ------------------ MIXER MODULE FUNCTIONS ------------------ 
+    procedure mixer_set_voice_pan(signal axi_aclk  : in std_logic;
+                                  signal axi_slave : inout t_axi_slave;
+                                  constant voice   : in integer;
+                                  constant pan     : in real);
+
+    ------------------ EFFECTS MODULE FUNCTIONS ------------------ 
+    procedure effects_set_tap(signal axi_aclk   : in std_logic;
+                              signal axi_slave  : inout t_axi_slave;
+                              constant tap      : in integer;
+                              constant delay    : in integer;
+                              constant level    : in real;
+                              constant feedback : in real);
+    ------------------ REGISTER SCRIPT ------------------
+    -- runs a register script (model/src/register_script.h) on the oscillator,
+    -- ADSR and filter: drives i_en every sample_cycles clocks and makes the
+    -- writes of each sample period sample_cycles-1 clocks after the i_en
+    -- before, once the modules are done with it, which lengthens that sample
+    -- period by the clocks of the writes. Returns before the sample period of
+    -- the end line.
+    procedure run_register_script(signal axi_aclk      : in std_logic;
+                                  signal enable        : out std_logic;
+                                  signal axi_osc       : inout t_axi_slave;
+                                  signal axi_adsr      : inout t_axi_slave;
+                                  signal axi_filter    : inout t_axi_slave;
+                                  constant sample_cycles : in integer;
+                                  constant path        : in string);
 
 end package synth_module_sim_package;
 
@@ -226,6 +391,27 @@ package body synth_module_sim_package is
         msg := std_logic_vector(to_unsigned(osc * 2**25, 32));
         s_axi_write(axi_aclk, axi_slave, OSC_PWM_ENABLE_REG, msg);
     end procedure;     
+
+    -- voices {1, 2, 4, 8} per note, the slots are detuned evenly from -detune to detune cents
+    procedure osc_set_unison(signal axi_aclk   : in std_logic;
+                             signal axi_slave  : inout t_axi_slave;
+                             constant voices   : in integer;
+                             constant detune   : in real) is
+        variable cents : real;
+        variable msg   : std_logic_vector(31 downto 0);
+    begin
+        for slot in 0 to voices-1 loop
+            if voices > 1 then
+                cents := detune * (2.0 * real(slot) / real(voices-1) - 1.0);
+            else
+                cents := 0.0;
+            end if;
+            msg := std_logic_vector(to_unsigned(slot * 2**25 + integer(2.0**14.0 * 2.0**(cents/1200.0)), 32));
+            s_axi_write(axi_aclk, axi_slave, OSC_UNISON_DETUNE_REG, msg);
+        end loop;
+        msg := std_logic_vector(to_unsigned(integer(log2(real(voices))), 32));
+        s_axi_write(axi_aclk, axi_slave, OSC_UNISON_REG, msg);
+    end procedure;
     -- ------------------ ADSR MODULE FUNCTIONS ------------------    
     
     procedure adsr_set_voice_on(signal axi_aclk : in std_logic;
@@ -315,6 +501,48 @@ package body synth_module_sim_package is
         s_axi_write(axi_aclk, axi_slave, ADSR_RELEASE_CW_REG, msg);
     end procedure;
 
+    procedure adsr_steal_voices(signal axi_aclk  : in std_logic;
+                                signal axi_slave : inout t_axi_slave;
+                                constant voice   : in integer;
+                                constant count   : in integer) is
+        variable msg : std_logic_vector(31 downto 0);
+    begin
+        msg := std_logic_vector(to_unsigned(voice, 7)) & std_logic_vector(to_unsigned(count, 25));
+        s_axi_write(axi_aclk, axi_slave, ADSR_STEAL_REG, msg);
+    end procedure;
+
+    procedure adsr_get_quietest_voice(signal axi_aclk  : in std_logic;
+                                      signal axi_slave : inout t_axi_slave;
+                                      variable valid   : out boolean;
+                                      variable voice   : out integer;
+                                      variable level   : out integer) is
+        variable data : std_logic_vector(31 downto 0);
+    begin
+        s_axi_read(axi_aclk, axi_slave, ADSR_STEAL_REG, data);
+        valid := data(24) = '1';
+        voice := to_integer(unsigned(data(31 downto 25)));
+        level := to_integer(unsigned(data(23 downto 0)));
+    end procedure;
+
+    procedure adsr_set_voice_freed_irq(signal axi_aclk  : in std_logic;
+                                       signal axi_slave : inout t_axi_slave;
+                                       constant enable  : in boolean) is
+        variable msg : std_logic_vector(31 downto 0) := (others => '0');
+    begin
+        if enable then
+            msg(0) := '1';
+        end if;
+        s_axi_write(axi_aclk, axi_slave, ADSR_FREED_IRQ_EN_REG, msg);
+    end procedure;
+
+    procedure adsr_get_freed_voices(signal axi_aclk  : in std_logic;
+                                    signal axi_slave : inout t_axi_slave;
+                                    constant word    : in integer;
+                                    variable freed   : out std_logic_vector(31 downto 0)) is
+    begin
+        s_axi_read(axi_aclk, axi_slave, ADSR_FREED_REG+word, freed);
+    end procedure;
+
     ------------------ FILTER MODULE FUNCTIONS ------------------ 
 
     procedure filter_set_cutoff_frequency(signal axi_aclk : in std_logic;
@@ -323,7 +551,7 @@ package body synth_module_sim_package is
         variable cutoff_freq : integer;
         variable msg : std_logic_vector(31 downto 0); 
     begin
-        cutoff_freq := integer(freq * 32768.0/96000.0*2.0*MATH_PI);
+        cutoff_freq := integer(freq * 32768.0/AUDIO_FREQUENCY*2.0*MATH_PI);
         msg := std_logic_vector(to_unsigned(cutoff_freq, 32));
         s_axi_write(axi_aclk, axi_slave, FILTER_CUTOFF_FREQUENCY_REG, msg);
     end procedure;
@@ -357,47 +585,92 @@ package body synth_module_sim_package is
         s_axi_write(axi_aclk, axi_slave, FILTER_ATTENUATION_REG, msg);
     end procedure;
 
+    procedure filter_set_voice_cutoff_offset(signal axi_aclk  : in std_logic;
+                                             signal axi_slave : inout t_axi_slave;
+                                             constant voice   : in integer;
+                                             constant freq    : in real) is
+        variable offset : integer;
+        variable msg : std_logic_vector(31 downto 0); 
+    begin
+        offset := integer(freq * 32768.0/AUDIO_FREQUENCY*2.0*MATH_PI);
+        msg := std_logic_vector(to_unsigned(voice, 7)) & "0000000" & std_logic_vector(to_signed(offset, 18));
+        s_axi_write(axi_aclk, axi_slave, FILTER_CUTOFF_OFFSET_REG, msg);
+    end procedure;
+
+    procedure filter_set_voice_note(signal axi_aclk  : in std_logic;
+                                    signal axi_slave : inout t_axi_slave;
+                                    constant voice   : in integer;
+                                    constant note    : in integer) is
+        variable msg : std_logic_vector(31 downto 0); 
+    begin
+        msg := std_logic_vector(to_unsigned(voice*2**25 + note, 32));
+        s_axi_write(axi_aclk, axi_slave, FILTER_KEY_NOTE_REG, msg);
+    end procedure;
+
+    procedure filter_set_key_tracking(signal axi_aclk  : in std_logic;
+                                      signal axi_slave : inout t_axi_slave;
+                                      constant amount  : in real) is
+        variable msg : std_logic_vector(31 downto 0); 
+    begin
+        msg := std_logic_vector(to_unsigned(integer(amount * 2.0**15.0), 32));
+        s_axi_write(axi_aclk, axi_slave, FILTER_KEY_TRACKING_REG, msg);
+    end procedure;
+    
+    procedure filter_set_oversampling(signal axi_aclk  : in std_logic;
+                                      signal axi_slave : inout t_axi_slave;
+                                      constant enable  : in integer) is
+        variable msg : std_logic_vector(31 downto 0); 
+    begin
+        msg := std_logic_vector(to_unsigned(enable, 32));
+        s_axi_write(axi_aclk, axi_slave, FILTER_OVERSAMPLE_REG, msg);
+    end procedure;
+
 
     procedure lfo_set_voice_on(signal axi_aclk  : in std_logic;
                                signal axi_slave : inout t_axi_slave;
-                               constant voice   : in integer) is
+                               constant voice   : in integer;
+                               constant lfo      : in integer := 0) is
         variable msg : std_logic_vector(31 downto 0); 
     begin
         msg := std_logic_vector(to_unsigned(1*2**8+1*2**7+voice, 32));
-        s_axi_write(axi_aclk, axi_slave, LFO_VOICE_ON_OFF_REG, msg);
+        s_axi_write(axi_aclk, axi_slave, lfo*LFO_BANK_REGS+LFO_VOICE_ON_OFF_REG, msg);
     end procedure;
 
     procedure lfo_set_voice_off(signal axi_aclk  : in std_logic;
                                 signal axi_slave : inout t_axi_slave;
-                                constant voice   : in integer) is
+                                constant voice   : in integer;
+                                constant lfo      : in integer := 0) is
         variable msg : std_logic_vector(31 downto 0); 
     begin
         msg := std_logic_vector(to_unsigned(1*2**7+voice, 32));
-        s_axi_write(axi_aclk, axi_slave, LFO_VOICE_ON_OFF_REG, msg);
+        s_axi_write(axi_aclk, axi_slave, lfo*LFO_BANK_REGS+LFO_VOICE_ON_OFF_REG, msg);
     end procedure;
 
     procedure lfo_set_rate(signal axi_aclk : in std_logic;
                                 signal axi_slave    : inout t_axi_slave;
-                                constant period   : in real) is 
+                                constant period   : in real;
+                                constant lfo      : in integer := 0) is 
         variable msg : std_logic_vector(31 downto 0); 
     begin
         msg := std_logic_vector(to_unsigned(integer((2.0**24.0-1.0)/AUDIO_FREQUENCY/period), 32));
-        s_axi_write(axi_aclk, axi_slave, LFO_RATE_REG, msg);
+        s_axi_write(axi_aclk, axi_slave, lfo*LFO_BANK_REGS+LFO_RATE_REG, msg);
     end procedure;   
                                 
     
     procedure lfo_set_amount(signal axi_aclk   : in std_logic;
                                  signal axi_slave      : inout t_axi_slave;
-                                 constant amp      : in real) is
+                                 constant amp      : in real;
+                                 constant lfo      : in integer := 0) is
         variable msg : std_logic_vector(31 downto 0); 
     begin
         msg := std_logic_vector(to_unsigned(integer(amp * 2.0**15.0), 32));
-        s_axi_write(axi_aclk, axi_slave, LFO_AMOUNT_REG, msg);
+        s_axi_write(axi_aclk, axi_slave, lfo*LFO_BANK_REGS+LFO_AMOUNT_REG, msg);
     end procedure;                                     
                                  
     procedure lfo_set_waveform(signal axi_aclk   : in std_logic;
                                 signal axi_slave      : inout t_axi_slave;
-                                constant wavetype : in t_wavetype) is
+                                constant wavetype : in t_wavetype;
+                                constant lfo      : in integer := 0) is
         variable wave : integer;
         variable msg : std_logic_vector(31 downto 0);                            
     begin
@@ -410,18 +683,163 @@ package body synth_module_sim_package is
         end case;
 
         msg := std_logic_vector(to_unsigned(wave, 32));
-        s_axi_write(axi_aclk, axi_slave, LFO_WAVEFORM_REG, msg);
+        s_axi_write(axi_aclk, axi_slave, lfo*LFO_BANK_REGS+LFO_WAVEFORM_REG, msg);
     end procedure;  
     
     procedure lfo_enable_polyphony(signal axi_aclk   : in std_logic;
                                 signal axi_slave      : inout t_axi_slave;
-                                constant enable : in std_logic) is
+                                constant enable : in std_logic;
+                                constant lfo      : in integer := 0) is
         variable msg : std_logic_vector(31 downto 0);                            
     begin
         msg(0) := enable;
         msg(31 downto 1) := (others => '0'); 
-        s_axi_write(axi_aclk, axi_slave, LFO_POLYPHONY_ENABLE_REG, msg);
+        s_axi_write(axi_aclk, axi_slave, lfo*LFO_BANK_REGS+LFO_POLYPHONY_ENABLE_REG, msg);
     end procedure;                              
+
+    ------------------ MIXER MODULE FUNCTIONS ------------------ 
+    -- pan from -1.0 (left) to 1.0 (right)
+    ------------------ MODULATION MATRIX FUNCTIONS ------------------
+    procedure mod_matrix_set_amount(signal axi_aclk    : in std_logic;
+                                    signal axi_slave   : inout t_axi_slave;
+                                    constant dest      : in integer;
+                                    constant source    : in integer;
+                                    constant amount    : in real) is
+        variable msg : std_logic_vector(31 downto 0);
+    begin
+        msg := std_logic_vector(to_signed(integer(amount * 2.0**15.0), 32));
+        s_axi_write(axi_aclk, axi_slave, dest*MOD_MATRIX_BANK_REGS+source, msg);
+    end procedure;
+
+    procedure mixer_set_voice_pan(signal axi_aclk  : in std_logic;
+                                  signal axi_slave : inout t_axi_slave;
+                                  constant voice   : in integer;
+                                  constant pan     : in real) is
+        variable msg : std_logic_vector(31 downto 0); 
+    begin
+        msg := std_logic_vector(to_unsigned(voice*2**25 + integer(round((pan + 1.0) * 128.0)), 32));
+        s_axi_write(axi_aclk, axi_slave, MIXER_PAN_REG, msg);
+    end procedure;
+
+    ------------------ EFFECTS MODULE FUNCTIONS ------------------ 
+    -- delay in frames, levels in [-1.0, 1.0)
+    procedure effects_set_tap(signal axi_aclk   : in std_logic;
+                              signal axi_slave  : inout t_axi_slave;
+                              constant tap      : in integer;
+                              constant delay    : in integer;
+                              constant level    : in real;
+                              constant feedback : in real) is
+    begin
+        s_axi_write(axi_aclk, axi_slave, tap*EFFECTS_TAP_BANK_REGS+EFFECTS_TAP_DELAY_REG,
+                    std_logic_vector(to_unsigned(delay, 32)));
+        s_axi_write(axi_aclk, axi_slave, tap*EFFECTS_TAP_BANK_REGS+EFFECTS_TAP_LEVEL_REG,
+                    x"0000" & std_logic_vector(to_signed(integer(level * 2.0**15.0), 16)));
+        s_axi_write(axi_aclk, axi_slave, tap*EFFECTS_TAP_BANK_REGS+EFFECTS_TAP_FEEDBACK_REG,
+                    x"0000" & std_logic_vector(to_signed(integer(feedback * 2.0**15.0), 16)));
+    end procedure;
+
+    ------------------ REGISTER SCRIPT ------------------
+    -- the next blank separated word of a line, length 0 at the end of the line
+    procedure read_word(variable l      : inout line;
+                        variable word   : out string;
+                        variable length : out integer) is
+        variable c : character;
+        variable n : integer := 0;
+    begin
+        while l'length > 0 and (l(l'left) = ' ' or l(l'left) = HT or l(l'left) = CR) loop
+            read(l, c);
+        end loop;
+        while l'length > 0 and l(l'left) /= ' ' and l(l'left) /= HT and l(l'left) /= CR loop
+            read(l, c);
+            if n < word'length then
+                word(word'left + n) := c;
+                n := n + 1;
+            end if;
+        end loop;
+        length := n;
+    end procedure;
+
+    function hex_to_slv(word : string) return std_logic_vector is
+        variable value : unsigned(31 downto 0) := (others => '0');
+        variable digit : integer := 0;
+    begin
+        for i in word'range loop
+            case word(i) is
+                when '0' to '9' => digit := character'pos(word(i)) - character'pos('0');
+                when 'a' to 'f' => digit := character'pos(word(i)) - character'pos('a') + 10;
+                when 'A' to 'F' => digit := character'pos(word(i)) - character'pos('A') + 10;
+                when others     => report "register script: " & word & " is not hex" severity failure;
+            end case;
+            value := shift_left(value, 4) or to_unsigned(digit, 32);
+        end loop;
+        return std_logic_vector(value);
+    end function;
+
+    procedure run_register_script(signal axi_aclk      : in std_logic;
+                                  signal enable        : out std_logic;
+                                  signal axi_osc       : inout t_axi_slave;
+                                  signal axi_adsr      : inout t_axi_slave;
+                                  signal axi_filter    : inout t_axi_slave;
+                                  constant sample_cycles : in integer;
+                                  constant path        : in string) is
+        file     v_script        : text open read_mode is path;
+        variable v_line          : line;
+        variable v_word          : string(1 to 16);
+        variable v_length        : integer;
+        variable v_module        : string(1 to 16);
+        variable v_module_length : integer := 0;
+        variable v_period        : integer := 0;       -- sample periods started
+        variable v_have          : boolean := false;   -- the next write is read
+        variable v_due           : integer := 0;       -- sample period of the next write
+        variable v_reg           : integer := 0;
+        variable v_data          : std_logic_vector(31 downto 0) := (others => '0');
+    begin
+        enable <= '0';
+        loop
+            for i in 1 to sample_cycles-1 loop
+                wait until rising_edge(axi_aclk);
+            end loop;
+
+            -- the writes due before this sample period
+            loop
+                while not v_have and not endfile(v_script) loop
+                    readline(v_script, v_line);
+                    read_word(v_line, v_word, v_length);
+                    if v_length > 0 and v_word(1) /= '#' then
+                        v_due := integer'value(v_word(1 to v_length));
+                        read_word(v_line, v_module, v_module_length);
+                        if v_module(1 to v_module_length) /= "end" then
+                            read_word(v_line, v_word, v_length);
+                            v_reg := integer'value(v_word(1 to v_length));
+                            read_word(v_line, v_word, v_length);
+                            v_data := hex_to_slv(v_word(1 to v_length));
+                        end if;
+                        v_have := true;
+                    end if;
+                end loop;
+                assert v_have report path & ": no end line" severity failure;
+                exit when v_due > v_period;
+
+                if v_module(1 to v_module_length) = "end" then
+                    return;
+                elsif v_module(1 to v_module_length) = "osc" then
+                    s_axi_write(axi_aclk, axi_osc, v_reg, v_data);
+                elsif v_module(1 to v_module_length) = "adsr" then
+                    s_axi_write(axi_aclk, axi_adsr, v_reg, v_data);
+                elsif v_module(1 to v_module_length) = "filter" then
+                    s_axi_write(axi_aclk, axi_filter, v_reg, v_data);
+                else
+                    report path & ": unknown module " & v_module(1 to v_module_length) severity failure;
+                end if;
+                v_have := false;
+            end loop;
+
+            enable <= '1';
+            wait until rising_edge(axi_aclk);
+            enable <= '0';
+            v_period := v_period + 1;
+        end loop;
+    end procedure;
                                                                
                               
 
@@ -7,6 +7,11 @@ use work.axi_sim_package.all;
 use work.synth_module_sim_package.all;
 
 entity tb_adsr_module is
+    generic(
+        g_NUM_CHANNELS  : integer := 2;
+        g_SAMPLE_CYCLES : integer := 21;   -- clocks from one i_en to the next
+        g_CYCLE_BUDGET  : integer := 0     -- clocks per sample period the modules must meet, 0 does not check
+    );
 end tb_adsr_module;
 
 architecture tb of tb_adsr_module is
@@ -16,7 +21,7 @@ architecture tb of tb_adsr_module is
     signal finished : std_logic := '0';
     
     -- constants
-    constant C_NUM_CHANNELS    : integer := 2;
+    constant C_NUM_CHANNELS    : integer := g_NUM_CHANNELS;
     constant C_DATA_WIDTH      : integer := 24;
     
     -- types 
@@ -32,6 +37,8 @@ architecture tb of tb_adsr_module is
     signal s_axi_ctrl : t_axi_slave := C_INIT_AXI_SLAVE;
     
     signal m_axis_output : t_axi_stream_slave;
+    
+    signal voice_freed_irq : std_logic;
           
 begin
     
@@ -43,7 +50,7 @@ begin
     process
     begin
         enable <= '0';
-        for i in 0 to 19 loop
+        for i in 0 to g_SAMPLE_CYCLES-2 loop
             wait until rising_edge(axi_aclk);
         end loop;
         enable <= '1';
@@ -52,11 +59,16 @@ begin
     
     -- main process
     process
+        variable valid : boolean;
+        variable voice : integer;
+        variable level : integer;
+        variable freed : std_logic_vector(127 downto 0);
     begin
         adsr_set_sustain_level(axi_aclk, s_axi_ctrl, 0.8);
         adsr_set_attack_time(axi_aclk, s_axi_ctrl, 0.01);
         adsr_set_decay_time(axi_aclk, s_axi_ctrl, 0.005);
         adsr_set_release_time(axi_aclk, s_axi_ctrl, 0.02);
+        adsr_set_voice_freed_irq(axi_aclk, s_axi_ctrl, true);
 
         adsr_set_voice_on(axi_aclk, s_axi_ctrl, 0);
 
@@ -64,12 +76,50 @@ begin
             wait until rising_edge(enable);
         end loop; 
         
+        -- voice 0 sustains and the last voice attacks, the quieter new note
+        -- ranks above the held one and is not the quietest
+        adsr_set_voice_on(axi_aclk, s_axi_ctrl, C_NUM_CHANNELS-1);
+        for i in 0 to 2 loop
+            wait until rising_edge(enable);
+        end loop;
+        adsr_get_quietest_voice(axi_aclk, s_axi_ctrl, valid, voice, level);
+        assert valid and voice = 0 and level > ADSR_MAX_CW_VALUE/2
+            report "quietest voice " & integer'image(voice) & " level " & integer'image(level) severity error;
+
+        -- a stolen voice fades out in 1 ms and restarts its attack as its note is on
+        adsr_steal_voices(axi_aclk, s_axi_ctrl, 0, 1);
+        for i in 0 to 100 loop
+            wait until rising_edge(enable);
+        end loop;
+        level := to_integer(signed(r_output_array(0)));
+        assert level > 0 and level < ADSR_MAX_CW_VALUE/10
+            report "stolen voice at " & integer'image(level) & ", not restarted" severity error;
+
+        -- the stolen voice was freed when its fade out reached off
+        assert voice_freed_irq = '1' report "no voice freed interrupt for the stolen voice" severity error;
+        for word in 0 to (C_NUM_CHANNELS-1)/32 loop
+            adsr_get_freed_voices(axi_aclk, s_axi_ctrl, word, freed(word*32+31 downto word*32));
+        end loop;
+        assert freed(0) = '1' report "stolen voice not freed" severity error;
+
+        adsr_set_voice_off(axi_aclk, s_axi_ctrl, C_NUM_CHANNELS-1);
         adsr_set_voice_off(axi_aclk, s_axi_ctrl, 0);
 
         for i in 0 to 2000 loop
             wait until rising_edge(enable);
         end loop;
 
+        -- both voices released to off, the read clears the interrupt
+        assert voice_freed_irq = '1' report "no voice freed interrupt" severity error;
+        for word in 0 to (C_NUM_CHANNELS-1)/32 loop
+            adsr_get_freed_voices(axi_aclk, s_axi_ctrl, word, freed(word*32+31 downto word*32));
+        end loop;
+        assert freed(0) = '1' and freed(C_NUM_CHANNELS-1) = '1' report "released voices not freed" severity error;
+        for i in 0 to 2 loop
+            wait until rising_edge(axi_aclk);
+        end loop;
+        assert voice_freed_irq = '0' report "voice freed interrupt not cleared by the read" severity error;
+
         finished <= '1';
     end process;
     
@@ -98,11 +148,12 @@ begin
         -- Users to add ports here
         i_enable                => enable,
         o_active_channel_count  => open,
+        o_voice_freed_irq       => voice_freed_irq,
 
         -- Ports of Axi Slave Bus Interface S_AXI_CTRL
         s_axi_ctrl_aclk	    => axi_aclk,
 		s_axi_ctrl_aresetn	=> axi_aresetn,
-		s_axi_ctrl_awaddr	=> s_axi_ctrl.awaddr,
+		s_axi_ctrl_awaddr	=> s_axi_ctrl.awaddr(6 downto 0),
 		s_axi_ctrl_awprot	=> (others => '0'),
 		s_axi_ctrl_awvalid	=> s_axi_ctrl.awvalid,
 		s_axi_ctrl_awready	=> s_axi_ctrl.awready,
@@ -113,7 +164,7 @@ begin
 		s_axi_ctrl_bresp	=> open,
 		s_axi_ctrl_bvalid	=> s_axi_ctrl.bvalid,
 		s_axi_ctrl_bready	=> s_axi_ctrl.bready,
-		s_axi_ctrl_araddr	=> s_axi_ctrl.araddr,
+		s_axi_ctrl_araddr	=> s_axi_ctrl.araddr(6 downto 0),
 		s_axi_ctrl_arprot	=> (others => '0'),
 		s_axi_ctrl_arvalid	=> s_axi_ctrl.arvalid,
 		s_axi_ctrl_arready	=> s_axi_ctrl.arready,
@@ -122,6 +173,45 @@ begin
 		s_axi_ctrl_rvalid	=> s_axi_ctrl.rvalid,
 		s_axi_ctrl_rready	=> s_axi_ctrl.rready,
 
+		-- Ports of Axi Slave Bus Interface S_AXI_PARAM
+		s_axi_param_aclk	=> axi_aclk,
+		s_axi_param_aresetn	=> axi_aresetn,
+		s_axi_param_awid	=> (others => '0'),
+		s_axi_param_awaddr	=> (others => '0'),
+		s_axi_param_awlen	=> (others => '0'),
+		s_axi_param_awsize	=> (others => '0'),
+		s_axi_param_awburst	=> (others => '0'),
+		s_axi_param_awlock	=> '0',
+		s_axi_param_awcache	=> (others => '0'),
+		s_axi_param_awprot	=> (others => '0'),
+		s_axi_param_awvalid	=> '0',
+		s_axi_param_awready	=> open,
+		s_axi_param_wdata	=> (others => '0'),
+		s_axi_param_wstrb	=> (others => '1'),
+		s_axi_param_wlast	=> '0',
+		s_axi_param_wvalid	=> '0',
+		s_axi_param_wready	=> open,
+		s_axi_param_bid	=> open,
+		s_axi_param_bresp	=> open,
+		s_axi_param_bvalid	=> open,
+		s_axi_param_bready	=> '0',
+		s_axi_param_arid	=> (others => '0'),
+		s_axi_param_araddr	=> (others => '0'),
+		s_axi_param_arlen	=> (others => '0'),
+		s_axi_param_arsize	=> (others => '0'),
+		s_axi_param_arburst	=> (others => '0'),
+		s_axi_param_arlock	=> '0',
+		s_axi_param_arcache	=> (others => '0'),
+		s_axi_param_arprot	=> (others => '0'),
+		s_axi_param_arvalid	=> '0',
+		s_axi_param_arready	=> open,
+		s_axi_param_rid	=> open,
+		s_axi_param_rdata	=> open,
+		s_axi_param_rresp	=> open,
+		s_axi_param_rlast	=> open,
+		s_axi_param_rvalid	=> open,
+		s_axi_param_rready	=> '0',
+
         -- Ports of Axi Master Bus Interface M_AXIS_OUTPUT
         m_axis_output_aclk	    => axi_aclk,
 		m_axis_output_aresetn	=> axi_aresetn,
@@ -132,5 +222,20 @@ begin
 		m_axis_output_tready	=> m_axis_output.tready
     );
 
+    -- clocks from i_en to the last channel out, checked against g_CYCLE_BUDGET
+    cycle_budget : if g_CYCLE_BUDGET > 0 generate
+        adsr_budget : entity work.cycle_budget_monitor
+        generic map(
+            g_NAME      => "adsr",
+            g_NUM_BEATS => C_NUM_CHANNELS,
+            g_BUDGET    => g_CYCLE_BUDGET
+        )
+        port map(
+            i_clk    => axi_aclk,
+            i_en     => enable,
+            i_tvalid => m_axis_output.tvalid,
+            i_tready => m_axis_output.tready
+        );
+    end generate;
 
-end tb;
\ No newline at end of file
+end tb;
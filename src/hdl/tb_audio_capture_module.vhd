@@ -0,0 +1,199 @@
+library ieee;
+use ieee.std_logic_1164.all;
+use ieee.numeric_std.all;
+
+use work.axi_sim_package.all;
+use work.synth_module_sim_package.all;
+use work.synth_config_package.all;
+
+entity tb_audio_capture_module is
+end tb_audio_capture_module;
+
+architecture tb of tb_audio_capture_module is
+
+    -- simulation variables
+    constant T : time := 10 ns;
+    signal finished : std_logic := '0';
+
+    -- capture constants
+    constant c_DATA_WIDTH    : integer := 24;
+    constant c_BUFFER_BASE   : integer := 16#10000000#;
+    constant c_BUFFER_WORDS  : integer := 64; -- four bursts
+    constant c_SAMPLE_PERIOD : integer := 20;
+    constant c_NUM_SAMPLES   : integer := 300;
+
+    -- signals
+    signal axi_aclk    : std_logic := '0';
+    signal axi_aresetn : std_logic;
+
+    signal r_sample_valid : std_logic := '0';
+    signal r_mix_sample   : std_logic_vector(c_DATA_WIDTH-1 downto 0) := (others => '0');
+    signal w_voice_select : std_logic_vector(c_CHANNEL_WIDTH-1 downto 0);
+
+    signal s_axi_capture_ctrl : t_axi_slave := C_INIT_AXI_SLAVE;
+
+    -- write master of the capture to the DDR model
+    signal m_axi_awaddr  : std_logic_vector(31 downto 0);
+    signal m_axi_awlen   : std_logic_vector(7 downto 0);
+    signal m_axi_awvalid : std_logic;
+    signal m_axi_awready : std_logic := '0';
+    signal m_axi_wdata   : std_logic_vector(31 downto 0);
+    signal m_axi_wlast   : std_logic;
+    signal m_axi_wvalid  : std_logic;
+    signal m_axi_wready  : std_logic := '0';
+    signal m_axi_bvalid  : std_logic := '0';
+    signal m_axi_bready  : std_logic;
+
+    type t_memory is array (0 to c_BUFFER_WORDS-1) of std_logic_vector(31 downto 0);
+    signal r_memory : t_memory := (others => (others => '0'));
+
+begin
+
+    -- generate clk and resetn
+    axi_aclk    <= not axi_aclk after T/2 when finished /= '1' else '0';
+    axi_aresetn <= '0', '1' after T;
+
+    -- mixer output, a ramp with one sample every c_SAMPLE_PERIOD clocks
+    process
+    begin
+        wait until axi_aresetn = '1';
+        loop
+            for i in 0 to c_SAMPLE_PERIOD-2 loop
+                wait until rising_edge(axi_aclk);
+            end loop;
+            r_sample_valid <= '1';
+            wait until rising_edge(axi_aclk);
+            r_sample_valid <= '0';
+            r_mix_sample   <= std_logic_vector(unsigned(r_mix_sample) + 1);
+        end loop;
+    end process;
+
+    -- DDR model, accepts one burst at a time with a wait state on every other beat
+    process
+        variable addr : integer;
+    begin
+        m_axi_awready <= '0';
+        m_axi_wready  <= '0';
+        m_axi_bvalid  <= '0';
+        wait until rising_edge(axi_aclk) and m_axi_awvalid = '1';
+        m_axi_awready <= '1';
+        addr := (to_integer(unsigned(m_axi_awaddr(27 downto 0))) / 4) mod c_BUFFER_WORDS;
+        assert unsigned(m_axi_awlen) = 15 report "unexpected burst length" severity error;
+        wait until rising_edge(axi_aclk);
+        m_axi_awready <= '0';
+        loop
+            m_axi_wready <= '1';
+            wait until rising_edge(axi_aclk) and m_axi_wvalid = '1';
+            r_memory(addr) <= m_axi_wdata;
+            addr := (addr + 1) mod c_BUFFER_WORDS;
+            m_axi_wready <= '0';
+            exit when m_axi_wlast = '1';
+            wait until rising_edge(axi_aclk);
+        end loop;
+        m_axi_bvalid <= '1';
+        wait until rising_edge(axi_aclk) and m_axi_bready = '1';
+        m_axi_bvalid <= '0';
+    end process;
+
+    -- main process, reads the buffer between the tail and the head as the firmware does
+    process
+        variable status   : std_logic_vector(31 downto 0);
+        variable head     : integer;
+        variable tail     : integer := 0;
+        variable expected : integer := -1;
+        variable count    : integer := 0;
+    begin
+        wait until axi_aresetn = '1';
+        s_axi_write(axi_aclk, s_axi_capture_ctrl, CAPTURE_BASE_REG, std_logic_vector(to_unsigned(c_BUFFER_BASE, 32)));
+        s_axi_write(axi_aclk, s_axi_capture_ctrl, CAPTURE_SIZE_REG, std_logic_vector(to_unsigned(c_BUFFER_WORDS*4, 32)));
+        s_axi_write(axi_aclk, s_axi_capture_ctrl, CAPTURE_TAIL_REG, (others => '0'));
+        s_axi_write(axi_aclk, s_axi_capture_ctrl, CAPTURE_CONTROL_REG, x"00000001"); -- enable, mix
+
+        while count < c_NUM_SAMPLES loop
+            s_axi_read(axi_aclk, s_axi_capture_ctrl, CAPTURE_HEAD_REG, status);
+            head := to_integer(unsigned(status));
+            while tail /= head loop
+                -- the first sample is the value of the ramp when the capture is enabled
+                if expected < 0 then
+                    expected := to_integer(signed(r_memory(tail/4)));
+                end if;
+                assert to_integer(signed(r_memory(tail/4))) = expected
+                    report "captured sample " & integer'image(to_integer(signed(r_memory(tail/4)))) &
+                           ", expected " & integer'image(expected)
+                    severity error;
+                expected := expected + 1;
+                count    := count + 1;
+                tail := (tail + 4) mod (c_BUFFER_WORDS*4);
+            end loop;
+            s_axi_write(axi_aclk, s_axi_capture_ctrl, CAPTURE_TAIL_REG, std_logic_vector(to_unsigned(tail, 32)));
+        end loop;
+
+        s_axi_read(axi_aclk, s_axi_capture_ctrl, CAPTURE_FIFO_ERROR_REG, status);
+        assert unsigned(status(15 downto 0)) = 0
+            report "capture FIFO overflow, samples dropped" severity error;
+        s_axi_read(axi_aclk, s_axi_capture_ctrl, CAPTURE_ERROR_REG, status);
+        assert unsigned(status) = 0
+            report "capture write errors" severity error;
+
+        s_axi_write(axi_aclk, s_axi_capture_ctrl, CAPTURE_CONTROL_REG, x"00000000");
+        finished <= '1';
+        wait;
+    end process;
+
+    -- instantiate audio capture module
+    audio_capture_module : entity work.Audio_Capture_v1_0
+    port map (
+        i_sample_valid  => r_sample_valid,
+        i_mix_sample    => r_mix_sample,
+        i_voice_sample  => (others => '0'),
+        o_voice_select  => w_voice_select,
+
+		-- Ports of Axi Slave Bus Interface S_AXI_CTRL
+		s_axi_ctrl_aclk	    => axi_aclk,
+		s_axi_ctrl_aresetn	=> axi_aresetn,
+		s_axi_ctrl_awaddr	=> s_axi_capture_ctrl.awaddr(5 downto 0),
+		s_axi_ctrl_awprot	=> (others => '0'),
+		s_axi_ctrl_awvalid	=> s_axi_capture_ctrl.awvalid,
+		s_axi_ctrl_awready	=> s_axi_capture_ctrl.awready,
+		s_axi_ctrl_wdata	=> s_axi_capture_ctrl.wdata,
+		s_axi_ctrl_wstrb	=> (others => '1'),
+		s_axi_ctrl_wvalid	=> s_axi_capture_ctrl.wvalid,
+		s_axi_ctrl_wready	=> s_axi_capture_ctrl.wready,
+		s_axi_ctrl_bresp	=> open,
+		s_axi_ctrl_bvalid	=> s_axi_capture_ctrl.bvalid,
+		s_axi_ctrl_bready	=> s_axi_capture_ctrl.bready,
+		s_axi_ctrl_araddr	=> s_axi_capture_ctrl.araddr(5 downto 0),
+		s_axi_ctrl_arprot	=> (others => '0'),
+		s_axi_ctrl_arvalid	=> s_axi_capture_ctrl.arvalid,
+		s_axi_ctrl_arready	=> s_axi_capture_ctrl.arready,
+		s_axi_ctrl_rdata	=> s_axi_capture_ctrl.rdata,
+		s_axi_ctrl_rresp	=> open,
+		s_axi_ctrl_rvalid	=> s_axi_capture_ctrl.rvalid,
+		s_axi_ctrl_rready	=> s_axi_capture_ctrl.rready,
+
+		-- Ports of Axi Master Bus Interface M_AXI
+		m_axi_aclk	    => axi_aclk,
+		m_axi_aresetn	=> axi_aresetn,
+		m_axi_awid	    => open,
+		m_axi_awaddr	=> m_axi_awaddr,
+		m_axi_awlen	    => m_axi_awlen,
+		m_axi_awsize	=> open,
+		m_axi_awburst	=> open,
+		m_axi_awlock	=> open,
+		m_axi_awcache	=> open,
+		m_axi_awprot	=> open,
+		m_axi_awqos	    => open,
+		m_axi_awvalid	=> m_axi_awvalid,
+		m_axi_awready	=> m_axi_awready,
+		m_axi_wdata	    => m_axi_wdata,
+		m_axi_wstrb	    => open,
+		m_axi_wlast	    => m_axi_wlast,
+		m_axi_wvalid	=> m_axi_wvalid,
+		m_axi_wready	=> m_axi_wready,
+		m_axi_bid	    => (others => '0'),
+		m_axi_bresp	    => "00",
+		m_axi_bvalid	=> m_axi_bvalid,
+		m_axi_bready	=> m_axi_bready
+    );
+
+end tb;
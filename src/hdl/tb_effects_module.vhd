@@ -0,0 +1,286 @@
+library ieee;
+use ieee.std_logic_1164.all;
+use ieee.numeric_std.all;
+
+use work.axi_sim_package.all;
+use work.synth_module_sim_package.all;
+
+entity tb_effects_module is
+end tb_effects_module;
+
+architecture tb of tb_effects_module is
+
+    -- simulation variables
+    constant T : time := 10 ns;
+    signal finished : std_logic := '0';
+
+    -- effects constants
+    constant c_DATA_WIDTH    : integer := 24;
+    constant c_BUFFER_BASE   : integer := 16#10000000#;
+    constant c_BUFFER_FRAMES : integer := 512;
+    constant c_SAMPLE_PERIOD : integer := 64;
+    constant c_NUM_FRAMES    : integer := 260;
+    constant c_IMPULSE_FRAME : integer := 10;
+    constant c_IMPULSE       : integer := 2**20;
+    constant c_ECHO_DELAY    : integer := 96;  -- tap 0, heard
+    constant c_REPEAT_DELAY  : integer := 128; -- tap 1, fed back into the line
+
+    -- signals
+    signal axi_aclk    : std_logic := '0';
+    signal axi_aresetn : std_logic;
+
+    signal r_sample_valid : std_logic := '0';
+    signal r_left         : std_logic_vector(c_DATA_WIDTH-1 downto 0) := (others => '0');
+    signal r_right        : std_logic_vector(c_DATA_WIDTH-1 downto 0) := (others => '0');
+    signal w_left         : std_logic_vector(c_DATA_WIDTH-1 downto 0);
+    signal w_right        : std_logic_vector(c_DATA_WIDTH-1 downto 0);
+
+    signal s_axi_effects_ctrl : t_axi_slave := C_INIT_AXI_SLAVE;
+
+    -- write and read master of the effects to the DDR model
+    signal m_axi_awaddr  : std_logic_vector(31 downto 0);
+    signal m_axi_awlen   : std_logic_vector(7 downto 0);
+    signal m_axi_awvalid : std_logic;
+    signal m_axi_awready : std_logic := '0';
+    signal m_axi_wdata   : std_logic_vector(31 downto 0);
+    signal m_axi_wlast   : std_logic;
+    signal m_axi_wvalid  : std_logic;
+    signal m_axi_wready  : std_logic := '0';
+    signal m_axi_bvalid  : std_logic := '0';
+    signal m_axi_bready  : std_logic;
+    signal m_axi_araddr  : std_logic_vector(31 downto 0);
+    signal m_axi_arlen   : std_logic_vector(7 downto 0);
+    signal m_axi_arvalid : std_logic;
+    signal m_axi_arready : std_logic := '0';
+    signal m_axi_rdata   : std_logic_vector(31 downto 0) := (others => '0');
+    signal m_axi_rlast   : std_logic := '0';
+    signal m_axi_rvalid  : std_logic := '0';
+    signal m_axi_rready  : std_logic;
+
+    type t_memory is array (0 to c_BUFFER_FRAMES*2-1) of std_logic_vector(31 downto 0);
+    signal r_memory : t_memory := (others => (others => '0'));
+
+    type t_output is array (0 to c_NUM_FRAMES-1) of integer;
+
+begin
+
+    -- generate clk and resetn
+    axi_aclk    <= not axi_aclk after T/2 when finished /= '1' else '0';
+    axi_aresetn <= '0', '1' after T;
+
+    -- DDR model write channel, accepts one burst at a time with a wait state on every other beat
+    process
+        variable addr : integer;
+    begin
+        m_axi_awready <= '0';
+        m_axi_wready  <= '0';
+        m_axi_bvalid  <= '0';
+        wait until rising_edge(axi_aclk) and m_axi_awvalid = '1';
+        m_axi_awready <= '1';
+        addr := (to_integer(unsigned(m_axi_awaddr(27 downto 0))) / 4) mod (c_BUFFER_FRAMES*2);
+        assert unsigned(m_axi_awlen) = 15 report "unexpected write burst length" severity error;
+        wait until rising_edge(axi_aclk);
+        m_axi_awready <= '0';
+        loop
+            m_axi_wready <= '1';
+            wait until rising_edge(axi_aclk) and m_axi_wvalid = '1';
+            r_memory(addr) <= m_axi_wdata;
+            addr := (addr + 1) mod (c_BUFFER_FRAMES*2);
+            m_axi_wready <= '0';
+            exit when m_axi_wlast = '1';
+            wait until rising_edge(axi_aclk);
+        end loop;
+        m_axi_bvalid <= '1';
+        wait until rising_edge(axi_aclk) and m_axi_bready = '1';
+        m_axi_bvalid <= '0';
+    end process;
+
+    -- DDR model read channel, one burst at a time after a fixed latency
+    process
+        variable addr : integer;
+    begin
+        m_axi_arready <= '0';
+        m_axi_rvalid  <= '0';
+        m_axi_rlast   <= '0';
+        wait until rising_edge(axi_aclk) and m_axi_arvalid = '1';
+        m_axi_arready <= '1';
+        addr := (to_integer(unsigned(m_axi_araddr(27 downto 0))) / 4) mod (c_BUFFER_FRAMES*2);
+        assert unsigned(m_axi_arlen) = 15 report "unexpected read burst length" severity error;
+        wait until rising_edge(axi_aclk);
+        m_axi_arready <= '0';
+        for i in 0 to 7 loop
+            wait until rising_edge(axi_aclk);
+        end loop;
+        for i in 0 to 15 loop
+            m_axi_rvalid <= '1';
+            m_axi_rdata  <= r_memory(addr);
+            if i = 15 then
+                m_axi_rlast <= '1';
+            end if;
+            wait until rising_edge(axi_aclk) and m_axi_rready = '1';
+            addr := (addr + 1) mod (c_BUFFER_FRAMES*2);
+        end loop;
+    end process;
+
+    -- main process, one frame every c_SAMPLE_PERIOD clocks, the output is sampled
+    -- before each frame so output(i) is the output of frame i-1
+    process
+        variable status       : std_logic_vector(31 downto 0);
+        variable left_output  : t_output;
+        variable right_output : t_output;
+        variable expected     : integer;
+    begin
+        wait until axi_aresetn = '1';
+
+        -- bypassed while disabled
+        r_left  <= std_logic_vector(to_signed(12345, c_DATA_WIDTH));
+        r_right <= std_logic_vector(to_signed(-54321, c_DATA_WIDTH));
+        r_sample_valid <= '1';
+        wait until rising_edge(axi_aclk);
+        r_sample_valid <= '0';
+        wait until rising_edge(axi_aclk);
+        assert signed(w_left) = 12345 and signed(w_right) = -54321
+            report "input not bypassed while disabled" severity error;
+
+        -- tap 0 is an echo, tap 1 feeds the line back so the echo repeats at half the level
+        s_axi_write(axi_aclk, s_axi_effects_ctrl, EFFECTS_BASE_REG, std_logic_vector(to_unsigned(c_BUFFER_BASE, 32)));
+        s_axi_write(axi_aclk, s_axi_effects_ctrl, EFFECTS_SIZE_REG, std_logic_vector(to_unsigned(c_BUFFER_FRAMES*8, 32)));
+        effects_set_tap(axi_aclk, s_axi_effects_ctrl, 0, c_ECHO_DELAY, 0.5, 0.0);
+        effects_set_tap(axi_aclk, s_axi_effects_ctrl, 1, c_REPEAT_DELAY, 0.0, 0.5);
+        effects_set_tap(axi_aclk, s_axi_effects_ctrl, 2, 160, 0.0, 0.0);
+        effects_set_tap(axi_aclk, s_axi_effects_ctrl, 3, 200, 0.0, 0.0);
+        s_axi_write(axi_aclk, s_axi_effects_ctrl, EFFECTS_CONTROL_REG, x"00000001");
+
+        -- let the taps prefetch before the first frame
+        for i in 0 to 499 loop
+            wait until rising_edge(axi_aclk);
+        end loop;
+
+        for frame in 0 to c_NUM_FRAMES-1 loop
+            left_output(frame)  := to_integer(signed(w_left));
+            right_output(frame) := to_integer(signed(w_right));
+            if frame = c_IMPULSE_FRAME then
+                r_left  <= std_logic_vector(to_signed(c_IMPULSE, c_DATA_WIDTH));
+                r_right <= std_logic_vector(to_signed(-c_IMPULSE, c_DATA_WIDTH));
+            else
+                r_left  <= (others => '0');
+                r_right <= (others => '0');
+            end if;
+            r_sample_valid <= '1';
+            wait until rising_edge(axi_aclk);
+            r_sample_valid <= '0';
+            for i in 0 to c_SAMPLE_PERIOD-2 loop
+                wait until rising_edge(axi_aclk);
+            end loop;
+        end loop;
+
+        -- dry impulse at the default dry level of 0x7FFF, then the echo and its repeat
+        for frame in 1 to c_NUM_FRAMES-1 loop
+            if frame = c_IMPULSE_FRAME+1 then
+                expected := c_IMPULSE - c_IMPULSE/2**15;
+            elsif frame = c_IMPULSE_FRAME+1+c_ECHO_DELAY then
+                expected := c_IMPULSE/2;
+            elsif frame = c_IMPULSE_FRAME+1+c_REPEAT_DELAY+c_ECHO_DELAY then
+                expected := c_IMPULSE/4;
+            else
+                expected := 0;
+            end if;
+            assert left_output(frame) = expected and right_output(frame) = -expected
+                report "frame " & integer'image(frame-1) & " output " & integer'image(left_output(frame)) &
+                       " " & integer'image(right_output(frame)) & ", expected " & integer'image(expected)
+                severity error;
+        end loop;
+
+        s_axi_read(axi_aclk, s_axi_effects_ctrl, EFFECTS_FLOW_STATUS_REG, status);
+        assert unsigned(status) = 0
+            report "effects overflow or tap underrun" severity error;
+        s_axi_read(axi_aclk, s_axi_effects_ctrl, EFFECTS_ERROR_REG, status);
+        assert unsigned(status) = 0
+            report "effects burst errors" severity error;
+        s_axi_read(axi_aclk, s_axi_effects_ctrl, EFFECTS_WRITE_BURST_REG, status);
+        assert unsigned(status) = c_NUM_FRAMES/8
+            report "effects write bursts " & integer'image(to_integer(unsigned(status))) severity error;
+        s_axi_read(axi_aclk, s_axi_effects_ctrl, EFFECTS_READ_BURST_REG, status);
+        assert unsigned(status) >= 4*c_NUM_FRAMES/8
+            report "effects read bursts " & integer'image(to_integer(unsigned(status))) severity error;
+
+        s_axi_write(axi_aclk, s_axi_effects_ctrl, EFFECTS_CONTROL_REG, x"00000000");
+        finished <= '1';
+        wait;
+    end process;
+
+    -- instantiate effects module
+    effects_module : entity work.Effects_v1_0
+    port map (
+        i_sample_valid  => r_sample_valid,
+        i_left          => r_left,
+        i_right         => r_right,
+        o_left          => w_left,
+        o_right         => w_right,
+
+		-- Ports of Axi Slave Bus Interface S_AXI_CTRL
+		s_axi_ctrl_aclk	    => axi_aclk,
+		s_axi_ctrl_aresetn	=> axi_aresetn,
+		s_axi_ctrl_awaddr	=> s_axi_effects_ctrl.awaddr(7 downto 0),
+		s_axi_ctrl_awprot	=> (others => '0'),
+		s_axi_ctrl_awvalid	=> s_axi_effects_ctrl.awvalid,
+		s_axi_ctrl_awready	=> s_axi_effects_ctrl.awready,
+		s_axi_ctrl_wdata	=> s_axi_effects_ctrl.wdata,
+		s_axi_ctrl_wstrb	=> (others => '1'),
+		s_axi_ctrl_wvalid	=> s_axi_effects_ctrl.wvalid,
+		s_axi_ctrl_wready	=> s_axi_effects_ctrl.wready,
+		s_axi_ctrl_bresp	=> open,
+		s_axi_ctrl_bvalid	=> s_axi_effects_ctrl.bvalid,
+		s_axi_ctrl_bready	=> s_axi_effects_ctrl.bready,
+		s_axi_ctrl_araddr	=> s_axi_effects_ctrl.araddr(7 downto 0),
+		s_axi_ctrl_arprot	=> (others => '0'),
+		s_axi_ctrl_arvalid	=> s_axi_effects_ctrl.arvalid,
+		s_axi_ctrl_arready	=> s_axi_effects_ctrl.arready,
+		s_axi_ctrl_rdata	=> s_axi_effects_ctrl.rdata,
+		s_axi_ctrl_rresp	=> open,
+		s_axi_ctrl_rvalid	=> s_axi_effects_ctrl.rvalid,
+		s_axi_ctrl_rready	=> s_axi_effects_ctrl.rready,
+
+		-- Ports of Axi Master Bus Interface M_AXI
+		m_axi_aclk	    => axi_aclk,
+		m_axi_aresetn	=> axi_aresetn,
+		m_axi_awid	    => open,
+		m_axi_awaddr	=> m_axi_awaddr,
+		m_axi_awlen	    => m_axi_awlen,
+		m_axi_awsize	=> open,
+		m_axi_awburst	=> open,
+		m_axi_awlock	=> open,
+		m_axi_awcache	=> open,
+		m_axi_awprot	=> open,
+		m_axi_awqos	    => open,
+		m_axi_awvalid	=> m_axi_awvalid,
+		m_axi_awready	=> m_axi_awready,
+		m_axi_wdata	    => m_axi_wdata,
+		m_axi_wstrb	    => open,
+		m_axi_wlast	    => m_axi_wlast,
+		m_axi_wvalid	=> m_axi_wvalid,
+		m_axi_wready	=> m_axi_wready,
+		m_axi_bid	    => (others => '0'),
+		m_axi_bresp	    => "00",
+		m_axi_bvalid	=> m_axi_bvalid,
+		m_axi_bready	=> m_axi_bready,
+		m_axi_arid	    => open,
+		m_axi_araddr	=> m_axi_araddr,
+		m_axi_arlen	    => m_axi_arlen,
+		m_axi_arsize	=> open,
+		m_axi_arburst	=> open,
+		m_axi_arlock	=> open,
+		m_axi_arcache	=> open,
+		m_axi_arprot	=> open,
+		m_axi_arqos	    => open,
+		m_axi_arvalid	=> m_axi_arvalid,
+		m_axi_arready	=> m_axi_arready,
+		m_axi_rid	    => (others => '0'),
+		m_axi_rdata	    => m_axi_rdata,
+		m_axi_rresp	    => "00",
+		m_axi_rlast	    => m_axi_rlast,
+		m_axi_rvalid	=> m_axi_rvalid,
+		m_axi_rready	=> m_axi_rready
+    );
+
+end tb;
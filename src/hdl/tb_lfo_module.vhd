@@ -7,6 +7,11 @@ use work.axi_sim_package.all;
 use work.synth_module_sim_package.all;
 
 entity tb_lfo_module is
+    generic(
+        g_NUM_CHANNELS  : integer := 2;
+        g_SAMPLE_CYCLES : integer := 21;   -- clocks from one i_en to the next
+        g_CYCLE_BUDGET  : integer := 0     -- clocks per sample period the modules must meet, 0 does not check
+    );
 end tb_lfo_module;
 
 architecture tb of tb_lfo_module is
@@ -16,9 +21,10 @@ architecture tb of tb_lfo_module is
     signal finished : std_logic := '0';
     
     -- oscillator module constants
-    constant c_NUM_CHANNELS    : integer := 2;
+    constant c_NUM_CHANNELS    : integer := g_NUM_CHANNELS;
     constant c_NUM_OSCILLATORS : integer := 2;
     constant c_DATA_WIDTH      : integer := 24;
+    constant c_NUM_LFOS        : integer := 2;
     
     -- signals
     signal axi_aclk      : std_logic := '0';   
@@ -31,12 +37,15 @@ architecture tb of tb_lfo_module is
     signal r_lfo2_output_array : t_data_array := (others => (others => '0'));
     
     signal s_axi_osc_ctrl : t_axi_slave := C_INIT_AXI_SLAVE;
-    signal s_axi_lfo1_ctrl : t_axi_slave := C_INIT_AXI_SLAVE;
-    signal s_axi_lfo2_ctrl : t_axi_slave := C_INIT_AXI_SLAVE;
+    signal s_axi_lfo_ctrl : t_axi_slave := C_INIT_AXI_SLAVE;
     
     signal m_axis_osc_output : t_axi_stream_slave;
     signal m_axis_lfo1_output : t_axi_stream_slave;
     signal m_axis_lfo2_output : t_axi_stream_slave;
+
+    signal m_axis_lfo_tvalid : std_logic;
+    signal m_axis_lfo_tdata  : std_logic_vector(32*c_NUM_LFOS-1 downto 0);
+    signal m_axis_lfo_tready : std_logic;
           
 begin
     
@@ -48,7 +57,7 @@ begin
     process
     begin
         enable <= '0';
-        for i in 0 to 19 loop
+        for i in 0 to g_SAMPLE_CYCLES-2 loop
             wait until rising_edge(axi_aclk);
         end loop;
         enable <= '1';
@@ -66,23 +75,23 @@ begin
         osc_set_pulse_width(axi_aclk, s_axi_osc_ctrl, 0, 0.0);
         osc_pwm_enable(axi_aclk, s_axi_osc_ctrl, 0);
 
---        lfo_set_amount(axi_aclk, s_axi_lfo1_ctrl, 0.8);
---        lfo_set_rate(axi_aclk, s_axi_lfo1_ctrl, 0.02);
---        lfo_set_waveform(axi_aclk, s_axi_lfo1_ctrl, SAW);
---        lfo_set_voice_on(axi_aclk, s_axi_lfo1_ctrl, 0);
---        lfo_set_voice_on(axi_aclk, s_axi_lfo1_ctrl, 1);
+--        lfo_set_amount(axi_aclk, s_axi_lfo_ctrl, 0.8, 0);
+--        lfo_set_rate(axi_aclk, s_axi_lfo_ctrl, 0.02, 0);
+--        lfo_set_waveform(axi_aclk, s_axi_lfo_ctrl, SAW, 0);
+--        lfo_set_voice_on(axi_aclk, s_axi_lfo_ctrl, 0, 0);
+--        lfo_set_voice_on(axi_aclk, s_axi_lfo_ctrl, 1, 0);
         
-        lfo_set_amount(axi_aclk, s_axi_lfo2_ctrl, 0.8);
-        lfo_set_rate(axi_aclk, s_axi_lfo2_ctrl, 0.02);
-        lfo_set_waveform(axi_aclk, s_axi_lfo2_ctrl, TRIANGLE);
-        lfo_set_voice_on(axi_aclk, s_axi_lfo2_ctrl, 0);
-        lfo_enable_polyphony(axi_aclk, s_axi_lfo2_ctrl, '0');
+        lfo_set_amount(axi_aclk, s_axi_lfo_ctrl, 0.8, 1);
+        lfo_set_rate(axi_aclk, s_axi_lfo_ctrl, 0.02, 1);
+        lfo_set_waveform(axi_aclk, s_axi_lfo_ctrl, TRIANGLE, 1);
+        lfo_set_voice_on(axi_aclk, s_axi_lfo_ctrl, 0, 1);
+        lfo_enable_polyphony(axi_aclk, s_axi_lfo_ctrl, '0', 1);
         
         for i in 0 to 3000 loop
             wait until rising_edge(enable);
         end loop;     
         
-        lfo_set_voice_on(axi_aclk, s_axi_lfo2_ctrl, 1);
+        lfo_set_voice_on(axi_aclk, s_axi_lfo_ctrl, 1, 1);
         
         for i in 0 to 3000 loop
             wait until rising_edge(enable);
@@ -115,7 +124,10 @@ begin
         variable index : integer := 0;
     begin
         if rising_edge(axi_aclk) then
-            if m_axis_lfo1_output.tvalid = '1' then
+            if m_axis_lfo1_output.tvalid = '1' and m_axis_lfo1_output.tready = '1' then
+                -- no voices are on in LFO 0, its output must not pick up LFO 1
+                assert unsigned(m_axis_lfo1_output.tdata) = 0
+                    report "LFO 0 output with no voices on" severity error;
                 r_lfo1_output_array(index) <= m_axis_lfo1_output.tdata(r_lfo1_output_array(index)'range);
                 index := index + 1;
                 if index = c_NUM_CHANNELS then
@@ -130,7 +142,7 @@ begin
         variable index : integer := 0;
     begin
         if rising_edge(axi_aclk) then
-            if m_axis_lfo2_output.tvalid = '1' then
+            if m_axis_lfo2_output.tvalid = '1' and m_axis_lfo2_output.tready = '1' then
                 r_lfo2_output_array(index) <= m_axis_lfo2_output.tdata(r_lfo2_output_array(index)'range);
                 index := index + 1;
                 if index = c_NUM_CHANNELS then
@@ -156,10 +168,13 @@ begin
         end if;
     end process;
 
-    lfo_module1 : entity work.LFO_v1_0
+    -- both LFOs are computed by one module, LFO 0 in bits 31:0 and LFO 1 in bits 63:32
+    lfo_module : entity work.LFO_v1_0
         generic map(
             -- LFO parameters
-            g_NUM_CHANNELS => c_NUM_CHANNELS
+            g_NUM_CHANNELS => c_NUM_CHANNELS,
+            g_NUM_LFOS     => c_NUM_LFOS,
+            C_M_AXIS_OUTPUT_TDATA_WIDTH => 32*c_NUM_LFOS
         )
         port map(
             -- Module enable
@@ -168,17 +183,17 @@ begin
             -- Ports of Axi Slave Bus Interface S_AXI_CTRL
             s_axi_ctrl_aclk	    => axi_aclk,
             s_axi_ctrl_aresetn	=> axi_aresetn,
-            s_axi_ctrl_awaddr	=> s_axi_lfo1_ctrl.awaddr(4 downto 0),
+            s_axi_ctrl_awaddr	=> s_axi_lfo_ctrl.awaddr(6 downto 0),
             s_axi_ctrl_awprot	=> (others => '0'),
-            s_axi_ctrl_awvalid	=> s_axi_lfo1_ctrl.awvalid,
-            s_axi_ctrl_awready	=> s_axi_lfo1_ctrl.awready,
-            s_axi_ctrl_wdata	=> s_axi_lfo1_ctrl.wdata,
+            s_axi_ctrl_awvalid	=> s_axi_lfo_ctrl.awvalid,
+            s_axi_ctrl_awready	=> s_axi_lfo_ctrl.awready,
+            s_axi_ctrl_wdata	=> s_axi_lfo_ctrl.wdata,
             s_axi_ctrl_wstrb	=> (others => '1'),
-            s_axi_ctrl_wvalid	=> s_axi_lfo1_ctrl.wvalid,
-            s_axi_ctrl_wready	=> s_axi_lfo1_ctrl.wready,
+            s_axi_ctrl_wvalid	=> s_axi_lfo_ctrl.wvalid,
+            s_axi_ctrl_wready	=> s_axi_lfo_ctrl.wready,
             s_axi_ctrl_bresp	=> open,
-            s_axi_ctrl_bvalid	=> s_axi_lfo1_ctrl.bvalid,
-            s_axi_ctrl_bready	=> s_axi_lfo1_ctrl.bready,
+            s_axi_ctrl_bvalid	=> s_axi_lfo_ctrl.bvalid,
+            s_axi_ctrl_bready	=> s_axi_lfo_ctrl.bready,
             s_axi_ctrl_araddr	=> (others => '0'),
             s_axi_ctrl_arprot	=> (others => '0'),
             s_axi_ctrl_arvalid	=> '0',
@@ -191,54 +206,20 @@ begin
             -- Ports of Axi Master Bus Interface M_AXIS_OUTPUT
             m_axis_output_aclk	    => axi_aclk,
             m_axis_output_aresetn	=> axi_aresetn,
-            m_axis_output_tvalid	=> m_axis_lfo1_output.tvalid,
-            m_axis_output_tdata	    => m_axis_lfo1_output.tdata,
+            m_axis_output_tvalid	=> m_axis_lfo_tvalid,
+            m_axis_output_tdata	    => m_axis_lfo_tdata,
             m_axis_output_tstrb	    => open,
             m_axis_output_tlast	    => open,
-            m_axis_output_tready	=> m_axis_lfo1_output.tready
+            m_axis_output_tready	=> m_axis_lfo_tready
         );
-    
-    lfo_module2 : entity work.LFO_v1_0
-        generic map(
-            -- LFO parameters
-            g_NUM_CHANNELS => c_NUM_CHANNELS
-        )
-        port map(
-            -- Module enable
-            i_enable            => enable,
 
-            -- Ports of Axi Slave Bus Interface S_AXI_CTRL
-            s_axi_ctrl_aclk	    => axi_aclk,
-            s_axi_ctrl_aresetn	=> axi_aresetn,
-            s_axi_ctrl_awaddr	=> s_axi_lfo2_ctrl.awaddr(4 downto 0),
-            s_axi_ctrl_awprot	=> (others => '0'),
-            s_axi_ctrl_awvalid	=> s_axi_lfo2_ctrl.awvalid,
-            s_axi_ctrl_awready	=> s_axi_lfo2_ctrl.awready,
-            s_axi_ctrl_wdata	=> s_axi_lfo2_ctrl.wdata,
-            s_axi_ctrl_wstrb	=> (others => '1'),
-            s_axi_ctrl_wvalid	=> s_axi_lfo2_ctrl.wvalid,
-            s_axi_ctrl_wready	=> s_axi_lfo2_ctrl.wready,
-            s_axi_ctrl_bresp	=> open,
-            s_axi_ctrl_bvalid	=> s_axi_lfo2_ctrl.bvalid,
-            s_axi_ctrl_bready	=> s_axi_lfo2_ctrl.bready,
-            s_axi_ctrl_araddr	=> (others => '0'),
-            s_axi_ctrl_arprot	=> (others => '0'),
-            s_axi_ctrl_arvalid	=> '0',
-            s_axi_ctrl_arready	=> open,
-            s_axi_ctrl_rdata	=> open,
-            s_axi_ctrl_rresp	=> open,
-            s_axi_ctrl_rvalid	=> open,
-            s_axi_ctrl_rready	=> '0',
-    
-            -- Ports of Axi Master Bus Interface M_AXIS_OUTPUT
-            m_axis_output_aclk	    => axi_aclk,
-            m_axis_output_aresetn	=> axi_aresetn,
-            m_axis_output_tvalid	=> m_axis_lfo2_output.tvalid,
-            m_axis_output_tdata	    => m_axis_lfo2_output.tdata,
-            m_axis_output_tstrb	    => open,
-            m_axis_output_tlast	    => open,
-            m_axis_output_tready	=> m_axis_lfo2_output.tready
-        );
+    -- split the LFO stream as the axis_broadcaster does in the block design,
+    -- a sample is only taken when both destinations are ready
+    m_axis_lfo1_output.tdata  <= m_axis_lfo_tdata(31 downto 0);
+    m_axis_lfo2_output.tdata  <= m_axis_lfo_tdata(63 downto 32);
+    m_axis_lfo1_output.tvalid <= m_axis_lfo_tvalid and m_axis_lfo2_output.tready;
+    m_axis_lfo2_output.tvalid <= m_axis_lfo_tvalid and m_axis_lfo1_output.tready;
+    m_axis_lfo_tready <= m_axis_lfo1_output.tready and m_axis_lfo2_output.tready;
 
     -- instantiate oscillator module
     oscillator_module : entity work.Oscillator_v2_0
@@ -253,7 +234,7 @@ begin
 		-- Ports of Axi Slave Bus Interface S_AXI_CTRL
 		s_axi_ctrl_aclk	    => axi_aclk,
 		s_axi_ctrl_aresetn	=> axi_aresetn,
-		s_axi_ctrl_awaddr	=> s_axi_osc_ctrl.awaddr,
+		s_axi_ctrl_awaddr	=> s_axi_osc_ctrl.awaddr(5 downto 0),
 		s_axi_ctrl_awprot	=> (others => '0'),
 		s_axi_ctrl_awvalid	=> s_axi_osc_ctrl.awvalid,
 		s_axi_ctrl_awready	=> s_axi_osc_ctrl.awready,
@@ -273,6 +254,45 @@ begin
 		s_axi_ctrl_rvalid	=> open,
 		s_axi_ctrl_rready	=> '0',
 
+		-- Ports of Axi Slave Bus Interface S_AXI_PARAM
+		s_axi_param_aclk	=> axi_aclk,
+		s_axi_param_aresetn	=> axi_aresetn,
+		s_axi_param_awid	=> (others => '0'),
+		s_axi_param_awaddr	=> (others => '0'),
+		s_axi_param_awlen	=> (others => '0'),
+		s_axi_param_awsize	=> (others => '0'),
+		s_axi_param_awburst	=> (others => '0'),
+		s_axi_param_awlock	=> '0',
+		s_axi_param_awcache	=> (others => '0'),
+		s_axi_param_awprot	=> (others => '0'),
+		s_axi_param_awvalid	=> '0',
+		s_axi_param_awready	=> open,
+		s_axi_param_wdata	=> (others => '0'),
+		s_axi_param_wstrb	=> (others => '1'),
+		s_axi_param_wlast	=> '0',
+		s_axi_param_wvalid	=> '0',
+		s_axi_param_wready	=> open,
+		s_axi_param_bid	=> open,
+		s_axi_param_bresp	=> open,
+		s_axi_param_bvalid	=> open,
+		s_axi_param_bready	=> '0',
+		s_axi_param_arid	=> (others => '0'),
+		s_axi_param_araddr	=> (others => '0'),
+		s_axi_param_arlen	=> (others => '0'),
+		s_axi_param_arsize	=> (others => '0'),
+		s_axi_param_arburst	=> (others => '0'),
+		s_axi_param_arlock	=> '0',
+		s_axi_param_arcache	=> (others => '0'),
+		s_axi_param_arprot	=> (others => '0'),
+		s_axi_param_arvalid	=> '0',
+		s_axi_param_arready	=> open,
+		s_axi_param_rid	=> open,
+		s_axi_param_rdata	=> open,
+		s_axi_param_rresp	=> open,
+		s_axi_param_rlast	=> open,
+		s_axi_param_rvalid	=> open,
+		s_axi_param_rready	=> '0',
+
 		-- Ports of Axi Master Bus Interface M_AXIS_OUTPUT
 		m_axis_output_aclk	    => axi_aclk,
 		m_axis_output_aresetn	=> axi_aresetn,
@@ -301,5 +321,20 @@ begin
 		s_axis_pwm_tvalid	=> m_axis_lfo2_output.tvalid
 	);
 
+    -- clocks from i_en to the last channel out, checked against g_CYCLE_BUDGET
+    cycle_budget : if g_CYCLE_BUDGET > 0 generate
+        lfo_budget : entity work.cycle_budget_monitor
+        generic map(
+            g_NAME      => "lfo",
+            g_NUM_BEATS => c_NUM_CHANNELS,
+            g_BUDGET    => g_CYCLE_BUDGET
+        )
+        port map(
+            i_clk    => axi_aclk,
+            i_en     => enable,
+            i_tvalid => m_axis_lfo_tvalid,
+            i_tready => m_axis_lfo_tready
+        );
+    end generate;
 
-end tb;
\ No newline at end of file
+end tb;
@@ -5,8 +5,14 @@ use ieee.math_real.all;
 
 use work.axi_sim_package.all;
 use work.synth_module_sim_package.all;
+use work.synth_config_package.all;
 
 entity tb_mixer_module is
+    generic(
+        g_NUM_CHANNELS  : integer := 4;
+        g_SAMPLE_CYCLES : integer := 42;   -- clocks from one i_en to the next
+        g_CYCLE_BUDGET  : integer := 0     -- clocks per sample period the modules must meet, 0 does not check
+    );
 end tb_mixer_module;
 
 architecture tb of tb_mixer_module is
@@ -16,7 +22,7 @@ architecture tb of tb_mixer_module is
     signal finished : std_logic := '0';
     
     -- constants
-    constant C_NUM_CHANNELS    : integer := 4;
+    constant C_NUM_CHANNELS    : integer := g_NUM_CHANNELS;
     constant C_NUM_OSCILLATORS : integer := 2;
     constant C_DATA_WIDTH      : integer := 24;
     
@@ -32,6 +38,7 @@ architecture tb of tb_mixer_module is
     -- axi lite interfaces
     signal s_axi_osc_ctrl  : t_axi_slave := C_INIT_AXI_SLAVE;
     signal s_axi_adsr_ctrl : t_axi_slave := C_INIT_AXI_SLAVE;
+    signal s_axi_mixer_ctrl : t_axi_slave := C_INIT_AXI_SLAVE;
     -- axi stream interfaces
     signal m_axis_osc_output  : t_axi_stream_slave;
     signal m_axis_adsr_output : t_axi_stream_slave;
@@ -41,8 +48,11 @@ architecture tb of tb_mixer_module is
     signal r_adsr_output_array : t_data_array := (others => (others => '0'));
     signal r_nca_output_array  : t_data_array := (others => (others => '0'));
     --
-    signal w_active_channels   : std_logic_vector(6 downto 0);
+    signal w_active_channels   : std_logic_vector(c_COUNT_WIDTH-1 downto 0);
     signal w_mixer_output      : std_logic_vector(23 downto 0);
+    signal w_mixer_output_valid : std_logic;
+    signal w_mixer_output_left  : std_logic_vector(23 downto 0);
+    signal w_mixer_output_right : std_logic_vector(23 downto 0);
           
 begin
     
@@ -54,7 +64,7 @@ begin
     process
     begin
         enable <= '0';
-        for i in 0 to 40 loop
+        for i in 0 to g_SAMPLE_CYCLES-2 loop
             wait until rising_edge(axi_aclk);
         end loop;
         enable <= '1';
@@ -91,6 +101,25 @@ begin
             wait until rising_edge(enable);
         end loop; 
         
+        -- stereo mix with both voices panned hard left
+        mixer_set_voice_pan(axi_aclk, s_axi_mixer_ctrl, 0, -1.0);
+        mixer_set_voice_pan(axi_aclk, s_axi_mixer_ctrl, 1, -1.0);
+        s_axi_write(axi_aclk, s_axi_mixer_ctrl, MIXER_STEREO_REG, std_logic_vector(to_unsigned(1, 32)));
+        
+        for i in 0 to 10 loop
+            wait until rising_edge(enable);
+        end loop; 
+        
+        for i in 0 to 100 loop
+            wait until rising_edge(enable);
+            assert signed(w_mixer_output_right) = 0
+                report "right channel not silent with all voices panned left" severity error;
+            assert abs(to_integer(signed(w_mixer_output_left)) - to_integer(signed(w_mixer_output))) < 16
+                report "left channel " & integer'image(to_integer(signed(w_mixer_output_left))) &
+                       " differs from the mono mix " & integer'image(to_integer(signed(w_mixer_output)))
+                severity error;
+        end loop; 
+        
 --        adsr_set_voice_on(axi_aclk, s_axi_adsr_ctrl, 2);
 --        --adsr_set_voice_off(axi_aclk, s_axi_adsr_ctrl, 0);
 
@@ -170,7 +199,7 @@ begin
 		-- Ports of Axi Slave Bus Interface S_AXI_CTRL
 		s_axi_ctrl_aclk	    => axi_aclk,
 		s_axi_ctrl_aresetn	=> axi_aresetn,
-		s_axi_ctrl_awaddr	=> s_axi_osc_ctrl.awaddr,
+		s_axi_ctrl_awaddr	=> s_axi_osc_ctrl.awaddr(5 downto 0),
 		s_axi_ctrl_awprot	=> (others => '0'),
 		s_axi_ctrl_awvalid	=> s_axi_osc_ctrl.awvalid,
 		s_axi_ctrl_awready	=> s_axi_osc_ctrl.awready,
@@ -190,6 +219,45 @@ begin
 		s_axi_ctrl_rvalid	=> open,
 		s_axi_ctrl_rready	=> '0',
 
+		-- Ports of Axi Slave Bus Interface S_AXI_PARAM
+		s_axi_param_aclk	=> axi_aclk,
+		s_axi_param_aresetn	=> axi_aresetn,
+		s_axi_param_awid	=> (others => '0'),
+		s_axi_param_awaddr	=> (others => '0'),
+		s_axi_param_awlen	=> (others => '0'),
+		s_axi_param_awsize	=> (others => '0'),
+		s_axi_param_awburst	=> (others => '0'),
+		s_axi_param_awlock	=> '0',
+		s_axi_param_awcache	=> (others => '0'),
+		s_axi_param_awprot	=> (others => '0'),
+		s_axi_param_awvalid	=> '0',
+		s_axi_param_awready	=> open,
+		s_axi_param_wdata	=> (others => '0'),
+		s_axi_param_wstrb	=> (others => '1'),
+		s_axi_param_wlast	=> '0',
+		s_axi_param_wvalid	=> '0',
+		s_axi_param_wready	=> open,
+		s_axi_param_bid	=> open,
+		s_axi_param_bresp	=> open,
+		s_axi_param_bvalid	=> open,
+		s_axi_param_bready	=> '0',
+		s_axi_param_arid	=> (others => '0'),
+		s_axi_param_araddr	=> (others => '0'),
+		s_axi_param_arlen	=> (others => '0'),
+		s_axi_param_arsize	=> (others => '0'),
+		s_axi_param_arburst	=> (others => '0'),
+		s_axi_param_arlock	=> '0',
+		s_axi_param_arcache	=> (others => '0'),
+		s_axi_param_arprot	=> (others => '0'),
+		s_axi_param_arvalid	=> '0',
+		s_axi_param_arready	=> open,
+		s_axi_param_rid	=> open,
+		s_axi_param_rdata	=> open,
+		s_axi_param_rresp	=> open,
+		s_axi_param_rlast	=> open,
+		s_axi_param_rvalid	=> open,
+		s_axi_param_rready	=> '0',
+
 		-- Ports of Axi Master Bus Interface M_AXIS_OUTPUT
 		m_axis_output_aclk	    => axi_aclk,
 		m_axis_output_aresetn	=> axi_aresetn,
@@ -227,11 +295,12 @@ begin
         -- Users to add ports here
         i_enable                => enable,
         o_active_channel_count  => w_active_channels,
+        o_voice_freed_irq       => open,
 
         -- Ports of Axi Slave Bus Interface S_AXI_CTRL
         s_axi_ctrl_aclk	    => axi_aclk,
 		s_axi_ctrl_aresetn	=> axi_aresetn,
-		s_axi_ctrl_awaddr	=> s_axi_adsr_ctrl.awaddr,
+		s_axi_ctrl_awaddr	=> s_axi_adsr_ctrl.awaddr(6 downto 0),
 		s_axi_ctrl_awprot	=> (others => '0'),
 		s_axi_ctrl_awvalid	=> s_axi_adsr_ctrl.awvalid,
 		s_axi_ctrl_awready	=> s_axi_adsr_ctrl.awready,
@@ -242,7 +311,7 @@ begin
 		s_axi_ctrl_bresp	=> open,
 		s_axi_ctrl_bvalid	=> s_axi_adsr_ctrl.bvalid,
 		s_axi_ctrl_bready	=> s_axi_adsr_ctrl.bready,
-		s_axi_ctrl_araddr	=> s_axi_adsr_ctrl.araddr,
+		s_axi_ctrl_araddr	=> s_axi_adsr_ctrl.araddr(6 downto 0),
 		s_axi_ctrl_arprot	=> (others => '0'),
 		s_axi_ctrl_arvalid	=> s_axi_adsr_ctrl.arvalid,
 		s_axi_ctrl_arready	=> s_axi_adsr_ctrl.arready,
@@ -251,6 +320,45 @@ begin
 		s_axi_ctrl_rvalid	=> s_axi_adsr_ctrl.rvalid,
 		s_axi_ctrl_rready	=> s_axi_adsr_ctrl.rready,
 
+		-- Ports of Axi Slave Bus Interface S_AXI_PARAM
+		s_axi_param_aclk	=> axi_aclk,
+		s_axi_param_aresetn	=> axi_aresetn,
+		s_axi_param_awid	=> (others => '0'),
+		s_axi_param_awaddr	=> (others => '0'),
+		s_axi_param_awlen	=> (others => '0'),
+		s_axi_param_awsize	=> (others => '0'),
+		s_axi_param_awburst	=> (others => '0'),
+		s_axi_param_awlock	=> '0',
+		s_axi_param_awcache	=> (others => '0'),
+		s_axi_param_awprot	=> (others => '0'),
+		s_axi_param_awvalid	=> '0',
+		s_axi_param_awready	=> open,
+		s_axi_param_wdata	=> (others => '0'),
+		s_axi_param_wstrb	=> (others => '1'),
+		s_axi_param_wlast	=> '0',
+		s_axi_param_wvalid	=> '0',
+		s_axi_param_wready	=> open,
+		s_axi_param_bid	=> open,
+		s_axi_param_bresp	=> open,
+		s_axi_param_bvalid	=> open,
+		s_axi_param_bready	=> '0',
+		s_axi_param_arid	=> (others => '0'),
+		s_axi_param_araddr	=> (others => '0'),
+		s_axi_param_arlen	=> (others => '0'),
+		s_axi_param_arsize	=> (others => '0'),
+		s_axi_param_arburst	=> (others => '0'),
+		s_axi_param_arlock	=> '0',
+		s_axi_param_arcache	=> (others => '0'),
+		s_axi_param_arprot	=> (others => '0'),
+		s_axi_param_arvalid	=> '0',
+		s_axi_param_arready	=> open,
+		s_axi_param_rid	=> open,
+		s_axi_param_rdata	=> open,
+		s_axi_param_rresp	=> open,
+		s_axi_param_rlast	=> open,
+		s_axi_param_rvalid	=> open,
+		s_axi_param_rready	=> '0',
+
         -- Ports of Axi Master Bus Interface M_AXIS_OUTPUT
         m_axis_output_aclk	    => axi_aclk,
 		m_axis_output_aresetn	=> axi_aresetn,
@@ -269,6 +377,29 @@ begin
             -- Users to add ports here
             i_enable => enable,
     
+            -- Ports of Axi Slave Bus Interface S_AXI_CTRL
+            s_axi_ctrl_aclk	    => axi_aclk,
+            s_axi_ctrl_aresetn	=> axi_aresetn,
+            s_axi_ctrl_awaddr	=> (others => '0'),
+            s_axi_ctrl_awprot	=> (others => '0'),
+            s_axi_ctrl_awvalid	=> '0',
+            s_axi_ctrl_awready	=> open,
+            s_axi_ctrl_wdata	=> (others => '0'),
+            s_axi_ctrl_wstrb	=> (others => '1'),
+            s_axi_ctrl_wvalid	=> '0',
+            s_axi_ctrl_wready	=> open,
+            s_axi_ctrl_bresp	=> open,
+            s_axi_ctrl_bvalid	=> open,
+            s_axi_ctrl_bready	=> '0',
+            s_axi_ctrl_araddr	=> (others => '0'),
+            s_axi_ctrl_arprot	=> (others => '0'),
+            s_axi_ctrl_arvalid	=> '0',
+            s_axi_ctrl_arready	=> open,
+            s_axi_ctrl_rdata	=> open,
+            s_axi_ctrl_rresp	=> open,
+            s_axi_ctrl_rvalid	=> open,
+            s_axi_ctrl_rready	=> '0',
+    
             -- Ports of Axi Slave Bus Interface S_AXIS_INPUT
             s_axis_input_aclk	    => axi_aclk,
             s_axis_input_aresetn	=> axi_aresetn,
@@ -306,6 +437,32 @@ begin
         i_en                => enable,
         i_active_channels   => w_active_channels,
         o_output            => w_mixer_output,
+        o_output_valid      => w_mixer_output_valid,
+        o_output_left       => w_mixer_output_left,
+        o_output_right      => w_mixer_output_right,
+
+        -- Ports of Axi Slave Bus Interface S_AXI_CTRL
+        s_axi_ctrl_aclk	    => axi_aclk,
+        s_axi_ctrl_aresetn	=> axi_aresetn,
+        s_axi_ctrl_awaddr	=> s_axi_mixer_ctrl.awaddr(3 downto 0),
+        s_axi_ctrl_awprot	=> (others => '0'),
+        s_axi_ctrl_awvalid	=> s_axi_mixer_ctrl.awvalid,
+        s_axi_ctrl_awready	=> s_axi_mixer_ctrl.awready,
+        s_axi_ctrl_wdata	=> s_axi_mixer_ctrl.wdata,
+        s_axi_ctrl_wstrb	=> (others => '1'),
+        s_axi_ctrl_wvalid	=> s_axi_mixer_ctrl.wvalid,
+        s_axi_ctrl_wready	=> s_axi_mixer_ctrl.wready,
+        s_axi_ctrl_bresp	=> open,
+        s_axi_ctrl_bvalid	=> s_axi_mixer_ctrl.bvalid,
+        s_axi_ctrl_bready	=> s_axi_mixer_ctrl.bready,
+        s_axi_ctrl_araddr	=> s_axi_mixer_ctrl.araddr(3 downto 0),
+        s_axi_ctrl_arprot	=> (others => '0'),
+        s_axi_ctrl_arvalid	=> s_axi_mixer_ctrl.arvalid,
+        s_axi_ctrl_arready	=> s_axi_mixer_ctrl.arready,
+        s_axi_ctrl_rdata	=> s_axi_mixer_ctrl.rdata,
+        s_axi_ctrl_rresp	=> open,
+        s_axi_ctrl_rvalid	=> s_axi_mixer_ctrl.rvalid,
+        s_axi_ctrl_rready	=> s_axi_mixer_ctrl.rready,
 
         -- Ports of Axi Slave Bus Interface S_AXIS_INPUT
         s_axis_input_aclk	    => axi_aclk,
@@ -316,4 +473,21 @@ begin
         s_axis_input_tlast	    => '0',
         s_axis_input_tvalid	    => m_axis_nca_output.tvalid
         );
-end tb;
\ No newline at end of file
+
+    -- clocks from i_en to the last channel out, checked against g_CYCLE_BUDGET
+    cycle_budget : if g_CYCLE_BUDGET > 0 generate
+        mixer_budget : entity work.cycle_budget_monitor
+        generic map(
+            g_NAME      => "mixer",
+            g_NUM_BEATS => 1,
+            g_BUDGET    => g_CYCLE_BUDGET
+        )
+        port map(
+            i_clk    => axi_aclk,
+            i_en     => enable,
+            i_tvalid => w_mixer_output_valid,
+            i_tready => '1'
+        );
+    end generate;
+
+end tb;
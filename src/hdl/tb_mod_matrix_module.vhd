@@ -0,0 +1,301 @@
+library ieee;
+use ieee.std_logic_1164.all;
+use ieee.numeric_std.all;
+use ieee.math_real.all;
+
+use work.axi_sim_package.all;
+use work.synth_module_sim_package.all;
+
+entity tb_mod_matrix_module is
+end tb_mod_matrix_module;
+
+architecture tb of tb_mod_matrix_module is
+
+    -- simulation variables
+    constant T : time := 10 ns;
+    signal finished : std_logic := '0';
+
+    -- modulation matrix constants
+    constant c_NUM_CHANNELS     : integer := 2;
+    constant c_DATA_WIDTH       : integer := 24;
+    constant c_NUM_LFOS         : integer := 3;
+    constant c_NUM_ENVELOPES    : integer := 2;
+    constant c_NUM_SOURCES      : integer := 8;
+    constant c_NUM_DESTINATIONS : integer := 4;
+
+    -- sources and destinations
+    constant c_LFO_A        : integer := 0;
+    constant c_LFO_B        : integer := 1;
+    constant c_LFO_C        : integer := 2;
+    constant c_AMP_ENV      : integer := 4;
+    constant c_FILTER_ENV   : integer := 5;
+    constant c_PITCH        : integer := 0;
+    constant c_PULSE_WIDTH  : integer := 1;
+    constant c_CUTOFF       : integer := 2;
+    constant c_AMPLITUDE    : integer := 3;
+
+    -- types
+    type t_amount_array is array (0 to c_NUM_DESTINATIONS*c_NUM_SOURCES-1) of integer; -- Q3.15
+    type t_output_array is array (0 to c_NUM_DESTINATIONS-1) of integer;
+    type t_voice_array is array (0 to c_NUM_CHANNELS-1) of t_output_array;
+
+    -- amounts after reset
+    constant c_RESET_AMOUNT : t_amount_array := (c_PITCH*c_NUM_SOURCES+c_LFO_A          => 2**15,
+                                                 c_PULSE_WIDTH*c_NUM_SOURCES+c_LFO_C    => 2**15,
+                                                 c_CUTOFF*c_NUM_SOURCES+c_LFO_B         => 2**15,
+                                                 c_CUTOFF*c_NUM_SOURCES+c_FILTER_ENV    => 2**15,
+                                                 c_AMPLITUDE*c_NUM_SOURCES+c_AMP_ENV    => 2**15,
+                                                 others => 0);
+
+    -- signals
+    signal axi_aclk      : std_logic := '0';
+    signal axi_aresetn   : std_logic;
+    signal enable        : std_logic;
+
+    signal s_axi_ctrl : t_axi_slave := C_INIT_AXI_SLAVE;
+
+    signal s_axis_lfo_tvalid      : std_logic := '0';
+    signal s_axis_lfo_tdata       : std_logic_vector(32*c_NUM_LFOS-1 downto 0) := (others => '0');
+    signal s_axis_lfo_tready      : std_logic;
+    signal s_axis_envelope_tvalid : std_logic := '0';
+    signal s_axis_envelope_tdata  : std_logic_vector(32*c_NUM_ENVELOPES-1 downto 0) := (others => '0');
+    signal s_axis_envelope_tready : std_logic;
+    signal envelope_stall         : integer := 0; -- clocks the envelope stream stalls after the first voice
+
+
+    signal m_axis_output_tvalid : std_logic;
+    signal m_axis_output_tdata  : std_logic_vector(32*c_NUM_DESTINATIONS-1 downto 0);
+    signal m_axis_output_tready : std_logic;
+
+    signal r_output_array : t_voice_array := (others => (others => 0));
+
+    -- source value of every voice, the envelopes are positive, the LFOs change sign
+    function source_value(source, voice : integer) return integer is
+    begin
+        case source is
+            when c_LFO_A      => return 100000*(voice+1);
+            when c_LFO_B      => return -200000*(voice+1);
+            when c_LFO_C      => return 300000*(voice+1);
+            when c_AMP_ENV    => return (2**22)/(voice+1);
+            when c_FILTER_ENV => return (2**20)*(voice+1);
+            when others       => return 0;
+        end case;
+    end function;
+
+    -- reference model, sum of the scaled sources, saturated, the amplitude is not negative
+    function expected_value(amount : t_amount_array; dest, voice : integer) return integer is
+        variable v_sum : signed(2*c_DATA_WIDTH-1 downto 0) := (others => '0');
+    begin
+        for s in 0 to c_NUM_SOURCES-1 loop
+            v_sum := v_sum + to_signed(source_value(s, voice), c_DATA_WIDTH) * to_signed(amount(dest*c_NUM_SOURCES+s), c_DATA_WIDTH);
+        end loop;
+        v_sum := shift_right(v_sum, 15);
+        if dest = c_AMPLITUDE and v_sum < 0 then
+            return 0;
+        elsif v_sum > 2**(c_DATA_WIDTH-1)-1 then
+            return 2**(c_DATA_WIDTH-1)-1;
+        elsif v_sum < -2**(c_DATA_WIDTH-1) then
+            return -2**(c_DATA_WIDTH-1);
+        end if;
+        return to_integer(v_sum);
+    end function;
+
+begin
+
+    -- generate clk and resetn
+    axi_aclk    <= not axi_aclk after T/2 when finished /= '1' else '0';
+    axi_aresetn <= '0', '1' after T;
+
+    -- generate module enable
+    process
+    begin
+        enable <= '0';
+        for i in 0 to 19 loop
+            wait until rising_edge(axi_aclk);
+        end loop;
+        enable <= '1';
+        wait until rising_edge(axi_aclk);
+    end process;
+
+    -- main process
+    process
+        variable v_amount : t_amount_array := c_RESET_AMOUNT;
+        variable status   : std_logic_vector(31 downto 0);
+
+        procedure set_amount(dest, source : integer; amount : real) is
+        begin
+            mod_matrix_set_amount(axi_aclk, s_axi_ctrl, dest, source, amount);
+            v_amount(dest*c_NUM_SOURCES+source) := integer(amount * 2.0**15.0);
+        end procedure;
+
+        procedure check_outputs(test : string) is
+        begin
+            -- let the new amounts reach every voice
+            for i in 0 to 3 loop
+                wait until rising_edge(enable);
+            end loop;
+            for v in 0 to c_NUM_CHANNELS-1 loop
+                for d in 0 to c_NUM_DESTINATIONS-1 loop
+                    assert r_output_array(v)(d) = expected_value(v_amount, d, v)
+                        report test & ": voice " & integer'image(v) & " destination " & integer'image(d) &
+                               " is " & integer'image(r_output_array(v)(d)) & ", expected " & integer'image(expected_value(v_amount, d, v))
+                        severity error;
+                end loop;
+            end loop;
+        end procedure;
+    begin
+        wait until axi_aresetn = '1';
+
+        -- routing after reset
+        check_outputs("reset routing");
+
+        -- several sources on one destination, negative amounts
+        set_amount(c_PITCH, c_LFO_B, -0.5);
+        set_amount(c_PULSE_WIDTH, c_LFO_A, 0.25);
+        set_amount(c_CUTOFF, c_FILTER_ENV, 0.75);
+        check_outputs("mixed routing");
+
+        -- destination saturation and non negative amplitude
+        set_amount(c_CUTOFF, c_AMP_ENV, 3.5);
+        set_amount(c_AMPLITUDE, c_AMP_ENV, 0.0);
+        set_amount(c_AMPLITUDE, c_LFO_B, 1.0);
+        check_outputs("saturation");
+
+        -- the sources arrive in time, no voice is processed with a missing source
+        s_axi_read(axi_aclk, s_axi_ctrl, MOD_MATRIX_FLOW_STATUS_REG, status);
+        assert unsigned(status) = 0
+            report "modulation matrix flow status " & integer'image(to_integer(unsigned(status(15 downto 0)))) & " overflows, " &
+                   integer'image(to_integer(unsigned(status(31 downto 16)))) & " underruns"
+            severity error;
+
+        -- the envelope stream stalls past the next enable after the first voice, the second
+        -- voice is issued with a zero envelope and its late beat dropped when it arrives,
+        -- the voices after it keep their own envelopes
+        envelope_stall <= 30;
+        wait until rising_edge(enable);
+        wait until rising_edge(enable);
+        envelope_stall <= 0;
+        check_outputs("late envelope");
+
+        s_axi_read(axi_aclk, s_axi_ctrl, MOD_MATRIX_FLOW_STATUS_REG, status);
+        assert unsigned(status(31 downto 16)) /= 0
+            report "no underrun counted for the late envelope" severity error;
+
+        finished <= '1';
+        wait;
+    end process;
+
+    -- lfo stream, one beat per voice after every enable
+    process
+    begin
+        wait until rising_edge(axi_aclk) and enable = '1';
+        for v in 0 to c_NUM_CHANNELS-1 loop
+            for l in 0 to c_NUM_LFOS-1 loop
+                s_axis_lfo_tdata(l*32+31 downto l*32) <= std_logic_vector(to_signed(source_value(l, v), 32));
+            end loop;
+            s_axis_lfo_tvalid <= '1';
+            wait until rising_edge(axi_aclk) and s_axis_lfo_tready = '1';
+        end loop;
+        s_axis_lfo_tvalid <= '0';
+    end process;
+
+    -- envelope stream, as combined from the two ADSR outputs
+    process
+    begin
+        wait until rising_edge(axi_aclk) and enable = '1';
+        for v in 0 to c_NUM_CHANNELS-1 loop
+            for e in 0 to c_NUM_ENVELOPES-1 loop
+                s_axis_envelope_tdata(e*32+31 downto e*32) <= std_logic_vector(to_signed(source_value(c_AMP_ENV+e, v), 32));
+            end loop;
+            s_axis_envelope_tvalid <= '1';
+            wait until rising_edge(axi_aclk) and s_axis_envelope_tready = '1';
+            if v = 0 and envelope_stall > 0 then
+                s_axis_envelope_tvalid <= '0';
+                for i in 1 to envelope_stall loop
+                    wait until rising_edge(axi_aclk);
+                end loop;
+            end if;
+        end loop;
+        s_axis_envelope_tvalid <= '0';
+    end process;
+
+    -- receive modulation matrix output process
+    process(axi_aclk)
+        variable index : integer := 0;
+    begin
+        m_axis_output_tready <= '1';
+        if rising_edge(axi_aclk) then
+            if m_axis_output_tvalid = '1' then
+                for d in 0 to c_NUM_DESTINATIONS-1 loop
+                    r_output_array(index)(d) <= to_integer(signed(m_axis_output_tdata(d*32+c_DATA_WIDTH-1 downto d*32)));
+                end loop;
+                index := index + 1;
+                if index = c_NUM_CHANNELS then
+                    index := 0;
+                end if;
+            end if;
+        end if;
+    end process;
+
+    -- instantiate modulation matrix
+    mod_matrix_module : entity work.Mod_Matrix_v1_0
+        generic map(
+            g_NUM_CHANNELS  => c_NUM_CHANNELS,
+            g_NUM_LFOS      => c_NUM_LFOS,
+            g_NUM_ENVELOPES => c_NUM_ENVELOPES
+        )
+        port map(
+            i_enable            => enable,
+
+            -- Ports of Axi Slave Bus Interface S_AXI_CTRL
+            s_axi_ctrl_aclk	    => axi_aclk,
+            s_axi_ctrl_aresetn	=> axi_aresetn,
+            s_axi_ctrl_awaddr	=> s_axi_ctrl.awaddr,
+            s_axi_ctrl_awprot	=> (others => '0'),
+            s_axi_ctrl_awvalid	=> s_axi_ctrl.awvalid,
+            s_axi_ctrl_awready	=> s_axi_ctrl.awready,
+            s_axi_ctrl_wdata	=> s_axi_ctrl.wdata,
+            s_axi_ctrl_wstrb	=> (others => '1'),
+            s_axi_ctrl_wvalid	=> s_axi_ctrl.wvalid,
+            s_axi_ctrl_wready	=> s_axi_ctrl.wready,
+            s_axi_ctrl_bresp	=> open,
+            s_axi_ctrl_bvalid	=> s_axi_ctrl.bvalid,
+            s_axi_ctrl_bready	=> s_axi_ctrl.bready,
+            s_axi_ctrl_araddr	=> s_axi_ctrl.araddr,
+            s_axi_ctrl_arprot	=> (others => '0'),
+            s_axi_ctrl_arvalid	=> s_axi_ctrl.arvalid,
+            s_axi_ctrl_arready	=> s_axi_ctrl.arready,
+            s_axi_ctrl_rdata	=> s_axi_ctrl.rdata,
+            s_axi_ctrl_rresp	=> open,
+            s_axi_ctrl_rvalid	=> s_axi_ctrl.rvalid,
+            s_axi_ctrl_rready	=> s_axi_ctrl.rready,
+
+            -- Ports of Axi Slave Bus Interface S_AXIS_LFO
+            s_axis_lfo_aclk	    => axi_aclk,
+            s_axis_lfo_aresetn	=> axi_aresetn,
+            s_axis_lfo_tready	=> s_axis_lfo_tready,
+            s_axis_lfo_tdata	=> s_axis_lfo_tdata,
+            s_axis_lfo_tstrb	=> (others => '1'),
+            s_axis_lfo_tlast	=> '0',
+            s_axis_lfo_tvalid	=> s_axis_lfo_tvalid,
+
+            -- Ports of Axi Slave Bus Interface S_AXIS_ENVELOPE
+            s_axis_envelope_aclk	=> axi_aclk,
+            s_axis_envelope_aresetn	=> axi_aresetn,
+            s_axis_envelope_tready	=> s_axis_envelope_tready,
+            s_axis_envelope_tdata	=> s_axis_envelope_tdata,
+            s_axis_envelope_tstrb	=> (others => '1'),
+            s_axis_envelope_tlast	=> '0',
+            s_axis_envelope_tvalid	=> s_axis_envelope_tvalid,
+
+            -- Ports of Axi Master Bus Interface M_AXIS_OUTPUT
+            m_axis_output_aclk	    => axi_aclk,
+            m_axis_output_aresetn	=> axi_aresetn,
+            m_axis_output_tvalid	=> m_axis_output_tvalid,
+            m_axis_output_tdata	    => m_axis_output_tdata,
+            m_axis_output_tstrb	    => open,
+            m_axis_output_tlast	    => open,
+            m_axis_output_tready	=> m_axis_output_tready
+        );
+
+end tb;
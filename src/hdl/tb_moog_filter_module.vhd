@@ -7,6 +7,11 @@ use work.axi_sim_package.all;
 use work.synth_module_sim_package.all;
 
 entity tb_moog_filter_module is
+    generic(
+        g_NUM_CHANNELS  : integer := 8;
+        g_SAMPLE_CYCLES : integer := 21;   -- clocks from one i_en to the next
+        g_CYCLE_BUDGET  : integer := 0     -- clocks per sample period the modules must meet, 0 does not check
+    );
 end tb_moog_filter_module;
 
 architecture tb of tb_moog_filter_module is
@@ -16,7 +21,7 @@ architecture tb of tb_moog_filter_module is
     signal finished : std_logic := '0';
     
     -- oscillator module constants
-    constant c_NUM_CHANNELS    : integer := 8;
+    constant c_NUM_CHANNELS    : integer := g_NUM_CHANNELS;
     constant c_NUM_OSCILLATORS : integer := 2;
     constant c_DATA_WIDTH      : integer := 24;
     
@@ -45,7 +50,7 @@ begin
     process
     begin
         enable <= '0';
-        for i in 0 to 19 loop
+        for i in 0 to g_SAMPLE_CYCLES-2 loop
             wait until rising_edge(axi_aclk);
         end loop;
         enable <= '1';
@@ -54,6 +59,7 @@ begin
     
     -- main process
     process
+        variable status : std_logic_vector(31 downto 0);
     begin
         osc_set_frequency(axi_aclk, s_axi_oscillator_ctrl, 0, 523.0);
         osc_set_frequency(axi_aclk, s_axi_oscillator_ctrl, 1, 1000.0);
@@ -67,11 +73,22 @@ begin
 		filter_set_type(axi_aclk, s_axi_filter_ctrl, LOW_PASS);
 		filter_set_attenuation(axi_aclk, s_axi_filter_ctrl, ATTENUATION_24DB_OCT);
 		--filter_set_resonance(axi_aclk, s_axi_filter_ctrl, 0.80);
+		filter_set_voice_note(axi_aclk, s_axi_filter_ctrl, 0, 72);
+		filter_set_voice_note(axi_aclk, s_axi_filter_ctrl, 1, 83);
+		filter_set_voice_cutoff_offset(axi_aclk, s_axi_filter_ctrl, 1, -500.0);
+		filter_set_key_tracking(axi_aclk, s_axi_filter_ctrl, 0.5);
+		filter_set_oversampling(axi_aclk, s_axi_filter_ctrl, 1);
         
         for i in 0 to 1000 loop
             wait until rising_edge(enable);
         end loop;                      
         
+        -- the sample period is measured from the module enable (21 clock cycles)
+        s_axi_read(axi_aclk, s_axi_filter_ctrl, FILTER_FIFO_SELECT_REG, status);
+        assert unsigned(status(31 downto 16)) = 21
+            report "filter sample cycles " & integer'image(to_integer(unsigned(status(31 downto 16)))) & ", expected 21"
+            severity error;
+        
         
         finished <= '1';
     end process;
@@ -121,7 +138,7 @@ begin
 		-- Ports of Axi Slave Bus Interface S_AXI_CTRL
 		s_axi_ctrl_aclk	    => axi_aclk,
 		s_axi_ctrl_aresetn	=> axi_aresetn,
-		s_axi_ctrl_awaddr	=> s_axi_oscillator_ctrl.awaddr,
+		s_axi_ctrl_awaddr	=> s_axi_oscillator_ctrl.awaddr(5 downto 0),
 		s_axi_ctrl_awprot	=> (others => '0'),
 		s_axi_ctrl_awvalid	=> s_axi_oscillator_ctrl.awvalid,
 		s_axi_ctrl_awready	=> s_axi_oscillator_ctrl.awready,
@@ -141,6 +158,45 @@ begin
 		s_axi_ctrl_rvalid	=> open,
 		s_axi_ctrl_rready	=> '0',
 
+		-- Ports of Axi Slave Bus Interface S_AXI_PARAM
+		s_axi_param_aclk	=> axi_aclk,
+		s_axi_param_aresetn	=> axi_aresetn,
+		s_axi_param_awid	=> (others => '0'),
+		s_axi_param_awaddr	=> (others => '0'),
+		s_axi_param_awlen	=> (others => '0'),
+		s_axi_param_awsize	=> (others => '0'),
+		s_axi_param_awburst	=> (others => '0'),
+		s_axi_param_awlock	=> '0',
+		s_axi_param_awcache	=> (others => '0'),
+		s_axi_param_awprot	=> (others => '0'),
+		s_axi_param_awvalid	=> '0',
+		s_axi_param_awready	=> open,
+		s_axi_param_wdata	=> (others => '0'),
+		s_axi_param_wstrb	=> (others => '1'),
+		s_axi_param_wlast	=> '0',
+		s_axi_param_wvalid	=> '0',
+		s_axi_param_wready	=> open,
+		s_axi_param_bid	=> open,
+		s_axi_param_bresp	=> open,
+		s_axi_param_bvalid	=> open,
+		s_axi_param_bready	=> '0',
+		s_axi_param_arid	=> (others => '0'),
+		s_axi_param_araddr	=> (others => '0'),
+		s_axi_param_arlen	=> (others => '0'),
+		s_axi_param_arsize	=> (others => '0'),
+		s_axi_param_arburst	=> (others => '0'),
+		s_axi_param_arlock	=> '0',
+		s_axi_param_arcache	=> (others => '0'),
+		s_axi_param_arprot	=> (others => '0'),
+		s_axi_param_arvalid	=> '0',
+		s_axi_param_arready	=> open,
+		s_axi_param_rid	=> open,
+		s_axi_param_rdata	=> open,
+		s_axi_param_rresp	=> open,
+		s_axi_param_rlast	=> open,
+		s_axi_param_rvalid	=> open,
+		s_axi_param_rready	=> '0',
+
 		-- Ports of Axi Master Bus Interface M_AXIS_OUTPUT
 		m_axis_output_aclk	    => axi_aclk,
 		m_axis_output_aresetn	=> axi_aresetn,
@@ -182,7 +238,7 @@ begin
 		-- Ports of Axi Slave Bus Interface S_AXI_CTRL
 		s_axi_ctrl_aclk	    => axi_aclk,
 		s_axi_ctrl_aresetn	=> axi_aresetn,
-		s_axi_ctrl_awaddr	=> s_axi_filter_ctrl.awaddr,
+		s_axi_ctrl_awaddr	=> s_axi_filter_ctrl.awaddr(5 downto 0),
 		s_axi_ctrl_awprot	=> (others => '0'),
 		s_axi_ctrl_awvalid	=> s_axi_filter_ctrl.awvalid,
 		s_axi_ctrl_awready	=> s_axi_filter_ctrl.awready,
@@ -193,14 +249,14 @@ begin
 		s_axi_ctrl_bresp	=> open,
 		s_axi_ctrl_bvalid	=> s_axi_filter_ctrl.bvalid,
 		s_axi_ctrl_bready	=> s_axi_filter_ctrl.bready,
-		s_axi_ctrl_araddr	=> (others => '0'),
+		s_axi_ctrl_araddr	=> s_axi_filter_ctrl.araddr(5 downto 0),
 		s_axi_ctrl_arprot	=> (others => '0'),
-		s_axi_ctrl_arvalid	=> '0',
-		s_axi_ctrl_arready	=> open,
-		s_axi_ctrl_rdata	=> open,
+		s_axi_ctrl_arvalid	=> s_axi_filter_ctrl.arvalid,
+		s_axi_ctrl_arready	=> s_axi_filter_ctrl.arready,
+		s_axi_ctrl_rdata	=> s_axi_filter_ctrl.rdata,
 		s_axi_ctrl_rresp	=> open,
-		s_axi_ctrl_rvalid	=> open,
-		s_axi_ctrl_rready	=> '0',
+		s_axi_ctrl_rvalid	=> s_axi_filter_ctrl.rvalid,
+		s_axi_ctrl_rready	=> s_axi_filter_ctrl.rready,
 
 		-- Ports of Axi Master Bus Interface M_AXIS_OUTPUT
 		m_axis_output_aclk	    => axi_aclk,
@@ -238,6 +294,21 @@ begin
 		s_axi_modulation_tlast	    => '0',
 		s_axi_modulation_tvalid	    => '0'
 	);
-	
-	
-end tb;
\ No newline at end of file
+
+    -- clocks from i_en to the last channel out, checked against g_CYCLE_BUDGET
+    cycle_budget : if g_CYCLE_BUDGET > 0 generate
+        filter_budget : entity work.cycle_budget_monitor
+        generic map(
+            g_NAME      => "moog_filter",
+            g_NUM_BEATS => c_NUM_CHANNELS,
+            g_BUDGET    => g_CYCLE_BUDGET
+        )
+        port map(
+            i_clk    => axi_aclk,
+            i_en     => enable,
+            i_tvalid => m_axis_filter_output.tvalid,
+            i_tready => m_axis_filter_output.tready
+        );
+    end generate;
+
+end tb;
@@ -7,6 +7,11 @@ use work.axi_sim_package.all;
 use work.synth_module_sim_package.all;
 
 entity tb_nca_module is
+    generic(
+        g_NUM_CHANNELS  : integer := 2;
+        g_SAMPLE_CYCLES : integer := 21;   -- clocks from one i_en to the next
+        g_CYCLE_BUDGET  : integer := 0     -- clocks per sample period the modules must meet, 0 does not check
+    );
 end tb_nca_module;
 
 architecture tb of tb_nca_module is
@@ -16,7 +21,7 @@ architecture tb of tb_nca_module is
     signal finished : std_logic := '0';
     
     -- constants
-    constant C_NUM_CHANNELS    : integer := 2;
+    constant C_NUM_CHANNELS    : integer := g_NUM_CHANNELS;
     constant C_NUM_OSCILLATORS : integer := 2;
     constant C_DATA_WIDTH      : integer := 24;
     
@@ -32,10 +37,15 @@ architecture tb of tb_nca_module is
     -- axi lite interfaces
     signal s_axi_osc_ctrl  : t_axi_slave := C_INIT_AXI_SLAVE;
     signal s_axi_adsr_ctrl : t_axi_slave := C_INIT_AXI_SLAVE;
+    signal s_axi_nca_ctrl  : t_axi_slave := C_INIT_AXI_SLAVE;
     -- axi stream interfaces
     signal m_axis_osc_output : t_axi_stream_slave;
     signal m_axis_adsr_output : t_axi_stream_slave;
     signal m_axis_nca_output : t_axi_stream_slave;
+    -- envelope stream into the multiplier, held off while starved
+    signal starve_envelope        : std_logic := '0';
+    signal w_nca_envelope_tvalid  : std_logic;
+    signal w_nca_envelope_tready  : std_logic;
     -- output arrays
     signal r_osc_output_array : t_data_array := (others => (others => '0'));
     signal r_adsr_output_array : t_data_array := (others => (others => '0'));
@@ -51,7 +61,7 @@ begin
     process
     begin
         enable <= '0';
-        for i in 0 to 19 loop
+        for i in 0 to g_SAMPLE_CYCLES-2 loop
             wait until rising_edge(axi_aclk);
         end loop;
         enable <= '1';
@@ -60,6 +70,8 @@ begin
     
     -- main process
     process
+        variable status         : std_logic_vector(31 downto 0);
+        variable voice_0_output : boolean := false;
     begin
         -- configure oscillator
         osc_set_frequency(axi_aclk, s_axi_osc_ctrl, 0, 500.0);
@@ -80,6 +92,38 @@ begin
             wait until rising_edge(enable);
         end loop; 
 
+        -- starve the envelope stream from the second voice of a sample period until after
+        -- the next enable, the multiplier processes that voice with a zero envelope and
+        -- must drop the envelope when it arrives late to keep the streams voice aligned
+        s_axi_write(axi_aclk, s_axi_nca_ctrl, MULT_FLOW_STATUS_REG, x"00000000");
+        wait until rising_edge(enable);
+        wait until rising_edge(axi_aclk) and m_axis_adsr_output.tvalid = '1' and m_axis_adsr_output.tready = '1';
+        starve_envelope <= '1';
+        wait until rising_edge(enable);
+        for i in 0 to 3 loop
+            wait until rising_edge(axi_aclk);
+        end loop;
+        starve_envelope <= '0';
+
+        -- only voice 0 is on and voice 1 has no amplitude, a stream shifted by a voice
+        -- would multiply the voice 0 oscillator by the silent voice 1 envelope
+        for i in 0 to 3 loop
+            wait until rising_edge(enable);
+        end loop;
+        for i in 0 to 9 loop
+            wait until rising_edge(enable);
+            assert signed(r_nca_output_array(1)) = 0
+                report "voice 1 output " & integer'image(to_integer(signed(r_nca_output_array(1)))) &
+                       " after the envelope stream was starved" severity error;
+            voice_0_output := voice_0_output or signed(r_nca_output_array(0)) /= 0;
+        end loop;
+        assert voice_0_output report "voice 0 silent after the envelope stream was starved, streams misaligned" severity error;
+
+        s_axi_read(axi_aclk, s_axi_nca_ctrl, MULT_FLOW_STATUS_REG, status);
+        assert unsigned(status(31 downto 16)) = 1
+            report "multiplier underruns " & integer'image(to_integer(unsigned(status(31 downto 16)))) &
+                   ", expected the starved voice only" severity error;
+
         adsr_set_voice_on(axi_aclk, s_axi_adsr_ctrl, 1);
 
         for i in 0 to 1000 loop
@@ -121,7 +165,7 @@ begin
         variable index : integer := 0;
     begin
         if rising_edge(axi_aclk) then
-            if m_axis_adsr_output.tvalid = '1' then
+            if m_axis_adsr_output.tvalid = '1' and m_axis_adsr_output.tready = '1' then
                 r_adsr_output_array(index) <= m_axis_adsr_output.tdata(r_adsr_output_array(index)'range);
                 index := index + 1;
                 if index = c_NUM_CHANNELS then
@@ -161,7 +205,7 @@ begin
 		-- Ports of Axi Slave Bus Interface S_AXI_CTRL
 		s_axi_ctrl_aclk	    => axi_aclk,
 		s_axi_ctrl_aresetn	=> axi_aresetn,
-		s_axi_ctrl_awaddr	=> s_axi_osc_ctrl.awaddr,
+		s_axi_ctrl_awaddr	=> s_axi_osc_ctrl.awaddr(5 downto 0),
 		s_axi_ctrl_awprot	=> (others => '0'),
 		s_axi_ctrl_awvalid	=> s_axi_osc_ctrl.awvalid,
 		s_axi_ctrl_awready	=> s_axi_osc_ctrl.awready,
@@ -181,6 +225,45 @@ begin
 		s_axi_ctrl_rvalid	=> open,
 		s_axi_ctrl_rready	=> '0',
 
+		-- Ports of Axi Slave Bus Interface S_AXI_PARAM
+		s_axi_param_aclk	=> axi_aclk,
+		s_axi_param_aresetn	=> axi_aresetn,
+		s_axi_param_awid	=> (others => '0'),
+		s_axi_param_awaddr	=> (others => '0'),
+		s_axi_param_awlen	=> (others => '0'),
+		s_axi_param_awsize	=> (others => '0'),
+		s_axi_param_awburst	=> (others => '0'),
+		s_axi_param_awlock	=> '0',
+		s_axi_param_awcache	=> (others => '0'),
+		s_axi_param_awprot	=> (others => '0'),
+		s_axi_param_awvalid	=> '0',
+		s_axi_param_awready	=> open,
+		s_axi_param_wdata	=> (others => '0'),
+		s_axi_param_wstrb	=> (others => '1'),
+		s_axi_param_wlast	=> '0',
+		s_axi_param_wvalid	=> '0',
+		s_axi_param_wready	=> open,
+		s_axi_param_bid	=> open,
+		s_axi_param_bresp	=> open,
+		s_axi_param_bvalid	=> open,
+		s_axi_param_bready	=> '0',
+		s_axi_param_arid	=> (others => '0'),
+		s_axi_param_araddr	=> (others => '0'),
+		s_axi_param_arlen	=> (others => '0'),
+		s_axi_param_arsize	=> (others => '0'),
+		s_axi_param_arburst	=> (others => '0'),
+		s_axi_param_arlock	=> '0',
+		s_axi_param_arcache	=> (others => '0'),
+		s_axi_param_arprot	=> (others => '0'),
+		s_axi_param_arvalid	=> '0',
+		s_axi_param_arready	=> open,
+		s_axi_param_rid	=> open,
+		s_axi_param_rdata	=> open,
+		s_axi_param_rresp	=> open,
+		s_axi_param_rlast	=> open,
+		s_axi_param_rvalid	=> open,
+		s_axi_param_rready	=> '0',
+
 		-- Ports of Axi Master Bus Interface M_AXIS_OUTPUT
 		m_axis_output_aclk	    => axi_aclk,
 		m_axis_output_aresetn	=> axi_aresetn,
@@ -218,11 +301,12 @@ begin
         -- Users to add ports here
         i_enable                => enable,
         o_active_channel_count  => open,
+        o_voice_freed_irq       => open,
 
         -- Ports of Axi Slave Bus Interface S_AXI_CTRL
         s_axi_ctrl_aclk	    => axi_aclk,
 		s_axi_ctrl_aresetn	=> axi_aresetn,
-		s_axi_ctrl_awaddr	=> s_axi_adsr_ctrl.awaddr,
+		s_axi_ctrl_awaddr	=> s_axi_adsr_ctrl.awaddr(6 downto 0),
 		s_axi_ctrl_awprot	=> (others => '0'),
 		s_axi_ctrl_awvalid	=> s_axi_adsr_ctrl.awvalid,
 		s_axi_ctrl_awready	=> s_axi_adsr_ctrl.awready,
@@ -233,7 +317,7 @@ begin
 		s_axi_ctrl_bresp	=> open,
 		s_axi_ctrl_bvalid	=> s_axi_adsr_ctrl.bvalid,
 		s_axi_ctrl_bready	=> s_axi_adsr_ctrl.bready,
-		s_axi_ctrl_araddr	=> s_axi_adsr_ctrl.araddr,
+		s_axi_ctrl_araddr	=> s_axi_adsr_ctrl.araddr(6 downto 0),
 		s_axi_ctrl_arprot	=> (others => '0'),
 		s_axi_ctrl_arvalid	=> s_axi_adsr_ctrl.arvalid,
 		s_axi_ctrl_arready	=> s_axi_adsr_ctrl.arready,
@@ -242,6 +326,45 @@ begin
 		s_axi_ctrl_rvalid	=> s_axi_adsr_ctrl.rvalid,
 		s_axi_ctrl_rready	=> s_axi_adsr_ctrl.rready,
 
+		-- Ports of Axi Slave Bus Interface S_AXI_PARAM
+		s_axi_param_aclk	=> axi_aclk,
+		s_axi_param_aresetn	=> axi_aresetn,
+		s_axi_param_awid	=> (others => '0'),
+		s_axi_param_awaddr	=> (others => '0'),
+		s_axi_param_awlen	=> (others => '0'),
+		s_axi_param_awsize	=> (others => '0'),
+		s_axi_param_awburst	=> (others => '0'),
+		s_axi_param_awlock	=> '0',
+		s_axi_param_awcache	=> (others => '0'),
+		s_axi_param_awprot	=> (others => '0'),
+		s_axi_param_awvalid	=> '0',
+		s_axi_param_awready	=> open,
+		s_axi_param_wdata	=> (others => '0'),
+		s_axi_param_wstrb	=> (others => '1'),
+		s_axi_param_wlast	=> '0',
+		s_axi_param_wvalid	=> '0',
+		s_axi_param_wready	=> open,
+		s_axi_param_bid	=> open,
+		s_axi_param_bresp	=> open,
+		s_axi_param_bvalid	=> open,
+		s_axi_param_bready	=> '0',
+		s_axi_param_arid	=> (others => '0'),
+		s_axi_param_araddr	=> (others => '0'),
+		s_axi_param_arlen	=> (others => '0'),
+		s_axi_param_arsize	=> (others => '0'),
+		s_axi_param_arburst	=> (others => '0'),
+		s_axi_param_arlock	=> '0',
+		s_axi_param_arcache	=> (others => '0'),
+		s_axi_param_arprot	=> (others => '0'),
+		s_axi_param_arvalid	=> '0',
+		s_axi_param_arready	=> open,
+		s_axi_param_rid	=> open,
+		s_axi_param_rdata	=> open,
+		s_axi_param_rresp	=> open,
+		s_axi_param_rlast	=> open,
+		s_axi_param_rvalid	=> open,
+		s_axi_param_rready	=> '0',
+
         -- Ports of Axi Master Bus Interface M_AXIS_OUTPUT
         m_axis_output_aclk	    => axi_aclk,
 		m_axis_output_aresetn	=> axi_aresetn,
@@ -252,6 +375,9 @@ begin
 		m_axis_output_tready	=> m_axis_adsr_output.tready
     );
 
+    w_nca_envelope_tvalid     <= m_axis_adsr_output.tvalid and not starve_envelope;
+    m_axis_adsr_output.tready <= w_nca_envelope_tready and not starve_envelope;
+
     nca_module : entity work.Multiplier_v2_0
         generic map(
             g_NUM_CHANNELS   => C_NUM_CHANNELS
@@ -260,6 +386,29 @@ begin
             -- Users to add ports here
             i_enable => enable,
     
+            -- Ports of Axi Slave Bus Interface S_AXI_CTRL
+            s_axi_ctrl_aclk	    => axi_aclk,
+            s_axi_ctrl_aresetn	=> axi_aresetn,
+            s_axi_ctrl_awaddr	=> s_axi_nca_ctrl.awaddr(3 downto 0),
+            s_axi_ctrl_awprot	=> (others => '0'),
+            s_axi_ctrl_awvalid	=> s_axi_nca_ctrl.awvalid,
+            s_axi_ctrl_awready	=> s_axi_nca_ctrl.awready,
+            s_axi_ctrl_wdata	=> s_axi_nca_ctrl.wdata,
+            s_axi_ctrl_wstrb	=> (others => '1'),
+            s_axi_ctrl_wvalid	=> s_axi_nca_ctrl.wvalid,
+            s_axi_ctrl_wready	=> s_axi_nca_ctrl.wready,
+            s_axi_ctrl_bresp	=> open,
+            s_axi_ctrl_bvalid	=> s_axi_nca_ctrl.bvalid,
+            s_axi_ctrl_bready	=> s_axi_nca_ctrl.bready,
+            s_axi_ctrl_araddr	=> s_axi_nca_ctrl.araddr(3 downto 0),
+            s_axi_ctrl_arprot	=> (others => '0'),
+            s_axi_ctrl_arvalid	=> s_axi_nca_ctrl.arvalid,
+            s_axi_ctrl_arready	=> s_axi_nca_ctrl.arready,
+            s_axi_ctrl_rdata	=> s_axi_nca_ctrl.rdata,
+            s_axi_ctrl_rresp	=> open,
+            s_axi_ctrl_rvalid	=> s_axi_nca_ctrl.rvalid,
+            s_axi_ctrl_rready	=> s_axi_nca_ctrl.rready,
+    
             -- Ports of Axi Slave Bus Interface S_AXIS_INPUT
             s_axis_input_aclk	    => axi_aclk,
             s_axis_input_aresetn	=> axi_aresetn,
@@ -272,11 +421,11 @@ begin
             -- Ports of Axi Slave Bus Interface S_AXIS_ENVELOPE
             s_axis_envelope_aclk	    => axi_aclk,
             s_axis_envelope_aresetn	    => axi_aresetn,
-            s_axis_envelope_tready	    => m_axis_adsr_output.tready,
+            s_axis_envelope_tready	    => w_nca_envelope_tready,
             s_axis_envelope_tdata	    => m_axis_adsr_output.tdata,
             s_axis_envelope_tstrb	    => (others => '0'),
             s_axis_envelope_tlast	    => '0',
-            s_axis_envelope_tvalid	    => m_axis_adsr_output.tvalid,
+            s_axis_envelope_tvalid	    => w_nca_envelope_tvalid,
     
             -- Ports of Axi Master Bus Interface M_AXIS_OUTPUT
             m_axis_output_aclk	    => axi_aclk,
@@ -288,4 +437,20 @@ begin
             m_axis_output_tready	=> m_axis_nca_output.tready
         );
 
-end tb;
\ No newline at end of file
+    -- clocks from i_en to the last channel out, checked against g_CYCLE_BUDGET
+    cycle_budget : if g_CYCLE_BUDGET > 0 generate
+        nca_budget : entity work.cycle_budget_monitor
+        generic map(
+            g_NAME      => "multiplier",
+            g_NUM_BEATS => C_NUM_CHANNELS,
+            g_BUDGET    => g_CYCLE_BUDGET
+        )
+        port map(
+            i_clk    => axi_aclk,
+            i_en     => enable,
+            i_tvalid => m_axis_nca_output.tvalid,
+            i_tready => m_axis_nca_output.tready
+        );
+    end generate;
+
+end tb;
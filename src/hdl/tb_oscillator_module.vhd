@@ -7,6 +7,11 @@ use work.axi_sim_package.all;
 use work.synth_module_sim_package.all;
 
 entity tb_oscillator_module is
+    generic(
+        g_NUM_CHANNELS  : integer := 2;
+        g_SAMPLE_CYCLES : integer := 21;   -- clocks from one i_en to the next
+        g_CYCLE_BUDGET  : integer := 0     -- clocks per sample period the modules must meet, 0 does not check
+    );
 end tb_oscillator_module;
 
 architecture tb of tb_oscillator_module is
@@ -16,7 +21,7 @@ architecture tb of tb_oscillator_module is
     signal finished : std_logic := '0';
     
     -- oscillator module constants
-    constant c_NUM_CHANNELS    : integer := 2;
+    constant c_NUM_CHANNELS    : integer := g_NUM_CHANNELS;
     constant c_NUM_OSCILLATORS : integer := 3;
     constant c_DATA_WIDTH      : integer := 24;
     
@@ -42,7 +47,7 @@ begin
     process
     begin
         enable <= '0';
-        for i in 0 to 19 loop
+        for i in 0 to g_SAMPLE_CYCLES-2 loop
             wait until rising_edge(axi_aclk);
         end loop;
         enable <= '1';
@@ -81,6 +86,15 @@ begin
         osc_set_waveform(axi_aclk, s_axi_ctrl_wr, 0, SQUARE);
        osc_set_pulse_width(axi_aclk, s_axi_ctrl_wr, 0, 0.75);
 
+        for i in 0 to 2000 loop
+            wait until rising_edge(enable);
+        end loop; 
+
+        -- unison, both channels play the same note 20 cents apart
+        osc_set_waveform(axi_aclk, s_axi_ctrl_wr, 0, SAW);
+        osc_set_frequency(axi_aclk, s_axi_ctrl_wr, 1, 250.0);
+        osc_set_unison(axi_aclk, s_axi_ctrl_wr, 2, 10.0);
+
         for i in 0 to 2000 loop
             wait until rising_edge(enable);
         end loop; 
@@ -117,7 +131,7 @@ begin
 		-- Ports of Axi Slave Bus Interface S_AXI_CTRL
 		s_axi_ctrl_aclk	    => axi_aclk,
 		s_axi_ctrl_aresetn	=> axi_aresetn,
-		s_axi_ctrl_awaddr	=> s_axi_ctrl_wr.awaddr,
+		s_axi_ctrl_awaddr	=> s_axi_ctrl_wr.awaddr(5 downto 0),
 		s_axi_ctrl_awprot	=> (others => '0'),
 		s_axi_ctrl_awvalid	=> s_axi_ctrl_wr.awvalid,
 		s_axi_ctrl_awready	=> s_axi_ctrl_wr.awready,
@@ -137,6 +151,45 @@ begin
 		s_axi_ctrl_rvalid	=> open,
 		s_axi_ctrl_rready	=> '0',
 
+		-- Ports of Axi Slave Bus Interface S_AXI_PARAM
+		s_axi_param_aclk	=> axi_aclk,
+		s_axi_param_aresetn	=> axi_aresetn,
+		s_axi_param_awid	=> (others => '0'),
+		s_axi_param_awaddr	=> (others => '0'),
+		s_axi_param_awlen	=> (others => '0'),
+		s_axi_param_awsize	=> (others => '0'),
+		s_axi_param_awburst	=> (others => '0'),
+		s_axi_param_awlock	=> '0',
+		s_axi_param_awcache	=> (others => '0'),
+		s_axi_param_awprot	=> (others => '0'),
+		s_axi_param_awvalid	=> '0',
+		s_axi_param_awready	=> open,
+		s_axi_param_wdata	=> (others => '0'),
+		s_axi_param_wstrb	=> (others => '1'),
+		s_axi_param_wlast	=> '0',
+		s_axi_param_wvalid	=> '0',
+		s_axi_param_wready	=> open,
+		s_axi_param_bid	=> open,
+		s_axi_param_bresp	=> open,
+		s_axi_param_bvalid	=> open,
+		s_axi_param_bready	=> '0',
+		s_axi_param_arid	=> (others => '0'),
+		s_axi_param_araddr	=> (others => '0'),
+		s_axi_param_arlen	=> (others => '0'),
+		s_axi_param_arsize	=> (others => '0'),
+		s_axi_param_arburst	=> (others => '0'),
+		s_axi_param_arlock	=> '0',
+		s_axi_param_arcache	=> (others => '0'),
+		s_axi_param_arprot	=> (others => '0'),
+		s_axi_param_arvalid	=> '0',
+		s_axi_param_arready	=> open,
+		s_axi_param_rid	=> open,
+		s_axi_param_rdata	=> open,
+		s_axi_param_rresp	=> open,
+		s_axi_param_rlast	=> open,
+		s_axi_param_rvalid	=> open,
+		s_axi_param_rready	=> '0',
+
 		-- Ports of Axi Master Bus Interface M_AXIS_OUTPUT
 		m_axis_output_aclk	    => axi_aclk,
 		m_axis_output_aresetn	=> axi_aresetn,
@@ -165,5 +218,20 @@ begin
 		s_axis_pwm_tvalid	=> '0'
 	);
 
+    -- clocks from i_en to the last channel out, checked against g_CYCLE_BUDGET
+    cycle_budget : if g_CYCLE_BUDGET > 0 generate
+        oscillator_budget : entity work.cycle_budget_monitor
+        generic map(
+            g_NAME      => "oscillator",
+            g_NUM_BEATS => c_NUM_CHANNELS,
+            g_BUDGET    => g_CYCLE_BUDGET
+        )
+        port map(
+            i_clk    => axi_aclk,
+            i_en     => enable,
+            i_tvalid => m_axis_output.tvalid,
+            i_tready => m_axis_output.tready
+        );
+    end generate;
 
-end tb;
\ No newline at end of file
+end tb;
@@ -0,0 +1,229 @@
+library ieee;
+use ieee.std_logic_1164.all;
+use ieee.numeric_std.all;
+use ieee.math_real.all;
+
+use work.axi_sim_package.all;
+use work.synth_module_sim_package.all;
+
+entity tb_param_stream_module is
+end tb_param_stream_module;
+
+architecture tb of tb_param_stream_module is
+
+    -- simulation variables
+    constant T : time := 10 ns;
+    signal finished : std_logic := '0';
+
+    -- lfo module constants
+    constant c_NUM_CHANNELS : integer := 2;
+    constant c_DATA_WIDTH   : integer := 24;
+
+    -- parameter stream constants
+    constant c_LFO_BASE_ADDR : integer := 16#43C50000#;
+    constant c_LFO_TARGET    : integer := 4;
+
+    -- signals
+    signal axi_aclk      : std_logic := '0';
+    signal axi_aresetn   : std_logic;
+    signal enable        : std_logic;
+
+    type t_data_array is array (0 to C_NUM_CHANNELS-1) of std_logic_vector(c_DATA_WIDTH-1 downto 0);
+    signal r_lfo_output_array : t_data_array := (others => (others => '0'));
+
+    signal s_axi_param_stream_ctrl : t_axi_slave := C_INIT_AXI_SLAVE;
+
+    -- command stream, driven by the AXI DMA MM2S on hardware
+    signal s_axis_cmd_tvalid : std_logic := '0';
+    signal s_axis_cmd_tdata  : std_logic_vector(63 downto 0) := (others => '0');
+    signal s_axis_cmd_tready : std_logic;
+
+    -- write master of the parameter stream to the lfo control interface
+    signal m_axi : t_axi_slave := C_INIT_AXI_SLAVE;
+    signal m_axi_awaddr : std_logic_vector(31 downto 0);
+
+    signal m_axis_lfo_output : t_axi_stream_slave;
+
+    procedure send_command(signal axi_aclk  : in std_logic;
+                           signal tvalid    : out std_logic;
+                           signal tdata     : out std_logic_vector(63 downto 0);
+                           signal tready    : in std_logic;
+                           constant target  : in integer;
+                           constant reg     : in integer;
+                           constant value   : in std_logic_vector(31 downto 0)) is
+    begin
+        tdata(63 downto 51) <= (others => '0');
+        tdata(50 downto 48) <= std_logic_vector(to_unsigned(target, 3));
+        tdata(47 downto 32) <= std_logic_vector(to_unsigned(reg*4, 16));
+        tdata(31 downto 0)  <= value;
+        tvalid <= '1';
+        wait until rising_edge(axi_aclk) and tready = '1';
+        tvalid <= '0';
+    end procedure;
+
+begin
+
+    -- generate clk and resetn
+    axi_aclk    <= not axi_aclk after T/2 when finished /= '1' else '0';
+    axi_aresetn <= '0', '1' after T;
+
+    -- generate module enable
+    process
+    begin
+        enable <= '0';
+        for i in 0 to 19 loop
+            wait until rising_edge(axi_aclk);
+        end loop;
+        enable <= '1';
+        wait until rising_edge(axi_aclk);
+    end process;
+
+    -- main process
+    process
+        variable status : std_logic_vector(31 downto 0);
+    begin
+        -- base address table, written once by the firmware
+        s_axi_write(axi_aclk, s_axi_param_stream_ctrl, PARAM_STREAM_TARGET_BASE_REG+c_LFO_TARGET,
+                    std_logic_vector(to_unsigned(c_LFO_BASE_ADDR, 32)));
+
+        -- patch load as one burst of commands
+        send_command(axi_aclk, s_axis_cmd_tvalid, s_axis_cmd_tdata, s_axis_cmd_tready, c_LFO_TARGET, LFO_AMOUNT_REG,
+                     std_logic_vector(to_unsigned(integer(0.8 * 2.0**15.0), 32)));
+        send_command(axi_aclk, s_axis_cmd_tvalid, s_axis_cmd_tdata, s_axis_cmd_tready, c_LFO_TARGET, LFO_RATE_REG,
+                     std_logic_vector(to_unsigned(integer((2.0**24.0-1.0)/AUDIO_FREQUENCY/0.02), 32)));
+        send_command(axi_aclk, s_axis_cmd_tvalid, s_axis_cmd_tdata, s_axis_cmd_tready, c_LFO_TARGET, LFO_WAVEFORM_REG,
+                     std_logic_vector(to_unsigned(2, 32))); -- triangle
+        send_command(axi_aclk, s_axis_cmd_tvalid, s_axis_cmd_tdata, s_axis_cmd_tready, c_LFO_TARGET, LFO_POLYPHONY_ENABLE_REG,
+                     (others => '0'));
+        send_command(axi_aclk, s_axis_cmd_tvalid, s_axis_cmd_tdata, s_axis_cmd_tready, c_LFO_TARGET, LFO_VOICE_ON_OFF_REG,
+                     std_logic_vector(to_unsigned(1*2**8+1*2**7+0, 32))); -- voice 0 on
+
+        -- wait for the commands to be written
+        loop
+            s_axi_read(axi_aclk, s_axi_param_stream_ctrl, PARAM_STREAM_BUSY_REG, status);
+            exit when status(0) = '0';
+        end loop;
+
+        s_axi_read(axi_aclk, s_axi_param_stream_ctrl, PARAM_STREAM_STATUS_REG, status);
+        assert unsigned(status(15 downto 0)) = 5
+            report "parameter stream command count " & integer'image(to_integer(unsigned(status(15 downto 0)))) & ", expected 5"
+            severity error;
+        assert unsigned(status(31 downto 16)) = 0
+            report "parameter stream write errors" severity error;
+
+        for i in 0 to 3000 loop
+            wait until rising_edge(enable);
+        end loop;
+
+        finished <= '1';
+    end process;
+
+    -- receive lfo output process
+    process(axi_aclk)
+        variable index : integer := 0;
+    begin
+        m_axis_lfo_output.tready <= '1';
+        if rising_edge(axi_aclk) then
+            if m_axis_lfo_output.tvalid = '1' then
+                r_lfo_output_array(index) <= m_axis_lfo_output.tdata(r_lfo_output_array(index)'range);
+                index := index + 1;
+                if index = c_NUM_CHANNELS then
+                    index := 0;
+                end if;
+            end if;
+        end if;
+    end process;
+
+    -- instantiate parameter stream module
+    param_stream_module : entity work.Param_Stream_v1_0
+    port map (
+		-- Ports of Axi Slave Bus Interface S_AXI_CTRL
+		s_axi_ctrl_aclk	    => axi_aclk,
+		s_axi_ctrl_aresetn	=> axi_aresetn,
+		s_axi_ctrl_awaddr	=> s_axi_param_stream_ctrl.awaddr(5 downto 0),
+		s_axi_ctrl_awprot	=> (others => '0'),
+		s_axi_ctrl_awvalid	=> s_axi_param_stream_ctrl.awvalid,
+		s_axi_ctrl_awready	=> s_axi_param_stream_ctrl.awready,
+		s_axi_ctrl_wdata	=> s_axi_param_stream_ctrl.wdata,
+		s_axi_ctrl_wstrb	=> (others => '1'),
+		s_axi_ctrl_wvalid	=> s_axi_param_stream_ctrl.wvalid,
+		s_axi_ctrl_wready	=> s_axi_param_stream_ctrl.wready,
+		s_axi_ctrl_bresp	=> open,
+		s_axi_ctrl_bvalid	=> s_axi_param_stream_ctrl.bvalid,
+		s_axi_ctrl_bready	=> s_axi_param_stream_ctrl.bready,
+		s_axi_ctrl_araddr	=> s_axi_param_stream_ctrl.araddr(5 downto 0),
+		s_axi_ctrl_arprot	=> (others => '0'),
+		s_axi_ctrl_arvalid	=> s_axi_param_stream_ctrl.arvalid,
+		s_axi_ctrl_arready	=> s_axi_param_stream_ctrl.arready,
+		s_axi_ctrl_rdata	=> s_axi_param_stream_ctrl.rdata,
+		s_axi_ctrl_rresp	=> open,
+		s_axi_ctrl_rvalid	=> s_axi_param_stream_ctrl.rvalid,
+		s_axi_ctrl_rready	=> s_axi_param_stream_ctrl.rready,
+
+		-- Ports of Axi Slave Bus Interface S_AXIS_CMD
+		s_axis_cmd_aclk	    => axi_aclk,
+		s_axis_cmd_aresetn	=> axi_aresetn,
+		s_axis_cmd_tready	=> s_axis_cmd_tready,
+		s_axis_cmd_tdata	=> s_axis_cmd_tdata,
+		s_axis_cmd_tstrb	=> (others => '1'),
+		s_axis_cmd_tlast	=> '0',
+		s_axis_cmd_tvalid	=> s_axis_cmd_tvalid,
+
+		-- Ports of Axi Master Bus Interface M_AXI
+		m_axi_aclk	    => axi_aclk,
+		m_axi_aresetn	=> axi_aresetn,
+		m_axi_awaddr	=> m_axi_awaddr,
+		m_axi_awprot	=> open,
+		m_axi_awvalid	=> m_axi.awvalid,
+		m_axi_awready	=> m_axi.awready,
+		m_axi_wdata	    => m_axi.wdata,
+		m_axi_wstrb	    => open,
+		m_axi_wvalid	=> m_axi.wvalid,
+		m_axi_wready	=> m_axi.wready,
+		m_axi_bresp	    => "00",
+		m_axi_bvalid	=> m_axi.bvalid,
+		m_axi_bready	=> m_axi.bready
+    );
+
+    -- instantiate lfo module, only the register offset reaches the slave as in the interconnect
+    lfo_module : entity work.LFO_v1_0
+        generic map(
+            g_NUM_CHANNELS => c_NUM_CHANNELS
+        )
+        port map(
+            i_enable            => enable,
+
+            -- Ports of Axi Slave Bus Interface S_AXI_CTRL
+            s_axi_ctrl_aclk	    => axi_aclk,
+            s_axi_ctrl_aresetn	=> axi_aresetn,
+            s_axi_ctrl_awaddr	=> m_axi_awaddr(6 downto 0),
+            s_axi_ctrl_awprot	=> (others => '0'),
+            s_axi_ctrl_awvalid	=> m_axi.awvalid,
+            s_axi_ctrl_awready	=> m_axi.awready,
+            s_axi_ctrl_wdata	=> m_axi.wdata,
+            s_axi_ctrl_wstrb	=> (others => '1'),
+            s_axi_ctrl_wvalid	=> m_axi.wvalid,
+            s_axi_ctrl_wready	=> m_axi.wready,
+            s_axi_ctrl_bresp	=> open,
+            s_axi_ctrl_bvalid	=> m_axi.bvalid,
+            s_axi_ctrl_bready	=> m_axi.bready,
+            s_axi_ctrl_araddr	=> (others => '0'),
+            s_axi_ctrl_arprot	=> (others => '0'),
+            s_axi_ctrl_arvalid	=> '0',
+            s_axi_ctrl_arready	=> open,
+            s_axi_ctrl_rdata	=> open,
+            s_axi_ctrl_rresp	=> open,
+            s_axi_ctrl_rvalid	=> open,
+            s_axi_ctrl_rready	=> '0',
+
+            -- Ports of Axi Master Bus Interface M_AXIS_OUTPUT
+            m_axis_output_aclk	    => axi_aclk,
+            m_axis_output_aresetn	=> axi_aresetn,
+            m_axis_output_tvalid	=> m_axis_lfo_output.tvalid,
+            m_axis_output_tdata	    => m_axis_lfo_output.tdata,
+            m_axis_output_tstrb	    => open,
+            m_axis_output_tlast	    => open,
+            m_axis_output_tready	=> m_axis_lfo_output.tready
+        );
+
+end tb;
@@ -5,8 +5,16 @@ use ieee.math_real.all;
 
 use work.axi_sim_package.all;
 use work.synth_module_sim_package.all;
+use work.synth_config_package.all;
 
 entity tb_system is
+    generic(
+        g_NUM_CHANNELS  : integer := 8;
+        g_SAMPLE_CYCLES : integer := 32;   -- clocks from one i_en to the next
+        g_CYCLE_BUDGET  : integer := 0;    -- clocks per sample period the modules must meet, 0 does not check
+        g_SCRIPT        : string  := "";   -- register script run instead of the stimulus below
+        g_LOG_DIR       : string  := ""    -- directory of the stream logs, "" does not log
+    );
 end tb_system;
 
 architecture tb of tb_system is
@@ -16,7 +24,7 @@ architecture tb of tb_system is
     signal finished : std_logic := '0';
     
     -- constants
-    constant C_NUM_CHANNELS    : integer := 8;
+    constant C_NUM_CHANNELS    : integer := g_NUM_CHANNELS;
     constant C_NUM_OSCILLATORS : integer := 2;
     constant C_DATA_WIDTH      : integer := 24;
     
@@ -38,14 +46,16 @@ architecture tb of tb_system is
     signal m_axis_adsr_output : t_axi_stream_slave;
     signal m_axis_nca_output  : t_axi_stream_slave;
     signal m_axis_filter_output  : t_axi_stream_slave;
+    signal m_axis_mixer_output   : t_axi_stream_slave;
     -- output arrays
     signal r_osc_output_array  : t_data_array := (others => (others => '0'));
     signal r_adsr_output_array : t_data_array := (others => (others => '0'));
     signal r_nca_output_array  : t_data_array := (others => (others => '0'));
     signal r_filter_output_array  : t_data_array := (others => (others => '0'));
     --
-    signal w_active_channels   : std_logic_vector(6 downto 0);
+    signal w_active_channels   : std_logic_vector(c_COUNT_WIDTH-1 downto 0);
     signal w_mixer_output      : std_logic_vector(23 downto 0);
+    signal w_mixer_output_valid : std_logic;
           
 begin
     
@@ -53,67 +63,80 @@ begin
     axi_aclk    <= not axi_aclk after T/2 when finished /= '1' else '0';
     axi_aresetn <= '0', '1' after T;
     
-    -- generate module enable
-    process
-    begin
-        enable <= '0';
-        for i in 0 to 30 loop
+    stimulus : if g_SCRIPT = "" generate
+        -- generate module enable
+        process
+        begin
+            enable <= '0';
+            for i in 0 to g_SAMPLE_CYCLES-2 loop
+                wait until rising_edge(axi_aclk);
+            end loop;
+            enable <= '1';
             wait until rising_edge(axi_aclk);
-        end loop;
-        enable <= '1';
-        wait until rising_edge(axi_aclk);
-    end process;
+        end process;
     
-    -- main process
-    process
-    begin
-        -- configure oscillator
-        osc_set_frequency(axi_aclk, s_axi_osc_ctrl, 0, 500.0);
-        osc_set_frequency(axi_aclk, s_axi_osc_ctrl, 1, 500.0);
-        osc_set_frequency(axi_aclk, s_axi_osc_ctrl, 2, 500.0);
-        osc_set_frequency(axi_aclk, s_axi_osc_ctrl, 3, 500.0);
-        osc_set_waveform(axi_aclk, s_axi_osc_ctrl, 0, SINE);
-        osc_set_amplitude(axi_aclk, s_axi_osc_ctrl, 0, 1.0);
-        osc_set_amplitude(axi_aclk, s_axi_osc_ctrl, 1, 0.0);
-
-        -- configure adsr
-        adsr_set_sustain_level(axi_aclk, s_axi_adsr_ctrl, 0.7);
-        adsr_set_attack_time(axi_aclk, s_axi_adsr_ctrl, 0.01);
-        adsr_set_decay_time(axi_aclk, s_axi_adsr_ctrl, 0.005);
-        adsr_set_release_time(axi_aclk, s_axi_adsr_ctrl, 0.02);
+        -- main process
+        process
+        begin
+            -- configure oscillator
+            osc_set_frequency(axi_aclk, s_axi_osc_ctrl, 0, 500.0);
+            osc_set_frequency(axi_aclk, s_axi_osc_ctrl, 1, 500.0);
+            osc_set_frequency(axi_aclk, s_axi_osc_ctrl, 2, 500.0);
+            osc_set_frequency(axi_aclk, s_axi_osc_ctrl, 3, 500.0);
+            osc_set_waveform(axi_aclk, s_axi_osc_ctrl, 0, SINE);
+            osc_set_amplitude(axi_aclk, s_axi_osc_ctrl, 0, 1.0);
+            osc_set_amplitude(axi_aclk, s_axi_osc_ctrl, 1, 0.0);
+
+            -- configure adsr
+            adsr_set_sustain_level(axi_aclk, s_axi_adsr_ctrl, 0.7);
+            adsr_set_attack_time(axi_aclk, s_axi_adsr_ctrl, 0.01);
+            adsr_set_decay_time(axi_aclk, s_axi_adsr_ctrl, 0.005);
+            adsr_set_release_time(axi_aclk, s_axi_adsr_ctrl, 0.02);
         
-        -- configure filter
-        filter_set_cutoff_frequency(axi_aclk, s_axi_filter_ctrl, 20000.0);
-		filter_set_resonance(axi_aclk, s_axi_filter_ctrl, 0.0);
+            -- configure filter
+            filter_set_cutoff_frequency(axi_aclk, s_axi_filter_ctrl, 20000.0);
+    		filter_set_resonance(axi_aclk, s_axi_filter_ctrl, 0.0);
 
-        adsr_set_voice_on(axi_aclk, s_axi_adsr_ctrl, 0);
+            adsr_set_voice_on(axi_aclk, s_axi_adsr_ctrl, 0);
 
-        for i in 0 to 1000 loop
-            wait until rising_edge(enable);
-        end loop; 
+            for i in 0 to 1000 loop
+                wait until rising_edge(enable);
+            end loop; 
 
-        adsr_set_voice_on(axi_aclk, s_axi_adsr_ctrl, 1);
+            adsr_set_voice_on(axi_aclk, s_axi_adsr_ctrl, 1);
 
-        for i in 0 to 1000 loop
-            wait until rising_edge(enable);
-        end loop; 
+            for i in 0 to 1000 loop
+                wait until rising_edge(enable);
+            end loop; 
         
-        adsr_set_voice_on(axi_aclk, s_axi_adsr_ctrl, 2);
-        adsr_set_voice_off(axi_aclk, s_axi_adsr_ctrl, 0);
+            adsr_set_voice_on(axi_aclk, s_axi_adsr_ctrl, 2);
+            adsr_set_voice_off(axi_aclk, s_axi_adsr_ctrl, 0);
 
-        for i in 0 to 1000 loop
-            wait until rising_edge(enable);
-        end loop;
+            for i in 0 to 1000 loop
+                wait until rising_edge(enable);
+            end loop;
 
-        adsr_set_voice_on(axi_aclk, s_axi_adsr_ctrl, 3);
-        adsr_set_voice_off(axi_aclk, s_axi_adsr_ctrl, 1);
+            adsr_set_voice_on(axi_aclk, s_axi_adsr_ctrl, 3);
+            adsr_set_voice_off(axi_aclk, s_axi_adsr_ctrl, 1);
 
-        for i in 0 to 3000 loop
-            wait until rising_edge(enable);
-        end loop;
+            for i in 0 to 3000 loop
+                wait until rising_edge(enable);
+            end loop;
         
-        finished <= '1';
-    end process;
+            finished <= '1';
+        end process;
+    end generate;
+
+    -- i_en and the register writes of the script, see model/src/register_script.h
+    script : if g_SCRIPT /= "" generate
+        process
+        begin
+            run_register_script(axi_aclk, enable, s_axi_osc_ctrl, s_axi_adsr_ctrl, s_axi_filter_ctrl,
+                                g_SAMPLE_CYCLES, g_SCRIPT);
+            finished <= '1';
+            wait;
+        end process;
+    end generate;
     
     -- receive oscillator output process
     process(axi_aclk)
@@ -193,7 +216,7 @@ begin
 		-- Ports of Axi Slave Bus Interface S_AXI_CTRL
 		s_axi_ctrl_aclk	    => axi_aclk,
 		s_axi_ctrl_aresetn	=> axi_aresetn,
-		s_axi_ctrl_awaddr	=> s_axi_osc_ctrl.awaddr,
+		s_axi_ctrl_awaddr	=> s_axi_osc_ctrl.awaddr(5 downto 0),
 		s_axi_ctrl_awprot	=> (others => '0'),
 		s_axi_ctrl_awvalid	=> s_axi_osc_ctrl.awvalid,
 		s_axi_ctrl_awready	=> s_axi_osc_ctrl.awready,
@@ -213,6 +236,45 @@ begin
 		s_axi_ctrl_rvalid	=> open,
 		s_axi_ctrl_rready	=> '0',
 
+		-- Ports of Axi Slave Bus Interface S_AXI_PARAM
+		s_axi_param_aclk	=> axi_aclk,
+		s_axi_param_aresetn	=> axi_aresetn,
+		s_axi_param_awid	=> (others => '0'),
+		s_axi_param_awaddr	=> (others => '0'),
+		s_axi_param_awlen	=> (others => '0'),
+		s_axi_param_awsize	=> (others => '0'),
+		s_axi_param_awburst	=> (others => '0'),
+		s_axi_param_awlock	=> '0',
+		s_axi_param_awcache	=> (others => '0'),
+		s_axi_param_awprot	=> (others => '0'),
+		s_axi_param_awvalid	=> '0',
+		s_axi_param_awready	=> open,
+		s_axi_param_wdata	=> (others => '0'),
+		s_axi_param_wstrb	=> (others => '1'),
+		s_axi_param_wlast	=> '0',
+		s_axi_param_wvalid	=> '0',
+		s_axi_param_wready	=> open,
+		s_axi_param_bid	=> open,
+		s_axi_param_bresp	=> open,
+		s_axi_param_bvalid	=> open,
+		s_axi_param_bready	=> '0',
+		s_axi_param_arid	=> (others => '0'),
+		s_axi_param_araddr	=> (others => '0'),
+		s_axi_param_arlen	=> (others => '0'),
+		s_axi_param_arsize	=> (others => '0'),
+		s_axi_param_arburst	=> (others => '0'),
+		s_axi_param_arlock	=> '0',
+		s_axi_param_arcache	=> (others => '0'),
+		s_axi_param_arprot	=> (others => '0'),
+		s_axi_param_arvalid	=> '0',
+		s_axi_param_arready	=> open,
+		s_axi_param_rid	=> open,
+		s_axi_param_rdata	=> open,
+		s_axi_param_rresp	=> open,
+		s_axi_param_rlast	=> open,
+		s_axi_param_rvalid	=> open,
+		s_axi_param_rready	=> '0',
+
 		-- Ports of Axi Master Bus Interface M_AXIS_OUTPUT
 		m_axis_output_aclk	    => axi_aclk,
 		m_axis_output_aresetn	=> axi_aresetn,
@@ -250,11 +312,12 @@ begin
         -- Users to add ports here
         i_enable                => enable,
         o_active_channel_count  => w_active_channels,
+        o_voice_freed_irq       => open,
 
         -- Ports of Axi Slave Bus Interface S_AXI_CTRL
         s_axi_ctrl_aclk	    => axi_aclk,
 		s_axi_ctrl_aresetn	=> axi_aresetn,
-		s_axi_ctrl_awaddr	=> s_axi_adsr_ctrl.awaddr,
+		s_axi_ctrl_awaddr	=> s_axi_adsr_ctrl.awaddr(6 downto 0),
 		s_axi_ctrl_awprot	=> (others => '0'),
 		s_axi_ctrl_awvalid	=> s_axi_adsr_ctrl.awvalid,
 		s_axi_ctrl_awready	=> s_axi_adsr_ctrl.awready,
@@ -265,7 +328,7 @@ begin
 		s_axi_ctrl_bresp	=> open,
 		s_axi_ctrl_bvalid	=> s_axi_adsr_ctrl.bvalid,
 		s_axi_ctrl_bready	=> s_axi_adsr_ctrl.bready,
-		s_axi_ctrl_araddr	=> s_axi_adsr_ctrl.araddr,
+		s_axi_ctrl_araddr	=> s_axi_adsr_ctrl.araddr(6 downto 0),
 		s_axi_ctrl_arprot	=> (others => '0'),
 		s_axi_ctrl_arvalid	=> s_axi_adsr_ctrl.arvalid,
 		s_axi_ctrl_arready	=> s_axi_adsr_ctrl.arready,
@@ -274,6 +337,45 @@ begin
 		s_axi_ctrl_rvalid	=> s_axi_adsr_ctrl.rvalid,
 		s_axi_ctrl_rready	=> s_axi_adsr_ctrl.rready,
 
+		-- Ports of Axi Slave Bus Interface S_AXI_PARAM
+		s_axi_param_aclk	=> axi_aclk,
+		s_axi_param_aresetn	=> axi_aresetn,
+		s_axi_param_awid	=> (others => '0'),
+		s_axi_param_awaddr	=> (others => '0'),
+		s_axi_param_awlen	=> (others => '0'),
+		s_axi_param_awsize	=> (others => '0'),
+		s_axi_param_awburst	=> (others => '0'),
+		s_axi_param_awlock	=> '0',
+		s_axi_param_awcache	=> (others => '0'),
+		s_axi_param_awprot	=> (others => '0'),
+		s_axi_param_awvalid	=> '0',
+		s_axi_param_awready	=> open,
+		s_axi_param_wdata	=> (others => '0'),
+		s_axi_param_wstrb	=> (others => '1'),
+		s_axi_param_wlast	=> '0',
+		s_axi_param_wvalid	=> '0',
+		s_axi_param_wready	=> open,
+		s_axi_param_bid	=> open,
+		s_axi_param_bresp	=> open,
+		s_axi_param_bvalid	=> open,
+		s_axi_param_bready	=> '0',
+		s_axi_param_arid	=> (others => '0'),
+		s_axi_param_araddr	=> (others => '0'),
+		s_axi_param_arlen	=> (others => '0'),
+		s_axi_param_arsize	=> (others => '0'),
+		s_axi_param_arburst	=> (others => '0'),
+		s_axi_param_arlock	=> '0',
+		s_axi_param_arcache	=> (others => '0'),
+		s_axi_param_arprot	=> (others => '0'),
+		s_axi_param_arvalid	=> '0',
+		s_axi_param_arready	=> open,
+		s_axi_param_rid	=> open,
+		s_axi_param_rdata	=> open,
+		s_axi_param_rresp	=> open,
+		s_axi_param_rlast	=> open,
+		s_axi_param_rvalid	=> open,
+		s_axi_param_rready	=> '0',
+
         -- Ports of Axi Master Bus Interface M_AXIS_OUTPUT
         m_axis_output_aclk	    => axi_aclk,
 		m_axis_output_aresetn	=> axi_aresetn,
@@ -292,6 +394,29 @@ begin
             -- Users to add ports here
             i_enable => enable,
     
+            -- Ports of Axi Slave Bus Interface S_AXI_CTRL
+            s_axi_ctrl_aclk	    => axi_aclk,
+            s_axi_ctrl_aresetn	=> axi_aresetn,
+            s_axi_ctrl_awaddr	=> (others => '0'),
+            s_axi_ctrl_awprot	=> (others => '0'),
+            s_axi_ctrl_awvalid	=> '0',
+            s_axi_ctrl_awready	=> open,
+            s_axi_ctrl_wdata	=> (others => '0'),
+            s_axi_ctrl_wstrb	=> (others => '1'),
+            s_axi_ctrl_wvalid	=> '0',
+            s_axi_ctrl_wready	=> open,
+            s_axi_ctrl_bresp	=> open,
+            s_axi_ctrl_bvalid	=> open,
+            s_axi_ctrl_bready	=> '0',
+            s_axi_ctrl_araddr	=> (others => '0'),
+            s_axi_ctrl_arprot	=> (others => '0'),
+            s_axi_ctrl_arvalid	=> '0',
+            s_axi_ctrl_arready	=> open,
+            s_axi_ctrl_rdata	=> open,
+            s_axi_ctrl_rresp	=> open,
+            s_axi_ctrl_rvalid	=> open,
+            s_axi_ctrl_rready	=> '0',
+    
             -- Ports of Axi Slave Bus Interface S_AXIS_INPUT
             s_axis_input_aclk	    => axi_aclk,
             s_axis_input_aresetn	=> axi_aresetn,
@@ -333,7 +458,7 @@ begin
 		-- Ports of Axi Slave Bus Interface S_AXI_CTRL
 		s_axi_ctrl_aclk	    => axi_aclk,
 		s_axi_ctrl_aresetn	=> axi_aresetn,
-		s_axi_ctrl_awaddr	=> s_axi_filter_ctrl.awaddr,
+		s_axi_ctrl_awaddr	=> s_axi_filter_ctrl.awaddr(5 downto 0),
 		s_axi_ctrl_awprot	=> (others => '0'),
 		s_axi_ctrl_awvalid	=> s_axi_filter_ctrl.awvalid,
 		s_axi_ctrl_awready	=> s_axi_filter_ctrl.awready,
@@ -398,6 +523,30 @@ begin
         i_en                => enable,
         i_active_channels   => w_active_channels,
         o_output            => w_mixer_output,
+        o_output_valid      => w_mixer_output_valid,
+
+        -- Ports of Axi Slave Bus Interface S_AXI_CTRL, mono mix
+        s_axi_ctrl_aclk	    => axi_aclk,
+        s_axi_ctrl_aresetn	=> axi_aresetn,
+        s_axi_ctrl_awaddr	=> (others => '0'),
+        s_axi_ctrl_awprot	=> (others => '0'),
+        s_axi_ctrl_awvalid	=> '0',
+        s_axi_ctrl_awready	=> open,
+        s_axi_ctrl_wdata	=> (others => '0'),
+        s_axi_ctrl_wstrb	=> (others => '0'),
+        s_axi_ctrl_wvalid	=> '0',
+        s_axi_ctrl_wready	=> open,
+        s_axi_ctrl_bresp	=> open,
+        s_axi_ctrl_bvalid	=> open,
+        s_axi_ctrl_bready	=> '0',
+        s_axi_ctrl_araddr	=> (others => '0'),
+        s_axi_ctrl_arprot	=> (others => '0'),
+        s_axi_ctrl_arvalid	=> '0',
+        s_axi_ctrl_arready	=> open,
+        s_axi_ctrl_rdata	=> open,
+        s_axi_ctrl_rresp	=> open,
+        s_axi_ctrl_rvalid	=> open,
+        s_axi_ctrl_rready	=> '0',
 
         -- Ports of Axi Slave Bus Interface S_AXIS_INPUT
         s_axis_input_aclk	    => axi_aclk,
@@ -408,4 +557,87 @@ begin
         s_axis_input_tlast	    => '0',
         s_axis_input_tvalid	    => m_axis_filter_output.tvalid
         );
-end tb;
\ No newline at end of file
+
+    -- the mixer output as a stream that is always ready
+    m_axis_mixer_output.tvalid <= w_mixer_output_valid;
+    m_axis_mixer_output.tdata  <= std_logic_vector(resize(signed(w_mixer_output), 32));
+    m_axis_mixer_output.tready <= '1';
+
+    -- every transfer of the module outputs, compared with the models by synth_compare
+    stream_log : if g_LOG_DIR /= "" generate
+        oscillator_log : axis_log(axi_aclk, enable, m_axis_osc_output, C_DATA_WIDTH, g_LOG_DIR & "/oscillator.log");
+        adsr_log       : axis_log(axi_aclk, enable, m_axis_adsr_output, C_DATA_WIDTH, g_LOG_DIR & "/adsr.log");
+        nca_log        : axis_log(axi_aclk, enable, m_axis_nca_output, C_DATA_WIDTH, g_LOG_DIR & "/nca.log");
+        filter_log     : axis_log(axi_aclk, enable, m_axis_filter_output, C_DATA_WIDTH, g_LOG_DIR & "/filter.log");
+        mixer_log      : axis_log(axi_aclk, enable, m_axis_mixer_output, C_DATA_WIDTH, g_LOG_DIR & "/mixer.log");
+    end generate;
+
+    -- clocks from i_en to the last channel out, checked against g_CYCLE_BUDGET
+    cycle_budget : if g_CYCLE_BUDGET > 0 generate
+        oscillator_budget : entity work.cycle_budget_monitor
+        generic map(
+            g_NAME      => "system_oscillator",
+            g_NUM_BEATS => C_NUM_CHANNELS,
+            g_BUDGET    => g_CYCLE_BUDGET
+        )
+        port map(
+            i_clk    => axi_aclk,
+            i_en     => enable,
+            i_tvalid => m_axis_osc_output.tvalid,
+            i_tready => m_axis_osc_output.tready
+        );
+
+        adsr_budget : entity work.cycle_budget_monitor
+        generic map(
+            g_NAME      => "system_adsr",
+            g_NUM_BEATS => C_NUM_CHANNELS,
+            g_BUDGET    => g_CYCLE_BUDGET
+        )
+        port map(
+            i_clk    => axi_aclk,
+            i_en     => enable,
+            i_tvalid => m_axis_adsr_output.tvalid,
+            i_tready => m_axis_adsr_output.tready
+        );
+
+        nca_budget : entity work.cycle_budget_monitor
+        generic map(
+            g_NAME      => "system_multiplier",
+            g_NUM_BEATS => C_NUM_CHANNELS,
+            g_BUDGET    => g_CYCLE_BUDGET
+        )
+        port map(
+            i_clk    => axi_aclk,
+            i_en     => enable,
+            i_tvalid => m_axis_nca_output.tvalid,
+            i_tready => m_axis_nca_output.tready
+        );
+
+        filter_budget : entity work.cycle_budget_monitor
+        generic map(
+            g_NAME      => "system_moog_filter",
+            g_NUM_BEATS => C_NUM_CHANNELS,
+            g_BUDGET    => g_CYCLE_BUDGET
+        )
+        port map(
+            i_clk    => axi_aclk,
+            i_en     => enable,
+            i_tvalid => m_axis_filter_output.tvalid,
+            i_tready => m_axis_filter_output.tready
+        );
+
+        mixer_budget : entity work.cycle_budget_monitor
+        generic map(
+            g_NAME      => "system_mixer",
+            g_NUM_BEATS => 1,
+            g_BUDGET    => g_CYCLE_BUDGET
+        )
+        port map(
+            i_clk    => axi_aclk,
+            i_en     => enable,
+            i_tvalid => w_mixer_output_valid,
+            i_tready => '1'
+        );
+    end generate;
+
+end tb;